@@ -264,6 +264,9 @@ void Agent::handleSelectedAudioFormat(QSharedPointer<ReceivedMessage> message) {
 }
 
 void Agent::selectAudioFormat(const QString& selectedCodecName) {
+    // the pump thread may be encoding with the current codec - swap under the lock
+    QMutexLocker encoderLocker(&_encoderMutex);
+
     if (_selectedCodecName == selectedCodecName) {
         return;
     }
@@ -440,25 +443,19 @@ void Agent::executeScript() {
 
     DependencyManager::set<AssignmentParentFinder>(_entityViewer.getTree());
 
-    // 100Hz timer for audio
+    // 100Hz audio and 45Hz avatar data, both pumped from a dedicated thread that sleeps
+    // to absolute deadlines - the direct connections run the handlers on that thread, so
+    // a script busy on this thread can't starve NPC audio or presence updates
     AvatarAudioTimer* audioTimerWorker = new AvatarAudioTimer();
     audioTimerWorker->moveToThread(&_avatarAudioTimerThread);
-    connect(audioTimerWorker, &AvatarAudioTimer::avatarTick, this, &Agent::processAgentAvatarAudio);
+    connect(audioTimerWorker, &AvatarAudioTimer::avatarTick, this, &Agent::processAgentAvatarAudio, Qt::DirectConnection);
+    connect(audioTimerWorker, &AvatarAudioTimer::avatarDataTick, this, &Agent::processAgentAvatar, Qt::DirectConnection);
     connect(this, &Agent::startAvatarAudioTimer, audioTimerWorker, &AvatarAudioTimer::start);
-    connect(this, &Agent::stopAvatarAudioTimer, audioTimerWorker, &AvatarAudioTimer::stop);
+    // stop must be direct - once the pump is running its thread never returns to the event loop
+    connect(this, &Agent::stopAvatarAudioTimer, audioTimerWorker, &AvatarAudioTimer::stop, Qt::DirectConnection);
     connect(&_avatarAudioTimerThread, &QThread::finished, audioTimerWorker, &QObject::deleteLater);
     _avatarAudioTimerThread.start();
 
-    // Agents should run at 45hz
-    static const int AVATAR_DATA_HZ = 45;
-    static const int AVATAR_DATA_IN_MSECS = MSECS_PER_SECOND / AVATAR_DATA_HZ;
-    QTimer* avatarDataTimer = new QTimer(this);
-    connect(avatarDataTimer, &QTimer::timeout, this, &Agent::processAgentAvatar);
-    avatarDataTimer->setSingleShot(false);
-    avatarDataTimer->setInterval(AVATAR_DATA_IN_MSECS);
-    avatarDataTimer->setTimerType(Qt::PreciseTimer);
-    avatarDataTimer->start();
-
     _scriptEngine->run();
 
     Frame::clearFrameHandler(AUDIO_FRAME_TYPE);
@@ -614,7 +611,15 @@ void Agent::processAgentAvatarAudio() {
     auto recordingInterface = DependencyManager::get<RecordingScriptingInterface>();
     bool isPlayingRecording = recordingInterface->isPlaying();
 
-    if (_isAvatar && ((_isListeningToAudioStream && !isPlayingRecording) || _avatarSound)) {
+    // hold our own reference to the sound for this frame, so the script thread swapping
+    // it out from under us can't invalidate the buffer we're reading
+    SharedSoundPointer avatarSound;
+    {
+        QMutexLocker lock(&_avatarSoundMutex);
+        avatarSound = _avatarSound;
+    }
+
+    if (_isAvatar && ((_isListeningToAudioStream && !isPlayingRecording) || avatarSound)) {
         // if we have an avatar audio stream then send it out to our audio-mixer
         auto scriptedAvatar = DependencyManager::get<ScriptableAvatar>();
         bool silentFrame = true;
@@ -622,8 +627,8 @@ void Agent::processAgentAvatarAudio() {
         int16_t numAvailableSamples = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
         const int16_t* nextSoundOutput = NULL;
 
-        if (_avatarSound) {
-            const QByteArray& soundByteArray = _avatarSound->getByteArray();
+        if (avatarSound) {
+            const QByteArray& soundByteArray = avatarSound->getByteArray();
             nextSoundOutput = reinterpret_cast<const int16_t*>(soundByteArray.data()
                     + _numAvatarSoundSentBytes);
 
@@ -645,12 +650,20 @@ void Agent::processAgentAvatarAudio() {
             if (_numAvatarSoundSentBytes == soundByteArray.size()) {
                 // we're done with this sound object - so set our pointer back to NULL
                 // and our sent bytes back to zero
-                _avatarSound.clear();
+                QMutexLocker lock(&_avatarSoundMutex);
+                if (_avatarSound == avatarSound) {
+                    // don't throw away a new sound the script set while we consumed this one
+                    _avatarSound.clear();
+                }
                 _numAvatarSoundSentBytes = 0;
                 _flushEncoder = true;
             }
         }
 
+        // codec negotiation on the agent thread may swap the encoder - build and encode
+        // this frame under the lock
+        QMutexLocker encoderLocker(&_encoderMutex);
+
         auto audioPacket = NLPacket::create(silentFrame && !_flushEncoder
                 ? PacketType::SilentAudioFrame
                 : PacketType::MicrophoneAudioNoEcho);
@@ -752,7 +765,12 @@ void Agent::aboutToFinish() {
     emit stopAvatarAudioTimer();
     _avatarAudioTimerThread.quit();
 
+    // make sure the pump thread has finished its last tick before we tear down
+    // the encoder it may be using
+    _avatarAudioTimerThread.wait();
+
     // cleanup codec & encoder
+    QMutexLocker encoderLocker(&_encoderMutex);
     if (_codec && _encoder) {
         _codec->releaseEncoder(_encoder);
         _encoder = nullptr;
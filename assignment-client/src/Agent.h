@@ -12,10 +12,12 @@
 #ifndef hifi_Agent_h
 #define hifi_Agent_h
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
 #include <QtScript/QScriptEngine>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtCore/QUrl>
 #include <QtCore/QTimer>
@@ -49,7 +51,7 @@ public:
     void setIsAvatar(bool isAvatar);
     bool isAvatar() const { return _isAvatar; }
 
-    bool isPlayingAvatarSound() const { return _avatarSound != NULL; }
+    bool isPlayingAvatarSound() const { QMutexLocker lock(&_avatarSoundMutex); return !_avatarSound.isNull(); }
 
     bool isListeningToAudioStream() const { return _isListeningToAudioStream; }
     void setIsListeningToAudioStream(bool isListeningToAudioStream);
@@ -97,17 +99,20 @@ private:
     MixedAudioStream _receivedAudioStream;
     float _lastReceivedAudioLoudness;
 
-    void setAvatarSound(SharedSoundPointer avatarSound) { _avatarSound = avatarSound; }
+    void setAvatarSound(SharedSoundPointer avatarSound) { QMutexLocker lock(&_avatarSoundMutex); _avatarSound = avatarSound; }
 
     void sendAvatarIdentityPacket();
 
     QString _scriptContents;
     QTimer* _scriptRequestTimeout { nullptr };
     ResourceRequest* _pendingScriptRequest { nullptr };
-    bool _isListeningToAudioStream = false;
+    // these members are shared with the avatar/audio pump thread, which reads them
+    // on every tick while the script thread changes them
+    std::atomic<bool> _isListeningToAudioStream { false };
+    mutable QMutex _avatarSoundMutex;
     SharedSoundPointer _avatarSound;
     int _numAvatarSoundSentBytes = 0;
-    bool _isAvatar = false;
+    std::atomic<bool> _isAvatar { false };
     QTimer* _avatarIdentityTimer = nullptr;
     QHash<QUuid, quint16> _outgoingScriptAudioSequenceNumbers;
 
@@ -115,6 +120,9 @@ private:
     bool _isNoiseGateEnabled { false };
 
     CodecPluginPointer _codec;
+    // guards the encoder and selected codec name, which the pump thread uses while
+    // codec negotiation on the agent thread can swap them
+    QMutex _encoderMutex;
     QString _selectedCodecName;
     Encoder* _encoder { nullptr };
     QThread _avatarAudioTimerThread;
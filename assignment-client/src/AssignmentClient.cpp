@@ -29,6 +29,7 @@
 #include <SharedUtil.h>
 #include <ShutdownEventListener.h>
 #include <SoundCache.h>
+#include <ResourceGovernor.h>
 #include <ResourceScriptingInterface.h>
 
 #include "AssignmentFactory.h"
@@ -36,6 +37,7 @@
 
 #include "AssignmentClient.h"
 #include "AssignmentClientLogging.h"
+#include "AssignmentClientStatusSegment.h"
 #include "avatars/ScriptableAvatar.h"
 #include <Trace.h>
 #include <StatTracker.h>
@@ -52,6 +54,7 @@ AssignmentClient::AssignmentClient(Assignment::Type requestAssignmentType, QStri
 
     DependencyManager::set<tracing::Tracer>();
     DependencyManager::set<StatTracker>();
+    DependencyManager::set<ResourceGovernor>();
     DependencyManager::set<AccountManager>();
 
     auto scriptableAvatar = DependencyManager::set<ScriptableAvatar>();
@@ -144,6 +147,8 @@ void AssignmentClient::stopAssignmentClient() {
     _requestTimer.stop();
     _statsTimerACM.stop();
 
+    releaseStatusSlot();
+
     if (_currentAssignment) {
         // grab the thread for the current assignment
         QThread* currentAssignmentThread = _currentAssignment->thread();
@@ -179,26 +184,85 @@ void AssignmentClient::aboutToQuit() {
 }
 
 void AssignmentClient::setUpStatusToMonitor() {
-    // send a stats packet every 1 seconds
+    // try to claim a slot in the monitor's shared status segment - once we have one,
+    // our once-per-second updates are in-place writes instead of loopback packets
+    _statusSharedMemory = new QSharedMemory(AssignmentClientStatus::sharedMemoryKey(_assignmentClientMonitorSocket.getPort()),
+                                            this);
+
+    if (_statusSharedMemory->attach()) {
+        _statusSharedMemory->lock();
+
+        auto slots = reinterpret_cast<AssignmentClientStatus::Slot*>(_statusSharedMemory->data());
+        for (int i = 0; i < AssignmentClientStatus::MAX_STATUS_SLOTS; i++) {
+            if (!slots[i].inUse) {
+                slots[i].inUse = 1;
+                slots[i].assignmentType = Assignment::Type::AllTypes;
+                slots[i].nodeLocalPort = DependencyManager::get<NodeList>()->getLocalSockAddr().getPort();
+                memcpy(slots[i].nodeUUID, _childAssignmentUUID.toRfc4122().constData(), sizeof(slots[i].nodeUUID));
+                slots[i].lastUpdateTimestamp = usecTimestampNow();
+
+                _statusSlotIndex = i;
+                break;
+            }
+        }
+
+        _statusSharedMemory->unlock();
+    }
+
+    if (_statusSlotIndex < 0) {
+        qCDebug(assignment_client) << "Could not claim a slot in the monitor's shared status segment"
+            << "- will fall back to status packets.";
+    }
+
+    // update our status for the monitor every 1 second
     connect(&_statsTimerACM, &QTimer::timeout, this, &AssignmentClient::sendStatusPacketToACM);
     _statsTimerACM.start(1000);
 }
 
+void AssignmentClient::releaseStatusSlot() {
+    if (_statusSlotIndex >= 0) {
+        // hand our slot in the shared status segment back to the monitor
+        _statusSharedMemory->lock();
+
+        auto slots = reinterpret_cast<AssignmentClientStatus::Slot*>(_statusSharedMemory->data());
+        slots[_statusSlotIndex].inUse = 0;
+
+        _statusSharedMemory->unlock();
+
+        _statusSlotIndex = -1;
+    }
+}
+
 void AssignmentClient::sendStatusPacketToACM() {
     // tell the assignment client monitor what this assignment client is doing (if anything)
     auto nodeList = DependencyManager::get<NodeList>();
-    
+
     quint8 assignmentType = Assignment::Type::AllTypes;
 
     if (_currentAssignment) {
         assignmentType = _currentAssignment->getType();
     }
 
+    if (_statusSlotIndex >= 0) {
+        // we own a slot in the monitor's shared status segment - update it in place and
+        // let the monitor pick the change up on its next scan
+        _statusSharedMemory->lock();
+
+        auto slot = reinterpret_cast<AssignmentClientStatus::Slot*>(_statusSharedMemory->data()) + _statusSlotIndex;
+        slot->assignmentType = assignmentType;
+        slot->nodeLocalPort = nodeList->getLocalSockAddr().getPort();
+        slot->lastUpdateTimestamp = usecTimestampNow();
+
+        _statusSharedMemory->unlock();
+
+        return;
+    }
+
     auto statusPacket = NLPacket::create(PacketType::AssignmentClientStatus, sizeof(assignmentType) + NUM_BYTES_RFC4122_UUID);
 
     statusPacket->write(_childAssignmentUUID.toRfc4122());
     statusPacket->writePrimitive(assignmentType);
-    
+
     nodeList->sendPacket(std::move(statusPacket), _assignmentClientMonitorSocket);
 }
 
@@ -243,6 +307,10 @@ void AssignmentClient::handleCreateAssignmentPacket(QSharedPointer<ReceivedMessa
         qDebug(assignment_client) << "Received an assignment -" << *_currentAssignment;
         _isAssigned = true;
 
+        // tell the resource governor what we're about to host so any configured
+        // per-type budget applies - done before the worker thread starts
+        DependencyManager::get<ResourceGovernor>()->setAssignmentTypeName(_currentAssignment->getTypeName());
+
         auto nodeList = DependencyManager::get<NodeList>();
 
         // switch our DomainHandler hostname and port to whoever sent us the assignment
@@ -44,6 +44,7 @@ private slots:
 
 private:
     void setUpStatusToMonitor();
+    void releaseStatusSlot();
 
     Assignment _requestAssignment;
     QPointer<ThreadedAssignment> _currentAssignment;
@@ -53,6 +54,8 @@ private:
     QTimer _requestTimer; // timer for requesting and assignment
     QTimer _statsTimerACM; // timer for sending stats to assignment client monitor
     QUuid _childAssignmentUUID = QUuid::createUuid();
+    QSharedMemory* _statusSharedMemory { nullptr };
+    int _statusSlotIndex { -1 }; // slot claimed in the monitor's shared status segment, -1 if none
 
  protected:
     HifiSockAddr _assignmentClientMonitorSocket;
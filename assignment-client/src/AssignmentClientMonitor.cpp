@@ -13,21 +13,28 @@
 #include <signal.h>
 
 #include <QDir>
+#include <QSharedMemory>
 #include <QStandardPaths>
 
 #include <AddressManager.h>
 #include <LogHandler.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
+#include <UUID.h>
 
 #include "AssignmentClientMonitor.h"
 #include "AssignmentClientApp.h"
 #include "AssignmentClientChildData.h"
+#include "AssignmentClientStatusSegment.h"
 #include "SharedUtil.h"
 #include <QtCore/QJsonDocument>
 
 const QString ASSIGNMENT_CLIENT_MONITOR_TARGET_NAME = "assignment-client-monitor";
 const int WAIT_FOR_CHILD_MSECS = 1000;
 
+// how often the shared status segment is scanned for child updates
+const int CHILD_STATUS_SCAN_INTERVAL_MSECS = 1 * 1000;
+
 AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmentClientForks,
                                                  const unsigned int minAssignmentClientForks,
                                                  const unsigned int maxAssignmentClientForks,
@@ -66,6 +73,25 @@ AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmen
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListener(PacketType::AssignmentClientStatus, this, "handleChildStatusPacket");
 
+    // create the shared status segment the children write into in place - one scan of the
+    // segment per interval replaces a second's worth of per-child loopback status packets
+    _statusSharedMemory = new QSharedMemory(AssignmentClientStatus::sharedMemoryKey(nodeList->getLocalSockAddr().getPort()),
+                                            this);
+
+    int statusSegmentSize = AssignmentClientStatus::MAX_STATUS_SLOTS * (int) sizeof(AssignmentClientStatus::Slot);
+
+    if (_statusSharedMemory->create(statusSegmentSize) || _statusSharedMemory->attach()) {
+        _statusSharedMemory->lock();
+        memset(_statusSharedMemory->data(), 0, statusSegmentSize);
+        _statusSharedMemory->unlock();
+
+        connect(&_scanStatusTimer, &QTimer::timeout, this, &AssignmentClientMonitor::scanChildStatusSegment);
+        _scanStatusTimer.start(CHILD_STATUS_SCAN_INTERVAL_MSECS);
+    } else {
+        qDebug() << "Failed to create shared status segment -" << _statusSharedMemory->errorString()
+            << "- children will fall back to status packets.";
+    }
+
     // use QProcess to fork off a process for each of the child assignment clients
     for (unsigned int i = 0; i < _numAssignmentClientForks; i++) {
         spawnChildClient();
@@ -265,57 +291,101 @@ void AssignmentClientMonitor::checkSpares() {
     }
 }
 
-void AssignmentClientMonitor::handleChildStatusPacket(QSharedPointer<ReceivedMessage> message) {
-    // read out the sender ID
-    QUuid senderID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
+void AssignmentClientMonitor::updateChildStatus(const QUuid& childID, const HifiSockAddr& childSockAddr,
+                                                Assignment::Type childType, quint64 heardAt) {
+    auto nodeList = DependencyManager::get<LimitedNodeList>();
 
-    auto nodeList = DependencyManager::get<NodeList>();
+    SharedNodePointer matchingNode = nodeList->nodeWithUUID(childID);
 
-    SharedNodePointer matchingNode = nodeList->nodeWithUUID(senderID);
-    const HifiSockAddr& senderSockAddr = message->getSenderSockAddr();
+    if (!matchingNode) {
+        // The parent only expects to be talking with programs running on this same machine.
+        if (childSockAddr.getAddress() != QHostAddress::LocalHost &&
+                childSockAddr.getAddress() != QHostAddress::LocalHostIPv6) {
+            return;
+        }
 
-    AssignmentClientChildData* childData = nullptr;
+        // We don't have this node yet - we should add it
+        matchingNode = nodeList->addOrUpdateNode(childID, NodeType::Unassigned, childSockAddr, childSockAddr);
 
-    if (!matchingNode) {
-        // The parent only expects to be talking with prorams running on this same machine.
-        if (senderSockAddr.getAddress() == QHostAddress::LocalHost ||
-                senderSockAddr.getAddress() == QHostAddress::LocalHostIPv6) {
+        auto childData = std::unique_ptr<AssignmentClientChildData>
+            { new AssignmentClientChildData(Assignment::Type::AllTypes) };
+        matchingNode->setLinkedData(std::move(childData));
+    }
+
+    AssignmentClientChildData* childData = dynamic_cast<AssignmentClientChildData*>(matchingNode->getLinkedData());
+
+    if (childData) {
+        // update our records about how to reach this child
+        matchingNode->setLocalSocket(childSockAddr);
+
+        childData->setChildType(childType);
+
+        // note when this child talked
+        matchingNode->setLastHeardMicrostamp(heardAt);
+    }
+}
 
-            if (!senderID.isNull()) {
-                // We don't have this node yet - we should add it
-                matchingNode = DependencyManager::get<LimitedNodeList>()->addOrUpdateNode(senderID, NodeType::Unassigned,
-                                                                                          senderSockAddr, senderSockAddr);
+void AssignmentClientMonitor::scanChildStatusSegment() {
+    quint64 now = usecTimestampNow();
 
-                auto childData = std::unique_ptr<AssignmentClientChildData>
-                    { new AssignmentClientChildData(Assignment::Type::AllTypes) };
-                matchingNode->setLinkedData(std::move(childData));
-            } else {
-                // tell unknown assignment-client child to exit.
-                qDebug() << "Asking unknown child at" << senderSockAddr << "to exit.";
+    // a slot whose owner has stopped writing for several update intervals belongs to a
+    // dead child - hand it back so a replacement can claim it
+    const quint64 STALE_STATUS_SLOT_USECS = NODE_SILENCE_THRESHOLD_MSECS * USECS_PER_MSEC;
 
-                auto diePacket = NLPacket::create(PacketType::StopNode, 0);
-                nodeList->sendPacket(std::move(diePacket), senderSockAddr);
+    std::vector<AssignmentClientStatus::Slot> statusSlots(AssignmentClientStatus::MAX_STATUS_SLOTS);
 
-                return;
+    // copy the segment out under the lock, reclaiming stale slots as we go, so the node
+    // bookkeeping below doesn't hold the children's writes up
+    _statusSharedMemory->lock();
+
+    auto sharedSlots = reinterpret_cast<AssignmentClientStatus::Slot*>(_statusSharedMemory->data());
+    for (int i = 0; i < AssignmentClientStatus::MAX_STATUS_SLOTS; i++) {
+        if (sharedSlots[i].inUse && now - sharedSlots[i].lastUpdateTimestamp > STALE_STATUS_SLOT_USECS) {
+            sharedSlots[i].inUse = 0;
+        }
+
+        statusSlots[i] = sharedSlots[i];
+    }
+
+    _statusSharedMemory->unlock();
+
+    for (auto& statusSlot : statusSlots) {
+        if (statusSlot.inUse) {
+            QUuid childID = QUuid::fromRfc4122(QByteArray::fromRawData(reinterpret_cast<const char*>(statusSlot.nodeUUID),
+                                                                       sizeof(statusSlot.nodeUUID)));
+
+            if (!childID.isNull()) {
+                updateChildStatus(childID, HifiSockAddr(QHostAddress::LocalHost, statusSlot.nodeLocalPort),
+                                  Assignment::Type(statusSlot.assignmentType), statusSlot.lastUpdateTimestamp);
             }
         }
-    } else {
-        childData = dynamic_cast<AssignmentClientChildData*>(matchingNode->getLinkedData());
     }
+}
 
-    if (childData) {
-        // update our records about how to reach this child
-        matchingNode->setLocalSocket(senderSockAddr);
+void AssignmentClientMonitor::handleChildStatusPacket(QSharedPointer<ReceivedMessage> message) {
+    // read out the sender ID
+    QUuid senderID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
 
-        // get child's assignment type out of the packet
-        quint8 assignmentType;
-        message->readPrimitive(&assignmentType);
+    const HifiSockAddr& senderSockAddr = message->getSenderSockAddr();
 
-        childData->setChildType(Assignment::Type(assignmentType));
+    if (senderID.isNull()) {
+        if (senderSockAddr.getAddress() == QHostAddress::LocalHost ||
+                senderSockAddr.getAddress() == QHostAddress::LocalHostIPv6) {
+            // tell unknown assignment-client child to exit.
+            qDebug() << "Asking unknown child at" << senderSockAddr << "to exit.";
 
-        // note when this child talked
-        matchingNode->setLastHeardMicrostamp(usecTimestampNow());
+            auto diePacket = NLPacket::create(PacketType::StopNode, 0);
+            DependencyManager::get<NodeList>()->sendPacket(std::move(diePacket), senderSockAddr);
+        }
+
+        return;
     }
+
+    // get child's assignment type out of the packet
+    quint8 assignmentType;
+    message->readPrimitive(&assignmentType);
+
+    updateChildStatus(senderID, senderSockAddr, Assignment::Type(assignmentType), usecTimestampNow());
 }
 
 bool AssignmentClientMonitor::handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) {
@@ -336,6 +406,21 @@ bool AssignmentClientMonitor::handleHTTPRequest(HTTPConnection* connection, cons
 
         status["servers"] = servers;
 
+        // one consolidated view of every child's last reported status
+        QJsonObject children;
+        quint64 now = usecTimestampNow();
+        DependencyManager::get<LimitedNodeList>()->eachNode([&](const SharedNodePointer& node) {
+            AssignmentClientChildData* childData = static_cast<AssignmentClientChildData*>(node->getLinkedData());
+
+            QJsonObject child;
+            child["type"] = childData->getChildType();
+            child["heard_ms_ago"] = double((now - node->getLastHeardMicrostamp()) / USECS_PER_MSEC);
+
+            children[uuidStringWithoutCurlyBraces(node->getUUID())] = child;
+        });
+
+        status["children"] = children;
+
         QJsonDocument document { status };
 
         connection->respond(HTTPConnection::StatusCode200, document.toJson());
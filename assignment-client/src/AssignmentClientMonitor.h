@@ -26,6 +26,8 @@
 
 extern const char* NUM_FORKS_PARAMETER;
 
+class QSharedMemory;
+
 struct ACProcess {
     QProcess* process; // looks like a dangling pointer, but is parented by the AssignmentClientMonitor 
     QString logStdoutPath;
@@ -46,6 +48,7 @@ private slots:
     void checkSpares();
     void childProcessFinished(qint64 pid);
     void handleChildStatusPacket(QSharedPointer<ReceivedMessage> message);
+    void scanChildStatusSegment();
 
     bool handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler = false) override;
 
@@ -55,8 +58,12 @@ public slots:
 private:
     void spawnChildClient();
     void simultaneousWaitOnChildren(int waitMsecs);
+    void updateChildStatus(const QUuid& childID, const HifiSockAddr& childSockAddr,
+                           Assignment::Type childType, quint64 heardAt);
 
     QTimer _checkSparesTimer; // every few seconds see if it need fewer or more spare children
+    QTimer _scanStatusTimer; // once per second collect all child status from the shared segment
+    QSharedMemory* _statusSharedMemory { nullptr }; // status slots the children write into in place
 
     QDir _logDirectory;
 
@@ -0,0 +1,39 @@
+//
+//  AssignmentClientStatusSegment.h
+//  assignment-client/src
+//
+//  Created by Stephen Birarda on 2016-04-20.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssignmentClientStatusSegment_h
+#define hifi_AssignmentClientStatusSegment_h
+
+#include <QtCore/QString>
+
+// Layout of the shared memory segment the assignment-client monitor creates for its children.
+// Each child claims one slot and updates its status in place once per second; the monitor
+// scans the whole segment once per interval, so a host full of children generates no
+// loopback status packets or per-child wakeups at all.
+
+namespace AssignmentClientStatus {
+    const int MAX_STATUS_SLOTS = 512;
+
+    struct Slot {
+        quint8 inUse;
+        quint8 assignmentType; // Assignment::Type, AllTypes when the child is a spare
+        quint16 nodeLocalPort; // the child's NodeList port, so the monitor can send it packets
+        quint8 nodeUUID[16]; // the child's session UUID, in RFC 4122 byte order
+        quint64 lastUpdateTimestamp; // usecTimestampNow of the child's last in-place write
+    };
+
+    inline QString sharedMemoryKey(quint16 monitorPort) {
+        // keyed on the monitor's port so several monitors can share a host
+        return QString("hifi-assignment-client-status-%1").arg(monitorPort);
+    }
+}
+
+#endif // hifi_AssignmentClientStatusSegment_h
@@ -9,15 +9,24 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 #include <QDebug>
+#include <NumericalConstants.h>
 #include <SharedUtil.h>
 #include "AvatarAudioTimer.h"
 
 // this should send a signal every 10ms, with pretty good precision.  Hardcoding
-// to 10ms since that's what you'd want for audio.  
+// to 10ms since that's what you'd want for audio.
 void AvatarAudioTimer::start() {
+    _quit = false;
+
     auto startTime = usecTimestampNow();
     quint64 frameCounter = 0;
     const int TARGET_INTERVAL_USEC = 10000; // 10ms
+
+    // avatar data ticks are scheduled on the same absolute timeline, so both cadences
+    // hold their average rate no matter how late any individual wakeup is
+    const quint64 AVATAR_DATA_INTERVAL_USEC = USECS_PER_SECOND / 45;
+    quint64 nextAvatarDataTime = startTime + AVATAR_DATA_INTERVAL_USEC;
+
     while (!_quit) {
         ++frameCounter;
 
@@ -31,6 +40,11 @@ void AvatarAudioTimer::start() {
         }
 
         emit avatarTick();
+
+        if (targetTime >= nextAvatarDataTime) {
+            nextAvatarDataTime += AVATAR_DATA_INTERVAL_USEC;
+            emit avatarDataTick();
+        }
     }
     qDebug() << "AvatarAudioTimer is finished";
 }
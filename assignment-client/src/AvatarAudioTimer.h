@@ -12,6 +12,8 @@
 #ifndef hifi_AvatarAudioTimer_h
 #define hifi_AvatarAudioTimer_h
 
+#include <atomic>
+
 #include <QtCore/QObject>
 
 class AvatarAudioTimer : public QObject {
@@ -19,13 +21,16 @@ class AvatarAudioTimer : public QObject {
 
 signals:
     void avatarTick();
+    void avatarDataTick();
 
 public slots:
     void start();
+
+    // called via a direct connection since start() never returns to the event loop
     void stop() { _quit = true; }
 
 private:
-    bool _quit { false };
+    std::atomic<bool> _quit { false };
 };
 
 #endif //hifi_AvatarAudioTimer_h
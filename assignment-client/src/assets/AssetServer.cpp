@@ -218,6 +218,9 @@ void AssetServer::cleanupUnmappedFiles() {
                 QFile removeableFile { fileInfo.absoluteFilePath() };
 
                 if (removeableFile.remove()) {
+                    // make sure we aren't holding a stale mapping for the deleted file
+                    _mappedAssetCache.remove(fileInfo.fileName());
+
                     qDebug() << "\tDeleted" << fileInfo.fileName() << "from asset files directory since it is unmapped.";
                 } else {
                     qDebug() << "\tAttempt to delete unmapped file" << fileInfo.fileName() << "failed";
@@ -388,7 +391,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, &_mappedAssetCache);
     _taskPool.start(task);
 }
 
@@ -672,6 +675,9 @@ bool AssetServer::deleteMappings(AssetPathList& paths) {
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
 
             if (removeableFile.remove()) {
+                // make sure we aren't holding a stale mapping for the deleted file
+                _mappedAssetCache.remove(hash);
+
                 qDebug() << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
             } else {
                 qDebug() << "\tAttempt to delete unmapped file" << hash << "failed";
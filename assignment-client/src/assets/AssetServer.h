@@ -18,6 +18,7 @@
 #include <ThreadedAssignment.h>
 
 #include "AssetUtils.h"
+#include "MappedAssetCache.h"
 #include "ReceivedMessage.h"
 
 class AssetServer : public ThreadedAssignment {
@@ -68,6 +69,9 @@ private:
     QDir _resourcesDirectory;
     QDir _filesDirectory;
     QThreadPool _taskPool;
+
+    // hot-set of mapped asset files shared with send tasks on the task pool
+    MappedAssetCache _mappedAssetCache;
 };
 
 #endif
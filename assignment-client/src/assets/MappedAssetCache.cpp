@@ -0,0 +1,102 @@
+//
+//  MappedAssetCache.cpp
+//  assignment-client/src/assets
+//
+//  Created by Ryan Huffman on 2016/04/15
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MappedAssetCache.h"
+
+#include <NetworkLogging.h>
+
+// total bytes of asset file we will keep mapped - this bounds address space and open file
+// descriptors, not resident memory, since the mappings are file-backed
+static const qint64 MAX_MAPPED_ASSET_BYTES = 1024 * 1024 * 1024;
+
+MappedAsset::MappedAsset(const QString& filePath) :
+    _file(filePath)
+{
+    if (_file.open(QIODevice::ReadOnly)) {
+        _size = _file.size();
+
+        if (_size > 0) {
+            _data = _file.map(0, _size);
+
+            if (!_data) {
+                qCWarning(networking) << "Failed to map asset file" << filePath;
+            }
+        }
+
+        // the mapping outlives the file handle, so we can give the descriptor back right away
+        // for empty or unmappable files there is nothing to hold on to either
+        _file.close();
+    }
+}
+
+MappedAssetPointer MappedAssetCache::getMappedAsset(const QDir& filesDir, const QString& hexHash) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(hexHash);
+    if (it != _entries.end()) {
+        // cache hit - move this asset to the front of the LRU order
+        _lruOrder.erase(it->lruIterator);
+        _lruOrder.push_front(hexHash);
+        it->lruIterator = _lruOrder.begin();
+
+        return it->asset;
+    }
+
+    QString filePath = filesDir.filePath(hexHash);
+
+    if (!QFile::exists(filePath)) {
+        return MappedAssetPointer();
+    }
+
+    auto mappedAsset = std::make_shared<MappedAsset>(filePath);
+
+    if (!mappedAsset->isValid()) {
+        // an empty asset maps to nothing but is still servable - hand it back without caching
+        if (mappedAsset->size() == 0) {
+            return mappedAsset;
+        }
+
+        return MappedAssetPointer();
+    }
+
+    _lruOrder.push_front(hexHash);
+    _entries.insert(hexHash, { mappedAsset, _lruOrder.begin() });
+    _totalMappedBytes += mappedAsset->size();
+
+    evictToBudget();
+
+    return mappedAsset;
+}
+
+void MappedAssetCache::remove(const QString& hexHash) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(hexHash);
+    if (it != _entries.end()) {
+        _totalMappedBytes -= it->asset->size();
+        _lruOrder.erase(it->lruIterator);
+        _entries.erase(it);
+    }
+}
+
+void MappedAssetCache::evictToBudget() {
+    // walk up from the least recently used end until we are back under budget,
+    // always keeping the mapping we just added
+    while (_totalMappedBytes > MAX_MAPPED_ASSET_BYTES && _lruOrder.size() > 1) {
+        QString& oldestHash = _lruOrder.back();
+
+        auto it = _entries.find(oldestHash);
+        _totalMappedBytes -= it->asset->size();
+        _entries.erase(it);
+
+        _lruOrder.pop_back();
+    }
+}
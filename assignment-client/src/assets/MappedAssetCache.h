@@ -0,0 +1,70 @@
+//
+//  MappedAssetCache.h
+//  assignment-client/src/assets
+//
+//  Created by Ryan Huffman on 2016/04/15
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MappedAssetCache_h
+#define hifi_MappedAssetCache_h
+
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+// A memory-mapped view of one content-addressed asset file. The pages backing the view are
+// file-backed and faulted in on demand, so a mapping costs address space and a file descriptor
+// rather than committed memory - the kernel page cache decides which parts of the file stay hot.
+class MappedAsset {
+public:
+    MappedAsset(const QString& filePath);
+
+    bool isValid() const { return _data != nullptr; }
+    const char* data() const { return reinterpret_cast<const char*>(_data); }
+    qint64 size() const { return _size; }
+
+private:
+    QFile _file; // keeps the mapping alive - it is released when the QFile is destroyed
+    uchar* _data { nullptr };
+    qint64 _size { 0 };
+};
+
+using MappedAssetPointer = std::shared_ptr<MappedAsset>;
+
+// An LRU hot-set of mapped asset files, keyed by hex content hash. Since asset files are
+// content addressed they never change under a mapping, so a cached mapping stays valid until
+// the file is deleted. Send tasks on the task pool hold shared pointers to the mappings they
+// are serving from, so eviction never unmaps a file that is mid-send.
+class MappedAssetCache {
+public:
+    // returns a mapping for the given asset, re-using a cached one when possible,
+    // or a null pointer if the file does not exist or cannot be mapped
+    MappedAssetPointer getMappedAsset(const QDir& filesDir, const QString& hexHash);
+
+    // drops any cached mapping for the given asset - called when the backing file is deleted
+    void remove(const QString& hexHash);
+
+private:
+    struct Entry {
+        MappedAssetPointer asset;
+        std::list<QString>::iterator lruIterator;
+    };
+
+    void evictToBudget();
+
+    std::mutex _mutex;
+    std::list<QString> _lruOrder; // front is most recently used
+    QHash<QString, Entry> _entries;
+    qint64 _totalMappedBytes { 0 };
+};
+
+#endif // hifi_MappedAssetCache_h
@@ -11,8 +11,6 @@
 
 #include "SendAssetTask.h"
 
-#include <QFile>
-
 #include <DependencyManager.h>
 #include <NetworkLogging.h>
 #include <NLPacket.h>
@@ -23,13 +21,15 @@
 #include "AssetUtils.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             MappedAssetCache* mappedAssetCache) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _mappedAssetCache(mappedAssetCache)
 {
-    
+
 }
 
 void SendAssetTask::run() {
@@ -59,25 +59,23 @@ void SendAssetTask::run() {
     if (end <= start) {
         replyPacketList->writePrimitive(AssetServerError::InvalidByteRange);
     } else {
-        QString filePath = _resourcesDir.filePath(QString(hexHash));
-        
-        QFile file { filePath };
+        // serve the range straight out of a shared file mapping - the hot-set cache hands
+        // concurrent requests for the same asset the same pages instead of a heap copy each
+        auto mappedAsset = _mappedAssetCache->getMappedAsset(_resourcesDir, QString(hexHash));
 
-        if (file.open(QIODevice::ReadOnly)) {
-            if (file.size() < end) {
+        if (mappedAsset) {
+            if (mappedAsset->size() < end) {
                 replyPacketList->writePrimitive(AssetServerError::InvalidByteRange);
                 qCDebug(networking) << "Bad byte range: " << hexHash << " " << start << ":" << end;
             } else {
                 auto size = end - start;
-                file.seek(start);
                 replyPacketList->writePrimitive(AssetServerError::NoError);
                 replyPacketList->writePrimitive(size);
-                replyPacketList->write(file.read(size));
+                replyPacketList->write(mappedAsset->data() + start, size);
                 qCDebug(networking) << "Sending asset: " << hexHash;
             }
-            file.close();
         } else {
-            qCDebug(networking) << "Asset not found: " << filePath << "(" << hexHash << ")";
+            qCDebug(networking) << "Asset not found: " << _resourcesDir.filePath(QString(hexHash)) << "(" << hexHash << ")";
             replyPacketList->writePrimitive(AssetServerError::AssetNotFound);
         }
     }
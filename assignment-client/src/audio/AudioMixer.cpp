@@ -24,6 +24,7 @@
 #include <plugins/PluginManager.h>
 #include <plugins/CodecPlugin.h>
 #include <udt/PacketHeaders.h>
+#include <ResourceGovernor.h>
 #include <SharedUtil.h>
 #include <StDev.h>
 #include <UUID.h>
@@ -157,6 +158,41 @@ const std::pair<QString, CodecPluginPointer> AudioMixer::negotiateCodec(std::vec
     return std::make_pair(selectedCodecName, _availableCodecs[selectedCodecName]);
 }
 
+// relative network cost of the codecs we know about. CodecPlugin has no bitrate API, so this
+// fixed ranking is what falling back to a "cheaper" codec means; codecs we don't recognize are
+// assumed to be compressed
+static int codecNetworkCost(const QString& codecName) {
+    if (codecName == "pcm") {
+        return 2;
+    }
+    if (codecName == "zlib") {
+        return 1;
+    }
+    return 0;
+}
+
+const std::pair<QString, CodecPluginPointer> AudioMixer::robustCodec(std::vector<QString> codecs) {
+    QString selectedCodecName;
+    int minCost = std::numeric_limits<int>::max();
+
+    // of the codecs the client offered that we also have, pick the cheapest one on the wire
+    for (auto& codec : codecs) {
+        if (_availableCodecs.count(codec) > 0 && _codecPreferenceOrder.indexOf(codec) >= 0) {
+            int cost = codecNetworkCost(codec);
+
+            if (cost < minCost) {
+                minCost = cost;
+                selectedCodecName = codec;
+            }
+        }
+    }
+
+    if (selectedCodecName.isEmpty()) {
+        return std::make_pair(selectedCodecName, CodecPluginPointer());
+    }
+    return std::make_pair(selectedCodecName, _availableCodecs[selectedCodecName]);
+}
+
 void AudioMixer::handleNodeKilled(SharedNodePointer killedNode) {
     // enumerate the connected listeners to remove HRTF objects for the disconnected node
     auto nodeList = DependencyManager::get<NodeList>();
@@ -362,6 +398,9 @@ void AudioMixer::start() {
             auto timer = _sleepTiming.timer();
             auto frameDuration = timeFrame(frameTimestamp);
             throttle(frameDuration, frame);
+            if (_autoThreads) {
+                autoscale(frame);
+            }
         }
 
         auto frameTimer = _frameTiming.timer();
@@ -378,7 +417,8 @@ void AudioMixer::start() {
             // mix across slave threads
             {
                 auto mixTimer = _mixTiming.timer();
-                _slavePool.mix(cbegin, cend, frame, _throttlingRatio);
+                _spatialIndex.rebuild(cbegin, cend);
+                _slavePool.mix(cbegin, cend, frame, _throttlingRatio, &_spatialIndex);
             }
         });
 
@@ -465,8 +505,19 @@ void AudioMixer::throttle(std::chrono::microseconds duration, int frame) {
     _trailingMixRatio = PREVIOUS_FRAMES_RATIO * _trailingMixRatio + CURRENT_FRAME_RATIO * mixRatio;
 
     if (frame % TRAILING_FRAMES == 0) {
-        if (_trailingMixRatio > TARGET) {
+        // the process-wide resource governor can also demand throttling - our own
+        // mix/sleep ratio may look healthy while we starve a co-hosted assignment
+        auto resourceGovernor = DependencyManager::get<ResourceGovernor>();
+        bool overCPUBudget = resourceGovernor && resourceGovernor->isOverCPUBudget();
+
+        if (_trailingMixRatio > TARGET || overCPUBudget) {
             int proportionalTerm = 1 + (_trailingMixRatio - TARGET) / 0.1f;
+            if (proportionalTerm < 1) {
+                proportionalTerm = 1; // over the CPU budget but under the mix target - creep up slowly
+            }
+            if (overCPUBudget) {
+                resourceGovernor->noteThrottle();
+            }
             _throttlingRatio += THROTTLE_RATE * proportionalTerm;
             _throttlingRatio = std::min(_throttlingRatio, 1.0f);
             qDebug("audio-mixer is struggling (%f mix/sleep) - throttling %f of streams",
@@ -481,6 +532,35 @@ void AudioMixer::throttle(std::chrono::microseconds duration, int frame) {
     }
 }
 
+void AudioMixer::autoscale(int frame) {
+    // grow/shrink the slave pool to track co-tenant load, using the same trailing
+    // mix/sleep ratio as the throttle; growth triggers below the throttle TARGET
+    // so a new thread is tried before any streams are dropped
+    const int AUTOSCALE_WINDOW = 500;   // frames, 5s - resizing churns caches, do it rarely
+    if (frame % AUTOSCALE_WINDOW != 0) {
+        return;
+    }
+
+    const float GROW_TARGET = 0.8f;
+    // shrink only when the projected load on the remaining threads leaves ample headroom,
+    // to prevent grow/shrink oscillation
+    const float SHRINK_HEADROOM = 0.5f;
+
+    int numThreads = _slavePool.numThreads();
+    if (_trailingMixRatio > GROW_TARGET && numThreads < AudioMixerSlavePool::maxNumThreads()) {
+        _slavePool.setNumThreads(numThreads + 1);
+        qDebug("audio-mixer is loaded (%f mix/sleep) - growing to %d threads",
+                (double)_trailingMixRatio, numThreads + 1);
+    } else if (numThreads > 1) {
+        float projectedMixRatio = _trailingMixRatio * numThreads / (numThreads - 1);
+        if (projectedMixRatio < SHRINK_HEADROOM) {
+            _slavePool.setNumThreads(numThreads - 1);
+            qDebug("audio-mixer is idle (%f mix/sleep) - shrinking to %d threads",
+                    (double)_trailingMixRatio, numThreads - 1);
+        }
+    }
+}
+
 int AudioMixer::prepareFrame(const SharedNodePointer& node, unsigned int frame) {
     AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
     if (data == nullptr) {
@@ -497,6 +577,7 @@ void AudioMixer::parseSettingsObject(const QJsonObject &settingsObject) {
         QJsonObject audioThreadingGroupObject = settingsObject[AUDIO_THREADING_GROUP_KEY].toObject();
         const QString AUTO_THREADS = "auto_threads";
         bool autoThreads = audioThreadingGroupObject[AUTO_THREADS].toBool();
+        _autoThreads = autoThreads;
         if (!autoThreads) {
             bool ok;
             const QString NUM_THREADS = "num_threads";
@@ -20,6 +20,7 @@
 
 #include "AudioMixerStats.h"
 #include "AudioMixerSlavePool.h"
+#include "AudioMixerSpatialIndex.h"
 
 class PositionalAudioStream;
 class AvatarAudioStream;
@@ -50,6 +51,8 @@ public:
     static const QVector<ZoneSettings>& getZoneSettings() { return _zoneSettings; }
     static const QVector<ReverbSettings>& getReverbSettings() { return _zoneReverbSettings; }
     static const std::pair<QString, CodecPluginPointer> negotiateCodec(std::vector<QString> codecs);
+    // the lowest-network-cost codec both sides can use - what a lossy downstream link falls back to
+    static const std::pair<QString, CodecPluginPointer> robustCodec(std::vector<QString> codecs);
 
 public slots:
     void run() override;
@@ -70,6 +73,8 @@ private:
     // mixing helpers
     std::chrono::microseconds timeFrame(p_high_resolution_clock::time_point& timestamp);
     void throttle(std::chrono::microseconds frameDuration, int frame);
+    // grow/shrink the slave pool to track the trailing mix load (when auto_threads is set)
+    void autoscale(int frame);
     // pop a frame from any streams on the node
     // returns the number of available streams
     int prepareFrame(const SharedNodePointer& node, unsigned int frame);
@@ -82,6 +87,7 @@ private:
 
     float _trailingMixRatio { 0.0f };
     float _throttlingRatio { 0.0f };
+    bool _autoThreads { false };
 
     int _numSilentPackets { 0 };
 
@@ -89,6 +95,7 @@ private:
     AudioMixerStats _stats;
 
     AudioMixerSlavePool _slavePool;
+    AudioMixerSpatialIndex _spatialIndex;
 
     class Timer {
     public:
@@ -9,6 +9,7 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <algorithm>
 #include <random>
 
 #include <QtCore/QDebug>
@@ -55,6 +56,14 @@ void AudioMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message,
     _packetQueue.push(message);
 }
 
+static bool isAudioDataPacket(PacketType packetType) {
+    return packetType == PacketType::MicrophoneAudioNoEcho
+        || packetType == PacketType::MicrophoneAudioWithEcho
+        || packetType == PacketType::InjectAudio
+        || packetType == PacketType::AudioStreamStats
+        || packetType == PacketType::SilentAudioFrame;
+}
+
 void AudioMixerClientData::processPackets() {
     SharedNodePointer node = _packetQueue.node;
     assert(_packetQueue.empty() || node);
@@ -69,9 +78,16 @@ void AudioMixerClientData::processPackets() {
             case PacketType::InjectAudio:
             case PacketType::AudioStreamStats:
             case PacketType::SilentAudioFrame: {
+                // drain every consecutive audio packet in one batch, under one lock acquisition
+                _audioPacketBatch.clear();
+                while (!_packetQueue.empty() && isAudioDataPacket(_packetQueue.front()->getType())) {
+                    _audioPacketBatch.push_back(_packetQueue.front());
+                    _packetQueue.pop();
+                }
+
                 QMutexLocker lock(&getMutex());
-                parseData(*packet);
-                break;
+                parseAudioBatch(_audioPacketBatch);
+                continue;   // the batch was already popped from the queue
             }
             case PacketType::NegotiateAudioFormat:
                 negotiateAudioFormat(*packet, node);
@@ -106,10 +122,72 @@ void AudioMixerClientData::negotiateAudioFormat(ReceivedMessage& message, const
     }
     const std::pair<QString, CodecPluginPointer> codec = AudioMixer::negotiateCodec(codecs);
 
+    // remember what the client offered so the codec can be renegotiated against link quality later
+    _offeredCodecs = codecs;
+    _usingRobustCodec = false;
+    _lossyStatsIntervals = 0;
+    _cleanStatsIntervals = 0;
+
     setupCodec(codec.second, codec.first);
     sendSelectAudioFormat(node, codec.first);
 }
 
+void AudioMixerClientData::checkCodecForLinkQuality(const SharedNodePointer& node) {
+    // thresholds on the lost rate the client reports for its downstream mixed stream, with
+    // hysteresis on both sides so a single bad interval doesn't flap the codec
+    const float LOSS_STEP_DOWN_THRESHOLD = 0.05f;
+    const float LOSS_STEP_UP_THRESHOLD = 0.01f;
+    const int STEP_DOWN_AFTER_INTERVALS = 3;    // ~3s of sustained loss before falling back
+    const int STEP_UP_AFTER_INTERVALS = 30;     // ~30s clean before going back up
+
+    if (_offeredCodecs.empty()) {
+        return;
+    }
+
+    float lostRate = _downstreamAudioStreamStats._packetStreamWindowStats.getLostRate();
+
+    if (lostRate >= LOSS_STEP_DOWN_THRESHOLD) {
+        _cleanStatsIntervals = 0;
+        _lossyStatsIntervals++;
+    } else if (lostRate <= LOSS_STEP_UP_THRESHOLD) {
+        _lossyStatsIntervals = 0;
+        _cleanStatsIntervals++;
+    } else {
+        // in between the thresholds - hold whatever codec we're on
+        _lossyStatsIntervals = 0;
+        _cleanStatsIntervals = 0;
+    }
+
+    if (!_usingRobustCodec && _lossyStatsIntervals >= STEP_DOWN_AFTER_INTERVALS) {
+        _lossyStatsIntervals = 0;
+
+        auto robust = AudioMixer::robustCodec(_offeredCodecs);
+        if (!robust.first.isEmpty() && robust.first != _selectedCodecName) {
+            qDebug() << "Downstream link to" << getNodeID() << "reports" << lostRate * 100.0f
+                << "% loss - falling back from codec" << _selectedCodecName << "to" << robust.first;
+
+            // swap our coders under the same lock that guards packet parsing, then tell the client
+            QMutexLocker lock(&getMutex());
+            setupCodec(robust.second, robust.first);
+            sendSelectAudioFormat(node, robust.first);
+        }
+        _usingRobustCodec = true;
+    } else if (_usingRobustCodec && _cleanStatsIntervals >= STEP_UP_AFTER_INTERVALS) {
+        _cleanStatsIntervals = 0;
+
+        auto preferred = AudioMixer::negotiateCodec(_offeredCodecs);
+        if (!preferred.first.isEmpty() && preferred.first != _selectedCodecName) {
+            qDebug() << "Downstream link to" << getNodeID() << "has been clean - returning to codec"
+                << preferred.first;
+
+            QMutexLocker lock(&getMutex());
+            setupCodec(preferred.second, preferred.first);
+            sendSelectAudioFormat(node, preferred.first);
+        }
+        _usingRobustCodec = false;
+    }
+}
+
 void AudioMixerClientData::parseRequestsDomainListData(ReceivedMessage& message) {
     bool isRequesting;
     message.readPrimitive(&isRequesting);
@@ -183,10 +261,33 @@ int AudioMixerClientData::parseData(ReceivedMessage& message) {
         return message.getPosition();
 
     } else {
-        SharedStreamPointer matchingStream;
-
         bool isMicStream = false;
+        SharedStreamPointer matchingStream = resolveAudioStream(message, isMicStream);
+
+        // seek to the beginning of the packet so that the next reader is in the right spot
+        message.seek(0);
+
+        // check the overflow count before we parse data
+        auto overflowBefore = matchingStream->getOverflowCount();
+        auto parseResult = matchingStream->parseData(message);
+
+        if (matchingStream->getOverflowCount() > overflowBefore) {
+            qDebug() << "Just overflowed on stream from" << message.getSourceID() << "at" << message.getSenderSockAddr();
+            qDebug() << "This stream is for" << (isMicStream ? "microphone audio" : "injected audio");
+        }
+
+        return parseResult;
+    }
+    return 0;
+}
 
+SharedStreamPointer AudioMixerClientData::resolveAudioStream(ReceivedMessage& message, bool& isMicStream) {
+    PacketType packetType = message.getType();
+    SharedStreamPointer matchingStream;
+
+    isMicStream = false;
+
+    {
         if (packetType == PacketType::MicrophoneAudioWithEcho
             || packetType == PacketType::MicrophoneAudioNoEcho
             || packetType == PacketType::SilentAudioFrame) {
@@ -258,22 +359,47 @@ int AudioMixerClientData::parseData(ReceivedMessage& message) {
 
             writeLock.unlock();
         }
+    }
+
+    return matchingStream;
+}
+
+void AudioMixerClientData::parseAudioBatch(std::vector<QSharedPointer<ReceivedMessage>>& messages) {
+    // group the batch by target stream, preserving arrival order within each stream
+    _streamBatches.clear();
+
+    for (auto& message : messages) {
+        if (message->getType() == PacketType::AudioStreamStats) {
+            parseData(*message);
+            continue;
+        }
+
+        bool isMicStream = false;
+        SharedStreamPointer matchingStream = resolveAudioStream(*message, isMicStream);
 
         // seek to the beginning of the packet so that the next reader is in the right spot
-        message.seek(0);
+        message->seek(0);
 
-        // check the overflow count before we parse data
-        auto overflowBefore = matchingStream->getOverflowCount();
-        auto parseResult = matchingStream->parseData(message);
+        auto batch = std::find_if(_streamBatches.begin(), _streamBatches.end(),
+            [&](const StreamBatch& batch) { return batch.stream == matchingStream; });
+        if (batch == _streamBatches.end()) {
+            _streamBatches.push_back({ matchingStream, isMicStream, {} });
+            batch = _streamBatches.end() - 1;
+        }
+        batch->messages.push_back(message);
+    }
 
-        if (matchingStream->getOverflowCount() > overflowBefore) {
+    // one decode/ingest pass per stream, with jitter-buffer housekeeping deferred to batch end
+    for (auto& batch : _streamBatches) {
+        auto overflowBefore = batch.stream->getOverflowCount();
+        batch.stream->parseDataBatch(batch.messages);
+
+        if (batch.stream->getOverflowCount() > overflowBefore) {
+            auto& message = *batch.messages.back();
             qDebug() << "Just overflowed on stream from" << message.getSourceID() << "at" << message.getSenderSockAddr();
-            qDebug() << "This stream is for" << (isMicStream ? "microphone audio" : "injected audio");
+            qDebug() << "This stream is for" << (batch.isMicStream ? "microphone audio" : "injected audio");
         }
-
-        return parseResult;
     }
-    return 0;
 }
 
 int AudioMixerClientData::checkBuffersBeforeFrameSend() {
@@ -13,6 +13,7 @@
 #define hifi_AudioMixerClientData_h
 
 #include <queue>
+#include <vector>
 
 #include <QtCore/QJsonObject>
 
@@ -50,8 +51,24 @@ public:
     // the following methods should be called from the AudioMixer assignment thread ONLY
     // they are not thread-safe
 
+    // cached spatialization parameters for a listener-source pair, reusable while
+    // neither endpoint moves beyond a threshold (maintained by AudioMixerSlave)
+    struct MixParams {
+        glm::vec3 relativePosition;
+        glm::quat listenerOrientation;
+        glm::quat sourceOrientation;
+        float distance { 0.0f };
+        float gain { 0.0f };
+        float azimuth { 0.0f };
+        unsigned int frame { 0 };
+        bool valid { false };
+    };
+
     // returns a new or existing HRTF object for the given stream from the given node
-    AudioHRTF& hrtfForStream(const QUuid& nodeID, const QUuid& streamID = QUuid()) { return _nodeSourcesHRTFMap[nodeID][streamID]; }
+    AudioHRTF& hrtfForStream(const QUuid& nodeID, const QUuid& streamID = QUuid()) { return _nodeSourcesHRTFMap[nodeID][streamID].hrtf; }
+
+    // returns the new or existing cached mix parameters alongside that HRTF
+    MixParams& mixParamsForStream(const QUuid& nodeID, const QUuid& streamID = QUuid()) { return _nodeSourcesHRTFMap[nodeID][streamID].params; }
 
     // removes an AudioHRTF object for a given stream
     void removeHRTFForStream(const QUuid& nodeID, const QUuid& streamID = QUuid());
@@ -63,6 +80,7 @@ public:
 
     // packet parsers
     int parseData(ReceivedMessage& message) override;
+    void parseAudioBatch(std::vector<QSharedPointer<ReceivedMessage>>& messages);
     void negotiateAudioFormat(ReceivedMessage& message, const SharedNodePointer& node);
     void parseRequestsDomainListData(ReceivedMessage& message);
     void parsePerAvatarGainSet(ReceivedMessage& message, const SharedNodePointer& node);
@@ -84,6 +102,11 @@ public:
     // uses randomization to have the AudioMixer send a stats packet to this node around every second
     bool shouldSendStats(int frameNumber);
 
+    // re-evaluates the selected codec against the loss the client reports for its downstream
+    // mixed stream: sustained loss falls back to the cheapest mutual codec, and a link that has
+    // been clean for a while goes back to the preferred one. called about once a second.
+    void checkCodecForLinkQuality(const SharedNodePointer& node);
+
     AudioLimiter audioLimiter;
 
     void setupCodec(CodecPluginPointer codec, const QString& codecName);
@@ -121,6 +144,18 @@ private:
     };
     PacketQueue _packetQueue;
 
+    // resolves (creating, if necessary) the stream an audio packet targets
+    SharedStreamPointer resolveAudioStream(ReceivedMessage& message, bool& isMicStream);
+
+    // batched ingest scratch, retained to avoid per-batch reallocation
+    struct StreamBatch {
+        SharedStreamPointer stream;
+        bool isMicStream;
+        std::vector<QSharedPointer<ReceivedMessage>> messages;
+    };
+    std::vector<QSharedPointer<ReceivedMessage>> _audioPacketBatch;
+    std::vector<StreamBatch> _streamBatches;
+
     QReadWriteLock _streamsLock;
     AudioStreamMap _audioStreams; // microphone stream from avatar is stored under key of null UUID
 
@@ -162,7 +197,11 @@ private:
     using NodeSourcesIgnoreMap = tbb::concurrent_unordered_map<QUuid, IgnoreNodeCache, IgnoreNodeCacheHasher>;
     NodeSourcesIgnoreMap _nodeSourcesIgnoreMap;
 
-    using HRTFMap = std::unordered_map<QUuid, AudioHRTF>;
+    struct MixableStream {
+        AudioHRTF hrtf;
+        MixParams params;
+    };
+    using HRTFMap = std::unordered_map<QUuid, MixableStream>;
     using NodeSourcesHRTFMap = std::unordered_map<QUuid, HRTFMap>;
     NodeSourcesHRTFMap _nodeSourcesHRTFMap;
 
@@ -177,6 +216,12 @@ private:
     Encoder* _encoder{ nullptr }; // for outbound mixed stream
     Decoder* _decoder{ nullptr }; // for mic stream
 
+    // in-session codec renegotiation state
+    std::vector<QString> _offeredCodecs;
+    bool _usingRobustCodec { false };
+    int _lossyStatsIntervals { 0 };
+    int _cleanStatsIntervals { 0 };
+
     bool _shouldFlushEncoder { false };
 
     bool _shouldMuteClient { false };
@@ -0,0 +1,84 @@
+//
+//  AudioMixerFrameArena.h
+//  assignment-client/src/audio
+//
+//  Created by Zach Pomerantz on 11/22/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerFrameArena_h
+#define hifi_AudioMixerFrameArena_h
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Monotonic bump allocator backing transient per-frame mix state on a slave.
+// reset() rewinds to the start while retaining the backing chunks, so once the
+// first few frames establish a high-water mark, steady-state mixing performs
+// zero heap allocations (and no cross-thread malloc contention).
+class AudioMixerFrameArena {
+public:
+    static const size_t CHUNK_SIZE = 64 * 1024;
+
+    void* allocate(size_t bytes, size_t alignment) {
+        size_t offset = (_offset + (alignment - 1)) & ~(alignment - 1);
+
+        // advance past chunks too full to satisfy the request
+        while (_chunk < _chunks.size() && offset + bytes > _chunks[_chunk].size) {
+            ++_chunk;
+            offset = 0;
+        }
+        if (_chunk == _chunks.size()) {
+            // grow - sized for the request, to also handle oversize allocations
+            size_t size = bytes > CHUNK_SIZE ? bytes : CHUNK_SIZE;
+            _chunks.push_back({ std::unique_ptr<char[]>(new char[size]), size });
+            offset = 0;
+        }
+
+        void* ptr = _chunks[_chunk].data.get() + offset;
+        _offset = offset + bytes;
+        return ptr;
+    }
+
+    // invalidates all outstanding allocations, but keeps the chunks
+    void reset() {
+        _chunk = 0;
+        _offset = 0;
+    }
+
+private:
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Chunk> _chunks;
+    size_t _chunk { 0 };
+    size_t _offset { 0 };
+};
+
+// STL allocator adapter over AudioMixerFrameArena; deallocation is a no-op,
+// memory is reclaimed wholesale by the arena's reset()
+template <typename T>
+class AudioMixerArenaAllocator {
+public:
+    using value_type = T;
+
+    AudioMixerArenaAllocator(AudioMixerFrameArena& arena) : _arena(&arena) {}
+    template <typename U>
+    AudioMixerArenaAllocator(const AudioMixerArenaAllocator<U>& other) : _arena(other._arena) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) {}
+
+    bool operator==(const AudioMixerArenaAllocator& other) const { return _arena == other._arena; }
+    bool operator!=(const AudioMixerArenaAllocator& other) const { return _arena != other._arena; }
+
+    AudioMixerFrameArena* _arena;
+};
+
+#endif // hifi_AudioMixerFrameArena_h
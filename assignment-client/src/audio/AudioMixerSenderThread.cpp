@@ -0,0 +1,81 @@
+//
+//  AudioMixerSenderThread.cpp
+//  assignment-client/src/audio
+//
+//  Created by Zach Pomerantz on 11/16/2016.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerSenderThread.h"
+
+bool AudioMixerPacketRing::push(std::unique_ptr<NLPacket>& packet, const SharedNodePointer& node) {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) == RING_SIZE) {
+        // full - caller falls back to a direct send
+        return false;
+    }
+
+    Entry& entry = _entries[head & (RING_SIZE - 1)];
+    entry.packet = std::move(packet);
+    entry.node = node;
+
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool AudioMixerPacketRing::pop(std::unique_ptr<NLPacket>& packet, SharedNodePointer& node) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (_head.load(std::memory_order_acquire) == tail) {
+        // empty
+        return false;
+    }
+
+    Entry& entry = _entries[tail & (RING_SIZE - 1)];
+    packet = std::move(entry.packet);
+    node = std::move(entry.node);
+
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+AudioMixerSenderThread::AudioMixerSenderThread(int numRings) {
+    for (int i = 0; i < numRings; ++i) {
+        _rings.emplace_back(new AudioMixerPacketRing());
+    }
+}
+
+void AudioMixerSenderThread::stop() {
+    _stop = true;
+    wait();
+}
+
+bool AudioMixerSenderThread::drainRings() {
+    bool sent = false;
+
+    std::unique_ptr<NLPacket> packet;
+    SharedNodePointer node;
+    for (auto& ring : _rings) {
+        while (ring->pop(packet, node)) {
+            DependencyManager::get<NodeList>()->sendPacket(std::move(packet), *node);
+            sent = true;
+        }
+    }
+
+    return sent;
+}
+
+void AudioMixerSenderThread::run() {
+    while (!_stop) {
+        if (!drainRings()) {
+            // rings are empty; sleep briefly rather than spin between frames
+            static const unsigned long IDLE_SLEEP_USECS = 250;
+            usleep(IDLE_SLEEP_USECS);
+        }
+    }
+
+    // send anything queued behind the stop flag
+    drainRings();
+}
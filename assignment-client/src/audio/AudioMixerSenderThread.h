@@ -0,0 +1,69 @@
+//
+//  AudioMixerSenderThread.h
+//  assignment-client/src/audio
+//
+//  Created by Zach Pomerantz on 11/16/2016.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerSenderThread_h
+#define hifi_AudioMixerSenderThread_h
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QThread>
+
+#include <NodeList.h>
+
+// Lock-free single-producer/single-consumer ring of mixed packets pending send.
+// Each AudioMixerSlaveThread produces into its own ring, so slaves never contend
+// with each other and never block on network syscalls inside the frame tick.
+class AudioMixerPacketRing {
+public:
+    static const uint32_t RING_SIZE = 1024;     // must be a power of two
+
+    // producer (slave thread); returns false (leaving packet intact) if the ring is full
+    bool push(std::unique_ptr<NLPacket>& packet, const SharedNodePointer& node);
+
+    // consumer (sender thread); returns false if the ring is empty
+    bool pop(std::unique_ptr<NLPacket>& packet, SharedNodePointer& node);
+
+private:
+    struct Entry {
+        std::unique_ptr<NLPacket> packet;
+        SharedNodePointer node;
+    };
+
+    Entry _entries[RING_SIZE];
+    std::atomic<uint32_t> _head { 0 };  // written by producer
+    std::atomic<uint32_t> _tail { 0 };  // written by consumer
+};
+
+// Dedicated sender thread that drains the slave rings and performs the actual
+// NodeList::sendPacket calls, decoupling mix computation from send latency.
+class AudioMixerSenderThread : public QThread {
+    Q_OBJECT
+public:
+    AudioMixerSenderThread(int numRings);
+
+    AudioMixerPacketRing* getRing(int i) { return _rings[i].get(); }
+    int getNumRings() const { return (int)_rings.size(); }
+
+    // drain remaining packets and stop the thread
+    void stop();
+
+    void run() override final;
+
+private:
+    bool drainRings();
+
+    std::vector<std::unique_ptr<AudioMixerPacketRing>> _rings;
+    std::atomic<bool> _stop { false };
+};
+
+#endif // hifi_AudioMixerSenderThread_h
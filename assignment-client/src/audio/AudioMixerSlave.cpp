@@ -30,6 +30,8 @@
 #include "AudioRingBuffer.h"
 #include "AudioMixer.h"
 #include "AudioMixerClientData.h"
+#include "AudioMixerSenderThread.h"
+#include "AudioMixerSpatialIndex.h"
 #include "AvatarAudioStream.h"
 #include "InjectedAudioStream.h"
 #include "AudioHelpers.h"
@@ -40,10 +42,6 @@ using AudioStreamMap = AudioMixerClientData::AudioStreamMap;
 
 // packet helpers
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec);
-void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer);
-void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
-void sendMutePacket(const SharedNodePointer& node, AudioMixerClientData&);
-void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
 
 // mix helpers
 inline float approximateGain(const AvatarAudioStream& listeningNodeStream, const PositionalAudioStream& streamToAdd,
@@ -60,11 +58,13 @@ void AudioMixerSlave::processPackets(const SharedNodePointer& node) {
     }
 }
 
-void AudioMixerSlave::configureMix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio) {
+void AudioMixerSlave::configureMix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio,
+        const AudioMixerSpatialIndex* spatialIndex) {
     _begin = begin;
     _end = end;
     _frame = frame;
     _throttlingRatio = throttlingRatio;
+    _spatialIndex = spatialIndex;
 }
 
 void AudioMixerSlave::mix(const SharedNodePointer& node) {
@@ -117,6 +117,10 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
         const unsigned int NUM_FRAMES_PER_SEC = (int)ceil(AudioConstants::NETWORK_FRAMES_PER_SEC);
         if (data->shouldSendStats(_frame % NUM_FRAMES_PER_SEC)) {
             data->sendAudioStreamStatsPackets(node);
+
+            // same once-a-second cadence: re-check the codec against the loss this client has
+            // been reporting for its downstream mixed stream
+            data->checkCodecForLinkQuality(node);
         }
     }
 }
@@ -129,7 +133,21 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     memset(_mixSamples, 0, sizeof(_mixSamples));
 
     bool isThrottling = _throttlingRatio > 0.0f;
-    std::vector<std::pair<float, SharedNodePointer>> throttledNodes;
+
+    // transient mix state goes in the frame arena - no steady-state heap allocations
+    _frameArena.reset();
+    using ThrottlePair = std::pair<float, SharedNodePointer>;
+    std::vector<ThrottlePair, AudioMixerArenaAllocator<ThrottlePair>> throttledNodes {
+        AudioMixerArenaAllocator<ThrottlePair>(_frameArena) };
+    std::vector<const Node*, AudioMixerArenaAllocator<const Node*>> candidateNodes {
+        AudioMixerArenaAllocator<const Node*>(_frameArena) };
+
+    // cull nodes whose streams cannot contribute audible gain to this listener
+    float audibilityRadius = AudioMixerSpatialIndex::audibilityRadius();
+    bool isCulling = _spatialIndex && audibilityRadius > 0.0f;
+    if (isCulling) {
+        _spatialIndex->query(listenerAudioStream->getPosition(), audibilityRadius, candidateNodes);
+    }
 
     typedef void (AudioMixerSlave::*MixFunctor)(
             AudioMixerClientData&, const QUuid&, const AvatarAudioStream&, const PositionalAudioStream&);
@@ -151,6 +169,12 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return;
         }
 
+        if (isCulling && !(*node == *listener) &&
+            std::find(candidateNodes.begin(), candidateNodes.end(), node.data()) == candidateNodes.end()) {
+            // every stream of this node is beyond the audible-gain radius
+            return;
+        }
+
         if (*node == *listener) {
             // only mix the echo, if requested
             for (auto& streamPair : nodeData->getAudioStreams()) {
@@ -261,9 +285,39 @@ void AudioMixerSlave::addStream(AudioMixerClientData& listenerNodeData, const QU
 
     glm::vec3 relativePosition = streamToAdd.getPosition() - listeningNodeStream.getPosition();
 
-    float distance = glm::max(glm::length(relativePosition), EPSILON);
-    float gain = computeGain(listeningNodeStream, streamToAdd, relativePosition, isEcho);
-    float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
+    // spatialization parameters involve trig and zone lookups; most pairs are mutually
+    // stationary frame-over-frame, so reuse the cached values until an endpoint moves
+    auto& mixParams = listenerNodeData.mixParamsForStream(sourceNodeID, streamToAdd.getStreamIdentifier());
+
+    // thresholds below which motion is inaudible in the mix
+    const float POSITION_REUSE_THRESHOLD2 = 1e-6f; // 1mm, squared
+    const float ORIENTATION_REUSE_THRESHOLD = 0.9999999f; // ~0.05 degrees
+    // recompute periodically regardless, so zone/attenuation setting edits propagate
+    const unsigned int MIX_PARAMS_MAX_AGE = 100; // frames, ~1s
+
+    float distance, gain, azimuth;
+    if (mixParams.valid &&
+            (_frame - mixParams.frame) < MIX_PARAMS_MAX_AGE &&
+            glm::distance2(relativePosition, mixParams.relativePosition) < POSITION_REUSE_THRESHOLD2 &&
+            fabsf(glm::dot(listeningNodeStream.getOrientation(), mixParams.listenerOrientation)) > ORIENTATION_REUSE_THRESHOLD &&
+            fabsf(glm::dot(streamToAdd.getOrientation(), mixParams.sourceOrientation)) > ORIENTATION_REUSE_THRESHOLD) {
+        distance = mixParams.distance;
+        gain = mixParams.gain;
+        azimuth = mixParams.azimuth;
+    } else {
+        distance = glm::max(glm::length(relativePosition), EPSILON);
+        gain = computeGain(listeningNodeStream, streamToAdd, relativePosition, isEcho);
+        azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
+
+        mixParams.relativePosition = relativePosition;
+        mixParams.listenerOrientation = listeningNodeStream.getOrientation();
+        mixParams.sourceOrientation = streamToAdd.getOrientation();
+        mixParams.distance = distance;
+        mixParams.gain = gain;
+        mixParams.azimuth = azimuth;
+        mixParams.frame = _frame;
+        mixParams.valid = true;
+    }
     const int HRTF_DATASET_INDEX = 1;
 
     if (!streamToAdd.lastPopSucceeded()) {
@@ -364,7 +418,15 @@ std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 s
     return audioPacket;
 }
 
-void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer) {
+void AudioMixerSlave::queuePacket(std::unique_ptr<NLPacket> packet, const SharedNodePointer& node) {
+    // hand the packet to the sender thread; fall back to a direct send when running
+    // without a ring (single-threaded) or in the unlikely case the ring is full
+    if (!_packetRing || !_packetRing->push(packet, node)) {
+        DependencyManager::get<NodeList>()->sendPacket(std::move(packet), *node);
+    }
+}
+
+void AudioMixerSlave::sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer) {
     const int MIX_PACKET_SIZE =
         sizeof(quint16) + AudioConstants::MAX_CODEC_NAME_LENGTH_ON_WIRE + AudioConstants::NETWORK_FRAME_BYTES_STEREO;
     quint16 sequence = data.getOutgoingSequenceNumber();
@@ -375,11 +437,11 @@ void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QB
     mixPacket->write(buffer.constData(), buffer.size());
 
     // send packet
-    DependencyManager::get<NodeList>()->sendPacket(std::move(mixPacket), *node);
+    queuePacket(std::move(mixPacket), node);
     data.incrementOutgoingMixedAudioSequenceNumber();
 }
 
-void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data) {
+void AudioMixerSlave::sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data) {
     const int SILENT_PACKET_SIZE =
         sizeof(quint16) + AudioConstants::MAX_CODEC_NAME_LENGTH_ON_WIRE + sizeof(quint16);
     quint16 sequence = data.getOutgoingSequenceNumber();
@@ -390,19 +452,19 @@ void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data)
     mixPacket->writePrimitive(AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
 
     // send packet
-    DependencyManager::get<NodeList>()->sendPacket(std::move(mixPacket), *node);
+    queuePacket(std::move(mixPacket), node);
     data.incrementOutgoingMixedAudioSequenceNumber();
 }
 
-void sendMutePacket(const SharedNodePointer& node, AudioMixerClientData& data) {
+void AudioMixerSlave::sendMutePacket(const SharedNodePointer& node, AudioMixerClientData& data) {
     auto mutePacket = NLPacket::create(PacketType::NoisyMute, 0);
-    DependencyManager::get<NodeList>()->sendPacket(std::move(mutePacket), *node);
+    queuePacket(std::move(mutePacket), node);
 
     // probably now we just reset the flag, once should do it (?)
     data.setShouldMuteClient(false);
 }
 
-void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData& data) {
+void AudioMixerSlave::sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData& data) {
     bool hasReverb = false;
     float reverbTime, wetLevel;
 
@@ -459,7 +521,7 @@ void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData&
         }
 
         // send the packet
-        DependencyManager::get<NodeList>()->sendPacket(std::move(envPacket), *node);
+        queuePacket(std::move(envPacket), node);
     }
 }
 
@@ -19,12 +19,15 @@
 #include <UUIDHasher.h>
 #include <NodeList.h>
 
+#include "AudioMixerFrameArena.h"
 #include "AudioMixerStats.h"
 
 class PositionalAudioStream;
 class AvatarAudioStream;
 class AudioHRTF;
 class AudioMixerClientData;
+class AudioMixerPacketRing;
+class AudioMixerSpatialIndex;
 
 class AudioMixerSlave {
 public:
@@ -34,12 +37,16 @@ public:
     void processPackets(const SharedNodePointer& node);
 
     // configure a round of mixing
-    void configureMix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio);
+    void configureMix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio,
+            const AudioMixerSpatialIndex* spatialIndex);
 
     // mix and broadcast non-ignored streams to the node (requires configuration using configureMix, above)
     // returns true if a mixed packet was sent to the node
     void mix(const SharedNodePointer& node);
 
+    // hand finished packets to the sender thread (direct send when no ring is set)
+    void setPacketRing(AudioMixerPacketRing* ring) { _packetRing = ring; }
+
     AudioMixerStats stats;
 
 private:
@@ -53,6 +60,16 @@ private:
             const AvatarAudioStream& listenerStream, const PositionalAudioStream& streamer,
             bool throttle);
 
+    // packet helpers
+    void queuePacket(std::unique_ptr<NLPacket> packet, const SharedNodePointer& node);
+    void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer);
+    void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
+    void sendMutePacket(const SharedNodePointer& node, AudioMixerClientData& data);
+    void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
+
+    // outbound packet ring, drained by AudioMixerSenderThread
+    AudioMixerPacketRing* _packetRing { nullptr };
+
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
@@ -62,6 +79,12 @@ private:
     ConstIter _end;
     unsigned int _frame { 0 };
     float _throttlingRatio { 0.0f };
+
+    // source culling state
+    const AudioMixerSpatialIndex* _spatialIndex { nullptr };
+
+    // per-frame bump arena for transient mix state
+    AudioMixerFrameArena _frameArena;
 };
 
 #endif // hifi_AudioMixerSlave_h
@@ -12,9 +12,36 @@
 #include <assert.h>
 #include <algorithm>
 
+#include <QtCore/QtGlobal>
+
+#ifdef Q_OS_LINUX
+#include <pthread.h>
+#include <sched.h>
+#elif defined(Q_OS_WIN)
+#include <Windows.h>
+#endif
+
 #include "AudioMixerSlavePool.h"
 
+// pin the calling thread to a core, to avoid cross-socket migration of hot mix state
+static void pinToCore(int coreId) {
+    if (coreId < 0) {
+        return;
+    }
+#ifdef Q_OS_LINUX
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(coreId, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(Q_OS_WIN)
+    SetThreadAffinityMask(GetCurrentThread(), 1ull << coreId);
+#endif
+    // (unpinned on other platforms)
+}
+
 void AudioMixerSlaveThread::run() {
+    pinToCore(_coreId);
+
     while (true) {
         wait();
 
@@ -68,19 +95,41 @@ bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node) {
 static AudioMixerSlave slave;
 #endif
 
+int AudioMixerSlavePool::maxNumThreads() {
+    int maxThreads = QThread::idealThreadCount();
+    if (maxThreads == -1) {
+        // idealThreadCount returns -1 if cores cannot be detected
+        static const int MAX_THREADS_IF_UNKNOWN = 4;
+        maxThreads = MAX_THREADS_IF_UNKNOWN;
+    }
+    return maxThreads;
+}
+
+AudioMixerSlavePool::AudioMixerSlavePool(int numThreads) : _sender(maxNumThreads()) {
+    _sender.start();
+    setNumThreads(numThreads);
+}
+
+AudioMixerSlavePool::~AudioMixerSlavePool() {
+    resize(0);
+    _sender.stop();
+}
+
 void AudioMixerSlavePool::processPackets(ConstIter begin, ConstIter end) {
     _function = &AudioMixerSlave::processPackets;
     _configure = [](AudioMixerSlave& slave) {};
     run(begin, end);
 }
 
-void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio) {
+void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio,
+        const AudioMixerSpatialIndex* spatialIndex) {
     _function = &AudioMixerSlave::mix;
     _configure = [&](AudioMixerSlave& slave) {
-        slave.configureMix(_begin, _end, _frame, _throttlingRatio);
+        slave.configureMix(_begin, _end, _frame, _throttlingRatio, _spatialIndex);
     };
     _frame = frame;
     _throttlingRatio = throttlingRatio;
+    _spatialIndex = spatialIndex;
 
     run(begin, end);
 }
@@ -133,12 +182,7 @@ void AudioMixerSlavePool::each(std::function<void(AudioMixerSlave& slave)> funct
 void AudioMixerSlavePool::setNumThreads(int numThreads) {
     // clamp to allowed size
     {
-        int maxThreads = QThread::idealThreadCount();
-        if (maxThreads == -1) {
-            // idealThreadCount returns -1 if cores cannot be detected
-            static const int MAX_THREADS_IF_UNKNOWN = 4;
-            maxThreads = MAX_THREADS_IF_UNKNOWN;
-        }
+        int maxThreads = maxNumThreads();
 
         int clampedThreads = std::min(std::max(1, numThreads), maxThreads);
         if (clampedThreads != numThreads) {
@@ -164,6 +208,9 @@ void AudioMixerSlavePool::resize(int numThreads) {
         // start new slaves
         for (int i = 0; i < numThreads - _numThreads; ++i) {
             auto slave = new AudioMixerSlaveThread(*this);
+            slave->setPacketRing(_sender.getRing((int)_slaves.size()));
+            // slaves are appended/erased at the tail, so the index makes a stable core assignment
+            slave->_coreId = (int)_slaves.size() % maxNumThreads();
             slave->start();
             _slaves.emplace_back(slave);
         }
@@ -20,8 +20,11 @@
 
 #include <QThread>
 
+#include "AudioMixerSenderThread.h"
 #include "AudioMixerSlave.h"
 
+class AudioMixerSpatialIndex;
+
 class AudioMixerSlavePool;
 
 class AudioMixerSlaveThread : public QThread, public AudioMixerSlave {
@@ -45,6 +48,7 @@ private:
     AudioMixerSlavePool& _pool;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
     bool _stop { false };
+    int _coreId { -1 }; // core to pin to, assigned by the pool before start
 };
 
 // Slave pool for audio mixers
@@ -58,14 +62,15 @@ class AudioMixerSlavePool {
 public:
     using ConstIter = NodeList::const_iterator;
 
-    AudioMixerSlavePool(int numThreads = QThread::idealThreadCount()) { setNumThreads(numThreads); }
-    ~AudioMixerSlavePool() { resize(0); }
+    AudioMixerSlavePool(int numThreads = QThread::idealThreadCount());
+    ~AudioMixerSlavePool();
 
     // process packets on slave threads
     void processPackets(ConstIter begin, ConstIter end);
 
     // mix on slave threads
-    void mix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio);
+    void mix(ConstIter begin, ConstIter end, unsigned int frame, float throttlingRatio,
+            const AudioMixerSpatialIndex* spatialIndex);
 
     // iterate over all slaves
     void each(std::function<void(AudioMixerSlave& slave)> functor);
@@ -73,12 +78,17 @@ public:
     void setNumThreads(int numThreads);
     int numThreads() { return _numThreads; }
 
+    static int maxNumThreads();
+
 private:
     void run(ConstIter begin, ConstIter end);
     void resize(int numThreads);
 
     std::vector<std::unique_ptr<AudioMixerSlaveThread>> _slaves;
 
+    // dedicated sender thread; slaves push finished packets into per-slave rings
+    AudioMixerSenderThread _sender;
+
     friend void AudioMixerSlaveThread::wait();
     friend void AudioMixerSlaveThread::notify(bool stopping);
     friend bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node);
@@ -98,6 +108,7 @@ private:
     Queue _queue;
     unsigned int _frame { 0 };
     float _throttlingRatio { 0.0f };
+    const AudioMixerSpatialIndex* _spatialIndex { nullptr };
     ConstIter _begin;
     ConstIter _end;
 };
@@ -0,0 +1,73 @@
+//
+//  AudioMixerSpatialIndex.cpp
+//  assignment-client/src/audio
+//
+//  Created by Zach Pomerantz on 11/22/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/gtx/norm.hpp>
+
+#include "AudioMixer.h"
+#include "AudioMixerClientData.h"
+#include "AudioMixerSpatialIndex.h"
+
+int64_t AudioMixerSpatialIndex::cellKey(int x, int y, int z) {
+    // pack 21-bit signed cell coordinates into one key
+    const int64_t MASK = (1 << 21) - 1;
+    return ((int64_t)(x & MASK) << 42) | ((int64_t)(y & MASK) << 21) | (int64_t)(z & MASK);
+}
+
+void AudioMixerSpatialIndex::rebuild(ConstIter begin, ConstIter end) {
+    // retain bucket storage across frames to avoid reallocation
+    for (auto& cell : _cells) {
+        cell.second.clear();
+    }
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* data = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!data) {
+            return;
+        }
+
+        for (auto& streamPair : data->getAudioStreams()) {
+            auto& stream = streamPair.second;
+            glm::vec3 position = stream->getPosition();
+
+            int x = (int)std::floor(position.x) >> CELL_SIZE_LOG2;
+            int y = (int)std::floor(position.y) >> CELL_SIZE_LOG2;
+            int z = (int)std::floor(position.z) >> CELL_SIZE_LOG2;
+
+            _cells[cellKey(x, y, z)].push_back({ node.data(), position });
+        }
+    });
+}
+
+float AudioMixerSpatialIndex::audibilityRadius() {
+    // translate the attenuation setting to gain per log2(distance), as computeGain does
+    float g = 1.0f - AudioMixer::getAttenuationPerDoublingInDistance();
+    if (g >= 1.0f || g <= 0.0f) {
+        // attenuation is off (or degenerate); every source is potentially audible
+        return -1.0f;
+    }
+
+    // distance at which attenuation alone drops a full-scale source below -60dB
+    const float AUDIBILITY_THRESHOLD = 0.001f;
+    float radius = exp2f(log2f(AUDIBILITY_THRESHOLD) / log2f(g));
+
+    // culling does not pay off for very flat falloffs
+    const float MAX_RADIUS = 4096.0f;
+    if (radius > MAX_RADIUS) {
+        return -1.0f;
+    }
+
+    // never cull inside the immediate cell neighborhood
+    const float MIN_RADIUS = (float)(1 << CELL_SIZE_LOG2);
+    return std::max(radius, MIN_RADIUS);
+}
@@ -0,0 +1,91 @@
+//
+//  AudioMixerSpatialIndex.h
+//  assignment-client/src/audio
+//
+//  Created by Zach Pomerantz on 11/22/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerSpatialIndex_h
+#define hifi_AudioMixerSpatialIndex_h
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/norm.hpp>
+
+#include <NodeList.h>
+
+// Uniform spatial hash over the positions of each node's positional audio streams,
+// rebuilt once per frame on the mixer thread before mixing starts. Slaves query it
+// (read-only) to cull nodes whose streams cannot contribute audible gain to a
+// listener, reducing the O(listeners x sources) pair loop to audible pairs only.
+class AudioMixerSpatialIndex {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    // cells are sized so a query visits at most a 3x3x3 neighborhood
+    static const int CELL_SIZE_LOG2 = 5;    // 32m cells
+
+    // rebuild the hash from every positional stream of every node
+    void rebuild(ConstIter begin, ConstIter end);
+
+    // collect nodes with at least one stream within radius of position;
+    // templated so callers may pass arena-allocated vectors
+    template <typename Vector>
+    void query(const glm::vec3& position, float radius, Vector& candidates) const;
+
+    // distance at which distance attenuation alone drives gain below audibility,
+    // or -1.0f if attenuation is configured off (no culling possible)
+    static float audibilityRadius();
+
+private:
+    struct Entry {
+        const Node* node;
+        glm::vec3 position;
+    };
+
+    static int64_t cellKey(int x, int y, int z);
+
+    std::unordered_map<int64_t, std::vector<Entry>> _cells;
+};
+
+template <typename Vector>
+void AudioMixerSpatialIndex::query(const glm::vec3& position, float radius, Vector& candidates) const {
+    candidates.clear();
+
+    float radius2 = radius * radius;
+
+    int x0 = (int)std::floor(position.x - radius) >> CELL_SIZE_LOG2;
+    int x1 = (int)std::floor(position.x + radius) >> CELL_SIZE_LOG2;
+    int y0 = (int)std::floor(position.y - radius) >> CELL_SIZE_LOG2;
+    int y1 = (int)std::floor(position.y + radius) >> CELL_SIZE_LOG2;
+    int z0 = (int)std::floor(position.z - radius) >> CELL_SIZE_LOG2;
+    int z1 = (int)std::floor(position.z + radius) >> CELL_SIZE_LOG2;
+
+    for (int x = x0; x <= x1; ++x) {
+        for (int y = y0; y <= y1; ++y) {
+            for (int z = z0; z <= z1; ++z) {
+                auto cell = _cells.find(cellKey(x, y, z));
+                if (cell == _cells.end()) {
+                    continue;
+                }
+
+                for (auto& entry : cell->second) {
+                    if (glm::distance2(entry.position, position) <= radius2 &&
+                        std::find(candidates.begin(), candidates.end(), entry.node) == candidates.end()) {
+                        candidates.push_back(entry.node);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // hifi_AudioMixerSpatialIndex_h
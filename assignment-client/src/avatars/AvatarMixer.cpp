@@ -115,18 +115,17 @@ void AvatarMixer::start() {
         auto frameDuration = timeFrame(frameTimestamp); // calculates last frame duration and sleeps remainder of target amount
         throttle(frameDuration, frame); // determines _throttlingRatio for upcoming mix frame
 
-        int lockWait, nodeTransform, functor;
+        int lockWait, nodeTransform;
+
+        // Publish one immutable snapshot of the node set per frame - the slave threads
+        // iterate it for every pass below without ever touching the node mutex
+        auto nodes = nodeList->nodeSnapshot(&lockWait, &nodeTransform);
 
         // Allow nodes to process any pending/queued packets across our worker threads
         {
             auto start = usecTimestampNow();
-
-            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
-                auto end = usecTimestampNow();
-                _processQueuedAvatarDataPacketsLockWaitElapsedTime += (end - start);
-
-                _slavePool.processIncomingPackets(cbegin, cend);
-            }, &lockWait, &nodeTransform, &functor);
+            _processQueuedAvatarDataPacketsLockWaitElapsedTime += lockWait;
+            _slavePool.processIncomingPackets(nodes.cbegin(), nodes.cend());
             auto end = usecTimestampNow();
             _processQueuedAvatarDataPacketsElapsedTime += (end - start);
         }
@@ -135,31 +134,43 @@ void AvatarMixer::start() {
         // side-effects the mixer's data, which is fine because it's a very low cost operation
         {
             auto start = usecTimestampNow();
-            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
-                std::for_each(cbegin, cend, [&](const SharedNodePointer& node) {
-                    manageDisplayName(node);
-                    ++_sumListeners;
-                });
-            }, &lockWait, &nodeTransform, &functor);
+            std::for_each(nodes.cbegin(), nodes.cend(), [&](const SharedNodePointer& node) {
+                manageDisplayName(node);
+                ++_sumListeners;
+            });
             auto end = usecTimestampNow();
             _displayNameManagementElapsedTime += (end - start);
         }
 
+        // refresh each client's cached bubble box and any stale ignore bitsets up front, while
+        // nothing else is touching them, so the slaves' per-pair filter below is a pair of bit
+        // tests and a touches() between two cached boxes - no hashing or locking
+        {
+            quint64 indexGeneration = AvatarMixerClientData::getSimpleIndexGeneration();
+            std::for_each(nodes.cbegin(), nodes.cend(), [&](const SharedNodePointer& node) {
+                AvatarMixerClientData* nodeData = reinterpret_cast<AvatarMixerClientData*>(node->getLinkedData());
+                if (nodeData) {
+                    nodeData->computeBubbleBox();
+                    nodeData->updateIgnoreBitset(*node, indexGeneration, nodes);
+                }
+            });
+        }
+
         // this is where we need to put the real work...
         {
             auto start = usecTimestampNow();
-            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
-                auto start = usecTimestampNow();
-                _slavePool.broadcastAvatarData(cbegin, cend, _lastFrameTimestamp, _maxKbpsPerNode, _throttlingRatio);
-                auto end = usecTimestampNow();
-                _broadcastAvatarDataInner += (end - start);
-            }, &lockWait, &nodeTransform, &functor);
+            {
+                auto innerStart = usecTimestampNow();
+                _slavePool.broadcastAvatarData(nodes.cbegin(), nodes.cend(), _lastFrameTimestamp, _maxKbpsPerNode, _throttlingRatio);
+                auto innerEnd = usecTimestampNow();
+                _broadcastAvatarDataInner += (innerEnd - innerStart);
+            }
             auto end = usecTimestampNow();
             _broadcastAvatarDataElapsedTime += (end - start);
 
             _broadcastAvatarDataLockWait += lockWait;
             _broadcastAvatarDataNodeTransform += nodeTransform;
-            _broadcastAvatarDataNodeFunctor += functor;
+            _broadcastAvatarDataNodeFunctor += (end - start);
         }
 
         ++frame;
@@ -554,6 +565,12 @@ void AvatarMixer::sendStatsPacket() {
         float averageOverBudgetAvatars = averageNodes ? stats.overBudgetAvatars / averageNodes : 0.0f;
         slaveObject["sent_7_averageOverBudgetAvatars"] = TIGHT_LOOP_STAT(averageOverBudgetAvatars);
 
+        float averageStaticOthers = averageNodes ? stats.numStaticOthers / averageNodes : 0.0f;
+        slaveObject["sent_8_averageOthersSentMinimal"] = TIGHT_LOOP_STAT(averageStaticOthers);
+
+        float averageTierThrottled = averageNodes ? stats.numOthersThrottledByTier / averageNodes : 0.0f;
+        slaveObject["sent_9_averageOthersThrottledByTier"] = TIGHT_LOOP_STAT(averageTierThrottled);
+
         slaveObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(stats.processIncomingPacketsElapsedTime);
         slaveObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(stats.ignoreCalculationElapsedTime);
         slaveObject["timing_3_toByteArray"] = TIGHT_LOOP_STAT_UINT64(stats.toByteArrayElapsedTime);
@@ -587,6 +604,12 @@ void AvatarMixer::sendStatsPacket() {
     float averageOverBudgetAvatars = averageNodes ? aggregateStats.overBudgetAvatars / averageNodes : 0.0f;
     slavesAggregatObject["sent_7_averageOverBudgetAvatars"] = TIGHT_LOOP_STAT(averageOverBudgetAvatars);
 
+    float averageStaticOthers = averageNodes ? aggregateStats.numStaticOthers / averageNodes : 0.0f;
+    slavesAggregatObject["sent_8_averageOthersSentMinimal"] = TIGHT_LOOP_STAT(averageStaticOthers);
+
+    float averageTierThrottled = averageNodes ? aggregateStats.numOthersThrottledByTier / averageNodes : 0.0f;
+    slavesAggregatObject["sent_9_averageOthersThrottledByTier"] = TIGHT_LOOP_STAT(averageTierThrottled);
+
     slavesAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     slavesAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
     slavesAggregatObject["timing_3_toByteArray"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.toByteArrayElapsedTime);
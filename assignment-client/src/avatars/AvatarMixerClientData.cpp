@@ -9,6 +9,9 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <atomic>
+#include <mutex>
+
 #include <udt/PacketHeaders.h>
 
 #include <DependencyManager.h>
@@ -16,7 +19,71 @@
 
 #include "AvatarMixerClientData.h"
 
+// simple stable indexes backing the dense ignore bitsets: each live client data holds one,
+// released indexes are reused, and every release bumps the generation so bitsets built
+// against the old assignment know to rebuild
+static std::mutex simpleIndexMutex;
+static std::vector<uint16_t> freeSimpleIndexes;
+static uint16_t simpleIndexCount = 0;
+static std::atomic<quint64> simpleIndexGeneration { 0 };
+
+uint16_t AvatarMixerClientData::acquireSimpleIndex() {
+    std::lock_guard<std::mutex> lock(simpleIndexMutex);
+    if (!freeSimpleIndexes.empty()) {
+        uint16_t index = freeSimpleIndexes.back();
+        freeSimpleIndexes.pop_back();
+        return index;
+    }
+    return simpleIndexCount++;
+}
+
+void AvatarMixerClientData::releaseSimpleIndex(uint16_t index) {
+    std::lock_guard<std::mutex> lock(simpleIndexMutex);
+    freeSimpleIndexes.push_back(index);
+    simpleIndexGeneration.fetch_add(1, std::memory_order_release);
+}
+
+size_t AvatarMixerClientData::getSimpleIndexCount() {
+    std::lock_guard<std::mutex> lock(simpleIndexMutex);
+    return simpleIndexCount;
+}
+
+quint64 AvatarMixerClientData::getSimpleIndexGeneration() {
+    return simpleIndexGeneration.load(std::memory_order_acquire);
+}
+
+void AvatarMixerClientData::updateIgnoreBitset(const Node& self, quint64 indexGeneration,
+                                               const std::vector<SharedNodePointer>& nodes) {
+    quint32 ignoreSetVersion = self.getIgnoreSetVersion();
+    if (ignoreSetVersion == _builtIgnoreSetVersion && indexGeneration == _builtIndexGeneration) {
+        return;
+    }
+
+    _ignoredSimpleIndexes.assign(getSimpleIndexCount(), false);
+    for (const SharedNodePointer& other : nodes) {
+        auto otherData = reinterpret_cast<const AvatarMixerClientData*>(other->getLinkedData());
+        if (otherData && self.isIgnoringNodeWithID(other->getUUID())) {
+            _ignoredSimpleIndexes[otherData->getSimpleIndex()] = true;
+        }
+    }
 
+    _builtIgnoreSetVersion = ignoreSetVersion;
+    _builtIndexGeneration = indexGeneration;
+}
+
+void AvatarMixerClientData::computeBubbleBox() {
+    // define the minimum bubble size
+    static const glm::vec3 minBubbleSize = glm::vec3(0.3f, 1.3f, 0.3f);
+    glm::vec3 boxScale = (getPosition() - getGlobalBoundingBoxCorner()) * 2.0f;
+    AABox box(getGlobalBoundingBoxCorner(), boxScale);
+    // clamp the size of the bounding box to a minimum scale
+    if (glm::any(glm::lessThan(boxScale, minBubbleSize))) {
+        box.setScaleStayCentered(minBubbleSize);
+    }
+    // quadruple the scale of the bounding box
+    box.embiggen(4.0f);
+    _bubbleBox = box;
+}
 
 void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
     if (!_packetQueue.node) {
@@ -14,13 +14,16 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <limits>
 #include <unordered_map>
 #include <unordered_set>
 #include <queue>
+#include <vector>
 
 #include <QtCore/QJsonObject>
 #include <QtCore/QUrl>
 
+#include <AABox.h>
 #include <AvatarData.h>
 #include <NodeData.h>
 #include <NumericalConstants.h>
@@ -36,8 +39,11 @@ const QString INBOUND_AVATAR_DATA_STATS_KEY = "inbound_av_data_kbps";
 class AvatarMixerClientData : public NodeData {
     Q_OBJECT
 public:
-    AvatarMixerClientData(const QUuid& nodeID = QUuid()) : NodeData(nodeID) { _currentViewFrustum.invalidate(); }
-    virtual ~AvatarMixerClientData() {}
+    AvatarMixerClientData(const QUuid& nodeID = QUuid()) : NodeData(nodeID) {
+        _currentViewFrustum.invalidate();
+        _simpleIndex = acquireSimpleIndex();
+    }
+    virtual ~AvatarMixerClientData() { releaseSimpleIndex(_simpleIndex); }
     using HRCTime = p_high_resolution_clock::time_point;
 
     int parseData(ReceivedMessage& message) override;
@@ -96,6 +102,22 @@ public:
     void removeFromRadiusIgnoringSet(SharedNodePointer self, const QUuid& other);
     void ignoreOther(SharedNodePointer self, SharedNodePointer other);
 
+    // dense ignore filter: every live client data holds a small stable index, and each client
+    // caches a bitset of the indexes its node is ignoring. The mixer thread refreshes stale
+    // bitsets once per frame before the slaves fan out, so the broadcast inner loop filters a
+    // sender/receiver pair with two bit tests instead of two locked hash probes.
+    uint16_t getSimpleIndex() const { return _simpleIndex; }
+    bool isIgnoringSimpleIndex(uint16_t index) const
+        { return index < _ignoredSimpleIndexes.size() && _ignoredSimpleIndexes[index]; }
+    void updateIgnoreBitset(const Node& self, quint64 indexGeneration, const std::vector<SharedNodePointer>& nodes);
+
+    // the embiggened ignore-radius bubble, recomputed once per frame by the mixer thread so
+    // the per-pair radius check is a box-touches test against two cached boxes
+    const AABox& getBubbleBox() const { return _bubbleBox; }
+    void computeBubbleBox();
+
+    static quint64 getSimpleIndexGeneration();
+
     void readViewFrustumPacket(const QByteArray& message);
 
     bool otherAvatarInView(const AABox& otherAvatarBox);
@@ -110,6 +132,12 @@ public:
 
     ViewFrustum getViewFrustom() const { return _currentViewFrustum; }
 
+    quint64 getLastBroadcastAttempt(const QUuid& otherAvatar) const {
+        auto itr = _lastBroadcastAttempts.find(otherAvatar);
+        return itr != _lastBroadcastAttempts.end() ? itr->second : 0;
+    }
+    void setLastBroadcastAttempt(const QUuid& otherAvatar, quint64 time) { _lastBroadcastAttempts[otherAvatar] = time; }
+
     quint64 getLastOtherAvatarEncodeTime(QUuid otherAvatar) {
         quint64 result = 0;
         if (_lastOtherAvatarEncodeTime.find(otherAvatar) != _lastOtherAvatarEncodeTime.end()) {
@@ -139,6 +167,10 @@ private:
     std::unordered_map<QUuid, uint16_t> _lastBroadcastSequenceNumbers;
     std::unordered_map<QUuid, uint64_t> _lastBroadcastTimes;
 
+    // the last time we considered each "other" avatar for this receiver,
+    // used by the tiered update cadence in AvatarMixerSlave
+    std::unordered_map<QUuid, quint64> _lastBroadcastAttempts;
+
     // this is a map of the last time we encoded an "other" avatar for
     // sending to "this" node
     std::unordered_map<QUuid, quint64> _lastOtherAvatarEncodeTime;
@@ -154,8 +186,17 @@ private:
     SimpleMovingAverage _otherAvatarSkips;
     int _numOutOfOrderSends = 0;
 
+    static uint16_t acquireSimpleIndex();
+    static void releaseSimpleIndex(uint16_t index);
+    static size_t getSimpleIndexCount();
+
     SimpleMovingAverage _avgOtherAvatarDataRate;
     std::unordered_set<QUuid> _radiusIgnoredOthers;
+    uint16_t _simpleIndex { 0 };
+    std::vector<bool> _ignoredSimpleIndexes;
+    quint32 _builtIgnoreSetVersion { std::numeric_limits<quint32>::max() };
+    quint64 _builtIndexGeneration { std::numeric_limits<quint64>::max() };
+    AABox _bubbleBox;
     ViewFrustum _currentViewFrustum;
 
     int _recentOtherAvatarsInView { 0 };
@@ -143,18 +143,8 @@ void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
         // setup a PacketList for the avatarPackets
         auto avatarPacketList = NLPacketList::create(PacketType::BulkAvatarData);
 
-        // Define the minimum bubble size
-        static const glm::vec3 minBubbleSize = glm::vec3(0.3f, 1.3f, 0.3f);
-        // Define the scale of the box for the current node
-        glm::vec3 nodeBoxScale = (nodeData->getPosition() - nodeData->getGlobalBoundingBoxCorner()) * 2.0f;
-        // Set up the bounding box for the current node
-        AABox nodeBox(nodeData->getGlobalBoundingBoxCorner(), nodeBoxScale);
-        // Clamp the size of the bounding box to a minimum scale
-        if (glm::any(glm::lessThan(nodeBoxScale, minBubbleSize))) {
-            nodeBox.setScaleStayCentered(minBubbleSize);
-        }
-        // Quadruple the scale of both bounding boxes
-        nodeBox.embiggen(4.0f);
+        // The receiver's embiggened ignore-radius bubble, precomputed by the mixer this frame
+        const AABox& nodeBox = nodeData->getBubbleBox();
 
 
         // setup list of AvatarData as well as maps to map betweeen the AvatarData and the original nodes
@@ -214,10 +204,12 @@ void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
                     // make sure we have data for this avatar, that it isn't the same node,
                     // and isn't an avatar that the viewing node has ignored
                     // or that has ignored the viewing node
+                    // the ignore checks test the dense bitsets the mixer rebuilt this frame,
+                    // so each is a bit test rather than a locked hash probe
                     if (!avatarNode->getLinkedData()
                         || avatarNode->getUUID() == node->getUUID()
-                        || (node->isIgnoringNodeWithID(avatarNode->getUUID()) && !PALIsOpen)
-                        || (avatarNode->isIgnoringNodeWithID(node->getUUID()) && !getsAnyIgnored)) {
+                        || (nodeData->isIgnoringSimpleIndex(avatarNodeData->getSimpleIndex()) && !PALIsOpen)
+                        || (avatarNodeData->isIgnoringSimpleIndex(nodeData->getSimpleIndex()) && !getsAnyIgnored)) {
                         shouldIgnore = true;
                     } else {
 
@@ -225,19 +217,8 @@ void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
                         // Don't bother with these checks if the other avatar has their bubble enabled and we're gettingAnyIgnored
                         if (node->isIgnoreRadiusEnabled() || (avatarNode->isIgnoreRadiusEnabled() && !getsAnyIgnored)) {
 
-                            // Define the scale of the box for the current other node
-                            glm::vec3 otherNodeBoxScale = (avatarNodeData->getPosition() - avatarNodeData->getGlobalBoundingBoxCorner()) * 2.0f;
-                            // Set up the bounding box for the current other node
-                            AABox otherNodeBox(avatarNodeData->getGlobalBoundingBoxCorner(), otherNodeBoxScale);
-                            // Clamp the size of the bounding box to a minimum scale
-                            if (glm::any(glm::lessThan(otherNodeBoxScale, minBubbleSize))) {
-                                otherNodeBox.setScaleStayCentered(minBubbleSize);
-                            }
-                            // Quadruple the scale of both bounding boxes
-                            otherNodeBox.embiggen(4.0f);
-
-                            // Perform the collision check between the two bounding boxes
-                            if (nodeBox.touches(otherNodeBox)) {
+                            // Perform the collision check between the two precomputed bounding boxes
+                            if (nodeBox.touches(avatarNodeData->getBubbleBox())) {
                                 nodeData->ignoreOther(node, avatarNode);
                                 shouldIgnore = !getsAnyIgnored;
                             }
@@ -315,6 +296,34 @@ void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
             AABox otherNodeBox(otherNodeData->getGlobalBoundingBoxCorner(), otherNodeBoxScale);
             bool isInView = nodeData->otherAvatarInView(otherNodeBox);
 
+            // tiered cadence: avatars that are out of view or subtend a small angle for
+            // this receiver update at a reduced rate, so bandwidth and serialization CPU
+            // concentrate on the avatars the receiver is actually looking at
+            const float MID_TIER_APPARENT_SIZE = 0.04f; // a standard avatar beyond ~25m
+            const quint64 MID_TIER_INTERVAL = USECS_PER_SECOND / 15; // 15hz
+            const quint64 LOW_TIER_INTERVAL = USECS_PER_SECOND / 2;  // 2hz
+
+            quint64 sendInterval = 0; // full rate - every frame
+            if (!isInView) {
+                sendInterval = LOW_TIER_INTERVAL;
+            } else {
+                float distance = glm::length(otherPosition - cameraView.getPosition());
+                float boxRadius = 0.5f * glm::max(otherNodeBoxScale.x,
+                        glm::max(otherNodeBoxScale.y, otherNodeBoxScale.z));
+                if (distance > 1.0f && boxRadius / distance < MID_TIER_APPARENT_SIZE) {
+                    sendInterval = MID_TIER_INTERVAL;
+                }
+            }
+
+            // PAL wants fresh data for everyone, so don't gate while it's open
+            quint64 now = usecTimestampNow();
+            if (sendInterval > 0 && !PALIsOpen &&
+                    now - nodeData->getLastBroadcastAttempt(otherNode->getUUID()) < sendInterval) {
+                _stats.numOthersThrottledByTier++;
+                continue;
+            }
+            nodeData->setLastBroadcastAttempt(otherNode->getUUID(), now);
+
             // start a new segment in the PacketList for this avatar
             avatarPacketList->startSegment();
 
@@ -336,6 +345,15 @@ void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
             bool includeThisAvatar = true;
             auto lastEncodeForOther = nodeData->getLastOtherAvatarEncodeTime(otherNode->getUUID());
             QVector<JointData>& lastSentJointsForOther = nodeData->getLastOtherAvatarSentJoints(otherNode->getUUID());
+
+            if (detail == AvatarData::CullSmallData && !otherAvatar->hasDataChangedSince(lastEncodeForOther)) {
+                // nothing in the delta has changed since the last send to this receiver -
+                // send the minimal payload (global position only) instead of re-walking
+                // and re-culling every joint
+                detail = AvatarData::MinimumData;
+                _stats.numStaticOthers++;
+            }
+
             bool distanceAdjust = true;
             glm::vec3 viewerPosition = myPosition;
             AvatarDataPacket::HasFlags hasFlagsOut; // the result of the toByteArray
@@ -25,6 +25,8 @@ public:
     int numBytesSent { 0 };
     int numIdentityPackets { 0 };
     int numOthersIncluded { 0 };
+    int numStaticOthers { 0 };
+    int numOthersThrottledByTier { 0 };
     int overBudgetAvatars { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
@@ -45,6 +47,8 @@ public:
         numBytesSent = 0;
         numIdentityPackets = 0;
         numOthersIncluded = 0;
+        numStaticOthers = 0;
+        numOthersThrottledByTier = 0;
         overBudgetAvatars = 0;
 
         ignoreCalculationElapsedTime = 0;
@@ -64,6 +68,8 @@ public:
         numBytesSent += rhs.numBytesSent;
         numIdentityPackets += rhs.numIdentityPackets;
         numOthersIncluded += rhs.numOthersIncluded;
+        numStaticOthers += rhs.numStaticOthers;
+        numOthersThrottledByTier += rhs.numOthersThrottledByTier;
         overBudgetAvatars += rhs.overBudgetAvatars;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
@@ -10,6 +10,7 @@
 //
 
 #include <QThread>
+#include <QWriteLocker>
 
 #include <GLMHelpers.h>
 #include "ScriptableAvatar.h"
@@ -78,10 +79,15 @@ void ScriptableAvatar::update(float deltatime) {
             QStringList animationJointNames = _animation->getJointNames();
 
             const int nJoints = modelJoints.size();
-            if (_jointData.size() != nJoints) {
-                _jointData.resize(nJoints);
+            {
+                // serialization reads the joint data from the avatar data pump thread
+                QWriteLocker writeLock(&_jointDataLock);
+                if (_jointData.size() != nJoints) {
+                    _jointData.resize(nJoints);
+                }
             }
-            
+
+
             const int frameCount = _animation->getFrames().size();
             const FBXAnimationFrame& floorFrame = _animation->getFrames().at((int)glm::floor(currentFrame) % frameCount);
             const FBXAnimationFrame& ceilFrame = _animation->getFrames().at((int)glm::ceil(currentFrame) % frameCount);
@@ -100,6 +106,8 @@ void ScriptableAvatar::update(float deltatime) {
                  }
             }
             _animSkeleton->convertRelativePosesToAbsolute(poses);
+
+            QWriteLocker writeLock(&_jointDataLock);
             for (int i = 0; i < nJoints; i++) {
                 JointData& data = _jointData[i];
                 AnimPose& pose = poses[i];
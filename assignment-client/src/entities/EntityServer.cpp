@@ -36,8 +36,14 @@ EntityServer::EntityServer(ReceivedMessage& message) :
     DependencyManager::set<ScriptCache>();
 
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
-    packetReceiver.registerListenerForTypes({ PacketType::EntityAdd, PacketType::EntityEdit, PacketType::EntityErase, PacketType::EntityPhysics },
-                                            this, "handleEntityPacket");
+
+    // edit packets are high-rate and are only handed to the inbound packet processor's queue,
+    // so they are function dispatched on the networking thread to skip the event loop hop
+    packetReceiver.registerFunctionListenerForTypes(
+        { PacketType::EntityAdd, PacketType::EntityEdit, PacketType::EntityErase, PacketType::EntityPhysics },
+        this, [this](QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
+            handleEntityPacket(message, senderNode);
+        });
 }
 
 EntityServer::~EntityServer() {
@@ -11,15 +11,20 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonObject>
+#include <QtCore/QTimer>
 #include <QBuffer>
 #include <LogHandler.h>
 #include <MessagesClient.h>
+#include <NLPacketList.h>
 #include <NodeList.h>
 #include <udt/PacketHeaders.h>
 #include "MessagesMixer.h"
 
 const QString MESSAGES_MIXER_LOGGING_NAME = "messages-mixer";
 
+// how often queued messages are fanned out to their destinations
+const int MESSAGES_FANOUT_INTERVAL_MSECS = 10;
+
 MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(message)
 {
     connect(DependencyManager::get<NodeList>().data(), &NodeList::nodeKilled, this, &MessagesMixer::nodeKilled);
@@ -33,6 +38,8 @@ void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
     for (auto& channel : _channelSubscribers) {
         channel.remove(killedNode->getUUID());
     }
+
+    _pendingMessages.remove(killedNode->getUUID());
 }
 
 void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
@@ -42,17 +49,42 @@ void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessa
     bool isText;
     MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
 
+    // the sender already encoded this message for us - queue the raw bytes for every
+    // subscriber on the channel instead of re-encoding a packet list per destination
+    QByteArray encodedMessage = receivedMessage->getMessage();
+
+    auto subscribers = _channelSubscribers.constFind(channel);
+    if (subscribers != _channelSubscribers.constEnd()) {
+        for (const QUuid& subscriberID : *subscribers) {
+            _pendingMessages[subscriberID].append(encodedMessage);
+        }
+    }
+}
+
+void MessagesMixer::sendPendingMessages() {
+    if (_pendingMessages.isEmpty()) {
+        return;
+    }
+
     auto nodeList = DependencyManager::get<NodeList>();
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
-        nodeList->sendPacketList(std::move(packetList), *node);
-    });
+    // everything queued for one destination this tick shares a single packet list,
+    // so fan-out cost scales with distinct destinations rather than messages
+    for (auto it = _pendingMessages.constBegin(); it != _pendingMessages.constEnd(); ++it) {
+        auto node = nodeList->nodeWithUUID(it.key());
+
+        if (node && node->getActiveSocket()) {
+            auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+
+            for (const QByteArray& encodedMessage : it.value()) {
+                packetList->write(encodedMessage);
+            }
+
+            nodeList->sendPacketList(std::move(packetList), *node);
+        }
+    }
+
+    _pendingMessages.clear();
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
@@ -87,4 +119,9 @@ void MessagesMixer::run() {
     ThreadedAssignment::commonInit(MESSAGES_MIXER_LOGGING_NAME, NodeType::MessagesMixer);
     auto nodeList = DependencyManager::get<NodeList>();
     nodeList->addSetOfNodeTypesToNodeInterestSet({ NodeType::Agent, NodeType::EntityScriptServer });
+
+    // fan queued messages out to their destinations once per network tick
+    QTimer* fanoutTimer = new QTimer(this);
+    connect(fanoutTimer, &QTimer::timeout, this, &MessagesMixer::sendPendingMessages);
+    fanoutTimer->start(MESSAGES_FANOUT_INTERVAL_MSECS);
 }
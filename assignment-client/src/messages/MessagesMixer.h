@@ -32,9 +32,14 @@ private slots:
     void handleMessages(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
+    void sendPendingMessages();
 
 private:
     QHash<QString,QSet<QUuid>> _channelSubscribers;
+
+    // encoded messages queued for fan-out, grouped by destination - the QByteArray payloads
+    // are implicitly shared between every destination subscribed to the same channel
+    QHash<QUuid, QVector<QByteArray>> _pendingMessages;
 };
 
 #endif // hifi_MessagesMixer_h
@@ -10,12 +10,15 @@
 //
 
 #include <chrono>
+#include <future>
 #include <thread>
+#include <vector>
 
 #include <NodeList.h>
 #include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
+#include <ResourceGovernor.h>
 
 #include "OctreeQueryNode.h"
 #include "OctreeSendThread.h"
@@ -109,6 +112,14 @@ bool OctreeSendThread::process() {
             usecToSleep = MIN_USEC_TO_SLEEP;
         }
 
+        // if the process is over its CPU budget, idle for an extra send interval so
+        // co-hosted assignments can be scheduled - effectively halving our send rate
+        auto resourceGovernor = DependencyManager::get<ResourceGovernor>();
+        if (resourceGovernor && resourceGovernor->isOverCPUBudget()) {
+            usecToSleep += OCTREE_SEND_INTERVAL_USECS;
+            resourceGovernor->noteThrottle();
+        }
+
         {
             PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
             std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
@@ -299,6 +310,136 @@ int OctreeSendThread::handlePacketSend(SharedNodePointer node, OctreeQueryNode*
     return packetsSent;
 }
 
+bool OctreeSendThread::parallelSceneEncode(SharedNodePointer node, OctreeQueryNode* nodeData,
+                                           bool viewFrustumChanged, bool isFullScene) {
+    if (!_myServer->wantsParallelSceneEncode()) {
+        return false;
+    }
+
+    auto octree = _myServer->getOctree();
+
+    // partition the scene by the root's children - each is an independent subtree that a worker can
+    // encode as its own self-rooted sections. If the root element holds content of its own we can't
+    // cleanly partition below it, so fall back to the serial encode.
+    std::vector<OctreeElementPointer> subTrees;
+    bool rootHasContent = false;
+    octree->withReadLock([&] {
+        auto root = octree->getRoot();
+        rootHasContent = root->hasContent();
+        if (!rootHasContent) {
+            for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
+                OctreeElementPointer child = root->getChildAtIndex(i);
+                if (child) {
+                    subTrees.push_back(child);
+                }
+            }
+        }
+    });
+
+    if (rootHasContent || subTrees.empty()) {
+        return false;
+    }
+
+    // sized so a finalized section always fits in a freshly reset wire packet
+    const unsigned int sectionTargetSize =
+        MAX_OCTREE_PACKET_DATA_SIZE - sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE) - COMPRESS_PADDING;
+
+    int boundaryLevelAdjust = nodeData->getBoundaryLevelAdjust() +
+                              (viewFrustumChanged ? LOW_RES_MOVING_ADJUST : NO_BOUNDARY_ADJUST);
+    float octreeSizeScale = nodeData->getOctreeSizeScale();
+    quint64 lastTimeBagEmpty = nodeData->getLastTimeBagEmpty();
+
+    quint64 encodeStart = usecTimestampNow();
+    nodeData->stats.encodeStarted();
+
+    std::vector<std::future<std::list<QByteArray>>> futures;
+    for (auto& subTree : subTrees) {
+        futures.push_back(std::async(std::launch::async, [=]() {
+            std::list<QByteArray> sections;
+
+            // each worker owns its encode state - the subtrees are disjoint, so the per-element
+            // entries these maps accumulate never collide across workers. Scene stats aren't
+            // thread-safe, so workers encode without them.
+            OctreeElementExtraEncodeData extraEncodeData;
+            EncodeBitstreamParams params(INT_MAX, WANT_EXISTS_BITS, DONT_CHOP,
+                                         viewFrustumChanged,
+                                         boundaryLevelAdjust, octreeSizeScale,
+                                         lastTimeBagEmpty,
+                                         isFullScene, IGNORE_SCENE_STATS, _myServer->getJurisdiction(),
+                                         &extraEncodeData,
+                                         nodeData->getUsesFrustum(),
+                                         nodeData);
+            nodeData->copyCurrentViewFrustum(params.viewFrustum);
+            if (viewFrustumChanged) {
+                nodeData->copyLastKnownViewFrustum(params.lastViewFrustum);
+            }
+            params.trackSend = [this, node](const QUuid& dataID, quint64 dataEdited) {
+                _myServer->trackSend(dataID, dataEdited, node->getUUID());
+            };
+
+            OctreePacketData packetData(true, sectionTargetSize);
+            OctreeElementBag bag;
+            bag.insert(subTree);
+
+            while (!bag.isEmpty() && !nodeData->isShuttingDown()) {
+                // take the tree lock per section (as the serial encode does) so entity edits
+                // can interleave with a long-running scene encode
+                octree->withReadLock([&] {
+                    // perceptual order: encode (and therefore send) whatever looks largest in the
+                    // client's view first, so the visible world completes early in the transfer
+                    OctreeElementPointer sectionRoot = nodeData->getUsesFrustum()
+                        ? bag.extract(params.viewFrustum) : bag.extract();
+                    if (sectionRoot) {
+                        octree->encodeTreeBitstream(sectionRoot, &packetData, bag, params);
+                    }
+                });
+
+                if (packetData.hasContent()) {
+                    sections.emplace_back(reinterpret_cast<const char*>(packetData.getFinalizedData()),
+                                          packetData.getFinalizedSize());
+                }
+                packetData.changeSettings(true, sectionTargetSize);
+            }
+
+            octree->releaseSceneEncodeData(&extraEncodeData);
+            return sections;
+        }));
+    }
+
+    for (auto& future : futures) {
+        _pendingEncodedSections.splice(_pendingEncodedSections.end(), future.get());
+    }
+
+    nodeData->stats.encodeStopped();
+    OctreeServer::trackEncodeTime((float)(usecTimestampNow() - encodeStart));
+
+    return true;
+}
+
+QString OctreeSendThread::sceneCacheKey(OctreeQueryNode* nodeData) const {
+    // quantize to roughly the same thresholds the view-similarity check uses, so viewers whose
+    // frustums would be considered matching land on the same cache entry
+    const float POSITION_QUANTIZATION = 5.0f; // meters, matches the isVerySimilar position threshold
+    const float ORIENTATION_QUANTIZATION = 0.1f; // per quat component, roughly the 10 degree threshold
+
+    glm::vec3 position = nodeData->getCameraPosition();
+    glm::quat orientation = nodeData->getCameraOrientation();
+
+    QString key;
+    key.sprintf("%d,%d,%d/%d,%d,%d,%d/%d/%f/%d",
+        (int)glm::round(position.x / POSITION_QUANTIZATION),
+        (int)glm::round(position.y / POSITION_QUANTIZATION),
+        (int)glm::round(position.z / POSITION_QUANTIZATION),
+        (int)glm::round(orientation.x / ORIENTATION_QUANTIZATION),
+        (int)glm::round(orientation.y / ORIENTATION_QUANTIZATION),
+        (int)glm::round(orientation.z / ORIENTATION_QUANTIZATION),
+        (int)glm::round(orientation.w / ORIENTATION_QUANTIZATION),
+        nodeData->getBoundaryLevelAdjust(),
+        (double)nodeData->getOctreeSizeScale(),
+        nodeData->getUsesFrustum() ? 1 : 0);
+    return key;
+}
+
 /// Version of octree element distributor that sends the deepest LOD level at once
 int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged) {
 
@@ -309,7 +450,22 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
         return 0;
     }
 
-    if (nodeData->elementBag.isEmpty()) {
+    // A continuously moving view would otherwise restart the scene traversal every time the
+    // frustum drifts past the similarity threshold, and each restart re-walks everything in
+    // view. Cap the restart rate so an in-flight traversal persists across small view deltas;
+    // the changed-element timestamps still deliver edits every pass, and when the view stops
+    // changing the usual full-resolution pass runs unchanged.
+    const quint64 MIN_VIEW_RESTART_INTERVAL_USECS = 500 * USECS_PER_MSEC;
+    if (viewFrustumChanged) {
+        quint64 now = usecTimestampNow();
+        if (now - _lastViewRestartTime < MIN_VIEW_RESTART_INTERVAL_USECS) {
+            viewFrustumChanged = false;
+        } else {
+            _lastViewRestartTime = now;
+        }
+    }
+
+    if (nodeData->elementBag.isEmpty() && _pendingEncodedSections.empty()) {
         // if we're about to do a fresh pass,
         // give our pre-distribution processing a chance to do what it needs
         preDistributionProcessing();
@@ -355,7 +511,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
 
     // If the current view frustum has changed OR we have nothing to send, then search against
     // the current view frustum for things to send.
-    if (viewFrustumChanged || nodeData->elementBag.isEmpty()) {
+    if (viewFrustumChanged || (nodeData->elementBag.isEmpty() && _pendingEncodedSections.empty())) {
 
         // if our view has changed, we need to reset these things...
         if (viewFrustumChanged) {
@@ -364,6 +520,12 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
             }
         }
 
+        // any sections still queued from a parallel encode belong to the scene we're abandoning,
+        // as does anything accumulated toward the shared scene cache
+        _pendingEncodedSections.clear();
+        _cachingSceneSections = false;
+        _sceneCacheSections.clear();
+
         // track completed scenes and send out the stats packet accordingly
         nodeData->stats.sceneCompleted();
         nodeData->setLastRootTimestamp(_myServer->getOctree()->getRoot()->getLastChanged());
@@ -391,19 +553,34 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
         nodeData->stats.sceneStarted(isFullScene, viewFrustumChanged,
                                      _myServer->getOctree()->getRoot(), _myServer->getJurisdiction());
 
+        // A full, non-delta scene encodes to the same bitstream for every viewer with the same
+        // quantized view and LOD, so those scenes can be shared through the server's scene cache.
+        // Anything view-delta or change-pruned is per-viewer and never cached.
+        bool cacheableScene = _myServer->wantsSceneCache() && isFullScene && !viewFrustumChanged;
+        if (cacheableScene) {
+            _sceneCacheKey = sceneCacheKey(nodeData);
+            _sceneCacheRootTimestamp = _myServer->getOctree()->getRoot()->getLastChanged();
+        }
+
         // This is the start of "resending" the scene.
         bool dontRestartSceneOnMove = false; // this is experimental
         if (dontRestartSceneOnMove) {
             if (nodeData->elementBag.isEmpty()) {
                 nodeData->elementBag.insert(_myServer->getOctree()->getRoot());
             }
+        } else if (cacheableScene && _myServer->getCachedSceneSections(_sceneCacheKey, _pendingEncodedSections)) {
+            // another viewer already encoded this exact scene - replay its sections instead of re-encoding
         } else {
-            nodeData->elementBag.insert(_myServer->getOctree()->getRoot());
+            _cachingSceneSections = cacheableScene;
+            if (!parallelSceneEncode(node, nodeData, viewFrustumChanged, isFullScene)) {
+                nodeData->elementBag.insert(_myServer->getOctree()->getRoot());
+            }
         }
     }
 
-    // If we have something in our elementBag, then turn them into packets and send them out...
-    if (!nodeData->elementBag.isEmpty()) {
+    // If we have something in our elementBag (or sections queued by a parallel encode),
+    // then turn them into packets and send them out...
+    if (!nodeData->elementBag.isEmpty() || !_pendingEncodedSections.empty()) {
         int bytesWritten = 0;
         quint64 start = usecTimestampNow();
 
@@ -423,7 +600,28 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
             quint64 startInside = usecTimestampNow();
 
             bool lastNodeDidntFit = false; // assume each node fits
-            if (!nodeData->elementBag.isEmpty()) {
+            if (!_pendingEncodedSections.empty()) {
+                // drain sections already encoded by the parallel workers - each is finalized
+                // (compressed) and sized to fit a fresh wire packet, so we only need to flush
+                // the current packet when the next section won't fit alongside what's waiting
+                quint64 compressAndWriteStart = usecTimestampNow();
+                const QByteArray& section = _pendingEncodedSections.front();
+                unsigned int writtenSize = section.size() + sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE);
+                if (writtenSize > nodeData->getAvailable()) {
+                    quint64 packetSendingStart = usecTimestampNow();
+                    packetsSentThisInterval += handlePacketSend(node, nodeData, trueBytesSent, truePacketsSent);
+                    packetSendingElapsedUsec = (float)(usecTimestampNow() - packetSendingStart);
+                }
+                nodeData->writeToPacket(reinterpret_cast<const unsigned char*>(section.constData()), section.size());
+                if (_cachingSceneSections) {
+                    _sceneCacheSections.push_back(section);
+                }
+                _pendingEncodedSections.pop_front();
+                compressAndWriteElapsedUsec = (float)(usecTimestampNow() - compressAndWriteStart);
+
+                // once the last section is written, flow through the send logic below to flush it
+                completedScene = _pendingEncodedSections.empty() && nodeData->elementBag.isEmpty();
+            } else if (!nodeData->elementBag.isEmpty()) {
 
                 quint64 lockWaitStart = usecTimestampNow();
                 _myServer->getOctree()->withReadLock([&]{
@@ -431,7 +629,18 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
                     lockWaitElapsedUsec = (float)(lockWaitEnd - lockWaitStart);
                     quint64 encodeStart = usecTimestampNow();
 
-                    OctreeElementPointer subTree = nodeData->elementBag.extract();
+                    // Extract in perceptual order: whatever looks largest in the client's current
+                    // frustum is encoded (and therefore sent) first. Since the bag is re-scored
+                    // against the latest query frustum on every extract, the pending subtrees
+                    // re-order in flight as the client looks around.
+                    OctreeElementPointer subTree;
+                    if (nodeData->getUsesFrustum()) {
+                        ViewFrustum currentViewFrustum;
+                        nodeData->copyCurrentViewFrustum(currentViewFrustum);
+                        subTree = nodeData->elementBag.extract(currentViewFrustum);
+                    } else {
+                        subTree = nodeData->elementBag.extract();
+                    }
                     if (!subTree) {
                         return;
                     }
@@ -511,6 +720,10 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
                     }
 
                     nodeData->writeToPacket(_packetData.getFinalizedData(), _packetData.getFinalizedSize());
+                    if (_cachingSceneSections) {
+                        _sceneCacheSections.emplace_back(reinterpret_cast<const char*>(_packetData.getFinalizedData()),
+                                                         _packetData.getFinalizedSize());
+                    }
                     quint64 compressAndWriteEnd = usecTimestampNow();
                     compressAndWriteElapsedUsec = (float)(compressAndWriteEnd - compressAndWriteStart);
                 }
@@ -604,10 +817,17 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
 
         // if after sending packets we've emptied our bag, then we want to remember that we've sent all
         // the octree elements from the current view frustum
-        if (nodeData->elementBag.isEmpty()) {
+        if (nodeData->elementBag.isEmpty() && _pendingEncodedSections.empty()) {
             nodeData->updateLastKnownViewFrustum();
             nodeData->setViewSent(true);
 
+            // if this completed scene was cacheable, publish it for other viewers with the same view
+            if (_cachingSceneSections) {
+                _myServer->storeCachedSceneSections(_sceneCacheKey, _sceneCacheRootTimestamp, _sceneCacheSections);
+                _cachingSceneSections = false;
+                _sceneCacheSections.clear();
+            }
+
             // If this was a full scene then make sure we really send out a stats packet at this point so that
             // the clients will know the scene is stable
             if (isFullScene) {
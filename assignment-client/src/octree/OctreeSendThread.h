@@ -15,6 +15,7 @@
 #define hifi_OctreeSendThread_h
 
 #include <atomic>
+#include <list>
 
 #include <GenericThread.h>
 #include <Node.h>
@@ -60,12 +61,32 @@ protected:
 private:
     int handlePacketSend(SharedNodePointer node, OctreeQueryNode* nodeData, int& trueBytesSent, int& truePacketsSent, bool dontSuppressDuplicate = false);
     int packetDistributor(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged);
-    
+
+    /// Encode a full scene by partitioning the tree below the root across worker threads, leaving the finalized
+    /// sections in _pendingEncodedSections for the normal send flow to drain. Returns false if parallel encoding
+    /// is disabled or doesn't apply, in which case the caller should fall back to the serial bag-based encode.
+    bool parallelSceneEncode(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged, bool isFullScene);
+
+    /// Quantized view + LOD key used for the server's shared scene-section cache, so viewers with
+    /// near-identical views hash to the same cached scene.
+    QString sceneCacheKey(OctreeQueryNode* nodeData) const;
 
     QUuid _nodeUuid;
 
     OctreePacketData _packetData;
 
+    // finalized (compressed) scene sections produced by parallelSceneEncode(), drained by packetDistributor()
+    std::list<QByteArray> _pendingEncodedSections;
+
+    // when a cacheable full scene is being encoded, its finalized sections accumulate here so the
+    // completed scene can be stored in the server's shared cache for other viewers with the same view
+    bool _cachingSceneSections { false };
+    QString _sceneCacheKey;
+    quint64 _sceneCacheRootTimestamp { 0 };
+    std::list<QByteArray> _sceneCacheSections;
+
+    quint64 _lastViewRestartTime { 0 };
+
     int _nodeMissingCount { 0 };
     bool _isShuttingDown { false };
 };
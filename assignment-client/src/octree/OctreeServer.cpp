@@ -228,6 +228,8 @@ OctreeServer::OctreeServer(ReceivedMessage& message) :
     _debugSending(false),
     _debugReceiving(false),
     _verboseDebug(false),
+    _parallelSceneEncode(false),
+    _sceneCache(false),
     _jurisdiction(NULL),
     _jurisdictionSender(NULL),
     _octreeInboundPacketProcessor(NULL),
@@ -886,6 +888,50 @@ OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePo
     return sendThread;
 }
 
+bool OctreeServer::getCachedSceneSections(const QString& key, std::list<QByteArray>& sections) {
+    quint64 rootLastChanged = _tree->getRoot()->getLastChanged();
+
+    {
+        QReadLocker locker(&_cachedScenesLock);
+        auto cached = _cachedScenes.constFind(key);
+        if (cached != _cachedScenes.constEnd() && cached->rootLastChanged == rootLastChanged) {
+            sections = cached->sections;
+            return true;
+        }
+    }
+
+    // edits bubble their changed timestamps up to the root, so a mismatched root timestamp
+    // means the cached bitstream is stale - drop it rather than leave it to age out
+    QWriteLocker locker(&_cachedScenesLock);
+    auto cached = _cachedScenes.find(key);
+    if (cached != _cachedScenes.end() && cached->rootLastChanged != rootLastChanged) {
+        _cachedScenes.erase(cached);
+    }
+    return false;
+}
+
+void OctreeServer::storeCachedSceneSections(const QString& key, quint64 rootLastChanged,
+                                            const std::list<QByteArray>& sections) {
+    // if the tree changed while this scene was being encoded, the sections are already stale
+    if (_tree->getRoot()->getLastChanged() != rootLastChanged) {
+        return;
+    }
+
+    const int MAX_CACHED_SCENES = 8;
+
+    QWriteLocker locker(&_cachedScenesLock);
+    while (_cachedScenes.size() >= MAX_CACHED_SCENES && !_cachedScenes.contains(key)) {
+        auto oldest = _cachedScenes.begin();
+        for (auto it = _cachedScenes.begin(); it != _cachedScenes.end(); ++it) {
+            if (it->storedAt < oldest->storedAt) {
+                oldest = it;
+            }
+        }
+        _cachedScenes.erase(oldest);
+    }
+    _cachedScenes.insert(key, { rootLastChanged, usecTimestampNow(), sections });
+}
+
 void OctreeServer::removeSendThread() {
     // If the object has been deleted since the event was queued, sender() will return nullptr
     if (auto sendThread = qobject_cast<OctreeSendThread*>(sender())) {
@@ -1047,6 +1093,12 @@ void OctreeServer::readConfiguration() {
     readOptionBool(QString("debugTimestampNow"), settingsSectionObject, _debugTimestampNow);
     qDebug() << "debugTimestampNow=" << _debugTimestampNow;
 
+    readOptionBool(QString("parallelSceneEncode"), settingsSectionObject, _parallelSceneEncode);
+    qDebug("parallelSceneEncode=%s", debug::valueOf(_parallelSceneEncode));
+
+    readOptionBool(QString("sceneCache"), settingsSectionObject, _sceneCache);
+    qDebug("sceneCache=%s", debug::valueOf(_sceneCache));
+
     bool noPersist;
     readOptionBool(QString("NoPersist"), settingsSectionObject, noPersist);
     _wantPersist = !noPersist;
@@ -1080,6 +1132,9 @@ void OctreeServer::readConfiguration() {
         readOptionBool(QString("persistFileDownload"), settingsSectionObject, _persistFileDownload);
         qDebug() << "persistFileDownload=" << _persistFileDownload;
 
+        readOptionBool(QString("persistChunked"), settingsSectionObject, _persistChunked);
+        qDebug() << "persistChunked=" << _persistChunked;
+
     } else {
         qDebug("persistFilename= DISABLED");
     }
@@ -1266,7 +1321,8 @@ void OctreeServer::domainSettingsRequestComplete() {
         
         // now set up PersistThread
         _persistThread = new OctreePersistThread(_tree, persistAbsoluteFilePath, _backupDirectoryPath, _persistInterval,
-                                                 _wantBackup, _settings, _debugTimestampNow, _persistAsFileType);
+                                                 _wantBackup, _settings, _debugTimestampNow, _persistAsFileType,
+                                                 _persistChunked);
         _persistThread->initialize(true);
     }
     
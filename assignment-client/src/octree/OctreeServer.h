@@ -12,11 +12,13 @@
 #ifndef hifi_OctreeServer_h
 #define hifi_OctreeServer_h
 
+#include <list>
 #include <memory>
 
 #include <QStringList>
 #include <QDateTime>
 #include <QtCore/QCoreApplication>
+#include <QtCore/QReadWriteLock>
 
 #include <HTTPManager.h>
 
@@ -42,6 +44,13 @@ public:
     bool wantsDebugSending() const { return _debugSending; }
     bool wantsDebugReceiving() const { return _debugReceiving; }
     bool wantsVerboseDebug() const { return _verboseDebug; }
+    bool wantsParallelSceneEncode() const { return _parallelSceneEncode; }
+    bool wantsSceneCache() const { return _sceneCache; }
+
+    // shared cache of encoded full-scene sections, so viewers with near-identical views
+    // (e.g. fleets of headless agents) don't each re-encode the same scene
+    bool getCachedSceneSections(const QString& key, std::list<QByteArray>& sections);
+    void storeCachedSceneSections(const QString& key, quint64 rootLastChanged, const std::list<QByteArray>& sections);
 
     OctreePointer getOctree() { return _tree; }
     JurisdictionMap* getJurisdiction() { return _jurisdiction; }
@@ -182,6 +191,8 @@ protected:
     bool _debugReceiving;
     bool _debugTimestampNow;
     bool _verboseDebug;
+    bool _parallelSceneEncode;
+    bool _sceneCache;
     JurisdictionMap* _jurisdiction;
     JurisdictionSender* _jurisdictionSender;
     OctreeInboundPacketProcessor* _octreeInboundPacketProcessor;
@@ -190,6 +201,7 @@ protected:
     int _persistInterval;
     bool _wantBackup;
     bool _persistFileDownload;
+    bool _persistChunked { false };
     QString _backupExtensionFormat;
     int _backupInterval;
     int _maxBackupVersions;
@@ -200,6 +212,14 @@ protected:
     
     SendThreads _sendThreads;
 
+    struct CachedSceneSections {
+        quint64 rootLastChanged;
+        quint64 storedAt;
+        std::list<QByteArray> sections;
+    };
+    QHash<QString, CachedSceneSections> _cachedScenes;
+    QReadWriteLock _cachedScenesLock;
+
     static int _clientCount;
     static SimpleMovingAverage _averageLoopTime;
 
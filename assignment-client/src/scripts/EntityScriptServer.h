@@ -12,9 +12,11 @@
 #ifndef hifi_EntityScriptServer_h
 #define hifi_EntityScriptServer_h
 
+#include <mutex>
 #include <set>
 #include <vector>
 
+#include <QtCore/QHash>
 #include <QtCore/QObject>
 #include <QtCore/QUuid>
 
@@ -27,6 +29,31 @@
 static const int DEFAULT_MAX_ENTITY_PPS = 9000;
 static const int DEFAULT_ENTITY_PPS_PER_SCRIPT = 900;
 
+/// Routes entity script operations onto a pool of script engines, each running in its own
+/// thread, sharded by entity ID so one heavy script can't starve every entity's timers.
+/// Entities that must share an engine (and therefore a javascript heap) can be pinned to
+/// another entity's shard through the affinity API, which is exposed to entity server
+/// scripts as the EntityScriptPool global. Affinity only takes effect if it is established
+/// before the pinned entity's script is loaded.
+class EntityScriptEngineRouter : public QObject, public EntitiesScriptEngineProvider {
+    Q_OBJECT
+public:
+    void setEngines(const std::vector<QSharedPointer<ScriptEngine>>& engines);
+    QSharedPointer<ScriptEngine> engineForEntity(const EntityItemID& entityID);
+
+    // thread-safe, marshals the call onto the owning engine's thread
+    virtual void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                        const QStringList& params = QStringList()) override;
+
+    Q_INVOKABLE void setAffinity(const QUuid& entityID, const QUuid& groupEntityID);
+    Q_INVOKABLE void clearAffinity(const QUuid& entityID);
+
+private:
+    std::mutex _mutex;
+    std::vector<QSharedPointer<ScriptEngine>> _engines;
+    QHash<QUuid, QUuid> _affinities;
+};
+
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
 
@@ -61,7 +88,7 @@ private:
     void negotiateAudioFormat();
     void selectAudioFormat(const QString& selectedCodecName);
 
-    void resetEntitiesScriptEngine();
+    void resetEntitiesScriptEngines();
     void clear();
     void shutdownScriptEngine();
 
@@ -75,7 +102,8 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    QSharedPointer<ScriptEngine> _entitiesScriptEngine;
+    std::vector<QSharedPointer<ScriptEngine>> _entityScriptEngines;
+    EntityScriptEngineRouter _entityScriptEngineRouter;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
 
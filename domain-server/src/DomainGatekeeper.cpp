@@ -15,8 +15,13 @@
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
 
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
+
 #include <AccountManager.h>
 #include <Assignment.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
 
 #include "DomainServer.h"
 #include "DomainServerNodeData.h"
@@ -26,9 +31,63 @@ using SharedAssignmentPointer = QSharedPointer<Assignment>;
 DomainGatekeeper::DomainGatekeeper(DomainServer* server) :
     _server(server)
 {
-
+    qRegisterMetaType<NodeConnectionData>("NodeConnectionData");
 }
 
+// results posted back by the off-thread signature check
+static const int SIGNATURE_VERIFIED = 1;
+static const int SIGNATURE_MISMATCH = 0;
+static const int SIGNATURE_BAD_KEY = -1;
+
+// Runs the RSA verification for one agent connect request on the global thread pool and
+// posts the result back to the gatekeeper, which completes the connect on its own thread.
+// This keeps a stampede of joins verifying in parallel while node-list changes stay serialized.
+class SignatureVerificationWorker : public QRunnable {
+public:
+    SignatureVerificationWorker(DomainGatekeeper* gatekeeper, const NodeConnectionData& nodeConnection,
+                                const QString& username, const QByteArray& publicKeyArray,
+                                const QByteArray& usernameWithToken, const QByteArray& usernameSignature) :
+        _gatekeeper(gatekeeper),
+        _nodeConnection(nodeConnection),
+        _username(username),
+        _publicKeyArray(publicKeyArray),
+        _usernameWithToken(usernameWithToken),
+        _usernameSignature(usernameSignature)
+    {
+    }
+
+    virtual void run() override {
+        int result = SIGNATURE_BAD_KEY;
+
+        const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(_publicKeyArray.constData());
+        RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, _publicKeyArray.size());
+
+        if (rsaPublicKey) {
+            int decryptResult = RSA_verify(NID_sha256,
+                                           reinterpret_cast<const unsigned char*>(_usernameWithToken.constData()),
+                                           _usernameWithToken.size(),
+                                           reinterpret_cast<const unsigned char*>(_usernameSignature.constData()),
+                                           _usernameSignature.size(),
+                                           rsaPublicKey);
+            result = (decryptResult == 1) ? SIGNATURE_VERIFIED : SIGNATURE_MISMATCH;
+            RSA_free(rsaPublicKey);
+        }
+
+        QMetaObject::invokeMethod(_gatekeeper, "agentSignatureVerified", Qt::QueuedConnection,
+                                  Q_ARG(NodeConnectionData, _nodeConnection),
+                                  Q_ARG(QString, _username),
+                                  Q_ARG(int, result));
+    }
+
+private:
+    DomainGatekeeper* _gatekeeper;
+    NodeConnectionData _nodeConnection;
+    QString _username;
+    QByteArray _publicKeyArray;
+    QByteArray _usernameWithToken;
+    QByteArray _usernameSignature;
+};
+
 void DomainGatekeeper::addPendingAssignedNode(const QUuid& nodeUUID, const QUuid& assignmentUUID,
                                               const QUuid& walletUUID, const QString& nodeVersion) {
     _pendingAssignedNodes.emplace(std::piecewise_construct,
@@ -88,6 +147,11 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
     if (pendingAssignment != _pendingAssignedNodes.end()) {
         node = processAssignmentConnectRequest(nodeConnection, pendingAssignment->second);
     } else if (!STATICALLY_ASSIGNED_NODES.contains(nodeConnection.nodeType)) {
+        // bounded admission of agent connects - our own assignment nodes are never throttled
+        if (!admitConnectRequest(message->getSenderSockAddr())) {
+            return;
+        }
+
         QString username;
         QByteArray usernameSignature;
 
@@ -105,26 +169,7 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
     }
 
     if (node) {
-        // set the sending sock addr and node interest set on this node
-        DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-        nodeData->setSendingSockAddr(message->getSenderSockAddr());
-
-        // guard against patched agents asking to hear about other agents
-        auto safeInterestSet = nodeConnection.interestList.toSet();
-        if (nodeConnection.nodeType == NodeType::Agent) {
-            safeInterestSet.remove(NodeType::Agent);
-        }
-
-        nodeData->setNodeInterestSet(safeInterestSet);
-        nodeData->setPlaceName(nodeConnection.placeName);
-
-        qDebug() << "Allowed connection from node" << uuidStringWithoutCurlyBraces(node->getUUID())
-            << "on" << message->getSenderSockAddr() << "with MAC" << nodeConnection.hardwareAddress
-            << "and machine fingerprint" << nodeConnection.machineFingerprint;
-
-        // signal that we just connected a node so the DomainServer can get it a list
-        // and broadcast its presence right away
-        emit connectedNode(node);
+        handleConnectedNode(node, nodeConnection);
     } else {
         qDebug() << "Refusing connection from node at" << message->getSenderSockAddr()
             << "with hardware address" << nodeConnection.hardwareAddress
@@ -132,6 +177,51 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
     }
 }
 
+void DomainGatekeeper::handleConnectedNode(SharedNodePointer node, const NodeConnectionData& nodeConnection) {
+    // set the sending sock addr and node interest set on this node
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    nodeData->setSendingSockAddr(nodeConnection.senderSockAddr);
+
+    // guard against patched agents asking to hear about other agents
+    auto safeInterestSet = nodeConnection.interestList.toSet();
+    if (nodeConnection.nodeType == NodeType::Agent) {
+        safeInterestSet.remove(NodeType::Agent);
+    }
+
+    nodeData->setNodeInterestSet(safeInterestSet);
+    nodeData->setPlaceName(nodeConnection.placeName);
+
+    qDebug() << "Allowed connection from node" << uuidStringWithoutCurlyBraces(node->getUUID())
+        << "on" << nodeConnection.senderSockAddr << "with MAC" << nodeConnection.hardwareAddress
+        << "and machine fingerprint" << nodeConnection.machineFingerprint;
+
+    // signal that we just connected a node so the DomainServer can get it a list
+    // and broadcast its presence right away
+    emit connectedNode(node);
+}
+
+// how many agent connect requests we'll take on per admission window; the rest are sent
+// an explicit denial so their interface retries instead of silently timing out
+static const int MAX_AGENT_CONNECT_REQUESTS_PER_WINDOW = 50;
+
+bool DomainGatekeeper::admitConnectRequest(const HifiSockAddr& senderSockAddr) {
+    quint64 now = usecTimestampNow();
+    if (now >= _connectAdmissionWindowExpiry) {
+        _connectAdmissionWindowExpiry = now + USECS_PER_SECOND;
+        _connectAdmissionRemaining = MAX_AGENT_CONNECT_REQUESTS_PER_WINDOW;
+    }
+
+    if (_connectAdmissionRemaining <= 0) {
+        qDebug() << "Connect admission window exhausted, asking node at" << senderSockAddr << "to retry.";
+        sendConnectionDeniedPacket("Domain is handling many connections, please try again.", senderSockAddr,
+                                   DomainHandler::ConnectionRefusedReason::TooManyUsers);
+        return false;
+    }
+
+    _connectAdmissionRemaining--;
+    return true;
+}
+
 NodePermissions DomainGatekeeper::setPermissionsForUser(bool isLocalUser, QString verifiedUsername, const QHostAddress& senderAddress,
                                                         const QString& hardwareAddress, const QUuid& machineFingerprint) {
     NodePermissions userPerms;
@@ -368,18 +458,6 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
                                                                const QString& username,
                                                                const QByteArray& usernameSignature) {
 
-    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
-
-    // start with empty permissions
-    NodePermissions userPerms(NodePermissionsKey(username, 0));
-    userPerms.setAll(false);
-
-    // check if this user is on our local machine - if this is true set permissions to those for a "localhost" connection
-    QHostAddress senderHostAddress = nodeConnection.senderSockAddr.getAddress();
-    bool isLocalUser =
-        (senderHostAddress == limitedNodeList->getLocalSockAddr().getAddress() || senderHostAddress == QHostAddress::LocalHost);
-
-    QString verifiedUsername; // if this remains empty, consider this an anonymous connection attempt
     if (!username.isEmpty()) {
         if (usernameSignature.isEmpty()) {
             // user is attempting to prove their identity to us, but we don't have enough information
@@ -391,19 +469,80 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
             qDebug() << "stalling login because we have no username-signature:" << username;
 #endif
             return SharedNodePointer();
-        } else if (verifyUserSignature(username, usernameSignature, nodeConnection.senderSockAddr)) {
-            // they sent us a username and the signature verifies it
-            getGroupMemberships(username);
-            verifiedUsername = username;
-        } else {
-            // they sent us a username, but it didn't check out
-            requestUserPublicKey(username);
-#ifdef WANT_DEBUG
-            qDebug() << "stalling login because signature verification failed:" << username;
-#endif
+        }
+
+        auto lowerUsername = username.toLower();
+        QByteArray publicKeyArray = _userPublicKeys.value(lowerUsername);
+        const QUuid& connectionToken = _connectionTokenHash.value(lowerUsername);
+
+        if (publicKeyArray.isEmpty() || connectionToken.isNull()) {
+            // we can't check their signature without their public key and an outstanding connection token
+            qDebug() << "Insufficient data to decrypt username signature - delaying connection.";
+            requestUserPublicKey(username); // no joy.  maybe next time?
             return SharedNodePointer();
         }
+
+        QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
+        QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
+                                                                QCryptographicHash::Sha256);
+
+        // hand the expensive RSA check to the worker pool; agentSignatureVerified finishes
+        // this connect on the gatekeeper thread when the result comes back
+        auto worker = new SignatureVerificationWorker(this, nodeConnection, username, publicKeyArray,
+                                                      usernameWithToken, usernameSignature);
+        QThreadPool::globalInstance()->start(worker);
+        return SharedNodePointer();
+    }
+
+    // anonymous connection attempt - complete it in place
+    return completeAgentConnectRequest(nodeConnection, username, QString());
+}
+
+void DomainGatekeeper::agentSignatureVerified(NodeConnectionData nodeConnection, QString username, int verificationResult) {
+    if (verificationResult == SIGNATURE_MISMATCH) {
+        qDebug() << "Error decrypting username signature for " << username << "- denying connection.";
+        sendConnectionDeniedPacket("Error decrypting username signature.", nodeConnection.senderSockAddr,
+            DomainHandler::ConnectionRefusedReason::LoginError);
+        requestUserPublicKey(username); // no joy.  maybe next time?
+        return;
+    } else if (verificationResult == SIGNATURE_BAD_KEY) {
+        // we can't let this user in since we couldn't convert their public key to an RSA key we could use
+        qDebug() << "Couldn't convert data to RSA key for" << username << "- denying connection.";
+        sendConnectionDeniedPacket("Couldn't convert data to RSA key.", nodeConnection.senderSockAddr,
+            DomainHandler::ConnectionRefusedReason::LoginError);
+        requestUserPublicKey(username); // no joy.  maybe next time?
+        return;
+    }
+
+    qDebug() << "Username signature matches for" << username;
+    _connectionTokenHash.remove(username);
+    getGroupMemberships(username);
+
+    SharedNodePointer node = completeAgentConnectRequest(nodeConnection, username, username);
+
+    if (node) {
+        handleConnectedNode(node, nodeConnection);
+    } else {
+        qDebug() << "Refusing connection from node at" << nodeConnection.senderSockAddr
+            << "with hardware address" << nodeConnection.hardwareAddress
+            << "and machine fingerprint" << nodeConnection.machineFingerprint;
     }
+}
+
+SharedNodePointer DomainGatekeeper::completeAgentConnectRequest(const NodeConnectionData& nodeConnection,
+                                                                const QString& username,
+                                                                const QString& verifiedUsername) {
+
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    // start with empty permissions
+    NodePermissions userPerms(NodePermissionsKey(username, 0));
+    userPerms.setAll(false);
+
+    // check if this user is on our local machine - if this is true set permissions to those for a "localhost" connection
+    QHostAddress senderHostAddress = nodeConnection.senderSockAddr.getAddress();
+    bool isLocalUser =
+        (senderHostAddress == limitedNodeList->getLocalSockAddr().getAddress() || senderHostAddress == QHostAddress::LocalHost);
 
     userPerms = setPermissionsForUser(isLocalUser, verifiedUsername, nodeConnection.senderSockAddr.getAddress(),
                                       nodeConnection.hardwareAddress, nodeConnection.machineFingerprint);
@@ -510,74 +649,6 @@ SharedNodePointer DomainGatekeeper::addVerifiedNodeFromConnectRequest(const Node
     return newNode;
 }
 
-bool DomainGatekeeper::verifyUserSignature(const QString& username,
-                                           const QByteArray& usernameSignature,
-                                           const HifiSockAddr& senderSockAddr) {
-    // it's possible this user can be allowed to connect, but we need to check their username signature
-    auto lowerUsername = username.toLower();
-    QByteArray publicKeyArray = _userPublicKeys.value(lowerUsername);
-
-    const QUuid& connectionToken = _connectionTokenHash.value(lowerUsername);
-
-    if (!publicKeyArray.isEmpty() && !connectionToken.isNull()) {
-        // if we do have a public key for the user, check for a signature match
-
-        const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKeyArray.constData());
-
-        // first load up the public key into an RSA struct
-        RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKeyArray.size());
-
-        QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
-        QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
-                                                                QCryptographicHash::Sha256);
-
-        if (rsaPublicKey) {
-            int decryptResult = RSA_verify(NID_sha256,
-                                           reinterpret_cast<const unsigned char*>(usernameWithToken.constData()),
-                                           usernameWithToken.size(),
-                                           reinterpret_cast<const unsigned char*>(usernameSignature.constData()),
-                                           usernameSignature.size(),
-                                           rsaPublicKey);
-
-            if (decryptResult == 1) {
-                qDebug() << "Username signature matches for" << username;
-
-                // free up the public key and remove connection token before we return
-                RSA_free(rsaPublicKey);
-                _connectionTokenHash.remove(username);
-
-                return true;
-
-            } else {
-                if (!senderSockAddr.isNull()) {
-                    qDebug() << "Error decrypting username signature for " << username << "- denying connection.";
-                    sendConnectionDeniedPacket("Error decrypting username signature.", senderSockAddr,
-                        DomainHandler::ConnectionRefusedReason::LoginError);
-                }
-
-                // free up the public key, we don't need it anymore
-                RSA_free(rsaPublicKey);
-            }
-
-        } else {
-
-            // we can't let this user in since we couldn't convert their public key to an RSA key we could use
-            if (!senderSockAddr.isNull()) {
-                qDebug() << "Couldn't convert data to RSA key for" << username << "- denying connection.";
-                sendConnectionDeniedPacket("Couldn't convert data to RSA key.", senderSockAddr,
-                    DomainHandler::ConnectionRefusedReason::LoginError);
-            }
-        }
-    } else {
-        if (!senderSockAddr.isNull()) {
-            qDebug() << "Insufficient data to decrypt username signature - delaying connection.";
-        }
-    }
-
-    requestUserPublicKey(username); // no joy.  maybe next time?
-    return false;
-}
-
 bool DomainGatekeeper::isWithinMaxCapacity() {
     // find out what our maximum capacity is
     const QVariant* maximumUserCapacityVariant =
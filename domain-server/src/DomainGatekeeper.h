@@ -70,17 +70,22 @@ public slots:
 
 private slots:
     void handlePeerPingTimeout();
+    void agentSignatureVerified(NodeConnectionData nodeConnection, QString username, int verificationResult);
 private:
     SharedNodePointer processAssignmentConnectRequest(const NodeConnectionData& nodeConnection,
                                                       const PendingAssignedNodeData& pendingAssignment);
     SharedNodePointer processAgentConnectRequest(const NodeConnectionData& nodeConnection,
                                                  const QString& username,
                                                  const QByteArray& usernameSignature);
+    SharedNodePointer completeAgentConnectRequest(const NodeConnectionData& nodeConnection,
+                                                  const QString& username,
+                                                  const QString& verifiedUsername);
     SharedNodePointer addVerifiedNodeFromConnectRequest(const NodeConnectionData& nodeConnection,
                                                         QUuid nodeID = QUuid());
+
+    void handleConnectedNode(SharedNodePointer node, const NodeConnectionData& nodeConnection);
+    bool admitConnectRequest(const HifiSockAddr& senderSockAddr);
     
-    bool verifyUserSignature(const QString& username, const QByteArray& usernameSignature,
-                             const HifiSockAddr& senderSockAddr);
     bool isWithinMaxCapacity();
     
     bool shouldAllowConnectionFromNode(const QString& username, const QByteArray& usernameSignature,
@@ -101,6 +106,11 @@ private:
     
     QHash<QUuid, SharedNetworkPeer> _icePeers;
     
+    // admission window for agent connect requests, so join stampedes get explicit
+    // "try again" denials instead of queueing behind each other until they time out
+    quint64 _connectAdmissionWindowExpiry { 0 };
+    int _connectAdmissionRemaining { 0 };
+
     QHash<QString, QUuid> _connectionTokenHash;
     QHash<QString, QByteArray> _userPublicKeys;
     QSet<QString> _inFlightPublicKeyRequests; // keep track of which we've already asked for
@@ -852,7 +852,23 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     // update the connecting hostname in case it has changed
     nodeData->setPlaceName(nodeRequestData.placeName);
 
-    sendDomainListToNode(sendingNode, message->getSenderSockAddr());
+    // read the node list version this client has acked, if it sent one
+    quint32 ackedListVersion = 0;
+
+    if (message->getVersion() >= static_cast<PacketVersion>(DomainListRequestVersion::HasListVersionAck)) {
+        packetStream >> ackedListVersion;
+    }
+
+    // clients periodically get a full list even when in sync, as a backstop for any
+    // delta packets that were lost on the wire
+    const quint64 FULL_DOMAIN_LIST_SYNC_INTERVAL_USECS = 30 * USECS_PER_SECOND;
+
+    bool listIsCurrent = ackedListVersion == _nodeListVersion
+        && usecTimestampNow() - nodeData->getLastFullDomainListTimestamp() < FULL_DOMAIN_LIST_SYNC_INTERVAL_USECS;
+
+    // when this client's list is current we answer with just the list header - the add and
+    // remove records it has been receiving already describe everything since its last full list
+    sendDomainListToNode(sendingNode, message->getSenderSockAddr(), !listIsCurrent);
 }
 
 bool DomainServer::isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
@@ -950,6 +966,9 @@ QUrl DomainServer::oauthAuthorizationURL(const QUuid& stateUUID) {
 void DomainServer::handleConnectedNode(SharedNodePointer newNode) {
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(newNode->getLinkedData());
 
+    // membership just changed - move to a new list version
+    ++_nodeListVersion;
+
     // reply back to the user with a PacketType::DomainList
     sendDomainListToNode(newNode, nodeData->getSendingSockAddr());
 
@@ -962,8 +981,8 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode) {
     broadcastNewNode(newNode);
 }
 
-void DomainServer::sendDomainListToNode(const SharedNodePointer& node, const HifiSockAddr &senderSockAddr) {
-    const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NUM_BYTES_RFC4122_UUID + 2;
+void DomainServer::sendDomainListToNode(const SharedNodePointer& node, const HifiSockAddr &senderSockAddr, bool isFullList) {
+    const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NUM_BYTES_RFC4122_UUID + 2 + sizeof(quint32);
 
     // setup the extended header for the domain list packets
     // this data is at the beginning of each of the domain list packets
@@ -975,6 +994,7 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, const Hif
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << node->getUUID();
     extendedHeaderStream << node->getPermissions();
+    extendedHeaderStream << _nodeListVersion;
 
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
@@ -986,7 +1006,7 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, const Hif
     // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
     auto& nodeInterestSet = nodeData->getNodeInterestSet();
 
-    if (nodeInterestSet.size() > 0) {
+    if (isFullList && nodeInterestSet.size() > 0) {
 
         // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
         if (nodeData->isAuthenticated()) {
@@ -1014,6 +1034,11 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, const Hif
 
     // write the PacketList to this node
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
+
+    if (isFullList) {
+        // note when this node last saw the complete list, for the periodic full syncs
+        nodeData->setLastFullDomainListTimestamp(usecTimestampNow());
+    }
 }
 
 QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
@@ -1050,6 +1075,12 @@ void DomainServer::broadcastNewNode(const SharedNodePointer& addedNode) {
 
     int connectionSecretIndex = addNodePacket->pos();
 
+    // leave room for the connection secret, which is re-written per recipient below
+    addNodePacket->write(QByteArray(NUM_BYTES_RFC4122_UUID, 0));
+
+    // include the list version this add record brings an in-sync client up to
+    addNodeStream << _nodeListVersion;
+
     limitedNodeList->eachMatchingNode(
         [&](const SharedNodePointer& node)->bool {
             if (node->getLinkedData() && node->getActiveSocket() && node != addedNode) {
@@ -2188,6 +2219,10 @@ void DomainServer::nodeAdded(SharedNodePointer node) {
 }
 
 void DomainServer::nodeKilled(SharedNodePointer node) {
+    // membership just changed - move to a new list version so clients that miss the
+    // remove record (or a silent removal, which sends none) fall back to a full list
+    ++_nodeListVersion;
+
     // if this peer connected via ICE then remove them from our ICE peers hash
     _gatekeeper.removeICEPeer(node->getUUID());
 
@@ -2407,13 +2442,19 @@ void DomainServer::handleKillNode(SharedNodePointer nodeToKill) {
     auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
     const QUuid& nodeUUID = nodeToKill->getUUID();
 
+    // killing the node emits nodeKilled, which bumps _nodeListVersion before the remove
+    // record carrying that version is built below
     limitedNodeList->killNodeWithUUID(nodeUUID);
 
-    static auto removedNodePacket = NLPacket::create(PacketType::DomainServerRemovedNode, NUM_BYTES_RFC4122_UUID);
+    static auto removedNodePacket = NLPacket::create(PacketType::DomainServerRemovedNode,
+                                                     NUM_BYTES_RFC4122_UUID + sizeof(quint32));
 
     removedNodePacket->reset();
     removedNodePacket->write(nodeUUID.toRfc4122());
 
+    // include the list version this remove record brings an in-sync client up to
+    removedNodePacket->writePrimitive(_nodeListVersion);
+
     // broadcast out the DomainServerRemovedNode message
     limitedNodeList->eachMatchingNode([this, &nodeToKill](const SharedNodePointer& otherNode) -> bool {
         // only send the removed node packet to nodes that care about the type of node this was
@@ -130,7 +130,7 @@ private:
 
     void handleKillNode(SharedNodePointer nodeToKill);
 
-    void sendDomainListToNode(const SharedNodePointer& node, const HifiSockAddr& senderSockAddr);
+    void sendDomainListToNode(const SharedNodePointer& node, const HifiSockAddr& senderSockAddr, bool isFullList = true);
 
     bool isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
 
@@ -197,6 +197,10 @@ private:
     QTimer* _metaverseHeartbeatTimer { nullptr };
     QTimer* _metaverseGroupCacheTimer { nullptr };
 
+    // bumped on every node add or remove - clients ack the version they last received so
+    // list requests from up-to-date clients can be answered without re-sending every node
+    quint32 _nodeListVersion { 1 };
+
     QList<QHostAddress> _iceServerAddresses;
     QSet<QHostAddress> _failedIceServerAddresses;
     int _iceAddressLookupID { -1 };
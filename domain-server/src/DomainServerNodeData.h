@@ -68,7 +68,11 @@ public:
 
     bool wasAssigned() const { return _wasAssigned; };
     void setWasAssigned(bool wasAssigned) { _wasAssigned = wasAssigned; }
-    
+
+    quint64 getLastFullDomainListTimestamp() const { return _lastFullDomainListTimestamp; }
+    void setLastFullDomainListTimestamp(quint64 timestamp) { _lastFullDomainListTimestamp = timestamp; }
+
+
 private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
     QJsonArray overrideValuesIfNeeded(const QJsonArray& newStats);
@@ -93,6 +97,10 @@ private:
     QString _placeName;
 
     bool _wasAssigned { false };
+
+    // when this node last received a full domain list, for the periodic full syncs
+    // that backstop the versioned delta updates
+    quint64 _lastFullDomainListTimestamp { 0 };
 };
 
 #endif // hifi_DomainServerNodeData_h
@@ -34,5 +34,6 @@ public:
     QByteArray protocolVersion;
 };
 
+Q_DECLARE_METATYPE(NodeConnectionData)
 
 #endif // hifi_NodeConnectionData_h
@@ -0,0 +1,148 @@
+//
+//  IcePeerTable.cpp
+//  ice-server/src
+//
+//  Created by Stephen Birarda on 2016-04-14.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "IcePeerTable.h"
+
+#include <algorithm>
+
+// must stay a power of two so probing can mask instead of mod
+static const int INITIAL_PEER_TABLE_SIZE = 1024;
+
+// grow once occupied and tombstoned slots together pass this fraction of the table,
+// keeping linear probe chains short
+static const float MAX_PEER_TABLE_LOAD_FACTOR = 0.75f;
+
+IcePeerTable::IcePeerTable() {
+    _slots.resize(INITIAL_PEER_TABLE_SIZE);
+}
+
+int IcePeerTable::probeForUUID(const QUuid& peerUUID) const {
+    int mask = (int) _slots.size() - 1;
+    int index = qHash(peerUUID) & mask;
+
+    // linear probe until we hit the UUID or a free slot - tombstones keep the chain alive
+    while (_slots[index].state != SlotState::Free) {
+        if (_slots[index].state == SlotState::Occupied && _slots[index].peerUUID == peerUUID) {
+            return index;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    return -1;
+}
+
+SharedNetworkPeer IcePeerTable::find(const QUuid& peerUUID) const {
+    int index = probeForUUID(peerUUID);
+    return index != -1 ? _slots[index].peer : SharedNetworkPeer();
+}
+
+void IcePeerTable::insert(const QUuid& peerUUID, const SharedNetworkPeer& peer, quint64 heardMicrostamp) {
+    if (_occupiedCount + _tombstoneCount >= (int)(_slots.size() * MAX_PEER_TABLE_LOAD_FACTOR)) {
+        growAndRehash();
+    }
+
+    int mask = (int) _slots.size() - 1;
+    int index = qHash(peerUUID) & mask;
+    int insertIndex = -1;
+
+    while (_slots[index].state != SlotState::Free) {
+        if (_slots[index].state == SlotState::Occupied && _slots[index].peerUUID == peerUUID) {
+            // the peer is already present - just replace its peer object and timestamp
+            _slots[index].peer = peer;
+            _slots[index].lastHeardMicrostamp = heardMicrostamp;
+            return;
+        }
+
+        if (_slots[index].state == SlotState::Tombstone && insertIndex == -1) {
+            // remember the first tombstone on the chain so we can re-use it if the UUID turns out to be new
+            insertIndex = index;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    if (insertIndex == -1) {
+        insertIndex = index;
+    } else {
+        --_tombstoneCount;
+    }
+
+    Slot& slot = _slots[insertIndex];
+    slot.peerUUID = peerUUID;
+    slot.lastHeardMicrostamp = heardMicrostamp;
+    slot.peer = peer;
+    slot.state = SlotState::Occupied;
+
+    ++_occupiedCount;
+}
+
+void IcePeerTable::touch(const QUuid& peerUUID, quint64 heardMicrostamp) {
+    int index = probeForUUID(peerUUID);
+    if (index != -1) {
+        _slots[index].lastHeardMicrostamp = heardMicrostamp;
+    }
+}
+
+int IcePeerTable::sweepSlice(int maxSlots, quint64 silenceThresholdUsecs, quint64 nowUsecs,
+                             const PeerRemovedCallback& peerRemovedCallback) {
+    int tableSize = (int) _slots.size();
+    int slotsToInspect = std::min(maxSlots, tableSize);
+
+    for (int i = 0; i < slotsToInspect; ++i) {
+        Slot& slot = _slots[_sweepCursor];
+        _sweepCursor = (_sweepCursor + 1) & (tableSize - 1);
+
+        if (slot.state == SlotState::Occupied && (nowUsecs - slot.lastHeardMicrostamp) > silenceThresholdUsecs) {
+            SharedNetworkPeer removedPeer = slot.peer;
+            removeSlot(slot);
+
+            if (peerRemovedCallback) {
+                peerRemovedCallback(removedPeer);
+            }
+        }
+    }
+
+    return slotsToInspect;
+}
+
+void IcePeerTable::removeSlot(Slot& slot) {
+    slot.peerUUID = QUuid();
+    slot.lastHeardMicrostamp = 0;
+    slot.peer.clear();
+    slot.state = SlotState::Tombstone;
+
+    --_occupiedCount;
+    ++_tombstoneCount;
+}
+
+void IcePeerTable::growAndRehash() {
+    // re-hashing drops all of the tombstones, so we only need a bigger table when the
+    // slots are actually occupied - otherwise same-size re-hashing cleans the chains
+    int newSize = (int) _slots.size();
+    if (_occupiedCount >= (int)(_slots.size() * MAX_PEER_TABLE_LOAD_FACTOR / 2.0f)) {
+        newSize *= 2;
+    }
+
+    std::vector<Slot> oldSlots;
+    oldSlots.swap(_slots);
+
+    _slots.resize(newSize);
+    _occupiedCount = 0;
+    _tombstoneCount = 0;
+    _sweepCursor = 0;
+
+    for (auto& oldSlot : oldSlots) {
+        if (oldSlot.state == SlotState::Occupied) {
+            insert(oldSlot.peerUUID, oldSlot.peer, oldSlot.lastHeardMicrostamp);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+//
+//  IcePeerTable.h
+//  ice-server/src
+//
+//  Created by Stephen Birarda on 2016-04-14.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_IcePeerTable_h
+#define hifi_IcePeerTable_h
+
+#include <functional>
+#include <vector>
+
+#include <QtCore/QUuid>
+
+#include <NetworkPeer.h>
+
+// An open-addressing table from peer UUID to NetworkPeer, sized for a large number of
+// concurrently heartbeating peers. The last-heard timestamp for each peer is stored inline
+// in the slot so the inactivity sweep walks one flat array instead of chasing a heap
+// allocated NetworkPeer per bucket, and the sweep is incremental - each call inspects a
+// bounded slice of slots so we never stall packet processing on a full-table walk.
+class IcePeerTable {
+public:
+    IcePeerTable();
+
+    SharedNetworkPeer find(const QUuid& peerUUID) const;
+
+    // inserts the given peer, or if the UUID is already present replaces its peer object
+    void insert(const QUuid& peerUUID, const SharedNetworkPeer& peer, quint64 heardMicrostamp);
+
+    // refreshes the inline last-heard timestamp for an already present peer
+    void touch(const QUuid& peerUUID, quint64 heardMicrostamp);
+
+    using PeerRemovedCallback = std::function<void(const SharedNetworkPeer&)>;
+
+    // inspects up to maxSlots slots from the current sweep cursor, removing any peer whose
+    // inline timestamp is older than the silence threshold, and returns the number inspected
+    int sweepSlice(int maxSlots, quint64 silenceThresholdUsecs, quint64 nowUsecs,
+                   const PeerRemovedCallback& peerRemovedCallback);
+
+    int size() const { return _occupiedCount; }
+    int capacity() const { return (int) _slots.size(); }
+
+private:
+    enum class SlotState : quint8 {
+        Free,
+        Occupied,
+        Tombstone
+    };
+
+    struct Slot {
+        QUuid peerUUID;
+        quint64 lastHeardMicrostamp { 0 };
+        SharedNetworkPeer peer;
+        SlotState state { SlotState::Free };
+    };
+
+    int probeForUUID(const QUuid& peerUUID) const;
+    void growAndRehash();
+    void removeSlot(Slot& slot);
+
+    std::vector<Slot> _slots;
+    int _occupiedCount { 0 };
+    int _tombstoneCount { 0 };
+    int _sweepCursor { 0 };
+};
+
+#endif // hifi_IcePeerTable_h
@@ -102,7 +102,7 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
             QUuid connectRequestID;
             heartbeatStream >> connectRequestID;
             
-            SharedNetworkPeer matchingPeer = _activePeers.value(connectRequestID);
+            SharedNetworkPeer matchingPeer = _activePeers.find(connectRequestID);
             
             if (matchingPeer) {
                 
@@ -138,24 +138,29 @@ SharedNetworkPeer IceServer::addOrUpdateHeartbeatingPeer(NLPacket& packet) {
 
     // make sure this is a verified heartbeat before performing any more processing
     if (isVerifiedHeartbeat(senderUUID, signedPlaintext, signature)) {
-        // make sure we have this sender in our peer hash
-        SharedNetworkPeer matchingPeer = _activePeers.value(senderUUID);
+        auto heardAt = usecTimestampNow();
+
+        // make sure we have this sender in our peer table
+        SharedNetworkPeer matchingPeer = _activePeers.find(senderUUID);
 
         if (!matchingPeer) {
             // if we don't have this sender we need to create them now
             matchingPeer = QSharedPointer<NetworkPeer>::create(senderUUID, publicSocket, localSocket);
-            _activePeers.insert(senderUUID, matchingPeer);
+            _activePeers.insert(senderUUID, matchingPeer, heardAt);
 
             qDebug() << "Added a new network peer" << *matchingPeer;
         } else {
             // we already had the peer so just potentially update their sockets
             matchingPeer->setPublicSocket(publicSocket);
             matchingPeer->setLocalSocket(localSocket);
+
+            // refresh the inline activity timestamp the sweep reads
+            _activePeers.touch(senderUUID, heardAt);
         }
 
         // update our last heard microstamp for this network peer to now
-        matchingPeer->setLastHeardMicrostamp(usecTimestampNow());
-        
+        matchingPeer->setLastHeardMicrostamp(heardAt);
+
         return matchingPeer;
     } else {
         // not verified, return the empty peer object
@@ -290,22 +295,18 @@ void IceServer::sendPeerInformationPacket(const NetworkPeer& peer, const HifiSoc
 }
 
 void IceServer::clearInactivePeers() {
-    NetworkPeerHash::iterator peerItem = _activePeers.begin();
+    // sweep incrementally - size each slice so the full table is covered about once per
+    // silence threshold, keeping any one timer tick cheap even with a very large table
+    const int SWEEP_PASSES_PER_THRESHOLD = PEER_SILENCE_THRESHOLD_MSECS / CLEAR_INACTIVE_PEERS_INTERVAL_MSECS;
+    int slotsThisTick = (_activePeers.capacity() / SWEEP_PASSES_PER_THRESHOLD) + 1;
 
-    while (peerItem != _activePeers.end()) {
-        SharedNetworkPeer peer = peerItem.value();
+    static const quint64 PEER_SILENCE_THRESHOLD_USECS = PEER_SILENCE_THRESHOLD_MSECS * 1000;
 
-        if ((usecTimestampNow() - peer->getLastHeardMicrostamp()) > (PEER_SILENCE_THRESHOLD_MSECS * 1000)) {
-            qDebug() << "Removing peer from memory for inactivity -" << *peer;
+    _activePeers.sweepSlice(slotsThisTick, PEER_SILENCE_THRESHOLD_USECS, usecTimestampNow(),
+                            [this](const SharedNetworkPeer& peer) {
+        qDebug() << "Removing peer from memory for inactivity -" << *peer;
 
-            // if we had a public key for this domain, remove it now
-            _domainPublicKeys.erase(peer->getUUID());
-
-            // remove the peer object
-            peerItem = _activePeers.erase(peerItem);
-        } else {
-            // we didn't kill this peer, push the iterator forwards
-            ++peerItem;
-        }
-    }
+        // if we had a public key for this domain, remove it now
+        _domainPublicKeys.erase(peer->getUUID());
+    });
 }
@@ -22,6 +22,8 @@
 
 #include <NetworkPeer.h>
 #include <HTTPConnection.h>
+
+#include "IcePeerTable.h"
 #include <HTTPManager.h>
 #include <NLPacket.h>
 #include <udt/Socket.h>
@@ -48,8 +50,7 @@ private:
     QUuid _id;
     udt::Socket _serverSocket;
 
-    using NetworkPeerHash = QHash<QUuid, SharedNetworkPeer>;
-    NetworkPeerHash _activePeers;
+    IcePeerTable _activePeers;
 
     using RSAUniquePtr = std::unique_ptr<RSA, std::function<void(RSA*)>>;
     using DomainPublicKeyHash = std::unordered_map<QUuid, RSAUniquePtr>;
@@ -156,6 +156,7 @@
 #include "scripting/ControllerScriptingInterface.h"
 #include "scripting/ToolbarScriptingInterface.h"
 #include "scripting/RatesScriptingInterface.h"
+#include "StartupTaskGraph.h"
 #if defined(Q_OS_MAC) || defined(Q_OS_WIN)
 #include "SpeechRecognizer.h"
 #endif
@@ -431,97 +432,158 @@ bool setupEssentials(int& argc, char** argv) {
     const char* portStr = getCmdOption(argc, constArgv, "--listenPort");
     const int listenPort = portStr ? atoi(portStr) : INVALID_PORT;
 
-    Setting::init();
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::registerInheritance<AvatarHashMap, AvatarManager>();
+    DependencyManager::registerInheritance<EntityActionFactoryInterface, InterfaceActionFactory>();
+    DependencyManager::registerInheritance<SpatialParentFinder, InterfaceParentFinder>();
 
-    if (auto steamClient = PluginManager::getInstance()->getSteamClientPlugin()) {
-        steamClient->init();
-    }
+    // startup is expressed as a task graph so that each subsystem's init cost shows up
+    // in the log, and so tasks that don't need the main thread can leave it. Nearly all
+    // of these construct QObjects whose thread affinity must be the main thread, so they
+    // are main-thread tasks - the graph runs those in the order they're added here, which
+    // is the order this code has always run in.
+    StartupTaskGraph startupGraph;
+    bool previousSessionCrashed = false;
+
+    startupGraph.addMainThreadTask("settings", {}, [] {
+        Setting::init();
+    });
 
-    DependencyManager::set<tracing::Tracer>();
-    PROFILE_SET_THREAD_NAME("Main Thread");
+    startupGraph.addMainThreadTask("steam-client", {}, [] {
+        if (auto steamClient = PluginManager::getInstance()->getSteamClientPlugin()) {
+            steamClient->init();
+        }
+    });
+
+    startupGraph.addMainThreadTask("tracing", {}, [] {
+        DependencyManager::set<tracing::Tracer>();
+        PROFILE_SET_THREAD_NAME("Main Thread");
+    });
 
 #if defined(Q_OS_WIN)
-    // Select appropriate audio DLL
-    QString audioDLLPath = QCoreApplication::applicationDirPath();
-    if (IsWindows8OrGreater()) {
-        audioDLLPath += "/audioWin8";
-    } else {
-        audioDLLPath += "/audioWin7";
-    }
-    QCoreApplication::addLibraryPath(audioDLLPath);
+    startupGraph.addMainThreadTask("audio-dll-path", {}, [] {
+        // Select appropriate audio DLL
+        QString audioDLLPath = QCoreApplication::applicationDirPath();
+        if (IsWindows8OrGreater()) {
+            audioDLLPath += "/audioWin8";
+        } else {
+            audioDLLPath += "/audioWin7";
+        }
+        QCoreApplication::addLibraryPath(audioDLLPath);
+    });
 #endif
 
-    static const auto SUPPRESS_SETTINGS_RESET = "--suppress-settings-reset";
-    bool suppressPrompt = cmdOptionExists(argc, const_cast<const char**>(argv), SUPPRESS_SETTINGS_RESET);
-    bool previousSessionCrashed = CrashHandler::checkForResetSettings(suppressPrompt);
+    startupGraph.addMainThreadTask("crash-check", { "settings" }, [&] {
+        static const auto SUPPRESS_SETTINGS_RESET = "--suppress-settings-reset";
+        bool suppressPrompt = cmdOptionExists(argc, const_cast<const char**>(argv), SUPPRESS_SETTINGS_RESET);
+        previousSessionCrashed = CrashHandler::checkForResetSettings(suppressPrompt);
+    });
 
-    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
-    DependencyManager::registerInheritance<AvatarHashMap, AvatarManager>();
-    DependencyManager::registerInheritance<EntityActionFactoryInterface, InterfaceActionFactory>();
-    DependencyManager::registerInheritance<SpatialParentFinder, InterfaceParentFinder>();
+    startupGraph.addMainThreadTask("core-services", { "settings", "crash-check" }, [] {
+        DependencyManager::set<AccountManager>(std::bind(&Application::getUserAgent, qApp));
+        DependencyManager::set<StatTracker>();
+        DependencyManager::set<ScriptEngines>(ScriptEngine::CLIENT_SCRIPT);
+        DependencyManager::set<Preferences>();
+        DependencyManager::set<recording::Deck>();
+        DependencyManager::set<recording::Recorder>();
+    });
+
+    startupGraph.addMainThreadTask("networking", { "core-services" }, [listenPort] {
+        DependencyManager::set<AddressManager>();
+        // the NodeList must be set after the AddressManager
+        DependencyManager::set<NodeList>(NodeType::Agent, listenPort);
+    });
 
-    // Set dependencies
-    DependencyManager::set<AccountManager>(std::bind(&Application::getUserAgent, qApp));
-    DependencyManager::set<StatTracker>();
-    DependencyManager::set<ScriptEngines>(ScriptEngine::CLIENT_SCRIPT);
-    DependencyManager::set<Preferences>();
-    DependencyManager::set<recording::Deck>();
-    DependencyManager::set<recording::Recorder>();
-    DependencyManager::set<AddressManager>();
-    DependencyManager::set<NodeList>(NodeType::Agent, listenPort);
-    DependencyManager::set<GeometryCache>();
-    DependencyManager::set<ModelCache>();
-    DependencyManager::set<ScriptCache>();
-    DependencyManager::set<SoundCache>();
-    DependencyManager::set<Faceshift>();
-    DependencyManager::set<DdeFaceTracker>();
-    DependencyManager::set<EyeTracker>();
-    DependencyManager::set<AudioClient>();
-    DependencyManager::set<AudioScope>();
-    DependencyManager::set<DeferredLightingEffect>();
-    DependencyManager::set<TextureCache>();
-    DependencyManager::set<FramebufferCache>();
-    DependencyManager::set<AnimationCache>();
-    DependencyManager::set<ModelBlender>();
-    DependencyManager::set<UsersScriptingInterface>();
-    DependencyManager::set<AvatarManager>();
-    DependencyManager::set<LODManager>();
-    DependencyManager::set<StandAloneJSConsole>();
-    DependencyManager::set<DialogsManager>();
-    DependencyManager::set<BandwidthRecorder>();
-    DependencyManager::set<ResourceCacheSharedItems>();
-    DependencyManager::set<DesktopScriptingInterface>();
-    DependencyManager::set<EntityScriptingInterface>(true);
-    DependencyManager::set<RecordingScriptingInterface>();
-    DependencyManager::set<WindowScriptingInterface>();
-    DependencyManager::set<HMDScriptingInterface>();
-    DependencyManager::set<ResourceScriptingInterface>();
-    DependencyManager::set<TabletScriptingInterface>();
-    DependencyManager::set<ToolbarScriptingInterface>();
-    DependencyManager::set<UserActivityLoggerScriptingInterface>();
+    startupGraph.addMainThreadTask("asset-caches", { "networking" }, [] {
+        DependencyManager::set<GeometryCache>();
+        DependencyManager::set<ModelCache>();
+        DependencyManager::set<ScriptCache>();
+        DependencyManager::set<SoundCache>();
+    });
+
+    startupGraph.addMainThreadTask("face-trackers", {}, [] {
+        DependencyManager::set<Faceshift>();
+        DependencyManager::set<DdeFaceTracker>();
+        DependencyManager::set<EyeTracker>();
+    });
+
+    QStringList audioDependencies { "networking" };
+#if defined(Q_OS_WIN)
+    audioDependencies << "audio-dll-path";
+#endif
+    startupGraph.addMainThreadTask("audio-client", audioDependencies, [] {
+        DependencyManager::set<AudioClient>();
+        DependencyManager::set<AudioScope>();
+    });
+
+    startupGraph.addMainThreadTask("render-caches", { "asset-caches" }, [] {
+        DependencyManager::set<DeferredLightingEffect>();
+        DependencyManager::set<TextureCache>();
+        DependencyManager::set<FramebufferCache>();
+        DependencyManager::set<AnimationCache>();
+        DependencyManager::set<ModelBlender>();
+    });
+
+    startupGraph.addMainThreadTask("avatars", { "networking", "asset-caches" }, [] {
+        DependencyManager::set<UsersScriptingInterface>();
+        DependencyManager::set<AvatarManager>();
+        DependencyManager::set<LODManager>();
+    });
+
+    startupGraph.addMainThreadTask("dialogs-and-monitoring", { "core-services" }, [] {
+        DependencyManager::set<StandAloneJSConsole>();
+        DependencyManager::set<DialogsManager>();
+        DependencyManager::set<BandwidthRecorder>();
+        DependencyManager::set<ResourceCacheSharedItems>();
+        DependencyManager::set<DesktopScriptingInterface>();
+    });
+
+    startupGraph.addMainThreadTask("scripting-interfaces", { "networking", "asset-caches" }, [] {
+        DependencyManager::set<EntityScriptingInterface>(true);
+        DependencyManager::set<RecordingScriptingInterface>();
+        DependencyManager::set<WindowScriptingInterface>();
+        DependencyManager::set<HMDScriptingInterface>();
+        DependencyManager::set<ResourceScriptingInterface>();
+        DependencyManager::set<TabletScriptingInterface>();
+        DependencyManager::set<ToolbarScriptingInterface>();
+        DependencyManager::set<UserActivityLoggerScriptingInterface>();
 
 #if defined(Q_OS_MAC) || defined(Q_OS_WIN)
-    DependencyManager::set<SpeechRecognizer>();
+        DependencyManager::set<SpeechRecognizer>();
 #endif
-    DependencyManager::set<DiscoverabilityManager>();
-    DependencyManager::set<SceneScriptingInterface>();
-    DependencyManager::set<OffscreenUi>();
-    DependencyManager::set<AutoUpdater>();
-    DependencyManager::set<PathUtils>();
-    DependencyManager::set<InterfaceActionFactory>();
-    DependencyManager::set<AudioInjectorManager>();
-    DependencyManager::set<MessagesClient>();
-    controller::StateController::setStateVariables({ { STATE_IN_HMD, STATE_CAMERA_FULL_SCREEN_MIRROR,
-                    STATE_CAMERA_FIRST_PERSON, STATE_CAMERA_THIRD_PERSON, STATE_CAMERA_ENTITY, STATE_CAMERA_INDEPENDENT,
-                    STATE_SNAP_TURN, STATE_GROUNDED, STATE_NAV_FOCUSED } });
-    DependencyManager::set<UserInputMapper>();
-    DependencyManager::set<controller::ScriptingInterface, ControllerScriptingInterface>();
-    DependencyManager::set<InterfaceParentFinder>();
-    DependencyManager::set<EntityTreeRenderer>(true, qApp, qApp);
-    DependencyManager::set<CompositorHelper>();
-    DependencyManager::set<OffscreenQmlSurfaceCache>();
-    DependencyManager::set<EntityScriptClient>();
-    DependencyManager::set<EntityScriptServerLogClient>();
+        DependencyManager::set<DiscoverabilityManager>();
+        DependencyManager::set<SceneScriptingInterface>();
+    });
+
+    startupGraph.addMainThreadTask("ui-and-helpers", { "core-services" }, [] {
+        DependencyManager::set<OffscreenUi>();
+        DependencyManager::set<AutoUpdater>();
+        DependencyManager::set<PathUtils>();
+        DependencyManager::set<InterfaceActionFactory>();
+        DependencyManager::set<AudioInjectorManager>();
+        DependencyManager::set<MessagesClient>();
+    });
+
+    startupGraph.addMainThreadTask("input", {}, [] {
+        controller::StateController::setStateVariables({ { STATE_IN_HMD, STATE_CAMERA_FULL_SCREEN_MIRROR,
+                        STATE_CAMERA_FIRST_PERSON, STATE_CAMERA_THIRD_PERSON, STATE_CAMERA_ENTITY, STATE_CAMERA_INDEPENDENT,
+                        STATE_SNAP_TURN, STATE_GROUNDED, STATE_NAV_FOCUSED } });
+        DependencyManager::set<UserInputMapper>();
+        DependencyManager::set<controller::ScriptingInterface, ControllerScriptingInterface>();
+    });
+
+    startupGraph.addMainThreadTask("entities", { "asset-caches", "scripting-interfaces" }, [] {
+        DependencyManager::set<InterfaceParentFinder>();
+        DependencyManager::set<EntityTreeRenderer>(true, qApp, qApp);
+        DependencyManager::set<CompositorHelper>();
+        DependencyManager::set<OffscreenQmlSurfaceCache>();
+        DependencyManager::set<EntityScriptClient>();
+        DependencyManager::set<EntityScriptServerLogClient>();
+    });
+
+    startupGraph.run();
+    startupGraph.logTimeline();
+
     return previousSessionCrashed;
 }
 
@@ -984,12 +1046,13 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
 
     connect(this, SIGNAL(aboutToQuit()), this, SLOT(aboutToQuit()));
 
-    // hook up bandwidth estimator
+    // hook up bandwidth estimator -- the recorder's update slots are lock-free and
+    // thread-safe, so connect directly rather than queueing an event per packet
     QSharedPointer<BandwidthRecorder> bandwidthRecorder = DependencyManager::get<BandwidthRecorder>();
     connect(nodeList.data(), &LimitedNodeList::dataSent,
-        bandwidthRecorder.data(), &BandwidthRecorder::updateOutboundData);
+        bandwidthRecorder.data(), &BandwidthRecorder::updateOutboundData, Qt::DirectConnection);
     connect(nodeList.data(), &LimitedNodeList::dataReceived,
-        bandwidthRecorder.data(), &BandwidthRecorder::updateInboundData);
+        bandwidthRecorder.data(), &BandwidthRecorder::updateInboundData, Qt::DirectConnection);
 
     // FIXME -- I'm a little concerned about this.
     connect(myAvatar->getSkeletonModel().get(), &SkeletonModel::skeletonLoaded,
@@ -6376,17 +6439,24 @@ void Application::takeSnapshot(bool notify, bool includeAnimated, float aspectRa
         player->setMedia(QUrl::fromLocalFile(inf.absoluteFilePath()));
         player->play();
 
-        // Get a screenshot and save it
-        QString path = Snapshot::saveSnapshot(getActiveDisplayPlugin()->getScreenshot(aspectRatio));
-
-        // If we're not doing an animated snapshot as well...
-        if (!includeAnimated || !(SnapshotAnimated::alsoTakeAnimatedSnapshot.get())) {
-            // Tell the dependency manager that the capture of the still snapshot has taken place.
-            emit DependencyManager::get<WindowScriptingInterface>()->snapshotTaken(path, "", notify);
-        } else {
-            // Get an animated GIF snapshot and save it
-            SnapshotAnimated::saveSnapshotAnimated(path, aspectRatio, qApp, DependencyManager::get<WindowScriptingInterface>());
-        }
+        // Get a screenshot and save it.  The capture is asynchronous - the display plugin
+        // hands us the image a frame or two later so the render thread never stalls on a
+        // framebuffer readback - and the callback fires on the present thread, so bounce
+        // back to the main thread before touching the filesystem or the script interfaces.
+        getActiveDisplayPlugin()->getScreenshotAsync(aspectRatio, [notify, includeAnimated, aspectRatio, this](QImage screenshot) {
+            postLambdaEvent([notify, includeAnimated, aspectRatio, screenshot, this] {
+                QString path = Snapshot::saveSnapshot(screenshot);
+
+                // If we're not doing an animated snapshot as well...
+                if (!includeAnimated || !(SnapshotAnimated::alsoTakeAnimatedSnapshot.get())) {
+                    // Tell the dependency manager that the capture of the still snapshot has taken place.
+                    emit DependencyManager::get<WindowScriptingInterface>()->snapshotTaken(path, "", notify);
+                } else {
+                    // Get an animated GIF snapshot and save it
+                    SnapshotAnimated::saveSnapshotAnimated(path, aspectRatio, qApp, DependencyManager::get<WindowScriptingInterface>());
+                }
+            });
+        });
     });
 }
 void Application::shareSnapshot(const QString& path, const QUrl& href) {
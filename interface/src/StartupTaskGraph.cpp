@@ -0,0 +1,154 @@
+//
+//  StartupTaskGraph.cpp
+//  interface/src
+//
+//  Created by Brad Davis on 2017-04-18.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "StartupTaskGraph.h"
+
+#include <algorithm>
+
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
+
+#include <SharedUtil.h>
+
+#include "InterfaceLogging.h"
+
+namespace {
+    class StartupTaskRunnable : public QRunnable {
+    public:
+        StartupTaskRunnable(std::function<void()> function) : _function(function) {}
+        void run() override { _function(); }
+    private:
+        std::function<void()> _function;
+    };
+}
+
+void StartupTaskGraph::addTask(const QString& name, const QStringList& dependencies, Task task) {
+    _tasks.push_back({ name, dependencies, task, false });
+}
+
+void StartupTaskGraph::addMainThreadTask(const QString& name, const QStringList& dependencies, Task task) {
+    _tasks.push_back({ name, dependencies, task, true });
+}
+
+bool StartupTaskGraph::dependenciesMet(const TaskRecord& record) const {
+    for (const QString& dependency : record.dependencies) {
+        auto it = std::find_if(_tasks.begin(), _tasks.end(),
+                               [&](const TaskRecord& other) { return other.name == dependency; });
+        if (it != _tasks.end() && !it->finished) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StartupTaskGraph::runTask(TaskRecord& record, quint64 graphStart) {
+    quint64 start = usecTimestampNow();
+    record.startOffsetUsecs = start - graphStart;
+    record.task();
+    record.durationUsecs = usecTimestampNow() - start;
+}
+
+void StartupTaskGraph::run() {
+    quint64 graphStart = usecTimestampNow();
+
+    // complain about dependencies on tasks that were never added - they are treated as met
+    for (const auto& record : _tasks) {
+        for (const QString& dependency : record.dependencies) {
+            auto it = std::find_if(_tasks.begin(), _tasks.end(),
+                                   [&](const TaskRecord& other) { return other.name == dependency; });
+            if (it == _tasks.end()) {
+                qCWarning(interfaceapp) << "Startup task" << record.name
+                    << "depends on" << dependency << "which was never added";
+            }
+        }
+    }
+
+    auto threadPool = QThreadPool::globalInstance();
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (true) {
+        bool allFinished = true;
+        bool madeProgress = false;
+
+        for (auto& record : _tasks) {
+            if (record.finished) {
+                continue;
+            }
+            allFinished = false;
+
+            if (record.dispatched || !dependenciesMet(record)) {
+                continue;
+            }
+
+            record.dispatched = true;
+            madeProgress = true;
+
+            if (record.isMainThread) {
+                lock.unlock();
+                runTask(record, graphStart);
+                lock.lock();
+                record.finished = true;
+            } else {
+                TaskRecord* recordPointer = &record;
+                threadPool->start(new StartupTaskRunnable([this, recordPointer, graphStart] {
+                    runTask(*recordPointer, graphStart);
+                    std::lock_guard<std::mutex> finishedLock(_mutex);
+                    recordPointer->finished = true;
+                    _condition.notify_all();
+                }));
+            }
+        }
+
+        if (allFinished) {
+            break;
+        }
+
+        if (!madeProgress) {
+            bool inFlight = std::any_of(_tasks.begin(), _tasks.end(),
+                                        [](const TaskRecord& record) { return record.dispatched && !record.finished; });
+            if (inFlight) {
+                // a pool task will wake us when it finishes
+                _condition.wait(lock);
+            } else {
+                // a dependency cycle - run what is left in add order so startup cannot hang
+                qCWarning(interfaceapp) << "StartupTaskGraph has a dependency cycle - running remaining tasks in add order";
+                for (auto& record : _tasks) {
+                    if (!record.finished) {
+                        record.dispatched = true;
+                        lock.unlock();
+                        runTask(record, graphStart);
+                        lock.lock();
+                        record.finished = true;
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+
+void StartupTaskGraph::logTimeline() const {
+    std::vector<TaskRecord> sortedTasks;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        sortedTasks = _tasks;
+    }
+    std::sort(sortedTasks.begin(), sortedTasks.end(), [](const TaskRecord& a, const TaskRecord& b) {
+        return a.startOffsetUsecs < b.startOffsetUsecs;
+    });
+
+    qCDebug(interfaceapp_timing) << "Startup timeline (start offset / duration):";
+    for (const auto& record : sortedTasks) {
+        qCDebug(interfaceapp_timing, "  +%8.1f ms %8.1f ms %s%s",
+                (double)record.startOffsetUsecs / 1000.0, (double)record.durationUsecs / 1000.0,
+                record.isMainThread ? "" : "[pool] ", qPrintable(record.name));
+    }
+}
@@ -0,0 +1,66 @@
+//
+//  StartupTaskGraph.h
+//  interface/src
+//
+//  Created by Brad Davis on 2017-04-18.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_StartupTaskGraph_h
+#define hifi_StartupTaskGraph_h
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+/// A small dependency graph for application startup. Tasks are registered with a name
+/// and the names of the tasks they depend on; run() executes them all and records a
+/// per-task timeline that logTimeline() dumps to the log, so the cost of each startup
+/// subsystem is visible without a profiler attached.
+///
+/// Tasks added with addTask run on the global thread pool as soon as their dependencies
+/// have finished. Tasks added with addMainThreadTask run on the thread that calls run() -
+/// most of our startup constructs QObjects whose thread affinity must be the main thread,
+/// so those stay serialized, but they are guaranteed to execute in the order they were
+/// added whenever their dependencies allow it.
+class StartupTaskGraph {
+public:
+    using Task = std::function<void()>;
+
+    void addTask(const QString& name, const QStringList& dependencies, Task task);
+    void addMainThreadTask(const QString& name, const QStringList& dependencies, Task task);
+
+    /// runs every task, returning once all of them have finished
+    void run();
+
+    /// logs each task's start offset and duration, in start order
+    void logTimeline() const;
+
+private:
+    struct TaskRecord {
+        QString name;
+        QStringList dependencies;
+        Task task;
+        bool isMainThread;
+        bool dispatched { false };
+        bool finished { false };
+        quint64 startOffsetUsecs { 0 };
+        quint64 durationUsecs { 0 };
+    };
+
+    bool dependenciesMet(const TaskRecord& record) const; // caller must hold _mutex
+    void runTask(TaskRecord& record, quint64 graphStart);
+
+    std::vector<TaskRecord> _tasks;
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+};
+
+#endif // hifi_StartupTaskGraph_h
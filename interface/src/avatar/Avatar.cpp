@@ -334,6 +334,40 @@ void Avatar::updateAvatarEntities() {
     setAvatarEntityDataChanged(false);
 }
 
+// animation LOD tiers: avatars above each apparent size take full joint updates at the
+// corresponding rate and hold their last pose in between. Hysteresis keeps an avatar
+// sitting near a boundary from flickering between rates.
+static const float ANIMATION_LOD_APPARENT_SIZE[] = { 0.25f, 0.1f, 0.04f };
+static const uint64_t ANIMATION_LOD_INTERVAL[] = { 0, USECS_PER_SECOND / 30, USECS_PER_SECOND / 15, USECS_PER_SECOND / 8 };
+static const int ANIMATION_LOD_NUM_TIERS = 4;
+static const float ANIMATION_LOD_HYSTERESIS = 1.25f;
+
+bool Avatar::wantsAnimationUpdate(uint64_t now, const ViewFrustum& view) {
+    if (getIsLookAtTarget()) {
+        // the gaze target is promoted to full rate immediately.
+        _animationUpdateTier = 0;
+    } else {
+        float distance = glm::distance(view.getPosition(), getPosition());
+        float apparentSize = 2.0f * getBoundingRadius() / glm::max(distance, 0.1f);
+
+        // promote as soon as we cross a tier threshold, demote only when clearly below one.
+        int tier = _animationUpdateTier;
+        while (tier > 0 && apparentSize >= ANIMATION_LOD_APPARENT_SIZE[tier - 1]) {
+            tier--;
+        }
+        while (tier < ANIMATION_LOD_NUM_TIERS - 1 &&
+                apparentSize < ANIMATION_LOD_APPARENT_SIZE[tier] / ANIMATION_LOD_HYSTERESIS) {
+            tier++;
+        }
+        _animationUpdateTier = tier;
+    }
+    if (now >= _lastAnimationUpdate + ANIMATION_LOD_INTERVAL[_animationUpdateTier]) {
+        _lastAnimationUpdate = now;
+        return true;
+    }
+    return false;
+}
+
 void Avatar::simulate(float deltaTime, bool inView) {
     PROFILE_RANGE(simulation, "simulate");
 
@@ -909,6 +943,17 @@ QVector<glm::quat> Avatar::getJointRotations() const {
     return jointRotations;
 }
 
+QVector<glm::vec3> Avatar::getJointTranslations() const {
+    if (QThread::currentThread() != thread()) {
+        return AvatarData::getJointTranslations();
+    }
+    QVector<glm::vec3> jointTranslations(_skeletonModel->getJointStateCount());
+    for (int i = 0; i < _skeletonModel->getJointStateCount(); ++i) {
+        _skeletonModel->getJointTranslation(i, jointTranslations[i]);
+    }
+    return jointTranslations;
+}
+
 glm::quat Avatar::getJointRotation(int index) const {
     glm::quat rotation;
     _skeletonModel->getJointRotation(index, rotation);
@@ -1013,18 +1058,69 @@ glm::vec3 Avatar::getAbsoluteJointTranslationInObjectFrame(int index) const {
     }
 }
 
+void Avatar::invalidateJointIndicesCache() const {
+    QWriteLocker writeLock(&_modelJointIndicesCacheLock);
+    _modelJointsCached = false;
+    _modelJointIndicesCache.clear();
+}
+
 int Avatar::getJointIndex(const QString& name) const {
+    int result = getFauxJointIndex(name);
+    if (result != -1) {
+        return result;
+    }
+
+    // the cached name table is a plain copy of the model's, so any thread can search it
+    // without a blocking round-trip to the owner thread
+    {
+        QReadLocker readLock(&_modelJointIndicesCacheLock);
+        if (_modelJointsCached) {
+            return _modelJointIndicesCache.value(name) - 1;
+        }
+    }
+
     if (QThread::currentThread() != thread()) {
-        int result;
         QMetaObject::invokeMethod(const_cast<Avatar*>(this), "getJointIndex", Qt::BlockingQueuedConnection,
             Q_RETURN_ARG(int, result), Q_ARG(const QString&, name));
         return result;
     }
-    int result = getFauxJointIndex(name);
-    if (result != -1) {
+
+    if (!_skeletonModel->isActive()) {
+        return -1;
+    }
+
+    // compile the name table once per skeleton; subsequent lookups from any thread hit the cache
+    QWriteLocker writeLock(&_modelJointIndicesCacheLock);
+    if (!_modelJointsCached) {
+        _modelJointIndicesCache = _skeletonModel->getFBXGeometry().jointIndices;
+        _modelJointsCached = true;
+    }
+    return _modelJointIndicesCache.value(name) - 1;
+}
+
+QVector<int> Avatar::getJointIndices(const QStringList& names) const {
+    // warm the cache so the batch resolves locally; until the skeleton is loaded the cache
+    // cannot populate, so fall back to a single blocking hop for the whole batch
+    if (!names.isEmpty()) {
+        getJointIndex(names.first());
+    }
+    bool cached;
+    {
+        QReadLocker readLock(&_modelJointIndicesCacheLock);
+        cached = _modelJointsCached;
+    }
+    if (!cached && QThread::currentThread() != thread()) {
+        QVector<int> result;
+        QMetaObject::invokeMethod(const_cast<Avatar*>(this), "getJointIndices", Qt::BlockingQueuedConnection,
+            Q_RETURN_ARG(QVector<int>, result), Q_ARG(const QStringList&, names));
         return result;
     }
-    return _skeletonModel->isActive() ? _skeletonModel->getFBXGeometry().getJointIndex(name) : -1;
+    QVector<int> result;
+    result.reserve(names.size());
+    foreach (const QString& name, names) {
+        result.append(getJointIndex(name));
+    }
+    return result;
 }
 
 QStringList Avatar::getJointNames() const {
@@ -1068,6 +1164,7 @@ void Avatar::scaleVectorRelativeToPosition(glm::vec3 &positionToScale) const {
 
 void Avatar::setSkeletonModelURL(const QUrl& skeletonModelURL) {
     AvatarData::setSkeletonModelURL(skeletonModelURL);
+    invalidateJointIndicesCache();
     if (QThread::currentThread() == thread()) {
         _skeletonModel->setURL(_skeletonModelURL);
     } else {
@@ -1076,6 +1173,8 @@ void Avatar::setSkeletonModelURL(const QUrl& skeletonModelURL) {
 }
 
 void Avatar::setModelURLFinished(bool success) {
+    // a completed load (or fallback to the default) means any compiled joint name table is stale
+    invalidateJointIndicesCache();
     if (!success && _skeletonModelURL != AvatarData::defaultFullAvatarModelUrl()) {
         qCWarning(interfaceapp) << "Using default after failing to load Avatar model: " << _skeletonModelURL;
         // call _skeletonModel.setURL, but leave our copy of _skeletonModelURL alone.  This is so that
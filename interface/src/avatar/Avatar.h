@@ -103,9 +103,11 @@ public:
     virtual bool isMyAvatar() const override { return false; }
 
     virtual QVector<glm::quat> getJointRotations() const override;
+    virtual QVector<glm::vec3> getJointTranslations() const override;
     virtual glm::quat getJointRotation(int index) const override;
     virtual glm::vec3 getJointTranslation(int index) const override;
     virtual int getJointIndex(const QString& name) const override;
+    virtual QVector<int> getJointIndices(const QStringList& names) const override;
     virtual QStringList getJointNames() const override;
 
     Q_INVOKABLE virtual glm::quat getDefaultJointRotation(int index) const;
@@ -185,6 +187,11 @@ public:
 
     bool hasNewJointData() const { return _hasNewJointData; }
 
+    // animation LOD: decides whether this avatar is due for a full joint update this frame,
+    // based on projected screen size. Small distant avatars update at reduced rates and hold
+    // their last pose in between; the current gaze target always runs at full rate.
+    bool wantsAnimationUpdate(uint64_t now, const ViewFrustum& view);
+
 public slots:
 
     // FIXME - these should be migrated to use Pose data instead
@@ -205,6 +212,14 @@ protected:
 
     void setMotionState(AvatarMotionState* motionState);
 
+    // copy of the skeleton model's compiled joint name table, searchable from any thread
+    // without the blocking round-trip that reading the model itself requires; compiled once
+    // per skeleton on the owner thread and invalidated on skeleton model change
+    void invalidateJointIndicesCache() const;
+    mutable QReadWriteLock _modelJointIndicesCacheLock;
+    mutable QHash<QString, int> _modelJointIndicesCache; ///< 1-based, like FBXGeometry::jointIndices
+    mutable bool _modelJointsCached { false };
+
     SkeletonModelPointer _skeletonModel;
     glm::vec3 _skeletonOffset;
     std::vector<std::shared_ptr<Model>> _attachmentModels;
@@ -281,6 +296,8 @@ private:
     MapOfAvatarEntityDataHashes _avatarEntityDataHashes;
 
     uint64_t _lastRenderUpdateTime { 0 };
+    uint64_t _lastAnimationUpdate { 0 };
+    int _animationUpdateTier { 0 };
     int _leftPointerGeometryID { 0 };
     int _rightPointerGeometryID { 0 };
     int _nameRectGeometryID { 0 };
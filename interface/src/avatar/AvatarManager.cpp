@@ -224,10 +224,17 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
         if (now < updateExpiry) {
             // we're within budget
             bool inView = sortData.priority > OUT_OF_VIEW_THRESHOLD;
-            if (inView && avatar->hasNewJointData()) {
+            // animation LOD: distant in-view avatars take full joint updates at a reduced rate
+            bool animateNow = inView && avatar->wantsAnimationUpdate(now, cameraView);
+            if (animateNow && avatar->hasNewJointData()) {
                 numAvatarsUpdated++;
             }
-            avatar->simulate(deltaTime, inView);
+            if (animateNow) {
+                // unpack the newest deferred joint payload now that this avatar has
+                // earned a full update; payloads it superseded were never parsed
+                avatar->parseDeferredJointData();
+            }
+            avatar->simulate(deltaTime, animateNow);
             avatar->updateRenderItem(pendingChanges);
             avatar->setLastRenderUpdateTime(startTime);
         } else {
@@ -313,6 +320,10 @@ AvatarSharedPointer AvatarManager::addAvatar(const QUuid& sessionUUID, const QWe
     auto newAvatar = AvatarHashMap::addAvatar(sessionUUID, mixerWeakPointer);
     auto rawRenderableAvatar = std::static_pointer_cast<Avatar>(newAvatar);
 
+    // joint data for other avatars is unpacked on demand in updateOtherAvatars, so
+    // avatars the renderer will cull never pay for full packet parsing
+    rawRenderableAvatar->setDeferJointDataParse(true);
+
     rawRenderableAvatar->addToScene(rawRenderableAvatar);
 
     return newAvatar;
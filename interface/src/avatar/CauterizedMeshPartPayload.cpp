@@ -22,9 +22,9 @@ CauterizedMeshPartPayload::CauterizedMeshPartPayload(Model* model, int meshIndex
 
 void CauterizedMeshPartPayload::updateTransformForCauterizedMesh(
         const Transform& renderTransform,
-        const gpu::BufferPointer& buffer) {
+        const ClusterPaletteBuffer::Allocation& clusterPalette) {
     _cauterizedTransform = renderTransform;
-    _cauterizedClusterBuffer = buffer;
+    _cauterizedClusterPalette = clusterPalette;
 }
 
 void CauterizedMeshPartPayload::bindTransform(gpu::Batch& batch, const render::ShapePipeline::LocationsPointer locations, RenderArgs::RenderMode renderMode) const {
@@ -33,13 +33,15 @@ void CauterizedMeshPartPayload::bindTransform(gpu::Batch& batch, const render::S
     bool useCauterizedMesh = (renderMode != RenderArgs::RenderMode::SHADOW_RENDER_MODE) && skeleton->getEnableCauterization();
 
     if (useCauterizedMesh) {
-        if (_cauterizedClusterBuffer) {
-            batch.setUniformBuffer(ShapePipeline::Slot::BUFFER::SKINNING, _cauterizedClusterBuffer);
+        if (_cauterizedClusterPalette.size > 0) {
+            batch.setUniformBuffer(ShapePipeline::Slot::BUFFER::SKINNING, ClusterPaletteBuffer::instance().getBuffer(),
+                _cauterizedClusterPalette.offset, _cauterizedClusterPalette.size);
         }
         batch.setModelTransform(_cauterizedTransform);
     } else {
-        if (_clusterBuffer) {
-            batch.setUniformBuffer(ShapePipeline::Slot::BUFFER::SKINNING, _clusterBuffer);
+        if (_clusterPalette.size > 0) {
+            batch.setUniformBuffer(ShapePipeline::Slot::BUFFER::SKINNING, ClusterPaletteBuffer::instance().getBuffer(),
+                _clusterPalette.offset, _clusterPalette.size);
         }
         batch.setModelTransform(_transform);
     }
@@ -18,12 +18,16 @@ class CauterizedMeshPartPayload : public ModelMeshPartPayload {
 public:
     CauterizedMeshPartPayload(Model* model, int meshIndex, int partIndex, int shapeIndex, const Transform& transform, const Transform& offsetTransform);
 
-    void updateTransformForCauterizedMesh(const Transform& renderTransform, const gpu::BufferPointer& buffer);
+    void updateTransformForCauterizedMesh(const Transform& renderTransform, const ClusterPaletteBuffer::Allocation& clusterPalette);
 
     void bindTransform(gpu::Batch& batch, const render::ShapePipeline::LocationsPointer locations, RenderArgs::RenderMode renderMode) const override;
 
+    // The cauterized transform is picked per render mode in bindTransform, which an
+    // instanced merge would bypass
+    bool canMergeInstances() const override { return false; }
+
 private:
-    gpu::BufferPointer _cauterizedClusterBuffer;
+    ClusterPaletteBuffer::Allocation _cauterizedClusterPalette;
     Transform _cauterizedTransform;
 };
 
@@ -27,6 +27,9 @@ CauterizedModel::~CauterizedModel() {
 
 void CauterizedModel::deleteGeometry() {
     Model::deleteGeometry();
+    for (const auto& state : _cauterizeMeshStates) {
+        ClusterPaletteBuffer::instance().release(state.clusterPalette);
+    }
     _cauterizeMeshStates.clear();
 }
 
@@ -107,20 +110,25 @@ void CauterizedModel::updateClusterMatrices() {
     for (int i = 0; i < _meshStates.size(); i++) {
         Model::MeshState& state = _meshStates[i];
         const FBXMesh& mesh = geometry.meshes.at(i);
+        bool paletteChanged = false;
         for (int j = 0; j < mesh.clusters.size(); j++) {
             const FBXCluster& cluster = mesh.clusters.at(j);
             auto jointMatrix = _rig->getJointTransform(cluster.jointIndex);
+            glm::mat4 previous = state.clusterMatrices[j];
             glm_mat4u_mul(jointMatrix, cluster.inverseBindMatrix, state.clusterMatrices[j]);
+            paletteChanged = paletteChanged || (state.clusterMatrices[j] != previous);
         }
 
-        // Once computed the cluster matrices, update the buffer(s)
+        // Once computed the cluster matrices, refresh our range of the shared palette,
+        // but only when the pose actually moved since the last upload
         if (mesh.clusters.size() > 1) {
-            if (!state.clusterBuffer) {
-                state.clusterBuffer = std::make_shared<gpu::Buffer>(state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                                    (const gpu::Byte*) state.clusterMatrices.constData());
-            } else {
-                state.clusterBuffer->setSubData(0, state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                (const gpu::Byte*) state.clusterMatrices.constData());
+            auto& palette = ClusterPaletteBuffer::instance();
+            if (state.clusterPalette.size == 0) {
+                state.clusterPalette = palette.allocate(mesh.clusters.size());
+                paletteChanged = true;
+            }
+            if (paletteChanged) {
+                palette.update(state.clusterPalette, mesh.clusters.size(), state.clusterMatrices.constData());
             }
         }
     }
@@ -137,23 +145,26 @@ void CauterizedModel::updateClusterMatrices() {
         for (int i = 0; i < _cauterizeMeshStates.size(); i++) {
             Model::MeshState& state = _cauterizeMeshStates[i];
             const FBXMesh& mesh = geometry.meshes.at(i);
+            bool paletteChanged = false;
             for (int j = 0; j < mesh.clusters.size(); j++) {
                 const FBXCluster& cluster = mesh.clusters.at(j);
                 auto jointMatrix = _rig->getJointTransform(cluster.jointIndex);
                 if (_cauterizeBoneSet.find(cluster.jointIndex) != _cauterizeBoneSet.end()) {
                     jointMatrix = cauterizeMatrix;
                 }
+                glm::mat4 previous = state.clusterMatrices[j];
                 glm_mat4u_mul(jointMatrix, cluster.inverseBindMatrix, state.clusterMatrices[j]);
+                paletteChanged = paletteChanged || (state.clusterMatrices[j] != previous);
             }
 
             if (!_cauterizeBoneSet.empty() && (state.clusterMatrices.size() > 1)) {
-                if (!state.clusterBuffer) {
-                    state.clusterBuffer =
-                        std::make_shared<gpu::Buffer>(state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                      (const gpu::Byte*) state.clusterMatrices.constData());
-                } else {
-                    state.clusterBuffer->setSubData(0, state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                              (const gpu::Byte*) state.clusterMatrices.constData());
+                auto& palette = ClusterPaletteBuffer::instance();
+                if (state.clusterPalette.size == 0) {
+                    state.clusterPalette = palette.allocate(mesh.clusters.size());
+                    paletteChanged = true;
+                }
+                if (paletteChanged) {
+                    palette.update(state.clusterPalette, mesh.clusters.size(), state.clusterMatrices.constData());
                 }
             }
         }
@@ -218,7 +229,7 @@ void CauterizedModel::updateRenderItems() {
                             if (state.clusterMatrices.size() == 1) {
                                 renderTransform = modelTransform.worldTransform(Transform(state.clusterMatrices[0]));
                             }
-                            data.updateTransformForSkinnedMesh(renderTransform, modelTransform, state.clusterBuffer);
+                            data.updateTransformForSkinnedMesh(renderTransform, modelTransform, state.clusterPalette);
 
                             // this stuff for cauterized mesh
                             CauterizedModel* cModel = static_cast<CauterizedModel*>(data._model);
@@ -227,7 +238,7 @@ void CauterizedModel::updateRenderItems() {
                             if (cState.clusterMatrices.size() == 1) {
                                 renderTransform = modelTransform.worldTransform(Transform(cState.clusterMatrices[0]));
                             }
-                            data.updateTransformForCauterizedMesh(renderTransform, cState.clusterBuffer);
+                            data.updateTransformForCauterizedMesh(renderTransform, cState.clusterPalette);
                         }
                     }
                 });
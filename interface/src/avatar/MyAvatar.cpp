@@ -475,9 +475,21 @@ void MyAvatar::simulate(float deltaTime) {
     // before we perform rig animations and IK.
     updateSensorToWorldMatrix();
 
-    {
+    // The sensor-driven updates above (sensor-to-world matrix, palms, controller caches)
+    // are cheap and track the HMD at render rate. The full-body animation and IK solve
+    // below is the expensive part, so when rendering faster than the solve cadence
+    // (90Hz in HMD) we bank the delta and hand the rig the summed time on the next
+    // solve - animation advances at the correct speed, we just pay for the solve at a
+    // fixed rate while head and hands stay at render rate.
+    const float FULL_BODY_SOLVE_PERIOD = 1.0f / 60.0f;
+    _rigSolveTimeAccumulator += deltaTime;
+    if (_rigSolveTimeAccumulator >= FULL_BODY_SOLVE_PERIOD) {
         PerformanceTimer perfTimer("skeleton");
-        _skeletonModel->simulate(deltaTime);
+        _skeletonModel->simulate(_rigSolveTimeAccumulator);
+        _rigSolveTimeAccumulator = 0.0f;
+    } else {
+        // keep the rendered model tracking the avatar's position between solves
+        _skeletonModel->updateAttitude();
     }
 
     // we've achived our final adjusted position and rotation for the avatar
@@ -453,6 +453,10 @@ private:
     glm::vec2 _hmdSensorFacing;  // facing vector in xz plane
     glm::vec2 _hmdSensorFacingMovingAverage { 0, 0 };   // facing vector in xz plane
 
+    // time banked toward the next full-body rig solve, which runs at a fixed cadence
+    // rather than at render rate (see MyAvatar::simulate)
+    float _rigSolveTimeAccumulator { 0.0f };
+
     // cache of the current body position and orientation of the avatar's body,
     // in sensor space.
     glm::mat4 _bodySensorMatrix;
@@ -49,6 +49,7 @@ void SoftAttachmentModel::updateClusterMatrices() {
         MeshState& state = _meshStates[i];
         const FBXMesh& mesh = geometry.meshes.at(i);
 
+        bool paletteChanged = false;
         for (int j = 0; j < mesh.clusters.size(); j++) {
             const FBXCluster& cluster = mesh.clusters.at(j);
 
@@ -60,17 +61,21 @@ void SoftAttachmentModel::updateClusterMatrices() {
             } else {
                 jointMatrix = _rig->getJointTransform(cluster.jointIndex);
             }
+            glm::mat4 previous = state.clusterMatrices[j];
             glm_mat4u_mul(jointMatrix, cluster.inverseBindMatrix, state.clusterMatrices[j]);
+            paletteChanged = paletteChanged || (state.clusterMatrices[j] != previous);
         }
 
-        // Once computed the cluster matrices, update the buffer(s)
+        // Once computed the cluster matrices, refresh our range of the shared palette,
+        // but only when the pose actually moved since the last upload
         if (mesh.clusters.size() > 1) {
-            if (!state.clusterBuffer) {
-                state.clusterBuffer = std::make_shared<gpu::Buffer>(state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                                    (const gpu::Byte*) state.clusterMatrices.constData());
-            } else {
-                state.clusterBuffer->setSubData(0, state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                (const gpu::Byte*) state.clusterMatrices.constData());
+            auto& palette = ClusterPaletteBuffer::instance();
+            if (state.clusterPalette.size == 0) {
+                state.clusterPalette = palette.allocate(mesh.clusters.size());
+                paletteChanged = true;
+            }
+            if (paletteChanged) {
+                palette.update(state.clusterPalette, mesh.clusters.size(), state.clusterMatrices.constData());
             }
         }
     }
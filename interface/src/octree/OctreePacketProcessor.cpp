@@ -18,13 +18,14 @@
 
 OctreePacketProcessor::OctreePacketProcessor() {
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
-    
-    packetReceiver.registerDirectListenerForTypes({ PacketType::OctreeStats, PacketType::EntityData, PacketType::EntityErase },
-                                                  this, "handleOctreePacket");
-}
 
-void OctreePacketProcessor::handleOctreePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    queueReceivedPacket(message, senderNode);
+    // octree data packets are high-rate and just get queued for our processing thread, so they are
+    // function dispatched on the networking thread instead of going through QMetaObject invocation
+    packetReceiver.registerFunctionListenerForTypes(
+        { PacketType::OctreeStats, PacketType::EntityData, PacketType::EntityErase },
+        this, [this](QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
+            queueReceivedPacket(message, senderNode);
+        });
 }
 
 void OctreePacketProcessor::processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
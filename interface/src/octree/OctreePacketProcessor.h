@@ -27,8 +27,5 @@ signals:
 
 protected:
     virtual void processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) override;
-
-private slots:
-    void handleOctreePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
 };
 #endif // hifi_OctreePacketProcessor_h
@@ -25,6 +25,10 @@ QString SnapshotAnimated::snapshotAnimatedPath;
 QString SnapshotAnimated::snapshotStillPath;
 QVector<QImage> SnapshotAnimated::snapshotAnimatedFrameVector;
 QVector<qint64> SnapshotAnimated::snapshotAnimatedFrameDelayVector;
+QMutex SnapshotAnimated::snapshotAnimatedFrameMutex;
+QAtomicInt SnapshotAnimated::snapshotAnimatedPendingFrames(0);
+QAtomicInt SnapshotAnimated::snapshotAnimatedCaptureComplete(0);
+QAtomicInt SnapshotAnimated::snapshotAnimatedProcessKicked(0);
 Application* SnapshotAnimated::app;
 float SnapshotAnimated::aspectRatio;
 QSharedPointer<WindowScriptingInterface> SnapshotAnimated::snapshotAnimatedDM;
@@ -60,12 +64,34 @@ void SnapshotAnimated::saveSnapshotAnimated(QString pathStill, float aspectRatio
 
 void SnapshotAnimated::captureFrames() {
     if (SnapshotAnimated::snapshotAnimatedTimerRunning) {
-        // Get a screenshot from the display, then scale the screenshot down,
-        // then convert it to the image format the GIF library needs,
-        // then save all that to the QImage named "frame"
-        QImage frame(SnapshotAnimated::app->getActiveDisplayPlugin()->getScreenshot(SnapshotAnimated::aspectRatio));
-        frame = frame.scaledToWidth(SNAPSNOT_ANIMATED_WIDTH);
-        SnapshotAnimated::snapshotAnimatedFrameVector.append(frame);
+        // Request a screenshot from the display.  The capture is asynchronous - the
+        // display plugin hands us the image a frame or two later - so reserve this
+        // frame's slot in the vector now to keep the frames in capture order, and do
+        // the delay bookkeeping at request time so the GIF timing matches the
+        // capture cadence rather than the readback latency.
+        int frameIndex;
+        {
+            QMutexLocker lock(&SnapshotAnimated::snapshotAnimatedFrameMutex);
+            frameIndex = SnapshotAnimated::snapshotAnimatedFrameVector.size();
+            SnapshotAnimated::snapshotAnimatedFrameVector.append(QImage());
+        }
+        SnapshotAnimated::snapshotAnimatedPendingFrames.fetchAndAddOrdered(1);
+        SnapshotAnimated::app->getActiveDisplayPlugin()->getScreenshotAsync(SnapshotAnimated::aspectRatio, [frameIndex](QImage frame) {
+            // This fires on the present thread - push the scaling onto a worker thread
+            QtConcurrent::run([frameIndex, frame] {
+                {
+                    QMutexLocker lock(&SnapshotAnimated::snapshotAnimatedFrameMutex);
+                    SnapshotAnimated::snapshotAnimatedFrameVector[frameIndex] = frame.scaledToWidth(SNAPSNOT_ANIMATED_WIDTH);
+                }
+                // If this was the last outstanding frame of a finished capture, pack the GIF
+                if (SnapshotAnimated::snapshotAnimatedPendingFrames.fetchAndSubOrdered(1) == 1 &&
+                    SnapshotAnimated::snapshotAnimatedCaptureComplete.loadAcquire()) {
+                    if (SnapshotAnimated::snapshotAnimatedProcessKicked.testAndSetOrdered(0, 1)) {
+                        processFrames();
+                    }
+                }
+            });
+        });
 
         // If that was the first frame...
         if (SnapshotAnimated::snapshotAnimatedFirstFrameTimestamp == 0) {
@@ -88,8 +114,14 @@ void SnapshotAnimated::captureFrames() {
                 // Notify the user that we're processing the snapshot
                 emit SnapshotAnimated::snapshotAnimatedDM->processingGif();
 
-                // Kick off the thread that'll pack the frames into the GIF
-                QtConcurrent::run(processFrames);
+                // Pack the frames into the GIF once the in-flight captures have all landed.
+                // The last arriving frame normally kicks processFrames; if everything has
+                // already landed, kick it ourselves.
+                SnapshotAnimated::snapshotAnimatedCaptureComplete.storeRelease(1);
+                if (SnapshotAnimated::snapshotAnimatedPendingFrames.loadAcquire() == 0 &&
+                    SnapshotAnimated::snapshotAnimatedProcessKicked.testAndSetOrdered(0, 1)) {
+                    QtConcurrent::run(processFrames);
+                }
                 // Stop the snapshot QTimer. This action by itself DOES NOT GUARANTEE
                 // that the slot will not be called again in the future.
                 // See: http://lists.qt-project.org/pipermail/qt-interest-old/2009-October/013926.html
@@ -132,6 +164,8 @@ void SnapshotAnimated::processFrames() {
     // Reset the current frame timestamp
     SnapshotAnimated::snapshotAnimatedTimestamp = 0;
     SnapshotAnimated::snapshotAnimatedFirstFrameTimestamp = 0;
+    SnapshotAnimated::snapshotAnimatedCaptureComplete.storeRelease(0);
+    SnapshotAnimated::snapshotAnimatedProcessKicked.storeRelease(0);
 
     // Let the window scripting interface know that the snapshots have been taken.
     emit SnapshotAnimated::snapshotAnimatedDM->snapshotTaken(SnapshotAnimated::snapshotStillPath, SnapshotAnimated::snapshotAnimatedPath, false);
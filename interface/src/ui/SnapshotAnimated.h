@@ -12,6 +12,8 @@
 #ifndef hifi_SnapshotAnimated_h
 #define hifi_SnapshotAnimated_h
 
+#include <QtCore/QAtomicInt>
+#include <QtCore/QMutex>
 #include <QtCore/QVector>
 #include <Application.h>
 #include <DependencyManager.h>
@@ -41,6 +43,12 @@ private:
     static QString snapshotAnimatedPath;
     static QVector<QImage> snapshotAnimatedFrameVector;
     static QVector<qint64> snapshotAnimatedFrameDelayVector;
+    // Frames come back from the display plugin asynchronously, so the vector is
+    // written from worker threads while the timer thread is still appending slots.
+    static QMutex snapshotAnimatedFrameMutex;
+    static QAtomicInt snapshotAnimatedPendingFrames;
+    static QAtomicInt snapshotAnimatedCaptureComplete;
+    static QAtomicInt snapshotAnimatedProcessKicked;
     static QSharedPointer<WindowScriptingInterface> snapshotAnimatedDM;
     static Application* app;
     static float aspectRatio;
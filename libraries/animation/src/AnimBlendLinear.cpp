@@ -33,7 +33,7 @@ const AnimPoseVec& AnimBlendLinear::evaluate(const AnimVariantMap& animVars, flo
             pose = AnimPose::identity;
         }
     } else if (_children.size() == 1) {
-        _poses = _children[0]->evaluate(animVars, dt, triggersOut);
+        _poses = _children[0]->evaluateWithCache(animVars, dt, triggersOut);
     } else {
 
         float clampedAlpha = glm::clamp(_alpha, 0.0f, (float)(_children.size() - 1));
@@ -55,11 +55,11 @@ void AnimBlendLinear::evaluateAndBlendChildren(const AnimVariantMap& animVars, T
                                                size_t prevPoseIndex, size_t nextPoseIndex, float dt) {
     if (prevPoseIndex == nextPoseIndex) {
         // this can happen if alpha is on an integer boundary
-        _poses = _children[prevPoseIndex]->evaluate(animVars, dt, triggersOut);
+        _poses = _children[prevPoseIndex]->evaluateWithCache(animVars, dt, triggersOut);
     } else {
         // need to eval and blend between two children.
-        auto prevPoses = _children[prevPoseIndex]->evaluate(animVars, dt, triggersOut);
-        auto nextPoses = _children[nextPoseIndex]->evaluate(animVars, dt, triggersOut);
+        auto prevPoses = _children[prevPoseIndex]->evaluateWithCache(animVars, dt, triggersOut);
+        auto nextPoses = _children[nextPoseIndex]->evaluateWithCache(animVars, dt, triggersOut);
 
         if (prevPoses.size() > 0 && prevPoses.size() == nextPoses.size()) {
             _poses.resize(prevPoses.size());
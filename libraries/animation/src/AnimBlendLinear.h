@@ -38,6 +38,11 @@ protected:
     // for AnimDebugDraw rendering
     virtual const AnimPoseVec& getPosesInternal() const override;
 
+    virtual void gatherAnimVars(std::vector<QString>& animVarsOut) const override {
+        appendAnimVar(animVarsOut, _alphaVar);
+    }
+    virtual bool isTimeVarying() const override { return false; }
+
     void evaluateAndBlendChildren(const AnimVariantMap& animVars, Triggers& triggersOut, float alpha,
                                   size_t prevPoseIndex, size_t nextPoseIndex, float dt);
 
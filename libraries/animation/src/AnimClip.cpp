@@ -8,6 +8,8 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <map>
+
 #include "GLMHelpers.h"
 #include "AnimClip.h"
 #include "AnimationLogging.h"
@@ -15,6 +17,12 @@
 
 bool AnimClip::usePreAndPostPoseFromAnim = true;
 
+// decoded frames keyed by animation url and skeleton content key, so N avatars looping
+// the same idle on the same skeleton decode and store it once. weak entries let frames
+// free themselves when the last clip using them goes away. main thread only.
+using AnimFramesKey = std::pair<QString, uint64_t>;
+static std::map<AnimFramesKey, std::weak_ptr<const AnimClip::AnimFrames>> _sharedAnimFrames;
+
 AnimClip::AnimClip(const QString& id, const QString& url, float startFrame, float endFrame, float timeScale, bool loopFlag, bool mirrorFlag) :
     AnimNode(AnimNode::Type::Clip, id),
     _startFrame(startFrame),
@@ -50,10 +58,10 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, float dt,
         _networkAnim.reset();
     }
 
-    if (_anim.size()) {
+    if (_anim && _anim->size()) {
 
         // lazy creation of mirrored animation frames.
-        if (_mirrorFlag && _anim.size() != _mirrorAnim.size()) {
+        if (_mirrorFlag && _anim->size() != _mirrorAnim.size()) {
             buildMirrorAnim();
         }
 
@@ -67,12 +75,12 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, float dt,
 
         // It can be quite possible for the user to set _startFrame and _endFrame to
         // values before or past valid ranges.  We clamp the frames here.
-        int frameCount = (int)_anim.size();
+        int frameCount = (int)_anim->size();
         prevIndex = std::min(std::max(0, prevIndex), frameCount - 1);
         nextIndex = std::min(std::max(0, nextIndex), frameCount - 1);
 
-        const AnimPoseVec& prevFrame = _mirrorFlag ? _mirrorAnim[prevIndex] : _anim[prevIndex];
-        const AnimPoseVec& nextFrame = _mirrorFlag ? _mirrorAnim[nextIndex] : _anim[nextIndex];
+        const AnimPoseVec& prevFrame = _mirrorFlag ? _mirrorAnim[prevIndex] : (*_anim)[prevIndex];
+        const AnimPoseVec& nextFrame = _mirrorFlag ? _mirrorAnim[nextIndex] : (*_anim)[nextIndex];
         float alpha = glm::fract(_frame);
 
         ::blend(_poses.size(), &prevFrame[0], &nextFrame[0], alpha, &_poses[0]);
@@ -87,6 +95,28 @@ void AnimClip::loadURL(const QString& url) {
     _url = url;
 }
 
+void AnimClip::gatherAnimVars(std::vector<QString>& animVarsOut) const {
+    appendAnimVar(animVarsOut, _startFrameVar);
+    appendAnimVar(animVarsOut, _endFrameVar);
+    appendAnimVar(animVarsOut, _timeScaleVar);
+    appendAnimVar(animVarsOut, _loopFlagVar);
+    appendAnimVar(animVarsOut, _mirrorFlagVar);
+    appendAnimVar(animVarsOut, _frameVar);
+}
+
+bool AnimClip::isTimeVarying() const {
+    // keep polling evaluate() while the network animation is still loading.
+    if (_networkAnim) {
+        return true;
+    }
+    // when the frame is driven by an anim var, the output is a pure function of that var.
+    if (!_frameVar.isEmpty()) {
+        return false;
+    }
+    // a paused or single frame clip is static, and a non-looping clip parks on its end frame.
+    return _timeScale != 0.0f && _startFrame != _endFrame && (_loopFlag || _frame < _endFrame);
+}
+
 void AnimClip::setCurrentFrameInternal(float frame) {
     // because dt is 0, we should not encounter any triggers
     const float dt = 0.0f;
@@ -96,14 +126,27 @@ void AnimClip::setCurrentFrameInternal(float frame) {
 
 void AnimClip::copyFromNetworkAnim() {
     assert(_networkAnim && _networkAnim->isLoaded() && _skeleton);
-    _anim.clear();
+
+    const auto skeletonJointCount = _skeleton->getNumJoints();
+
+    // another clip may have already decoded this animation for an equivalent skeleton.
+    AnimFramesKey key(_url, _skeleton->getContentKey());
+    auto iter = _sharedAnimFrames.find(key);
+    if (iter != _sharedAnimFrames.end()) {
+        if (auto sharedFrames = iter->second.lock()) {
+            _anim = sharedFrames;
+            _mirrorAnim.clear();
+            _poses.resize(skeletonJointCount);
+            return;
+        }
+        _sharedAnimFrames.erase(iter);
+    }
 
     // build a mapping from animation joint indices to skeleton joint indices.
     // by matching joints with the same name.
     const FBXGeometry& geom = _networkAnim->getGeometry();
     AnimSkeleton animSkeleton(geom);
     const auto animJointCount = animSkeleton.getNumJoints();
-    const auto skeletonJointCount = _skeleton->getNumJoints();
     std::vector<int> jointMap;
     jointMap.reserve(animJointCount);
     for (int i = 0; i < animJointCount; i++) {
@@ -115,7 +158,8 @@ void AnimClip::copyFromNetworkAnim() {
     }
 
     const int frameCount = geom.animationFrames.size();
-    _anim.resize(frameCount);
+    auto anim = std::make_shared<AnimFrames>();
+    anim->resize(frameCount);
 
     for (int frame = 0; frame < frameCount; frame++) {
 
@@ -123,9 +167,9 @@ void AnimClip::copyFromNetworkAnim() {
 
         // init all joints in animation to default pose
         // this will give us a resonable result for bones in the model skeleton but not in the animation.
-        _anim[frame].reserve(skeletonJointCount);
+        (*anim)[frame].reserve(skeletonJointCount);
         for (int skeletonJoint = 0; skeletonJoint < skeletonJointCount; skeletonJoint++) {
-            _anim[frame].push_back(_skeleton->getRelativeDefaultPose(skeletonJoint));
+            (*anim)[frame].push_back(_skeleton->getRelativeDefaultPose(skeletonJoint));
         }
 
         for (int animJoint = 0; animJoint < animJointCount; animJoint++) {
@@ -165,11 +209,23 @@ void AnimClip::copyFromNetworkAnim() {
 
                 AnimPose trans = AnimPose(glm::vec3(1.0f), glm::quat(), relDefaultPose.trans() + boneLengthScale * (fbxAnimTrans - fbxZeroTrans));
 
-                _anim[frame][skeletonJoint] = trans * preRot * rot * postRot;
+                (*anim)[frame][skeletonJoint] = trans * preRot * rot * postRot;
             }
         }
     }
 
+    // publish the frames for other clips on equivalent skeletons, dropping
+    // any entries whose frames have since been freed.
+    _anim = anim;
+    for (auto entry = _sharedAnimFrames.begin(); entry != _sharedAnimFrames.end();) {
+        if (entry->second.expired()) {
+            entry = _sharedAnimFrames.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+    _sharedAnimFrames[key] = _anim;
+
     // mirrorAnim will be re-built on demand, if needed.
     _mirrorAnim.clear();
 
@@ -180,8 +236,8 @@ void AnimClip::buildMirrorAnim() {
     assert(_skeleton);
 
     _mirrorAnim.clear();
-    _mirrorAnim.reserve(_anim.size());
-    for (auto& relPoses : _anim) {
+    _mirrorAnim.reserve(_anim->size());
+    for (auto& relPoses : *_anim) {
         _mirrorAnim.push_back(relPoses);
         _skeleton->mirrorRelativePoses(_mirrorAnim.back());
     }
@@ -27,6 +27,12 @@ public:
 
     static bool usePreAndPostPoseFromAnim;
 
+    // decoded animation frames, remapped onto a particular skeleton. immutable once
+    // built, and shared between all clips playing the same animation url on an
+    // equivalent skeleton (same AnimSkeleton content key).
+    using AnimFrames = std::vector<AnimPoseVec>;
+    using AnimFramesConstPointer = std::shared_ptr<const AnimFrames>;
+
     AnimClip(const QString& id, const QString& url, float startFrame, float endFrame, float timeScale, bool loopFlag, bool mirrorFlag);
     virtual ~AnimClip() override;
 
@@ -58,6 +64,9 @@ protected:
 
     virtual void setCurrentFrameInternal(float frame) override;
 
+    virtual void gatherAnimVars(std::vector<QString>& animVarsOut) const override;
+    virtual bool isTimeVarying() const override;
+
     void copyFromNetworkAnim();
     void buildMirrorAnim();
 
@@ -67,8 +76,8 @@ protected:
     AnimationPointer _networkAnim;
     AnimPoseVec _poses;
 
-    // _anim[frame][joint]
-    std::vector<AnimPoseVec> _anim;
+    // (*_anim)[frame][joint], shared with other clips, do not mutate
+    AnimFramesConstPointer _anim;
     std::vector<AnimPoseVec> _mirrorAnim;
 
     QString _url;
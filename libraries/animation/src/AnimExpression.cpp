@@ -21,6 +21,88 @@ AnimExpression::AnimExpression(const QString& str) :
     while(!_tokenStack.empty()) {
         _tokenStack.pop();
     }
+    foldConstants();
+}
+
+// Fold subexpressions made entirely of constants down to a single opcode once at compile
+// time, so the per-frame evaluation only spends time on the operators that read anim vars.
+// The fold replays the same eval functions used at runtime, so results match exactly.
+void AnimExpression::foldConstants() {
+    static const AnimVariantMap emptyMap;
+    _foldedOpCodes.clear();
+    _foldedOpCodes.reserve(_opCodes.size());
+
+    // tracks, for each value on the simulated evaluation stack, whether it is a constant.
+    // a constant entry is always a single opcode at the top of _foldedOpCodes, because
+    // constant operands fold as soon as their operator is seen.
+    std::vector<bool> constantStack;
+
+    for (auto& opCode : _opCodes) {
+        int numArgs;
+        switch (opCode.type) {
+        case OpCode::Identifier:
+        case OpCode::Int:
+        case OpCode::Float:
+        case OpCode::Bool:
+            constantStack.push_back(opCode.type != OpCode::Identifier);
+            _foldedOpCodes.push_back(opCode);
+            continue;
+        case OpCode::Not:
+        case OpCode::UnaryMinus:
+            numArgs = 1;
+            break;
+        default:
+            numArgs = 2;
+            break;
+        }
+
+        if ((int)constantStack.size() < numArgs) {
+            // malformed expression, evaluate the opcodes as parsed
+            _foldedOpCodes = _opCodes;
+            return;
+        }
+
+        bool allConstant = true;
+        for (int i = 0; i < numArgs; i++) {
+            allConstant = allConstant && constantStack[constantStack.size() - numArgs + i];
+        }
+
+        if (allConstant) {
+            // replay the operator over the constant operands now
+            std::stack<OpCode> stack;
+            for (int i = 0; i < numArgs; i++) {
+                stack.push(_foldedOpCodes[_foldedOpCodes.size() - numArgs + i]);
+            }
+            switch (opCode.type) {
+            case OpCode::And: evalAnd(emptyMap, stack); break;
+            case OpCode::Or: evalOr(emptyMap, stack); break;
+            case OpCode::GreaterThan: evalGreaterThan(emptyMap, stack); break;
+            case OpCode::GreaterThanEqual: evalGreaterThanEqual(emptyMap, stack); break;
+            case OpCode::LessThan: evalLessThan(emptyMap, stack); break;
+            case OpCode::LessThanEqual: evalLessThanEqual(emptyMap, stack); break;
+            case OpCode::Equal: evalEqual(emptyMap, stack); break;
+            case OpCode::NotEqual: evalNotEqual(emptyMap, stack); break;
+            case OpCode::Not: evalNot(emptyMap, stack); break;
+            case OpCode::Subtract: evalSubtract(emptyMap, stack); break;
+            case OpCode::Add: evalAdd(emptyMap, stack); break;
+            case OpCode::Multiply: evalMultiply(emptyMap, stack); break;
+            case OpCode::Divide: evalDivide(emptyMap, stack); break;
+            case OpCode::Modulus: evalModulus(emptyMap, stack); break;
+            case OpCode::UnaryMinus: evalUnaryMinus(emptyMap, stack); break;
+            default: break;
+            }
+            _foldedOpCodes.resize(_foldedOpCodes.size() - numArgs);
+            constantStack.resize(constantStack.size() - numArgs);
+            _foldedOpCodes.push_back(stack.top());
+            constantStack.push_back(true);
+        } else {
+            for (int i = 0; i < numArgs; i++) {
+                constantStack.pop_back();
+            }
+            constantStack.push_back(false);
+            _foldedOpCodes.push_back(opCode);
+        }
+    }
 }
 
 //
@@ -339,7 +421,7 @@ bool AnimExpression::parseFactor(const QString& str, QString::const_iterator& it
 
 AnimExpression::OpCode AnimExpression::evaluate(const AnimVariantMap& map) const {
     std::stack<OpCode> stack;
-    for (auto& opCode : _opCodes) {
+    for (auto& opCode : _foldedOpCodes) {
         switch (opCode.type) {
         case OpCode::Identifier:
         case OpCode::Int:
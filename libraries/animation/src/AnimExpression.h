@@ -145,9 +145,12 @@ protected:
 
     OpCode coerseToValue(const AnimVariantMap& map, const OpCode& opCode) const;
 
+    void foldConstants();
+
     QString _expression;
     mutable std::stack<Token> _tokenStack;    // TODO: remove, only needed during parsing
     std::vector<OpCode> _opCodes;
+    std::vector<OpCode> _foldedOpCodes;       // _opCodes with constant subexpressions pre-evaluated
 
 #ifndef NDEBUG
     void dumpOpCodes() const;
@@ -145,12 +145,49 @@ void AnimInverseKinematics::solveWithCyclicCoordinateDescent(const std::vector<I
         accumulator.clearAndClean();
     }
 
-    float maxError = FLT_MAX;
-    int numLoops = 0;
+    auto measureMaxError = [&]() -> float {
+        float maxError = 0.0f;
+        for (size_t i = 0; i < targets.size(); i++) {
+            if (targets[i].getType() == IKTarget::Type::RotationAndPosition || targets[i].getType() == IKTarget::Type::HmdHead ||
+                    targets[i].getType() == IKTarget::Type::HipsRelativeRotationAndPosition) {
+                float error = glm::length(absolutePoses[targets[i].getIndex()].trans() - targets[i].getTranslation());
+                if (error > maxError) {
+                    maxError = error;
+                }
+            }
+        }
+        return maxError;
+    };
+
+    // all rigs in the process share one pool of CCD iterations that refills once per
+    // simulation frame. MyAvatar's rig updates earliest in the frame so it draws from the
+    // full pool; other rigs then draw in the priority (proximity) order that
+    // AvatarManager updates them in.
+    const int GLOBAL_IK_LOOPS_PER_FRAME = 48;
+    const quint64 BUDGET_WINDOW = USECS_PER_SECOND / 60;
+    static int globalLoopsRemaining = 0;
+    static quint64 budgetWindowExpiry = 0;
+    quint64 now = usecTimestampNow();
+    if (now >= budgetWindowExpiry) {
+        globalLoopsRemaining = GLOBAL_IK_LOOPS_PER_FRAME;
+        budgetWindowExpiry = now + BUDGET_WINDOW;
+    }
+
     const int MAX_IK_LOOPS = 16;
+    // never starve a solve completely, even when the pool is exhausted
+    int maxLoops = std::min(MAX_IK_LOOPS, std::max(1, globalLoopsRemaining));
+
+    // warm start: _relativePoses still hold last frame's solution (relaxed slightly toward
+    // the underPoses), so when the targets are quiet we are often already converged and
+    // skip the loop entirely.
+    int numLoops = 0;
     const float MAX_ERROR_TOLERANCE = 0.1f; // cm
-    while (maxError > MAX_ERROR_TOLERANCE && numLoops < MAX_IK_LOOPS) {
+    const float MIN_ERROR_IMPROVEMENT = 0.001f;
+    float maxError = measureMaxError();
+    float previousError = FLT_MAX;
+    while (maxError > MAX_ERROR_TOLERANCE && numLoops < maxLoops) {
         ++numLoops;
+        --globalLoopsRemaining;
 
         // solve all targets
         int lowestMovedIndex = (int)_relativePoses.size();
@@ -178,16 +215,13 @@ void AnimInverseKinematics::solveWithCyclicCoordinateDescent(const std::vector<I
         }
 
         // compute maxError
-        maxError = 0.0f;
-        for (size_t i = 0; i < targets.size(); i++) {
-            if (targets[i].getType() == IKTarget::Type::RotationAndPosition || targets[i].getType() == IKTarget::Type::HmdHead ||
-                targets[i].getType() == IKTarget::Type::HipsRelativeRotationAndPosition) {
-                float error = glm::length(absolutePoses[targets[i].getIndex()].trans() - targets[i].getTranslation());
-                if (error > maxError) {
-                    maxError = error;
-                }
-            }
+        maxError = measureMaxError();
+
+        // early out when the solve has stalled, further iterations won't help
+        if (previousError - maxError < MIN_ERROR_IMPROVEMENT) {
+            break;
         }
+        previousError = maxError;
     }
     _maxErrorOnLastSolve = maxError;
 
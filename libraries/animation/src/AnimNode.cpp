@@ -18,6 +18,7 @@ AnimNode::Pointer AnimNode::getParent() {
 void AnimNode::addChild(Pointer child) {
     _children.push_back(child);
     child->_parent = shared_from_this();
+    invalidateSubtreeAnimVars();
 }
 
 void AnimNode::removeChild(Pointer child) {
@@ -25,6 +26,7 @@ void AnimNode::removeChild(Pointer child) {
     if (iter != _children.end()) {
         _children.erase(iter);
         child->_parent.reset();
+        invalidateSubtreeAnimVars();
     }
 }
 
@@ -37,6 +39,7 @@ void AnimNode::replaceChild(Pointer oldChild, Pointer newChild) {
             newChild->setSkeleton(_skeleton);
         }
         *iter = newChild;
+        invalidateSubtreeAnimVars();
     }
 }
 
@@ -46,6 +49,7 @@ AnimNode::Pointer AnimNode::getChild(int i) const {
 }
 
 void AnimNode::setSkeleton(AnimSkeleton::ConstPointer skeleton) {
+    _cachedEvaluation = false;
     setSkeletonInternal(skeleton);
     for (auto&& child : _children) {
         child->setSkeleton(skeleton);
@@ -53,8 +57,62 @@ void AnimNode::setSkeleton(AnimSkeleton::ConstPointer skeleton) {
 }
 
 void AnimNode::setCurrentFrame(float frame) {
+    _cachedEvaluation = false;
     setCurrentFrameInternal(frame);
     for (auto&& child : _children) {
+        child->_cachedEvaluation = false;
         child->setCurrentFrameInternal(frame);
     }
 }
+
+const AnimPoseVec& AnimNode::evaluateWithCache(const AnimVariantMap& animVars, float dt, Triggers& triggersOut) {
+    if (isSubtreeTimeVarying()) {
+        _cachedEvaluation = false;
+        return evaluate(animVars, dt, triggersOut);
+    }
+    quint64 inputHash = animVars.hashOfKeys(getSubtreeAnimVars());
+    if (_cachedEvaluation && inputHash == _lastInputHash) {
+        return getPosesInternal();
+    }
+    const AnimPoseVec& poses = evaluate(animVars, dt, triggersOut);
+    _lastInputHash = inputHash;
+    _cachedEvaluation = true;
+    return poses;
+}
+
+bool AnimNode::isSubtreeTimeVarying() const {
+    if (isTimeVarying()) {
+        return true;
+    }
+    for (auto&& child : _children) {
+        if (child->isSubtreeTimeVarying()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::vector<QString>& AnimNode::getSubtreeAnimVars() {
+    if (!_subtreeAnimVarsValid) {
+        _subtreeAnimVars.clear();
+        gatherSubtreeAnimVars(_subtreeAnimVars);
+        _subtreeAnimVarsValid = true;
+    }
+    return _subtreeAnimVars;
+}
+
+void AnimNode::gatherSubtreeAnimVars(std::vector<QString>& animVarsOut) const {
+    gatherAnimVars(animVarsOut);
+    for (auto&& child : _children) {
+        child->gatherSubtreeAnimVars(animVarsOut);
+    }
+}
+
+void AnimNode::invalidateSubtreeAnimVars() {
+    _subtreeAnimVarsValid = false;
+    _cachedEvaluation = false;
+    auto parent = _parent.lock();
+    if (parent) {
+        parent->invalidateSubtreeAnimVars();
+    }
+}
@@ -77,6 +77,12 @@ public:
         return evaluate(animVars, dt, triggersOut);
     }
 
+    // evaluate via the memoization cache: when none of the anim vars read by this subtree
+    // have changed since the last evaluation and no node in the subtree is animating on its
+    // own timeline, the poses from the previous evaluation are returned without
+    // re-evaluating the subtree.
+    const AnimPoseVec& evaluateWithCache(const AnimVariantMap& animVars, float dt, Triggers& triggersOut);
+
     void setCurrentFrame(float frame);
 
     template <typename F>
@@ -111,12 +117,38 @@ protected:
     // for AnimDebugDraw rendering
     virtual const AnimPoseVec& getPosesInternal() const = 0;
 
+    // memoization support.
+    // append the names of the anim vars read by this node (not its children), used for input hashing.
+    virtual void gatherAnimVars(std::vector<QString>& animVarsOut) const {}
+
+    // nodes whose output changes from frame to frame even when their anim vars are held
+    // constant (playing clips, interpolating state machines, IK solvers) are time varying
+    // and can never be returned from the cache.
+    virtual bool isTimeVarying() const { return true; }
+    virtual bool isSubtreeTimeVarying() const;
+
+    static void appendAnimVar(std::vector<QString>& animVarsOut, const QString& varName) {
+        if (!varName.isEmpty()) {
+            animVarsOut.push_back(varName);
+        }
+    }
+
+    const std::vector<QString>& getSubtreeAnimVars();
+    void gatherSubtreeAnimVars(std::vector<QString>& animVarsOut) const;
+    void invalidateSubtreeAnimVars();
+
     Type _type;
     QString _id;
     std::vector<AnimNode::Pointer> _children;
     AnimSkeleton::ConstPointer _skeleton;
     std::weak_ptr<AnimNode> _parent;
 
+    // memoization state
+    std::vector<QString> _subtreeAnimVars;
+    bool _subtreeAnimVarsValid { false };
+    quint64 _lastInputHash { 0 };
+    bool _cachedEvaluation { false };
+
     // no copies
     AnimNode(const AnimNode&) = delete;
     AnimNode& operator=(const AnimNode&) = delete;
@@ -51,6 +51,12 @@ public:
  protected:
     void buildBoneSet(BoneSet boneSet);
 
+    virtual void gatherAnimVars(std::vector<QString>& animVarsOut) const override {
+        appendAnimVar(animVarsOut, _boneSetVar);
+        appendAnimVar(animVarsOut, _alphaVar);
+    }
+    virtual bool isTimeVarying() const override { return false; }
+
     // for AnimDebugDraw rendering
     virtual const AnimPoseVec& getPosesInternal() const override;
     virtual void setSkeletonInternal(AnimSkeleton::ConstPointer skeleton) override;
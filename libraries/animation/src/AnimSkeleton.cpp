@@ -206,6 +206,27 @@ void AnimSkeleton::buildSkeletonFromJoints(const std::vector<FBXJoint>& joints)
         _jointIndicesByName[_joints[i].name] = i;
     }
 
+    // hash everything animation retargeting reads from this skeleton, so clips can share
+    // decoded frames between skeletons with identical content (see AnimClip).
+    auto hashPose = [](uint64_t hash, const AnimPose& pose) -> uint64_t {
+        const quint32* words = reinterpret_cast<const quint32*>(&pose);
+        const int NUM_POSE_WORDS = (int)(sizeof(AnimPose) / sizeof(quint32));
+        for (int i = 0; i < NUM_POSE_WORDS; i++) {
+            hash = hash * 31 + words[i];
+        }
+        return hash;
+    };
+    uint64_t contentKey = (uint64_t)_jointsSize;
+    for (int i = 0; i < _jointsSize; i++) {
+        contentKey = contentKey * 31 + qHash(_joints[i].name);
+        contentKey = contentKey * 31 + (uint64_t)(int64_t)getParentIndex(i);
+        contentKey = hashPose(contentKey, _relativeDefaultPoses[i]);
+        contentKey = hashPose(contentKey, _relativeBindPoses[i]);
+        contentKey = hashPose(contentKey, _relativePreRotationPoses[i]);
+        contentKey = hashPose(contentKey, _relativePostRotationPoses[i]);
+    }
+    _contentKey = contentKey;
+
     // build mirror map.
     _nonMirroredIndices.clear();
     _mirrorMap.reserve(_jointsSize);
@@ -50,6 +50,10 @@ public:
 
     int getParentIndex(int jointIndex) const;
 
+    // hash of the joint names, hierarchy and poses that animation retargeting depends on.
+    // two skeletons with the same key can share decoded animation frames.
+    uint64_t getContentKey() const { return _contentKey; }
+
     AnimPose getAbsolutePose(int jointIndex, const AnimPoseVec& poses) const;
 
     void convertRelativePosesToAbsolute(AnimPoseVec& poses) const;
@@ -81,6 +85,7 @@ protected:
     std::vector<int> _nonMirroredIndices;
     std::vector<int> _mirrorMap;
     QHash<QString, int> _jointIndicesByName;
+    uint64_t _contentKey { 0 };
 
     // no copies
     AnimSkeleton(const AnimSkeleton&) = delete;
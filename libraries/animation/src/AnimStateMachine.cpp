@@ -62,7 +62,7 @@ const AnimPoseVec& AnimStateMachine::evaluate(const AnimVariantMap& animVars, fl
             } else if (_interpType == InterpType::SnapshotPrev) {
                 // interp between the prev snapshot and evaluated next target.
                 // this is useful for interping into a blend
-                localNextPoses = currentStateNode->evaluate(animVars, dt, triggersOut);
+                localNextPoses = currentStateNode->evaluateWithCache(animVars, dt, triggersOut);
                 prevPoses = &_prevPoses;
                 nextPoses = &localNextPoses;
             } else {
@@ -79,7 +79,7 @@ const AnimPoseVec& AnimStateMachine::evaluate(const AnimVariantMap& animVars, fl
         }
     }
     if (!_duringInterp) {
-        _poses = currentStateNode->evaluate(animVars, dt, triggersOut);
+        _poses = currentStateNode->evaluateWithCache(animVars, dt, triggersOut);
     }
     return _poses;
 }
@@ -90,6 +90,32 @@ void AnimStateMachine::setCurrentState(State::Pointer state) {
 
 void AnimStateMachine::addState(State::Pointer state) {
     _states.push_back(state);
+    invalidateSubtreeAnimVars();
+}
+
+void AnimStateMachine::gatherAnimVars(std::vector<QString>& animVarsOut) const {
+    appendAnimVar(animVarsOut, _currentStateVar);
+    // conservatively include the vars of every state, not just the current one,
+    // so the cached var list does not depend on the current state.
+    for (auto& state : _states) {
+        appendAnimVar(animVarsOut, state->_interpTargetVar);
+        appendAnimVar(animVarsOut, state->_interpDurationVar);
+        appendAnimVar(animVarsOut, state->_interpTypeVar);
+        for (auto& transition : state->_transitions) {
+            appendAnimVar(animVarsOut, transition._var);
+        }
+    }
+}
+
+bool AnimStateMachine::isSubtreeTimeVarying() const {
+    // only the current state's subtree is evaluated, idle states parked on
+    // playing clips do not make this node time varying.
+    if (_duringInterp || !_currentState) {
+        return true;
+    }
+    auto currentStateNode = _children[_currentState->getChildIndex()];
+    assert(currentStateNode);
+    return currentStateNode->isSubtreeTimeVarying();
 }
 
 void AnimStateMachine::switchState(const AnimVariantMap& animVars, State::Pointer desiredState) {
@@ -114,7 +140,7 @@ void AnimStateMachine::switchState(const AnimVariantMap& animVars, State::Pointe
         _prevPoses = _poses;
         // snapshot next pose at the target frame.
         nextStateNode->setCurrentFrame(desiredState->_interpTarget);
-        _nextPoses = nextStateNode->evaluate(animVars, dt, triggers);
+        _nextPoses = nextStateNode->evaluateWithCache(animVars, dt, triggers);
     } else if (_interpType == InterpType::SnapshotPrev) {
         // snapshot previoius pose
         _prevPoses = _poses;
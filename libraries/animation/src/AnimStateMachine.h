@@ -126,6 +126,10 @@ protected:
     void switchState(const AnimVariantMap& animVars, State::Pointer desiredState);
     State::Pointer evaluateTransitions(const AnimVariantMap& animVars) const;
 
+    virtual void gatherAnimVars(std::vector<QString>& animVarsOut) const override;
+    virtual bool isTimeVarying() const override { return _duringInterp; }
+    virtual bool isSubtreeTimeVarying() const override;
+
     // for AnimDebugDraw rendering
     virtual const AnimPoseVec& getPosesInternal() const override;
 
@@ -11,8 +11,60 @@
 #include "AnimUtil.h"
 #include "GLMHelpers.h"
 
-// TODO: use restrict keyword
-// TODO: excellent candidate for simd vectorization.
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+static_assert(sizeof(AnimPose) == 10 * sizeof(float), "AnimPose is expected to be 10 tightly packed floats");
+
+// four lane dot product, result splatted into all lanes
+static inline __m128 mm_dot4_ps(__m128 x, __m128 y) {
+    __m128 mul = _mm_mul_ps(x, y);
+    __m128 tmp = _mm_add_ps(mul, _mm_shuffle_ps(mul, mul, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(tmp, _mm_shuffle_ps(tmp, tmp, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    const __m128 alphaVec = _mm_set1_ps(alpha);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    for (size_t i = 0; i < numPoses; i++) {
+        // each AnimPose is 10 tightly packed floats: scale.xyz, rot.xyzw, trans.xyz
+        const float* aPose = reinterpret_cast<const float*>(a + i);
+        const float* bPose = reinterpret_cast<const float*>(b + i);
+        float* outPose = reinterpret_cast<float*>(result + i);
+
+        __m128 qa = _mm_loadu_ps(aPose + 3);
+        __m128 qb = _mm_loadu_ps(bPose + 3);
+        __m128 headA = _mm_loadu_ps(aPose);      // scale.xyz, rot.x
+        __m128 headB = _mm_loadu_ps(bPose);
+        __m128 tailA = _mm_loadu_ps(aPose + 6);  // rot.w, trans.xyz
+        __m128 tailB = _mm_loadu_ps(bPose + 6);
+
+        // adjust signs if necessary
+        __m128 flip = _mm_and_ps(_mm_cmplt_ps(mm_dot4_ps(qa, qb), _mm_setzero_ps()), signMask);
+        qb = _mm_xor_ps(qb, flip);
+
+        // nlerp the rotations, normalizing with rsqrt plus one Newton-Raphson step,
+        // accurate to ~22 bits which is plenty for a unit quat.
+        __m128 q = _mm_add_ps(qa, _mm_mul_ps(alphaVec, _mm_sub_ps(qb, qa)));
+        __m128 lengthSquared = mm_dot4_ps(q, q);
+        __m128 invLength = _mm_rsqrt_ps(lengthSquared);
+        invLength = _mm_mul_ps(invLength, _mm_sub_ps(threeHalves,
+            _mm_mul_ps(_mm_mul_ps(half, lengthSquared), _mm_mul_ps(invLength, invLength))));
+        q = _mm_mul_ps(q, invLength);
+
+        // lerp the scales and translations, then overwrite the rotation lanes with the
+        // normalized quat. the three overlapping stores all stay within this pose, so
+        // this is safe even when result aliases a or b.
+        _mm_storeu_ps(outPose, _mm_add_ps(headA, _mm_mul_ps(alphaVec, _mm_sub_ps(headB, headA))));
+        _mm_storeu_ps(outPose + 6, _mm_add_ps(tailA, _mm_mul_ps(alphaVec, _mm_sub_ps(tailB, tailA))));
+        _mm_storeu_ps(outPose + 3, q);
+    }
+}
+
+#else
 
 void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
@@ -33,6 +85,8 @@ void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, A
     }
 }
 
+#endif
+
 float accumulateTime(float startFrame, float endFrame, float timeScale, float currentFrame, float dt, bool loopFlag,
                      const QString& id, AnimNode::Triggers& triggersOut) {
 
@@ -17,6 +17,7 @@
 #include <glm/gtx/quaternion.hpp>
 #include <map>
 #include <set>
+#include <vector>
 #include <QScriptValue>
 #include <StreamUtils.h>
 #include <GLMHelpers.h>
@@ -104,6 +105,35 @@ public:
         return _stringVal;
     }
 
+    // cheap value hash, used by AnimNode memoization to detect unchanged inputs.
+    quint64 hash() const {
+        quint64 hash = (quint64)_type;
+        switch (_type) {
+        case Type::Bool:
+            hash = hash * 31 + (_val.boolVal ? 1 : 0);
+            break;
+        case Type::Int:
+            hash = hash * 31 + (quint64)(quint32)_val.intVal;
+            break;
+        case Type::Float:
+        case Type::Vec3:
+        case Type::Quat: {
+            int numFloats = (_type == Type::Float) ? 1 : ((_type == Type::Vec3) ? 3 : 4);
+            for (int i = 0; i < numFloats; i++) {
+                // hash the bit patterns, exact equality is all we need here.
+                hash = hash * 31 + reinterpret_cast<const quint32&>(_val.floats[i]);
+            }
+            break;
+        }
+        case Type::String:
+            hash = hash * 31 + qHash(_stringVal);
+            break;
+        default:
+            break;
+        }
+        return hash;
+    }
+
 protected:
     Type _type;
     QString _stringVal;
@@ -211,6 +241,22 @@ public:
     void clearMap() { _map.clear(); }
     bool hasKey(const QString& key) const { return _map.find(key) != _map.end(); }
 
+    // combine the current values (and trigger state) of the given keys into a single hash,
+    // used by AnimNode::evaluateWithCache to detect unchanged inputs.
+    quint64 hashOfKeys(const std::vector<QString>& keys) const {
+        quint64 hash = 0;
+        for (auto& key : keys) {
+            hash = hash * 31 + (_triggers.find(key) != _triggers.end() ? 1 : 0);
+            auto iter = _map.find(key);
+            if (iter != _map.end()) {
+                hash = hash * 31 + 1 + iter->second.hash();
+            } else {
+                hash = hash * 31;
+            }
+        }
+        return hash;
+    }
+
     const AnimVariant& get(const QString& key) const {
         auto iter = _map.find(key);
         if (iter != _map.end()) {
@@ -160,7 +160,6 @@ AudioClient::AudioClient() :
     _loopbackAudioOutput(NULL),
     _loopbackOutputDevice(NULL),
     _inputRingBuffer(0),
-    _localInjectorsStream(0),
     _receivedAudioStream(RECEIVED_AUDIO_STREAM_CAPACITY_FRAMES),
     _isStereoInput(false),
     _outputStarveDetectionStartTimeMsec(0),
@@ -188,7 +187,7 @@ AudioClient::AudioClient() :
     _positionGetter(DEFAULT_POSITION_GETTER),
     _orientationGetter(DEFAULT_ORIENTATION_GETTER) {
     // avoid putting a lock in the device callback
-    assert(_localSamplesAvailable.is_lock_free());
+    assert(_localInjectorsStream.isLockFree());
 
     // deprecate legacy settings
     {
@@ -813,7 +812,13 @@ void AudioClient::configureReverb() {
     p.wetDryMix = _reverbOptions->getWetDryMix();
 
     _listenerReverb.setParameters(&p);
+
+    // the local reverb is the return of a send/return bus shared by all local injectors -
+    // it renders fully wet and the per-injector send gains carry the wet level instead
+    _localReverbSendLevel = p.wetDryMix * (1/100.0f);
+    p.wetDryMix = 100.0f;
     _localReverb.setParameters(&p);
+    p.wetDryMix = _reverbOptions->getWetDryMix();
 
     // used only for adding self-reverb to loopback audio
     p.sampleRate = _outputFormat.sampleRate();
@@ -1002,6 +1007,9 @@ void AudioClient::handleAudioInput() {
 
     while (_inputRingBuffer.samplesAvailable() >= inputSamplesRequired) {
 
+        float resampleUsecs = 0.0f;
+        float gateUsecs = 0.0f;
+
         if (!_muted) {
 
 
@@ -1010,22 +1018,21 @@ void AudioClient::handleAudioInput() {
                 _timeSinceLastClip += (float)numNetworkSamples / (float)AudioConstants::SAMPLE_RATE;
             }
 
+            quint64 resampleStart = usecTimestampNow();
             _inputRingBuffer.readSamples(inputAudioSamples.get(), inputSamplesRequired);
             possibleResampling(_inputToNetworkResampler,
                 inputAudioSamples.get(), networkAudioSamples,
                 inputSamplesRequired, numNetworkSamples,
                 _inputFormat.channelCount(), _desiredInputFormat.channelCount());
+            quint64 gateStart = usecTimestampNow();
+            resampleUsecs = (float)(gateStart - resampleStart);
 
-            //  Remove DC offset
+            // the noise gate is only imposed if we are sending mono audio
             if (!_isStereoInput) {
-                _inputGate.removeDCOffset(networkAudioSamples, numNetworkSamples);
-            }
-
-            // only impose the noise gate and perform tone injection if we are sending mono audio
-            if (!_isStereoInput && _isNoiseGateEnabled) {
-                _inputGate.gateSamples(networkAudioSamples, numNetworkSamples);
+                // fused single pass: DC-offset removal, loudness and clipping measurement, and
+                // (when enabled) the gate envelope are applied in one trip over the block
+                _inputGate.processBlock(networkAudioSamples, numNetworkSamples, _isNoiseGateEnabled);
 
-                // if we performed the noise gate we can get values from it instead of enumerating the samples again
                 _lastInputLoudness = _inputGate.getLastLoudness();
 
                 if (_inputGate.clippedInLastBlock()) {
@@ -1046,6 +1053,7 @@ void AudioClient::handleAudioInput() {
 
                 _lastInputLoudness = fabs(loudness / numNetworkSamples);
             }
+            gateUsecs = (float)(usecTimestampNow() - gateStart);
 
             emit inputReceived({ reinterpret_cast<char*>(networkAudioSamples), numNetworkBytes });
 
@@ -1085,11 +1093,13 @@ void AudioClient::handleAudioInput() {
 
         QByteArray decodedBuffer(reinterpret_cast<char*>(networkAudioSamples), numNetworkBytes);
         QByteArray encodedBuffer;
+        quint64 encodeStart = usecTimestampNow();
         if (_encoder) {
             _encoder->encode(decodedBuffer, encodedBuffer);
         } else {
             encodedBuffer = decodedBuffer;
         }
+        _stats.updateInputStageTimings(resampleUsecs, gateUsecs, (float)(usecTimestampNow() - encodeStart));
 
         emitAudioPacket(encodedBuffer.constData(), encodedBuffer.size(), _outgoingAvatarAudioSequenceNumber,
             audioTransform, avatarBoundingBoxCorner, avatarBoundingBoxScale,
@@ -1140,11 +1150,11 @@ void AudioClient::prepareLocalAudioInjectors() {
 
     int samplesNeeded = std::numeric_limits<int>::max();
     while (samplesNeeded > 0) {
-        // lock for every write to avoid locking out the device callback
-        // this lock is intentional - the buffer is only lock-free in its use in the device callback
+        // lock for every write so a device switch can't delete the resampler and mix
+        // buffers out from under us - the device callback itself never takes this lock
         RecursiveLock lock(_localAudioMutex);
 
-        samplesNeeded = bufferCapacity - _localSamplesAvailable.load(std::memory_order_relaxed);
+        samplesNeeded = bufferCapacity - _localInjectorsStream.samplesAvailable();
         if (samplesNeeded <= 0) {
             break;
         }
@@ -1154,9 +1164,13 @@ void AudioClient::prepareLocalAudioInjectors() {
             break;
         }
 
-        // reverb
+        // reverb: the injectors mixed their sends into the shared wet bus, so one reverb
+        // render covers every source in the zone; the return sums back into the mix
         if (_reverb) {
-            _localReverb.render(_localMixBuffer, _localMixBuffer, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            _localReverb.render(_localReverbSendBuffer, _localReverbSendBuffer, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; i++) {
+                _localMixBuffer[i] += _localReverbSendBuffer[i];
+            }
         }
 
         int samples;
@@ -1166,17 +1180,14 @@ void AudioClient::prepareLocalAudioInjectors() {
                 AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
             // write to local injectors' ring buffer
-            samples = frames * AudioConstants::STEREO;
-            _localInjectorsStream.writeSamples(_localOutputMixBuffer, samples);
+            samples = _localInjectorsStream.writeSamples(_localOutputMixBuffer, frames * AudioConstants::STEREO);
 
         } else {
             // write to local injectors' ring buffer
-            samples = AudioConstants::NETWORK_FRAME_SAMPLES_STEREO;
-            _localInjectorsStream.writeSamples(_localMixBuffer,
+            samples = _localInjectorsStream.writeSamples(_localMixBuffer,
                 AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
         }
 
-        _localSamplesAvailable.fetch_add(samples, std::memory_order_release);
         samplesNeeded -= samples;
     }
 }
@@ -1193,6 +1204,9 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
     }
 
     memset(mixBuffer, 0, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO * sizeof(float));
+    if (_reverb) {
+        memset(_localReverbSendBuffer, 0, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO * sizeof(float));
+    }
 
     for (AudioInjector* injector : _activeLocalAudioInjectors) {
         if (injector->getLocalBuffer()) {
@@ -1227,14 +1241,29 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
                     injector->getLocalFOA().render(_localScratchBuffer, mixBuffer, HRTF_DATASET_INDEX,
                                                    qw, qx, qy, qz, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
+                    if (_reverb) {
+                        // the omni (W) channel feeds the shared reverb bus
+                        float sendGain = gain * _localReverbSendLevel;
+                        for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+                            float sample = convertToFloat(_localScratchBuffer[i * AudioConstants::AMBISONIC]) * sendGain;
+                            _localReverbSendBuffer[2*i+0] += sample;
+                            _localReverbSendBuffer[2*i+1] += sample;
+                        }
+                    }
+
                 } else if (injector->isStereo()) {
 
                     // stereo gets directly mixed into mixBuffer
                     float gain = injector->getVolume();
+                    // branch-free send into the wet bus - a zero send gain when reverb is off
+                    // keeps the mix loop vectorizable
+                    float sendLevel = _reverb ? _localReverbSendLevel : 0.0f;
                     for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; i++) {
-                        mixBuffer[i] += convertToFloat(_localScratchBuffer[i]) * gain;
+                        float sample = convertToFloat(_localScratchBuffer[i]) * gain;
+                        mixBuffer[i] += sample;
+                        _localReverbSendBuffer[i] += sample * sendLevel;
                     }
-                    
+
                 } else {
 
                     // calculate distance, gain and azimuth for hrtf
@@ -1244,8 +1273,19 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
                     float azimuth = azimuthForSource(relativePosition);
                 
                     // mono gets spatialized into mixBuffer
-                    injector->getLocalHRTF().render(_localScratchBuffer, mixBuffer, HRTF_DATASET_INDEX, 
+                    injector->getLocalHRTF().render(_localScratchBuffer, mixBuffer, HRTF_DATASET_INDEX,
                                                     azimuth, distance, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+                    if (_reverb) {
+                        // the reverb return is diffuse, so the send skips the HRTF and feeds
+                        // the shared wet bus directly
+                        float sendGain = gain * _localReverbSendLevel;
+                        for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+                            float sample = convertToFloat(_localScratchBuffer[i]) * sendGain;
+                            _localReverbSendBuffer[2*i+0] += sample;
+                            _localReverbSendBuffer[2*i+1] += sample;
+                        }
+                    }
                 }
             
             } else {
@@ -1480,12 +1520,14 @@ bool AudioClient::switchOutputToAudioDevice(const QAudioDeviceInfo& outputDevice
     bool supportedFormat = false;
 
     RecursiveLock lock(_localAudioMutex);
-    _localSamplesAvailable.exchange(0, std::memory_order_release);
 
     // cleanup any previously initialized device
     if (_audioOutput) {
         _audioOutput->stop();
 
+        // the callback is stopped, so draining the pipe from this thread is safe
+        _localInjectorsStream.clear();
+
         delete _audioOutput;
         _audioOutput = NULL;
 
@@ -1561,7 +1603,10 @@ bool AudioClient::switchOutputToAudioDevice(const QAudioDeviceInfo& outputDevice
             _outputMixBuffer = new float[_outputPeriod];
             _outputScratchBuffer = new int16_t[_outputPeriod];
             _localOutputMixBuffer = new float[_outputPeriod];
-            _localInjectorsStream.resizeForFrameSize(_outputPeriod * 2);
+            // size the injector ring for worst-case callback jitter - ten frames of
+            // twice the output period, matching the previous ring buffer's capacity
+            const int LOCAL_INJECTORS_RING_FRAMES = 10;
+            _localInjectorsStream.resize(_outputPeriod * 2 * LOCAL_INJECTORS_RING_FRAMES);
 
             qCDebug(audioclient) << "Output Buffer capacity in frames: " << _audioOutput->bufferSize() / AudioConstants::SAMPLE_SIZE / (float)deviceFrameSize <<
                 "requested bytes:" << requestedSize << "actual bytes:" << _audioOutput->bufferSize() <<
@@ -1693,11 +1738,16 @@ qint64 AudioClient::AudioOutputIODevice::readData(char * data, qint64 maxSize) {
 
     int injectorSamplesPopped = 0;
     {
-        RecursiveLock lock(_audio->_localAudioMutex);
+        // the injector stream is a wait-free SPSC ring - no lock is taken here, so a
+        // slow injector mix can no longer stall this device callback into an underrun
         bool append = networkSamplesPopped > 0;
-        samplesRequested = std::min(samplesRequested, _audio->_localSamplesAvailable.load(std::memory_order_acquire));
+        int injectorSamplesAvailable = _localInjectorsStream.samplesAvailable();
+        if (injectorSamplesAvailable > 0 && injectorSamplesAvailable < samplesRequested) {
+            // a partially filled ring means the injector thread is behind the device clock
+            _localInjectorsStream.noteUnderrun();
+        }
+        samplesRequested = std::min(samplesRequested, injectorSamplesAvailable);
         if ((injectorSamplesPopped = _localInjectorsStream.appendSamples(mixBuffer, samplesRequested, append)) > 0) {
-            _audio->_localSamplesAvailable.fetch_sub(injectorSamplesPopped, std::memory_order_release);
             qCDebug(audiostream, "Read %d samples from injectors (%d available, %d requested)", injectorSamplesPopped, _localInjectorsStream.samplesAvailable(), samplesRequested);
         }
     }
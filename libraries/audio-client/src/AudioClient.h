@@ -46,6 +46,7 @@
 #include <AudioLimiter.h>
 #include <AudioConstants.h>
 #include <AudioNoiseGate.h>
+#include <AudioSPSCRing.h>
 
 #include <shared/RateCounter.h>
 
@@ -88,7 +89,7 @@ class AudioClient : public AbstractAudioInterface, public Dependency {
     Q_OBJECT
     SINGLETON_DEPENDENCY
 
-    using LocalInjectorsStream = AudioMixRingBuffer;
+    using LocalInjectorsStream = AudioSPSCRing;
 public:
     static const int MIN_BUFFER_FRAMES;
     static const int MAX_BUFFER_FRAMES;
@@ -129,6 +130,8 @@ public:
     Q_INVOKABLE float getMicAudioOutboundPPS() const { return _micAudioOutbound.rate(); }
     Q_INVOKABLE float getSilentInboundPPS() const { return _silentInbound.rate(); }
     Q_INVOKABLE float getAudioInboundPPS() const { return _audioInbound.rate(); }
+    Q_INVOKABLE int getLocalInjectorsOverrunCount() const { return (int)_localInjectorsStream.getOverrunCount(); }
+    Q_INVOKABLE int getLocalInjectorsUnderrunCount() const { return (int)_localInjectorsStream.getUnderrunCount(); }
 
     const MixedProcessedAudioStream& getReceivedAudioStream() const { return _receivedAudioStream; }
     MixedProcessedAudioStream& getReceivedAudioStream() { return _receivedAudioStream; }
@@ -294,10 +297,9 @@ private:
     QAudioOutput* _loopbackAudioOutput;
     QIODevice* _loopbackOutputDevice;
     AudioRingBuffer _inputRingBuffer;
+    // a wait-free SPSC pipe - written by the injector mixing thread, drained by the
+    // output device callback without taking any lock
     LocalInjectorsStream _localInjectorsStream;
-    // In order to use _localInjectorsStream as a lock-free pipe,
-    // use it with a single producer/consumer, and track available samples
-    std::atomic<int> _localSamplesAvailable { 0 };
     MixedProcessedAudioStream _receivedAudioStream;
     bool _isStereoInput;
 
@@ -329,6 +331,9 @@ private:
     AudioReverb _sourceReverb { AudioConstants::SAMPLE_RATE };
     AudioReverb _listenerReverb { AudioConstants::SAMPLE_RATE };
     AudioReverb _localReverb { AudioConstants::SAMPLE_RATE };
+    // wet level carried by the per-injector sends into the shared reverb bus,
+    // since _localReverb itself renders fully wet
+    float _localReverbSendLevel { 0.0f };
 
     // possible streams needed for resample
     AudioSRC* _inputToNetworkResampler;
@@ -340,6 +345,7 @@ private:
 
     // for local audio (used by audio injectors thread)
     float _localMixBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    float _localReverbSendBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _localScratchBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC];
     float* _localOutputMixBuffer { NULL };
     AudioInjectorsThread _localAudioThread;
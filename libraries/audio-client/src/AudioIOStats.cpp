@@ -25,12 +25,19 @@ static const int OUTPUT_UNPLAYED_WINDOW = 5;
 
 static const int APPROXIMATELY_30_SECONDS_OF_AUDIO_PACKETS = (int)(30.0f * 1000.0f / AudioConstants::NETWORK_FRAME_MSECS);
 
+// stage timings update once per mic block, so an interval is about a second of blocks
+static const int INPUT_STAGE_BLOCKS_PER_INTERVAL = (int)(1000.0f / AudioConstants::NETWORK_FRAME_MSECS);
+static const int INPUT_STAGE_WINDOW = 5;
+
 
 AudioIOStats::AudioIOStats(MixedProcessedAudioStream* receivedAudioStream) :
     _interface(new AudioStatsInterface(this)),
     _inputMsRead(1, INPUT_READS_WINDOW),
     _inputMsUnplayed(1, INPUT_UNPLAYED_WINDOW),
     _outputMsUnplayed(1, OUTPUT_UNPLAYED_WINDOW),
+    _inputResampleUsecs(INPUT_STAGE_BLOCKS_PER_INTERVAL, INPUT_STAGE_WINDOW),
+    _inputGateUsecs(INPUT_STAGE_BLOCKS_PER_INTERVAL, INPUT_STAGE_WINDOW),
+    _inputEncodeUsecs(INPUT_STAGE_BLOCKS_PER_INTERVAL, INPUT_STAGE_WINDOW),
     _lastSentPacketTime(0),
     _packetTimegaps(1, APPROXIMATELY_30_SECONDS_OF_AUDIO_PACKETS),
     _receivedAudioStream(receivedAudioStream)
@@ -44,9 +51,13 @@ void AudioIOStats::reset() {
     _inputMsRead.reset();
     _inputMsUnplayed.reset();
     _outputMsUnplayed.reset();
+    _inputResampleUsecs.reset();
+    _inputGateUsecs.reset();
+    _inputEncodeUsecs.reset();
     _packetTimegaps.reset();
 
     _interface->updateLocalBuffers(_inputMsRead, _inputMsUnplayed, _outputMsUnplayed, _packetTimegaps);
+    _interface->updateInputStages(_inputResampleUsecs, _inputGateUsecs, _inputEncodeUsecs);
     _interface->updateMixerStream(AudioStreamStats());
     _interface->updateClientStream(AudioStreamStats());
     _interface->updateInjectorStreams(QHash<QUuid, AudioStreamStats>());
@@ -112,6 +123,7 @@ void AudioIOStats::publish() {
 
     // update the interface
     _interface->updateLocalBuffers(_inputMsRead, _inputMsUnplayed, _outputMsUnplayed, _packetTimegaps);
+    _interface->updateInputStages(_inputResampleUsecs, _inputGateUsecs, _inputEncodeUsecs);
     _interface->updateClientStream(stats);
 
     // prepare a packet to the mixer
@@ -182,6 +194,14 @@ void AudioStatsInterface::updateLocalBuffers(const MovingMinMaxAvg<float>& input
     sentTimegapMsAvgWindow(timegaps.getWindowAverage() / USECS_PER_MSEC);
 }
 
+void AudioStatsInterface::updateInputStages(const MovingMinMaxAvg<float>& resampleUsecs,
+    const MovingMinMaxAvg<float>& gateUsecs,
+    const MovingMinMaxAvg<float>& encodeUsecs) {
+    inputResampleUsAvgWindow(resampleUsecs.getWindowAverage());
+    inputGateUsAvgWindow(gateUsecs.getWindowAverage());
+    inputEncodeUsAvgWindow(encodeUsecs.getWindowAverage());
+}
+
 void AudioStatsInterface::updateInjectorStreams(const QHash<QUuid, AudioStreamStats>& stats) {
     // Get existing injectors
     auto injectorIds = _injectors->dynamicPropertyNames();
@@ -74,6 +74,11 @@ class AudioStatsInterface : public QObject {
     AUDIO_PROPERTY(float, inputUnplayedMsMax);
     AUDIO_PROPERTY(float, outputUnplayedMsMax);
 
+    // per-stage cost of the microphone input pipeline, in usecs per block
+    AUDIO_PROPERTY(float, inputResampleUsAvgWindow);
+    AUDIO_PROPERTY(float, inputGateUsAvgWindow);
+    AUDIO_PROPERTY(float, inputEncodeUsAvgWindow);
+
     AUDIO_PROPERTY(quint64, sentTimegapMsMax);
     AUDIO_PROPERTY(quint64, sentTimegapMsAvg);
     AUDIO_PROPERTY(quint64, sentTimegapMsMaxWindow);
@@ -92,6 +97,9 @@ public:
                             const MovingMinMaxAvg<float>& inputMsUnplayed,
                             const MovingMinMaxAvg<float>& outputMsUnplayed,
                             const MovingMinMaxAvg<quint64>& timegaps);
+    void updateInputStages(const MovingMinMaxAvg<float>& resampleUsecs,
+                           const MovingMinMaxAvg<float>& gateUsecs,
+                           const MovingMinMaxAvg<float>& encodeUsecs);
     void updateMixerStream(const AudioStreamStats& stats) { _mixer->updateStream(stats); emit mixerStreamChanged(); }
     void updateClientStream(const AudioStreamStats& stats) { _client->updateStream(stats); emit clientStreamChanged(); }
     void updateInjectorStreams(const QHash<QUuid, AudioStreamStats>& stats);
@@ -121,6 +129,11 @@ public:
     void updateInputMsRead(float ms) const { _inputMsRead.update(ms); }
     void updateInputMsUnplayed(float ms) const { _inputMsUnplayed.update(ms); }
     void updateOutputMsUnplayed(float ms) const { _outputMsUnplayed.update(ms); }
+    void updateInputStageTimings(float resampleUsecs, float gateUsecs, float encodeUsecs) const {
+        _inputResampleUsecs.update(resampleUsecs);
+        _inputGateUsecs.update(gateUsecs);
+        _inputEncodeUsecs.update(encodeUsecs);
+    }
     void sentPacket() const;
 
     void publish();
@@ -134,6 +147,9 @@ private:
     mutable MovingMinMaxAvg<float> _inputMsRead;
     mutable MovingMinMaxAvg<float> _inputMsUnplayed;
     mutable MovingMinMaxAvg<float> _outputMsUnplayed;
+    mutable MovingMinMaxAvg<float> _inputResampleUsecs;
+    mutable MovingMinMaxAvg<float> _inputGateUsecs;
+    mutable MovingMinMaxAvg<float> _inputEncodeUsecs;
 
     mutable quint64 _lastSentPacketTime;
     mutable MovingMinMaxAvg<quint64> _packetTimegaps;
@@ -239,10 +239,12 @@ static void FIR_1x4_SSE(float* src, float* dst0, float* dst1, float* dst2, float
 #include "CPUDetect.h"
 
 void FIR_1x4_AVX2(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames);
+void FIR_1x4_AVX512(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames);
 
 static void FIR_1x4(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames) {
 
-    static auto f = cpuSupportsAVX2() ? FIR_1x4_AVX2 : FIR_1x4_SSE;
+    static auto f = cpuSupportsAVX512() ? FIR_1x4_AVX512 :
+                    cpuSupportsAVX2() ? FIR_1x4_AVX2 : FIR_1x4_SSE;
     (*f)(src, dst0, dst1, dst2, dst3, coef, numFrames); // dispatch
 }
 
@@ -850,11 +852,22 @@ static void setFilters(float firCoef[4][HRTF_TAPS], float bqCoef[5][8], int dela
 
 void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames) {
 
+    ALIGN32 float in[HRTF_TAPS + HRTF_BLOCK];               // mono
+
+    // convert mono input to float
+    for (int i = 0; i < HRTF_BLOCK; i++) {
+        in[HRTF_TAPS+i] = (float)input[i] * (1/32768.0f);
+    }
+
+    renderConverted(in, output, index, azimuth, distance, gain, numFrames);
+}
+
+void AudioHRTF::renderConverted(float* in, float* output, int index, float azimuth, float distance, float gain, int numFrames) {
+
     assert(index >= 0);
     assert(index < HRTF_TABLES);
     assert(numFrames == HRTF_BLOCK);
 
-    ALIGN32 float in[HRTF_TAPS + HRTF_BLOCK];               // mono
     ALIGN32 float firCoef[4][HRTF_TAPS];                    // 4-channel
     ALIGN32 float firBuffer[4][HRTF_DELAY + HRTF_BLOCK];    // 4-channel
     ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
@@ -875,11 +888,6 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     _distanceState = distance;
     _gainState = gain;
 
-    // convert mono input to float
-    for (int i = 0; i < HRTF_BLOCK; i++) {
-        in[HRTF_TAPS+i] = (float)input[i] * (1/32768.0f);
-    }
-
     // FIR state update
     memcpy(in, _firState, HRTF_TAPS * sizeof(float));
     memcpy(_firState, &in[HRTF_BLOCK], HRTF_TAPS * sizeof(float));
@@ -950,3 +958,36 @@ void AudioHRTF::renderSilent(int16_t* input, float* output, int index, float azi
 
     _silentState = true;
 }
+
+void AudioHRTF::renderBatch(AudioHRTF* hrtf[], int16_t* input[], const bool silent[],
+                            const int index[], const float azimuth[], const float distance[], const float gain[],
+                            float* output, int numSources, int numFrames) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    ALIGN32 float in[HRTF_BATCH][HRTF_TAPS + HRTF_BLOCK];   // mono, per source
+
+    for (int n = 0; n < numSources; n += HRTF_BATCH) {
+
+        int numBatch = MIN(numSources - n, HRTF_BATCH);
+
+        // convert all batch inputs to float, in one pass
+        for (int j = 0; j < numBatch; j++) {
+            if (!silent[n+j]) {
+                int16_t* src = input[n+j];
+                for (int i = 0; i < HRTF_BLOCK; i++) {
+                    in[j][HRTF_TAPS+i] = (float)src[i] * (1/32768.0f);
+                }
+            }
+        }
+
+        // run the filter chain per source, accumulating into the shared mix buffer
+        for (int j = 0; j < numBatch; j++) {
+            if (silent[n+j]) {
+                hrtf[n+j]->renderSilent(input[n+j], output, index[n+j], azimuth[n+j], distance[n+j], gain[n+j], numFrames);
+            } else {
+                hrtf[n+j]->renderConverted(in[j], output, index[n+j], azimuth[n+j], distance[n+j], gain[n+j], numFrames);
+            }
+        }
+    }
+}
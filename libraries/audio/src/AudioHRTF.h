@@ -23,6 +23,8 @@ static const int HRTF_BLOCK = 240;      // block processing size
 
 static const float HRTF_GAIN = 1.0f;    // HRTF global gain adjustment
 
+static const int HRTF_BATCH = 8;        // sources staged per pass of renderBatch()
+
 class AudioHRTF {
 
 public:
@@ -44,6 +46,16 @@ public:
     //
     void renderSilent(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames);
 
+    //
+    // Batched render: convolves numSources mono sources destined for the same listener,
+    // accumulating into one interleaved stereo mix buffer. Per-source filter state lives
+    // in hrtf[], while input conversion and kernel dispatch are amortized across the
+    // batch. Sources flagged silent only flush filter state, as renderSilent().
+    //
+    static void renderBatch(AudioHRTF* hrtf[], int16_t* input[], const bool silent[],
+                            const int index[], const float azimuth[], const float distance[], const float gain[],
+                            float* output, int numSources, int numFrames);
+
     //
     // HRTF local gain adjustment in amplitude (1.0 == unity)
     //
@@ -54,6 +66,9 @@ private:
     AudioHRTF(const AudioHRTF&) = delete;
     AudioHRTF& operator=(const AudioHRTF&) = delete;
 
+    // render from input already converted to float, at &input[HRTF_TAPS]
+    void renderConverted(float* input, float* output, int index, float azimuth, float distance, float gain, int numFrames);
+
     // SIMD channel assignmentS
     enum Channel {
         L0, R0,
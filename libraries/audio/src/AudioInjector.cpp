@@ -432,7 +432,12 @@ AudioInjector* AudioInjector::playSound(SharedSoundPointer sound, const float vo
 
     QByteArray samples = sound->getByteArray();
     if (stretchFactor == 1.0f) {
-        return playSoundAndDelete(samples, options);
+        AudioInjector* injector = playSoundAndDelete(samples, options);
+        if (injector) {
+            // the samples may be a view over the sound's mapping - hold the sound
+            injector->setSound(sound);
+        }
+        return injector;
     }
 
     const int standardRate = AudioConstants::SAMPLE_RATE;
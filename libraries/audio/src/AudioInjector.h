@@ -70,6 +70,11 @@ public:
     bool isAmbisonic() const { return _options.ambisonic; }
 
     bool stateHas(AudioInjectorState state) const ;
+
+    // when injecting from a (possibly memory-mapped) Sound, the injector must hold
+    // the Sound so the sample view stays valid for the injection lifetime
+    void setSound(SharedSoundPointer sound) { _sound = sound; }
+
     static void setLocalAudioInterface(AbstractAudioInterface* audioInterface) { _localAudioInterface = audioInterface; }
     static AudioInjector* playSoundAndDelete(const QByteArray& buffer, const AudioInjectorOptions options);
     static AudioInjector* playSound(const QByteArray& buffer, const AudioInjectorOptions options);
@@ -103,6 +108,7 @@ private:
     static AbstractAudioInterface* _localAudioInterface;
 
     QByteArray _audioData;
+    SharedSoundPointer _sound; // keeps a mapped Sound alive while injecting, see setSound
     AudioInjectorOptions _options;
     AudioInjectorState _state { AudioInjectorState::NotFinished };
     bool _hasSentFirstFrame { false };
@@ -11,13 +11,35 @@
 
 #include "AudioNoiseGate.h"
 
+#include <cmath>
 #include <cstdlib>
+#include <limits>
 #include <string.h>
 
 #include "AudioConstants.h"
 
 const float AudioNoiseGate::CLIPPING_THRESHOLD = 0.90f;
 
+//  The Noise Gate is used to reject constant background noise by measuring the noise
+//  floor observed at the microphone and then opening the 'gate' to allow microphone
+//  signals to be transmitted when the microphone samples average level exceeds a multiple
+//  of the noise floor.
+//
+//  NOISE_GATE_HEIGHT:  How loud you have to speak relative to noise background to open the gate.
+//                      Make this value lower for more sensitivity and less rejection of noise.
+//  NOISE_GATE_WIDTH:   The number of samples in an audio block for which the height must be exceeded
+//                      to open the gate.
+//  NOISE_GATE_CLOSE_BLOCK_DELAY:  Once the noise is below the gate height for the block, how many blocks
+//                      will we wait before closing the gate.
+//  NOISE_GATE_BLOCKS_TO_AVERAGE:  How many audio blocks should we average together to compute noise floor.
+//                      More means better rejection but also can reject continuous things like singing.
+// NUMBER_OF_NOISE_SAMPLE_BLOCKS:  How often should we re-evaluate the noise floor?
+
+static const float NOISE_GATE_HEIGHT = 7.0f;
+static const int NOISE_GATE_WIDTH = 5;
+static const int NOISE_GATE_CLOSE_BLOCK_DELAY = 5;
+static const int NOISE_GATE_BLOCKS_TO_AVERAGE = 5;
+
 AudioNoiseGate::AudioNoiseGate() :
     _lastLoudness(0.0f),
     _didClipInLastBlock(false),
@@ -27,7 +49,54 @@ AudioNoiseGate::AudioNoiseGate() :
     _isOpen(false),
     _blocksToClose(0) {}
 
-void AudioNoiseGate::removeDCOffset(int16_t* samples, int numSamples) {
+void AudioNoiseGate::removeDCAndMeasure_ref(int16_t* samples, int numSamples, int16_t dcOffset,
+                                            int32_t gateThreshold, int32_t clipThreshold,
+                                            int32_t& dcSum, int32_t& loudnessSum, int& samplesOverGate, bool& didClip) {
+    int32_t sum = 0;
+    int32_t loudness = 0;
+    int overGate = 0;
+    bool clipped = false;
+
+    for (int i = 0; i < numSamples; i++) {
+        sum += samples[i];
+        samples[i] -= dcOffset;
+
+        int32_t thisSample = std::abs((int32_t)samples[i]);
+        loudness += thisSample;
+        clipped |= (thisSample > clipThreshold);
+        //  Noise Reduction:  Count peaks above the average loudness
+        overGate += (thisSample > gateThreshold) ? 1 : 0;
+    }
+
+    dcSum = sum;
+    loudnessSum = loudness;
+    samplesOverGate = overGate;
+    didClip = clipped;
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include "CPUDetect.h"
+
+void AudioNoiseGate::removeDCAndMeasure(int16_t* samples, int numSamples, int16_t dcOffset,
+                                        int32_t gateThreshold, int32_t clipThreshold,
+                                        int32_t& dcSum, int32_t& loudnessSum, int& samplesOverGate, bool& didClip) {
+    static auto f = cpuSupportsAVX2() ? &AudioNoiseGate::removeDCAndMeasure_AVX2 : &AudioNoiseGate::removeDCAndMeasure_ref;
+    (*f)(samples, numSamples, dcOffset, gateThreshold, clipThreshold, dcSum, loudnessSum, samplesOverGate, didClip);   // dispatch
+}
+
+#else
+
+void AudioNoiseGate::removeDCAndMeasure(int16_t* samples, int numSamples, int16_t dcOffset,
+                                        int32_t gateThreshold, int32_t clipThreshold,
+                                        int32_t& dcSum, int32_t& loudnessSum, int& samplesOverGate, bool& didClip) {
+    removeDCAndMeasure_ref(samples, numSamples, dcOffset, gateThreshold, clipThreshold,
+                           dcSum, loudnessSum, samplesOverGate, didClip);
+}
+
+#endif
+
+void AudioNoiseGate::updateDCOffset(int32_t dcSum, int numSamples) {
     //
     //  DC Offset correction
     //
@@ -36,14 +105,8 @@ void AudioNoiseGate::removeDCOffset(int16_t* samples, int numSamples) {
     //  ADC's have a noticeable DC offset.
     //
     const float DC_OFFSET_AVERAGING = 0.99f;
-    float measuredDcOffset = 0.0f;
-    //  Remove trailing DC offset from samples
-    for (int i = 0; i < numSamples; i++) {
-        measuredDcOffset += samples[i];
-        samples[i] -= (int16_t) _dcOffset;
-    }
-    // Update measured DC offset
-    measuredDcOffset /= numSamples;
+    float measuredDcOffset = (float)dcSum / numSamples;
+
     if (_dcOffset == 0.0f) {
         // On first block, copy over measured offset
         _dcOffset = measuredDcOffset;
@@ -52,52 +115,7 @@ void AudioNoiseGate::removeDCOffset(int16_t* samples, int numSamples) {
     }
 }
 
-void AudioNoiseGate::gateSamples(int16_t* samples, int numSamples) {
-    //
-    //  Impose Noise Gate
-    //
-    //  The Noise Gate is used to reject constant background noise by measuring the noise
-    //  floor observed at the microphone and then opening the 'gate' to allow microphone
-    //  signals to be transmitted when the microphone samples average level exceeds a multiple
-    //  of the noise floor.
-    //
-    //  NOISE_GATE_HEIGHT:  How loud you have to speak relative to noise background to open the gate.
-    //                      Make this value lower for more sensitivity and less rejection of noise.
-    //  NOISE_GATE_WIDTH:   The number of samples in an audio block for which the height must be exceeded
-    //                      to open the gate.
-    //  NOISE_GATE_CLOSE_BLOCK_DELAY:  Once the noise is below the gate height for the block, how many blocks
-    //                      will we wait before closing the gate.
-    //  NOISE_GATE_BLOCKS_TO_AVERAGE:  How many audio blocks should we average together to compute noise floor.
-    //                      More means better rejection but also can reject continuous things like singing.
-    // NUMBER_OF_NOISE_SAMPLE_BLOCKS:  How often should we re-evaluate the noise floor?
-
-    float loudness = 0;
-    int thisSample = 0;
-    int samplesOverNoiseGate = 0;
-
-    const float NOISE_GATE_HEIGHT = 7.0f;
-    const int NOISE_GATE_WIDTH = 5;
-    const int NOISE_GATE_CLOSE_BLOCK_DELAY = 5;
-    const int NOISE_GATE_BLOCKS_TO_AVERAGE = 5;
-
-    //  Check clipping, and check if should open noise gate
-    _didClipInLastBlock = false;
-
-    for (int i = 0; i < numSamples; i++) {
-        thisSample = std::abs(samples[i]);
-        if (thisSample >= ((float) AudioConstants::MAX_SAMPLE_VALUE * CLIPPING_THRESHOLD)) {
-            _didClipInLastBlock = true;
-        }
-
-        loudness += thisSample;
-        //  Noise Reduction:  Count peaks above the average loudness
-        if (thisSample > (_measuredFloor * NOISE_GATE_HEIGHT)) {
-            samplesOverNoiseGate++;
-        }
-    }
-
-    _lastLoudness = fabs(loudness / numSamples);
-
+void AudioNoiseGate::updateGateState(int16_t* samples, int numSamples, int samplesOverGate) {
     //  If Noise Gate is enabled, check and turn the gate on and off
     float averageOfAllSampleBlocks = 0.0f;
     _sampleBlocks[_sampleCounter++] = _lastLoudness;
@@ -124,7 +142,7 @@ void AudioNoiseGate::gateSamples(int16_t* samples, int numSamples) {
     _closedInLastBlock = false;
     _openedInLastBlock = false;
 
-    if (samplesOverNoiseGate > NOISE_GATE_WIDTH) {
+    if (samplesOverGate > NOISE_GATE_WIDTH) {
         _openedInLastBlock = !_isOpen;
         _isOpen = true;
         _blocksToClose = NOISE_GATE_CLOSE_BLOCK_DELAY;
@@ -162,3 +180,51 @@ void AudioNoiseGate::gateSamples(int16_t* samples, int numSamples) {
         }
     }
 }
+
+void AudioNoiseGate::processBlock(int16_t* samples, int numSamples, bool gateEnabled) {
+    int32_t gateThreshold = (int32_t)floorf(_measuredFloor * NOISE_GATE_HEIGHT);
+    int32_t clipThreshold = (int32_t)((float)AudioConstants::MAX_SAMPLE_VALUE * CLIPPING_THRESHOLD);
+
+    int32_t dcSum, loudnessSum;
+    int samplesOverGate;
+    bool didClip;
+    removeDCAndMeasure(samples, numSamples, (int16_t)_dcOffset, gateThreshold, clipThreshold,
+                       dcSum, loudnessSum, samplesOverGate, didClip);
+
+    updateDCOffset(dcSum, numSamples);
+    _didClipInLastBlock = didClip;
+    _lastLoudness = fabs((float)loudnessSum / numSamples);
+
+    if (gateEnabled) {
+        updateGateState(samples, numSamples, samplesOverGate);
+    }
+}
+
+void AudioNoiseGate::removeDCOffset(int16_t* samples, int numSamples) {
+    int32_t dcSum, loudnessSum;
+    int samplesOverGate;
+    bool didClip;
+    removeDCAndMeasure(samples, numSamples, (int16_t)_dcOffset, std::numeric_limits<int32_t>::max(),
+                       std::numeric_limits<int32_t>::max(), dcSum, loudnessSum, samplesOverGate, didClip);
+    updateDCOffset(dcSum, numSamples);
+}
+
+void AudioNoiseGate::gateSamples(int16_t* samples, int numSamples) {
+    //  Impose Noise Gate
+    //
+    //  Check clipping, and check if should open noise gate
+    int32_t gateThreshold = (int32_t)floorf(_measuredFloor * NOISE_GATE_HEIGHT);
+    int32_t clipThreshold = (int32_t)((float)AudioConstants::MAX_SAMPLE_VALUE * CLIPPING_THRESHOLD);
+
+    int32_t dcSum, loudnessSum;
+    int samplesOverGate;
+    bool didClip;
+    // a zero DC offset leaves the samples untouched during measurement
+    removeDCAndMeasure(samples, numSamples, 0, gateThreshold, clipThreshold,
+                       dcSum, loudnessSum, samplesOverGate, didClip);
+
+    _didClipInLastBlock = didClip;
+    _lastLoudness = fabs((float)loudnessSum / numSamples);
+
+    updateGateState(samples, numSamples, samplesOverGate);
+}
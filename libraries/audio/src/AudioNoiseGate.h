@@ -23,6 +23,11 @@ public:
     void gateSamples(int16_t* samples, int numSamples);
     void removeDCOffset(int16_t* samples, int numSamples);
 
+    // fused single trip over the block: removes the DC offset in place while measuring
+    // loudness, clipping and gate peaks, then applies the gate envelope when enabled.
+    // Replaces the separate removeDCOffset/gateSamples passes on the microphone path.
+    void processBlock(int16_t* samples, int numSamples, bool gateEnabled);
+
     bool clippedInLastBlock() const { return _didClipInLastBlock; }
     bool closedInLastBlock() const { return _closedInLastBlock; }
     bool openedInLastBlock() const { return _openedInLastBlock; }
@@ -33,6 +38,21 @@ public:
     static const float CLIPPING_THRESHOLD;
 
 private:
+    // one pass over the samples: subtract dcOffset in place and accumulate everything the
+    // envelope logic needs, so the intermediate values stay in registers
+    static void removeDCAndMeasure(int16_t* samples, int numSamples, int16_t dcOffset,
+                                   int32_t gateThreshold, int32_t clipThreshold,
+                                   int32_t& dcSum, int32_t& loudnessSum, int& samplesOverGate, bool& didClip);
+    static void removeDCAndMeasure_ref(int16_t* samples, int numSamples, int16_t dcOffset,
+                                       int32_t gateThreshold, int32_t clipThreshold,
+                                       int32_t& dcSum, int32_t& loudnessSum, int& samplesOverGate, bool& didClip);
+    static void removeDCAndMeasure_AVX2(int16_t* samples, int numSamples, int16_t dcOffset,
+                                        int32_t gateThreshold, int32_t clipThreshold,
+                                        int32_t& dcSum, int32_t& loudnessSum, int& samplesOverGate, bool& didClip);
+
+    void updateDCOffset(int32_t dcSum, int numSamples);
+    void updateGateState(int16_t* samples, int numSamples, int samplesOverGate);
+
     float _lastLoudness;
     bool _didClipInLastBlock;
     float _dcOffset;
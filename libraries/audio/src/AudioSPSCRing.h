@@ -0,0 +1,144 @@
+//
+//  AudioSPSCRing.h
+//  libraries/audio/src
+//
+//  Created by Ken Cooke on 2017-04-24.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSPSCRing_h
+#define hifi_AudioSPSCRing_h
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include <QtGlobal>
+
+/// A wait-free single-producer/single-consumer ring of float samples, for moving audio
+/// between a mixing thread and a real-time device callback. Unlike AudioRingBuffer, which
+/// is only safe as a pipe when an external atomic gates every access, the read and write
+/// indices here are atomics - the consumer never takes a lock and never overreads, and the
+/// producer never overwrites unread data (excess samples are dropped and counted).
+///
+/// Exactly one thread may write and exactly one thread may read. resize() is only safe
+/// while both sides are stopped; clear() is safe from the consumer side.
+class AudioSPSCRing {
+public:
+    AudioSPSCRing() {}
+
+    // disallow copying, the indices are owned by live threads
+    AudioSPSCRing(const AudioSPSCRing&) = delete;
+    AudioSPSCRing& operator=(const AudioSPSCRing&) = delete;
+
+    void resize(int sampleCapacity) {
+        // one slot is kept empty to distinguish full from empty
+        _buffer.assign(sampleCapacity + 1, 0.0f);
+        _readIndex.store(0, std::memory_order_release);
+        _writeIndex.store(0, std::memory_order_release);
+    }
+
+    int getSampleCapacity() const { return std::max(0, (int)_buffer.size() - 1); }
+
+    int samplesAvailable() const {
+        int available = _writeIndex.load(std::memory_order_acquire) - _readIndex.load(std::memory_order_acquire);
+        if (available < 0) {
+            available += (int)_buffer.size();
+        }
+        return available;
+    }
+
+    int samplesFree() const { return getSampleCapacity() - samplesAvailable(); }
+
+    /// Write up to maxSamples from source; excess samples are dropped, not overwritten,
+    /// and any shortfall is counted as an overrun. Returns the number of samples written.
+    int writeSamples(const float* source, int maxSamples) {
+        int size = (int)_buffer.size();
+        if (size == 0) {
+            return 0;
+        }
+        int readIndex = _readIndex.load(std::memory_order_acquire);
+        int writeIndex = _writeIndex.load(std::memory_order_relaxed);
+
+        int free = readIndex - writeIndex - 1;
+        if (free < 0) {
+            free += size;
+        }
+
+        int samplesToWrite = std::min(maxSamples, free);
+        if (samplesToWrite < maxSamples) {
+            ++_overruns;
+        }
+
+        int firstSegment = std::min(samplesToWrite, size - writeIndex);
+        memcpy(_buffer.data() + writeIndex, source, firstSegment * sizeof(float));
+        memcpy(_buffer.data(), source + firstSegment, (samplesToWrite - firstSegment) * sizeof(float));
+
+        _writeIndex.store((writeIndex + samplesToWrite) % size, std::memory_order_release);
+        return samplesToWrite;
+    }
+
+    /// Read up to maxSamples into destination. Returns the number of samples read.
+    int readSamples(float* destination, int maxSamples) { return popSamples(destination, maxSamples, false); }
+
+    /// Mix (+=) up to maxSamples into destination, or copy when append is false.
+    /// Returns the number of samples appended.
+    int appendSamples(float* destination, int maxSamples, bool append = true) {
+        return popSamples(destination, maxSamples, append);
+    }
+
+    /// called by the consumer when it came up short against a producer that is still running
+    void noteUnderrun() { ++_underruns; }
+
+    quint64 getOverrunCount() const { return _overruns.load(std::memory_order_relaxed); }
+    quint64 getUnderrunCount() const { return _underruns.load(std::memory_order_relaxed); }
+
+    /// drops any buffered samples - consumer side only
+    void clear() { _readIndex.store(_writeIndex.load(std::memory_order_acquire), std::memory_order_release); }
+
+    bool isLockFree() const { return _readIndex.is_lock_free() && _writeIndex.is_lock_free(); }
+
+private:
+    int popSamples(float* destination, int maxSamples, bool append) {
+        int size = (int)_buffer.size();
+        if (size == 0) {
+            return 0;
+        }
+        int writeIndex = _writeIndex.load(std::memory_order_acquire);
+        int readIndex = _readIndex.load(std::memory_order_relaxed);
+
+        int available = writeIndex - readIndex;
+        if (available < 0) {
+            available += size;
+        }
+
+        int samplesToRead = std::min(maxSamples, available);
+        int firstSegment = std::min(samplesToRead, size - readIndex);
+        if (append) {
+            for (int i = 0; i < firstSegment; i++) {
+                destination[i] += _buffer[readIndex + i];
+            }
+            for (int i = firstSegment; i < samplesToRead; i++) {
+                destination[i] += _buffer[i - firstSegment];
+            }
+        } else {
+            memcpy(destination, _buffer.data() + readIndex, firstSegment * sizeof(float));
+            memcpy(destination + firstSegment, _buffer.data(), (samplesToRead - firstSegment) * sizeof(float));
+        }
+
+        _readIndex.store((readIndex + samplesToRead) % size, std::memory_order_release);
+        return samplesToRead;
+    }
+
+    std::vector<float> _buffer;
+    std::atomic<int> _readIndex { 0 };
+    std::atomic<int> _writeIndex { 0 };
+    std::atomic<quint64> _overruns { 0 };
+    std::atomic<quint64> _underruns { 0 };
+};
+
+#endif // hifi_AudioSPSCRing_h
@@ -433,19 +433,406 @@ int AudioSRC::multirateFilter4_ref(const float* input0, const float* input1, con
 
 #include "CPUDetect.h"
 
+
+#include <emmintrin.h>  // SSE2
+
+//
+// SSE2 versions
+//
+int AudioSRC::multirateFilter1_SSE(const float* input0, float* output0, int inputFrames) {
+    int outputFrames = 0;
+
+    assert(_numTaps % 8 == 0);  // SIMD8
+
+    if (_step == 0) {   // rational
+
+        int32_t i = HI32(_offset);
+
+        while (i < inputFrames) {
+
+            const float* c0 = &_polyphaseFilter[_numTaps * _phase];
+
+            __m128 acc0 = _mm_setzero_ps();
+            __m128 acc1 = _mm_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 8) {
+
+                //float coef = c0[j];
+                __m128 coef0 = _mm_load_ps(&c0[j + 0]); // aligned
+                __m128 coef1 = _mm_load_ps(&c0[j + 4]); // aligned
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 0]), coef0));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 4]), coef1));
+            }
+            acc0 = _mm_add_ps(acc0, acc1);
+
+            // horizontal sum
+            acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+            acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(0, 0, 0, 1)));
+
+            _mm_store_ss(&output0[outputFrames], acc0);
+            outputFrames += 1;
+
+            i += _stepTable[_phase];
+            if (++_phase == _upFactor) {
+                _phase = 0;
+            }
+        }
+        _offset = (int64_t)(i - inputFrames) << 32;
+
+    } else {    // irrational
+
+        while (HI32(_offset) < inputFrames) {
+
+            int32_t i = HI32(_offset);
+            uint32_t f = LO32(_offset);
+
+            uint32_t phase = f >> SRC_FRACBITS;
+            __m128 frac = _mm_set1_ps((f & SRC_FRACMASK) * QFRAC_TO_FLOAT);
+
+            const float* c0 = &_polyphaseFilter[_numTaps * (phase + 0)];
+            const float* c1 = &_polyphaseFilter[_numTaps * (phase + 1)];
+
+            __m128 acc0 = _mm_setzero_ps();
+            __m128 acc1 = _mm_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 8) {
+
+                __m128 coef0 = _mm_load_ps(&c0[j + 0]); // aligned
+                __m128 coef1 = _mm_load_ps(&c0[j + 4]); // aligned
+                __m128 coef2 = _mm_load_ps(&c1[j + 0]); // aligned
+                __m128 coef3 = _mm_load_ps(&c1[j + 4]); // aligned
+
+                //float coef = c0[j] + frac * (c1[j] - c0[j]);
+                coef2 = _mm_sub_ps(coef2, coef0);
+                coef3 = _mm_sub_ps(coef3, coef1);
+                coef0 = _mm_add_ps(coef0, _mm_mul_ps(coef2, frac));
+                coef1 = _mm_add_ps(coef1, _mm_mul_ps(coef3, frac));
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 0]), coef0));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 4]), coef1));
+            }
+            acc0 = _mm_add_ps(acc0, acc1);
+
+            // horizontal sum
+            acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+            acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(0, 0, 0, 1)));
+
+            _mm_store_ss(&output0[outputFrames], acc0);
+            outputFrames += 1;
+
+            _offset += _step;
+        }
+        _offset -= (int64_t)inputFrames << 32;
+    }
+
+    return outputFrames;
+}
+
+int AudioSRC::multirateFilter2_SSE(const float* input0, const float* input1, float* output0, float* output1, int inputFrames) {
+    int outputFrames = 0;
+
+    assert(_numTaps % 8 == 0);  // SIMD8
+
+    if (_step == 0) {   // rational
+
+        int32_t i = HI32(_offset);
+
+        while (i < inputFrames) {
+
+            const float* c0 = &_polyphaseFilter[_numTaps * _phase];
+
+            __m128 acc0 = _mm_setzero_ps();
+            __m128 acc1 = _mm_setzero_ps();
+            __m128 acc2 = _mm_setzero_ps();
+            __m128 acc3 = _mm_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 8) {
+
+                //float coef = c0[j];
+                __m128 coef0 = _mm_load_ps(&c0[j + 0]); // aligned
+                __m128 coef1 = _mm_load_ps(&c0[j + 4]); // aligned
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 0]), coef0));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 4]), coef1));
+                acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(&input1[i + j + 0]), coef0));
+                acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(&input1[i + j + 4]), coef1));
+            }
+            acc0 = _mm_add_ps(acc0, acc1);
+            acc2 = _mm_add_ps(acc2, acc3);
+
+            // horizontal sum
+            acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+            acc2 = _mm_add_ps(acc2, _mm_movehl_ps(acc2, acc2));
+            acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc2 = _mm_add_ss(acc2, _mm_shuffle_ps(acc2, acc2, _MM_SHUFFLE(0, 0, 0, 1)));
+
+            _mm_store_ss(&output0[outputFrames], acc0);
+            _mm_store_ss(&output1[outputFrames], acc2);
+            outputFrames += 1;
+
+            i += _stepTable[_phase];
+            if (++_phase == _upFactor) {
+                _phase = 0;
+            }
+        }
+        _offset = (int64_t)(i - inputFrames) << 32;
+
+    } else {    // irrational
+
+        while (HI32(_offset) < inputFrames) {
+
+            int32_t i = HI32(_offset);
+            uint32_t f = LO32(_offset);
+
+            uint32_t phase = f >> SRC_FRACBITS;
+            __m128 frac = _mm_set1_ps((f & SRC_FRACMASK) * QFRAC_TO_FLOAT);
+
+            const float* c0 = &_polyphaseFilter[_numTaps * (phase + 0)];
+            const float* c1 = &_polyphaseFilter[_numTaps * (phase + 1)];
+
+            __m128 acc0 = _mm_setzero_ps();
+            __m128 acc1 = _mm_setzero_ps();
+            __m128 acc2 = _mm_setzero_ps();
+            __m128 acc3 = _mm_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 8) {
+
+                __m128 coef0 = _mm_load_ps(&c0[j + 0]); // aligned
+                __m128 coef1 = _mm_load_ps(&c0[j + 4]); // aligned
+                __m128 coef2 = _mm_load_ps(&c1[j + 0]); // aligned
+                __m128 coef3 = _mm_load_ps(&c1[j + 4]); // aligned
+
+                //float coef = c0[j] + frac * (c1[j] - c0[j]);
+                coef2 = _mm_sub_ps(coef2, coef0);
+                coef3 = _mm_sub_ps(coef3, coef1);
+                coef0 = _mm_add_ps(coef0, _mm_mul_ps(coef2, frac));
+                coef1 = _mm_add_ps(coef1, _mm_mul_ps(coef3, frac));
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 0]), coef0));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 4]), coef1));
+                acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(&input1[i + j + 0]), coef0));
+                acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(&input1[i + j + 4]), coef1));
+            }
+            acc0 = _mm_add_ps(acc0, acc1);
+            acc2 = _mm_add_ps(acc2, acc3);
+
+            // horizontal sum
+            acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+            acc2 = _mm_add_ps(acc2, _mm_movehl_ps(acc2, acc2));
+            acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc2 = _mm_add_ss(acc2, _mm_shuffle_ps(acc2, acc2, _MM_SHUFFLE(0, 0, 0, 1)));
+
+            _mm_store_ss(&output0[outputFrames], acc0);
+            _mm_store_ss(&output1[outputFrames], acc2);
+            outputFrames += 1;
+
+            _offset += _step;
+        }
+        _offset -= (int64_t)inputFrames << 32;
+    }
+
+    return outputFrames;
+}
+
+int AudioSRC::multirateFilter4_SSE(const float* input0, const float* input1, const float* input2, const float* input3,
+                                   float* output0, float* output1, float* output2, float* output3, int inputFrames) {
+    int outputFrames = 0;
+
+    assert(_numTaps % 8 == 0);  // SIMD8
+
+    if (_step == 0) {   // rational
+
+        int32_t i = HI32(_offset);
+
+        while (i < inputFrames) {
+
+            const float* c0 = &_polyphaseFilter[_numTaps * _phase];
+
+            __m128 acc0 = _mm_setzero_ps();
+            __m128 acc1 = _mm_setzero_ps();
+            __m128 acc2 = _mm_setzero_ps();
+            __m128 acc3 = _mm_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 4) {
+
+                //float coef = c0[j];
+                __m128 coef0 = _mm_load_ps(&c0[j]);     // aligned
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&input0[i + j]), coef0));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&input1[i + j]), coef0));
+                acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(&input2[i + j]), coef0));
+                acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(&input3[i + j]), coef0));
+            }
+
+            // horizontal sum
+            acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+            acc1 = _mm_add_ps(acc1, _mm_movehl_ps(acc1, acc1));
+            acc2 = _mm_add_ps(acc2, _mm_movehl_ps(acc2, acc2));
+            acc3 = _mm_add_ps(acc3, _mm_movehl_ps(acc3, acc3));
+            acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc1 = _mm_add_ss(acc1, _mm_shuffle_ps(acc1, acc1, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc2 = _mm_add_ss(acc2, _mm_shuffle_ps(acc2, acc2, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc3 = _mm_add_ss(acc3, _mm_shuffle_ps(acc3, acc3, _MM_SHUFFLE(0, 0, 0, 1)));
+
+            _mm_store_ss(&output0[outputFrames], acc0);
+            _mm_store_ss(&output1[outputFrames], acc1);
+            _mm_store_ss(&output2[outputFrames], acc2);
+            _mm_store_ss(&output3[outputFrames], acc3);
+            outputFrames += 1;
+
+            i += _stepTable[_phase];
+            if (++_phase == _upFactor) {
+                _phase = 0;
+            }
+        }
+        _offset = (int64_t)(i - inputFrames) << 32;
+
+    } else {    // irrational
+
+        while (HI32(_offset) < inputFrames) {
+
+            int32_t i = HI32(_offset);
+            uint32_t f = LO32(_offset);
+
+            uint32_t phase = f >> SRC_FRACBITS;
+            __m128 frac = _mm_set1_ps((f & SRC_FRACMASK) * QFRAC_TO_FLOAT);
+
+            const float* c0 = &_polyphaseFilter[_numTaps * (phase + 0)];
+            const float* c1 = &_polyphaseFilter[_numTaps * (phase + 1)];
+
+            __m128 acc0 = _mm_setzero_ps();
+            __m128 acc1 = _mm_setzero_ps();
+            __m128 acc2 = _mm_setzero_ps();
+            __m128 acc3 = _mm_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 4) {
+
+                __m128 coef0 = _mm_load_ps(&c0[j]);     // aligned
+                __m128 coef1 = _mm_load_ps(&c1[j]);     // aligned
+
+                //float coef = c0[j] + frac * (c1[j] - c0[j]);
+                coef1 = _mm_sub_ps(coef1, coef0);
+                coef0 = _mm_add_ps(coef0, _mm_mul_ps(coef1, frac));
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&input0[i + j]), coef0));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&input1[i + j]), coef0));
+                acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(&input2[i + j]), coef0));
+                acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(&input3[i + j]), coef0));
+            }
+
+            // horizontal sum
+            acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+            acc1 = _mm_add_ps(acc1, _mm_movehl_ps(acc1, acc1));
+            acc2 = _mm_add_ps(acc2, _mm_movehl_ps(acc2, acc2));
+            acc3 = _mm_add_ps(acc3, _mm_movehl_ps(acc3, acc3));
+            acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc1 = _mm_add_ss(acc1, _mm_shuffle_ps(acc1, acc1, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc2 = _mm_add_ss(acc2, _mm_shuffle_ps(acc2, acc2, _MM_SHUFFLE(0, 0, 0, 1)));
+            acc3 = _mm_add_ss(acc3, _mm_shuffle_ps(acc3, acc3, _MM_SHUFFLE(0, 0, 0, 1)));
+
+            _mm_store_ss(&output0[outputFrames], acc0);
+            _mm_store_ss(&output1[outputFrames], acc1);
+            _mm_store_ss(&output2[outputFrames], acc2);
+            _mm_store_ss(&output3[outputFrames], acc3);
+            outputFrames += 1;
+
+            _offset += _step;
+        }
+        _offset -= (int64_t)inputFrames << 32;
+    }
+
+    return outputFrames;
+}
+
+//
+// Tap-count-specialized mono kernel for rational ratios.
+// With NUM_TAPS known at compile time, the inner loop trip count constant-folds
+// and fully unrolls, eliminating loop overhead for the common injector ratios.
+//
+template <int NUM_TAPS>
+int AudioSRC::multirateFilter1_T(const float* input0, float* output0, int inputFrames) {
+    int outputFrames = 0;
+
+    static_assert(NUM_TAPS % 8 == 0, "NUM_TAPS must be SIMD8");
+    assert(_step == 0);     // rational only
+    assert(_numTaps == NUM_TAPS);
+
+    int32_t i = HI32(_offset);
+
+    while (i < inputFrames) {
+
+        const float* c0 = &_polyphaseFilter[NUM_TAPS * _phase];
+
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+
+        for (int j = 0; j < NUM_TAPS; j += 8) {
+
+            //float coef = c0[j];
+            __m128 coef0 = _mm_load_ps(&c0[j + 0]);     // aligned
+            __m128 coef1 = _mm_load_ps(&c0[j + 4]);     // aligned
+
+            //acc += input[i + j] * coef;
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 0]), coef0));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&input0[i + j + 4]), coef1));
+        }
+        acc0 = _mm_add_ps(acc0, acc1);
+
+        // horizontal sum
+        acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+        acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(0, 0, 0, 1)));
+
+        _mm_store_ss(&output0[outputFrames], acc0);
+        outputFrames += 1;
+
+        i += _stepTable[_phase];
+        if (++_phase == _upFactor) {
+            _phase = 0;
+        }
+    }
+    _offset = (int64_t)(i - inputFrames) << 32;
+
+    return outputFrames;
+}
+
+
 int AudioSRC::multirateFilter1(const float* input0, float* output0, int inputFrames) {
-    static auto f = cpuSupportsAVX2() ? &AudioSRC::multirateFilter1_AVX2 : &AudioSRC::multirateFilter1_ref;
-    return (this->*f)(input0, output0, inputFrames);    // dispatch
+    static bool avx2 = cpuSupportsAVX2();   // dispatch
+    if (avx2) {
+        return multirateFilter1_AVX2(input0, output0, inputFrames);
+    }
+
+    if (_step == 0) {
+        // rational ratios with common tap counts use specialized kernels
+        switch (_numTaps) {
+            case 16: return multirateFilter1_T<16>(input0, output0, inputFrames);
+            case 24: return multirateFilter1_T<24>(input0, output0, inputFrames);
+            case 32: return multirateFilter1_T<32>(input0, output0, inputFrames);
+            case 40: return multirateFilter1_T<40>(input0, output0, inputFrames);
+            case 48: return multirateFilter1_T<48>(input0, output0, inputFrames);
+            case 64: return multirateFilter1_T<64>(input0, output0, inputFrames);
+            case 72: return multirateFilter1_T<72>(input0, output0, inputFrames);
+            case 96: return multirateFilter1_T<96>(input0, output0, inputFrames);
+        }
+    }
+    return multirateFilter1_SSE(input0, output0, inputFrames);
 }
 
 int AudioSRC::multirateFilter2(const float* input0, const float* input1, float* output0, float* output1, int inputFrames) {
-    static auto f = cpuSupportsAVX2() ? &AudioSRC::multirateFilter2_AVX2 : &AudioSRC::multirateFilter2_ref;
+    static auto f = cpuSupportsAVX2() ? &AudioSRC::multirateFilter2_AVX2 : &AudioSRC::multirateFilter2_SSE;
     return (this->*f)(input0, input1, output0, output1, inputFrames);   // dispatch
 }
 
 int AudioSRC::multirateFilter4(const float* input0, const float* input1, const float* input2, const float* input3, 
                                float* output0, float* output1, float* output2, float* output3, int inputFrames) {
-    static auto f = cpuSupportsAVX2() ? &AudioSRC::multirateFilter4_AVX2 : &AudioSRC::multirateFilter4_ref;
+    static auto f = cpuSupportsAVX2() ? &AudioSRC::multirateFilter4_AVX2 : &AudioSRC::multirateFilter4_SSE;
     return (this->*f)(input0, input1, input2, input3, output0, output1, output2, output3, inputFrames); // dispatch
 }
 
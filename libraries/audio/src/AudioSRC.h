@@ -89,6 +89,15 @@ private:
     int multirateFilter4_ref(const float* input0, const float* input1, const float* input2, const float* input3, 
                              float* output0, float* output1, float* output2, float* output3, int inputFrames);
 
+    int multirateFilter1_SSE(const float* input0, float* output0, int inputFrames);
+    int multirateFilter2_SSE(const float* input0, const float* input1, float* output0, float* output1, int inputFrames);
+    int multirateFilter4_SSE(const float* input0, const float* input1, const float* input2, const float* input3,
+                             float* output0, float* output1, float* output2, float* output3, int inputFrames);
+
+    // tap-count-specialized mono kernel for rational ratios
+    template <int NUM_TAPS>
+    int multirateFilter1_T(const float* input0, float* output0, int inputFrames);
+
     int multirateFilter1_AVX2(const float* input0, float* output0, int inputFrames);
     int multirateFilter2_AVX2(const float* input0, const float* input1, float* output0, float* output1, int inputFrames);
     int multirateFilter4_AVX2(const float* input0, const float* input1, const float* input2, const float* input3, 
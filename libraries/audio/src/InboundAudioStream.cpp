@@ -113,6 +113,21 @@ void InboundAudioStream::perSecondCallbackForUpdatingStats() {
 }
 
 int InboundAudioStream::parseData(ReceivedMessage& message) {
+    int position = parsePacket(message);
+    updateBufferState();
+    return position;
+}
+
+int InboundAudioStream::parseDataBatch(const std::vector<QSharedPointer<ReceivedMessage>>& messages) {
+    int position = 0;
+    for (auto& message : messages) {
+        position = parsePacket(*message);
+    }
+    updateBufferState();
+    return position;
+}
+
+int InboundAudioStream::parsePacket(ReceivedMessage& message) {
     // parse sequence number and track it
     quint16 sequence;
     message.readPrimitive(&sequence);
@@ -180,6 +195,10 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
         }
     }
 
+    return message.getPosition();
+}
+
+void InboundAudioStream::updateBufferState() {
     int framesAvailable = _ringBuffer.framesAvailable();
     // if this stream was starved, check if we're still starved.
     if (_isStarved && framesAvailable >= _desiredJitterBufferFrames) {
@@ -202,8 +221,6 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
     }
 
     framesAvailableChanged();
-
-    return message.getPosition();
 }
 
 int InboundAudioStream::parseStreamProperties(PacketType type, const QByteArray& packetAfterSeqNum, int& numAudioSamples) {
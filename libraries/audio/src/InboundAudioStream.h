@@ -12,6 +12,8 @@
 #ifndef hifi_InboundAudioStream_h
 #define hifi_InboundAudioStream_h
 
+#include <vector>
+
 #include <Node.h>
 #include <NodeData.h>
 #include <NumericalConstants.h>
@@ -56,6 +58,10 @@ public:
 
     virtual int parseData(ReceivedMessage& packet) override;
 
+    // Batched ingest: parses a run of queued packets for this stream in one pass,
+    // deferring jitter-buffer housekeeping until the whole batch has been written
+    int parseDataBatch(const std::vector<QSharedPointer<ReceivedMessage>>& messages);
+
     int popFrames(int maxFrames, bool allOrNothing);
     int popSamples(int maxSamples, bool allOrNothing);
 
@@ -113,6 +119,9 @@ public slots:
     void perSecondCallbackForUpdatingStats();
 
 private:
+    int parsePacket(ReceivedMessage& packet);
+    void updateBufferState();
+
     void packetReceivedUpdateTimingStats();
 
     void popSamplesNoCheck(int samples);
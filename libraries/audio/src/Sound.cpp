@@ -15,6 +15,9 @@
 
 #include <QDataStream>
 #include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
 #include <QtNetwork/QNetworkRequest>
 #include <QtNetwork/QNetworkReply>
 #include <qendian.h>
@@ -52,42 +55,161 @@ Sound::Sound(const QUrl& url, bool isStereo, bool isAmbisonic) :
 
 }
 
+//
+// Processed sound cache: once a download has been decoded and resampled to the
+// mixer-native format (signed 16-bit, 24khz) the result is persisted to disk.
+// Subsequent loads of the same source bytes are validated against the header
+// below and memory-mapped, skipping the decode entirely and letting the OS
+// share the sample pages between processes instead of duplicating them on
+// every heap. The injector streams the mapped view in network-frame windows,
+// so pages are only faulted in as playback reaches them.
+//
+static const quint32 PROCESSED_SOUND_MAGIC = 0x48465350; // 'HFSP'
+static const quint32 PROCESSED_SOUND_VERSION = 1;
+
+struct ProcessedSoundHeader {
+    quint32 magic;
+    quint32 version;
+    quint32 sourceSize;     // size of the source download, for invalidation
+    quint16 sourceChecksum; // qChecksum of the source download
+    quint8 isStereo;
+    quint8 isAmbisonic;
+    float duration;         // in seconds
+};
+
+QString Sound::processedFileName(const QUrl& url) {
+    return QString::number(qHash(url.toString()), 16) + ".hfsp";
+}
+
+static QString processedSoundPath(const QUrl& url) {
+    QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/processedSounds";
+    QDir().mkpath(cacheDir);
+    return cacheDir + "/" + Sound::processedFileName(url);
+}
+
+static QByteArray downSample(const QByteArray& rawAudioByteArray, int sampleRate, bool isStereo, bool isAmbisonic);
+static int interpretAsWav(const QByteArray& inputAudioByteArray, QByteArray& outputAudioByteArray,
+                          bool& isStereo, bool& isAmbisonic, float& duration);
+
+bool Sound::loadFromProcessedCache(const QString& path, const QByteArray& sourceData) {
+    auto file = std::unique_ptr<QFile>(new QFile(path));
+    if (!file->open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    ProcessedSoundHeader header;
+    if (file->read((char*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != PROCESSED_SOUND_MAGIC ||
+        header.version != PROCESSED_SOUND_VERSION ||
+        header.sourceSize != (quint32)sourceData.size() ||
+        header.sourceChecksum != qChecksum(sourceData.constData(), sourceData.size())) {
+        return false;
+    }
+
+    qint64 samplesSize = file->size() - sizeof(header);
+    uchar* mapped = file->map(sizeof(header), samplesSize);
+    if (!mapped) {
+        return false;
+    }
+
+    // hand out a zero-copy view over the mapping; the mapping lives as long as this Sound
+    _byteArray = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), (int)samplesSize);
+    _mappedFile = std::move(file);
+
+    _isStereo = header.isStereo;
+    _isAmbisonic = header.isAmbisonic;
+    _duration = header.duration;
+
+    qCDebug(audio) << "Mapped processed sound for" << getURL();
+    return true;
+}
+
+bool Sound::writeProcessedFile(const QString& path, const QByteArray& sourceData, const QByteArray& samples,
+                               bool isStereo, bool isAmbisonic, float duration) {
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    ProcessedSoundHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = PROCESSED_SOUND_MAGIC;
+    header.version = PROCESSED_SOUND_VERSION;
+    header.sourceSize = (quint32)sourceData.size();
+    header.sourceChecksum = qChecksum(sourceData.constData(), sourceData.size());
+    header.isStereo = isStereo;
+    header.isAmbisonic = isAmbisonic;
+    header.duration = duration;
+
+    file.write((const char*)&header, sizeof(header));
+    file.write(samples);
+    return file.commit();
+}
+
+void Sound::writeProcessedCache(const QString& path, const QByteArray& sourceData) {
+    writeProcessedFile(path, sourceData, _byteArray, _isStereo, _isAmbisonic, _duration);
+}
+
 void Sound::downloadFinished(const QByteArray& data) {
-    // replace our byte array with the downloaded data
-    QByteArray rawAudioByteArray = QByteArray(data);
-    QString fileName = getURL().fileName().toLower();
+    QString processedPath = processedSoundPath(getURL());
+    if (loadFromProcessedCache(processedPath, data)) {
+        finishedLoading(true);
+
+        _isReady = true;
+        emit ready();
+        return;
+    }
+
+    // process the downloaded data into mixer-native samples
+    bool isStereo = _isStereo;
+    bool isAmbisonic = _isAmbisonic;
+    float duration = _duration;
+    _byteArray = processSoundData(data, getURL().fileName().toLower(), isStereo, isAmbisonic, duration);
+    _isStereo = isStereo;
+    _isAmbisonic = isAmbisonic;
+    _duration = duration;
+
+    if (!_byteArray.isEmpty()) {
+        // persist the processed samples, then swap the heap copy for a mapped view
+        writeProcessedCache(processedPath, data);
+        loadFromProcessedCache(processedPath, data);
+    }
+
+    finishedLoading(true);
+
+    _isReady = true;
+    emit ready();
+}
 
+QByteArray Sound::processSoundData(const QByteArray& data, const QString& fileName,
+                                   bool& isStereo, bool& isAmbisonic, float& duration) {
     static const QString WAV_EXTENSION = ".wav";
     static const QString RAW_EXTENSION = ".raw";
     if (fileName.endsWith(WAV_EXTENSION)) {
 
         QByteArray outputAudioByteArray;
 
-        int sampleRate = interpretAsWav(rawAudioByteArray, outputAudioByteArray);
+        int sampleRate = interpretAsWav(data, outputAudioByteArray, isStereo, isAmbisonic, duration);
         if (sampleRate != 0) {
-            downSample(outputAudioByteArray, sampleRate);
+            return downSample(outputAudioByteArray, sampleRate, isStereo, isAmbisonic);
         }
     } else if (fileName.endsWith(RAW_EXTENSION)) {
         // check if this was a stereo raw file
         // since it's raw the only way for us to know that is if the file was called .stereo.raw
-        if (fileName.toLower().endsWith("stereo.raw")) {
-            _isStereo = true;
-            qCDebug(audio) << "Processing sound of" << rawAudioByteArray.size() << "bytes from" << getURL() << "as stereo audio file.";
+        if (fileName.endsWith("stereo.raw")) {
+            isStereo = true;
+            qCDebug(audio) << "Processing sound of" << data.size() << "bytes from" << fileName << "as stereo audio file.";
         }
 
         // Process as 48khz RAW file
-        downSample(rawAudioByteArray, 48000);
+        return downSample(data, 48000, isStereo, isAmbisonic);
     } else {
         qCDebug(audio) << "Unknown sound file type";
     }
-
-    finishedLoading(true);
-
-    _isReady = true;
-    emit ready();
+    return QByteArray();
 }
 
-void Sound::downSample(const QByteArray& rawAudioByteArray, int sampleRate) {
+static QByteArray downSample(const QByteArray& rawAudioByteArray, int sampleRate, bool isStereo, bool isAmbisonic) {
 
     // we want to convert it to the format that the audio-mixer wants
     // which is signed, 16-bit, 24Khz
@@ -95,27 +217,27 @@ void Sound::downSample(const QByteArray& rawAudioByteArray, int sampleRate) {
     if (sampleRate == AudioConstants::SAMPLE_RATE) {
 
         // no resampling needed
-        _byteArray = rawAudioByteArray;
-
-    } else {
+        return rawAudioByteArray;
+    }
 
-        int numChannels = _isAmbisonic ? AudioConstants::AMBISONIC : (_isStereo ? AudioConstants::STEREO : AudioConstants::MONO);
-        AudioSRC resampler(sampleRate, AudioConstants::SAMPLE_RATE, numChannels);
+    int numChannels = isAmbisonic ? AudioConstants::AMBISONIC : (isStereo ? AudioConstants::STEREO : AudioConstants::MONO);
+    AudioSRC resampler(sampleRate, AudioConstants::SAMPLE_RATE, numChannels);
 
-        // resize to max possible output
-        int numSourceFrames = rawAudioByteArray.size() / (numChannels * sizeof(AudioConstants::AudioSample));
-        int maxDestinationFrames = resampler.getMaxOutput(numSourceFrames);
-        int maxDestinationBytes = maxDestinationFrames * numChannels * sizeof(AudioConstants::AudioSample);
-        _byteArray.resize(maxDestinationBytes);
+    // resize to max possible output
+    int numSourceFrames = rawAudioByteArray.size() / (numChannels * sizeof(AudioConstants::AudioSample));
+    int maxDestinationFrames = resampler.getMaxOutput(numSourceFrames);
+    int maxDestinationBytes = maxDestinationFrames * numChannels * sizeof(AudioConstants::AudioSample);
+    QByteArray downSampled;
+    downSampled.resize(maxDestinationBytes);
 
-        int numDestinationFrames = resampler.render((int16_t*)rawAudioByteArray.data(), 
-                                                    (int16_t*)_byteArray.data(), 
-                                                    numSourceFrames);
+    int numDestinationFrames = resampler.render((int16_t*)rawAudioByteArray.data(),
+                                                (int16_t*)downSampled.data(),
+                                                numSourceFrames);
 
-        // truncate to actual output
-        int numDestinationBytes = numDestinationFrames * numChannels * sizeof(AudioConstants::AudioSample);
-        _byteArray.resize(numDestinationBytes);
-    }
+    // truncate to actual output
+    int numDestinationBytes = numDestinationFrames * numChannels * sizeof(AudioConstants::AudioSample);
+    downSampled.resize(numDestinationBytes);
+    return downSampled;
 }
 
 //
@@ -163,7 +285,8 @@ struct WAVEFormat {
 };
 
 // returns wavfile sample rate, used for resampling
-int Sound::interpretAsWav(const QByteArray& inputAudioByteArray, QByteArray& outputAudioByteArray) {
+static int interpretAsWav(const QByteArray& inputAudioByteArray, QByteArray& outputAudioByteArray,
+                          bool& isStereo, bool& isAmbisonic, float& duration) {
 
     // Create a data stream to analyze the data
     QDataStream waveStream(const_cast<QByteArray *>(&inputAudioByteArray), QIODevice::ReadOnly);
@@ -214,9 +337,9 @@ int Sound::interpretAsWav(const QByteArray& inputAudioByteArray, QByteArray& out
         return 0;
     }
     if (qFromLittleEndian<quint16>(wave.numChannels) == 2) {
-        _isStereo = true;
+        isStereo = true;
     } else if (qFromLittleEndian<quint16>(wave.numChannels) == 4) {
-        _isAmbisonic = true;
+        isAmbisonic = true;
     } else if (qFromLittleEndian<quint16>(wave.numChannels) != 1) {
         qCDebug(audio) << "Currently not supporting audio files with other than 1/2/4 channels.";
         return 0;
@@ -250,6 +373,6 @@ int Sound::interpretAsWav(const QByteArray& inputAudioByteArray, QByteArray& out
         return 0;
     }
 
-    _duration = (float)(outputAudioByteArraySize / (wave.sampleRate * wave.numChannels * wave.bitsPerSample / 8.0f));
+    duration = (float)(outputAudioByteArraySize / (wave.sampleRate * wave.numChannels * wave.bitsPerSample / 8.0f));
     return wave.sampleRate;
 }
@@ -12,6 +12,9 @@
 #ifndef hifi_Sound_h
 #define hifi_Sound_h
 
+#include <memory>
+
+#include <QtCore/QFile>
 #include <QtCore/QObject>
 #include <QtNetwork/QNetworkReply>
 #include <QtScript/qscriptengine.h>
@@ -32,19 +35,35 @@ public:
  
     const QByteArray& getByteArray() const { return _byteArray; }
 
+    /// Process a downloaded sound (WAV or 48khz raw) into mixer-native samples: signed
+    /// 16-bit, 24khz. The channel flags seed the conversion and are updated from the
+    /// content; duration is filled in for WAV sources. Returns an empty array on failure.
+    /// Static so offline tools can run the exact processing a loading Sound would.
+    static QByteArray processSoundData(const QByteArray& data, const QString& fileName,
+                                       bool& isStereo, bool& isAmbisonic, float& duration);
+
+    /// Write processed samples in the processed-sound file format that loads map at runtime.
+    static bool writeProcessedFile(const QString& path, const QByteArray& sourceData, const QByteArray& samples,
+                                   bool isStereo, bool isAmbisonic, float duration);
+
+    /// The file name (without directory) a processed version of the given source URL is stored
+    /// under, so offline-baked files can land where the runtime cache will look for them.
+    static QString processedFileName(const QUrl& url);
+
 signals:
     void ready();
-    
+
 private:
     QByteArray _byteArray;
+    std::unique_ptr<QFile> _mappedFile; // backs _byteArray when it is a mapped view
     bool _isStereo;
     bool _isAmbisonic;
     bool _isReady;
-    float _duration; // In seconds
-    
-    void downSample(const QByteArray& rawAudioByteArray, int sampleRate);
-    int interpretAsWav(const QByteArray& inputAudioByteArray, QByteArray& outputAudioByteArray);
-    
+    float _duration { 0.0f }; // In seconds
+
+    bool loadFromProcessedCache(const QString& path, const QByteArray& sourceData);
+    void writeProcessedCache(const QString& path, const QByteArray& sourceData);
+
     virtual void downloadFinished(const QByteArray& data) override;
 };
 
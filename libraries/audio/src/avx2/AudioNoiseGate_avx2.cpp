@@ -0,0 +1,95 @@
+//
+//  AudioNoiseGate_avx2.cpp
+//  libraries/audio/src
+//
+//  Created by Ken Cooke on 12/14/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <stdlib.h>
+#include <immintrin.h>  // AVX2
+
+#include "../AudioNoiseGate.h"
+
+#ifndef __AVX2__
+#error Must be compiled with /arch:AVX2 or -mavx2.
+#endif
+
+static inline int32_t horizontalSum(__m256i x) {
+    __m128i t = _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+    t = _mm_add_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2)));
+    t = _mm_add_epi32(t, _mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(t);
+}
+
+void AudioNoiseGate::removeDCAndMeasure_AVX2(int16_t* samples, int numSamples, int16_t dcOffset,
+                                             int32_t gateThreshold, int32_t clipThreshold,
+                                             int32_t& dcSum, int32_t& loudnessSum, int& samplesOverGate, bool& didClip) {
+    __m256i accDc = _mm256_setzero_si256();
+    __m256i accLoudness = _mm256_setzero_si256();
+    __m256i accOverGate = _mm256_setzero_si256();
+    __m256i accClip = _mm256_setzero_si256();
+
+    __m256i vOffset = _mm256_set1_epi16(dcOffset);
+    __m256i vGate = _mm256_set1_epi32(gateThreshold);
+    __m256i vClip = _mm256_set1_epi32(clipThreshold);
+    __m256i ones = _mm256_set1_epi16(1);
+
+    int n = numSamples & ~15;   // SIMD16
+
+    for (int i = 0; i < n; i += 16) {
+
+        __m256i v = _mm256_loadu_si256((__m256i*)&samples[i]);
+
+        // sum the raw samples pairwise into 32-bit lanes
+        accDc = _mm256_add_epi32(accDc, _mm256_madd_epi16(v, ones));
+
+        // subtract the offset in place, with the same int16_t wraparound as the scalar code
+        v = _mm256_sub_epi16(v, vOffset);
+        _mm256_storeu_si256((__m256i*)&samples[i], v);
+
+        // widen to 32-bit before taking magnitudes, so INT16_MIN behaves like std::abs(int)
+        __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+        __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+        lo = _mm256_abs_epi32(lo);
+        hi = _mm256_abs_epi32(hi);
+
+        accLoudness = _mm256_add_epi32(accLoudness, _mm256_add_epi32(lo, hi));
+
+        // compare masks are 0 or -1 per lane, so subtracting them counts the hits
+        accOverGate = _mm256_sub_epi32(accOverGate,
+            _mm256_add_epi32(_mm256_cmpgt_epi32(lo, vGate), _mm256_cmpgt_epi32(hi, vGate)));
+        accClip = _mm256_or_si256(accClip,
+            _mm256_or_si256(_mm256_cmpgt_epi32(lo, vClip), _mm256_cmpgt_epi32(hi, vClip)));
+    }
+
+    int32_t sum = horizontalSum(accDc);
+    int32_t loudness = horizontalSum(accLoudness);
+    int overGate = horizontalSum(accOverGate);
+    bool clipped = !_mm256_testz_si256(accClip, accClip);
+
+    _mm256_zeroupper();
+
+    // residual samples
+    for (int i = n; i < numSamples; i++) {
+        sum += samples[i];
+        samples[i] -= dcOffset;
+
+        int32_t thisSample = abs((int32_t)samples[i]);
+        loudness += thisSample;
+        clipped |= (thisSample > clipThreshold);
+        overGate += (thisSample > gateThreshold) ? 1 : 0;
+    }
+
+    dcSum = sum;
+    loudnessSum = loudness;
+    samplesOverGate = overGate;
+    didClip = clipped;
+}
+
+#endif
@@ -18,6 +18,7 @@
 
 #include <QtCore/QDataStream>
 #include <QtCore/QThread>
+#include <QtCore/QVarLengthArray>
 #include <QtCore/QUuid>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonArray>
@@ -55,6 +56,16 @@ const QString AvatarData::FRAME_NAME = "com.highfidelity.recording.AvatarData";
 static const int TRANSLATION_COMPRESSION_RADIX = 12;
 static const int SENSOR_TO_WORLD_SCALE_RADIX = 10;
 static const float AUDIO_LOUDNESS_SCALE = 1024.0f;
+static const int BLENDSHAPE_COMPRESSION_RADIX = 5;
+
+static int8_t quantizeBlendshapeCoefficient(float coefficient) {
+    const float scale = (float)(1 << BLENDSHAPE_COMPRESSION_RADIX);
+    return (int8_t)glm::clamp((int)glm::round(coefficient * scale), -128, 127);
+}
+
+static float dequantizeBlendshapeCoefficient(int8_t quantized) {
+    return (float)quantized / (float)(1 << BLENDSHAPE_COMPRESSION_RADIX);
+}
 
 #define ASSERT(COND)  do { if (!(COND)) { abort(); } } while(0)
 
@@ -170,6 +181,19 @@ float AvatarData::getDistanceBasedMinTranslationDistance(glm::vec3 viewerPositio
 
 
 // we want to track outbound data in this case...
+bool AvatarData::hasDataChangedSince(quint64 time) const {
+    lazyInitHeadData();
+
+    // face tracker info has no change tracking (see faceTrackerInfoChangedSince),
+    // so avatars with a face tracker always re-encode
+    return hasFaceTracker()
+        || rotationChangedSince(time) || tranlationChangedSince(time)
+        || avatarBoundingBoxChangedSince(time) || avatarScaleChangedSince(time)
+        || lookAtPositionChangedSince(time) || audioLoudnessChangedSince(time)
+        || sensorToWorldMatrixChangedSince(time) || additionalFlagsChangedSince(time)
+        || parentInfoChangedSince(time) || jointDataChangedSince(time);
+}
+
 QByteArray AvatarData::toByteArrayStateful(AvatarDataDetail dataDetail) {
     AvatarDataPacket::HasFlags hasFlagsOut;
     auto lastSentTime = _lastToByteArray;
@@ -457,9 +481,22 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         faceTrackerInfo->numBlendshapeCoefficients = _headData->_blendshapeCoefficients.size();
         destinationBuffer += sizeof(AvatarDataPacket::FaceTrackerInfo);
 
-        // followed by a variable number of float coefficients
-        memcpy(destinationBuffer, _headData->_blendshapeCoefficients.data(), _headData->_blendshapeCoefficients.size() * sizeof(float));
-        destinationBuffer += _headData->_blendshapeCoefficients.size() * sizeof(float);
+        // followed by a bitmask flagging the non-zero coefficients and one quantized
+        // byte per flagged coefficient - an idle face compresses down to just the mask
+        // instead of a full float per blendshape
+        const auto& blendshapeCoefficients = _headData->_blendshapeCoefficients;
+        int numCoefficients = blendshapeCoefficients.size();
+        unsigned char* validityPosition = destinationBuffer;
+        int numValidityBytes = (numCoefficients + (BITS_IN_BYTE - 1)) / BITS_IN_BYTE;
+        memset(validityPosition, 0, numValidityBytes);
+        destinationBuffer += numValidityBytes;
+        for (int i = 0; i < numCoefficients; i++) {
+            int8_t quantized = quantizeBlendshapeCoefficient(blendshapeCoefficients[i]);
+            if (quantized != 0) {
+                validityPosition[i / BITS_IN_BYTE] |= (1 << (i % BITS_IN_BYTE));
+                *destinationBuffer++ = (uint8_t)quantized;
+            }
+        }
 
         int numBytes = destinationBuffer - startSection;
         if (outboundDataRateOut) {
@@ -523,15 +560,19 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         validityBit = 0;
         validity = *validityPosition++;
-        for (int i = 0; i < _jointData.size(); i++) {
-            const JointData& data = _jointData[i];
-            if (validity & (1 << validityBit)) {
-                destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
-            }
-            if (++validityBit == BITS_IN_BYTE) {
-                validityBit = 0;
-                validity = *validityPosition++;
+        {
+            // stage the valid rotations contiguously so they quantize in one batched pass
+            QVarLengthArray<glm::quat, 128> rotations;
+            for (int i = 0; i < _jointData.size(); i++) {
+                if (validity & (1 << validityBit)) {
+                    rotations.append(_jointData[i].rotation);
+                }
+                if (++validityBit == BITS_IN_BYTE) {
+                    validityBit = 0;
+                    validity = *validityPosition++;
+                }
             }
+            destinationBuffer += packOrientationQuatsToSixBytes(destinationBuffer, rotations.constData(), rotations.size());
         }
 
 
@@ -966,11 +1007,28 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         _headData->_browAudioLift = faceTrackerInfo->browAudioLift;
 
         int numCoefficients = faceTrackerInfo->numBlendshapeCoefficients;
-        const int coefficientsSize = sizeof(float) * numCoefficients;
-        PACKET_READ_CHECK(FaceTrackerCoefficients, coefficientsSize);
+        const int numValidityBytes = (numCoefficients + (BITS_IN_BYTE - 1)) / BITS_IN_BYTE;
+        PACKET_READ_CHECK(FaceTrackerValidityBits, numValidityBytes);
+        const unsigned char* validityBits = sourceBuffer;
+        sourceBuffer += numValidityBytes;
+
+        int numValidCoefficients = 0;
+        for (int i = 0; i < numCoefficients; i++) {
+            if (validityBits[i / BITS_IN_BYTE] & (1 << (i % BITS_IN_BYTE))) {
+                ++numValidCoefficients;
+            }
+        }
+        PACKET_READ_CHECK(FaceTrackerCoefficients, numValidCoefficients);
+
         _headData->_blendshapeCoefficients.resize(numCoefficients);  // make sure there's room for the copy!
-        memcpy(_headData->_blendshapeCoefficients.data(), sourceBuffer, coefficientsSize);
-        sourceBuffer += coefficientsSize;
+        for (int i = 0; i < numCoefficients; i++) {
+            if (validityBits[i / BITS_IN_BYTE] & (1 << (i % BITS_IN_BYTE))) {
+                _headData->_blendshapeCoefficients[i] = dequantizeBlendshapeCoefficient((int8_t)*sourceBuffer++);
+            } else {
+                // coefficients outside the mask quantized to zero on the sender
+                _headData->_blendshapeCoefficients[i] = 0.0f;
+            }
+        }
         int numBytesRead = sourceBuffer - startSection;
         _faceTrackerRate.increment(numBytesRead);
         _faceTrackerUpdateRate.increment();
@@ -979,103 +1037,211 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     if (hasJointData) {
         auto startSection = sourceBuffer;
 
-        PACKET_READ_CHECK(NumJoints, sizeof(uint8_t));
-        int numJoints = *sourceBuffer++;
-        const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
-        PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
-
-        int numValidJointRotations = 0;
-        QVector<bool> validRotations;
-        validRotations.resize(numJoints);
-        { // rotation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointRotations;
-                }
-                validRotations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
+        if (_deferJointDataParse) {
+            // measure the section without unpacking it and stash the newest copy -
+            // parseDeferredJointData runs the real unpack only when this avatar passes the
+            // view and animation rate checks, so avatars behind the camera never pay for
+            // the per-joint quaternion math and superseded payloads are never parsed
+            const unsigned char* sectionEnd = skimJointDataFromBuffer(sourceBuffer, endPosition, now);
+            if (!sectionEnd) {
+                return buffer.size();
+            }
+            {
+                QWriteLocker writeLock(&_jointDataLock);
+                _deferredJointDataBuffer = QByteArray(reinterpret_cast<const char*>(sourceBuffer),
+                                                      (int)(sectionEnd - sourceBuffer));
+            }
+            sourceBuffer = sectionEnd;
+        } else {
+            sourceBuffer = unpackJointDataFromBuffer(sourceBuffer, endPosition, now);
+            if (!sourceBuffer) {
+                return buffer.size();
             }
         }
 
-        // each joint rotation is stored in 6 bytes.
-        QWriteLocker writeLock(&_jointDataLock);
-        _jointData.resize(numJoints);
+        int numBytesRead = sourceBuffer - startSection;
+        _jointDataRate.increment(numBytesRead);
+        _jointDataUpdateRate.increment();
+    }
+
+    int numBytesRead = sourceBuffer - startPosition;
+    _averageBytesReceived.updateAverage(numBytesRead);
+
+    _parseBufferRate.increment(numBytesRead);
+    _parseBufferUpdateRate.increment();
+
+    return numBytesRead;
+}
+
+// like PACKET_READ_CHECK, but for the helpers below that signal a malformed section by
+// returning nullptr rather than consuming the rest of the buffer themselves
+#define JOINT_PACKET_READ_CHECK(ITEM_NAME, SIZE_TO_READ)                                  \
+    if ((endPosition - sourceBuffer) < (int)SIZE_TO_READ) {                               \
+        if (shouldLogError(now)) {                                                        \
+            qCWarning(avatars) << "AvatarData packet too small, attempting to read " <<   \
+                #ITEM_NAME << ", only " << (endPosition - sourceBuffer) <<                \
+                " bytes left, " << getSessionUUID();                                      \
+        }                                                                                 \
+        return nullptr;                                                                   \
+    }
+
+const unsigned char* AvatarData::unpackJointDataFromBuffer(const unsigned char* sourceBuffer,
+                                                           const unsigned char* endPosition, quint64 now) {
+    JOINT_PACKET_READ_CHECK(NumJoints, sizeof(uint8_t));
+    int numJoints = *sourceBuffer++;
+    const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
+    JOINT_PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
 
-        const int COMPRESSED_QUATERNION_SIZE = 6;
-        PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
+    int numValidJointRotations = 0;
+    QVector<bool> validRotations;
+    validRotations.resize(numJoints);
+    { // rotation validity bits
+        unsigned char validity = 0;
+        int validityBit = 0;
         for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validRotations[i]) {
-                sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
-                _hasNewJointData = true;
-                data.rotationSet = true;
+            if (validityBit == 0) {
+                validity = *sourceBuffer++;
             }
+            bool valid = (bool)(validity & (1 << validityBit));
+            if (valid) {
+                ++numValidJointRotations;
+            }
+            validRotations[i] = valid;
+            validityBit = (validityBit + 1) % BITS_IN_BYTE;
         }
+    }
 
-        PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
-
-        // get translation validity bits -- these indicate which translations were packed
-        int numValidJointTranslations = 0;
-        QVector<bool> validTranslations;
-        validTranslations.resize(numJoints);
-        { // translation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointTranslations;
-                }
-                validTranslations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
-            }
-        } // 1 + bytesOfValidity bytes
+    // each joint rotation is stored in 6 bytes.
+    QWriteLocker writeLock(&_jointDataLock);
+    _jointData.resize(numJoints);
+
+    const int COMPRESSED_QUATERNION_SIZE = 6;
+    JOINT_PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
+    for (int i = 0; i < numJoints; i++) {
+        JointData& data = _jointData[i];
+        if (validRotations[i]) {
+            sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
+            _hasNewJointData = true;
+            data.rotationSet = true;
+        }
+    }
 
-        // each joint translation component is stored in 6 bytes.
-        const int COMPRESSED_TRANSLATION_SIZE = 6;
-        PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
+    JOINT_PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
 
+    // get translation validity bits -- these indicate which translations were packed
+    int numValidJointTranslations = 0;
+    QVector<bool> validTranslations;
+    validTranslations.resize(numJoints);
+    { // translation validity bits
+        unsigned char validity = 0;
+        int validityBit = 0;
         for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validTranslations[i]) {
-                sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
-                _hasNewJointData = true;
-                data.translationSet = true;
+            if (validityBit == 0) {
+                validity = *sourceBuffer++;
+            }
+            bool valid = (bool)(validity & (1 << validityBit));
+            if (valid) {
+                ++numValidJointTranslations;
             }
+            validTranslations[i] = valid;
+            validityBit = (validityBit + 1) % BITS_IN_BYTE;
         }
+    } // 1 + bytesOfValidity bytes
 
-#ifdef WANT_DEBUG
-        if (numValidJointRotations > 15) {
-            qCDebug(avatars) << "RECEIVING -- rotations:" << numValidJointRotations
-                << "translations:" << numValidJointTranslations
-                << "size:" << (int)(sourceBuffer - startPosition);
+    // each joint translation component is stored in 6 bytes.
+    const int COMPRESSED_TRANSLATION_SIZE = 6;
+    JOINT_PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
+
+    for (int i = 0; i < numJoints; i++) {
+        JointData& data = _jointData[i];
+        if (validTranslations[i]) {
+            sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
+            _hasNewJointData = true;
+            data.translationSet = true;
         }
+    }
+
+    if (numValidJointRotations > 0 || numValidJointTranslations > 0) {
+        _jointDataChanged = usecTimestampNow();
+    }
+
+#ifdef WANT_DEBUG
+    if (numValidJointRotations > 15) {
+        qCDebug(avatars) << "RECEIVING -- rotations:" << numValidJointRotations
+            << "translations:" << numValidJointTranslations;
+    }
 #endif
-        // faux joints
-        sourceBuffer = unpackFauxJoint(sourceBuffer, _controllerLeftHandMatrixCache);
-        sourceBuffer = unpackFauxJoint(sourceBuffer, _controllerRightHandMatrixCache);
+    // faux joints
+    sourceBuffer = unpackFauxJoint(sourceBuffer, _controllerLeftHandMatrixCache);
+    sourceBuffer = unpackFauxJoint(sourceBuffer, _controllerRightHandMatrixCache);
 
-        int numBytesRead = sourceBuffer - startSection;
-        _jointDataRate.increment(numBytesRead);
-        _jointDataUpdateRate.increment();
+    return sourceBuffer;
+}
+
+const unsigned char* AvatarData::skimJointDataFromBuffer(const unsigned char* sourceBuffer,
+                                                         const unsigned char* endPosition, quint64 now) {
+    JOINT_PACKET_READ_CHECK(NumJoints, sizeof(uint8_t));
+    int numJoints = *sourceBuffer++;
+    const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
+
+    // count the validity bits to find how many rotations and translations were packed,
+    // without touching the packed values themselves
+    auto countValidityBits = [](const unsigned char* validityBits, int numBytes) {
+        int count = 0;
+        for (int i = 0; i < numBytes; i++) {
+            unsigned char validity = validityBits[i];
+            while (validity) {
+                count += validity & 1;
+                validity >>= 1;
+            }
+        }
+        return count;
+    };
+
+    JOINT_PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
+    int numValidJointRotations = countValidityBits(sourceBuffer, bytesOfValidity);
+    sourceBuffer += bytesOfValidity;
+
+    const int COMPRESSED_QUATERNION_SIZE = 6;
+    JOINT_PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
+    sourceBuffer += numValidJointRotations * COMPRESSED_QUATERNION_SIZE;
+
+    JOINT_PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
+    int numValidJointTranslations = countValidityBits(sourceBuffer, bytesOfValidity);
+    sourceBuffer += bytesOfValidity;
+
+    const int COMPRESSED_TRANSLATION_SIZE = 6;
+    JOINT_PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
+    sourceBuffer += numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE;
+
+    // two faux joints, each a six byte rotation and a six byte translation
+    const int FAUX_JOINTS_SIZE = 2 * (COMPRESSED_QUATERNION_SIZE + COMPRESSED_TRANSLATION_SIZE);
+    JOINT_PACKET_READ_CHECK(FauxJoints, FAUX_JOINTS_SIZE);
+    sourceBuffer += FAUX_JOINTS_SIZE;
+
+    if (numValidJointRotations > 0 || numValidJointTranslations > 0) {
+        // the deferred payload carries joint changes - keep this avatar in the
+        // animation update rotation even though nothing is unpacked yet
+        _hasNewJointData = true;
     }
 
-    int numBytesRead = sourceBuffer - startPosition;
-    _averageBytesReceived.updateAverage(numBytesRead);
+    return sourceBuffer;
+}
 
-    _parseBufferRate.increment(numBytesRead);
-    _parseBufferUpdateRate.increment();
+void AvatarData::parseDeferredJointData() {
+    QByteArray buffer;
+    {
+        QWriteLocker writeLock(&_jointDataLock);
+        if (_deferredJointDataBuffer.isEmpty()) {
+            return;
+        }
+        buffer.swap(_deferredJointDataBuffer);
+    }
 
-    return numBytesRead;
+    quint64 now = usecTimestampNow();
+    auto sourceBuffer = reinterpret_cast<const unsigned char*>(buffer.data());
+    auto endPosition = sourceBuffer + buffer.size();
+    unpackJointDataFromBuffer(sourceBuffer, endPosition, now);
 }
 
 float AvatarData::getDataRate(const QString& rateName) const {
@@ -1183,6 +1349,7 @@ void AvatarData::setRawJointData(QVector<JointData> data) {
     }
     QWriteLocker writeLock(&_jointDataLock);
     _jointData = data;
+    _jointDataChanged = usecTimestampNow();
 }
 
 void AvatarData::setJointData(int index, const glm::quat& rotation, const glm::vec3& translation) {
@@ -1202,6 +1369,7 @@ void AvatarData::setJointData(int index, const glm::quat& rotation, const glm::v
     data.rotationSet = true;
     data.translation = translation;
     data.translationSet = true;
+    _jointDataChanged = usecTimestampNow();
 }
 
 void AvatarData::clearJointData(int index) {
@@ -1312,6 +1480,7 @@ void AvatarData::setJointRotation(int index, const glm::quat& rotation) {
     JointData& data = _jointData[index];
     data.rotation = rotation;
     data.rotationSet = true;
+    _jointDataChanged = usecTimestampNow();
 }
 
 void AvatarData::setJointTranslation(int index, const glm::vec3& translation) {
@@ -1329,6 +1498,7 @@ void AvatarData::setJointTranslation(int index, const glm::vec3& translation) {
     JointData& data = _jointData[index];
     data.translation = translation;
     data.translationSet = true;
+    _jointDataChanged = usecTimestampNow();
 }
 
 void AvatarData::clearJointData(const QString& name) {
@@ -1375,6 +1545,22 @@ QVector<glm::quat> AvatarData::getJointRotations() const {
     return jointRotations;
 }
 
+QVector<glm::vec3> AvatarData::getJointTranslations() const {
+    if (QThread::currentThread() != thread()) {
+        QVector<glm::vec3> result;
+        QMetaObject::invokeMethod(const_cast<AvatarData*>(this),
+                                  "getJointTranslations", Qt::BlockingQueuedConnection,
+                                  Q_RETURN_ARG(QVector<glm::vec3>, result));
+        return result;
+    }
+    QReadLocker readLock(&_jointDataLock);
+    QVector<glm::vec3> jointTranslations(_jointData.size());
+    for (int i = 0; i < _jointData.size(); ++i) {
+        jointTranslations[i] = _jointData[i].translation;
+    }
+    return jointTranslations;
+}
+
 void AvatarData::setJointRotations(QVector<glm::quat> jointRotations) {
     if (QThread::currentThread() != thread()) {
         QVector<glm::quat> result;
@@ -1450,6 +1636,17 @@ int AvatarData::getJointIndex(const QString& name) const {
     return _jointIndices.value(name) - 1;
 }
 
+QVector<int> AvatarData::getJointIndices(const QStringList& names) const {
+    QVector<int> result;
+    result.reserve(names.size());
+    QReadLocker readLock(&_jointDataLock);
+    foreach (const QString& name, names) {
+        int index = getFauxJointIndex(name);
+        result.append(index != -1 ? index : _jointIndices.value(name) - 1);
+    }
+    return result;
+}
+
 QStringList AvatarData::getJointNames() const {
     QReadLocker readLock(&_jointDataLock);
     return _jointNames;
@@ -225,7 +225,8 @@ namespace AvatarDataPacket {
         float averageLoudness;
         float browAudioLift;
         uint8_t numBlendshapeCoefficients;
-        // float blendshapeCoefficients[numBlendshapeCoefficients];
+        // uint8_t validityBits[ceil(numBlendshapeCoefficients / 8)]; // one bit per coefficient, set if non-zero
+        // int8_t blendshapeCoefficients[numNonZeroCoefficients];     // 8-bit fixed point (BLENDSHAPE_COMPRESSION_RADIX)
     } PACKED_END;
     const size_t FACE_TRACKER_INFO_SIZE = 17;
 
@@ -391,6 +392,10 @@ public:
 
     virtual void doneEncoding(bool cullSmallChanges);
 
+    // whether any part of the delta protocol besides the always-sent global position has
+    // changed since time; lets the avatar-mixer skip re-encoding static avatars per receiver
+    bool hasDataChangedSince(quint64 time) const;
+
     /// \return true if an error should be logged
     bool shouldLogError(const quint64& now);
 
@@ -399,6 +404,13 @@ public:
     /// \return number of bytes parsed
     virtual int parseDataFromBuffer(const QByteArray& buffer);
 
+    /// When deferred joint parsing is enabled, parseDataFromBuffer stores the newest joint
+    /// data section raw instead of unpacking it, and parseDeferredJointData runs the real
+    /// unpack on demand - so avatars that fail the view and animation rate checks this frame
+    /// never pay for the per-joint quaternion math, and stale payloads are never parsed.
+    void setDeferJointDataParse(bool defer) { _deferJointDataParse = defer; }
+    void parseDeferredJointData();
+
     // Body Rotation (degrees)
     float getBodyYaw() const;
     void setBodyYaw(float bodyYaw);
@@ -492,9 +504,16 @@ public:
 
     Q_INVOKABLE virtual void clearJointsData();
 
+    Q_INVOKABLE virtual QVector<glm::vec3> getJointTranslations() const;
+
     /// Returns the index of the joint with the specified name, or -1 if not found/unknown.
     Q_INVOKABLE virtual int getJointIndex(const QString& name) const;
 
+    /// Resolves a batch of joint names to indices in one call (one cross-thread hop instead of
+    /// one per name); scripts should resolve their names once and re-resolve when the skeleton
+    /// changes, rather than passing names to the per-joint setters every frame.
+    Q_INVOKABLE virtual QVector<int> getJointIndices(const QStringList& names) const;
+
     Q_INVOKABLE virtual QStringList getJointNames() const;
 
     Q_INVOKABLE void setBlendshape(QString name, float val) { _headData->setBlendshape(name, val); }
@@ -644,6 +663,7 @@ protected:
     bool additionalFlagsChangedSince(quint64 time) const { return _additionalFlagsChanged >= time; }
     bool parentInfoChangedSince(quint64 time) const { return _parentChanged >= time; }
     bool faceTrackerInfoChangedSince(quint64 time) const { return true; } // FIXME
+    bool jointDataChangedSince(quint64 time) const { return _jointDataChanged >= time; }
 
     bool hasParent() const { return !getParentID().isNull(); }
     bool hasFaceTracker() const { return _headData ? _headData->_isFaceTrackerConnected : false; }
@@ -660,10 +680,20 @@ protected:
     //  Hand state (are we grabbing something or not)
     char _handState;
 
+    // unpacks or measures the joint data section of a parsed buffer; both return the
+    // advanced source pointer, or nullptr if the section is malformed
+    const unsigned char* unpackJointDataFromBuffer(const unsigned char* sourceBuffer,
+                                                   const unsigned char* endPosition, quint64 now);
+    const unsigned char* skimJointDataFromBuffer(const unsigned char* sourceBuffer,
+                                                 const unsigned char* endPosition, quint64 now);
+
     QVector<JointData> _jointData; ///< the state of the skeleton joints
     QVector<JointData> _lastSentJointData; ///< the state of the skeleton joints last time we transmitted
     mutable QReadWriteLock _jointDataLock;
 
+    bool _deferJointDataParse { false };
+    QByteArray _deferredJointDataBuffer; // newest unparsed joint data section, guarded by _jointDataLock
+
     // key state
     KeyState _keyState;
 
@@ -713,6 +743,7 @@ protected:
     quint64 _sensorToWorldMatrixChanged { 0 };
     quint64 _additionalFlagsChanged { 0 };
     quint64 _parentChanged { 0 };
+    quint64 _jointDataChanged { 0 };
 
     quint64  _lastToByteArray { 0 }; // tracks the last time we did a toByteArray
 
@@ -100,6 +100,14 @@ AvatarSharedPointer AvatarHashMap::findAvatar(const QUuid& sessionUUID) const {
 
 void AvatarHashMap::processAvatarDataPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
     PerformanceTimer perfTimer("receiveAvatar");
+
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // take the hash lock once for the whole packet instead of once per enclosed avatar -
+    // a BulkAvatarData packet can carry dozens of avatars and the per-avatar locking in
+    // newOrExistingAvatar shows up in main loop profiles on crowded domains
+    QWriteLocker locker(&_hashLock);
+
     // enumerate over all of the avatars in this packet
     // only add them if mixerWeakPointer points to something (meaning that mixer is still around)
     while (message->getBytesLeftToRead()) {
@@ -110,18 +118,20 @@ void AvatarHashMap::processAvatarDataPacket(QSharedPointer<ReceivedMessage> mess
         QByteArray byteArray = message->readWithoutCopy(message->getBytesLeftToRead());
 
         // make sure this isn't our own avatar data or for a previously ignored node
-        auto nodeList = DependencyManager::get<NodeList>();
-
         if (sessionUUID != _lastOwnerSessionUUID && (!nodeList->isIgnoringNode(sessionUUID) || nodeList->getRequestsDomainListData())) {
-            auto avatar = newOrExistingAvatar(sessionUUID, sendingNode);
+            auto avatar = _avatarHash.value(sessionUUID);
+            if (!avatar) {
+                avatar = addAvatar(sessionUUID, sendingNode);
+            }
 
             // have the matching (or new) avatar parse the data from the packet
             int bytesRead = avatar->parseDataFromBuffer(byteArray);
             message->seek(positionBeforeRead + bytesRead);
         } else {
-            // create a dummy AvatarData class to throw this data on the ground
-            AvatarData dummyData;
-            int bytesRead = dummyData.parseDataFromBuffer(byteArray);
+            // parse the data into a pooled AvatarData to throw it on the ground,
+            // rather than constructing (and heap-allocating joint state for) a
+            // fresh dummy per discarded avatar per packet
+            int bytesRead = _discardedAvatarData.parseDataFromBuffer(byteArray);
             message->seek(positionBeforeRead + bytesRead);
         }
     }
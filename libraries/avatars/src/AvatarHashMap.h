@@ -76,6 +76,10 @@ protected:
 
 private:
     QUuid _lastOwnerSessionUUID;
+
+    // reused across packets to absorb data for ignored avatars without
+    // allocating a throwaway AvatarData per update
+    AvatarData _discardedAvatarData;
 };
 
 #endif // hifi_AvatarHashMap_h
@@ -8,6 +8,7 @@
 
 #include "UserInputMapper.h"
 
+#include <algorithm>
 #include <set>
 
 #include <QtCore/QThread>
@@ -93,6 +94,7 @@ void UserInputMapper::registerDevice(InputDevice::Pointer device) {
     }
 
     _registeredDevices[deviceID] = device;
+    _routePlanDirty = true;
 
     auto mapping = loadMappings(device->getDefaultMappingConfigs());
     if (mapping) {
@@ -134,6 +136,7 @@ void UserInputMapper::removeDevice(int deviceID) {
     }
 
     _registeredDevices.erase(proxyEntry);
+    _routePlanDirty = true;
 
     emit hardwareChanged();
 }
@@ -281,17 +284,18 @@ void UserInputMapper::update(float deltaTime) {
         // TODO: emit signal for pose changes
     }
 
-    auto standardInputs = getStandardInputs();
-    if ((int)_lastStandardStates.size() != standardInputs.size()) {
-        _lastStandardStates.resize(standardInputs.size());
+    // _standardInputPlan pairs each standard input with its endpoint, so this doesn't
+    // rebuild the named input list or do an endpoint lookup per input per frame
+    if (_lastStandardStates.size() != _standardInputPlan.size()) {
+        _lastStandardStates.resize(_standardInputPlan.size());
         for (auto& lastValue : _lastStandardStates) {
             lastValue = 0;
         }
     }
 
-    for (int i = 0; i < standardInputs.size(); ++i) {
-        const auto& input = standardInputs[i].first;
-        float value = getValue(input);
+    for (size_t i = 0; i < _standardInputPlan.size(); ++i) {
+        const auto& input = _standardInputPlan[i].first;
+        float value = _standardInputPlan[i].second->value();
         float& oldValue = _lastStandardStates[i];
         if (value != oldValue) {
             oldValue = value;
@@ -455,20 +459,19 @@ void UserInputMapper::runMappings() {
     if (debugRoutes) {
         qCDebug(controllers) << "Beginning mapping frame";
     }
-    for (auto endpointEntry : this->_endpointsByInput) {
-        endpointEntry.second->reset();
+
+    if (_routePlanDirty) {
+        rebuildRoutePlan();
     }
 
-    if (debugRoutes) {
-        qCDebug(controllers) << "Processing device routes";
+    for (const auto& endpoint : _resetPlan) {
+        endpoint->reset();
     }
-    // Now process the current values for each level of the stack
-    applyRoutes(_deviceRoutes);
 
     if (debugRoutes) {
-        qCDebug(controllers) << "Processing standard routes";
+        qCDebug(controllers) << "Processing routes";
     }
-    applyRoutes(_standardRoutes);
+    applyRoutePlan();
 
     if (debugRoutes) {
         qCDebug(controllers) << "Done with mappings";
@@ -476,22 +479,60 @@ void UserInputMapper::runMappings() {
     debugRoutes = false;
 }
 
-// Encapsulate the logic that routes should not be read before they are written
-void UserInputMapper::applyRoutes(const Route::List& routes) {
-    Route::List deferredRoutes;
+void UserInputMapper::rebuildRoutePlan() {
+    _routePlan.clear();
+    _routePlan.reserve(_deviceRoutes.size() + _standardRoutes.size());
+    // Device routes run before standard routes, so the hardware -> standard writes have
+    // all happened by the time the standard -> action routes read them
+    auto compile = [this](const Route::List& routes) {
+        for (const auto& route : routes) {
+            if (!route || !route->source || !route->destination) {
+                continue;
+            }
+            CompiledRoute entry;
+            entry.route = route;
+            entry.deferrable = (route->source->getInput().device == STANDARD_DEVICE);
+            _routePlan.push_back(entry);
+        }
+    };
+    compile(_deviceRoutes);
+    compile(_standardRoutes);
 
-    for (const auto& route : routes) {
-        if (!route) {
-            continue;
+    _resetPlan.clear();
+    _resetPlan.reserve(_endpointsByInput.size());
+    for (const auto& endpointEntry : _endpointsByInput) {
+        _resetPlan.push_back(endpointEntry.second);
+    }
+
+    _standardInputPlan.clear();
+    for (const auto& inputPair : getStandardInputs()) {
+        auto endpointEntry = _endpointsByInput.find(inputPair.first);
+        if (endpointEntry != _endpointsByInput.end()) {
+            _standardInputPlan.emplace_back(inputPair.first, endpointEntry->second);
         }
+    }
+
+    _routePlanDirty = false;
+}
 
-        // Try all the deferred routes
-        deferredRoutes.remove_if([](Route::Pointer route) {
-            return UserInputMapper::applyRoute(route);
-        });
+// Encapsulate the logic that routes should not be read before they are written
+void UserInputMapper::applyRoutePlan() {
+    std::vector<Route::Pointer> deferredRoutes;
+
+    for (const auto& entry : _routePlan) {
+        // Try all the deferred routes, their sources may have been written by now
+        if (!deferredRoutes.empty()) {
+            deferredRoutes.erase(std::remove_if(deferredRoutes.begin(), deferredRoutes.end(), [](const Route::Pointer& route) {
+                return UserInputMapper::applyRoute(route);
+            }), deferredRoutes.end());
+        }
 
-        if (!applyRoute(route)) {
-            deferredRoutes.push_back(route);
+        if (entry.deferrable) {
+            if (!applyRoute(entry.route)) {
+                deferredRoutes.push_back(entry.route);
+            }
+        } else {
+            applyRoute(entry.route);
         }
     }
 
@@ -1163,6 +1204,7 @@ void UserInputMapper::enableMapping(const Mapping::Pointer& mapping) {
         return (value->source->getInput().device == STANDARD_DEVICE);
     });
     _deviceRoutes.insert(_deviceRoutes.begin(), deviceRoutes.begin(), deviceRoutes.end());
+    _routePlanDirty = true;
 
     if (!debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
@@ -1179,6 +1221,7 @@ void UserInputMapper::disableMapping(const Mapping::Pointer& mapping) {
     _standardRoutes.remove_if([&](const Route::Pointer& value) {
         return routeSet.count(value) != 0;
     });
+    _routePlanDirty = true;
 
     if (debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
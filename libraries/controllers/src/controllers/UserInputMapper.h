@@ -151,7 +151,16 @@ namespace controller {
 
         void runMappings();
 
-        static void applyRoutes(const RouteList& route);
+        // The route lists are compiled into a flat execution plan whenever mappings or
+        // devices change, so the per-frame work is a single pass over contiguous arrays
+        // instead of linked-list walks and map lookups.
+        struct CompiledRoute {
+            RoutePointer route;
+            bool deferrable { false }; // source is a standard endpoint and may not be written yet
+        };
+        void rebuildRoutePlan();
+        void applyRoutePlan();
+
         static bool applyRoute(const RoutePointer& route, bool force = false);
         void enableMapping(const MappingPointer& mapping);
         void disableMapping(const MappingPointer& mapping);
@@ -185,6 +194,11 @@ namespace controller {
         RouteList _deviceRoutes;
         RouteList _standardRoutes;
 
+        std::vector<CompiledRoute> _routePlan;
+        std::vector<EndpointPointer> _resetPlan;
+        std::vector<std::pair<Input, EndpointPointer>> _standardInputPlan;
+        bool _routePlanDirty { true };
+
         QSet<QString> _loadedRouteJsonFiles;
 
         mutable std::recursive_mutex _lock;
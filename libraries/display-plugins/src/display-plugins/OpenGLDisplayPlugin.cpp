@@ -632,6 +632,12 @@ void OpenGLDisplayPlugin::present() {
             compositeLayers();
         }
 
+        // Issue any pending asynchronous captures of the fresh composite
+        {
+            PROFILE_RANGE_EX(render, "screenshot", 0xff00ffff, frameId)
+            processScreenshotRequests();
+        }
+
         // Take the composite framebuffer and send it to the output device
         {
             PROFILE_RANGE_EX(render, "internalPresent", 0xff00ffff, frameId)
@@ -675,7 +681,7 @@ void OpenGLDisplayPlugin::withMainThreadContext(std::function<void()> f) const {
     _container->makeRenderingContextCurrent();
 }
 
-QImage OpenGLDisplayPlugin::getScreenshot(float aspectRatio) const {
+ivec4 OpenGLDisplayPlugin::screenshotRegion(float aspectRatio) const {
     auto size = _compositeFramebuffer->getSize();
     if (isHmd()) {
         size.x /= 2;
@@ -691,14 +697,42 @@ QImage OpenGLDisplayPlugin::getScreenshot(float aspectRatio) const {
         corner.x = round((size.x - bestSize.x) / 2.0f);
         corner.y = round((size.y - bestSize.y) / 2.0f);
     }
+    return ivec4(corner, bestSize);
+}
+
+QImage OpenGLDisplayPlugin::getScreenshot(float aspectRatio) const {
+    auto region = screenshotRegion(aspectRatio);
     auto glBackend = const_cast<OpenGLDisplayPlugin&>(*this).getGLBackend();
-    QImage screenshot(bestSize.x, bestSize.y, QImage::Format_ARGB32);
+    QImage screenshot(region.z, region.w, QImage::Format_ARGB32);
     withMainThreadContext([&] {
-        glBackend->downloadFramebuffer(_compositeFramebuffer, ivec4(corner, bestSize), screenshot);
+        glBackend->downloadFramebuffer(_compositeFramebuffer, region, screenshot);
     });
     return screenshot.mirrored(false, true);
 }
 
+void OpenGLDisplayPlugin::getScreenshotAsync(float aspectRatio, ScreenshotCallback callback) const {
+    withNonPresentThreadLock([&] {
+        _screenshotRequests.push_back({ aspectRatio, callback });
+    });
+}
+
+void OpenGLDisplayPlugin::processScreenshotRequests() {
+    std::vector<ScreenshotRequest> requests;
+    withPresentThreadLock([&] {
+        requests.swap(_screenshotRequests);
+    });
+    auto glBackend = getGLBackend();
+    for (auto& request : requests) {
+        auto callback = request.callback;
+        glBackend->downloadFramebufferAsync(_compositeFramebuffer, screenshotRegion(request.aspectRatio),
+            [callback](QImage screenshot) {
+                callback(screenshot.mirrored(false, true));
+            });
+    }
+    // harvest whatever readbacks the GPU has finished; callbacks fire on this (the present) thread
+    glBackend->processFramebufferDownloads();
+}
+
 glm::uvec2 OpenGLDisplayPlugin::getSurfacePixels() const {
     uvec2 result;
     auto window = _container->getPrimaryWidget();
@@ -13,6 +13,7 @@
 #include <condition_variable>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
@@ -56,6 +57,7 @@ public:
     }
 
     QImage getScreenshot(float aspectRatio = 0.0f) const override;
+    void getScreenshotAsync(float aspectRatio, ScreenshotCallback callback) const override;
 
     float presentRate() const override;
 
@@ -111,6 +113,11 @@ protected:
     virtual void swapBuffers();
     ivec4 eyeViewport(Eye eye) const;
 
+    // the composite framebuffer region matching the requested aspect ratio
+    ivec4 screenshotRegion(float aspectRatio) const;
+    // issues any queued asynchronous screenshot captures and harvests completed ones
+    void processScreenshotRequests();
+
     void render(std::function<void(gpu::Batch& batch)> f);
 
     bool _vsyncEnabled { true };
@@ -140,6 +147,13 @@ protected:
     std::map<uint16_t, CursorData> _cursorsData;
     bool _lockCurrentTexture { false };
 
+    // asynchronous screenshot requests, queued from any thread and issued on the present thread
+    struct ScreenshotRequest {
+        float aspectRatio;
+        ScreenshotCallback callback;
+    };
+    mutable std::vector<ScreenshotRequest> _screenshotRequests;
+
     void assertNotPresentThread() const;
     void assertIsPresentThread() const;
 
@@ -357,6 +357,12 @@ void HmdDisplayPlugin::updateFrameData() {
     Parent::updateFrameData();
     uint32_t newFrameIndex = _currentFrame ? _currentFrame->frameIndex : INVALID_FRAME;
 
+    if (oldFrameIndex != INVALID_FRAME && oldFrameIndex == newFrameIndex) {
+        // No new frame arrived in time for this present - we're re-presenting the old
+        // one with a late-latched pose correction rather than dropping a vsync
+        _stutterRate.increment();
+    }
+
     if (oldFrameIndex != newFrameIndex) {
         withPresentThreadLock([&] {
             if (oldFrameIndex != INVALID_FRAME) {
@@ -13,14 +13,19 @@
 #include <QBuffer>
 #include <QCryptographicHash>
 #include <QTcpSocket>
+#include <QTimer>
 
 #include "HTTPConnection.h"
 #include "EmbeddedWebserverLogging.h"
 #include "HTTPManager.h"
 
+// how long a keep-alive connection may sit idle between requests before we drop it
+const int KEEP_ALIVE_IDLE_TIMEOUT_MSECS = 20 * 1000;
+
 const char* HTTPConnection::StatusCode200 = "200 OK";
 const char* HTTPConnection::StatusCode301 = "301 Moved Permanently";
 const char* HTTPConnection::StatusCode302 = "302 Found";
+const char* HTTPConnection::StatusCode304 = "304 Not Modified";
 const char* HTTPConnection::StatusCode400 = "400 Bad Request";
 const char* HTTPConnection::StatusCode401 = "401 Unauthorized";
 const char* HTTPConnection::StatusCode403 = "403 Forbidden";
@@ -42,6 +47,13 @@ HTTPConnection::HTTPConnection (QTcpSocket* socket, HTTPManager* parentManager)
     connect(socket, SIGNAL(readyRead()), SLOT(readRequest()));
     connect(socket, SIGNAL(error(QAbstractSocket::SocketError)), SLOT(deleteLater()));
     connect(socket, SIGNAL(disconnected()), SLOT(deleteLater()));
+
+    // if a keep-alive connection goes quiet between requests, tear it down so idle
+    // clients can't pin sockets open forever
+    _idleTimer = new QTimer(this);
+    _idleTimer->setSingleShot(true);
+    connect(_idleTimer, SIGNAL(timeout()), SLOT(deleteLater()));
+    _idleTimer->start(KEEP_ALIVE_IDLE_TIMEOUT_MSECS);
 }
 
 HTTPConnection::~HTTPConnection() {
@@ -109,6 +121,10 @@ QList<FormData> HTTPConnection::parseFormData() const {
 }
 
 void HTTPConnection::respond(const char* code, const QByteArray& content, const char* contentType, const Headers& headers) {
+    // honor the client's keep-alive preference, except after a malformed request
+    // where we may not have consumed the rest of its bytes
+    bool keepAlive = shouldKeepAlive() && qstrncmp(code, "400", 3) != 0;
+
     _socket->write("HTTP/1.1 ");
     _socket->write(code);
     _socket->write("\r\n");
@@ -122,31 +138,77 @@ void HTTPConnection::respond(const char* code, const QByteArray& content, const
         _socket->write(it.value());
         _socket->write("\r\n");
     }
-    if (csize > 0) {
-        _socket->write("Content-Length: ");
-        _socket->write(QByteArray::number(csize));
-        _socket->write("\r\n");
 
+    // a keep-alive client needs the length to frame the response, even when it's empty
+    _socket->write("Content-Length: ");
+    _socket->write(QByteArray::number(csize));
+    _socket->write("\r\n");
+
+    if (csize > 0) {
         _socket->write("Content-Type: ");
         _socket->write(contentType);
         _socket->write("\r\n");
     }
-    _socket->write("Connection: close\r\n\r\n");
+    _socket->write(keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
 
     if (csize > 0) {
         _socket->write(content);
     }
 
-    // make sure we receive no further read notifications
+    if (keepAlive) {
+        // ready this connection for the next request, which may already be buffered (pipelined)
+        resetRequestState();
+    } else {
+        // make sure we receive no further read notifications
+        _socket->disconnect(SIGNAL(readyRead()), this);
+
+        _socket->disconnectFromHost();
+    }
+}
+
+void HTTPConnection::respondAsync(QByteArray code, QByteArray content, QByteArray contentType, Headers headers) {
+    respond(code.constData(), content, contentType.constData(), headers);
+}
+
+bool HTTPConnection::shouldKeepAlive() const {
+    QByteArray connectionHeader = _requestHeaders.value("Connection").toLower();
+
+    if (_requestVersion == "HTTP/1.1") {
+        // HTTP/1.1 connections are persistent unless the client opts out
+        return connectionHeader != "close";
+    }
+
+    return connectionHeader == "keep-alive";
+}
+
+void HTTPConnection::resetRequestState() {
+    _requestOperation = QNetworkAccessManager::UnknownOperation;
+    _requestUrl.clear();
+    _requestHeaders.clear();
+    _lastRequestHeader.clear();
+    _requestContent.clear();
+    _requestVersion.clear();
+
+    // drop whichever read slot was hooked up for the last request and await a new request line
     _socket->disconnect(SIGNAL(readyRead()), this);
+    connect(_socket, SIGNAL(readyRead()), SLOT(readRequest()));
+
+    _idleTimer->start(KEEP_ALIVE_IDLE_TIMEOUT_MSECS);
 
-    _socket->disconnectFromHost();
+    // a pipelining client may have sent its next request already
+    if (_socket->canReadLine()) {
+        readRequest();
+    }
 }
 
 void HTTPConnection::readRequest() {
     if (!_socket->canReadLine()) {
         return;
     }
+
+    // a request is now in flight - the idle timer only covers the gaps between requests
+    _idleTimer->stop();
+
     // parse out the method and resource
     QByteArray line = _socket->readLine().trimmed();
     if (line.startsWith("HEAD")) {
@@ -171,6 +233,7 @@ void HTTPConnection::readRequest() {
     }
     int idx = line.indexOf(' ') + 1;
     _requestUrl.setUrl(line.mid(idx, line.lastIndexOf(' ') - idx));
+    _requestVersion = line.mid(line.lastIndexOf(' ') + 1);
 
     // switch to reading the header
     _socket->disconnect(this, SLOT(readRequest()));
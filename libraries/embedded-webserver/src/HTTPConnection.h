@@ -27,6 +27,7 @@
 #include <QUrl>
 
 class QTcpSocket;
+class QTimer;
 class HTTPManager;
 class MaskFilter;
 class ServerApp;
@@ -45,6 +46,7 @@ public:
     static const char* StatusCode200;
     static const char* StatusCode301;
     static const char* StatusCode302;
+    static const char* StatusCode304;
     static const char* StatusCode400;
     static const char* StatusCode401;
     static const char* StatusCode403;
@@ -79,11 +81,17 @@ public:
     /// Parses the request content as form data, returning a list of header/content pairs.
     QList<FormData> parseFormData () const;
 
-    /// Sends a response and closes the connection.
+    /// Sends a response, then either closes the connection or awaits the next
+    /// request on it, depending on whether the client asked for keep-alive.
     void respond (const char* code, const QByteArray& content = QByteArray(),
         const char* contentType = DefaultContentType,
         const Headers& headers = Headers());
 
+public slots:
+
+    /// Queued-invocation form of respond for responses produced on worker threads.
+    void respondAsync (QByteArray code, QByteArray content, QByteArray contentType, Headers headers);
+
 protected slots:
 
     /// Reads the request line.
@@ -97,6 +105,12 @@ protected slots:
 
 protected:
 
+    /// Returns true if the client asked for this connection to stay open after the response.
+    bool shouldKeepAlive () const;
+
+    /// Clears per-request state and arms the socket for the next request on this connection.
+    void resetRequestState ();
+
     /// The parent HTTP manager
     HTTPManager* _parentManager;
 
@@ -123,6 +137,14 @@ protected:
 
     /// The content of the request.
     QByteArray _requestContent;
+
+    /// The HTTP version from the request line, used to decide the keep-alive default.
+    QByteArray _requestVersion;
+
+    /// Tears down keep-alive connections that sit idle between requests.
+    QTimer* _idleTimer;
 };
 
+Q_DECLARE_METATYPE(Headers)
+
 #endif // hifi_HTTPConnection_h
@@ -17,6 +17,7 @@
 #define hifi_HTTPManager_h
 
 #include <QtNetwork/QTcpServer>
+#include <QtCore/QThreadPool>
 #include <QtCore/QTimer>
 
 class HTTPConnection;
@@ -54,6 +55,9 @@ protected:
     HTTPRequestHandler* _requestHandler;
     QTimer* _isListeningTimer;
     const quint16 _port;
+
+    /// Small pool that performs static file reads off the accept/event thread.
+    QThreadPool _fileTaskPool;
 };
 
 #endif // hifi_HTTPManager_h
@@ -0,0 +1,188 @@
+//
+//  HTTPStaticFileTask.cpp
+//  libraries/embedded-webserver/src
+//
+//  Created by Stephen Birarda on 2016-04-18.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HTTPStaticFileTask.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QLocale>
+#include <QtCore/QMimeDatabase>
+#include <QtCore/QRegExp>
+
+#include "EmbeddedWebserverLogging.h"
+
+HTTPStaticFileTask::HTTPStaticFileTask(HTTPConnection* connection, const QUrl& url, const QString& documentRoot) :
+    _subPath(url.path()),
+    _query(url.query()),
+    _documentRoot(documentRoot),
+    _requestHeaders(connection->requestHeaders())
+{
+    // remove any slash at the beginning of the path
+    if (_subPath.startsWith('/')) {
+        _subPath.remove(0, 1);
+    }
+
+    // we're constructed on the connection's thread - hook up delivery of the finished response
+    // before we're handed to the pool, so it lands back on that thread no matter where run() happens
+    connect(this, &HTTPStaticFileTask::responseReady, connection, &HTTPConnection::respondAsync);
+
+    // the pool would delete us on a worker thread - instead we deleteLater ourselves at the end of run
+    setAutoDelete(false);
+}
+
+static QByteArray httpDateString(const QDateTime& dateTime) {
+    // HTTP dates are RFC 1123 in GMT, always in the C locale regardless of system settings
+    return QLocale::c().toString(dateTime.toUTC(), "ddd, dd MMM yyyy HH:mm:ss").toLatin1() + " GMT";
+}
+
+void HTTPStaticFileTask::run() {
+    QString filePath;
+
+    if (QFileInfo(_documentRoot + _subPath).isFile()) {
+        filePath = _documentRoot + _subPath;
+    } else if (_subPath.size() > 0 && !_subPath.endsWith('/')) {
+        // this could be a directory with a trailing slash
+        // send a redirect to the path with a slash so we can
+        QString redirectLocation = '/' + _subPath + '/';
+
+        if (!_query.isEmpty()) {
+            redirectLocation += "?" + _query;
+        }
+
+        Headers redirectHeader;
+        redirectHeader.insert(QByteArray("Location"), redirectLocation.toUtf8());
+
+        emit responseReady(HTTPConnection::StatusCode301, "", HTTPConnection::DefaultContentType, redirectHeader);
+
+        deleteLater();
+        return;
+    }
+
+    // if the last thing is a trailing slash then we want to look for index file
+    if (_subPath.endsWith('/') || _subPath.size() == 0) {
+        QStringList possibleIndexFiles = QStringList() << "index.html" << "index.shtml";
+
+        foreach (const QString& possibleIndexFilename, possibleIndexFiles) {
+            if (QFileInfo(_documentRoot + _subPath + possibleIndexFilename).exists()) {
+                filePath = _documentRoot + _subPath + possibleIndexFilename;
+                break;
+            }
+        }
+    }
+
+    if (filePath.isEmpty()) {
+        emit responseReady(HTTPConnection::StatusCode404, "Resource not found.", HTTPConnection::DefaultContentType, Headers());
+
+        deleteLater();
+        return;
+    }
+
+    QFileInfo localFileInfo(filePath);
+    bool isSHTML = localFileInfo.completeSuffix() == "shtml";
+
+    Headers responseHeaders;
+
+    if (!isSHTML) {
+        // plain files are immutable between modifications, so hand the client validators and
+        // answer conditional GETs without touching the file contents at all
+        // (shtml output depends on the included files too, so it gets no validators)
+        QByteArray lastModified = httpDateString(localFileInfo.lastModified());
+        QByteArray etag = "\"" + QByteArray::number(localFileInfo.size(), 16) + "-"
+            + QByteArray::number(localFileInfo.lastModified().toMSecsSinceEpoch(), 16) + "\"";
+
+        responseHeaders.insert("ETag", etag);
+        responseHeaders.insert("Last-Modified", lastModified);
+
+        if (_requestHeaders.value("If-None-Match").contains(etag)
+            || _requestHeaders.value("If-Modified-Since") == lastModified) {
+            emit responseReady(HTTPConnection::StatusCode304, "", HTTPConnection::DefaultContentType, responseHeaders);
+
+            deleteLater();
+            return;
+        }
+    }
+
+    QFile localFile(filePath);
+
+    if (!localFile.open(QIODevice::ReadOnly)) {
+        qCDebug(embeddedwebserver) << "Could not open" << filePath << "for reading";
+        emit responseReady(HTTPConnection::StatusCode404, "Resource not found.", HTTPConnection::DefaultContentType, Headers());
+
+        deleteLater();
+        return;
+    }
+
+    // pull the contents through a file mapping where we can - one copy out of the page cache
+    // into the response, instead of buffered reads into a growing QByteArray
+    QByteArray localFileData;
+    uchar* mappedFileData = localFile.map(0, localFile.size());
+
+    if (mappedFileData) {
+        localFileData = QByteArray(reinterpret_cast<const char*>(mappedFileData), localFile.size());
+    } else {
+        localFileData = localFile.readAll();
+    }
+
+    if (isSHTML) {
+        // this is a file that may have some SSI statements
+        // the only thing we support is the include directive, but check the contents for that
+
+        // setup our static QRegExp that will catch <!--#include virtual ... --> and <!--#include file .. --> directives
+        const QString includeRegExpString = "<!--\\s*#include\\s+(virtual|file)\\s?=\\s?\"(\\S+)\"\\s*-->";
+        QRegExp includeRegExp(includeRegExpString);
+
+        int matchPosition = 0;
+
+        QString localFileString(localFileData);
+
+        while ((matchPosition = includeRegExp.indexIn(localFileString, matchPosition)) != -1) {
+            // check if this is a file or vitual include
+            bool isFileInclude = includeRegExp.cap(1) == "file";
+
+            // setup the correct file path for the included file
+            QString includeFilePath = isFileInclude
+            ? localFileInfo.canonicalPath() + "/" + includeRegExp.cap(2)
+            : _documentRoot + includeRegExp.cap(2);
+
+            QString replacementString;
+
+            if (QFileInfo(includeFilePath).isFile()) {
+
+                QFile includedFile(includeFilePath);
+                includedFile.open(QIODevice::ReadOnly);
+
+                replacementString = QString(includedFile.readAll());
+            } else {
+                qCDebug(embeddedwebserver) << "SSI include directive referenced a missing file:" << includeFilePath;
+            }
+
+            // replace the match with the contents of the file, or an empty string if the file was not found
+            localFileString.replace(matchPosition, includeRegExp.matchedLength(), replacementString);
+
+            // push the match position forward so we can check the next match
+            matchPosition += includeRegExp.matchedLength();
+        }
+
+        localFileData = localFileString.toLocal8Bit();
+    }
+
+    // if this is an shtml file just make the MIME type match HTML so browsers aren't confused
+    // otherwise use the mimeDatabase to look it up
+    QMimeDatabase mimeDatabase;
+    auto mimeType = isSHTML
+        ? QString { "text/html" }
+        : mimeDatabase.mimeTypeForFile(filePath).name();
+
+    emit responseReady(HTTPConnection::StatusCode200, localFileData, mimeType.toLocal8Bit(), responseHeaders);
+
+    deleteLater();
+}
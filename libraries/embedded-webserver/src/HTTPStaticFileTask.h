@@ -0,0 +1,43 @@
+//
+//  HTTPStaticFileTask.h
+//  libraries/embedded-webserver/src
+//
+//  Created by Stephen Birarda on 2016-04-18.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_HTTPStaticFileTask_h
+#define hifi_HTTPStaticFileTask_h
+
+#include <QtCore/QObject>
+#include <QtCore/QRunnable>
+#include <QtCore/QString>
+#include <QtCore/QUrl>
+
+#include "HTTPConnection.h"
+
+/// Resolves and reads a static file from the document root on a worker thread, so that disk
+/// stalls never block the HTTP accept loop, then hands the finished response back to the
+/// connection's thread. Handles directory redirects, index files and conditional GETs.
+class HTTPStaticFileTask : public QObject, public QRunnable {
+    Q_OBJECT
+public:
+    HTTPStaticFileTask(HTTPConnection* connection, const QUrl& url, const QString& documentRoot);
+
+    virtual void run() override;
+
+signals:
+    /// Emitted from the worker thread, delivered queued on the connection's thread.
+    void responseReady(QByteArray statusCode, QByteArray content, QByteArray contentType, Headers headers);
+
+private:
+    QString _subPath;
+    QString _query;
+    QString _documentRoot;
+    Headers _requestHeaders;
+};
+
+#endif // hifi_HTTPStaticFileTask_h
@@ -215,15 +215,15 @@ void EntityTreeRenderer::update() {
 
 bool EntityTreeRenderer::findBestZoneAndMaybeContainingEntities(QVector<EntityItemID>* entitiesContainingAvatar) {
     bool didUpdate = false;
-    float radius = 0.01f; // for now, assume 0.01 meter radius, because we actually check the point inside later
     QVector<EntityItemPointer> foundEntities;
 
-    // find the entities near us
+    // find the entities that contain us
     // don't let someone else change our tree while we search
     _tree->withReadLock([&] {
 
-        // FIXME - if EntityTree had a findEntitiesContainingPoint() this could theoretically be a little faster
-        std::static_pointer_cast<EntityTree>(_tree)->findEntities(_avatarPosition, radius, foundEntities);
+        // this only walks the branch of elements containing the avatar's position, so candidates
+        // are limited to entities big enough to straddle that branch rather than everything nearby
+        std::static_pointer_cast<EntityTree>(_tree)->findEntitiesContainingPoint(_avatarPosition, foundEntities);
 
         LayeredZones oldLayeredZones(std::move(_layeredZones));
         _layeredZones.clear();
@@ -540,7 +540,8 @@ void EntityTreeRenderer::processEraseMessage(ReceivedMessage& message, const Sha
     std::static_pointer_cast<EntityTree>(_tree)->processEraseMessage(message, sourceNode);
 }
 
-ModelPointer EntityTreeRenderer::allocateModel(const QString& url, float loadingPriority, SpatiallyNestable* spatiallyNestableOverride) {
+ModelPointer EntityTreeRenderer::allocateModel(const QString& url, float loadingPriority, SpatiallyNestable* spatiallyNestableOverride,
+                                               std::function<float()> loadingPriorityOperator) {
     ModelPointer model = nullptr;
 
     // Only create and delete models on the thread that owns the EntityTreeRenderer
@@ -554,6 +555,7 @@ ModelPointer EntityTreeRenderer::allocateModel(const QString& url, float loading
 
     model = std::make_shared<Model>(std::make_shared<Rig>(), nullptr, spatiallyNestableOverride);
     model->setLoadingPriority(loadingPriority);
+    model->setLoadingPriorityOperator(loadingPriorityOperator);
     model->init();
     model->setURL(QUrl(url));
     return model;
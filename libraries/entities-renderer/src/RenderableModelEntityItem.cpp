@@ -436,15 +436,19 @@ void RenderableModelEntityItem::render(RenderArgs* args) {
 
             // update whether the model should be showing collision mesh (this may flag for fixupInScene)
             bool showingCollisionGeometry = (bool)(args->_debugFlags & (int)RenderArgs::RENDER_DEBUG_HULLS);
-            if (showingCollisionGeometry != _showCollisionGeometry) {
+            if (showingCollisionGeometry != _showCollisionGeometry || _collisionMeshPending) {
                 ShapeType type = getShapeType();
                 _showCollisionGeometry = showingCollisionGeometry;
                 if (_showCollisionGeometry && type != SHAPE_TYPE_STATIC_MESH && type != SHAPE_TYPE_NONE) {
                     // NOTE: it is OK if _collisionMeshKey is nullptr
-                    model::MeshPointer mesh = collisionMeshCache.getMesh(_collisionMeshKey);
+                    // the cache builds new meshes within a per-frame budget -- a null result for
+                    // a valid key means we were deferred and should request again next frame
+                    model::MeshPointer mesh = collisionMeshCache.requestMesh(_collisionMeshKey);
+                    _collisionMeshPending = (bool)_collisionMeshKey && !mesh;
                     // NOTE: the model will render the collisionGeometry if it has one
                     _model->setCollisionMesh(mesh);
                 } else {
+                    _collisionMeshPending = false;
                     // release mesh
                     if (_collisionMeshKey) {
                         collisionMeshCache.releaseMesh(_collisionMeshKey);
@@ -510,7 +514,20 @@ ModelPointer RenderableModelEntityItem::getModel(QSharedPointer<EntityTreeRender
     if (!getModelURL().isEmpty()) {
         // If we don't have a model, allocate one *immediately*
         if (!_model) {
-            _model = _myRenderer->allocateModel(getModelURL(), renderer->getEntityLoadingPriority(*this), this);
+            // the priority operator is re-evaluated by the resource scheduler whenever a
+            // download slot opens up, so our load priority follows the avatar around
+            // instead of being frozen at whatever it was when the entity first appeared
+            EntityItemWeakPointer weakSelf = getThisPointer();
+            QWeakPointer<EntityTreeRenderer> weakRenderer = _myRenderer;
+            _model = _myRenderer->allocateModel(getModelURL(), renderer->getEntityLoadingPriority(*this), this,
+                [weakSelf, weakRenderer]() -> float {
+                    auto self = weakSelf.lock();
+                    auto strongRenderer = weakRenderer.lock();
+                    if (!self || !strongRenderer) {
+                        return 0.0f;
+                    }
+                    return strongRenderer->getEntityLoadingPriority(*self);
+                });
             _needsInitialSimulation = true;
         // If we need to change URLs, update it *after rendering* (to avoid access violations)
         } else if (QUrl(getModelURL()) != _model->getURL()) {
@@ -127,6 +127,7 @@ private:
 
     bool _needsJointSimulation { false };
     bool _showCollisionGeometry { false };
+    bool _collisionMeshPending { false };
     const void* _collisionMeshKey { nullptr };
 };
 
@@ -8,9 +8,12 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <algorithm>
+
 #include <glm/gtx/quaternion.hpp>
 
 #include <DependencyManager.h>
+#include <NumericalConstants.h>
 #include <PerfStat.h>
 #include <GeometryCache.h>
 #include <AbstractViewStateInterface.h>
@@ -18,7 +21,6 @@
 
 #include "RenderableParticleEffectEntityItem.h"
 
-#include "untextured_particle_vert.h"
 #include "untextured_particle_frag.h"
 #include "textured_particle_vert.h"
 #include "textured_particle_frag.h"
@@ -39,15 +41,12 @@ public:
         InterpolationData<float> radius;
         InterpolationData<glm::vec4> color; // rgba
         float lifespan;
-        glm::vec3 spare;
-    };
-    
-    struct ParticlePrimitive {
-        ParticlePrimitive(glm::vec3 xyzIn, glm::vec2 uvIn) : xyz(xyzIn), uv(uvIn) {}
-        glm::vec3 xyz; // Position
-        glm::vec2 uv; // Lifetime + seed
+        float time; // the emitter clock, in seconds; the vertex shader ages particles against it
+        glm::vec2 spare;
     };
-    
+
+    using ParticlePrimitive = RenderableParticleEffectEntityItem::ParticlePrimitive;
+
     using Payload = render::Payload<ParticlePayloadData>;
     using Pointer = Payload::DataPointer;
     using PipelinePointer = gpu::PipelinePointer;
@@ -63,10 +62,12 @@ public:
         ParticleUniforms uniforms;
         _uniformBuffer = std::make_shared<Buffer>(sizeof(ParticleUniforms), (const gpu::Byte*) &uniforms);
         
-        _vertexFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element::VEC3F_XYZ,
-                                    offsetof(ParticlePrimitive, xyz), gpu::Stream::PER_INSTANCE);
-        _vertexFormat->setAttribute(gpu::Stream::COLOR, 0, gpu::Element::VEC2F_UV,
-                                    offsetof(ParticlePrimitive, uv), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element::VEC4F_XYZW,
+                                    offsetof(ParticlePrimitive, positionAndBirth), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::COLOR, 0, gpu::Element::VEC4F_XYZW,
+                                    offsetof(ParticlePrimitive, velocityAndSeed), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::TEXCOORD, 0, gpu::Element::VEC4F_XYZW,
+                                    offsetof(ParticlePrimitive, acceleration), gpu::Stream::PER_INSTANCE);
     }
 
     void setPipeline(PipelinePointer pipeline) { _pipeline = pipeline; }
@@ -165,6 +166,7 @@ bool RenderableParticleEffectEntityItem::addToScene(EntityItemPointer self,
                                                     render::PendingChanges& pendingChanges) {
     _scene = scene;
     _renderItemId = _scene->allocateID();
+    _gpuRingCapacity = 0; // fresh payloads have an empty particle buffer; force a ring rebuild
     auto particlePayloadData = std::make_shared<ParticlePayloadData>();
     particlePayloadData->setPipeline(_untexturedPipeline);
     auto renderPayload = std::make_shared<ParticlePayloadData::Payload>(particlePayloadData);
@@ -216,9 +218,15 @@ void RenderableParticleEffectEntityItem::updateRenderItem() {
     }
     
     using ParticleUniforms = ParticlePayloadData::ParticleUniforms;
-    using ParticlePrimitive = ParticlePayloadData::ParticlePrimitive;
     using ParticlePrimitives = ParticlePayloadData::ParticlePrimitives;
 
+    // The base class update() stamped _lastSimulated just before calling us; that is "now" on
+    // the emitter clock the shader ages particles against.
+    if (_gpuClockBase == 0) {
+        _gpuClockBase = _lastSimulated;
+    }
+    float particleTime = (float)((double)(_lastSimulated - _gpuClockBase) / (double)USECS_PER_SECOND);
+
     // Fill in Uniforms structure
     ParticleUniforms particleUniforms;
     particleUniforms.radius.start = getRadiusStart();
@@ -230,13 +238,7 @@ void RenderableParticleEffectEntityItem::updateRenderItem() {
     particleUniforms.color.finish = glm::vec4(getColorFinishRGB(), getAlphaFinish());
     particleUniforms.color.spread = glm::vec4(getColorSpreadRGB(), getAlphaSpread());
     particleUniforms.lifespan = getLifespan();
-    
-    // Build particle primitives
-    auto particlePrimitives = std::make_shared<ParticlePrimitives>();
-    particlePrimitives->reserve(_particles.size()); // Reserve space
-    for (auto& particle : _particles) {
-        particlePrimitives->emplace_back(particle.position, glm::vec2(particle.lifetime, particle.seed));
-    }
+    particleUniforms.time = particleTime;
 
     bool successb, successp, successr;
     auto bounds = getAABox(successb);
@@ -252,22 +254,82 @@ void RenderableParticleEffectEntityItem::updateRenderItem() {
         transform.setRotation(rotation);
     }
 
+    // Stage birth state for particles that need uploading. The whole ring only needs rebuilding
+    // when its capacity changes or the payload was recreated; the steady state upload is just
+    // the particles born since last frame, and an idle frame uploads nothing at all.
+    bool rebuild = (_gpuRingCapacity != _maxParticles);
+    quint64 newlySpawned = _particlesSpawned - _gpuParticlesSpawned;
+    if (newlySpawned > _maxParticles) {
+        // the ring wrapped completely since last frame, a rebuild uploads less
+        rebuild = true;
+    }
+    if (_particles.empty() && !getIsEmitting()) {
+        // the emitter went idle; empty the ring so we stop drawing dead slots
+        rebuild = true;
+    }
+
+    auto stagedPrimitives = std::make_shared<ParticlePrimitives>();
+    quint32 firstSlot = _gpuRingNext;
+    if (rebuild) {
+        _gpuRingCapacity = _maxParticles;
+        _gpuRingCount = (quint32)_particles.size();
+        _gpuRingNext = _gpuRingCount % _gpuRingCapacity;
+        firstSlot = 0;
+        stagedPrimitives->reserve(_particles.size());
+        for (auto& particle : _particles) {
+            stagedPrimitives->push_back({ glm::vec4(particle.position, particleTime - particle.lifetime),
+                                          glm::vec4(particle.velocity, particle.seed),
+                                          glm::vec4(particle.acceleration, 0.0f) });
+        }
+        if (_particles.empty()) {
+            _gpuClockBase = 0; // rebase the clock when the emitter wakes up again
+        }
+    } else if (newlySpawned > 0) {
+        // newborns are at the back of the deque; ones that already died (sub-frame lifespan)
+        // were popped and are not worth a slot
+        quint32 stageCount = (quint32)std::min<quint64>(newlySpawned, _particles.size());
+        stagedPrimitives->reserve(stageCount);
+        for (auto it = _particles.end() - stageCount; it != _particles.end(); ++it) {
+            stagedPrimitives->push_back({ glm::vec4(it->position, particleTime - it->lifetime),
+                                          glm::vec4(it->velocity, it->seed),
+                                          glm::vec4(it->acceleration, 0.0f) });
+        }
+        _gpuRingNext = (quint32)((firstSlot + stageCount) % _gpuRingCapacity);
+        _gpuRingCount = std::min(_gpuRingCapacity, _gpuRingCount + stageCount);
+    }
+    _gpuParticlesSpawned = _particlesSpawned;
+
+    bool ringRebuilt = rebuild;
+    quint32 ringCapacity = _gpuRingCapacity;
+    quint32 ringCount = _gpuRingCount;
 
     render::PendingChanges pendingChanges;
     pendingChanges.updateItem<ParticlePayloadData>(_renderItemId, [=](ParticlePayloadData& payload) {
         payload.setVisibleFlag(true);
-        
+
         // Update particle uniforms
         memcpy(&payload.editParticleUniforms(), &particleUniforms, sizeof(ParticleUniforms));
-        
+
         // Update particle buffer
         auto particleBuffer = payload.getParticleBuffer();
-        size_t numBytes = sizeof(ParticlePrimitive) * particlePrimitives->size();
-        particleBuffer->resize(numBytes);
-        if (numBytes == 0) {
-            return;
+        const size_t stride = sizeof(ParticlePayloadData::ParticlePrimitive);
+        if (ringRebuilt) {
+            particleBuffer->resize(stagedPrimitives->size() * stride);
+            if (!stagedPrimitives->empty()) {
+                particleBuffer->setData(stagedPrimitives->size() * stride, (const gpu::Byte*)stagedPrimitives->data());
+            }
+        } else if (!stagedPrimitives->empty()) {
+            // grow to cover every valid slot, then scatter the newborns into theirs; the page
+            // manager only syncs the dirty ranges to the GPU
+            if (particleBuffer->getSize() < ringCount * stride) {
+                particleBuffer->resize(ringCount * stride);
+            }
+            quint32 slot = firstSlot;
+            for (const auto& primitive : *stagedPrimitives) {
+                particleBuffer->setSubData(slot * stride, stride, (const gpu::Byte*)&primitive);
+                slot = (slot + 1) % ringCapacity;
+            }
         }
-        particleBuffer->setData(numBytes, (const gpu::Byte*)particlePrimitives->data());
 
         // Update transform and bounds
         payload.setModelTransform(transform);
@@ -293,7 +355,8 @@ void RenderableParticleEffectEntityItem::createPipelines() {
         state->setBlendFunction(true, gpu::State::SRC_ALPHA, gpu::State::BLEND_OP_ADD, gpu::State::ONE,
                                 gpu::State::FACTOR_ALPHA, gpu::State::BLEND_OP_ADD, gpu::State::ONE);
 
-        auto vertShader = gpu::Shader::createVertex(std::string(untextured_particle_vert));
+        // both pipelines share the vertex shader that evaluates the particle trajectory on the GPU
+        auto vertShader = gpu::Shader::createVertex(std::string(textured_particle_vert));
         auto fragShader = gpu::Shader::createPixel(std::string(untextured_particle_frag));
 
         auto program = gpu::Shader::createProgram(vertShader, fragShader);
@@ -35,13 +35,31 @@ protected:
     void notifyBoundChanged();
 
     void createPipelines();
-    
+
+    /// Per-particle birth state as it lives in the GPU ring buffer. Written once when the
+    /// particle spawns; the vertex shader integrates the trajectory in closed form from these,
+    /// so nothing per-particle is touched again on the CPU.
+    struct ParticlePrimitive {
+        glm::vec4 positionAndBirth; // xyz = spawn position, w = birth time on the emitter clock
+        glm::vec4 velocityAndSeed;  // xyz = velocity at birth, w = seed
+        glm::vec4 acceleration;     // xyz = acceleration, w = spare
+    };
+
     render::ScenePointer _scene;
     render::ItemID _renderItemId{ render::Item::INVALID_ITEM_ID };
-    
+
     NetworkTexturePointer _texture;
     gpu::PipelinePointer _untexturedPipeline;
     gpu::PipelinePointer _texturedPipeline;
+
+    // GPU particle ring state. Slots are written in spawn order and wrap at capacity, mirroring
+    // the deque's drop-oldest-on-overflow behavior; dead slots are culled in the vertex shader
+    // and simply stay in place until a new particle overwrites them.
+    quint32 _gpuRingCapacity { 0 };     ///< _maxParticles when valid; mismatch forces a rebuild
+    quint32 _gpuRingNext { 0 };         ///< next slot to (over)write
+    quint32 _gpuRingCount { 0 };        ///< valid slots, grows to capacity then sticks
+    quint64 _gpuParticlesSpawned { 0 }; ///< _particlesSpawned as of the last upload
+    quint64 _gpuClockBase { 0 };        ///< usecs timestamp the shader's emitter clock is relative to
 };
 
 
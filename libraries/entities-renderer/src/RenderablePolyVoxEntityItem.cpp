@@ -54,6 +54,7 @@
 
 gpu::PipelinePointer RenderablePolyVoxEntityItem::_pipeline = nullptr;
 const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5;
+const int MESH_CHUNK_SIZE = 16; // cells per mesh chunk, along each axis
 
 
 /*
@@ -61,7 +62,7 @@ const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5;
 
   _voxelData -- compressed QByteArray representation of which voxels have which values
   _volData -- datastructure from the PolyVox library which holds which voxels have which values
-  _mesh -- renderable representation of the voxels
+  _meshChunks -- renderable representation of the voxels, one mesh per fixed-size chunk of cells
   _shape -- used for bullet collisions
 
   Each one depends on the one before it, except that _voxelData is set from _volData if a script edits the voxels.
@@ -74,9 +75,14 @@ const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5;
 
   In RenderablePolyVoxEntityItem::render, these flags are checked and changes are propagated along the chain.
   decompressVolumeData() is called to decompress _voxelData into _volData.  getMesh() is called to invoke the
-  polyVox surface extractor to create _mesh (as well as set Simulation _dirtyFlags).  Because Simulation::DIRTY_SHAPE
-  is set, isReadyToComputeShape() gets called and _shape is created either from _volData or _shape, depending on
-  the surface style.
+  polyVox surface extractor to update _meshChunks (as well as set Simulation _dirtyFlags).  Because
+  Simulation::DIRTY_SHAPE is set, isReadyToComputeShape() gets called and _shape is created either from _volData
+  or the mesh, depending on the surface style.
+
+  The mesh is kept as independently extracted fixed-size chunks.  Voxel edits accumulate a dirty bounding box
+  and getMesh() only re-extracts the chunks that box touches; each chunk's lock is held just long enough to run
+  the extractor over its cells, so edits and rendering are never blocked behind a whole-volume extraction.  The
+  freshly built chunk meshes for a pass are swapped in atomically by setMeshChunks.
 
   When a script changes _volData, compressVolumeDataAndSendEditPacket is called to update _voxelData and to
   send a packet to the entity-server.
@@ -112,7 +118,6 @@ EntityItemPointer RenderablePolyVoxEntityItem::factory(const EntityItemID& entit
 
 RenderablePolyVoxEntityItem::RenderablePolyVoxEntityItem(const EntityItemID& entityItemID) :
     PolyVoxEntityItem(entityItemID),
-    _mesh(new model::Mesh()),
     _meshDirty(true),
     _xTexture(nullptr),
     _yTexture(nullptr),
@@ -180,6 +185,8 @@ void RenderablePolyVoxEntityItem::setVoxelSurfaceStyle(PolyVoxSurfaceStyle voxel
             _volDataDirty = true;
             _voxelSurfaceStyle = voxelSurfaceStyle;
         }
+        // a new surface style means every chunk's mesh is stale
+        markAllVoxelsDirty();
     });
 
     if (volSizeChanged) {
@@ -685,15 +692,14 @@ void RenderablePolyVoxEntityItem::render(RenderArgs* args) {
         getMesh();
     }
 
-    model::MeshPointer mesh;
+    MeshChunks meshChunks;
     glm::vec3 voxelVolumeSize;
     withReadLock([&] {
-        mesh = _mesh;
+        meshChunks = _meshChunks;
         voxelVolumeSize = _voxelVolumeSize;
     });
 
-    if (!mesh ||
-        !mesh->getIndexBuffer()._buffer) {
+    if (meshChunks.empty()) {
         return;
     }
 
@@ -730,11 +736,6 @@ void RenderablePolyVoxEntityItem::render(RenderArgs* args) {
     Transform transform(voxelToWorldMatrix());
     batch.setModelTransform(transform);
     batch.setInputFormat(_vertexFormat);
-    batch.setInputBuffer(gpu::Stream::POSITION, mesh->getVertexBuffer()._buffer,
-                         0,
-                         sizeof(PolyVox::PositionMaterialNormal));
-
-    batch.setIndexBuffer(gpu::UINT32, mesh->getIndexBuffer()._buffer, 0);
 
     if (!_xTextureURL.isEmpty() && !_xTexture) {
         _xTexture = DependencyManager::get<TextureCache>()->getTexture(_xTextureURL);
@@ -765,7 +766,16 @@ void RenderablePolyVoxEntityItem::render(RenderArgs* args) {
     int voxelVolumeSizeLocation = _pipeline->getProgram()->getUniforms().findLocation("voxelVolumeSize");
     batch._glUniform3f(voxelVolumeSizeLocation, voxelVolumeSize.x, voxelVolumeSize.y, voxelVolumeSize.z);
 
-    batch.drawIndexed(gpu::TRIANGLES, (gpu::uint32)mesh->getNumIndices(), 0);
+    for (const MeshChunk& chunk : meshChunks) {
+        if (!chunk.mesh || !chunk.mesh->getIndexBuffer()._buffer || chunk.mesh->getNumIndices() == 0) {
+            continue; // a fully-empty or fully-solid chunk has no surface
+        }
+        batch.setInputBuffer(gpu::Stream::POSITION, chunk.mesh->getVertexBuffer()._buffer,
+                             0,
+                             sizeof(PolyVox::PositionMaterialNormal));
+        batch.setIndexBuffer(gpu::UINT32, chunk.mesh->getIndexBuffer()._buffer, 0);
+        batch.drawIndexed(gpu::TRIANGLES, (gpu::uint32)chunk.mesh->getNumIndices(), 0);
+    }
 }
 
 bool RenderablePolyVoxEntityItem::addToScene(EntityItemPointer self,
@@ -886,6 +896,7 @@ void RenderablePolyVoxEntityItem::setVoxelVolumeSize(glm::vec3 voxelVolumeSize)
 
         // having the "outside of voxel-space" value be 255 has helped me notice some problems.
         _volData->setBorderValue(255);
+        markAllVoxelsDirty();
     });
 }
 
@@ -934,6 +945,26 @@ uint8_t RenderablePolyVoxEntityItem::getVoxelInternal(int x, int y, int z) const
 }
 
 
+void RenderablePolyVoxEntityItem::markVoxelDirty(int x, int y, int z) {
+    // accumulate the bounds of edited voxels (in _volData coordinates) so that getMesh can
+    // re-extract just the chunks they touch.  This assumes the caller has write-locked the entity.
+    glm::ivec3 voxel(x, y, z);
+    if (_dirtyVoxelsMin.x > _dirtyVoxelsMax.x) {
+        _dirtyVoxelsMin = voxel;
+        _dirtyVoxelsMax = voxel;
+    } else {
+        _dirtyVoxelsMin = glm::min(_dirtyVoxelsMin, voxel);
+        _dirtyVoxelsMax = glm::max(_dirtyVoxelsMax, voxel);
+    }
+}
+
+void RenderablePolyVoxEntityItem::markAllVoxelsDirty() {
+    // force every chunk to re-extract on the next getMesh.  This assumes the caller has
+    // write-locked the entity.
+    _dirtyVoxelsMin = glm::ivec3(-(1 << 30));
+    _dirtyVoxelsMax = glm::ivec3(1 << 30);
+}
+
 bool RenderablePolyVoxEntityItem::setVoxelInternal(int x, int y, int z, uint8_t toValue) {
     // set a voxel without recompressing the voxel data.  This assumes that the caller has
     // write-locked the entity.
@@ -946,8 +977,14 @@ bool RenderablePolyVoxEntityItem::setVoxelInternal(int x, int y, int z, uint8_t
 
     if (isEdged(_voxelSurfaceStyle)) {
         _volData->setVoxelAt(x + 1, y + 1, z + 1, toValue);
+        if (result) {
+            markVoxelDirty(x + 1, y + 1, z + 1);
+        }
     } else {
         _volData->setVoxelAt(x, y, z, toValue);
+        if (result) {
+            markVoxelDirty(x, y, z);
+        }
     }
 
     if (x == 0 || y == 0 || z == 0) {
@@ -1153,15 +1190,22 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
     auto currentYPNeighbor = getYPNeighbor();
     auto currentZPNeighbor = getZPNeighbor();
 
+    // only voxels that actually changed are written and dirtied, so stitching an unchanged
+    // neighbor edge costs no re-extraction
+
     if (currentXPNeighbor && currentXPNeighbor->getVoxelVolumeSize() == _voxelVolumeSize) {
         withWriteLock([&] {
+            int x = _volData->getWidth() - 1;
             for (int y = 0; y < _volData->getHeight(); y++) {
                 for (int z = 0; z < _volData->getDepth(); z++) {
                     uint8_t neighborValue = currentXPNeighbor->getVoxel(0, y, z);
-                    if ((y == 0 || z == 0) && _volData->getVoxelAt(_volData->getWidth() - 1, y, z) != neighborValue) {
-                        bonkNeighbors();
+                    if (_volData->getVoxelAt(x, y, z) != neighborValue) {
+                        if (y == 0 || z == 0) {
+                            bonkNeighbors();
+                        }
+                        _volData->setVoxelAt(x, y, z, neighborValue);
+                        markVoxelDirty(x, y, z);
                     }
-                    _volData->setVoxelAt(_volData->getWidth() - 1, y, z, neighborValue);
                 }
             }
         });
@@ -1170,13 +1214,17 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
 
     if (currentYPNeighbor && currentYPNeighbor->getVoxelVolumeSize() == _voxelVolumeSize) {
         withWriteLock([&] {
+            int y = _volData->getHeight() - 1;
             for (int x = 0; x < _volData->getWidth(); x++) {
                 for (int z = 0; z < _volData->getDepth(); z++) {
                     uint8_t neighborValue = currentYPNeighbor->getVoxel(x, 0, z);
-                    if ((x == 0 || z == 0) && _volData->getVoxelAt(x, _volData->getHeight() - 1, z) != neighborValue) {
-                        bonkNeighbors();
+                    if (_volData->getVoxelAt(x, y, z) != neighborValue) {
+                        if (x == 0 || z == 0) {
+                            bonkNeighbors();
+                        }
+                        _volData->setVoxelAt(x, y, z, neighborValue);
+                        markVoxelDirty(x, y, z);
                     }
-                    _volData->setVoxelAt(x, _volData->getHeight() - 1, z, neighborValue);
                 }
             }
         });
@@ -1185,14 +1233,17 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
 
     if (currentZPNeighbor && currentZPNeighbor->getVoxelVolumeSize() == _voxelVolumeSize) {
         withWriteLock([&] {
+            int z = _volData->getDepth() - 1;
             for (int x = 0; x < _volData->getWidth(); x++) {
                 for (int y = 0; y < _volData->getHeight(); y++) {
                     uint8_t neighborValue = currentZPNeighbor->getVoxel(x, y, 0);
-                    _volData->setVoxelAt(x, y, _volData->getDepth() - 1, neighborValue);
-                    if ((x == 0 || y == 0) && _volData->getVoxelAt(x, y, _volData->getDepth() - 1) != neighborValue) {
-                        bonkNeighbors();
+                    if (_volData->getVoxelAt(x, y, z) != neighborValue) {
+                        if (x == 0 || y == 0) {
+                            bonkNeighbors();
+                        }
+                        _volData->setVoxelAt(x, y, z, neighborValue);
+                        markVoxelDirty(x, y, z);
                     }
-                    _volData->setVoxelAt(x, y, _volData->getDepth() - 1, neighborValue);
                 }
             }
         });
@@ -1200,7 +1251,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
 }
 
 void RenderablePolyVoxEntityItem::getMesh() {
-    // use _volData to make a renderable mesh
+    // use _volData to update the renderable mesh chunks
     PolyVoxSurfaceStyle voxelSurfaceStyle;
     withReadLock([&] {
         voxelSurfaceStyle = _voxelSurfaceStyle;
@@ -1209,78 +1260,165 @@ void RenderablePolyVoxEntityItem::getMesh() {
     cacheNeighbors();
     copyUpperEdgesFromNeighbors();
 
-    auto entity = std::static_pointer_cast<RenderablePolyVoxEntityItem>(getThisPointer());
-
-    QtConcurrent::run([entity, voxelSurfaceStyle] {
-        model::MeshPointer mesh(new model::Mesh());
-
-        // A mesh object to hold the result of surface extraction
-        PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
-
-        entity->withReadLock([&] {
-            PolyVox::SimpleVolume<uint8_t>* volData = entity->getVolData();
-            switch (voxelSurfaceStyle) {
-                case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES: {
-                    PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
+    // decide which chunks need to be re-extracted.  If the chunk partition no longer matches the
+    // volume (it was resized), everything does; otherwise only chunks touching the accumulated
+    // dirty bounds.  An edited voxel influences cells a couple of steps away (marching cubes
+    // samples neighbor gradients for normals), so pad the dirty bounds accordingly.
+    const int DIRTY_PAD = 2;
+    std::vector<PolyVox::Region> dirtyRegions;
+    bool replaceAll = false;
+    withWriteLock([&] {
+        PolyVox::Vector3DInt32 lower = _volData->getEnclosingRegion().getLowerCorner();
+        PolyVox::Vector3DInt32 upper = _volData->getEnclosingRegion().getUpperCorner();
+
+        std::vector<PolyVox::Region> chunkRegions;
+        for (int32_t z = lower.getZ(); z <= upper.getZ(); z += MESH_CHUNK_SIZE) {
+            for (int32_t y = lower.getY(); y <= upper.getY(); y += MESH_CHUNK_SIZE) {
+                for (int32_t x = lower.getX(); x <= upper.getX(); x += MESH_CHUNK_SIZE) {
+                    chunkRegions.push_back(
+                        PolyVox::Region(PolyVox::Vector3DInt32(x, y, z),
+                                        PolyVox::Vector3DInt32(std::min(x + MESH_CHUNK_SIZE - 1, upper.getX()),
+                                                               std::min(y + MESH_CHUNK_SIZE - 1, upper.getY()),
+                                                               std::min(z + MESH_CHUNK_SIZE - 1, upper.getZ()))));
                 }
-                case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
-                    PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
+            }
+        }
+
+        replaceAll = (_meshChunks.size() != chunkRegions.size());
+        if (!replaceAll) {
+            for (size_t i = 0; i < chunkRegions.size(); i++) {
+                if (_meshChunks[i].region.getLowerCorner() != chunkRegions[i].getLowerCorner() ||
+                    _meshChunks[i].region.getUpperCorner() != chunkRegions[i].getUpperCorner()) {
+                    replaceAll = true;
                     break;
                 }
-                case PolyVoxEntityItem::SURFACE_EDGED_CUBIC: {
-                    PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
+            }
+        }
+
+        if (replaceAll) {
+            dirtyRegions = chunkRegions;
+        } else if (_dirtyVoxelsMin.x <= _dirtyVoxelsMax.x) {
+            glm::ivec3 dirtyMin = _dirtyVoxelsMin - glm::ivec3(DIRTY_PAD);
+            glm::ivec3 dirtyMax = _dirtyVoxelsMax + glm::ivec3(DIRTY_PAD);
+            for (const PolyVox::Region& region : chunkRegions) {
+                if (region.getLowerCorner().getX() <= dirtyMax.x && region.getUpperCorner().getX() >= dirtyMin.x &&
+                    region.getLowerCorner().getY() <= dirtyMax.y && region.getUpperCorner().getY() >= dirtyMin.y &&
+                    region.getLowerCorner().getZ() <= dirtyMax.z && region.getUpperCorner().getZ() >= dirtyMin.z) {
+                    dirtyRegions.push_back(region);
                 }
-                case PolyVoxEntityItem::SURFACE_CUBIC: {
-                    PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
+            }
+        }
+
+        _dirtyVoxelsMin = glm::ivec3(0);
+        _dirtyVoxelsMax = glm::ivec3(-1);
+    });
+
+    if (dirtyRegions.empty()) {
+        return;
+    }
+
+    auto entity = std::static_pointer_cast<RenderablePolyVoxEntityItem>(getThisPointer());
+
+    QtConcurrent::run([entity, voxelSurfaceStyle, dirtyRegions, replaceAll] {
+        MeshChunks updatedChunks;
+        updatedChunks.reserve(dirtyRegions.size());
+
+        for (const PolyVox::Region& region : dirtyRegions) {
+            // A mesh object to hold the result of surface extraction
+            PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
+
+            // hold the lock only while this one chunk extracts.  An edit that lands between
+            // chunks re-dirties the chunks it touches, so any seam it opens is closed on the
+            // next pass.
+            entity->withReadLock([&] {
+                PolyVox::SimpleVolume<uint8_t>* volData = entity->getVolData();
+                switch (voxelSurfaceStyle) {
+                    case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
+                    case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
+                        PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (volData, region, &polyVoxMesh);
+                        surfaceExtractor.execute();
+                        break;
+                    }
+                    case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
+                    case PolyVoxEntityItem::SURFACE_CUBIC: {
+                        PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (volData, region, &polyVoxMesh);
+                        surfaceExtractor.execute();
+                        break;
+                    }
                 }
+            });
+
+            // convert PolyVox mesh to a Sam mesh
+            model::MeshPointer mesh(new model::Mesh());
+
+            const std::vector<uint32_t>& vecIndices = polyVoxMesh.getIndices();
+            auto indexBuffer = std::make_shared<gpu::Buffer>(vecIndices.size() * sizeof(uint32_t),
+                                                             (gpu::Byte*)vecIndices.data());
+            auto indexBufferPtr = gpu::BufferPointer(indexBuffer);
+            gpu::BufferView indexBufferView(indexBufferPtr, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::RAW));
+            mesh->setIndexBuffer(indexBufferView);
+
+            // the extractor emits vertices relative to the region's lower corner; bake the chunk
+            // offset back in so all chunks share one model transform
+            std::vector<PolyVox::PositionMaterialNormal> vecVertices = polyVoxMesh.getVertices();
+            PolyVox::Vector3DFloat chunkOffset((float)region.getLowerCorner().getX(),
+                                               (float)region.getLowerCorner().getY(),
+                                               (float)region.getLowerCorner().getZ());
+            for (PolyVox::PositionMaterialNormal& vertex : vecVertices) {
+                vertex.position += chunkOffset;
             }
-        });
 
-        // convert PolyVox mesh to a Sam mesh
-        const std::vector<uint32_t>& vecIndices = polyVoxMesh.getIndices();
-        auto indexBuffer = std::make_shared<gpu::Buffer>(vecIndices.size() * sizeof(uint32_t),
-                                                         (gpu::Byte*)vecIndices.data());
-        auto indexBufferPtr = gpu::BufferPointer(indexBuffer);
-        gpu::BufferView indexBufferView(indexBufferPtr, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::RAW));
-        mesh->setIndexBuffer(indexBufferView);
-
-        const std::vector<PolyVox::PositionMaterialNormal>& vecVertices = polyVoxMesh.getVertices();
-        auto vertexBuffer = std::make_shared<gpu::Buffer>(vecVertices.size() * sizeof(PolyVox::PositionMaterialNormal),
-                                                          (gpu::Byte*)vecVertices.data());
-        auto vertexBufferPtr = gpu::BufferPointer(vertexBuffer);
-        gpu::BufferView vertexBufferView(vertexBufferPtr, 0,
-                                         vertexBufferPtr->getSize(),
-                                         sizeof(PolyVox::PositionMaterialNormal),
-                                         gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::RAW));
-        mesh->setVertexBuffer(vertexBufferView);
-        mesh->addAttribute(gpu::Stream::NORMAL,
-                           gpu::BufferView(vertexBufferPtr, sizeof(float) * 3,
-                                           vertexBufferPtr->getSize() ,
-                                           sizeof(PolyVox::PositionMaterialNormal),
-                                           gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::RAW)));
-        entity->setMesh(mesh);
+            auto vertexBuffer = std::make_shared<gpu::Buffer>(vecVertices.size() * sizeof(PolyVox::PositionMaterialNormal),
+                                                              (gpu::Byte*)vecVertices.data());
+            auto vertexBufferPtr = gpu::BufferPointer(vertexBuffer);
+            gpu::BufferView vertexBufferView(vertexBufferPtr, 0,
+                                             vertexBufferPtr->getSize(),
+                                             sizeof(PolyVox::PositionMaterialNormal),
+                                             gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::RAW));
+            mesh->setVertexBuffer(vertexBufferView);
+            mesh->addAttribute(gpu::Stream::NORMAL,
+                               gpu::BufferView(vertexBufferPtr, sizeof(float) * 3,
+                                               vertexBufferPtr->getSize() ,
+                                               sizeof(PolyVox::PositionMaterialNormal),
+                                               gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::RAW)));
+
+            MeshChunk chunk;
+            chunk.region = region;
+            chunk.mesh = mesh;
+            updatedChunks.push_back(chunk);
+        }
+
+        entity->setMeshChunks(updatedChunks, replaceAll);
     });
 }
 
-void RenderablePolyVoxEntityItem::setMesh(model::MeshPointer mesh) {
-    // this catches the payload from getMesh
+void RenderablePolyVoxEntityItem::setMeshChunks(const MeshChunks& updatedChunks, bool replaceAll) {
+    // this catches the payload from getMesh.  All of a pass's freshly extracted chunks are
+    // swapped in under one lock so the renderer never sees a half-updated surface.
     bool neighborsNeedUpdate;
     withWriteLock([&] {
         if (!_collisionless) {
             _dirtyFlags |= Simulation::DIRTY_SHAPE | Simulation::DIRTY_MASS;
         }
-        _mesh = mesh;
+        if (replaceAll) {
+            _meshChunks = updatedChunks;
+        } else {
+            for (const MeshChunk& updated : updatedChunks) {
+                bool found = false;
+                for (MeshChunk& chunk : _meshChunks) {
+                    if (chunk.region.getLowerCorner() == updated.region.getLowerCorner()) {
+                        chunk.mesh = updated.mesh;
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found) {
+                    _meshChunks.push_back(updated);
+                }
+            }
+        }
         _meshDirty = true;
         _meshInitialized = true;
         neighborsNeedUpdate = _neighborsNeedUpdate;
@@ -1293,7 +1431,7 @@ void RenderablePolyVoxEntityItem::setMesh(model::MeshPointer mesh) {
 
 void RenderablePolyVoxEntityItem::computeShapeInfoWorker() {
     // this creates a collision-shape for the physics engine.  The shape comes from
-    // _volData for cubic extractors and from _mesh for marching-cube extractors
+    // _volData for cubic extractors and from the mesh chunks for marching-cube extractors
     if (!_meshInitialized) {
         return;
     }
@@ -1302,15 +1440,15 @@ void RenderablePolyVoxEntityItem::computeShapeInfoWorker() {
 
     PolyVoxSurfaceStyle voxelSurfaceStyle;
     glm::vec3 voxelVolumeSize;
-    model::MeshPointer mesh;
+    MeshChunks meshChunks;
 
     withReadLock([&] {
         voxelSurfaceStyle = _voxelSurfaceStyle;
         voxelVolumeSize = _voxelVolumeSize;
-        mesh = _mesh;
+        meshChunks = _meshChunks;
     });
 
-    QtConcurrent::run([entity, voxelSurfaceStyle, voxelVolumeSize, mesh] {
+    QtConcurrent::run([entity, voxelSurfaceStyle, voxelVolumeSize, meshChunks] {
         auto polyVoxEntity = std::static_pointer_cast<RenderablePolyVoxEntityItem>(entity);
         QVector<QVector<glm::vec3>> pointCollection;
         AABox box;
@@ -1321,43 +1459,48 @@ void RenderablePolyVoxEntityItem::computeShapeInfoWorker() {
             // pull each triangle in the mesh into a polyhedron which can be collided with
             unsigned int i = 0;
 
-            const gpu::BufferView& vertexBufferView = mesh->getVertexBuffer();
-            const gpu::BufferView& indexBufferView = mesh->getIndexBuffer();
-
-            gpu::BufferView::Iterator<const uint32_t> it = indexBufferView.cbegin<uint32_t>();
-            while (it != indexBufferView.cend<uint32_t>()) {
-                uint32_t p0Index = *(it++);
-                uint32_t p1Index = *(it++);
-                uint32_t p2Index = *(it++);
-
-                const glm::vec3& p0 = vertexBufferView.get<const glm::vec3>(p0Index);
-                const glm::vec3& p1 = vertexBufferView.get<const glm::vec3>(p1Index);
-                const glm::vec3& p2 = vertexBufferView.get<const glm::vec3>(p2Index);
-
-                glm::vec3 av = (p0 + p1 + p2) / 3.0f; // center of the triangular face
-                glm::vec3 normal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
-                glm::vec3 p3 = av - normal * MARCHING_CUBE_COLLISION_HULL_OFFSET;
-
-                glm::vec3 p0Model = glm::vec3(vtoM * glm::vec4(p0, 1.0f));
-                glm::vec3 p1Model = glm::vec3(vtoM * glm::vec4(p1, 1.0f));
-                glm::vec3 p2Model = glm::vec3(vtoM * glm::vec4(p2, 1.0f));
-                glm::vec3 p3Model = glm::vec3(vtoM * glm::vec4(p3, 1.0f));
-
-                box += p0Model;
-                box += p1Model;
-                box += p2Model;
-                box += p3Model;
-
-                QVector<glm::vec3> pointsInPart;
-                pointsInPart << p0Model;
-                pointsInPart << p1Model;
-                pointsInPart << p2Model;
-                pointsInPart << p3Model;
-                // add next convex hull
-                QVector<glm::vec3> newMeshPoints;
-                pointCollection << newMeshPoints;
-                // add points to the new convex hull
-                pointCollection[i++] << pointsInPart;
+            for (const MeshChunk& meshChunk : meshChunks) {
+                if (!meshChunk.mesh || !meshChunk.mesh->getIndexBuffer()._buffer) {
+                    continue;
+                }
+                const gpu::BufferView& vertexBufferView = meshChunk.mesh->getVertexBuffer();
+                const gpu::BufferView& indexBufferView = meshChunk.mesh->getIndexBuffer();
+
+                gpu::BufferView::Iterator<const uint32_t> it = indexBufferView.cbegin<uint32_t>();
+                while (it != indexBufferView.cend<uint32_t>()) {
+                    uint32_t p0Index = *(it++);
+                    uint32_t p1Index = *(it++);
+                    uint32_t p2Index = *(it++);
+
+                    const glm::vec3& p0 = vertexBufferView.get<const glm::vec3>(p0Index);
+                    const glm::vec3& p1 = vertexBufferView.get<const glm::vec3>(p1Index);
+                    const glm::vec3& p2 = vertexBufferView.get<const glm::vec3>(p2Index);
+
+                    glm::vec3 av = (p0 + p1 + p2) / 3.0f; // center of the triangular face
+                    glm::vec3 normal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+                    glm::vec3 p3 = av - normal * MARCHING_CUBE_COLLISION_HULL_OFFSET;
+
+                    glm::vec3 p0Model = glm::vec3(vtoM * glm::vec4(p0, 1.0f));
+                    glm::vec3 p1Model = glm::vec3(vtoM * glm::vec4(p1, 1.0f));
+                    glm::vec3 p2Model = glm::vec3(vtoM * glm::vec4(p2, 1.0f));
+                    glm::vec3 p3Model = glm::vec3(vtoM * glm::vec4(p3, 1.0f));
+
+                    box += p0Model;
+                    box += p1Model;
+                    box += p2Model;
+                    box += p3Model;
+
+                    QVector<glm::vec3> pointsInPart;
+                    pointsInPart << p0Model;
+                    pointsInPart << p1Model;
+                    pointsInPart << p2Model;
+                    pointsInPart << p3Model;
+                    // add next convex hull
+                    QVector<glm::vec3> newMeshPoints;
+                    pointCollection << newMeshPoints;
+                    // add points to the new convex hull
+                    pointCollection[i++] << pointsInPart;
+                }
             }
         } else {
             unsigned int i = 0;
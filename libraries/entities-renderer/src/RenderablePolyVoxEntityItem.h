@@ -14,6 +14,7 @@
 
 #include <QSemaphore>
 #include <atomic>
+#include <vector>
 
 #include <PolyVoxCore/SimpleVolume.h>
 #include <PolyVoxCore/Raycast.h>
@@ -132,7 +133,16 @@ public:
                            std::function<void(int, int, int, uint8_t)> thunk);
     QByteArray volDataToArray(quint16 voxelXSize, quint16 voxelYSize, quint16 voxelZSize) const;
 
-    void setMesh(model::MeshPointer mesh);
+    /// a piece of the renderable mesh covering a fixed-size box of voxel cells.  Chunks are
+    /// extracted independently so an edit only pays for the chunks it touches, and a chunk's
+    /// mesh is immutable once built -- an update swaps in a freshly extracted one.
+    struct MeshChunk {
+        PolyVox::Region region; // the cells this chunk owns, in voxel coordinates
+        model::MeshPointer mesh;
+    };
+    using MeshChunks = std::vector<MeshChunk>;
+
+    void setMeshChunks(const MeshChunks& updatedChunks, bool replaceAll);
     void setCollisionPoints(ShapeInfo::PointCollection points, AABox box);
     PolyVox::SimpleVolume<uint8_t>* getVolData() { return _volData; }
 
@@ -151,11 +161,18 @@ private:
     // The PolyVoxEntityItem class has _voxelData which contains dimensions and compressed voxel data.  The dimensions
     // may not match _voxelVolumeSize.
 
-    model::MeshPointer _mesh;
+    MeshChunks _meshChunks; // guarded by the entity lock; render() copies the vector
     gpu::Stream::FormatPointer _vertexFormat;
     bool _meshDirty { true }; // does collision-shape need to be recomputed?
     bool _meshInitialized { false };
 
+    // accumulated bounds of edited voxels, in _volData coordinates; empty while min > max.
+    // getMesh() re-extracts only the chunks these touch, then resets them.
+    glm::ivec3 _dirtyVoxelsMin { 0, 0, 0 };
+    glm::ivec3 _dirtyVoxelsMax { -1, -1, -1 };
+    void markVoxelDirty(int x, int y, int z);
+    void markAllVoxelsDirty();
+
     NetworkTexturePointer _xTexture;
     NetworkTexturePointer _yTexture;
     NetworkTexturePointer _zTexture;
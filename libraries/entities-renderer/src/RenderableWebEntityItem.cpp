@@ -39,6 +39,13 @@ static int MAX_WINDOW_SIZE = 4096;
 static float OPAQUE_ALPHA_THRESHOLD = 0.99f;
 static int DEFAULT_MAX_FPS = 10;
 static int YOUTUBE_MAX_FPS = 30;
+// Surfaces too small or distant to read still tick over at this rate so animations don't stall
+static int MIN_THROTTLED_MAX_FPS = 2;
+// Apparent size (largest dimension over distance) above which a surface earns its full rate
+static const float FULL_RATE_APPARENT_SIZE = 0.25f;
+// Freeze a surface that hasn't been rendered for this long (off screen or culled);
+// render() wakes it the moment it's visible again
+static uint64_t PAUSE_NO_RENDER_INTERVAL = USECS_PER_SECOND / 2;
 
 EntityItemPointer RenderableWebEntityItem::factory(const EntityItemID& entityID, const EntityItemProperties& properties) {
     EntityItemPointer entity{ new RenderableWebEntityItem(entityID) };
@@ -113,9 +120,8 @@ bool RenderableWebEntityItem::buildWebSurface(QSharedPointer<EntityTreeRenderer>
     };
     _webSurface = QSharedPointer<OffscreenQmlSurface>(new OffscreenQmlSurface(), deleter);
 
-    // FIXME, the max FPS could be better managed by being dynamic (based on the number of current surfaces
-    // and the current rendering load)
-    _webSurface->setMaxFps(DEFAULT_MAX_FPS);
+    _baseMaxFps = _currentMaxFps = DEFAULT_MAX_FPS;
+    _webSurface->setMaxFps(_baseMaxFps);
 
     // The lifetime of the QML surface MUST be managed by the main thread
     // Additionally, we MUST use local variables copied by value, rather than
@@ -207,6 +213,13 @@ void RenderableWebEntityItem::render(RenderArgs* args) {
 
     _lastRenderTime = usecTimestampNow();
 
+    // Being here means the entity survived frustum culling, so the surface is visible again;
+    // wake it if update() froze it, and rescale its update rate for the current view
+    if (_webSurface->isPaused()) {
+        _webSurface->resume();
+    }
+    updateMaxFps(args);
+
     glm::vec2 windowSize = getWindowSize();
 
     // The offscreen surface is idempotent for resizes (bails early
@@ -252,6 +265,32 @@ void RenderableWebEntityItem::render(RenderArgs* args) {
     DependencyManager::get<GeometryCache>()->renderQuad(batch, topLeft, bottomRight, texMin, texMax, glm::vec4(1.0f, 1.0f, 1.0f, fadeRatio), _geometryId);
 }
 
+void RenderableWebEntityItem::updateMaxFps(RenderArgs* args) {
+    if (!args->hasViewFrustum()) {
+        return;
+    }
+
+    // Scale the surface's update rate by roughly how much of the view it can occupy: a
+    // screen-filling browser earns its full rate, a distant postage stamp just enough to
+    // not look frozen. Surfaces being interacted with always run at full rate.
+    int maxFps = _baseMaxFps;
+    if (!_pressed) {
+        glm::vec3 dims = getDimensions();
+        float diameter = glm::max(dims.x, dims.y);
+        float distance = glm::distance(args->getViewFrustum().getPosition(), getPosition());
+        float apparentSize = diameter / glm::max(distance, diameter);
+        if (apparentSize < FULL_RATE_APPARENT_SIZE) {
+            maxFps = glm::clamp((int)(_baseMaxFps * (apparentSize / FULL_RATE_APPARENT_SIZE)),
+                                MIN_THROTTLED_MAX_FPS, _baseMaxFps);
+        }
+    }
+
+    if (maxFps != _currentMaxFps) {
+        _currentMaxFps = maxFps;
+        _webSurface->setMaxFps(maxFps);
+    }
+}
+
 void RenderableWebEntityItem::loadSourceURL() {
     QUrl sourceUrl(_sourceUrl);
     if (sourceUrl.scheme() == "http" || sourceUrl.scheme() == "https" ||
@@ -261,10 +300,12 @@ void RenderableWebEntityItem::loadSourceURL() {
 
         // We special case YouTube URLs since we know they are videos that we should play with at least 30 FPS.
         if (sourceUrl.host().endsWith("youtube.com", Qt::CaseInsensitive)) {
-            _webSurface->setMaxFps(YOUTUBE_MAX_FPS);
+            _baseMaxFps = YOUTUBE_MAX_FPS;
         } else {
-            _webSurface->setMaxFps(DEFAULT_MAX_FPS);
+            _baseMaxFps = DEFAULT_MAX_FPS;
         }
+        _currentMaxFps = _baseMaxFps;
+        _webSurface->setMaxFps(_baseMaxFps);
 
         _webSurface->load("WebView.qml", [&](QQmlContext* context, QObject* obj) {
             context->setContextProperty("eventBridgeJavaScriptToInject", QVariant(_javaScriptToInject));
@@ -426,6 +467,10 @@ void RenderableWebEntityItem::update(const quint64& now) {
     auto interval = now - _lastRenderTime;
     if (interval > MAX_NO_RENDER_INTERVAL) {
         destroyWebSurface();
+    } else if (_webSurface && !_webSurface->isPaused() && !_pressed && interval > PAUSE_NO_RENDER_INTERVAL) {
+        // Culled out of view but not yet idle long enough to tear down - freeze it so it
+        // stops consuming frame time until render() sees it again
+        _webSurface->pause();
     }
 }
 
@@ -60,6 +60,7 @@ public:
 private:
     bool buildWebSurface(QSharedPointer<EntityTreeRenderer> renderer);
     void destroyWebSurface();
+    void updateMaxFps(RenderArgs* args);
     glm::vec2 getWindowSize() const;
 
     QSharedPointer<OffscreenQmlSurface> _webSurface;
@@ -67,6 +68,8 @@ private:
     gpu::TexturePointer _texture;
     bool _pressed{ false };
     uint64_t _lastRenderTime{ 0 };
+    int _baseMaxFps { 0 }; // the surface's content-determined rate; throttled by view coverage
+    int _currentMaxFps { 0 };
     QTouchDevice _touchDevice;
 
     QMetaObject::Connection _mousePressConnection;
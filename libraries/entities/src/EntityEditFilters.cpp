@@ -63,6 +63,11 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
             }
             auto oldProperties = propertiesIn.getDesiredProperties();
             auto specifiedProperties = propertiesIn.getChangedProperties();
+            if (!filterData.wantsAllProperties) {
+                // only materialize the properties the filter declared it reads; the rest of the
+                // edit isn't marshalled into the script engine and passes through untouched
+                specifiedProperties &= filterData.wantedProperties;
+            }
             propertiesIn.setDesiredProperties(specifiedProperties);
             QScriptValue inputValues = propertiesIn.copyToScriptValue(filterData.engine, false, true, true);
             propertiesIn.setDesiredProperties(oldProperties);
@@ -213,9 +218,18 @@ void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
                     qDebug() << "Filter function specified but not found. Will reject all edits for those without lock rights.";
                     delete engine;
                     filterData.rejectAll=true;
+                } else {
+                    // a filter may limit what gets marshalled into the script engine per edit by
+                    // listing the properties it reads, e.g. filter.wantedProperties = ["position"];
+                    // unlisted properties then bypass the filter (and its marshalling) entirely
+                    QScriptValue wantedProperties = filterData.filterFn.property("wantedProperties");
+                    if (wantedProperties.isString() || wantedProperties.isArray()) {
+                        filterData.wantsAllProperties = false;
+                        EntityItemProperties::entityPropertyFlagsFromScriptValue(wantedProperties, filterData.wantedProperties);
+                    }
                 }
-               
-                
+
+
                 _lock.lockForWrite();
                 _filterDataMap.insert(entityID, filterData);
                 _lock.unlock();
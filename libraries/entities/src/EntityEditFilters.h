@@ -31,8 +31,10 @@ public:
         std::function<bool()> uncaughtExceptions;
         QScriptEngine* engine;
         bool rejectAll;
-        
-        FilterData(): engine(nullptr), rejectAll(false) {};
+        bool wantsAllProperties;
+        EntityPropertyFlags wantedProperties;
+
+        FilterData(): engine(nullptr), rejectAll(false), wantsAllProperties(true) {};
         bool valid() { return (rejectAll || (engine != nullptr && filterFn.isFunction() && uncaughtExceptions)); }
     };
 
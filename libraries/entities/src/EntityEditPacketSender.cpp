@@ -87,6 +87,55 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
         return;
     }
 
+    glm::vec3 routingPosition = evalRoutingPosition(entityTree, entityItemID, properties);
+
+    if (type == PacketType::EntityEdit) {
+        // stage the edit rather than encoding it immediately. Scripts frequently edit the same
+        // entity several times between frames (e.g. position then rotation then velocity in one
+        // update) and each call would otherwise become its own message on the wire. The staged
+        // edits are merged per entity and encoded when releaseQueuedMessages() runs at the end
+        // of the script frame.
+        QMutexLocker lock(&_pendingEntityEditsLock);
+        auto itr = _pendingEntityEdits.find(entityItemID);
+        if (itr == _pendingEntityEdits.end()) {
+            StagedEntityEdit stagedEdit;
+            stagedEdit.properties = properties;
+            stagedEdit.routingPosition = routingPosition;
+            _pendingEntityEdits.insert(entityItemID, stagedEdit);
+        } else {
+            // later values for the same property win
+            itr.value().properties.merge(properties);
+            itr.value().properties.setLastEdited(properties.getLastEdited());
+            itr.value().routingPosition = routingPosition;
+        }
+        return;
+    }
+
+    // EntityAdd and EntityPhysics are not coalesced. If we have a staged edit for this entity,
+    // release it first so messages for the same entity keep their original order.
+    flushPendingEntityEdit(entityItemID);
+
+    encodeAndQueueEditEntityMessage(type, entityItemID, properties, routingPosition);
+}
+
+glm::vec3 EntityEditPacketSender::evalRoutingPosition(EntityTreePointer entityTree, EntityItemID entityItemID,
+                                                      const EntityItemProperties& properties) const {
+    if (properties.positionChanged()) {
+        return properties.getPosition();
+    }
+    if (entityTree) {
+        EntityItemPointer entity = entityTree->findEntityByEntityItemID(entityItemID);
+        if (entity) {
+            return entity->getPosition();
+        }
+    }
+    // unknown entity and no position in the edit; the origin cell's server gets it
+    return glm::vec3(0.0f);
+}
+
+void EntityEditPacketSender::encodeAndQueueEditEntityMessage(PacketType type, EntityItemID entityItemID,
+                                                             const EntityItemProperties& properties,
+                                                             const glm::vec3& routingPosition) {
     QByteArray bufferOut(NLPacket::maxPayloadSize(type), 0);
 
     bool success;
@@ -95,9 +144,9 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
         auto nodeList = DependencyManager::get<NodeList>();
         const QUuid myNodeID = nodeList->getSessionUUID();
         propertiesCopy.setParentID(myNodeID);
-        success = EntityItemProperties::encodeEntityEditPacket(type, entityItemID, propertiesCopy, bufferOut);
+        success = EntityItemProperties::encodeEntityEditPacket(type, entityItemID, propertiesCopy, routingPosition, bufferOut);
     } else {
-        success = EntityItemProperties::encodeEntityEditPacket(type, entityItemID, properties, bufferOut);
+        success = EntityItemProperties::encodeEntityEditPacket(type, entityItemID, properties, routingPosition, bufferOut);
     }
 
     if (success) {
@@ -110,11 +159,44 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
     }
 }
 
+void EntityEditPacketSender::flushPendingEntityEdit(EntityItemID entityItemID) {
+    StagedEntityEdit staged;
+    bool found = false;
+    {
+        QMutexLocker lock(&_pendingEntityEditsLock);
+        auto itr = _pendingEntityEdits.find(entityItemID);
+        if (itr != _pendingEntityEdits.end()) {
+            staged = itr.value();
+            found = true;
+            _pendingEntityEdits.erase(itr);
+        }
+    }
+    if (found) {
+        encodeAndQueueEditEntityMessage(PacketType::EntityEdit, entityItemID, staged.properties, staged.routingPosition);
+    }
+}
+
+void EntityEditPacketSender::releaseQueuedMessages() {
+    QHash<EntityItemID, StagedEntityEdit> pendingEntityEdits;
+    {
+        QMutexLocker lock(&_pendingEntityEditsLock);
+        _pendingEntityEdits.swap(pendingEntityEdits);
+    }
+    for (auto itr = pendingEntityEdits.begin(); itr != pendingEntityEdits.end(); ++itr) {
+        encodeAndQueueEditEntityMessage(PacketType::EntityEdit, itr.key(), itr.value().properties, itr.value().routingPosition);
+    }
+    OctreeEditPacketSender::releaseQueuedMessages();
+}
+
 void EntityEditPacketSender::queueEraseEntityMessage(const EntityItemID& entityItemID) {
     if (!_shouldSend) {
         return; // bail early
     }
 
+    // a staged edit for an entity we're about to erase is moot, but if one exists we release it
+    // ahead of the erase so the messages arrive in the order they were queued
+    flushPendingEntityEdit(entityItemID);
+
     // in case this was a clientOnly entity:
     if(_myAvatar) {
         _myAvatar->clearAvatarEntity(entityItemID);
@@ -37,6 +37,10 @@ public:
 
     void queueEraseEntityMessage(const EntityItemID& entityItemID);
 
+    /// Releases queued messages, first encoding and queueing any per-entity coalesced edits
+    /// staged since the last release.
+    virtual void releaseQueuedMessages() override;
+
     // My server type is the model server
     virtual char getMyNodeType() const override { return NodeType::EntityServer; }
     virtual void adjustEditPacketForClockSkew(PacketType type, QByteArray& buffer, qint64 clockSkew) override;
@@ -48,8 +52,32 @@ private:
     void queueEditAvatarEntityMessage(PacketType type, EntityTreePointer entityTree,
                                       EntityItemID entityItemID, const EntityItemProperties& properties);
 
+    /// encodes the edit and appends it to the per-server buffered packets; routingPosition
+    /// selects the entity server whose jurisdiction receives the edit
+    void encodeAndQueueEditEntityMessage(PacketType type, EntityItemID entityItemID,
+                                         const EntityItemProperties& properties, const glm::vec3& routingPosition);
+
+    /// resolve the world position this message routes by: the new position if the edit moves
+    /// the entity, otherwise the entity's current position in the tree
+    glm::vec3 evalRoutingPosition(EntityTreePointer entityTree, EntityItemID entityItemID,
+                                  const EntityItemProperties& properties) const;
+
+    /// if a coalesced edit is staged for this entity, encode and queue it now so a following
+    /// message for the same entity can't jump ahead of it
+    void flushPendingEntityEdit(EntityItemID entityItemID);
+
 private:
     AvatarData* _myAvatar { nullptr };
     QScriptEngine _scriptEngine;
+
+    // edits staged per entity between releaseQueuedMessages() calls - scripts animating an
+    // entity queue many small edits per frame and these merge into one message at release
+    class StagedEntityEdit {
+    public:
+        EntityItemProperties properties;
+        glm::vec3 routingPosition;
+    };
+    QMutex _pendingEntityEditsLock;
+    QHash<EntityItemID, StagedEntityEdit> _pendingEntityEdits;
 };
 #endif // hifi_EntityEditPacketSender_h
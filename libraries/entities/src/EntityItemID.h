@@ -20,6 +20,8 @@
 #include <QScriptEngine>
 #include <QUuid>
 
+#include <UUIDHasher.h>
+
 const QUuid UNKNOWN_ENTITY_ID; // null uuid
 
 /// Abstract ID for editing model items. Used in EntityItem JS API.
@@ -39,6 +41,12 @@ inline QDebug operator<<(QDebug debug, const EntityItemID& id) {
     return debug;
 }
 
+namespace std {
+    template <> struct hash<EntityItemID> {
+        size_t operator()(const EntityItemID& id) const { return hash<QUuid>()(id); }
+    };
+}
+
 Q_DECLARE_METATYPE(EntityItemID);
 Q_DECLARE_METATYPE(QVector<EntityItemID>);
 QScriptValue EntityItemIDtoScriptValue(QScriptEngine* engine, const EntityItemID& properties);
@@ -9,6 +9,8 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <array>
+
 #include <QDebug>
 #include <QHash>
 #include <QObject>
@@ -1108,23 +1110,173 @@ void EntityItemProperties::entityPropertyFlagsFromScriptValue(const QScriptValue
 //
 // TODO: Implement support for script and visible properties.
 //
+EntityPropertyFlags EntityItemProperties::propertiesEncodedForType(EntityTypes::EntityType type) {
+    // Layout tables for the encoder below, built once and cached. Each table must be a
+    // superset of the properties encodeEntityEditPacket() appends for that type: the
+    // encoder uses them to compute its final property flags before appending anything,
+    // and a table missing a property would make the reserved flag field too small.
+    static const auto perTypeProperties = [] {
+        std::array<EntityPropertyFlags, EntityTypes::LAST + 1> tables;
+        EncodeBitstreamParams params; // the group tables don't depend on these
+
+        EntityPropertyFlags common;
+        common += PROP_SIMULATION_OWNER;
+        common += PROP_POSITION;
+        common += PROP_DIMENSIONS;
+        common += PROP_ROTATION;
+        common += PROP_DENSITY;
+        common += PROP_VELOCITY;
+        common += PROP_GRAVITY;
+        common += PROP_ACCELERATION;
+        common += PROP_DAMPING;
+        common += PROP_RESTITUTION;
+        common += PROP_FRICTION;
+        common += PROP_LIFETIME;
+        common += PROP_SCRIPT;
+        common += PROP_SCRIPT_TIMESTAMP;
+        common += PROP_SERVER_SCRIPTS;
+        common += PROP_COLOR;
+        common += PROP_REGISTRATION_POINT;
+        common += PROP_ANGULAR_VELOCITY;
+        common += PROP_ANGULAR_DAMPING;
+        common += PROP_VISIBLE;
+        common += PROP_COLLISIONLESS;
+        common += PROP_COLLISION_MASK;
+        common += PROP_DYNAMIC;
+        common += PROP_LOCKED;
+        common += PROP_USER_DATA;
+        common += PROP_HREF;
+        common += PROP_DESCRIPTION;
+        common += PROP_PARENT_ID;
+        common += PROP_PARENT_JOINT_INDEX;
+        common += PROP_QUERY_AA_CUBE;
+        common += PROP_MARKETPLACE_ID;
+        common += PROP_NAME;
+        common += PROP_COLLISION_SOUND_URL;
+        common += PROP_ACTION_DATA;
+        common += PROP_ALPHA;
+
+        for (int type = 0; type <= EntityTypes::LAST; type++) {
+            tables[type] = common;
+        }
+
+        tables[EntityTypes::Web] += PROP_SOURCE_URL;
+        tables[EntityTypes::Web] += PROP_DPI;
+
+        tables[EntityTypes::Text] += PROP_TEXT;
+        tables[EntityTypes::Text] += PROP_LINE_HEIGHT;
+        tables[EntityTypes::Text] += PROP_TEXT_COLOR;
+        tables[EntityTypes::Text] += PROP_BACKGROUND_COLOR;
+        tables[EntityTypes::Text] += PROP_FACE_CAMERA;
+
+        tables[EntityTypes::Model] += PROP_MODEL_URL;
+        tables[EntityTypes::Model] += PROP_COMPOUND_SHAPE_URL;
+        tables[EntityTypes::Model] += PROP_TEXTURES;
+        tables[EntityTypes::Model] += PROP_SHAPE_TYPE;
+        tables[EntityTypes::Model] += _staticAnimation.getEntityProperties(params);
+        tables[EntityTypes::Model] += PROP_JOINT_ROTATIONS_SET;
+        tables[EntityTypes::Model] += PROP_JOINT_ROTATIONS;
+        tables[EntityTypes::Model] += PROP_JOINT_TRANSLATIONS_SET;
+        tables[EntityTypes::Model] += PROP_JOINT_TRANSLATIONS;
+
+        tables[EntityTypes::Light] += PROP_IS_SPOTLIGHT;
+        tables[EntityTypes::Light] += PROP_INTENSITY;
+        tables[EntityTypes::Light] += PROP_FALLOFF_RADIUS;
+        tables[EntityTypes::Light] += PROP_EXPONENT;
+        tables[EntityTypes::Light] += PROP_CUTOFF;
+
+        tables[EntityTypes::ParticleEffect] += PROP_TEXTURES;
+        tables[EntityTypes::ParticleEffect] += PROP_MAX_PARTICLES;
+        tables[EntityTypes::ParticleEffect] += PROP_LIFESPAN;
+        tables[EntityTypes::ParticleEffect] += PROP_EMITTING_PARTICLES;
+        tables[EntityTypes::ParticleEffect] += PROP_EMIT_RATE;
+        tables[EntityTypes::ParticleEffect] += PROP_EMIT_SPEED;
+        tables[EntityTypes::ParticleEffect] += PROP_SPEED_SPREAD;
+        tables[EntityTypes::ParticleEffect] += PROP_EMIT_ORIENTATION;
+        tables[EntityTypes::ParticleEffect] += PROP_EMIT_DIMENSIONS;
+        tables[EntityTypes::ParticleEffect] += PROP_EMIT_RADIUS_START;
+        tables[EntityTypes::ParticleEffect] += PROP_POLAR_START;
+        tables[EntityTypes::ParticleEffect] += PROP_POLAR_FINISH;
+        tables[EntityTypes::ParticleEffect] += PROP_AZIMUTH_START;
+        tables[EntityTypes::ParticleEffect] += PROP_AZIMUTH_FINISH;
+        tables[EntityTypes::ParticleEffect] += PROP_EMIT_ACCELERATION;
+        tables[EntityTypes::ParticleEffect] += PROP_ACCELERATION_SPREAD;
+        tables[EntityTypes::ParticleEffect] += PROP_PARTICLE_RADIUS;
+        tables[EntityTypes::ParticleEffect] += PROP_RADIUS_SPREAD;
+        tables[EntityTypes::ParticleEffect] += PROP_RADIUS_START;
+        tables[EntityTypes::ParticleEffect] += PROP_RADIUS_FINISH;
+        tables[EntityTypes::ParticleEffect] += PROP_COLOR_SPREAD;
+        tables[EntityTypes::ParticleEffect] += PROP_COLOR_START;
+        tables[EntityTypes::ParticleEffect] += PROP_COLOR_FINISH;
+        tables[EntityTypes::ParticleEffect] += PROP_ALPHA_SPREAD;
+        tables[EntityTypes::ParticleEffect] += PROP_ALPHA_START;
+        tables[EntityTypes::ParticleEffect] += PROP_ALPHA_FINISH;
+        tables[EntityTypes::ParticleEffect] += PROP_EMITTER_SHOULD_TRAIL;
+
+        tables[EntityTypes::Zone] += _staticKeyLight.getEntityProperties(params);
+        tables[EntityTypes::Zone] += _staticStage.getEntityProperties(params);
+        tables[EntityTypes::Zone] += PROP_SHAPE_TYPE;
+        tables[EntityTypes::Zone] += PROP_COMPOUND_SHAPE_URL;
+        tables[EntityTypes::Zone] += PROP_BACKGROUND_MODE;
+        tables[EntityTypes::Zone] += _staticSkybox.getEntityProperties(params);
+        tables[EntityTypes::Zone] += PROP_FLYING_ALLOWED;
+        tables[EntityTypes::Zone] += PROP_GHOSTING_ALLOWED;
+        tables[EntityTypes::Zone] += PROP_FILTER_URL;
+
+        tables[EntityTypes::PolyVox] += PROP_VOXEL_VOLUME_SIZE;
+        tables[EntityTypes::PolyVox] += PROP_VOXEL_DATA;
+        tables[EntityTypes::PolyVox] += PROP_VOXEL_SURFACE_STYLE;
+        tables[EntityTypes::PolyVox] += PROP_X_TEXTURE_URL;
+        tables[EntityTypes::PolyVox] += PROP_Y_TEXTURE_URL;
+        tables[EntityTypes::PolyVox] += PROP_Z_TEXTURE_URL;
+        tables[EntityTypes::PolyVox] += PROP_X_N_NEIGHBOR_ID;
+        tables[EntityTypes::PolyVox] += PROP_Y_N_NEIGHBOR_ID;
+        tables[EntityTypes::PolyVox] += PROP_Z_N_NEIGHBOR_ID;
+        tables[EntityTypes::PolyVox] += PROP_X_P_NEIGHBOR_ID;
+        tables[EntityTypes::PolyVox] += PROP_Y_P_NEIGHBOR_ID;
+        tables[EntityTypes::PolyVox] += PROP_Z_P_NEIGHBOR_ID;
+
+        tables[EntityTypes::Line] += PROP_LINE_WIDTH;
+        tables[EntityTypes::Line] += PROP_LINE_POINTS;
+
+        tables[EntityTypes::PolyLine] += PROP_LINE_WIDTH;
+        tables[EntityTypes::PolyLine] += PROP_LINE_POINTS;
+        tables[EntityTypes::PolyLine] += PROP_NORMALS;
+        tables[EntityTypes::PolyLine] += PROP_STROKE_WIDTHS;
+        tables[EntityTypes::PolyLine] += PROP_TEXTURES;
+
+        tables[EntityTypes::Shape] += PROP_SHAPE;
+        tables[EntityTypes::Box] += PROP_SHAPE;
+        tables[EntityTypes::Sphere] += PROP_SHAPE;
+
+        return tables;
+    }();
+
+    if (type < 0 || type > EntityTypes::LAST) {
+        type = EntityTypes::Unknown;
+    }
+    return perTypeProperties[type];
+}
+
 bool EntityItemProperties::encodeEntityEditPacket(PacketType command, EntityItemID id, const EntityItemProperties& properties,
-                                                  QByteArray& buffer) {
+                                                  const glm::vec3& routingPosition, QByteArray& buffer) {
     OctreePacketData ourDataPacket(false, buffer.size()); // create a packetData object to add out packet details too.
     OctreePacketData* packetData = &ourDataPacket; // we want a pointer to this so we can use our APPEND_ENTITY_PROPERTY macro
 
     bool success = true; // assume the best
     OctreeElement::AppendState appendState = OctreeElement::COMPLETED; // assume the best
 
-    // TODO: We need to review how jurisdictions should be handled for entities. (The old Models and Particles code
-    // didn't do anything special for jurisdictions, so we're keeping that same behavior here.)
-    //
-    // Always include the root octcode. This is only because the OctreeEditPacketSender will check these octcodes
-    // to determine which server to send the changes to in the case of multiple jurisdictions. The root will be sent
-    // to all servers.
-    glm::vec3 rootPosition(0);
-    float rootScale = 0.5f;
-    unsigned char* octcode = pointToOctalCode(rootPosition.x, rootPosition.y, rootPosition.z, rootScale);
+    // Lead with the octcode of the cell containing the edit's position. The server ignores it,
+    // but the OctreeEditPacketSender checks it against each entity server's jurisdiction to
+    // route the edit when the domain is partitioned across several servers. The code is fixed
+    // at a depth well below any practical jurisdiction root, so it always lands within exactly
+    // the server owning that region.
+    const int ROUTING_OCTCODE_DEPTH = 10; // 32m cells: TREE_SCALE / 2^10
+    const float routingCellScale = 1.0f / (float)(1 << ROUTING_OCTCODE_DEPTH);
+    glm::vec3 normalizedPosition = (routingPosition + (float)HALF_TREE_SCALE) / (float)TREE_SCALE;
+    normalizedPosition = glm::clamp(normalizedPosition, 0.0f, 1.0f - routingCellScale);
+    unsigned char* octcode = pointToOctalCode(normalizedPosition.x, normalizedPosition.y, normalizedPosition.z,
+                                              routingCellScale);
 
     success = packetData->startSubTree(octcode);
     delete[] octcode;
@@ -1150,10 +1302,17 @@ bool EntityItemProperties::encodeEntityEditPacket(PacketType command, EntityItem
         ByteCountCoded<quint64> updateDeltaCoder = updateDelta;
         QByteArray encodedUpdateDelta = updateDeltaCoder;
 
-        EntityPropertyFlags propertyFlags(PROP_LAST_ITEM);
+        EntityPropertyFlags propertyFlags; // accumulates the properties actually appended
         EntityPropertyFlags requestedProperties = properties.getChangedProperties();
         EntityPropertyFlags propertiesDidntFit = requestedProperties;
 
+        // Single-pass flag layout: the append chain below packs exactly the requested
+        // properties this entity type carries, so the final property flags can be computed
+        // and encoded at their real size up front, instead of reserving a worst-case flag
+        // field and shifting the whole payload down afterwards. Only a property failing to
+        // fit in the buffer forces the rewrite path after the appends.
+        EntityPropertyFlags expectedFlags = requestedProperties & propertiesEncodedForType(properties.getType());
+
         // TODO: we need to handle the multi-pass form of this, similar to how we handle entity data
         //
         // If we are being called for a subsequent pass at appendEntityData() that failed to completely encode this item,
@@ -1183,7 +1342,7 @@ bool EntityItemProperties::encodeEntityEditPacket(PacketType command, EntityItem
         bool successLastUpdatedFits = packetData->appendRawData(encodedUpdateDelta);
 
         int propertyFlagsOffset = packetData->getUncompressedByteOffset();
-        QByteArray encodedPropertyFlags = propertyFlags;
+        QByteArray encodedPropertyFlags = expectedFlags;
         int oldPropertyFlagsLength = encodedPropertyFlags.length();
         bool successPropertyFlagsFits = packetData->appendRawData(encodedPropertyFlags);
         int propertyCount = 0;
@@ -1195,7 +1354,6 @@ bool EntityItemProperties::encodeEntityEditPacket(PacketType command, EntityItem
 
         if (headerFits) {
             bool successPropertyFits;
-            propertyFlags -= PROP_LAST_ITEM; // clear the last item for now, we may or may not set it as the actual item
 
             // These items would go here once supported....
             //      PROP_PAGED_PROPERTY,
@@ -1361,27 +1519,31 @@ bool EntityItemProperties::encodeEntityEditPacket(PacketType command, EntityItem
         }
 
         if (propertyCount > 0) {
-            int endOfEntityItemData = packetData->getUncompressedByteOffset();
-
-            encodedPropertyFlags = propertyFlags;
-            int newPropertyFlagsLength = encodedPropertyFlags.length();
-            packetData->updatePriorBytes(propertyFlagsOffset,
-                                         (const unsigned char*)encodedPropertyFlags.constData(), encodedPropertyFlags.length());
-
-            // if the size of the PropertyFlags shrunk, we need to shift everything down to front of packet.
-            if (newPropertyFlagsLength < oldPropertyFlagsLength) {
-                int oldSize = packetData->getUncompressedSize();
-
-                const unsigned char* modelItemData = packetData->getUncompressedData(propertyFlagsOffset + oldPropertyFlagsLength);
-                int modelItemDataLength = endOfEntityItemData - startOfEntityItemData;
-                int newEntityItemDataStart = propertyFlagsOffset + newPropertyFlagsLength;
-                packetData->updatePriorBytes(newEntityItemDataStart, modelItemData, modelItemDataLength);
-
-                int newSize = oldSize - (oldPropertyFlagsLength - newPropertyFlagsLength);
-                packetData->setUncompressedSize(newSize);
-
-            } else {
-                assert(newPropertyFlagsLength == oldPropertyFlagsLength); // should not have grown
+            // in the common case everything requested fit, the flags written up front are
+            // already correct, and no rewrite or payload shift is needed
+            if (!(propertyFlags == expectedFlags)) {
+                int endOfEntityItemData = packetData->getUncompressedByteOffset();
+
+                encodedPropertyFlags = propertyFlags;
+                int newPropertyFlagsLength = encodedPropertyFlags.length();
+                packetData->updatePriorBytes(propertyFlagsOffset,
+                                             (const unsigned char*)encodedPropertyFlags.constData(), encodedPropertyFlags.length());
+
+                // if the size of the PropertyFlags shrunk, we need to shift everything down to front of packet.
+                if (newPropertyFlagsLength < oldPropertyFlagsLength) {
+                    int oldSize = packetData->getUncompressedSize();
+
+                    const unsigned char* modelItemData = packetData->getUncompressedData(propertyFlagsOffset + oldPropertyFlagsLength);
+                    int modelItemDataLength = endOfEntityItemData - startOfEntityItemData;
+                    int newEntityItemDataStart = propertyFlagsOffset + newPropertyFlagsLength;
+                    packetData->updatePriorBytes(newEntityItemDataStart, modelItemData, modelItemDataLength);
+
+                    int newSize = oldSize - (oldPropertyFlagsLength - newPropertyFlagsLength);
+                    packetData->setUncompressedSize(newSize);
+
+                } else {
+                    assert(newPropertyFlagsLength == oldPropertyFlagsLength); // should not have grown
+                }
             }
 
             packetData->endLevel(entityLevel);
@@ -242,8 +242,15 @@ public:
     float getLocalRenderAlpha() const { return _localRenderAlpha; }
     void setLocalRenderAlpha(float value) { _localRenderAlpha = value; _localRenderAlphaChanged = true; }
 
+    /// routingPosition is the world position the edit pertains to; it is encoded as the leading
+    /// octcode of the message so the edit packet sender can route the edit to the entity server
+    /// whose jurisdiction contains it
     static bool encodeEntityEditPacket(PacketType command, EntityItemID id, const EntityItemProperties& properties,
-                                       QByteArray& buffer);
+                                       const glm::vec3& routingPosition, QByteArray& buffer);
+
+    /// every property the edit-packet encoder can pack for entities of the given type;
+    /// built once per type and cached
+    static EntityPropertyFlags propertiesEncodedForType(EntityTypes::EntityType type);
 
     static bool encodeEraseEntityMessage(const EntityItemID& entityItemID, QByteArray& buffer);
 
@@ -340,6 +347,7 @@ private:
 };
 
 Q_DECLARE_METATYPE(EntityItemProperties);
+Q_DECLARE_METATYPE(QVector<EntityItemProperties>);
 QScriptValue EntityItemPropertiesToScriptValue(QScriptEngine* engine, const EntityItemProperties& properties);
 QScriptValue EntityItemNonDefaultPropertiesToScriptValue(QScriptEngine* engine, const EntityItemProperties& properties);
 void EntityItemPropertiesFromScriptValueIgnoreReadOnly(const QScriptValue& object, EntityItemProperties& properties);
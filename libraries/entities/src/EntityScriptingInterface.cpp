@@ -39,6 +39,16 @@ EntityScriptingInterface::EntityScriptingInterface(bool bidOnSimulationOwnership
     connect(nodeList.data(), &NodeList::canRezChanged, this, &EntityScriptingInterface::canRezChanged);
     connect(nodeList.data(), &NodeList::canRezTmpChanged, this, &EntityScriptingInterface::canRezTmpChanged);
     connect(nodeList.data(), &NodeList::canWriteAssetsChanged, this, &EntityScriptingInterface::canWriteAssetsChanged);
+
+    // the delta signal crosses from this object's thread to script threads via queued connections
+    qRegisterMetaType<QVector<QUuid>>("QVector<QUuid>");
+
+    // all persistent queries share one evaluation pass (and one tree read lock) per tick;
+    // the cadence matches the 10Hz at which scripts typically poll findEntities() today
+    const int QUERY_UPDATE_INTERVAL_MSECS = 100;
+    _queryUpdateTimer.setInterval(QUERY_UPDATE_INTERVAL_MSECS);
+    connect(&_queryUpdateTimer, &QTimer::timeout, this, &EntityScriptingInterface::evaluateEntityQueries);
+    _queryUpdateTimer.start();
 }
 
 void EntityScriptingInterface::queueEntityMessage(PacketType packetType,
@@ -88,93 +98,89 @@ void EntityScriptingInterface::setEntityTree(EntityTreePointer elementTree) {
     }
 }
 
-EntityItemProperties convertLocationToScriptSemantics(const EntityItemProperties& entitySideProperties) {
+// These conversions are performed in place - the properties object is ~100 fields, and the hot
+// script edit path was paying for a full copy (and another on return) just to rewrite four of them.
+void convertLocationToScriptSemantics(EntityItemProperties& properties) {
     // In EntityTree code, properties.position and properties.rotation are relative to the parent.  In javascript,
     // they are in world-space.  The local versions are put into localPosition and localRotation and position and
     // rotation are converted from local to world space.
-    EntityItemProperties scriptSideProperties = entitySideProperties;
-    scriptSideProperties.setLocalPosition(entitySideProperties.getPosition());
-    scriptSideProperties.setLocalRotation(entitySideProperties.getRotation());
-    scriptSideProperties.setLocalVelocity(entitySideProperties.getLocalVelocity());
-    scriptSideProperties.setLocalAngularVelocity(entitySideProperties.getLocalAngularVelocity());
+    properties.setLocalPosition(properties.getPosition());
+    properties.setLocalRotation(properties.getRotation());
+    properties.setLocalVelocity(properties.getLocalVelocity());
+    properties.setLocalAngularVelocity(properties.getLocalAngularVelocity());
 
     bool success;
-    glm::vec3 worldPosition = SpatiallyNestable::localToWorld(entitySideProperties.getPosition(),
-                                                              entitySideProperties.getParentID(),
-                                                              entitySideProperties.getParentJointIndex(),
+    glm::vec3 worldPosition = SpatiallyNestable::localToWorld(properties.getPosition(),
+                                                              properties.getParentID(),
+                                                              properties.getParentJointIndex(),
                                                               success);
-    glm::quat worldRotation = SpatiallyNestable::localToWorld(entitySideProperties.getRotation(),
-                                                              entitySideProperties.getParentID(),
-                                                              entitySideProperties.getParentJointIndex(),
+    glm::quat worldRotation = SpatiallyNestable::localToWorld(properties.getRotation(),
+                                                              properties.getParentID(),
+                                                              properties.getParentJointIndex(),
                                                               success);
-    glm::vec3 worldVelocity = SpatiallyNestable::localToWorldVelocity(entitySideProperties.getVelocity(),
-                                                                      entitySideProperties.getParentID(),
-                                                                      entitySideProperties.getParentJointIndex(),
+    glm::vec3 worldVelocity = SpatiallyNestable::localToWorldVelocity(properties.getVelocity(),
+                                                                      properties.getParentID(),
+                                                                      properties.getParentJointIndex(),
                                                                       success);
-    glm::vec3 worldAngularVelocity = SpatiallyNestable::localToWorldAngularVelocity(entitySideProperties.getAngularVelocity(),
-                                                                                    entitySideProperties.getParentID(),
-                                                                                    entitySideProperties.getParentJointIndex(),
+    glm::vec3 worldAngularVelocity = SpatiallyNestable::localToWorldAngularVelocity(properties.getAngularVelocity(),
+                                                                                    properties.getParentID(),
+                                                                                    properties.getParentJointIndex(),
                                                                                     success);
 
-    scriptSideProperties.setPosition(worldPosition);
-    scriptSideProperties.setRotation(worldRotation);
-    scriptSideProperties.setVelocity(worldVelocity);
-    scriptSideProperties.setAngularVelocity(worldAngularVelocity);
-
-    return scriptSideProperties;
+    properties.setPosition(worldPosition);
+    properties.setRotation(worldRotation);
+    properties.setVelocity(worldVelocity);
+    properties.setAngularVelocity(worldAngularVelocity);
 }
 
 
-EntityItemProperties convertLocationFromScriptSemantics(const EntityItemProperties& scriptSideProperties) {
+void convertLocationFromScriptSemantics(EntityItemProperties& properties) {
     // convert position and rotation properties from world-space to local, unless localPosition and localRotation
     // are set.  If they are set, they overwrite position and rotation.
-    EntityItemProperties entitySideProperties = scriptSideProperties;
     bool success;
 
     // TODO -- handle velocity and angularVelocity
 
-    if (scriptSideProperties.localPositionChanged()) {
-        entitySideProperties.setPosition(scriptSideProperties.getLocalPosition());
-    } else if (scriptSideProperties.positionChanged()) {
-        glm::vec3 localPosition = SpatiallyNestable::worldToLocal(entitySideProperties.getPosition(),
-                                                                  entitySideProperties.getParentID(),
-                                                                  entitySideProperties.getParentJointIndex(),
+    if (properties.localPositionChanged()) {
+        properties.setPosition(properties.getLocalPosition());
+    } else if (properties.positionChanged()) {
+        glm::vec3 localPosition = SpatiallyNestable::worldToLocal(properties.getPosition(),
+                                                                  properties.getParentID(),
+                                                                  properties.getParentJointIndex(),
                                                                   success);
-        entitySideProperties.setPosition(localPosition);
+        properties.setPosition(localPosition);
     }
 
-    if (scriptSideProperties.localRotationChanged()) {
-        entitySideProperties.setRotation(scriptSideProperties.getLocalRotation());
-    } else if (scriptSideProperties.rotationChanged()) {
-        glm::quat localRotation = SpatiallyNestable::worldToLocal(entitySideProperties.getRotation(),
-                                                                  entitySideProperties.getParentID(),
-                                                                  entitySideProperties.getParentJointIndex(),
+    if (properties.localRotationChanged()) {
+        properties.setRotation(properties.getLocalRotation());
+    } else if (properties.rotationChanged()) {
+        glm::quat localRotation = SpatiallyNestable::worldToLocal(properties.getRotation(),
+                                                                  properties.getParentID(),
+                                                                  properties.getParentJointIndex(),
                                                                   success);
-        entitySideProperties.setRotation(localRotation);
+        properties.setRotation(localRotation);
     }
 
-    if (scriptSideProperties.localVelocityChanged()) {
-        entitySideProperties.setVelocity(scriptSideProperties.getLocalVelocity());
-    } else if (scriptSideProperties.velocityChanged()) {
-        glm::vec3 localVelocity = SpatiallyNestable::worldToLocalVelocity(entitySideProperties.getVelocity(),
-                                                                          entitySideProperties.getParentID(),
-                                                                          entitySideProperties.getParentJointIndex(),
+    if (properties.localVelocityChanged()) {
+        properties.setVelocity(properties.getLocalVelocity());
+    } else if (properties.velocityChanged()) {
+        glm::vec3 localVelocity = SpatiallyNestable::worldToLocalVelocity(properties.getVelocity(),
+                                                                          properties.getParentID(),
+                                                                          properties.getParentJointIndex(),
                                                                           success);
-        entitySideProperties.setVelocity(localVelocity);
+        properties.setVelocity(localVelocity);
     }
 
-    if (scriptSideProperties.localAngularVelocityChanged()) {
-        entitySideProperties.setAngularVelocity(scriptSideProperties.getLocalAngularVelocity());
-    } else if (scriptSideProperties.angularVelocityChanged()) {
+    if (properties.localAngularVelocityChanged()) {
+        properties.setAngularVelocity(properties.getLocalAngularVelocity());
+    } else if (properties.angularVelocityChanged()) {
         glm::vec3 localAngularVelocity =
-            SpatiallyNestable::worldToLocalAngularVelocity(entitySideProperties.getAngularVelocity(),
-                                                           entitySideProperties.getParentID(),
-                                                           entitySideProperties.getParentJointIndex(),
+            SpatiallyNestable::worldToLocalAngularVelocity(properties.getAngularVelocity(),
+                                                           properties.getParentID(),
+                                                           properties.getParentJointIndex(),
                                                            success);
-        entitySideProperties.setAngularVelocity(localAngularVelocity);
+        properties.setAngularVelocity(localAngularVelocity);
     }
-
-    return entitySideProperties;
 }
 
 
@@ -183,7 +189,8 @@ QUuid EntityScriptingInterface::addEntity(const EntityItemProperties& properties
 
     _activityTracking.addedEntityCount++;
 
-    EntityItemProperties propertiesWithSimID = convertLocationFromScriptSemantics(properties);
+    EntityItemProperties propertiesWithSimID = properties;
+    convertLocationFromScriptSemantics(propertiesWithSimID);
     propertiesWithSimID.setDimensionsInitialized(properties.dimensionsChanged());
 
     if (clientOnly) {
@@ -269,44 +276,88 @@ EntityItemProperties EntityScriptingInterface::getEntityProperties(QUuid identit
         _entityTree->withReadLock([&] {
             EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(identity));
             if (entity) {
-                if (desiredProperties.getHasProperty(PROP_POSITION) ||
-                    desiredProperties.getHasProperty(PROP_ROTATION) ||
-                    desiredProperties.getHasProperty(PROP_LOCAL_POSITION) ||
-                    desiredProperties.getHasProperty(PROP_LOCAL_ROTATION)) {
-                    // if we are explicitly getting position or rotation, we need parent information to make sense of them.
-                    desiredProperties.setHasProperty(PROP_PARENT_ID);
-                    desiredProperties.setHasProperty(PROP_PARENT_JOINT_INDEX);
-                }
+                results = getEntityPropertiesInternal(entity, desiredProperties);
+            }
+        });
+    }
 
-                if (desiredProperties.isEmpty()) {
-                    // these are left out of EntityItem::getEntityProperties so that localPosition and localRotation
-                    // don't end up in json saves, etc.  We still want them here, though.
-                    EncodeBitstreamParams params; // unknown
-                    desiredProperties = entity->getEntityProperties(params);
-                    desiredProperties.setHasProperty(PROP_LOCAL_POSITION);
-                    desiredProperties.setHasProperty(PROP_LOCAL_ROTATION);
-                }
+    convertLocationToScriptSemantics(results);
+    return results;
+}
 
-                results = entity->getProperties(desiredProperties);
-
-                // TODO: improve sitting points and naturalDimensions in the future,
-                //       for now we've included the old sitting points model behavior for entity types that are models
-                //        we've also added this hack for setting natural dimensions of models
-                if (entity->getType() == EntityTypes::Model) {
-                    const FBXGeometry* geometry = _entityTree->getGeometryForEntity(entity);
-                    if (geometry) {
-                        results.setSittingPoints(geometry->sittingPoints);
-                        Extents meshExtents = geometry->getUnscaledMeshExtents();
-                        results.setNaturalDimensions(meshExtents.maximum - meshExtents.minimum);
-                        results.calculateNaturalPosition(meshExtents.minimum, meshExtents.maximum);
-                    }
-                }
+QVector<EntityItemProperties> EntityScriptingInterface::getMultipleEntityProperties(const QVector<QUuid>& entityIDs) {
+    EntityPropertyFlags noSpecificProperties;
+    return getMultipleEntityProperties(entityIDs, noSpecificProperties);
+}
+
+QVector<EntityItemProperties> EntityScriptingInterface::getMultipleEntityProperties(const QVector<QUuid>& entityIDs,
+                                                                                    EntityPropertyFlags desiredProperties) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
 
+    QVector<EntityItemProperties> results;
+    results.reserve(entityIDs.size());
+    if (_entityTree) {
+        // fetch every entity under one acquisition of the tree lock, so polling many
+        // entities per frame doesn't pay the lock and wake-up cost per entity.
+        _entityTree->withReadLock([&] {
+            for (const auto& entityID : entityIDs) {
+                EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(entityID));
+                if (entity) {
+                    results.append(getEntityPropertiesInternal(entity, desiredProperties));
+                } else {
+                    // keep results aligned with entityIDs
+                    results.append(EntityItemProperties());
+                }
             }
         });
+    } else {
+        results.resize(entityIDs.size());
+    }
+
+    for (auto& result : results) {
+        convertLocationToScriptSemantics(result);
+    }
+    return results;
+}
+
+EntityItemProperties EntityScriptingInterface::getEntityPropertiesInternal(EntityItemPointer entity,
+                                                                           EntityPropertyFlags desiredProperties) {
+    EntityItemProperties results;
+
+    if (desiredProperties.getHasProperty(PROP_POSITION) ||
+        desiredProperties.getHasProperty(PROP_ROTATION) ||
+        desiredProperties.getHasProperty(PROP_LOCAL_POSITION) ||
+        desiredProperties.getHasProperty(PROP_LOCAL_ROTATION)) {
+        // if we are explicitly getting position or rotation, we need parent information to make sense of them.
+        desiredProperties.setHasProperty(PROP_PARENT_ID);
+        desiredProperties.setHasProperty(PROP_PARENT_JOINT_INDEX);
+    }
+
+    if (desiredProperties.isEmpty()) {
+        // these are left out of EntityItem::getEntityProperties so that localPosition and localRotation
+        // don't end up in json saves, etc.  We still want them here, though.
+        EncodeBitstreamParams params; // unknown
+        desiredProperties = entity->getEntityProperties(params);
+        desiredProperties.setHasProperty(PROP_LOCAL_POSITION);
+        desiredProperties.setHasProperty(PROP_LOCAL_ROTATION);
+    }
+
+    results = entity->getProperties(desiredProperties);
+
+    // TODO: improve sitting points and naturalDimensions in the future,
+    //       for now we've included the old sitting points model behavior for entity types that are models
+    //        we've also added this hack for setting natural dimensions of models
+    if (entity->getType() == EntityTypes::Model) {
+        const FBXGeometry* geometry = _entityTree->getGeometryForEntity(entity);
+        if (geometry) {
+            results.setSittingPoints(geometry->sittingPoints);
+            Extents meshExtents = geometry->getUnscaledMeshExtents();
+            results.setNaturalDimensions(meshExtents.maximum - meshExtents.minimum);
+            results.calculateNaturalPosition(meshExtents.minimum, meshExtents.maximum);
+        }
     }
 
-    return convertLocationToScriptSemantics(results);
+    return results;
 }
 
 QUuid EntityScriptingInterface::editEntity(QUuid id, const EntityItemProperties& scriptSideProperties) {
@@ -374,7 +425,7 @@ QUuid EntityScriptingInterface::editEntity(QUuid id, const EntityItemProperties&
                 properties.setRotation(entity->getOrientation());
             }
         }
-        properties = convertLocationFromScriptSemantics(properties);
+        convertLocationFromScriptSemantics(properties);
         properties.setClientOnly(entity->getClientOnly());
         properties.setOwningAvatarID(entity->getOwningAvatarID());
 
@@ -633,7 +684,133 @@ QVector<QUuid> EntityScriptingInterface::findEntitiesInFrustum(QVariantMap frust
     return result;
 }
 
-RayToEntityIntersectionResult EntityScriptingInterface::findRayIntersection(const PickRay& ray, bool precisionPicking, 
+QUuid EntityScriptingInterface::addQuery(EntityQuery& query, const QStringList& entityTypes) {
+    foreach (const QString& typeName, entityTypes) {
+        EntityTypes::EntityType type = EntityTypes::getEntityTypeFromName(typeName);
+        if (type != EntityTypes::Unknown) {
+            query.types << type;
+        } else {
+            qCWarning(entities) << "EntityScriptingInterface::addQuery ignoring unknown entity type" << typeName;
+        }
+    }
+
+    QUuid queryID = QUuid::createUuid();
+    std::lock_guard<std::mutex> lock(_queriesLock);
+    _queries.insert(queryID, query);
+    return queryID;
+}
+
+QUuid EntityScriptingInterface::addSphereQuery(const glm::vec3& center, float radius, const QStringList& entityTypes) {
+    EntityQuery query;
+    query.shape = EntityQuery::Sphere;
+    query.center = center;
+    query.radius = radius;
+    return addQuery(query, entityTypes);
+}
+
+QUuid EntityScriptingInterface::addBoxQuery(const glm::vec3& corner, const glm::vec3& dimensions, const QStringList& entityTypes) {
+    EntityQuery query;
+    query.shape = EntityQuery::Box;
+    query.box = AABox(corner, dimensions);
+    return addQuery(query, entityTypes);
+}
+
+QUuid EntityScriptingInterface::addFrustumQuery(QVariantMap frustum, const QStringList& entityTypes) {
+    const QString POSITION_PROPERTY = "position";
+    const QString ORIENTATION_PROPERTY = "orientation";
+    const QString PROJECTION_PROPERTY = "projection";
+    const QString CENTER_RADIUS_PROPERTY = "centerRadius";
+
+    if (!frustum.contains(POSITION_PROPERTY) || !frustum.contains(ORIENTATION_PROPERTY) ||
+        !frustum.contains(PROJECTION_PROPERTY) || !frustum.contains(CENTER_RADIUS_PROPERTY)) {
+        return QUuid();
+    }
+
+    EntityQuery query;
+    query.shape = EntityQuery::Frustum;
+    query.frustum.setPosition(qMapToGlmVec3(frustum[POSITION_PROPERTY]));
+    query.frustum.setOrientation(qMapToGlmQuat(frustum[ORIENTATION_PROPERTY]));
+    query.frustum.setProjection(qMapToGlmMat4(frustum[PROJECTION_PROPERTY]));
+    query.frustum.setCenterRadius(frustum[CENTER_RADIUS_PROPERTY].toFloat());
+    query.frustum.calculate();
+    return addQuery(query, entityTypes);
+}
+
+void EntityScriptingInterface::moveQuery(const QUuid& queryID, const glm::vec3& position) {
+    std::lock_guard<std::mutex> lock(_queriesLock);
+    auto it = _queries.find(queryID);
+    if (it == _queries.end()) {
+        return;
+    }
+    if (it->shape == EntityQuery::Sphere) {
+        it->center = position;
+    } else if (it->shape == EntityQuery::Box) {
+        it->box = AABox(position, it->box.getDimensions());
+    }
+}
+
+void EntityScriptingInterface::removeQuery(const QUuid& queryID) {
+    std::lock_guard<std::mutex> lock(_queriesLock);
+    _queries.remove(queryID);
+}
+
+void EntityScriptingInterface::evaluateEntityQueries() {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    std::lock_guard<std::mutex> lock(_queriesLock);
+    if (_queries.empty() || !_entityTree) {
+        return;
+    }
+
+    // one read lock covers every registered query, no matter how many scripts own one
+    _entityTree->withReadLock([&] {
+        for (auto it = _queries.begin(); it != _queries.end(); ++it) {
+            EntityQuery& query = it.value();
+
+            QVector<EntityItemPointer> entities;
+            switch (query.shape) {
+                case EntityQuery::Sphere:
+                    _entityTree->findEntities(query.center, query.radius, entities);
+                    break;
+                case EntityQuery::Box:
+                    _entityTree->findEntities(query.box, entities);
+                    break;
+                case EntityQuery::Frustum:
+                    _entityTree->findEntities(query.frustum, entities);
+                    break;
+            }
+
+            QSet<QUuid> currentResults;
+            foreach (EntityItemPointer entity, entities) {
+                if (query.types.isEmpty() || query.types.contains(entity->getType())) {
+                    currentResults << entity->getEntityItemID();
+                }
+            }
+
+            if (currentResults == query.lastResults) {
+                continue;
+            }
+
+            QVector<QUuid> added;
+            foreach (const QUuid& id, currentResults) {
+                if (!query.lastResults.contains(id)) {
+                    added << id;
+                }
+            }
+            QVector<QUuid> removed;
+            foreach (const QUuid& id, query.lastResults) {
+                if (!currentResults.contains(id)) {
+                    removed << id;
+                }
+            }
+
+            query.lastResults = currentResults;
+            emit entityQueryResultsChanged(it.key(), added, removed);
+        }
+    });
+}
+
+RayToEntityIntersectionResult EntityScriptingInterface::findRayIntersection(const PickRay& ray, bool precisionPicking,
                 const QScriptValue& entityIdsToInclude, const QScriptValue& entityIdsToDiscard, bool visibleOnly, bool collidableOnly) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -642,6 +819,33 @@ RayToEntityIntersectionResult EntityScriptingInterface::findRayIntersection(cons
     return findRayIntersectionWorker(ray, Octree::Lock, precisionPicking, entitiesToInclude, entitiesToDiscard, visibleOnly, collidableOnly);
 }
 
+QVector<RayToEntityIntersectionResult> EntityScriptingInterface::findRayIntersectionBatch(const QVector<PickRay>& rays,
+                bool precisionPicking, const QScriptValue& entityIdsToInclude, const QScriptValue& entityIdsToDiscard,
+                bool visibleOnly, bool collidableOnly) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    QVector<EntityItemID> entitiesToInclude = qVectorEntityItemIDFromScriptValue(entityIdsToInclude);
+    QVector<EntityItemID> entitiesToDiscard = qVectorEntityItemIDFromScriptValue(entityIdsToDiscard);
+
+    QVector<RayToEntityIntersectionResult> results;
+    results.reserve(rays.size());
+    if (!_entityTree) {
+        results.resize(rays.size());
+        return results;
+    }
+
+    // hold the tree's read lock across all of the rays -- the tree lock is recursive, so the casts
+    // inside re-acquire it for free.  A frame's pick rays pay for one lock acquisition instead of
+    // one each, and all of them resolve against the same snapshot of the tree.
+    _entityTree->withReadLock([&] {
+        for (const PickRay& ray : rays) {
+            results.append(findRayIntersectionWorker(ray, Octree::Lock, precisionPicking,
+                entitiesToInclude, entitiesToDiscard, visibleOnly, collidableOnly));
+        }
+    });
+    return results;
+}
+
 // FIXME - we should remove this API and encourage all users to use findRayIntersection() instead. We've changed
 //         findRayIntersection() to be blocking because it never makes sense for a script to get back a non-answer
 RayToEntityIntersectionResult EntityScriptingInterface::findRayIntersectionBlocking(const PickRay& ray, bool precisionPicking, 
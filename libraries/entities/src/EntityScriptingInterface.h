@@ -16,6 +16,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QStringList>
+#include <QtCore/QTimer>
 #include <QtQml/QJSValue>
 #include <QtQml/QJSValueList>
 
@@ -51,6 +52,7 @@ public:
 };
 
 Q_DECLARE_METATYPE(RayToEntityIntersectionResult)
+Q_DECLARE_METATYPE(QVector<RayToEntityIntersectionResult>)
 
 QScriptValue RayToEntityIntersectionResultToScriptValue(QScriptEngine* engine, const RayToEntityIntersectionResult& results);
 void RayToEntityIntersectionResultFromScriptValue(const QScriptValue& object, RayToEntityIntersectionResult& results);
@@ -144,6 +146,20 @@ public slots:
     Q_INVOKABLE EntityItemProperties getEntityProperties(QUuid entityID);
     Q_INVOKABLE EntityItemProperties getEntityProperties(QUuid identity, EntityPropertyFlags desiredProperties);
 
+    /**jsdoc
+     * Return the properties for several entities in one call, under a single acquisition
+     * of the entity tree lock. Much cheaper than calling getEntityProperties in a loop
+     * when polling many entities per frame.
+     * @param {EntityID[]} entityIDs The IDs of the entities to fetch.
+     * @param {EntityPropertyFlags} [desiredProperties=[]] Array containing the names of the properties you
+     *     would like to get. If the array is empty, all properties will be returned.
+     * @return {EntityItemProperties[]} The properties for each requested entity, in the same order
+     *     as entityIDs. Unknown entities produce an empty properties entry.
+     */
+    Q_INVOKABLE QVector<EntityItemProperties> getMultipleEntityProperties(const QVector<QUuid>& entityIDs);
+    Q_INVOKABLE QVector<EntityItemProperties> getMultipleEntityProperties(const QVector<QUuid>& entityIDs,
+                                                                          EntityPropertyFlags desiredProperties);
+
     /**jsdoc
      * Updates an entity with the specified properties.
      *
@@ -199,6 +215,28 @@ public slots:
     /// this function will not find any models in script engine contexts which don't have access to models
     Q_INVOKABLE QVector<QUuid> findEntitiesInFrustum(QVariantMap frustum) const;
 
+    /// registers a persistent sphere query; all registered queries are re-evaluated together on a fixed
+    /// cadence under a single tree read lock, and changes to the result set are delivered as add/remove
+    /// deltas via the entityQueryResultsChanged signal. entityTypes optionally restricts results to the
+    /// named types (e.g. ["Model", "Light"]); an empty list matches all types.
+    /// prefer this over polling findEntities() from a script timer.
+    Q_INVOKABLE QUuid addSphereQuery(const glm::vec3& center, float radius, const QStringList& entityTypes = QStringList());
+
+    /// registers a persistent box query; see addSphereQuery for delivery semantics
+    Q_INVOKABLE QUuid addBoxQuery(const glm::vec3& corner, const glm::vec3& dimensions, const QStringList& entityTypes = QStringList());
+
+    /// registers a persistent frustum query; the frustum map takes the same properties as
+    /// findEntitiesInFrustum; see addSphereQuery for delivery semantics
+    Q_INVOKABLE QUuid addFrustumQuery(QVariantMap frustum, const QStringList& entityTypes = QStringList());
+
+    /// recenters a registered sphere or box query (e.g. to follow the avatar) without
+    /// discarding its result set, so the next evaluation reports only the entities that
+    /// entered or left; ignored for frustum queries
+    Q_INVOKABLE void moveQuery(const QUuid& queryID, const glm::vec3& position);
+
+    /// unregisters a persistent query; no further entityQueryResultsChanged signals are emitted for it
+    Q_INVOKABLE void removeQuery(const QUuid& queryID);
+
     /// If the scripting context has visible entities, this will determine a ray intersection, the results
     /// may be inaccurate if the engine is unable to access the visible entities, in which case result.accurate
     /// will be false.
@@ -206,6 +244,14 @@ public slots:
         const QScriptValue& entityIdsToInclude = QScriptValue(), const QScriptValue& entityIdsToDiscard = QScriptValue(),
         bool visibleOnly = false, bool collidableOnly = false);
 
+    /// Like findRayIntersection(), but resolves a whole frame's worth of pick rays at once -- e.g. both
+    /// hand lasers plus gaze.  All of the rays are cast against the same snapshot of the entity tree under
+    /// a single lock acquisition, and a result is returned for each ray, in order.
+    Q_INVOKABLE QVector<RayToEntityIntersectionResult> findRayIntersectionBatch(const QVector<PickRay>& rays,
+        bool precisionPicking = false,
+        const QScriptValue& entityIdsToInclude = QScriptValue(), const QScriptValue& entityIdsToDiscard = QScriptValue(),
+        bool visibleOnly = false, bool collidableOnly = false);
+
     /// If the scripting context has visible entities, this will determine a ray intersection, and will block in
     /// order to return an accurate result
     Q_INVOKABLE RayToEntityIntersectionResult findRayIntersectionBlocking(const PickRay& ray, bool precisionPicking = false, const QScriptValue& entityIdsToInclude = QScriptValue(), const QScriptValue& entityIdsToDiscard = QScriptValue());
@@ -323,6 +369,13 @@ signals:
 
     void webEventReceived(const EntityItemID& entityItemID, const QVariant& message);
 
+    /// emitted when a persistent query's result set changes; added/removed hold only the delta
+    /// since the last evaluation, never the full result set
+    void entityQueryResultsChanged(const QUuid& queryID, const QVector<QUuid>& added, const QVector<QUuid>& removed);
+
+private slots:
+    void evaluateEntityQueries();
+
 private:
     bool actionWorker(const QUuid& entityID, std::function<bool(EntitySimulationPointer, EntityItemPointer)> actor);
     bool setVoxels(QUuid entityID, std::function<bool(PolyVoxEntityItem&)> actor);
@@ -332,12 +385,33 @@ private:
     EntityItemPointer checkForTreeEntityAndTypeMatch(const QUuid& entityID,
                                                      EntityTypes::EntityType entityType = EntityTypes::Unknown);
 
+    /// reads the desired properties from one entity; the caller must hold a read lock on the entity tree
+    EntityItemProperties getEntityPropertiesInternal(EntityItemPointer entity, EntityPropertyFlags desiredProperties);
+
 
     /// actually does the work of finding the ray intersection, can be called in locking mode or tryLock mode
     RayToEntityIntersectionResult findRayIntersectionWorker(const PickRay& ray, Octree::lockType lockType,
         bool precisionPicking, const QVector<EntityItemID>& entityIdsToInclude, const QVector<EntityItemID>& entityIdsToDiscard,
         bool visibleOnly = false, bool collidableOnly = false);
 
+    // registered via addSphereQuery and friends; the Q_INVOKABLEs run on script threads while
+    // evaluation runs on this object's thread, hence the lock
+    struct EntityQuery {
+        enum Shape { Sphere, Box, Frustum };
+        Shape shape;
+        glm::vec3 center;
+        float radius { 0.0f };
+        AABox box;
+        ViewFrustum frustum;
+        QVector<EntityTypes::EntityType> types; // empty matches all types
+        QSet<QUuid> lastResults;
+    };
+    QUuid addQuery(EntityQuery& query, const QStringList& entityTypes);
+
+    QHash<QUuid, EntityQuery> _queries;
+    std::mutex _queriesLock;
+    QTimer _queryUpdateTimer;
+
     EntityTreePointer _entityTree;
 
     std::recursive_mutex _entitiesScriptEngineLock;
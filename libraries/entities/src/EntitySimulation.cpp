@@ -39,6 +39,16 @@ void EntitySimulation::updateEntities() {
     sortEntitiesThatMoved();
 }
 
+bool EntitySimulation::hasWorkToDo(quint64 now) {
+    QMutexLocker lock(&_mutex);
+    return now > _nextExpiry
+        || !_entitiesToUpdate.isEmpty()
+        || !_simpleKinematicEntities.isEmpty()
+        || !_entitiesToSort.isEmpty()
+        || !_entitiesToDelete.isEmpty()
+        || hasWorkToDoInternal(now);
+}
+
 void EntitySimulation::takeEntitiesToDelete(VectorOfEntities& entitiesToDelete) {
     QMutexLocker lock(&_mutex);
     for (auto entity : _entitiesToDelete) {
@@ -264,9 +274,15 @@ void EntitySimulation::moveSimpleKinematics(const quint64& now) {
 
         // The entity-server doesn't know where avatars are, so don't attempt to do simple extrapolation for
         // children of avatars.  See related code in EntityMotionState::remoteSimulationOutOfSync.
-        bool ancestryIsKnown;
-        entity->getMaximumAACube(ancestryIsKnown);
-        bool hasAvatarAncestor = entity->hasAncestorOfType(NestableType::Avatar);
+        // Entities with no parent trivially have known ancestry and no avatar ancestor, so for
+        // them (the common case) we skip the two ancestry walks and the AACube that was being
+        // computed only for its success flag.
+        bool ancestryIsKnown = true;
+        bool hasAvatarAncestor = false;
+        if (!entity->getParentID().isNull()) {
+            entity->getMaximumAACube(ancestryIsKnown);
+            hasAvatarAncestor = entity->hasAncestorOfType(NestableType::Avatar);
+        }
 
         if (entity->isMovingRelativeToParent() && !entity->getPhysicsInfo() && ancestryIsKnown && !hasAvatarAncestor) {
             entity->simulate(now);
@@ -57,6 +57,12 @@ public:
 
     void updateEntities();
 
+    /// \return true if the next updateEntities() call would actually do something. Entities at rest
+    /// drop out of the per-tick sets, so when every set is empty and no expiry is due the caller can
+    /// skip the update (and the tree lock it takes) entirely. Wake events - edits, collisions, adds -
+    /// repopulate the sets via addEntity()/changeEntity() and the next poll returns true.
+    bool hasWorkToDo(quint64 now);
+
 //    friend class EntityTree;
 
     virtual void addAction(EntityActionPointer action);
@@ -95,6 +101,10 @@ protected:
     virtual void changeEntityInternal(EntityItemPointer entity);
     virtual void clearEntitiesInternal() = 0;
 
+    /// Override to report pending work in a derived simulation's own lists so hasWorkToDo() doesn't
+    /// put the simulation to sleep while the derived class still has something scheduled.
+    virtual bool hasWorkToDoInternal(const quint64& now) const { return false; }
+
     void expireMortalEntities(const quint64& now);
     void callUpdateOnEntitiesThatNeedIt(const quint64& now);
     virtual void sortEntitiesThatMoved();
@@ -11,8 +11,13 @@
 
 #include <PerfStat.h>
 #include <QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
 #include <QtScript/QScriptEngine>
 
+#include <Gzip.h>
+
 #include "EntityTree.h"
 #include "EntitySimulation.h"
 #include "VariantMapToScriptValue.h"
@@ -88,8 +93,8 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
     }
     {
         QWriteLocker locker(&_entityToElementLock);
-        foreach(EntityTreeElementPointer element, _entityToElementMap) {
-            element->cleanupEntities();
+        for (auto& entry : _entityToElementMap) {
+            entry.second->cleanupEntities();
         }
         _entityToElementMap.clear();
     }
@@ -585,16 +590,59 @@ bool EntityTree::findNearPointOperation(OctreeElementPointer element, void* extr
     return false;
 }
 
-bool findRayIntersectionOp(OctreeElementPointer element, void* extraData) {
-    RayArgs* args = static_cast<RayArgs*>(extraData);
+// Ray casts use their own recursion rather than recurseTreeWithOperation().  The octree is
+// already a bounding hierarchy over entity bounds -- each entity lives in the smallest element
+// whose cube contains it, and re-homes as it moves -- so by descending into children in the
+// order the ray enters their cubes, we can stop as soon as the nearest untested cube is farther
+// than the best hit found so far instead of visiting every cube the ray touches.
+void findRayIntersectionRecurse(EntityTreeElementPointer element, RayArgs& args) {
     bool keepSearching = true;
-    EntityTreeElementPointer entityTreeElementPointer = std::dynamic_pointer_cast<EntityTreeElement>(element);
-    if (entityTreeElementPointer->findRayIntersection(args->origin, args->direction, keepSearching,
-        args->element, args->distance, args->face, args->surfaceNormal, args->entityIdsToInclude,
-        args->entityIdsToDiscard, args->visibleOnly, args->collidableOnly, args->intersectedObject, args->precisionPicking)) {
-        args->found = true;
+    if (element->findRayIntersection(args.origin, args.direction, keepSearching,
+        args.element, args.distance, args.face, args.surfaceNormal, args.entityIdsToInclude,
+        args.entityIdsToDiscard, args.visibleOnly, args.collidableOnly,
+        args.intersectedObject, args.precisionPicking)) {
+        args.found = true;
+    }
+    if (!keepSearching) {
+        return; // the ray misses this element's cube, so it misses every child cube too
+    }
+
+    // gather the children the ray touches, sorted by the distance at which it enters their cubes
+    EntityTreeElementPointer touchedChildren[NUMBER_OF_CHILDREN];
+    float distancesToChildren[NUMBER_OF_CHILDREN];
+    int touchedCount = 0;
+    for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
+        EntityTreeElementPointer child = std::static_pointer_cast<EntityTreeElement>(element->getChildAtIndex(i));
+        if (!child) {
+            continue;
+        }
+        float distanceToChild;
+        BoxFace childFace;
+        glm::vec3 childNormal;
+        if (child->getAACube().contains(args.origin)) {
+            distanceToChild = 0.0f; // findRayIntersection() returns the exit distance in this case
+        } else if (!child->getAACube().findRayIntersection(args.origin, args.direction,
+                distanceToChild, childFace, childNormal)) {
+            continue;
+        }
+        int j = touchedCount++;
+        while (j > 0 && distancesToChildren[j - 1] > distanceToChild) {
+            touchedChildren[j] = touchedChildren[j - 1];
+            distancesToChildren[j] = distancesToChildren[j - 1];
+            j--;
+        }
+        touchedChildren[j] = child;
+        distancesToChildren[j] = distanceToChild;
+    }
+
+    for (int i = 0; i < touchedCount; i++) {
+        // everything in this child's subtree is at least distancesToChildren[i] away, so once
+        // that passes the best hit, this child and the (farther) remaining ones can't beat it
+        if (distancesToChildren[i] > args.distance) {
+            break;
+        }
+        findRayIntersectionRecurse(touchedChildren[i], args);
     }
-    return keepSearching;
 }
 
 bool EntityTree::findRayIntersection(const glm::vec3& origin, const glm::vec3& direction,
@@ -610,7 +658,7 @@ bool EntityTree::findRayIntersection(const glm::vec3& origin, const glm::vec3& d
 
     bool requireLock = lockType == Octree::Lock;
     bool lockResult = withReadLock([&]{
-        recurseTreeWithOperation(findRayIntersectionOp, &args);
+        findRayIntersectionRecurse(std::static_pointer_cast<EntityTreeElement>(getRoot()), args);
     }, requireLock);
 
     if (accurateResult) {
@@ -664,6 +712,37 @@ void EntityTree::findEntities(const glm::vec3& center, float radius, QVector<Ent
     foundEntities.swap(args.entities);
 }
 
+class FindContainingPointArgs {
+public:
+    glm::vec3 point;
+    QVector<EntityItemPointer> entities;
+};
+
+
+bool EntityTree::findContainingPointOperation(OctreeElementPointer element, void* extraData) {
+    FindContainingPointArgs* args = static_cast<FindContainingPointArgs*>(extraData);
+
+    // If this element doesn't contain the point, then neither it nor any of its children can
+    // hold an entity whose bounds contain the point, so stop searching. Sibling cubes don't
+    // overlap, so this recursion only walks the one branch of elements containing the point.
+    if (!element->getAACube().contains(args->point)) {
+        return false;
+    }
+
+    EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+    entityTreeElement->getEntitiesContainingPoint(args->point, args->entities);
+    return true;
+}
+
+// NOTE: assumes caller has handled locking
+void EntityTree::findEntitiesContainingPoint(const glm::vec3& point, QVector<EntityItemPointer>& foundEntities) {
+    FindContainingPointArgs args = { point, QVector<EntityItemPointer>() };
+    recurseTreeWithOperation(findContainingPointOperation, &args);
+
+    // swap the two lists of entity pointers instead of copy
+    foundEntities.swap(args.entities);
+}
+
 class FindEntitiesInCubeArgs {
 public:
     FindEntitiesInCubeArgs(const AACube& cube)
@@ -1266,7 +1345,9 @@ void EntityTree::deleteDescendantsOfAvatar(QUuid avatarID) {
 
 void EntityTree::update() {
     fixupMissingParents();
-    if (_simulation) {
+    // when every entity is at rest the simulation reports no work to do and we skip the write lock
+    // entirely - the entity-server and headless agents spend most ticks in exactly that state
+    if (_simulation && _simulation->hasWorkToDo(usecTimestampNow())) {
         withWriteLock([&] {
             _simulation->updateEntities();
             VectorOfEntities pendingDeletes;
@@ -1434,8 +1515,8 @@ int EntityTree::processEraseMessageDetails(const QByteArray& dataByteArray, cons
 
 EntityTreeElementPointer EntityTree::getContainingElement(const EntityItemID& entityItemID)  /*const*/ {
     QReadLocker locker(&_entityToElementLock);
-    EntityTreeElementPointer element = _entityToElementMap.value(entityItemID);
-    return element;
+    auto it = _entityToElementMap.find(entityItemID);
+    return (it == _entityToElementMap.end()) ? EntityTreeElementPointer() : it->second;
 }
 
 void EntityTree::setContainingElement(const EntityItemID& entityItemID, EntityTreeElementPointer element) {
@@ -1443,17 +1524,15 @@ void EntityTree::setContainingElement(const EntityItemID& entityItemID, EntityTr
     if (element) {
         _entityToElementMap[entityItemID] = element;
     } else {
-        _entityToElementMap.remove(entityItemID);
+        _entityToElementMap.erase(entityItemID);
     }
 }
 
 void EntityTree::debugDumpMap() {
     qCDebug(entities) << "EntityTree::debugDumpMap() --------------------------";
     QReadLocker locker(&_entityToElementLock);
-    QHashIterator<EntityItemID, EntityTreeElementPointer> i(_entityToElementMap);
-    while (i.hasNext()) {
-        i.next();
-        qCDebug(entities) << i.key() << ": " << i.value().get();
+    for (auto& entry : _entityToElementMap) {
+        qCDebug(entities) << entry.first << ": " << entry.second.get();
     }
     qCDebug(entities) << "-----------------------------------------------------";
 }
@@ -1638,6 +1717,115 @@ bool EntityTree::writeToMap(QVariantMap& entityDescription, OctreeElementPointer
     return true;
 }
 
+static const int NUM_PERSIST_CHUNKS = 16;
+
+static int persistChunkForID(const EntityItemID& id) {
+    return (int)(qHash(id) % (uint)NUM_PERSIST_CHUNKS);
+}
+
+static QString persistChunkFileName(const QDir& directory, int chunk) {
+    return directory.filePath(QString("chunk-%1.json.gz").arg(chunk, 2, 10, QChar('0')));
+}
+
+bool EntityTree::writeChunkedPersist(const QString& directory) {
+    QDir chunkDir(directory);
+    if (!chunkDir.exists() && !chunkDir.mkpath(".")) {
+        qCWarning(entities) << "unable to create chunked persist directory" << directory;
+        return false;
+    }
+
+    quint64 saveStarted = usecTimestampNow();
+
+    // bucket the entities by ID so each one always lands in the same chunk
+    std::vector<std::vector<EntityItemPointer>> chunkEntities(NUM_PERSIST_CHUNKS);
+    {
+        QReadLocker locker(&_entityToElementLock);
+        for (auto it = _entityToElementMap.begin(); it != _entityToElementMap.end(); ++it) {
+            EntityItemPointer entity = it->second ? it->second->getEntityWithEntityItemID(it->first) : nullptr;
+            if (entity) {
+                chunkEntities[persistChunkForID(it->first)].push_back(entity);
+            }
+        }
+    }
+
+    bool firstWrite = _lastChunkedPersistCounts.empty();
+    if (firstWrite) {
+        _lastChunkedPersistCounts.resize(NUM_PERSIST_CHUNKS, -1);
+    }
+
+    PacketVersion expectedVersion = versionForPacketType(expectedDataPacketType());
+    QScriptEngine scriptEngine;
+    bool success = true;
+
+    for (int chunk = 0; chunk < NUM_PERSIST_CHUNKS; chunk++) {
+        auto& entities = chunkEntities[chunk];
+
+        // a chunk is dirty if any of its entities changed since the last save, or if its
+        // population changed (which catches deletions)
+        bool dirty = firstWrite || (int)entities.size() != _lastChunkedPersistCounts[chunk];
+        if (!dirty) {
+            for (auto& entity : entities) {
+                if (entity->getLastChangedOnServer() >= _lastChunkedPersistTime) {
+                    dirty = true;
+                    break;
+                }
+            }
+        }
+        if (!dirty) {
+            continue;
+        }
+
+        QVariantList entitiesQList;
+        for (auto& entity : entities) {
+            if (!entity->isParentIDValid()) {
+                continue; // we weren't able to resolve a parent from _parentID, so don't save this entity.
+            }
+            EntityItemProperties properties = entity->getProperties();
+            entitiesQList << EntityItemNonDefaultPropertiesToScriptValue(&scriptEngine, properties).toVariant();
+        }
+
+        QVariantMap entityDescription;
+        entityDescription["Version"] = (int)expectedVersion;
+        entityDescription["Entities"] = entitiesQList;
+
+        QByteArray jsonData = QJsonDocument::fromVariant(entityDescription).toJson();
+        QByteArray gzippedData;
+        if (!gzip(jsonData, gzippedData, -1)) {
+            qCWarning(entities) << "unable to gzip chunked persist data for chunk" << chunk;
+            success = false;
+            continue;
+        }
+
+        QFile chunkFile(persistChunkFileName(chunkDir, chunk));
+        if (chunkFile.open(QIODevice::WriteOnly) && chunkFile.write(gzippedData) != -1) {
+            _lastChunkedPersistCounts[chunk] = (int)entities.size();
+        } else {
+            qCWarning(entities) << "unable to write chunked persist file" << chunkFile.fileName();
+            success = false;
+        }
+    }
+
+    if (success) {
+        // changes that arrive while we were writing are newer than this and get caught next save
+        _lastChunkedPersistTime = saveStarted;
+    }
+    return success;
+}
+
+bool EntityTree::readChunkedPersist(const QString& directory) {
+    QDir chunkDir(directory);
+    QStringList chunkFiles = chunkDir.entryList(QStringList() << "chunk-*.json.gz", QDir::Files, QDir::Name);
+    if (chunkFiles.isEmpty()) {
+        return false; // nothing chunked on disk - let the caller fall back to the monolithic file
+    }
+
+    bool success = true;
+    foreach (const QString& chunkFile, chunkFiles) {
+        success = readFromFile(qPrintable(chunkDir.filePath(chunkFile))) && success;
+    }
+    return success;
+}
+
 bool EntityTree::readFromMap(QVariantMap& map) {
     // map will have a top-level list keyed as "Entities".  This will be extracted
     // and iterated over.  Each member of this list is converted to a QVariantMap, then
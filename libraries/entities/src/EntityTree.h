@@ -12,6 +12,9 @@
 #ifndef hifi_EntityTree_h
 #define hifi_EntityTree_h
 
+#include <unordered_map>
+#include <vector>
+
 #include <QSet>
 #include <QVector>
 
@@ -152,6 +155,14 @@ public:
     /// \remark Side effect: any initial contents in foundEntities will be lost
     void findEntities(const glm::vec3& center, float radius, QVector<EntityItemPointer>& foundEntities);
 
+    /// finds all entities whose bounds contain a point. Because an entity's element always contains
+    /// the entity's bounds, this only descends the single branch of elements containing the point,
+    /// which is much cheaper than a sphere query around the point.
+    /// \param point the query point in world-frame (meters)
+    /// \param foundEntities[out] vector of EntityItemPointer
+    /// \remark Side effect: any initial contents in foundEntities will be lost
+    void findEntitiesContainingPoint(const glm::vec3& point, QVector<EntityItemPointer>& foundEntities);
+
     /// finds all entities that touch a cube
     /// \param cube the query cube in world-frame (meters)
     /// \param foundEntities[out] vector of non-EntityItemPointer
@@ -226,6 +237,10 @@ public:
                             bool skipThoseWithBadParents) override;
     virtual bool readFromMap(QVariantMap& entityDescription) override;
 
+    virtual bool supportsChunkedPersist() const override { return true; }
+    virtual bool writeChunkedPersist(const QString& directory) override;
+    virtual bool readChunkedPersist(const QString& directory) override;
+
     glm::vec3 getContentsDimensions();
     float getContentsLargestDimension();
 
@@ -293,6 +308,7 @@ protected:
                                  const SharedNodePointer& senderNode = SharedNodePointer(nullptr));
     static bool findNearPointOperation(OctreeElementPointer element, void* extraData);
     static bool findInSphereOperation(OctreeElementPointer element, void* extraData);
+    static bool findContainingPointOperation(OctreeElementPointer element, void* extraData);
     static bool findInCubeOperation(OctreeElementPointer element, void* extraData);
     static bool findInBoxOperation(OctreeElementPointer element, void* extraData);
     static bool findInFrustumOperation(OctreeElementPointer element, void* extraData);
@@ -323,13 +339,20 @@ protected:
     EntityItemFBXService* _fbxService;
 
     mutable QReadWriteLock _entityToElementLock;
-    QHash<EntityItemID, EntityTreeElementPointer> _entityToElementMap;
+    // touched for every entity edit off the wire, so kept as a flat std container with
+    // the 64-bit UUID hash rather than QHash's 32-bit one
+    std::unordered_map<EntityItemID, EntityTreeElementPointer> _entityToElementMap;
 
     EntitySimulationPointer _simulation;
 
     bool _wantEditLogging = false;
     bool _wantTerseEditLogging = false;
 
+    // chunked persist bookkeeping - the timestamp of the last chunked save and the number of
+    // entities each chunk held when it was last written (so deletions dirty their chunk)
+    quint64 _lastChunkedPersistTime = 0;
+    std::vector<int> _lastChunkedPersistCounts;
+
 
     // some performance tracking properties - only used in server trees
     int _totalEditMessages = 0;
@@ -13,6 +13,7 @@
 
 #include <FBXReader.h>
 #include <GeometryUtil.h>
+#include <MemoryPool.h>
 #include <OctreeUtils.h>
 
 #include "EntitiesLogging.h"
@@ -22,6 +23,27 @@
 #include "EntityTreeElement.h"
 #include "EntityTypes.h"
 
+static MemoryPool& entityTreeElementPool() {
+    static MemoryPool pool("entities.EntityTreeElement", sizeof(EntityTreeElement));
+    return pool;
+}
+
+void* EntityTreeElement::operator new(size_t size) {
+    if (size != sizeof(EntityTreeElement)) {
+        // a subclass - it didn't come from our pool, so don't send it there
+        return ::operator new(size);
+    }
+    return entityTreeElementPool().allocate();
+}
+
+void EntityTreeElement::operator delete(void* element, size_t size) {
+    if (size != sizeof(EntityTreeElement)) {
+        ::operator delete(element);
+        return;
+    }
+    entityTreeElementPool().release(element);
+}
+
 EntityTreeElement::EntityTreeElement(unsigned char* octalCode) : OctreeElement() {
     init(octalCode);
 };
@@ -783,6 +805,18 @@ void EntityTreeElement::getEntities(const glm::vec3& searchPosition, float searc
     });
 }
 
+void EntityTreeElement::getEntitiesContainingPoint(const glm::vec3& point, QVector<EntityItemPointer>& foundEntities) const {
+    forEachEntity([&](EntityItemPointer entity) {
+        bool success;
+        AABox entityBox = entity->getAABox(success);
+        // If the entities AABox contains the point then consider it to be found. Callers that need
+        // exact containment (e.g. compound zone hulls) should follow up with EntityItem::contains().
+        if (!success || entityBox.contains(point)) {
+            foundEntities.push_back(entity);
+        }
+    });
+}
+
 void EntityTreeElement::getEntities(const AACube& cube, QVector<EntityItemPointer>& foundEntities) {
     forEachEntity([&](EntityItemPointer entity) {
         bool success;
@@ -859,6 +893,12 @@ EntityItemPointer EntityTreeElement::getEntityWithEntityItemID(const EntityItemI
     return foundEntity;
 }
 
+void EntityTreeElement::republishEntityItems() {
+    // the snapshot shares the QVector's data with _entityItems - the next mutation detaches,
+    // leaving any in-flight lock-free readers on the old data
+    std::atomic_store(&_publishedEntityItems, std::make_shared<const EntityItems>(_entityItems));
+}
+
 void EntityTreeElement::cleanupEntities() {
     withWriteLock([&] {
         foreach(EntityItemPointer entity, _entityItems) {
@@ -869,6 +909,7 @@ void EntityTreeElement::cleanupEntities() {
             entity->_element = NULL;
         }
         _entityItems.clear();
+        republishEntityItems();
     });
 }
 
@@ -882,6 +923,7 @@ bool EntityTreeElement::removeEntityWithEntityItemID(const EntityItemID& id) {
                 foundEntity = true;
                 entity->_element = NULL;
                 _entityItems.removeAt(i);
+                republishEntityItems();
                 break;
             }
         }
@@ -893,6 +935,9 @@ bool EntityTreeElement::removeEntityItem(EntityItemPointer entity) {
     int numEntries = 0;
     withWriteLock([&] {
         numEntries = _entityItems.removeAll(entity);
+        if (numEntries > 0) {
+            republishEntityItems();
+        }
     });
     if (numEntries > 0) {
         assert(entity->_element.get() == this);
@@ -1034,6 +1079,7 @@ void EntityTreeElement::addEntityItem(EntityItemPointer entity) {
     assert(entity->_element == nullptr);
     withWriteLock([&] {
         _entityItems.push_back(entity);
+        republishEntityItems();
     });
     entity->_element = getThisPointer();
 }
@@ -86,6 +86,11 @@ class EntityTreeElement : public OctreeElement, ReadWriteLockable {
 public:
     virtual ~EntityTreeElement();
 
+    // elements churn heavily during edits and bulk imports, and million-element trees
+    // fragment the heap if every element is a separate allocation; slab-pool them
+    static void* operator new(size_t size);
+    static void operator delete(void* element, size_t size);
+
     // type safe versions of OctreeElement methods
     EntityTreeElementPointer getChildAtIndex(int index) const {
         return std::static_pointer_cast<EntityTreeElement>(OctreeElement::getChildAtIndex(index));
@@ -160,11 +165,16 @@ public:
 
     template <typename F>
     void forEachEntity(F f) const {
-        withReadLock([&] {
-            foreach(EntityItemPointer entityItem, _entityItems) {
+        // iterate the atomically published snapshot instead of taking the element lock. Spatial
+        // queries visit many elements per call, and on a recursive QReadWriteLock every acquisition
+        // serializes through an internal mutex - mutators republish the snapshot under the write
+        // lock, so this traversal always sees a consistent list without acquiring anything.
+        auto entityItems = std::atomic_load(&_publishedEntityItems);
+        if (entityItems) {
+            foreach(EntityItemPointer entityItem, *entityItems) {
                 f(entityItem);
             }
-        });
+        }
     }
 
     virtual uint16_t size() const;
@@ -184,6 +194,11 @@ public:
     /// \param entities[out] vector of const EntityItemPointer
     void getEntities(const glm::vec3& position, float radius, QVector<EntityItemPointer>& foundEntities) const;
 
+    /// finds all entities whose bounds contain a point
+    /// \param point the query point
+    /// \param entities[out] vector of const EntityItemPointer
+    void getEntitiesContainingPoint(const glm::vec3& point, QVector<EntityItemPointer>& foundEntities) const;
+
     /// finds all entities that touch a box
     /// \param box the query box
     /// \param entities[out] vector of non-const EntityItemPointer
@@ -240,8 +255,14 @@ public:
 
 protected:
     virtual void init(unsigned char * octalCode) override;
+
+    /// publishes an immutable snapshot of _entityItems for lock-free traversal; call with the
+    /// element write lock held after any change to _entityItems
+    void republishEntityItems();
+
     EntityTreePointer _myTree;
     EntityItems _entityItems;
+    std::shared_ptr<const EntityItems> _publishedEntityItems;
 };
 
 #endif // hifi_EntityTreeElement_h
@@ -118,6 +118,11 @@ bool MovingEntitiesOperator::shouldRecurseSubTree(OctreeElementPointer element)
         const AACube& elementCube = element->getAACube();
         int detailIndex = 0;
         foreach(const EntityToMoveDetails& details, _entitiesToMove) {
+            // entities already rethreaded into their new element don't need any more recursion
+            if (details.oldFound && details.newFound) {
+                detailIndex++;
+                continue;
+            }
 
             if (_wantDebug) {
                 qCDebug(entities) << "MovingEntitiesOperator::shouldRecurseSubTree() details["<< detailIndex <<"]-----------------------------";
@@ -161,8 +166,13 @@ bool MovingEntitiesOperator::preRecursion(OctreeElementPointer element) {
 
         // check against each of our search entities
         int detailIndex = 0;
-        foreach(const EntityToMoveDetails& details, _entitiesToMove) {
-        
+        for (EntityToMoveDetails& details : _entitiesToMove) {
+            // skip entities that have already been found in both their old and new elements
+            if (details.oldFound && details.newFound) {
+                detailIndex++;
+                continue;
+            }
+
             if (_wantDebug) {
                 qCDebug(entities) << "MovingEntitiesOperator::preRecursion() details["<< detailIndex <<"]-----------------------------";
                 qCDebug(entities) << "    entityTreeElement:" << entityTreeElement->getAACube();
@@ -182,7 +192,7 @@ bool MovingEntitiesOperator::preRecursion(OctreeElementPointer element) {
             if (!details.oldFound && entityTreeElement == details.oldContainingElement) {
                 // DO NOT remove the entity here.  It will be removed when added to the destination element.
                 _foundOldCount++;
-                //details.oldFound = true; // TODO: would be nice to add this optimization
+                details.oldFound = true;
                 if (_wantDebug) {
                     qCDebug(entities) << "MovingEntitiesOperator::preRecursion() -----------------------------";
                     qCDebug(entities) << "    FOUND OLD - REMOVING";
@@ -204,7 +214,7 @@ bool MovingEntitiesOperator::preRecursion(OctreeElementPointer element) {
                     _tree->setContainingElement(entityItemID, entityTreeElement);
                 }
                 _foundNewCount++;
-                //details.newFound = true; // TODO: would be nice to add this optimization
+                details.newFound = true;
                 if (_wantDebug) {
                     qCDebug(entities) << "MovingEntitiesOperator::preRecursion() -----------------------------";
                     qCDebug(entities) << "    FOUND NEW - ADDING";
@@ -227,32 +237,36 @@ bool MovingEntitiesOperator::postRecursion(OctreeElementPointer element) {
     // We might have two paths, one for the old entity and one for the new entity.
     bool keepSearching = (_foundOldCount < _lookingCount) || (_foundNewCount < _lookingCount);
 
-    // As we unwind, if we're in either of these two paths, we mark our element
-    // as dirty.
-    if ((shouldRecurseSubTree(element))) {
-        element->markWithChangedTime();
-    }
-    
-
-
     // It's not OK to prune if we have the potential of deleting the original containing element
-    // because if we prune the containing element then new might end up reallocating the same memory later 
+    // because if we prune the containing element then new might end up reallocating the same memory later
     // and that will confuse our logic.
-    // 
+    //
     // it's ok to prune if:
     // 2) this subtree doesn't contain any old elements
     // 3) this subtree contains an old element, but this element isn't a direct parent of any old containing element
 
+    // As we unwind, if we're in either the old or new path of any moved entity, we mark our element
+    // as dirty. Note: this can't use shouldRecurseSubTree() because that skips entities already
+    // rethreaded, and their paths still need to be marked on the way back up.
+    bool onPathOfMovedEntity = false;
     bool elementSubTreeContainsOldElements = false;
     bool elementIsDirectParentOfOldElment = false;
+    const AACube& elementCube = element->getAACube();
     foreach(const EntityToMoveDetails& details, _entitiesToMove) {
-        if (element->getAACube().contains(details.oldContainingElementCube)) {
+        if (elementCube.contains(details.oldContainingElementCube)) {
+            onPathOfMovedEntity = true;
             elementSubTreeContainsOldElements = true;
         }
+        if (elementCube.contains(details.newCubeClamped)) {
+            onPathOfMovedEntity = true;
+        }
         if (element->isParentOf(details.oldContainingElement)) {
             elementIsDirectParentOfOldElment = true;
         }
     }
+    if (onPathOfMovedEntity) {
+        element->markWithChangedTime();
+    }
     if (!elementSubTreeContainsOldElements || !elementIsDirectParentOfOldElment) {
         EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
         entityTreeElement->pruneChildren(); // take this opportunity to prune any empty leaves
@@ -270,6 +284,10 @@ OctreeElementPointer MovingEntitiesOperator::possiblyCreateChildAt(OctreeElement
     
         // check against each of our entities
         foreach(const EntityToMoveDetails& details, _entitiesToMove) {
+            // entities already added to their new element don't need any new branches
+            if (details.newFound) {
+                continue;
+            }
 
             // if the scale of our desired cube is smaller than our children, then consider making a child
             if (details.newCubeClamped.getLargestDimension() <= childElementScale) {
@@ -44,7 +44,7 @@ public:
     bool hasMovingEntities() const { return _entitiesToMove.size() > 0; }
 private:
     EntityTreePointer _tree;
-    QSet<EntityToMoveDetails> _entitiesToMove;
+    QVector<EntityToMoveDetails> _entitiesToMove;
     quint64 _changeTime;
     int _foundOldCount;
     int _foundNewCount;
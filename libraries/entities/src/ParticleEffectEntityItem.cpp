@@ -591,15 +591,9 @@ void ParticleEffectEntityItem::setShapeType(ShapeType type) {
     }
 }
 
-void ParticleEffectEntityItem::integrateParticle(Particle& particle, float deltaTime) {
-    glm::vec3 atSquared = (0.5f * deltaTime * deltaTime) * particle.acceleration;
-    glm::vec3 at = particle.acceleration * deltaTime;
-    particle.position += particle.velocity * deltaTime + atSquared;
-    particle.velocity += at;
-}
-
 void ParticleEffectEntityItem::stepSimulation(float deltaTime) {
-    // update particles between head and tail
+    // age particles between head and tail; position is evaluated in closed form from the
+    // birth state on the GPU, so the only per-particle work left here is retirement
     int popCount = 0;
     for (Particle& particle : _particles) {
         particle.lifetime += deltaTime;
@@ -608,9 +602,6 @@ void ParticleEffectEntityItem::stepSimulation(float deltaTime) {
         if (particle.lifetime >= _lifespan) {
             // move head forward
             popCount++;
-        } else {
-            // Otherwise update it
-            integrateParticle(particle, deltaTime);
         }
     }
     _particles.erase(_particles.begin(), _particles.begin() + popCount);
@@ -630,12 +621,10 @@ void ParticleEffectEntityItem::stepSimulation(float deltaTime) {
             // emit a new particle at tail index.
             _particles.push_back(createParticle(glm::mix(_previousPosition, getPosition(),
                 (deltaTime - timeLeftInFrame) / deltaTime)));
-            auto particle = _particles.back();
-            particle.lifetime += timeLeftInFrame;
-            
-            // Initialize it
-            integrateParticle(particle, deltaTime);
-            
+            // it was born part way through the frame, so it already has some age
+            _particles.back().lifetime = timeLeftInFrame;
+            _particlesSpawned++;
+
             // Advance in frame
             timeLeftInFrame -= _timeUntilNextEmit;
             _timeUntilNextEmit = 1.0f / _emitRate;
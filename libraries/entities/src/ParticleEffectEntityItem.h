@@ -229,8 +229,10 @@ protected:
     
     Particle createParticle(const glm::vec3& position);
     void stepSimulation(float deltaTime);
-    void integrateParticle(Particle& particle, float deltaTime);
-    
+
+    // Particles hold their state at birth and are never integrated on the CPU; with constant
+    // acceleration the trajectory is closed-form, so the renderer evaluates position from age
+    // on the GPU. Only lifetime advances here, to know when to retire a particle.
     struct Particle {
         float seed { 0.0f };
         float lifetime { 0.0f };
@@ -238,9 +240,10 @@ protected:
         glm::vec3 velocity { Vectors::ZERO };
         glm::vec3 acceleration { Vectors::ZERO };
     };
-    
+
     // Particles container
     Particles _particles;
+    quint64 _particlesSpawned { 0 }; /// monotonic spawn count, lets the renderer find new particles
     
     // Particles properties
     rgbColor _color;
@@ -34,6 +34,8 @@ protected:
     virtual void changeEntityInternal(EntityItemPointer entity) override;
     virtual void clearEntitiesInternal() override;
 
+    virtual bool hasWorkToDoInternal(const quint64& now) const override { return now > _nextOwnerlessExpiry; }
+
     virtual void sortEntitiesThatMoved() override;
 
     SetOfEntities _entitiesWithSimulationOwner;
@@ -18,6 +18,7 @@
 #include <QtDebug>
 #include <QtEndian>
 #include <QFileInfo>
+#include <QtConcurrent/QtConcurrentMap>
 
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/quaternion.hpp>
@@ -587,10 +588,32 @@ FBXGeometry* FBXReader::extractFBXGeometry(const QVariantHash& mapping, const QS
                 }
             }
         } else if (child.name == "Objects") {
+            // First index the mesh geometry spans, then extract them in parallel: on large
+            // scenes extractMesh dominates the parse and the meshes are independent of each
+            // other. Indices are assigned in node order up front so the result is identical
+            // to a serial extraction.
+            QVector<const FBXNode*> meshGeometryNodes;
+            foreach (const FBXNode& object, child.children) {
+                if (object.name == "Geometry" && object.properties.at(2) == "Mesh") {
+                    meshGeometryNodes.append(&object);
+                }
+            }
+            if (!meshGeometryNodes.isEmpty()) {
+                unsigned int baseMeshIndex = meshIndex;
+                meshIndex += (unsigned int)meshGeometryNodes.size();
+                QVector<ExtractedMesh> extractedMeshes = QtConcurrent::blockingMapped(meshGeometryNodes,
+                        [this, &meshGeometryNodes, baseMeshIndex](const FBXNode* object) {
+                    unsigned int nodeMeshIndex = baseMeshIndex + (unsigned int)meshGeometryNodes.indexOf(object);
+                    return extractMesh(*object, nodeMeshIndex);
+                });
+                for (int i = 0; i < meshGeometryNodes.size(); i++) {
+                    meshes.insert(getID(meshGeometryNodes.at(i)->properties), extractedMeshes.at(i));
+                }
+            }
             foreach (const FBXNode& object, child.children) {
                 if (object.name == "Geometry") {
                     if (object.properties.at(2) == "Mesh") {
-                        meshes.insert(getID(object.properties), extractMesh(object, meshIndex));
+                        // extracted in the parallel pass above
                     } else { // object.properties.at(2) == "Shape"
                         ExtractedBlendshape extracted = { getID(object.properties), extractBlendshape(object) };
                         blendshapes.append(extracted);
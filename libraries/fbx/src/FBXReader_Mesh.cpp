@@ -20,6 +20,7 @@
 #include <QFileInfo>
 #include <QHash>
 #include <LogHandler.h>
+#include <model/MeshOptimizer.h>
 #include "ModelFormatLogging.h"
 
 #include "FBXReader.h"
@@ -503,34 +504,46 @@ void FBXReader::buildModelMesh(FBXMesh& extractedMesh, const QString& url) {
     int indexNum = 0;
     int offset = 0;
 
+    float sourceACMR = 0.0f;
+    float optimizedACMR = 0.0f;
+
     std::vector< model::Mesh::Part > parts;
     if (extractedMesh.parts.size() > 1) {
         indexNum = 0;
     }
     foreach(const FBXMeshPart& part, extractedMesh.parts) {
         model::Mesh::Part modelPart(indexNum, 0, 0, model::Mesh::TRIANGLES);
-        
-        if (part.quadTrianglesIndices.size()) {
-            indexBuffer->setSubData(offset,
-                            part.quadTrianglesIndices.size() * sizeof(int),
-                            (gpu::Byte*) part.quadTrianglesIndices.constData());
-            offset += part.quadTrianglesIndices.size() * sizeof(int);
-            indexNum += part.quadTrianglesIndices.size();
-            modelPart._numIndices += part.quadTrianglesIndices.size();
-        }
 
-        if (part.triangleIndices.size()) {
+        // Reorder the uploaded copy of the part's triangles for post-transform cache
+        // locality; the source index vectors stay as authored for the other consumers
+        std::vector<uint32_t> partIndices;
+        partIndices.reserve(part.quadTrianglesIndices.size() + part.triangleIndices.size());
+        partIndices.insert(partIndices.end(), part.quadTrianglesIndices.begin(), part.quadTrianglesIndices.end());
+        partIndices.insert(partIndices.end(), part.triangleIndices.begin(), part.triangleIndices.end());
+
+        if (!partIndices.empty()) {
+            sourceACMR += model::MeshOptimizer::evalACMR(partIndices) * (partIndices.size() / 3);
+            model::MeshOptimizer::optimizeTriangleOrder((uint32_t)extractedMesh.vertices.size(), partIndices);
+            optimizedACMR += model::MeshOptimizer::evalACMR(partIndices) * (partIndices.size() / 3);
+
             indexBuffer->setSubData(offset,
-                            part.triangleIndices.size() * sizeof(int),
-                            (gpu::Byte*) part.triangleIndices.constData());
-            offset += part.triangleIndices.size() * sizeof(int);
-            indexNum += part.triangleIndices.size();
-            modelPart._numIndices += part.triangleIndices.size();
+                            partIndices.size() * sizeof(int),
+                            (gpu::Byte*) partIndices.data());
+            offset += (int)partIndices.size() * sizeof(int);
+            indexNum += (int)partIndices.size();
+            modelPart._numIndices += (int)partIndices.size();
         }
 
         parts.push_back(modelPart);
     }
 
+    if (totalIndices > 0) {
+        size_t numTriangles = totalIndices / 3;
+        qCDebug(modelformat) << "buildModelMesh -- optimized triangle order, ACMR"
+            << (sourceACMR / numTriangles) << "->" << (optimizedACMR / numTriangles)
+            << ", triangles =" << numTriangles << ", url =" << url;
+    }
+
     gpu::BufferView indexBufferView(indexBuffer, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::XYZ));
     mesh->setIndexBuffer(indexBufferView);
 
@@ -138,7 +138,10 @@ GLuint compileProgram(const std::vector<GLuint>& glshaders) {
         return 0;
     }
 
-    // glProgramParameteri(glprogram, GL_PROGRAM_, GL_TRUE);
+    // ask the driver to keep the binary retrievable, so the linked result can be
+    // persisted in the shader binary cache and skipped entirely on later runs
+    glProgramParameteri(glprogram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
     // Create the program from the sub shaders
     for (auto so : glshaders) {
         glAttachShader(glprogram, so);
@@ -214,6 +214,13 @@ void GLBackend::renderPassTransfer(const Batch& batch) {
         _transform._cameras.clear();
         _transform._cameraOffsets.clear();
 
+        BatchTranslation prepared;
+        bool usePrepared = tryTakePreparedTranslation(batch, prepared);
+        if (usePrepared) {
+            _transform._cameras = std::move(prepared.cameras);
+            _transform._cameraOffsets = std::move(prepared.cameraOffsets);
+        }
+
         for (_commandIndex = 0; _commandIndex < numCommands; ++_commandIndex) {
             switch (*command) {
                 case Batch::COMMAND_draw:
@@ -222,12 +229,17 @@ void GLBackend::renderPassTransfer(const Batch& batch) {
                 case Batch::COMMAND_drawIndexedInstanced:
                 case Batch::COMMAND_multiDrawIndirect:
                 case Batch::COMMAND_multiDrawIndexedIndirect:
-                    _transform.preUpdate(_commandIndex, _stereo);
+                    if (!usePrepared) {
+                        _transform.preUpdate(_commandIndex, _stereo);
+                    }
                     break;
 
                 case Batch::COMMAND_setViewportTransform:
                 case Batch::COMMAND_setViewTransform:
                 case Batch::COMMAND_setProjectionTransform: {
+                    // Replayed even when the cameras came prepared from translate(): they keep
+                    // the raw transform state current across batches, and setViewportTransform
+                    // also issues the actual viewport call
                     CommandCall call = _commandCalls[(*command)];
                     (this->*(call))(batch, *offset);
                     break;
@@ -326,6 +338,104 @@ void GLBackend::render(const Batch& batch) {
     _stereo._enable = savedStereo;
 }
 
+void GLBackend::translate(const Batch& batch) {
+    if (_transform._cameraUboSize == 0) {
+        // The transform stage is not initialized yet, there is nothing useful to prepare
+        return;
+    }
+
+    const size_t numCommands = batch.getCommands().size();
+    const Batch::Commands::value_type* command = batch.getCommands().data();
+    const Batch::CommandOffsets::value_type* offset = batch.getCommandOffsets().data();
+
+    // Same per batch stereo override as render()
+    StereoState stereo = _stereo;
+    if (!batch.isStereoEnabled()) {
+        stereo._enable = false;
+    }
+    stereo._skybox = batch.isSkyboxEnabled();
+
+    _translationState._skybox = batch.isSkyboxEnabled();
+    _translationState._correction = _transform._correction;
+    _translationState._cameraUboSize = _transform._cameraUboSize;
+    _translationState._cameras.clear();
+    _translationState._cameraOffsets.clear();
+
+    // Walk the same commands the transfer pass walks, against the shadow transform state:
+    // this is pure CPU work, no GL call is made here
+    for (size_t commandIndex = 0; commandIndex < numCommands; ++commandIndex) {
+        switch (*command) {
+            case Batch::COMMAND_draw:
+            case Batch::COMMAND_drawIndexed:
+            case Batch::COMMAND_drawInstanced:
+            case Batch::COMMAND_drawIndexedInstanced:
+            case Batch::COMMAND_multiDrawIndirect:
+            case Batch::COMMAND_multiDrawIndexedIndirect:
+                _translationState.preUpdate(commandIndex, stereo);
+                break;
+
+            case Batch::COMMAND_setViewTransform:
+                _translationState._view = batch._transforms.get(batch._params[*offset]._uint);
+                _translationState._viewIsCamera = batch._params[*offset + 1]._uint != 0;
+                _translationState._invalidView = true;
+                break;
+
+            case Batch::COMMAND_setProjectionTransform:
+                memcpy(&_translationState._projection, batch.readData(batch._params[*offset]._uint), sizeof(Mat4));
+                _translationState._invalidProj = true;
+                break;
+
+            case Batch::COMMAND_setViewportTransform: {
+                memcpy(&_translationState._viewport, batch.readData(batch._params[*offset]._uint), sizeof(Vec4i));
+#ifdef GPU_STEREO_DRAWCALL_INSTANCED
+                if (stereo._enable) {
+                    ivec4& vp = _translationState._viewport;
+                    vp.z /= 2;
+                    if (stereo._pass) {
+                        vp.x += vp.z;
+                    }
+                }
+#endif
+                _translationState._invalidViewport = true;
+                break;
+            }
+
+            default:
+                break;
+        }
+        command++;
+        offset++;
+    }
+
+    BatchTranslation translation;
+    translation.sourceBatch = &batch;
+    translation.stereo = stereo;
+    translation.cameras = std::move(_translationState._cameras);
+    translation.cameraOffsets = std::move(_translationState._cameraOffsets);
+    {
+        Lock lock(_translationMutex);
+        _preparedTranslations.push_back(std::move(translation));
+    }
+}
+
+bool GLBackend::tryTakePreparedTranslation(const Batch& batch, BatchTranslation& translation) {
+    Lock lock(_translationMutex);
+    if (_preparedTranslations.empty()) {
+        return false;
+    }
+    auto& front = _preparedTranslations.front();
+    if (front.sourceBatch != &batch || memcmp(&front.stereo, &_stereo, sizeof(StereoState)) != 0) {
+        // The batches are not being rendered in the order they were translated, or the stereo
+        // state moved underneath us: the carried over transform state makes every queued
+        // translation unreliable, so drop them all and translate inline
+        _preparedTranslations.clear();
+        return false;
+    }
+    translation = std::move(front);
+    _preparedTranslations.pop_front();
+    return true;
+}
+
 
 void GLBackend::syncCache() {
     PROFILE_RANGE(render_gpu_gl_detail, __FUNCTION__);
@@ -70,6 +70,7 @@ public:
 
     void setCameraCorrection(const Mat4& correction);
     void render(const Batch& batch) final override;
+    void translate(const Batch& batch) final override;
 
     // This call synchronize the Full Backend cache with the current GLState
     // THis is only intended to be used when mixing raw gl calls with the gpu api usage in order to sync
@@ -82,6 +83,17 @@ public:
     virtual void downloadFramebuffer(const FramebufferPointer& srcFramebuffer,
                                      const Vec4i& region, QImage& destImage) final override;
 
+    // The asynchronous counterpart: issues the read into a pixel buffer object and returns
+    // without waiting on the GPU. The callback fires from processFramebufferDownloads() on
+    // the GL thread once the transfer is done - normally a couple of frames later - so the
+    // render thread never stalls on the readback.
+    using FramebufferDownloadCallback = std::function<void(QImage)>;
+    virtual void downloadFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region,
+                                          FramebufferDownloadCallback callback) final;
+
+    // harvests any completed asynchronous downloads - call once per frame on the GL thread
+    virtual void processFramebufferDownloads(bool waitForOldest = false) final;
+
 
     // this is the maximum numeber of available input buffers
     size_t getNumInputBuffers() const { return _input._invalidBuffers.size(); }
@@ -317,9 +329,11 @@ protected:
 
         mutable std::map<std::string, GLvoid*> _drawCallInfoOffsets;
 
-        GLuint _objectBuffer { 0 };
-        GLuint _cameraBuffer { 0 };
-        GLuint _drawCallInfoBuffer { 0 };
+        // Mutable so a backend streaming these through per-frame buffer rings can
+        // repoint them at the ring buffer of the frame from transferTransformState
+        mutable GLuint _objectBuffer { 0 };
+        mutable GLuint _cameraBuffer { 0 };
+        mutable GLuint _drawCallInfoBuffer { 0 };
         GLuint _objectBufferTexture { 0 };
         size_t _cameraUboSize { 0 };
         bool _viewIsCamera{ false };
@@ -347,10 +361,34 @@ protected:
         void bindCurrentCamera(int stereoSide) const;
     } _transform;
 
+    // The output of translate() for one batch: the camera buffer content normally derived
+    // by preUpdate during the transfer pass, ready to be consumed by render()
+    struct BatchTranslation {
+        const Batch* sourceBatch { nullptr };
+        // The full stereo state the cameras were derived with, so a change of eye
+        // transforms between translation and execution invalidates the work
+        StereoState stereo;
+        TransformStageState::TransformCameras cameras;
+        TransformStageState::List cameraOffsets;
+    };
+
+    // Translations are produced and consumed in batch submission order; render() drops the
+    // whole queue and falls back to the inline path if the front does not match its batch
+    bool tryTakePreparedTranslation(const Batch& batch, BatchTranslation& translation);
+    mutable Mutex _translationMutex;
+    std::list<BatchTranslation> _preparedTranslations;
+    // Shadow transform state walked by translate(), so translation never touches the
+    // live _transform state the render thread is using
+    TransformStageState _translationState;
+
     virtual void transferTransformState(const Batch& batch) const = 0;
 
     struct UniformStageState {
         std::array<BufferPointer, MAX_NUM_UNIFORM_BUFFERS> _buffers;
+        // The bound range within each buffer, so rebinding the same buffer at a
+        // different offset is not mistaken for a redundant bind
+        std::array<GLintptr, MAX_NUM_UNIFORM_BUFFERS> _bufferOffsets {};
+        std::array<GLsizeiptr, MAX_NUM_UNIFORM_BUFFERS> _bufferSizes {};
         //Buffers _buffers {  };
     } _uniform;
 
@@ -408,6 +446,18 @@ protected:
         GLuint _drawFBO { 0 };
     } _output;
 
+    // ring of pixel buffers for asynchronous framebuffer downloads
+    struct FramebufferDownload {
+        GLuint _pbo { 0 };
+        GLsync _fence { nullptr };
+        Vec4i _region;
+        FramebufferDownloadCallback _callback;
+        bool _inFlight { false };
+    };
+    static const int FRAMEBUFFER_DOWNLOAD_RING_SIZE = 4;
+    std::array<FramebufferDownload, FRAMEBUFFER_DOWNLOAD_RING_SIZE> _framebufferDownloads;
+    std::queue<int> _framebufferDownloadsInFlight;
+
     void resetQueryStage();
     struct QueryStageState {
         uint32_t _rangeQueryDepth { 0 };
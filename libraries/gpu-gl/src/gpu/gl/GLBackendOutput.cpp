@@ -163,3 +163,95 @@ void GLBackend::downloadFramebuffer(const FramebufferPointer& srcFramebuffer, co
 
     (void) CHECK_GL_ERROR();
 }
+
+void GLBackend::downloadFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region,
+                                         FramebufferDownloadCallback callback) {
+    auto readFBO = getFramebufferID(srcFramebuffer);
+    if (srcFramebuffer && readFBO) {
+        if ((srcFramebuffer->getWidth() < (region.x + region.z)) || (srcFramebuffer->getHeight() < (region.y + region.w))) {
+            qCWarning(gpugllogging) << "GLBackend::downloadFramebufferAsync : srcFramebuffer is too small to provide the region queried";
+            return;
+        }
+    }
+
+    // if every ring slot is in flight the GPU is more than a full ring behind -
+    // harvest the oldest download (waiting if needed) before reusing its buffer
+    if ((int)_framebufferDownloadsInFlight.size() >= FRAMEBUFFER_DOWNLOAD_RING_SIZE) {
+        processFramebufferDownloads(true);
+    }
+
+    int slotIndex = -1;
+    for (int i = 0; i < FRAMEBUFFER_DOWNLOAD_RING_SIZE; i++) {
+        if (!_framebufferDownloads[i]._inFlight) {
+            slotIndex = i;
+            break;
+        }
+    }
+    if (slotIndex < 0) {
+        qCWarning(gpugllogging) << "GLBackend::downloadFramebufferAsync : no download slot available";
+        return;
+    }
+
+    auto& download = _framebufferDownloads[slotIndex];
+    if (download._pbo == 0) {
+        glGenBuffers(1, &download._pbo);
+    }
+
+    // orphan the buffer to exactly the size of this region - slots get reused at
+    // whatever size the next capture needs
+    GLsizeiptr bufferSize = (GLsizeiptr)region.z * region.w * 4; // GL_BGRA, GL_UNSIGNED_BYTE
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, download._pbo);
+    glBufferData(GL_PIXEL_PACK_BUFFER, bufferSize, nullptr, GL_STREAM_READ);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFBO);
+    glReadPixels(region.x, region.y, region.z, region.w, GL_BGRA, GL_UNSIGNED_BYTE, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    download._fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    download._region = region;
+    download._callback = callback;
+    download._inFlight = true;
+    _framebufferDownloadsInFlight.push(slotIndex);
+
+    (void) CHECK_GL_ERROR();
+}
+
+void GLBackend::processFramebufferDownloads(bool waitForOldest) {
+    while (!_framebufferDownloadsInFlight.empty()) {
+        auto& download = _framebufferDownloads[_framebufferDownloadsInFlight.front()];
+
+        // downloads complete in issue order, so once the oldest is unfinished we're done
+        const GLuint64 FORCED_HARVEST_TIMEOUT_NSECS = 500000000; // half a second, far beyond any sane transfer
+        GLenum status = glClientWaitSync(download._fence, waitForOldest ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                         waitForOldest ? FORCED_HARVEST_TIMEOUT_NSECS : 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            break;
+        }
+        waitForOldest = false;
+
+        glDeleteSync(download._fence);
+        download._fence = nullptr;
+
+        QImage destImage(download._region.z, download._region.w, QImage::Format_ARGB32);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, download._pbo);
+        GLsizeiptr bufferSize = (GLsizeiptr)download._region.z * download._region.w * 4;
+        void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bufferSize, GL_MAP_READ_BIT);
+        if (mapped) {
+            memcpy(destImage.bits(), mapped, bufferSize);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        auto callback = download._callback;
+        download._callback = FramebufferDownloadCallback();
+        download._inFlight = false;
+        _framebufferDownloadsInFlight.pop();
+
+        if (callback) {
+            callback(destImage);
+        }
+    }
+
+    (void) CHECK_GL_ERROR();
+}
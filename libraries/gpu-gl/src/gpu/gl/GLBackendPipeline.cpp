@@ -23,6 +23,7 @@ void GLBackend::do_setPipeline(const Batch& batch, size_t paramOffset) {
     PipelinePointer pipeline = batch._pipelines.get(batch._params[paramOffset + 0]._uint);
 
     if (_pipeline._pipeline == pipeline) {
+        _stats._PSNumRedundantSetPipelines++;
         return;
     }
 
@@ -138,6 +139,8 @@ void GLBackend::releaseUniformBuffer(uint32_t slot) {
             (void) CHECK_GL_ERROR();
         }
         buf.reset();
+        _uniform._bufferOffsets[slot] = 0;
+        _uniform._bufferSizes[slot] = 0;
     }
 }
 
@@ -158,8 +161,9 @@ void GLBackend::do_setUniformBuffer(const Batch& batch, size_t paramOffset) {
         return;
     }
     
-    // check cache before thinking
-    if (_uniform._buffers[slot] == uniformBuffer) {
+    // check cache before thinking, the same buffer at a different range is still a real bind
+    if (_uniform._buffers[slot] == uniformBuffer
+        && _uniform._bufferOffsets[slot] == rangeStart && _uniform._bufferSizes[slot] == rangeSize) {
         return;
     }
 
@@ -169,6 +173,8 @@ void GLBackend::do_setUniformBuffer(const Batch& batch, size_t paramOffset) {
         glBindBufferRange(GL_UNIFORM_BUFFER, slot, object->_buffer, rangeStart, rangeSize);
 
         _uniform._buffers[slot] = uniformBuffer;
+        _uniform._bufferOffsets[slot] = rangeStart;
+        _uniform._bufferSizes[slot] = rangeSize;
         (void) CHECK_GL_ERROR();
     } else {
         releaseUniformBuffer(slot);
@@ -211,6 +217,7 @@ void GLBackend::do_setResourceTexture(const Batch& batch, size_t paramOffset) {
     }
     // check cache before thinking
     if (_resource._textures[slot] == resourceTexture) {
+        _stats._RSNumRedundantTextureBounded++;
         return;
     }
 
@@ -220,6 +227,8 @@ void GLBackend::do_setResourceTexture(const Batch& batch, size_t paramOffset) {
     // Always make sure the GLObject is in sync
     GLTexture* object = syncGPUObject(resourceTexture);
     if (object) {
+        // Feed the eviction heuristic with the binds actually reaching the GPU
+        object->touch();
         GLuint to = object->_texture;
         GLuint target = object->_target;
         glActiveTexture(GL_TEXTURE0 + slot);
@@ -9,6 +9,7 @@
 #include <gl/GLShaders.h>
 
 #include "GLBackend.h"
+#include "GLShaderBinaryCache.h"
 
 using namespace gpu;
 using namespace gpu::gl;
@@ -112,6 +113,22 @@ GLShader* compileBackendProgram(GLBackend& backend, const Shader& program) {
     for (int version = 0; version < GLShader::NumVersions; version++) {
         auto& programObject = programObjects[version];
 
+        // Describe this program version exactly as it would be compiled, so the binary
+        // cache key misses whenever any of the generated source changes
+        std::string programDescription = glslVersion + "\n" + VERSION_DEFINES[version];
+        for (auto subShader : program.getShaders()) {
+            programDescription += "\n" + DOMAIN_DEFINES[subShader->getType()] + "\n" + subShader->getSource().getCode();
+        }
+        QString binaryKey = GLShaderBinaryCache::evalProgramKey(programDescription);
+
+        GLuint glprogram = GLShaderBinaryCache::readProgram(binaryKey);
+        if (glprogram != 0) {
+            // The binary was captured after makeProgramBindings() relinked, so the attribute
+            // bindings are baked in; relinking here would throw the loaded binary away
+            programObject.glprogram = glprogram;
+            continue;
+        }
+
         // Let's go through every shaders and make sure they are ready to go
         std::vector< GLuint > shaderGLObjects;
         for (auto subShader : program.getShaders()) {
@@ -124,7 +141,7 @@ GLShader* compileBackendProgram(GLBackend& backend, const Shader& program) {
             }
         }
 
-        GLuint glprogram = ::gl::compileProgram(shaderGLObjects);
+        glprogram = ::gl::compileProgram(shaderGLObjects);
         if (glprogram == 0) {
             return nullptr;
         }
@@ -132,6 +149,8 @@ GLShader* compileBackendProgram(GLBackend& backend, const Shader& program) {
         programObject.glprogram = glprogram;
 
         makeProgramBindings(programObject);
+
+        GLShaderBinaryCache::writeProgram(binaryKey, programObject.glprogram);
     }
 
     // So far so good, the program versions have all been created successfully
@@ -0,0 +1,161 @@
+//
+//  GLShaderBinaryCache.cpp
+//  libraries/gpu-gl/src/gpu/gl
+//
+//  Created by Andrzej Kapolka on 9/1/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "GLShaderBinaryCache.h"
+
+#include <mutex>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QStandardPaths>
+
+using namespace gpu;
+using namespace gpu::gl;
+
+static const quint32 SHADER_BINARY_FILE_MAGIC = 0x42534648; // 'HFSB'
+// Bump whenever the file layout below changes; stale entries are treated as misses
+static const quint32 SHADER_BINARY_FILE_VERSION = 1;
+
+// Program binaries are opaque driver-specific blobs, so the driver identity is folded into
+// every key: a driver update invalidates the whole cache instead of feeding back binaries
+// the new driver would reject (or worse, silently mis-load).
+static const QByteArray& driverIdentity() {
+    static QByteArray identity;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        auto vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+        auto renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        auto glversion = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+        identity.append(vendor ? vendor : "unknown");
+        identity.append('/');
+        identity.append(renderer ? renderer : "unknown");
+        identity.append('/');
+        identity.append(glversion ? glversion : "unknown");
+    });
+    return identity;
+}
+
+static bool binaryFormatsSupported() {
+    static GLint numFormats = -1;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    });
+    return numFormats > 0;
+}
+
+QString GLShaderBinaryCache::cacheFilePath(const QString& key) {
+    static QString cacheDirectory;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        cacheDirectory = QStandardPaths::writableLocation(QStandardPaths::DataLocation) + "/shader_binaries";
+        if (!QDir().mkpath(cacheDirectory)) {
+            qCWarning(gpugllogging) << "Could not create shader binary cache directory" << cacheDirectory;
+        }
+    });
+    return cacheDirectory + "/" + key + ".hsb";
+}
+
+QString GLShaderBinaryCache::evalProgramKey(const std::string& programDescription) {
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(driverIdentity());
+    hash.addData(programDescription.data(), (int)programDescription.size());
+    return QString(hash.result().toHex());
+}
+
+GLuint GLShaderBinaryCache::readProgram(const QString& key) {
+    if (!binaryFormatsSupported()) {
+        return 0;
+    }
+
+    QFile file(cacheFilePath(key));
+    if (!file.exists() || !file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+
+    QDataStream in(&file);
+    quint32 magic;
+    quint32 version;
+    quint32 binaryFormat;
+    QByteArray binary;
+    in >> magic >> version;
+    if (magic != SHADER_BINARY_FILE_MAGIC || version != SHADER_BINARY_FILE_VERSION) {
+        return 0;
+    }
+    in >> binaryFormat >> binary;
+    if (in.status() != QDataStream::Ok || binary.isEmpty()) {
+        qCWarning(gpugllogging) << "Rejecting truncated shader binary cache entry" << key;
+        return 0;
+    }
+
+    GLuint glprogram = glCreateProgram();
+    if (!glprogram) {
+        return 0;
+    }
+
+    glProgramBinary(glprogram, (GLenum)binaryFormat, binary.constData(), binary.size());
+
+    // The driver is always free to refuse a binary (even with the identity salt, e.g. after
+    // an implementation-internal cache format change), in which case we fall back to a
+    // normal compile and the entry gets rewritten.
+    GLint linked = 0;
+    glGetProgramiv(glprogram, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        glDeleteProgram(glprogram);
+        return 0;
+    }
+
+    return glprogram;
+}
+
+bool GLShaderBinaryCache::writeProgram(const QString& key, GLuint glprogram) {
+    if (!binaryFormatsSupported()) {
+        return false;
+    }
+
+    GLint binaryLength = 0;
+    glGetProgramiv(glprogram, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0) {
+        return false;
+    }
+
+    QByteArray binary(binaryLength, Qt::Uninitialized);
+    GLenum binaryFormat = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(glprogram, binaryLength, &written, &binaryFormat, binary.data());
+    if (written <= 0) {
+        return false;
+    }
+    binary.resize(written);
+
+    auto filePath = cacheFilePath(key);
+    QFile file(filePath + ".tmp");
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(gpugllogging) << "Could not write shader binary cache entry" << filePath;
+        return false;
+    }
+
+    QDataStream out(&file);
+    out << SHADER_BINARY_FILE_MAGIC << SHADER_BINARY_FILE_VERSION;
+    out << (quint32)binaryFormat << binary;
+    file.close();
+
+    // Write-then-rename so a crash mid-write can't leave a half entry behind
+    QFile::remove(filePath);
+    if (!file.rename(filePath)) {
+        file.remove();
+        return false;
+    }
+    return true;
+}
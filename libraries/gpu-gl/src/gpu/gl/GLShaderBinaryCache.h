@@ -0,0 +1,54 @@
+//
+//  GLShaderBinaryCache.h
+//  libraries/gpu-gl/src/gpu/gl
+//
+//  Created by Andrzej Kapolka on 9/1/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_gpu_gl_GLShaderBinaryCache_h
+#define hifi_gpu_gl_GLShaderBinaryCache_h
+
+#include <string>
+
+#include <QtCore/QString>
+
+#include "GLShared.h"
+
+namespace gpu { namespace gl {
+
+/// A content-addressed disk cache of linked program binaries.
+///
+/// Compiling and linking every shader permutation on a fresh install happens on the render
+/// thread and stutters for a long while as pipelines warm.  The binaries the driver hands
+/// back via glGetProgramBinary are saved after the first link; later runs rebuild the same
+/// program with glProgramBinary, which is a fraction of the cost, so a warmed-up install
+/// skips compilation entirely.
+///
+/// The key is derived from the generated program source (version defines plus every sub
+/// shader) salted with the driver identity, since program binaries are driver-specific
+/// blobs -- a driver update or a shader edit simply misses and relinks.  Binaries are
+/// captured after makeProgramBindings() relinks, so the attribute bindings are baked in and
+/// a cache hit must not relink the program.
+class GLShaderBinaryCache {
+public:
+    /// Evaluate the content-addressed key for the generated source of one program version.
+    static QString evalProgramKey(const std::string& programDescription);
+
+    /// Attempt to rebuild a linked program from the cache.
+    /// Returns 0 on a miss, a stale entry, or a binary the driver refuses to load.
+    static GLuint readProgram(const QString& key);
+
+    /// Persist the binary of a linked program under the given key.
+    static bool writeProgram(const QString& key, GLuint glprogram);
+
+private:
+    static QString cacheFilePath(const QString& key);
+};
+
+} }
+
+#endif // hifi_gpu_gl_GLShaderBinaryCache_h
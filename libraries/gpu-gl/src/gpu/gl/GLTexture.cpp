@@ -127,6 +127,11 @@ float GLTexture::getMemoryPressure() {
 }
 
 
+void GLTexture::touch() const {
+    static std::atomic<uint64_t> bindCounter { 0 };
+    _lastBound = ++bindCounter;
+}
+
 // Create the texture and allocate storage
 GLTexture::GLTexture(const std::weak_ptr<GLBackend>& backend, const Texture& texture, GLuint id, bool transferrable) :
     GLObject(backend, texture, id),
@@ -294,6 +299,9 @@ void GLTexture::initTextureTransferHelper() {
 
 void GLTexture::startTransfer() {
     createTexture();
+    _transferFace = 0;
+    _transferMip = _minMip;
+    _transferRow = 0;
 }
 
 void GLTexture::finishTransfer() {
@@ -182,11 +182,16 @@ public:
     static const GLFilterMode FILTER_MODES[Sampler::NUM_FILTERS];
     static const GLenum WRAP_MODES[Sampler::NUM_WRAP_MODES];
 
-    // Return a floating point value indicating how much of the allowed 
-    // texture memory we are currently consuming.  A value of 0 indicates 
+    // Return a floating point value indicating how much of the allowed
+    // texture memory we are currently consuming.  A value of 0 indicates
     // no texture memory usage, while a value of 1 indicates all available / allowed memory
     // is consumed.  A value above 1 indicates that there is a problem.
     static float getMemoryPressure();
+
+    // Render feedback for the eviction heuristic: the backend stamps the texture every
+    // time it is bound for sampling, so the derez pass can pick the coldest candidate
+    void touch() const;
+    uint64_t getLastBound() const { return _lastBound; }
 protected:
 
     static const std::vector<GLenum>& getFaceTargets(GLenum textureType);
@@ -196,6 +201,7 @@ protected:
 
     const GLuint _size { 0 }; // true size as reported by the gl api
     std::atomic<GLSyncState> _syncState { GLSyncState::Idle };
+    mutable std::atomic<uint64_t> _lastBound { 0 };
 
     GLTexture(const std::weak_ptr<gl::GLBackend>& backend, const Texture& texture, GLuint id, bool transferrable);
     GLTexture(const std::weak_ptr<gl::GLBackend>& backend, const Texture& texture, GLuint id);
@@ -215,10 +221,17 @@ protected:
     void setSize(GLuint size) const;
 
     virtual void startTransfer();
-    // Returns true if this is the last block required to complete transfer
-    virtual bool continueTransfer() { return false; }
+    // Uploads content slices until done or the per-pass byte budget runs out, decrementing
+    // budget by the bytes consumed.  Returns true while transfer work remains.
+    virtual bool continueTransfer(Size& budget) { return false; }
     virtual void finishTransfer();
 
+    // Incremental transfer cursor, advanced by continueTransfer implementations as the
+    // per-pass byte budget allows
+    uint8_t _transferFace { 0 };
+    uint16_t _transferMip { 0 };
+    uint32_t _transferRow { 0 };
+
 private:
     friend class GLTextureTransferHelper;
     friend class GLBackend;
@@ -7,6 +7,8 @@
 //
 #include "GLTextureTransfer.h"
 
+#include <algorithm>
+
 #include <gl/GLHelpers.h>
 #include <gl/Context.h>
 
@@ -110,7 +112,9 @@ void GLTextureTransferHelper::queueExecution(VoidLambda lambda) {
     _pendingCommands.push_back(lambda);
 }
 
-#define MAX_TRANSFERS_PER_PASS 2
+// Per-pass upload budget: bounds how long any single pass can occupy the GL pipeline, so a
+// big texture landing mid-session streams in over several passes instead of hitching a frame
+#define TEXTURE_TRANSFER_BYTES_PER_PASS (4 * 1024 * 1024)
 
 bool GLTextureTransferHelper::process() {
     // Take any new textures or commands off the queue
@@ -138,8 +142,17 @@ bool GLTextureTransferHelper::process() {
             object->startTransfer();
             _transferringTextures.push_back(texturePointer);
             _textureIterator = _transferringTextures.begin();
+            _queuedTransferSize += texturePointer->getSize();
         }
+        // Textures that have been sampled since creation are visible content being refreshed,
+        // so they go first; cold loads follow smallest-first so a run of small textures isn't
+        // stuck behind one giant one
         _transferringTextures.sort([](const gpu::TexturePointer& a, const gpu::TexturePointer& b)->bool {
+            GLTexture* objectA = Backend::getGPUObject<GLTexture>(*a);
+            GLTexture* objectB = Backend::getGPUObject<GLTexture>(*b);
+            if (objectA->getLastBound() != objectB->getLastBound()) {
+                return objectA->getLastBound() > objectB->getLastBound();
+            }
             return a->getSize() < b->getSize();
         });
     }
@@ -152,28 +165,28 @@ bool GLTextureTransferHelper::process() {
         return true;
     }
     PROFILE_COUNTER_IF_CHANGED(render_gpu_gl, "transferringTextures", int, (int) _transferringTextures.size())
+    PROFILE_COUNTER_IF_CHANGED(render_gpu_gl, "transferQueueBytes", int, (int) _queuedTransferSize)
 
     static auto lastReport = usecTimestampNow();
     auto now = usecTimestampNow();
     auto lastReportInterval = now - lastReport;
     if (lastReportInterval > USECS_PER_SECOND * 4) {
         lastReport = now;
-        qCDebug(gpulogging) << "Texture list " << _transferringTextures.size();
+        qCDebug(gpulogging) << "Texture list " << _transferringTextures.size() << " queued bytes " << _queuedTransferSize;
     }
 
-    size_t transferCount = 0;
+    Size budget = TEXTURE_TRANSFER_BYTES_PER_PASS;
     for (_textureIterator = _transferringTextures.begin(); _textureIterator != _transferringTextures.end();) {
-        if (++transferCount > MAX_TRANSFERS_PER_PASS) {
-            break;
-        }
         auto texture = *_textureIterator;
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
-        if (gltexture->continueTransfer()) {
-            ++_textureIterator;
-            continue;
+        if (gltexture->continueTransfer(budget)) {
+            // out of budget mid-texture; the texture's own cursor records where to resume,
+            // and the highest-priority texture keeps its place at the front of the queue
+            break;
         }
 
         gltexture->finishTransfer();
+        _queuedTransferSize -= std::min<Size>(_queuedTransferSize, texture->getSize());
 
 #ifdef TEXTURE_TRANSFER_FORCE_DRAW
         // FIXME force a draw on the texture transfer thread before passing the texture to the main thread for use
@@ -70,6 +70,8 @@ private:
     // Only used on the transfer thread
     TextureList _transferringTextures;
     TextureListIterator _textureIterator;
+    // Approximate bytes still queued for upload, for queue depth stats
+    Size _queuedTransferSize { 0 };
 
 };
 
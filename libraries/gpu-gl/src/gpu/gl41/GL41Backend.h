@@ -46,8 +46,9 @@ public:
         GL41Texture(const std::weak_ptr<GLBackend>& backend, const Texture& buffer, bool transferrable);
 
     protected:
-        void transferMip(uint16_t mipLevel, uint8_t face) const;
+        void transferMip(uint16_t mipLevel, uint8_t face, uint32_t rowOffset, uint32_t rows) const;
         void startTransfer() override;
+        bool continueTransfer(Size& budget) override;
         void allocateStorage() const override;
         void updateSize() const override;
         void syncSampler() const override;
@@ -10,6 +10,7 @@
 //
 #include "GL41Backend.h"
 
+#include <algorithm>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -110,14 +111,16 @@ void GL41Texture::updateSize() const {
     } 
 }
 
-// Move content bits from the CPU to the GPU for a given mip / face
-void GL41Texture::transferMip(uint16_t mipLevel, uint8_t face) const {
+// Move a row range of content bits from the CPU to the GPU for a given mip / face
+void GL41Texture::transferMip(uint16_t mipLevel, uint8_t face, uint32_t rowOffset, uint32_t rows) const {
     auto mip = _gpuObject.accessStoredMipFace(mipLevel, face);
     GLTexelFormat texelFormat = GLTexelFormat::evalGLTexelFormat(_gpuObject.getTexelFormat(), mip->getFormat());
     //GLenum target = getFaceTargets()[face];
     GLenum target = _target == GL_TEXTURE_2D ? GL_TEXTURE_2D : CUBE_FACE_LAYOUT[face];
     auto size = _gpuObject.evalMipDimensions(mipLevel);
-    glTexSubImage2D(target, mipLevel, 0, 0, size.x, size.y, texelFormat.format, texelFormat.type, mip->readData());
+    Size bytesPerRow = size.y > 0 ? mip->getSize() / size.y : mip->getSize();
+    glTexSubImage2D(target, mipLevel, 0, rowOffset, size.x, rows, texelFormat.format, texelFormat.type,
+                    mip->readData() + rowOffset * bytesPerRow);
     (void)CHECK_GL_ERROR();
 }
 
@@ -128,15 +131,41 @@ void GL41Texture::startTransfer() {
     glBindTexture(_target, _id);
     (void)CHECK_GL_ERROR();
 
-    // transfer pixels from each faces
+    // this path iterates stored mips from zero rather than from _minMip
+    _transferMip = 0;
+}
+
+// Pixels move to the GPU in budgeted slices so a single large texture can't absorb a
+// whole pass; the cursor in the base class tracks where to resume
+bool GL41Texture::continueTransfer(Size& budget) {
+    PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
+    glBindTexture(_target, _id);
+
     uint8_t numFaces = (Texture::TEX_CUBE == _gpuObject.getType()) ? CUBE_NUM_FACES : 1;
-    for (uint8_t f = 0; f < numFaces; f++) {
-        for (uint16_t i = 0; i < Sampler::MAX_MIP_LEVEL; ++i) {
-            if (_gpuObject.isStoredMipFaceAvailable(i, f)) {
-                transferMip(i, f);
+    for (; _transferFace < numFaces; ++_transferFace, _transferMip = 0) {
+        for (; _transferMip < Sampler::MAX_MIP_LEVEL; ++_transferMip, _transferRow = 0) {
+            if (!_gpuObject.isStoredMipFaceAvailable(_transferMip, _transferFace)) {
+                continue;
+            }
+            auto mip = _gpuObject.accessStoredMipFace(_transferMip, _transferFace);
+            auto size = _gpuObject.evalMipDimensions(_transferMip);
+            Size bytesPerRow = size.y > 0 ? mip->getSize() / size.y : mip->getSize();
+            while (_transferRow < size.y) {
+                if (0 == budget) {
+                    return true;
+                }
+                uint32_t rows = size.y - _transferRow;
+                if (bytesPerRow > 0) {
+                    rows = std::min<uint32_t>(rows, (uint32_t)std::max<Size>(1, budget / bytesPerRow));
+                }
+                transferMip(_transferMip, _transferFace, _transferRow, rows);
+                _transferRow += rows;
+                Size transferred = (Size)rows * bytesPerRow;
+                budget = transferred >= budget ? 0 : budget - transferred;
             }
         }
     }
+    return false;
 }
 
 void GL41Backend::GL41Texture::syncSampler() const {
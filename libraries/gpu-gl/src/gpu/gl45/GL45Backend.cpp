@@ -18,6 +18,16 @@ Q_LOGGING_CATEGORY(gpugl45logging, "hifi.gpu.gl45")
 using namespace gpu;
 using namespace gpu::gl45;
 
+GL45Backend::~GL45Backend() {
+    _cameraRing.destroy();
+    _objectRing.destroy();
+    _drawCallInfoRing.destroy();
+    // The stream buffers alias the rings just destroyed, keep killTransform from deleting them again
+    _transform._cameraBuffer = 0;
+    _transform._objectBuffer = 0;
+    _transform._drawCallInfoBuffer = 0;
+}
+
 void GL45Backend::do_draw(const Batch& batch, size_t paramOffset) {
     Primitive primitiveType = (Primitive)batch._params[paramOffset + 2]._uint;
     GLenum mode = gl::PRIMITIVE_TO_GL[primitiveType];
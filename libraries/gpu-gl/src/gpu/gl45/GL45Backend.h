@@ -28,6 +28,7 @@ class GL45Backend : public GLBackend {
 public:
     explicit GL45Backend(bool syncCache) : Parent(syncCache) {}
     GL45Backend() : Parent() {}
+    ~GL45Backend();
 
     class GL45Texture : public GLTexture {
         using Parent = GLTexture;
@@ -64,7 +65,7 @@ public:
         void updateMips() override;
         void stripToMip(uint16_t newMinMip);
         void startTransfer() override;
-        bool continueTransfer() override;
+        bool continueTransfer(Size& budget) override;
         void finishTransfer() override;
         void incrementalTransfer(const uvec3& size, const gpu::Texture::PixelsPointer& mip, std::function<void(const ivec3& offset, const uvec3& size)> f) const;
         void transferMip(uint16_t mipLevel, uint8_t face = 0) const;
@@ -115,6 +116,32 @@ protected:
     void initTransform() override;
     void updateTransform(const Batch& batch) override;
 
+    // Ring of persistently mapped buffers cycled once per batch so the per-frame
+    // transform streams are written straight into GPU visible memory, without
+    // orphaning or glBufferSubData.  NUM_FRAMES deep so the CPU writes one frame
+    // while the GPU still reads the previous ones; a fence per frame guards reuse.
+    struct TransformStreamRing {
+        static const int NUM_FRAMES = 3;
+        struct Frame {
+            GLuint buffer { 0 };
+            uint8_t* mapped { nullptr };
+            GLsizeiptr capacity { 0 };
+            GLsync fence { nullptr };
+        };
+
+        // Fence the frame written last time, step to the next one, wait until the GPU
+        // released it and copy the stream into its mapping; returns the buffer holding the data
+        GLuint write(const void* data, GLsizeiptr size);
+        void destroy();
+
+        Frame _frames[NUM_FRAMES];
+        int _current { 0 };
+    };
+
+    mutable TransformStreamRing _cameraRing;
+    mutable TransformStreamRing _objectRing;
+    mutable TransformStreamRing _drawCallInfoRing;
+
     // Output stage
     void do_blit(const Batch& batch, size_t paramOffset) override;
 
@@ -296,36 +296,56 @@ void GL45Texture::startTransfer() {
     _sparseInfo.update();
 }
 
-bool GL45Texture::continueTransfer() {
+bool GL45Texture::continueTransfer(Size& budget) {
     PROFILE_RANGE(render_gpu_gl, "continueTransfer")
     size_t maxFace = GL_TEXTURE_CUBE_MAP == _target ? CUBE_NUM_FACES : 1;
-    for (uint8_t face = 0; face < maxFace; ++face) {
-        for (uint16_t mipLevel = _minMip; mipLevel <= _maxMip; ++mipLevel) {
-            auto size = _gpuObject.evalMipDimensions(mipLevel);
-            if (_sparseInfo.sparse && mipLevel <= _sparseInfo.maxSparseLevel) {
-                glTexturePageCommitmentEXT(_id, mipLevel, 0, 0, face, size.x, size.y, 1, GL_TRUE);
+    for (; _transferFace < maxFace; ++_transferFace, _transferMip = _minMip) {
+        for (; _transferMip <= _maxMip; ++_transferMip, _transferRow = 0) {
+            if (0 == budget) {
+                // resume here next pass, before committing pages for this mip
+                return true;
+            }
+            auto size = _gpuObject.evalMipDimensions(_transferMip);
+            if (0 == _transferRow && _sparseInfo.sparse && _transferMip <= _sparseInfo.maxSparseLevel) {
+                glTexturePageCommitmentEXT(_id, _transferMip, 0, 0, _transferFace, size.x, size.y, 1, GL_TRUE);
                 _sparseInfo.allocatedPages += _sparseInfo.getPageCount(size);
             }
-            if (_gpuObject.isStoredMipFaceAvailable(mipLevel, face)) {
-                PROFILE_RANGE_EX(render_gpu_gl, "texSubImage", 0x0000ffff, (size.x * size.y * maxFace / 1024));
+            if (!_gpuObject.isStoredMipFaceAvailable(_transferMip, _transferFace)) {
+                continue;
+            }
+
+            auto mip = _gpuObject.accessStoredMipFace(_transferMip, _transferFace);
+            GLTexelFormat texelFormat = GLTexelFormat::evalGLTexelFormat(_gpuObject.getTexelFormat(), mip->getFormat());
+            Size bytesPerRow = size.y > 0 ? mip->getSize() / size.y : mip->getSize();
+            while (_transferRow < size.y) {
+                if (0 == budget) {
+                    return true;
+                }
+                GLsizei rows = (GLsizei)(size.y - _transferRow);
+                if (bytesPerRow > 0) {
+                    rows = std::min<GLsizei>(rows, (GLsizei)std::max<Size>(1, budget / bytesPerRow));
+                }
+                const Byte* data = mip->readData() + _transferRow * bytesPerRow;
+                PROFILE_RANGE_EX(render_gpu_gl, "texSubImage", 0x0000ffff, (size.x * rows / 1024));
 
-                auto mip = _gpuObject.accessStoredMipFace(mipLevel, face);
-                GLTexelFormat texelFormat = GLTexelFormat::evalGLTexelFormat(_gpuObject.getTexelFormat(), mip->getFormat());
                 if (GL_TEXTURE_2D == _target) {
-                    glTextureSubImage2D(_id, mipLevel, 0, 0, size.x, size.y, texelFormat.format, texelFormat.type, mip->readData());
+                    glTextureSubImage2D(_id, _transferMip, 0, _transferRow, size.x, rows, texelFormat.format, texelFormat.type, data);
                 } else if (GL_TEXTURE_CUBE_MAP == _target) {
                     // DSA ARB does not work on AMD, so use EXT
                     // unless EXT is not available on the driver
                     if (glTextureSubImage2DEXT) {
-                        auto target = CUBE_FACE_LAYOUT[face];
-                        glTextureSubImage2DEXT(_id, target, mipLevel, 0, 0, size.x, size.y, texelFormat.format, texelFormat.type, mip->readData());
+                        auto target = CUBE_FACE_LAYOUT[_transferFace];
+                        glTextureSubImage2DEXT(_id, target, _transferMip, 0, _transferRow, size.x, rows, texelFormat.format, texelFormat.type, data);
                     } else {
-                        glTextureSubImage3D(_id, mipLevel, 0, 0, face, size.x, size.y, 1, texelFormat.format, texelFormat.type, mip->readData());
+                        glTextureSubImage3D(_id, _transferMip, 0, _transferRow, _transferFace, size.x, rows, 1, texelFormat.format, texelFormat.type, data);
                     }
                 } else {
                     Q_ASSERT(false);
                 }
                 (void)CHECK_GL_ERROR();
+                _transferRow += rows;
+                Size transferred = (Size)rows * bytesPerRow;
+                budget = transferred >= budget ? 0 : budget - transferred;
             }
         }
     }
@@ -508,7 +528,13 @@ void GL45Backend::derezTextures() const {
     {
         auto& textures = texturesByMipCounts[mipLevel];
         assert(!textures.empty());
-        targetTexture = *textures.begin();
+        // Among the textures with the most resident mips, strip the one that was
+        // sampled the longest ago
+        for (const auto& texture : textures) {
+            if (!targetTexture || texture->getLastBound() < targetTexture->getLastBound()) {
+                targetTexture = texture;
+            }
+        }
     }
     lock.unlock();
     targetTexture->derez();
@@ -10,15 +10,13 @@
 //
 #include "GL45Backend.h"
 
+#include <QtCore/QThread>
+
 using namespace gpu;
 using namespace gpu::gl45;
 
 void GL45Backend::initTransform() {
-    GLuint transformBuffers[3];
-    glCreateBuffers(3, transformBuffers);
-    _transform._objectBuffer = transformBuffers[0];
-    _transform._cameraBuffer = transformBuffers[1];
-    _transform._drawCallInfoBuffer = transformBuffers[2];
+    // The transform streams live in the persistently mapped rings, allocated on first write
     glCreateTextures(GL_TEXTURE_BUFFER, 1, &_transform._objectBufferTexture);
     size_t cameraSize = sizeof(TransformStageState::CameraBufferElement);
     while (_transform._cameraUboSize < cameraSize) {
@@ -26,6 +24,68 @@ void GL45Backend::initTransform() {
     }
 }
 
+GLuint GL45Backend::TransformStreamRing::write(const void* data, GLsizeiptr size) {
+    // Fence the frame written by the previous batch now that all of its reads are issued
+    auto& previous = _frames[_current];
+    if (previous.buffer) {
+        if (previous.fence) {
+            glDeleteSync(previous.fence);
+        }
+        previous.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    _current = (_current + 1) % NUM_FRAMES;
+    auto& frame = _frames[_current];
+
+    // With the ring NUM_FRAMES deep this wait is expected to return immediately
+    if (frame.fence) {
+        auto result = glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (GL_TIMEOUT_EXPIRED == result || GL_WAIT_FAILED == result) {
+            // Minimum sleep
+            QThread::usleep(1);
+            result = glClientWaitSync(frame.fence, 0, 0);
+        }
+        glDeleteSync(frame.fence);
+        frame.fence = nullptr;
+    }
+
+    if (frame.capacity < size) {
+        if (frame.buffer) {
+            glUnmapNamedBuffer(frame.buffer);
+            glDeleteBuffers(1, &frame.buffer);
+        }
+        const GLsizeiptr INITIAL_CAPACITY = 4096;
+        GLsizeiptr capacity = (frame.capacity ? frame.capacity : INITIAL_CAPACITY);
+        while (capacity < size) {
+            capacity *= 2;
+        }
+        frame.capacity = capacity;
+        glCreateBuffers(1, &frame.buffer);
+        GLbitfield accessFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glNamedBufferStorage(frame.buffer, frame.capacity, nullptr, accessFlags);
+        frame.mapped = (uint8_t*)glMapNamedBufferRange(frame.buffer, 0, frame.capacity, accessFlags);
+    }
+
+    memcpy(frame.mapped, data, size);
+    return frame.buffer;
+}
+
+void GL45Backend::TransformStreamRing::destroy() {
+    for (auto& frame : _frames) {
+        if (frame.fence) {
+            glDeleteSync(frame.fence);
+            frame.fence = nullptr;
+        }
+        if (frame.buffer) {
+            glUnmapNamedBuffer(frame.buffer);
+            glDeleteBuffers(1, &frame.buffer);
+            frame.buffer = 0;
+            frame.mapped = nullptr;
+            frame.capacity = 0;
+        }
+    }
+}
+
 void GL45Backend::transferTransformState(const Batch& batch) const {
     // FIXME not thread safe
     static std::vector<uint8_t> bufferData;
@@ -34,11 +94,11 @@ void GL45Backend::transferTransformState(const Batch& batch) const {
         for (size_t i = 0; i < _transform._cameras.size(); ++i) {
             memcpy(bufferData.data() + (_transform._cameraUboSize * i), &_transform._cameras[i], sizeof(TransformStageState::CameraBufferElement));
         }
-        glNamedBufferData(_transform._cameraBuffer, bufferData.size(), bufferData.data(), GL_STREAM_DRAW);
+        _transform._cameraBuffer = _cameraRing.write(bufferData.data(), bufferData.size());
     }
 
     if (!batch._objects.empty()) {
-        glNamedBufferData(_transform._objectBuffer, batch._objects.size() * sizeof(Batch::TransformObject), batch._objects.data(), GL_STREAM_DRAW);
+        _transform._objectBuffer = _objectRing.write(batch._objects.data(), batch._objects.size() * sizeof(Batch::TransformObject));
     }
 
     if (!batch._namedData.empty()) {
@@ -50,7 +110,7 @@ void GL45Backend::transferTransformState(const Batch& batch) const {
             memcpy(bufferData.data() + currentSize, data.second.drawCallInfos.data(), bytesToCopy);
             _transform._drawCallInfoOffsets[data.first] = (GLvoid*)currentSize;
         }
-        glNamedBufferData(_transform._drawCallInfoBuffer, bufferData.size(), bufferData.data(), GL_STREAM_DRAW);
+        _transform._drawCallInfoBuffer = _drawCallInfoRing.write(bufferData.data(), bufferData.size());
     }
 
 #ifdef GPU_SSBO_DRAW_CALL_INFO
@@ -58,7 +118,9 @@ void GL45Backend::transferTransformState(const Batch& batch) const {
 #else
     glActiveTexture(GL_TEXTURE0 + TRANSFORM_OBJECT_SLOT);
     glBindTexture(GL_TEXTURE_BUFFER, _transform._objectBufferTexture);
-    glTextureBuffer(_transform._objectBufferTexture, GL_RGBA32F, _transform._objectBuffer);
+    if (_transform._objectBuffer) {
+        glTextureBuffer(_transform._objectBufferTexture, GL_RGBA32F, _transform._objectBuffer);
+    }
 #endif
 
     CHECK_GL_ERROR();
@@ -30,20 +30,61 @@ ProfileRangeBatch::~ProfileRangeBatch() {
 
 using namespace gpu;
 
-size_t Batch::_commandsMax { BATCH_PREALLOCATE_MIN };
-size_t Batch::_commandOffsetsMax { BATCH_PREALLOCATE_MIN };
-size_t Batch::_paramsMax { BATCH_PREALLOCATE_MIN };
-size_t Batch::_dataMax { BATCH_PREALLOCATE_MIN };
-size_t Batch::_objectsMax { BATCH_PREALLOCATE_MIN };
-size_t Batch::_drawCallInfosMax { BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_commandsMax { BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_commandOffsetsMax { BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_paramsMax { BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_dataMax { BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_objectsMax { BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_drawCallInfosMax { BATCH_PREALLOCATE_MIN };
+
+// Recycled batch storage, shared by every batch like the preallocation watermarks:
+// a dying batch parks its cleared command buffers here and the next batch constructed
+// on any thread adopts them, so steady state recording performs no allocations.
+// Parked storage is raw capacity only - batches release the resources they reference
+// before donating.
+struct BatchStorage {
+    Batch::Commands commands;
+    Batch::CommandOffsets commandOffsets;
+    Batch::Params params;
+    Batch::Bytes data;
+    Batch::TransformObjects objects;
+    Batch::DrawCallInfoBuffer drawCallInfos;
+    std::vector<Batch::Cache<BufferPointer>> buffers;
+    std::vector<Batch::Cache<TexturePointer>> textures;
+    std::vector<Batch::Cache<Stream::FormatPointer>> streamFormats;
+    std::vector<Batch::Cache<Transform>> transforms;
+    std::vector<Batch::Cache<PipelinePointer>> pipelines;
+    std::vector<Batch::Cache<FramebufferPointer>> framebuffers;
+    std::vector<Batch::Cache<QueryPointer>> queries;
+    std::vector<Batch::Cache<std::function<void()>>> lambdas;
+    std::vector<Batch::Cache<std::string>> profileRanges;
+    std::vector<Batch::Cache<std::string>> names;
+};
+
+static std::mutex _batchStorageMutex;
+static std::vector<BatchStorage> _batchStoragePool;
+static const size_t MAX_POOLED_BATCH_STORAGE = 128;
 
 Batch::Batch() {
+    if (adoptStorage()) {
+        return;
+    }
     _commands.reserve(_commandsMax);
     _commandOffsets.reserve(_commandOffsetsMax);
     _params.reserve(_paramsMax);
     _data.reserve(_dataMax);
     _objects.reserve(_objectsMax);
     _drawCallInfos.reserve(_drawCallInfosMax);
+    _buffers._items.reserve(Cache<BufferPointer>::_max);
+    _textures._items.reserve(Cache<TexturePointer>::_max);
+    _streamFormats._items.reserve(Cache<Stream::FormatPointer>::_max);
+    _transforms._items.reserve(Cache<Transform>::_max);
+    _pipelines._items.reserve(Cache<PipelinePointer>::_max);
+    _framebuffers._items.reserve(Cache<FramebufferPointer>::_max);
+    _queries._items.reserve(Cache<QueryPointer>::_max);
+    _lambdas._items.reserve(Cache<std::function<void()>>::_max);
+    _profileRanges._items.reserve(Cache<std::string>::_max);
+    _names._items.reserve(Cache<std::string>::_max);
 }
 
 Batch::Batch(const Batch& batch_) {
@@ -74,21 +115,100 @@ Batch::Batch(const Batch& batch_) {
 }
 
 Batch::~Batch() {
-    _commandsMax = std::max(_commands.size(), _commandsMax);
-    _commandOffsetsMax = std::max(_commandOffsets.size(), _commandOffsetsMax);
-    _paramsMax = std::max(_params.size(), _paramsMax);
-    _dataMax = std::max(_data.size(), _dataMax);
-    _objectsMax = std::max(_objects.size(), _objectsMax);
-    _drawCallInfosMax = std::max(_drawCallInfos.size(), _drawCallInfosMax);
+    updateSizeMax(_commandsMax, _commands.size());
+    updateSizeMax(_commandOffsetsMax, _commandOffsets.size());
+    updateSizeMax(_paramsMax, _params.size());
+    updateSizeMax(_dataMax, _data.size());
+    updateSizeMax(_objectsMax, _objects.size());
+    updateSizeMax(_drawCallInfosMax, _drawCallInfos.size());
+    donateStorage();
+}
+
+bool Batch::adoptStorage() {
+    // only a batch with no storage of its own - freshly constructed, or gutted by the
+    // stealing copy constructor - may adopt, otherwise warm capacity would be discarded
+    if (_commands.capacity() != 0 || _data.capacity() != 0) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(_batchStorageMutex);
+    if (_batchStoragePool.empty()) {
+        return false;
+    }
+    BatchStorage& storage = _batchStoragePool.back();
+    _commands.swap(storage.commands);
+    _commandOffsets.swap(storage.commandOffsets);
+    _params.swap(storage.params);
+    _data.swap(storage.data);
+    _objects.swap(storage.objects);
+    _drawCallInfos.swap(storage.drawCallInfos);
+    _buffers._items.swap(storage.buffers);
+    _textures._items.swap(storage.textures);
+    _streamFormats._items.swap(storage.streamFormats);
+    _transforms._items.swap(storage.transforms);
+    _pipelines._items.swap(storage.pipelines);
+    _framebuffers._items.swap(storage.framebuffers);
+    _queries._items.swap(storage.queries);
+    _lambdas._items.swap(storage.lambdas);
+    _profileRanges._items.swap(storage.profileRanges);
+    _names._items.swap(storage.names);
+    _batchStoragePool.pop_back();
+    return true;
+}
+
+void Batch::donateStorage() {
+    // batches gutted by the stealing copy constructor have nothing worth parking
+    if (_commands.capacity() == 0 && _data.capacity() == 0) {
+        return;
+    }
+
+    // the cache watermarks are normally fed by the Cache::Vector destructors, which
+    // will only see the emptied vectors, so feed them before clearing
+    updateSizeMax(Cache<BufferPointer>::_max, _buffers.size());
+    updateSizeMax(Cache<TexturePointer>::_max, _textures.size());
+    updateSizeMax(Cache<Stream::FormatPointer>::_max, _streamFormats.size());
+    updateSizeMax(Cache<Transform>::_max, _transforms.size());
+    updateSizeMax(Cache<PipelinePointer>::_max, _pipelines.size());
+    updateSizeMax(Cache<FramebufferPointer>::_max, _framebuffers.size());
+    updateSizeMax(Cache<QueryPointer>::_max, _queries.size());
+    updateSizeMax(Cache<std::function<void()>>::_max, _lambdas.size());
+    updateSizeMax(Cache<std::string>::_max, _profileRanges.size());
+    updateSizeMax(Cache<std::string>::_max, _names.size());
+
+    // drop the resources the batch referenced, exactly as destruction would, so the
+    // parked storage pins nothing
+    clear();
+
+    std::unique_lock<std::mutex> lock(_batchStorageMutex);
+    if (_batchStoragePool.size() >= MAX_POOLED_BATCH_STORAGE) {
+        return;
+    }
+    _batchStoragePool.resize(_batchStoragePool.size() + 1);
+    BatchStorage& storage = _batchStoragePool.back();
+    storage.commands.swap(_commands);
+    storage.commandOffsets.swap(_commandOffsets);
+    storage.params.swap(_params);
+    storage.data.swap(_data);
+    storage.objects.swap(_objects);
+    storage.drawCallInfos.swap(_drawCallInfos);
+    storage.buffers.swap(_buffers._items);
+    storage.textures.swap(_textures._items);
+    storage.streamFormats.swap(_streamFormats._items);
+    storage.transforms.swap(_transforms._items);
+    storage.pipelines.swap(_pipelines._items);
+    storage.framebuffers.swap(_framebuffers._items);
+    storage.queries.swap(_queries._items);
+    storage.lambdas.swap(_lambdas._items);
+    storage.profileRanges.swap(_profileRanges._items);
+    storage.names.swap(_names._items);
 }
 
 void Batch::clear() {
-    _commandsMax = std::max(_commands.size(), _commandsMax);
-    _commandOffsetsMax = std::max(_commandOffsets.size(), _commandOffsetsMax);
-    _paramsMax = std::max(_params.size(), _paramsMax);
-    _dataMax = std::max(_data.size(), _dataMax);
-    _objectsMax = std::max(_objects.size(), _objectsMax);
-    _drawCallInfosMax = std::max(_drawCallInfos.size(), _drawCallInfosMax);
+    updateSizeMax(_commandsMax, _commands.size());
+    updateSizeMax(_commandOffsetsMax, _commandOffsets.size());
+    updateSizeMax(_paramsMax, _params.size());
+    updateSizeMax(_dataMax, _data.size());
+    updateSizeMax(_objectsMax, _objects.size());
+    updateSizeMax(_drawCallInfosMax, _drawCallInfos.size());
 
     _commands.clear();
     _commandOffsets.clear();
@@ -102,6 +222,14 @@ void Batch::clear() {
     _framebuffers.clear();
     _objects.clear();
     _drawCallInfos.clear();
+    _queries.clear();
+    _lambdas.clear();
+    _profileRanges.clear();
+    _names.clear();
+    _namedData.clear();
+    _currentNamedCall.clear();
+    // A cleared batch must capture a fresh transform object before its first draw
+    _invalidModel = true;
 }
 
 size_t Batch::cacheData(size_t size, const void* data) {
@@ -612,6 +740,151 @@ void Batch::_glColor4f(float red, float green, float blue, float alpha) {
     _params.emplace_back(red);
 }
 
+void Batch::consolidateIndirectDraws() {
+    // A run only pays for its indirect buffer bind once it merges a few draws
+    const uint32 MIN_RUN_LENGTH = 3;
+
+    struct Run {
+        size_t firstCommand;
+        uint32 length;
+    };
+    std::vector<Run> runs;
+    {
+        Run run { 0, 0 };
+        uint32 runPrimitive { 0 };
+        bool inNamedCall = false;
+        auto endRun = [&] {
+            if (run.length >= MIN_RUN_LENGTH) {
+                runs.push_back(run);
+            }
+            run.length = 0;
+        };
+        for (size_t i = 0; i < _commands.size(); i++) {
+            switch (_commands[i]) {
+                case COMMAND_startNamedCall:
+                    inNamedCall = true;
+                    endRun();
+                    break;
+                case COMMAND_stopNamedCall:
+                    inNamedCall = false;
+                    break;
+                case COMMAND_drawIndexed: {
+                    if (inNamedCall) {
+                        break;
+                    }
+                    uint32 primitive = _params[_commandOffsets[i] + 2]._uint;
+                    if (run.length > 0 && primitive == runPrimitive) {
+                        run.length++;
+                    } else {
+                        endRun();
+                        run = { i, 1 };
+                        runPrimitive = primitive;
+                    }
+                    break;
+                }
+                default:
+                    // Any other command can change the state shared by the run
+                    endRun();
+                    break;
+            }
+        }
+        endRun();
+    }
+    if (runs.empty()) {
+        return;
+    }
+
+    // All the runs point into one shared indirect command buffer through the offset
+    // carried by their setIndirectBuffer command; it is cached in _buffers like any
+    // other buffer so it is synced and flushed through the regular paths
+    std::vector<DrawIndexedIndirectCommand> indirectCommands;
+    {
+        size_t numIndirectCommands = 0;
+        for (const auto& run : runs) {
+            numIndirectCommands += run.length;
+        }
+        indirectCommands.reserve(numIndirectCommands);
+    }
+    BufferPointer indirectBuffer = std::make_shared<Buffer>();
+    auto indirectBufferIndex = _buffers.cache(indirectBuffer);
+
+    Commands commands;
+    commands.reserve(_commands.size());
+    CommandOffsets commandOffsets;
+    commandOffsets.reserve(_commandOffsets.size());
+    DrawCallInfoBuffer drawCallInfos;
+    drawCallInfos.reserve(_drawCallInfos.size());
+
+    // The next _drawCallInfos entry consumed by a draw command outside of a named call
+    size_t drawCursor = 0;
+    bool inNamedCall = false;
+    size_t nextRun = 0;
+    for (size_t i = 0; i < _commands.size(); i++) {
+        auto command = _commands[i];
+        if (nextRun < runs.size() && i == runs[nextRun].firstCommand) {
+            const auto& run = runs[nextRun++];
+            Offset indirectOffset = indirectCommands.size() * sizeof(DrawIndexedIndirectCommand);
+            uint32 primitive = _params[_commandOffsets[i] + 2]._uint;
+            for (size_t j = i; j < i + run.length; j++) {
+                DrawIndexedIndirectCommand indirectCommand;
+                indirectCommand._count = _params[_commandOffsets[j] + 1]._uint;
+                indirectCommand._instanceCount = 1;
+                indirectCommand._firstIndex = _params[_commandOffsets[j] + 0]._uint;
+                indirectCommands.push_back(indirectCommand);
+            }
+
+            commands.push_back(COMMAND_setIndirectBuffer);
+            commandOffsets.push_back(_params.size());
+            _params.emplace_back(indirectBufferIndex);
+            _params.emplace_back(indirectOffset);
+            _params.emplace_back(Offset(0));
+
+            commands.push_back(COMMAND_multiDrawIndexedIndirect);
+            commandOffsets.push_back(_params.size());
+            _params.emplace_back(run.length);
+            _params.emplace_back(primitive);
+
+            // The whole run shares its model transform so one draw call info covers it
+            if (drawCursor < _drawCallInfos.size()) {
+                drawCallInfos.push_back(_drawCallInfos[drawCursor]);
+            }
+            drawCursor += run.length;
+
+            i += run.length - 1;
+            continue;
+        }
+
+        switch (command) {
+            case COMMAND_startNamedCall:
+                inNamedCall = true;
+                break;
+            case COMMAND_stopNamedCall:
+                inNamedCall = false;
+                break;
+            case COMMAND_draw:
+            case COMMAND_drawIndexed:
+            case COMMAND_drawInstanced:
+            case COMMAND_drawIndexedInstanced:
+            case COMMAND_multiDrawIndirect:
+            case COMMAND_multiDrawIndexedIndirect:
+                if (!inNamedCall && drawCursor < _drawCallInfos.size()) {
+                    drawCallInfos.push_back(_drawCallInfos[drawCursor++]);
+                }
+                break;
+            default:
+                break;
+        }
+        commands.push_back(command);
+        commandOffsets.push_back(_commandOffsets[i]);
+    }
+
+    indirectBuffer->setData(indirectCommands.size() * sizeof(DrawIndexedIndirectCommand), (const Byte*)indirectCommands.data());
+
+    _commands.swap(commands);
+    _commandOffsets.swap(commandOffsets);
+    _drawCallInfos.swap(drawCallInfos);
+}
+
 void Batch::finishFrame(BufferUpdates& updates) {
     for (auto& mapItem : _namedData) {
         auto& name = mapItem.first;
@@ -674,3 +947,27 @@ void Batch::flush() {
         buffer->flush();
     }
 }
+
+BatchPointer BatchPool::acquire() {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_batches.empty()) {
+            BatchPointer batch = _batches.back();
+            _batches.pop_back();
+            return batch;
+        }
+    }
+    return std::make_shared<Batch>();
+}
+
+void BatchPool::release(const BatchPointer& batch) {
+    if (!batch) {
+        return;
+    }
+    batch->clear();
+    // a released batch whose storage was stolen by Context::appendFrameBatch re-arms
+    // itself with parked storage so the next acquire starts warm
+    batch->adoptStorage();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _batches.push_back(batch);
+}
@@ -11,6 +11,8 @@
 #ifndef hifi_gpu_Batch_h
 #define hifi_gpu_Batch_h
 
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <mutex>
 #include <functional>
@@ -67,6 +69,14 @@ public:
 
     using DrawCallInfoBuffer = std::vector<DrawCallInfo>;
 
+    // The preallocation watermarks are shared by every batch, including the ones
+    // recorded concurrently on worker threads, so they only move through this helper
+    static void updateSizeMax(std::atomic<size_t>& max, size_t value) {
+        size_t prev = max.load();
+        while (value > prev && !max.compare_exchange_weak(prev, value)) {
+        }
+    }
+
     struct NamedBatchData {
         using BufferPointers = std::vector<BufferPointer>;
         using Function = std::function<void(gpu::Batch&, NamedBatchData&)>;
@@ -87,7 +97,7 @@ public:
     using NamedBatchDataMap = std::map<std::string, NamedBatchData>;
 
     DrawCallInfoBuffer _drawCallInfos;
-    static size_t _drawCallInfosMax;
+    static std::atomic<size_t> _drawCallInfosMax;
 
     mutable std::string _currentNamedCall;
 
@@ -103,6 +113,13 @@ public:
 
     void clear();
 
+    // The storage recycler: a dying batch that still owns its command buffers parks them
+    // in a shared pool instead of freeing them, and a newly constructed (or gutted) batch
+    // adopts parked buffers instead of reallocating, so steady state recording reuses the
+    // same warm storage frame after frame. Both are safe to call from any thread.
+    bool adoptStorage();
+    void donateStorage();
+
     // Batches may need to override the context level stereo settings
     // if they're performing framebuffer copy operations, like the 
     // deferred lighting resolution mechanism
@@ -366,18 +383,14 @@ public:
         typedef T Data;
         Data _data;
         Cache<T>(const Data& data) : _data(data) {}
-        static size_t _max;
+        static std::atomic<size_t> _max;
 
         class Vector {
         public:
             std::vector< Cache<T> > _items;
 
-            Vector() {
-                _items.reserve(_max);
-            }
-
             ~Vector() {
-                _max = std::max(_items.size(), _max);
+                updateSizeMax(_max, _items.size());
             }
 
 
@@ -431,16 +444,16 @@ public:
     }
 
     Commands _commands;
-    static size_t _commandsMax;
+    static std::atomic<size_t> _commandsMax;
 
     CommandOffsets _commandOffsets;
-    static size_t _commandOffsetsMax;
+    static std::atomic<size_t> _commandOffsetsMax;
 
     Params _params;
-    static size_t _paramsMax;
+    static std::atomic<size_t> _paramsMax;
 
     Bytes _data;
-    static size_t _dataMax;
+    static std::atomic<size_t> _dataMax;
 
     // SSBO class... layout MUST match the layout in Transform.slh
     class TransformObject {
@@ -453,7 +466,7 @@ public:
     bool _invalidModel { true };
     Transform _currentModel;
     TransformObjects _objects;
-    static size_t _objectsMax;
+    static std::atomic<size_t> _objectsMax;
 
     BufferCaches _buffers;
     TextureCaches _textures;
@@ -484,6 +497,14 @@ protected:
     // MUST only be called on batches created on the render thread
     void flush();
 
+    // Batch finalization: collapse each run of back to back drawIndexed commands - which by
+    // construction share their pipeline, input, textures and model transform - into a single
+    // multiDrawIndexedIndirect submission fed from a generated indirect command buffer.
+    // The baked commands draw one instance each so this MUST NOT be applied to batches
+    // rendered in stereo, where the backend adjusts the instance count per draw.
+    // Must run before the buffers are flushed so the indirect buffer reaches the render thread.
+    void consolidateIndirectDraws();
+
     void startNamedCall(const std::string& name);
     void stopNamedCall();
 
@@ -494,7 +515,24 @@ protected:
 };
 
 template <typename T>
-size_t Batch::Cache<T>::_max = BATCH_PREALLOCATE_MIN;
+std::atomic<size_t> Batch::Cache<T>::_max { BATCH_PREALLOCATE_MIN };
+
+using BatchPointer = std::shared_ptr<Batch>;
+
+// A thread safe pool of recycled batches, so worker threads recording segments of the
+// frame in parallel reuse warm batch storage instead of reallocating it every frame.
+// Segments are stitched back into the frame in order with Context::appendFrameBatches;
+// the backend replays the frame batches back to back with its state carried across, so
+// consecutive segments behave exactly like one batch.
+class BatchPool {
+public:
+    BatchPointer acquire();
+    void release(const BatchPointer& batch);
+
+protected:
+    std::mutex _mutex;
+    std::vector<BatchPointer> _batches;
+};
 
 }
 
@@ -25,12 +25,14 @@ void ContextStats::evalDelta(const ContextStats& begin, const ContextStats& end)
 
     _RSNumTextureBounded = end._RSNumTextureBounded - begin._RSNumTextureBounded;
     _RSAmountTextureMemoryBounded = end._RSAmountTextureMemoryBounded - begin._RSAmountTextureMemoryBounded;
+    _RSNumRedundantTextureBounded = end._RSNumRedundantTextureBounded - begin._RSNumRedundantTextureBounded;
 
     _DSNumAPIDrawcalls = end._DSNumAPIDrawcalls - begin._DSNumAPIDrawcalls;
     _DSNumDrawcalls = end._DSNumDrawcalls - begin._DSNumDrawcalls;
     _DSNumTriangles= end._DSNumTriangles - begin._DSNumTriangles;
 
     _PSNumSetPipelines = end._PSNumSetPipelines - begin._PSNumSetPipelines;
+    _PSNumRedundantSetPipelines = end._PSNumRedundantSetPipelines - begin._PSNumRedundantSetPipelines;
 }
 
 
@@ -53,7 +55,7 @@ Context::~Context() {
 void Context::beginFrame(const glm::mat4& renderPose) {
     assert(!_frameActive);
     _frameActive = true;
-    _currentFrame = std::make_shared<Frame>();
+    _currentFrame = _framePool->acquire();
     _currentFrame->pose = renderPose;
 
     if (!_frameRangeTimer) {
@@ -69,6 +71,16 @@ void Context::appendFrameBatch(Batch& batch) {
     _currentFrame->batches.push_back(batch);
 }
 
+void Context::appendFrameBatches(const std::vector<BatchPointer>& batches) {
+    // Stitch segments recorded on worker threads into the frame in submission order;
+    // the backend replays them back to back so they are equivalent to one batch
+    for (const auto& batch : batches) {
+        if (batch) {
+            appendFrameBatch(*batch);
+        }
+    }
+}
+
 FramePointer Context::endFrame() {
     assert(_frameActive);
     auto result = _currentFrame;
@@ -82,6 +94,9 @@ FramePointer Context::endFrame() {
 
 void Context::executeBatch(Batch& batch) const {
     PROFILE_RANGE(render_gpu, __FUNCTION__);
+    if (!_stereo._enable) {
+        batch.consolidateIndirectDraws();
+    }
     batch.flush();
     _backend->render(batch);
 }
@@ -124,6 +139,13 @@ void Context::executeFrame(const FramePointer& frame) const {
     _frameStats.evalDelta(beginStats, endStats);
 }
 
+void Context::translateFrame(const FramePointer& frame) const {
+    PROFILE_RANGE(render_gpu, __FUNCTION__);
+    for (auto& batch : frame->batches) {
+        _backend->translate(batch);
+    }
+}
+
 bool Context::makeProgram(Shader& shader, const Shader::BindingSet& bindings) {
     // If we're running in another DLL context, we need to fetch the program callback out of the application
     // FIXME find a way to do this without reliance on Qt app properties
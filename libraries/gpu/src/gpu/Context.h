@@ -36,13 +36,16 @@ public:
 
     int _RSNumTextureBounded = 0;
     int _RSAmountTextureMemoryBounded = 0;
+    // Binds requested by the batches but elided because the backend state cache already matched
+    int _RSNumRedundantTextureBounded = 0;
 
     int _DSNumAPIDrawcalls = 0;
     int _DSNumDrawcalls = 0;
     int _DSNumTriangles = 0;
 
     int _PSNumSetPipelines = 0;
- 
+    int _PSNumRedundantSetPipelines = 0;
+
     ContextStats() {}
     ContextStats(const ContextStats& stats) = default;
 
@@ -56,6 +59,10 @@ public:
     void setStereoState(const StereoState& stereo) { _stereo = stereo; }
 
     virtual void render(const Batch& batch) = 0;
+    // Optionally pre-digest the CPU only portion of a batch (the per draw camera transforms)
+    // ahead of render(), possibly from another thread. Batches must be translated in the exact
+    // order they will be rendered; backends fall back to translating inline on a mismatch.
+    virtual void translate(const Batch& batch) {}
     virtual void syncCache() = 0;
     virtual void recycle() const = 0;
     virtual void downloadFramebuffer(const FramebufferPointer& srcFramebuffer, const Vec4i& region, QImage& destImage) = 0;
@@ -153,6 +160,9 @@ public:
 
     void beginFrame(const glm::mat4& renderPose = glm::mat4());
     void appendFrameBatch(Batch& batch);
+    // Append a sequence of batch segments recorded on worker threads, in order.
+    // The segments are consumed; return them to their BatchPool afterwards.
+    void appendFrameBatches(const std::vector<BatchPointer>& batches);
     FramePointer endFrame();
 
     // MUST only be called on the rendering thread
@@ -172,6 +182,12 @@ public:
     // generated, IN THE ORDER they were generated.
     void executeFrame(const FramePointer& frame) const;
 
+    // MAY be called from a thread other than the rendering thread, to translate the batches
+    // of a frame ahead of its executeFrame call. Frames MUST be translated in the order they
+    // will be executed; the backend discards the prepared work and translates inline during
+    // executeFrame if the order or the stereo state does not match.
+    void translateFrame(const FramePointer& frame) const;
+
     // MUST only be called on the rendering thread. 
     //
     // Consuming a frame applies any updates queued from the recording thread and applies them to the 
@@ -232,6 +248,8 @@ protected:
     std::shared_ptr<Backend> _backend;
     bool _frameActive { false };
     FramePointer _currentFrame;
+    // Frames recycle themselves through the pool when their last reference dies
+    FramePoolPointer _framePool { std::make_shared<FramePool>() };
     RangeTimerPointer _frameRangeTimer;
     StereoState  _stereo;
 
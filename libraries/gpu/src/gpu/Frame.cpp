@@ -25,6 +25,9 @@ Frame::~Frame() {
 
 void Frame::finish() {
     for (Batch& batch : batches) {
+        if (!stereoState._enable) {
+            batch.consolidateIndirectDraws();
+        }
         batch.finishFrame(bufferUpdates);
     }
 }
@@ -35,3 +38,47 @@ void Frame::preRender() {
     }
     bufferUpdates.clear();
 }
+
+void Frame::reset() {
+    if (framebuffer && framebufferRecycler) {
+        framebufferRecycler(framebuffer);
+        framebuffer.reset();
+    }
+
+    assert(bufferUpdates.empty());
+    if (!bufferUpdates.empty()) {
+        qFatal("Buffer sync error... frame recycled without buffer updates being applied");
+    }
+
+    // destroying the batches releases the resources they reference and parks their
+    // command buffers for the next recorded batch to adopt; the vector itself keeps
+    // its capacity for the next use of this frame
+    batches.clear();
+    overlay.reset();
+    framebufferRecycler = FramebufferRecycler();
+    stereoState = StereoState();
+    frameIndex = 0;
+    pose = Mat4();
+}
+
+FramePointer FramePool::acquire() {
+    Frame* frame = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_frames.empty()) {
+            frame = _frames.back().release();
+            _frames.pop_back();
+        }
+    }
+    if (!frame) {
+        frame = new Frame();
+    }
+    auto pool = shared_from_this();
+    return FramePointer(frame, [pool](Frame* frame) { pool->release(frame); });
+}
+
+void FramePool::release(Frame* frame) {
+    frame->reset();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _frames.push_back(std::unique_ptr<Frame>(frame));
+}
@@ -42,10 +42,35 @@ namespace gpu {
         FramebufferRecycler framebufferRecycler;
 
     protected:
+        friend class FramePool;
+
         // Should be called once per frame, on the recording thred
         void finish();
         void preRender();
+
+        // Returns the frame to its baseline state for reuse.  Performs the same duties
+        // as the destructor on the per-frame content - recycling the framebuffer and
+        // donating the batch storage - but keeps the frame object and its vectors warm.
+        void reset();
+    };
+
+    // A thread safe pool of recycled frames, the frame-level analogue of BatchPool:
+    // the frames it hands out return themselves when their last reference dies,
+    // typically on the present thread once the backend has consumed them, so steady
+    // state rendering reuses the same few frame objects instead of allocating one per
+    // frame.  The deleter keeps the pool alive, so in-flight frames may safely outlive
+    // the context that recorded them.
+    class FramePool : public std::enable_shared_from_this<FramePool> {
+    public:
+        FramePointer acquire();
+
+    protected:
+        void release(Frame* frame);
+
+        std::mutex _mutex;
+        std::vector<std::unique_ptr<Frame>> _frames;
     };
+    using FramePoolPointer = std::shared_ptr<FramePool>;
 
 };
 
@@ -196,6 +196,11 @@ bool Texture::Storage::isMipAvailable(uint16 level, uint8 face) const {
     return (mipFace && mipFace->getSize());
 }
 
+bool Texture::Storage::isMipGPULoaded(uint16 level, uint8 face) const {
+    PixelsPointer mipFace = getMipFace(level, face);
+    return (mipFace && mipFace->isGPULoaded());
+}
+
 bool Texture::Storage::allocateMip(uint16 level) {
     bool changed = false;
     if (level >= _mips.size()) {
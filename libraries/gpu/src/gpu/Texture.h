@@ -228,8 +228,9 @@ public:
         Size setData(const Element& format, Size size, const Byte* bytes );
         
         const Element& getFormat() const { return _format; }
-        
+
         void notifyGPULoaded();
+        bool isGPULoaded() const { return _isGPULoaded; }
         
     protected:
         Element _format;
@@ -272,6 +273,8 @@ public:
         virtual bool assignMipData(uint16 level, const Element& format, Size size, const Byte* bytes);
         virtual bool assignMipFaceData(uint16 level, const Element& format, Size size, const Byte* bytes, uint8 face);
         virtual bool isMipAvailable(uint16 level, uint8 face = 0) const;
+        // A mip is resident once the backend has consumed its pixels and released the sysmem copy
+        virtual bool isMipGPULoaded(uint16 level, uint8 face = 0) const;
 
         Texture::Type getType() const { return _type; }
         
@@ -439,6 +442,7 @@ public:
 
     // Access the the sub mips
     bool isStoredMipFaceAvailable(uint16 level, uint8 face = 0) const { return _storage->isMipAvailable(level, face); }
+    bool isStoredMipFaceGPULoaded(uint16 level, uint8 face = 0) const { return _storage->isMipGPULoaded(level, face); }
     const PixelsPointer accessStoredMipFace(uint16 level, uint8 face = 0) const { return _storage->getMipFace(level, face); }
 
     // access sizes for the stored mips
@@ -0,0 +1,478 @@
+//
+//  CompiledGeometryCache.cpp
+//  libraries/model-networking/src
+//
+//  Created by Andrzej Kapolka on 8/30/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CompiledGeometryCache.h"
+
+#include <mutex>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QStandardPaths>
+
+#include <StreamUtils.h>
+
+#include "ModelNetworkingLogging.h"
+
+static const quint32 GEOMETRY_CACHE_FILE_MAGIC = 0x43474648; // 'HFGC'
+// Bump whenever the serialized layout below or the parsers feeding it change,
+// stale entries are simply treated as misses and rewritten.
+static const quint32 GEOMETRY_CACHE_FILE_VERSION = 1;
+
+// Serialization helpers. The bulk payloads (vertex, normal, index vectors) are written raw
+// and contiguous so deserialization is a sized read per vector rather than per element;
+// glm types are tightly packed so their QVectors qualify.
+
+template <typename T>
+static void writeRawVector(QDataStream& out, const QVector<T>& vector) {
+    out << (quint32)vector.size();
+    if (!vector.isEmpty()) {
+        out.writeRawData(reinterpret_cast<const char*>(vector.constData()), vector.size() * (int)sizeof(T));
+    }
+}
+
+template <typename T>
+static bool readRawVector(QDataStream& in, QVector<T>& vector) {
+    quint32 size;
+    in >> size;
+    vector.resize(size);
+    if (size > 0) {
+        int byteCount = (int)size * (int)sizeof(T);
+        if (in.readRawData(reinterpret_cast<char*>(vector.data()), byteCount) != byteCount) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void write(QDataStream& out, const glm::mat4& matrix) {
+    out.writeRawData(reinterpret_cast<const char*>(&matrix), sizeof(matrix));
+}
+
+static void read(QDataStream& in, glm::mat4& matrix) {
+    in.readRawData(reinterpret_cast<char*>(&matrix), sizeof(matrix));
+}
+
+static void write(QDataStream& out, const Extents& extents) {
+    out << extents.minimum << extents.maximum;
+}
+
+static void read(QDataStream& in, Extents& extents) {
+    in >> extents.minimum >> extents.maximum;
+}
+
+static void write(QDataStream& out, const FBXJoint& joint) {
+    writeRawVector(out, joint.shapeInfo.points);
+    writeRawVector(out, joint.freeLineage);
+    out << joint.isFree << joint.parentIndex << joint.distanceToParent;
+    out << joint.translation;
+    write(out, joint.preTransform);
+    out << joint.preRotation << joint.rotation << joint.postRotation;
+    write(out, joint.postTransform);
+    write(out, joint.transform);
+    out << joint.rotationMin << joint.rotationMax;
+    out << joint.inverseDefaultRotation << joint.inverseBindRotation;
+    write(out, joint.bindTransform);
+    out << joint.name << joint.isSkeletonJoint << joint.bindTransformFoundInCluster;
+    out << joint.hasGeometricOffset << joint.geometricTranslation << joint.geometricRotation
+        << joint.geometricScaling;
+}
+
+static void read(QDataStream& in, FBXJoint& joint) {
+    readRawVector(in, joint.shapeInfo.points);
+    readRawVector(in, joint.freeLineage);
+    in >> joint.isFree >> joint.parentIndex >> joint.distanceToParent;
+    in >> joint.translation;
+    read(in, joint.preTransform);
+    in >> joint.preRotation >> joint.rotation >> joint.postRotation;
+    read(in, joint.postTransform);
+    read(in, joint.transform);
+    in >> joint.rotationMin >> joint.rotationMax;
+    in >> joint.inverseDefaultRotation >> joint.inverseBindRotation;
+    read(in, joint.bindTransform);
+    in >> joint.name >> joint.isSkeletonJoint >> joint.bindTransformFoundInCluster;
+    in >> joint.hasGeometricOffset >> joint.geometricTranslation >> joint.geometricRotation
+        >> joint.geometricScaling;
+}
+
+static void write(QDataStream& out, const FBXTexture& texture) {
+    out << texture.name << texture.filename << texture.content;
+    out << texture.transform.getTranslation() << texture.transform.getRotation()
+        << texture.transform.getScale();
+    out << texture.maxNumPixels << texture.texcoordSet << texture.texcoordSetName << texture.isBumpmap;
+}
+
+static void read(QDataStream& in, FBXTexture& texture) {
+    in >> texture.name >> texture.filename >> texture.content;
+    glm::vec3 translation;
+    glm::quat rotation;
+    glm::vec3 scale;
+    in >> translation >> rotation >> scale;
+    texture.transform.setTranslation(translation);
+    texture.transform.setRotation(rotation);
+    texture.transform.setScale(scale);
+    in >> texture.maxNumPixels >> texture.texcoordSet >> texture.texcoordSetName >> texture.isBumpmap;
+}
+
+static void write(QDataStream& out, const FBXMaterial& material) {
+    out << material.diffuseColor << material.diffuseFactor;
+    out << material.specularColor << material.specularFactor;
+    out << material.emissiveColor << material.emissiveFactor;
+    out << material.shininess << material.opacity;
+    out << material.metallic << material.roughness << material.emissiveIntensity << material.ambientFactor;
+    out << material.materialID << material.name << material.shadingModel;
+
+    write(out, material.normalTexture);
+    write(out, material.albedoTexture);
+    write(out, material.opacityTexture);
+    write(out, material.glossTexture);
+    write(out, material.roughnessTexture);
+    write(out, material.specularTexture);
+    write(out, material.metallicTexture);
+    write(out, material.emissiveTexture);
+    write(out, material.occlusionTexture);
+    write(out, material.scatteringTexture);
+    write(out, material.lightmapTexture);
+    out.writeRawData(reinterpret_cast<const char*>(&material.lightmapParams), sizeof(material.lightmapParams));
+
+    out << material.isPBSMaterial << material.useNormalMap << material.useAlbedoMap << material.useOpacityMap
+        << material.useRoughnessMap << material.useSpecularMap << material.useMetallicMap
+        << material.useEmissiveMap << material.useOcclusionMap;
+
+    // The derived model::Material is rebuilt from its scalar state rather than reconsolidated
+    out << (material._material != nullptr);
+    if (material._material) {
+        out << material._material->getEmissive(false) << material._material->getAlbedo(false);
+        out << material._material->getOpacity() << material._material->getMetallic()
+            << material._material->getRoughness() << material._material->getScattering();
+        out << material._material->isUnlit();
+    }
+}
+
+static void read(QDataStream& in, FBXMaterial& material) {
+    in >> material.diffuseColor >> material.diffuseFactor;
+    in >> material.specularColor >> material.specularFactor;
+    in >> material.emissiveColor >> material.emissiveFactor;
+    in >> material.shininess >> material.opacity;
+    in >> material.metallic >> material.roughness >> material.emissiveIntensity >> material.ambientFactor;
+    in >> material.materialID >> material.name >> material.shadingModel;
+
+    read(in, material.normalTexture);
+    read(in, material.albedoTexture);
+    read(in, material.opacityTexture);
+    read(in, material.glossTexture);
+    read(in, material.roughnessTexture);
+    read(in, material.specularTexture);
+    read(in, material.metallicTexture);
+    read(in, material.emissiveTexture);
+    read(in, material.occlusionTexture);
+    read(in, material.scatteringTexture);
+    read(in, material.lightmapTexture);
+    in.readRawData(reinterpret_cast<char*>(&material.lightmapParams), sizeof(material.lightmapParams));
+
+    in >> material.isPBSMaterial >> material.useNormalMap >> material.useAlbedoMap >> material.useOpacityMap
+        >> material.useRoughnessMap >> material.useSpecularMap >> material.useMetallicMap
+        >> material.useEmissiveMap >> material.useOcclusionMap;
+
+    bool hasMaterial;
+    in >> hasMaterial;
+    if (hasMaterial) {
+        glm::vec3 emissive;
+        glm::vec3 albedo;
+        float opacity;
+        float metallic;
+        float roughness;
+        float scattering;
+        bool unlit;
+        in >> emissive >> albedo >> opacity >> metallic >> roughness >> scattering >> unlit;
+        material._material = std::make_shared<model::Material>();
+        material._material->setEmissive(emissive, false);
+        material._material->setAlbedo(albedo, false);
+        material._material->setOpacity(opacity);
+        material._material->setMetallic(metallic);
+        material._material->setRoughness(roughness);
+        material._material->setScattering(scattering);
+        material._material->setUnlit(unlit);
+    }
+}
+
+static void write(QDataStream& out, const FBXMesh& mesh) {
+    out << (quint32)mesh.parts.size();
+    for (const FBXMeshPart& part : mesh.parts) {
+        writeRawVector(out, part.quadIndices);
+        writeRawVector(out, part.quadTrianglesIndices);
+        writeRawVector(out, part.triangleIndices);
+        out << part.materialID;
+    }
+
+    writeRawVector(out, mesh.vertices);
+    writeRawVector(out, mesh.normals);
+    writeRawVector(out, mesh.tangents);
+    writeRawVector(out, mesh.colors);
+    writeRawVector(out, mesh.texCoords);
+    writeRawVector(out, mesh.texCoords1);
+    writeRawVector(out, mesh.clusterIndices);
+    writeRawVector(out, mesh.clusterWeights);
+
+    out << (quint32)mesh.clusters.size();
+    for (const FBXCluster& cluster : mesh.clusters) {
+        out << cluster.jointIndex;
+        write(out, cluster.inverseBindMatrix);
+    }
+
+    write(out, mesh.meshExtents);
+    write(out, mesh.modelTransform);
+    out << mesh.isEye;
+
+    out << (quint32)mesh.blendshapes.size();
+    for (const FBXBlendshape& blendshape : mesh.blendshapes) {
+        writeRawVector(out, blendshape.indices);
+        writeRawVector(out, blendshape.vertices);
+        writeRawVector(out, blendshape.normals);
+    }
+
+    out << mesh.meshIndex;
+}
+
+static void read(QDataStream& in, FBXMesh& mesh) {
+    quint32 numParts;
+    in >> numParts;
+    mesh.parts.resize(numParts);
+    for (FBXMeshPart& part : mesh.parts) {
+        readRawVector(in, part.quadIndices);
+        readRawVector(in, part.quadTrianglesIndices);
+        readRawVector(in, part.triangleIndices);
+        in >> part.materialID;
+    }
+
+    readRawVector(in, mesh.vertices);
+    readRawVector(in, mesh.normals);
+    readRawVector(in, mesh.tangents);
+    readRawVector(in, mesh.colors);
+    readRawVector(in, mesh.texCoords);
+    readRawVector(in, mesh.texCoords1);
+    readRawVector(in, mesh.clusterIndices);
+    readRawVector(in, mesh.clusterWeights);
+
+    quint32 numClusters;
+    in >> numClusters;
+    mesh.clusters.resize(numClusters);
+    for (FBXCluster& cluster : mesh.clusters) {
+        in >> cluster.jointIndex;
+        read(in, cluster.inverseBindMatrix);
+    }
+
+    read(in, mesh.meshExtents);
+    read(in, mesh.modelTransform);
+    in >> mesh.isEye;
+
+    quint32 numBlendshapes;
+    in >> numBlendshapes;
+    mesh.blendshapes.resize(numBlendshapes);
+    for (FBXBlendshape& blendshape : mesh.blendshapes) {
+        readRawVector(in, blendshape.indices);
+        readRawVector(in, blendshape.vertices);
+        readRawVector(in, blendshape.normals);
+    }
+
+    in >> mesh.meshIndex;
+}
+
+static QString _cacheDirectoryOverride;
+
+void CompiledGeometryCache::setCacheDirectory(const QString& directory) {
+    _cacheDirectoryOverride = directory;
+    if (!QDir().mkpath(directory)) {
+        qCWarning(modelnetworking) << "Could not create compiled geometry cache directory" << directory;
+    }
+}
+
+QString CompiledGeometryCache::cacheFilePath(const QString& key) {
+    if (!_cacheDirectoryOverride.isEmpty()) {
+        return _cacheDirectoryOverride + "/" + key + ".hgc";
+    }
+    static QString cacheDirectory;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        cacheDirectory = QStandardPaths::writableLocation(QStandardPaths::DataLocation) + "/compiled_geometry";
+        if (!QDir().mkpath(cacheDirectory)) {
+            qCWarning(modelnetworking) << "Could not create compiled geometry cache directory" << cacheDirectory;
+        }
+    });
+    return cacheDirectory + "/" + key + ".hgc";
+}
+
+QString CompiledGeometryCache::evalCacheKey(const QByteArray& content, const QVariantHash& mapping) {
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(content);
+    // The mapping participates in joint assignment and blendshapes, so it is part of the address
+    if (!mapping.isEmpty()) {
+        QByteArray mappingBytes;
+        QDataStream mappingStream(&mappingBytes, QIODevice::WriteOnly);
+        mappingStream << mapping;
+        hash.addData(mappingBytes);
+    }
+    return QString(hash.result().toHex());
+}
+
+FBXGeometry::Pointer CompiledGeometryCache::read(const QString& key, const QString& url) {
+    QFile file(cacheFilePath(key));
+    if (!file.exists() || !file.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+
+    QDataStream in(&file);
+    quint32 magic;
+    quint32 version;
+    in >> magic >> version;
+    if (magic != GEOMETRY_CACHE_FILE_MAGIC || version != GEOMETRY_CACHE_FILE_VERSION) {
+        return nullptr;
+    }
+
+    auto geometry = std::make_shared<FBXGeometry>();
+    in >> geometry->author >> geometry->applicationName;
+
+    quint32 numJoints;
+    in >> numJoints;
+    geometry->joints.resize(numJoints);
+    for (FBXJoint& joint : geometry->joints) {
+        ::read(in, joint);
+    }
+    in >> geometry->jointIndices >> geometry->hasSkeletonJoints;
+
+    quint32 numMeshes;
+    in >> numMeshes;
+    geometry->meshes.resize(numMeshes);
+    for (FBXMesh& mesh : geometry->meshes) {
+        ::read(in, mesh);
+    }
+
+    quint32 numMaterials;
+    in >> numMaterials;
+    for (quint32 i = 0; i < numMaterials; i++) {
+        QString materialID;
+        in >> materialID;
+        ::read(in, geometry->materials[materialID]);
+    }
+
+    ::read(in, geometry->offset);
+    in >> geometry->leftEyeJointIndex >> geometry->rightEyeJointIndex >> geometry->neckJointIndex
+        >> geometry->rootJointIndex >> geometry->leanJointIndex >> geometry->headJointIndex
+        >> geometry->leftHandJointIndex >> geometry->rightHandJointIndex
+        >> geometry->leftToeJointIndex >> geometry->rightToeJointIndex;
+    in >> geometry->leftEyeSize >> geometry->rightEyeSize;
+    readRawVector(in, geometry->humanIKJointIndices);
+    in >> geometry->palmDirection;
+
+    quint32 numSittingPoints;
+    in >> numSittingPoints;
+    geometry->sittingPoints.resize(numSittingPoints);
+    for (SittingPoint& sittingPoint : geometry->sittingPoints) {
+        in >> sittingPoint.name >> sittingPoint.position >> sittingPoint.rotation;
+    }
+
+    in >> geometry->neckPivot;
+    ::read(in, geometry->bindExtents);
+    ::read(in, geometry->meshExtents);
+
+    quint32 numAnimationFrames;
+    in >> numAnimationFrames;
+    geometry->animationFrames.resize(numAnimationFrames);
+    for (FBXAnimationFrame& frame : geometry->animationFrames) {
+        readRawVector(in, frame.rotations);
+        readRawVector(in, frame.translations);
+    }
+
+    in >> geometry->meshIndicesToModelNames >> geometry->blendshapeChannelNames;
+
+    if (in.status() != QDataStream::Ok) {
+        qCWarning(modelnetworking) << "Rejecting truncated compiled geometry cache entry" << key;
+        return nullptr;
+    }
+
+    geometry->originalURL = url;
+
+    // The gpu-side buffers are the only piece not persisted: rebuilding them is a linear
+    // repack of the vectors above into the final gpu::Stream layout.
+    for (FBXMesh& mesh : geometry->meshes) {
+        FBXReader::buildModelMesh(mesh, url);
+    }
+
+    return geometry;
+}
+
+bool CompiledGeometryCache::write(const QString& key, const FBXGeometry& geometry) {
+    auto filePath = cacheFilePath(key);
+    QFile file(filePath + ".tmp");
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(modelnetworking) << "Could not write compiled geometry cache entry" << filePath;
+        return false;
+    }
+
+    QDataStream out(&file);
+    out << GEOMETRY_CACHE_FILE_MAGIC << GEOMETRY_CACHE_FILE_VERSION;
+    out << geometry.author << geometry.applicationName;
+
+    out << (quint32)geometry.joints.size();
+    for (const FBXJoint& joint : geometry.joints) {
+        ::write(out, joint);
+    }
+    out << geometry.jointIndices << geometry.hasSkeletonJoints;
+
+    out << (quint32)geometry.meshes.size();
+    for (const FBXMesh& mesh : geometry.meshes) {
+        ::write(out, mesh);
+    }
+
+    out << (quint32)geometry.materials.size();
+    for (auto it = geometry.materials.constBegin(); it != geometry.materials.constEnd(); ++it) {
+        out << it.key();
+        ::write(out, it.value());
+    }
+
+    ::write(out, geometry.offset);
+    out << geometry.leftEyeJointIndex << geometry.rightEyeJointIndex << geometry.neckJointIndex
+        << geometry.rootJointIndex << geometry.leanJointIndex << geometry.headJointIndex
+        << geometry.leftHandJointIndex << geometry.rightHandJointIndex
+        << geometry.leftToeJointIndex << geometry.rightToeJointIndex;
+    out << geometry.leftEyeSize << geometry.rightEyeSize;
+    writeRawVector(out, geometry.humanIKJointIndices);
+    out << geometry.palmDirection;
+
+    out << (quint32)geometry.sittingPoints.size();
+    for (const SittingPoint& sittingPoint : geometry.sittingPoints) {
+        out << sittingPoint.name << sittingPoint.position << sittingPoint.rotation;
+    }
+
+    out << geometry.neckPivot;
+    ::write(out, geometry.bindExtents);
+    ::write(out, geometry.meshExtents);
+
+    out << (quint32)geometry.animationFrames.size();
+    for (const FBXAnimationFrame& frame : geometry.animationFrames) {
+        writeRawVector(out, frame.rotations);
+        writeRawVector(out, frame.translations);
+    }
+
+    out << geometry.meshIndicesToModelNames << geometry.blendshapeChannelNames;
+    file.close();
+
+    // Write to a temporary and rename, so a concurrent reader or an interrupted
+    // write can never observe a half-written entry.
+    QFile::remove(filePath);
+    if (!file.rename(filePath)) {
+        qCWarning(modelnetworking) << "Could not finalize compiled geometry cache entry" << filePath;
+        file.remove();
+        return false;
+    }
+    return true;
+}
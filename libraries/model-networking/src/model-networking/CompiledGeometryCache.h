@@ -0,0 +1,53 @@
+//
+//  CompiledGeometryCache.h
+//  libraries/model-networking/src
+//
+//  Created by Andrzej Kapolka on 8/30/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CompiledGeometryCache_h
+#define hifi_CompiledGeometryCache_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QVariantHash>
+
+#include <FBXReader.h>
+
+/// A content-addressed disk cache of compiled model geometry.
+///
+/// Parsing an FBX or OBJ document — node extraction, triangulation, tangent generation,
+/// cluster binding — costs seconds for a large model and produces the same FBXGeometry
+/// every time for unchanged content. This cache serializes the finished FBXGeometry after
+/// the first parse; later loads of the same bytes deserialize it directly and only rebuild
+/// the gpu-side mesh buffers, which is a linear repack of the deserialized vectors.
+///
+/// The key is derived from the source bytes and the FST mapping, so an edited asset or a
+/// changed mapping misses and gets reparsed. Entries are versioned: any change to the
+/// serialized layout or to the parsers invalidates them wholesale.
+class CompiledGeometryCache {
+public:
+    /// Evaluate the content-addressed key for a model document and its mapping.
+    static QString evalCacheKey(const QByteArray& content, const QVariantHash& mapping);
+
+    /// Attempt to rebuild a compiled geometry from the cache.
+    /// Returns nullptr on a miss or an unreadable/stale entry.
+    static FBXGeometry::Pointer read(const QString& key, const QString& url);
+
+    /// Persist a compiled geometry under the given key.
+    static bool write(const QString& key, const FBXGeometry& geometry);
+
+    /// Redirect entries away from the application data location. Used by tools that
+    /// bake content offline into a directory of their choosing; must be called before
+    /// the first read or write.
+    static void setCacheDirectory(const QString& directory);
+
+private:
+    static QString cacheFilePath(const QString& key);
+};
+
+#endif // hifi_CompiledGeometryCache_h
@@ -20,6 +20,7 @@
 
 #include <QThreadPool>
 
+#include "CompiledGeometryCache.h"
 #include "ModelNetworkingLogging.h"
 #include <Trace.h>
 #include <StatTracker.h>
@@ -172,15 +173,22 @@ void GeometryReader::run() {
             (_url.path().toLower().endsWith(".fbx") || _url.path().toLower().endsWith(".obj"))) {
             FBXGeometry::Pointer fbxGeometry;
 
-            if (_url.path().toLower().endsWith(".fbx")) {
-                fbxGeometry.reset(readFBX(_data, _mapping, _url.path()));
-                if (fbxGeometry->meshes.size() == 0 && fbxGeometry->joints.size() == 0) {
-                    throw QString("empty geometry, possibly due to an unsupported FBX version");
+            // A compiled version of this exact content may already be on disk, in which
+            // case the parse is skipped and only the gpu-side buffers are rebuilt.
+            QString cacheKey = CompiledGeometryCache::evalCacheKey(_data, _mapping);
+            fbxGeometry = CompiledGeometryCache::read(cacheKey, _url.path());
+            if (!fbxGeometry) {
+                if (_url.path().toLower().endsWith(".fbx")) {
+                    fbxGeometry.reset(readFBX(_data, _mapping, _url.path()));
+                    if (fbxGeometry->meshes.size() == 0 && fbxGeometry->joints.size() == 0) {
+                        throw QString("empty geometry, possibly due to an unsupported FBX version");
+                    }
+                } else if (_url.path().toLower().endsWith(".obj")) {
+                    fbxGeometry.reset(OBJReader().readOBJ(_data, _mapping, _url));
+                } else {
+                    throw QString("unsupported format");
                 }
-            } else if (_url.path().toLower().endsWith(".obj")) {
-                fbxGeometry.reset(OBJReader().readOBJ(_data, _mapping, _url));
-            } else {
-                throw QString("unsupported format");
+                CompiledGeometryCache::write(cacheKey, *fbxGeometry);
             }
 
             // Ensure the resource has not been deleted
@@ -303,16 +311,15 @@ const QVariantMap Geometry::getTextures() const {
     return textures;
 }
 
-// FIXME: The materials should only be copied when modified, but the Model currently caches the original
 Geometry::Geometry(const Geometry& geometry) {
     _fbxGeometry = geometry._fbxGeometry;
     _meshes = geometry._meshes;
     _meshParts = geometry._meshParts;
 
-    _materials.reserve(geometry._materials.size());
-    for (const auto& material : geometry._materials) {
-        _materials.push_back(std::make_shared<NetworkMaterial>(*material));
-    }
+    // The materials (like the meshes and their gpu buffers) stay shared with the cached
+    // resource; an instance only gets its own copy of a material if it actually overrides
+    // one of its textures -- see setTextures().
+    _materials = geometry._materials;
 
     _animGraphOverrideUrl = geometry._animGraphOverrideUrl;
 }
@@ -322,14 +329,13 @@ void Geometry::setTextures(const QVariantMap& textureMap) {
         for (auto& material : _materials) {
             // Check if any material textures actually changed
             if (std::any_of(material->_textures.cbegin(), material->_textures.cend(),
-                [&textureMap](const NetworkMaterial::Textures::value_type& it) { return it.texture && textureMap.contains(it.name); })) { 
-
-                // FIXME: The Model currently caches the materials (waste of space!)
-                //        so they must be copied in the Geometry copy-ctor
-                // if (material->isOriginal()) {
-                //    // Copy the material to avoid mutating the cached version
-                //    material = std::make_shared<NetworkMaterial>(*material);
-                //}
+                [&textureMap](const NetworkMaterial::Textures::value_type& it) { return it.texture && textureMap.contains(it.name); })) {
+
+                if (material->isOriginal()) {
+                    // Copy the material to avoid mutating the version shared with the cache
+                    // (and with every other instance of this geometry)
+                    material = std::make_shared<NetworkMaterial>(*material);
+                }
 
                 material->setTextures(textureMap);
                 _areTexturesLoaded = false;
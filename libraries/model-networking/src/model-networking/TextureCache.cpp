@@ -33,6 +33,7 @@
 #include <PathUtils.h>
 
 #include "ModelNetworkingLogging.h"
+#include "TextureTranscodeCache.h"
 #include <Trace.h>
 #include <StatTracker.h>
 
@@ -175,7 +176,7 @@ NetworkTexturePointer TextureCache::getTexture(const QUrl& url, Type type, const
 
 
 NetworkTexture::TextureLoaderFunc getTextureLoaderForType(NetworkTexture::Type type,
-                                                          const QVariantMap& options = QVariantMap()) {
+                                                          const QVariantMap& options) {
     using Type = NetworkTexture;
 
     switch (type) {
@@ -365,6 +366,32 @@ void ImageReader::run() {
     }
     listSupportedImageFormats();
 
+    // A processed version of this exact content may already be in the transcode cache, in which
+    // case the finished mips are mapped straight into the texture and the decode is skipped.
+    QString transcodeCacheKey;
+    {
+        auto resource = _resource.toStrongRef();
+        if (!resource) {
+            qCWarning(modelnetworking) << "Abandoning load of" << _url << "; could not get strong ref";
+            return;
+        }
+        auto type = resource.dynamicCast<NetworkTexture>()->getTextureType();
+        // Custom textures run an arbitrary loader the cache key cannot capture
+        if (type != NetworkTexture::CUSTOM_TEXTURE && !_content.isEmpty()) {
+            transcodeCacheKey = TextureTranscodeCache::evalCacheKey(_content, type, _maxNumPixels);
+            int cachedWidth = 0;
+            int cachedHeight = 0;
+            auto cachedTexture = TextureTranscodeCache::read(transcodeCacheKey, _url.toString().toStdString(),
+                cachedWidth, cachedHeight);
+            if (cachedTexture) {
+                QMetaObject::invokeMethod(resource.data(), "setImage",
+                    Q_ARG(gpu::TexturePointer, cachedTexture),
+                    Q_ARG(int, cachedWidth), Q_ARG(int, cachedHeight));
+                return;
+            }
+        }
+    }
+
     // Help the QImage loader by extracting the image file format from the url filename ext.
     // Some tga are not created properly without it.
     auto filename = _url.fileName().toStdString();
@@ -413,6 +440,12 @@ void ImageReader::run() {
         texture.reset(resource.dynamicCast<NetworkTexture>()->getTextureLoader()(image, url));
     }
 
+    // Persist the processed mips before handing the texture over: once it reaches the render
+    // thread the sysmem pixels can be released by the GPU upload at any time.
+    if (texture && !transcodeCacheKey.isEmpty()) {
+        TextureTranscodeCache::write(transcodeCacheKey, texture, imageWidth, imageHeight);
+    }
+
     // Ensure the resource has not been deleted
     auto resource = _resource.toStrongRef();
     if (!resource) {
@@ -99,6 +99,11 @@ private:
 
 using NetworkTexturePointer = QSharedPointer<NetworkTexture>;
 
+/// Maps a texture type to the model::TextureUsage loader that processes its image.
+/// Exposed so offline tools can run the exact processing a NetworkTexture of that type would.
+NetworkTexture::TextureLoaderFunc getTextureLoaderForType(NetworkTexture::Type type,
+                                                          const QVariantMap& options = QVariantMap());
+
 /// Stores cached textures, including render-to-texture targets.
 class TextureCache : public ResourceCache, public Dependency {
     Q_OBJECT
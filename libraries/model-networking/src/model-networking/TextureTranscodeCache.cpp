@@ -0,0 +1,234 @@
+//
+//  TextureTranscodeCache.cpp
+//  libraries/model-networking/src
+//
+//  Created by Andrzej Kapolka on 8/29/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureTranscodeCache.h"
+
+#include <cstring>
+#include <mutex>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QStandardPaths>
+
+#include "ModelNetworkingLogging.h"
+
+static const quint32 TEXTURE_CACHE_FILE_MAGIC = 0x43544648; // 'HFTC'
+// Bump whenever the file layout or the texture processing it captures changes,
+// stale entries are simply treated as misses and rewritten.
+static const quint32 TEXTURE_CACHE_FILE_VERSION = 1;
+
+// The fixed-size header at the start of every cache file, followed by
+// numStoredMips * (CacheMipHeader + payload bytes), tightly packed.
+struct CacheFileHeader {
+    quint32 magic;
+    quint32 version;
+    quint32 usageFlags;
+    quint32 originalWidth;
+    quint32 originalHeight;
+    quint16 width;
+    quint16 height;
+    quint16 maxMip;
+    quint16 numStoredMips;
+    quint8 texelSemantic;
+    quint8 texelDimension;
+    quint8 texelType;
+    quint8 autoGenerateMips;
+    quint8 samplerFilter;
+    quint8 samplerWrapModeU;
+    quint8 samplerWrapModeV;
+    quint8 samplerWrapModeW;
+};
+
+struct CacheMipHeader {
+    quint32 size;
+    quint16 level;
+    quint8 formatSemantic;
+    quint8 formatDimension;
+    quint8 formatType;
+    quint8 padding[3];
+};
+
+static QString _cacheDirectoryOverride;
+
+void TextureTranscodeCache::setCacheDirectory(const QString& directory) {
+    _cacheDirectoryOverride = directory;
+    if (!QDir().mkpath(directory)) {
+        qCWarning(modelnetworking) << "Could not create texture transcode cache directory" << directory;
+    }
+}
+
+QString TextureTranscodeCache::cacheFilePath(const QString& key) {
+    if (!_cacheDirectoryOverride.isEmpty()) {
+        return _cacheDirectoryOverride + "/" + key + ".htc";
+    }
+    static QString cacheDirectory;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        cacheDirectory = QStandardPaths::writableLocation(QStandardPaths::DataLocation) + "/processed_textures";
+        if (!QDir().mkpath(cacheDirectory)) {
+            qCWarning(modelnetworking) << "Could not create texture transcode cache directory" << cacheDirectory;
+        }
+    });
+    return cacheDirectory + "/" + key + ".htc";
+}
+
+QString TextureTranscodeCache::evalCacheKey(const QByteArray& content, int type, int maxNumPixels) {
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(content);
+    // The same bytes processed as a different texture type or with a different downscale
+    // limit produce different mips, so the parameters are part of the address.
+    hash.addData(reinterpret_cast<const char*>(&type), sizeof(type));
+    hash.addData(reinterpret_cast<const char*>(&maxNumPixels), sizeof(maxNumPixels));
+    return QString(hash.result().toHex());
+}
+
+gpu::TexturePointer TextureTranscodeCache::read(const QString& key, const std::string& source,
+        int& originalWidth, int& originalHeight) {
+    QFile file(cacheFilePath(key));
+    if (!file.exists() || !file.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+
+    auto fileSize = (size_t)file.size();
+    if (fileSize < sizeof(CacheFileHeader)) {
+        return nullptr;
+    }
+
+    // Map rather than read: the mip payloads go straight from the page cache
+    // into the texture sysmem without an intermediate buffer.
+    const uchar* mapped = file.map(0, fileSize);
+    if (!mapped) {
+        return nullptr;
+    }
+
+    CacheFileHeader header;
+    memcpy(&header, mapped, sizeof(header));
+    if (header.magic != TEXTURE_CACHE_FILE_MAGIC || header.version != TEXTURE_CACHE_FILE_VERSION
+            || header.width == 0 || header.height == 0 || header.numStoredMips == 0) {
+        return nullptr;
+    }
+
+    gpu::Sampler::Desc samplerDesc;
+    samplerDesc._filter = header.samplerFilter;
+    samplerDesc._wrapModeU = header.samplerWrapModeU;
+    samplerDesc._wrapModeV = header.samplerWrapModeV;
+    samplerDesc._wrapModeW = header.samplerWrapModeW;
+
+    gpu::Element texelFormat((gpu::Dimension)header.texelDimension, (gpu::Type)header.texelType,
+        (gpu::Semantic)header.texelSemantic);
+    auto texture = gpu::TexturePointer(
+        gpu::Texture::create2D(texelFormat, header.width, header.height, gpu::Sampler(samplerDesc)));
+    texture->setUsage(gpu::Texture::Usage(gpu::Texture::Usage::Flags(header.usageFlags)));
+    if (header.autoGenerateMips) {
+        texture->autoGenerateMips(header.maxMip);
+    }
+
+    const uchar* cursor = mapped + sizeof(CacheFileHeader);
+    const uchar* end = mapped + fileSize;
+    for (quint16 i = 0; i < header.numStoredMips; i++) {
+        if (cursor + sizeof(CacheMipHeader) > end) {
+            qCWarning(modelnetworking) << "Truncated texture transcode cache entry" << key;
+            return nullptr;
+        }
+        CacheMipHeader mipHeader;
+        memcpy(&mipHeader, cursor, sizeof(mipHeader));
+        cursor += sizeof(CacheMipHeader);
+        if (cursor + mipHeader.size > end) {
+            qCWarning(modelnetworking) << "Truncated texture transcode cache entry" << key;
+            return nullptr;
+        }
+        gpu::Element mipFormat((gpu::Dimension)mipHeader.formatDimension, (gpu::Type)mipHeader.formatType,
+            (gpu::Semantic)mipHeader.formatSemantic);
+        if (!texture->assignStoredMip(mipHeader.level, mipFormat, mipHeader.size, cursor)) {
+            qCWarning(modelnetworking) << "Rejecting inconsistent texture transcode cache entry" << key;
+            return nullptr;
+        }
+        cursor += mipHeader.size;
+    }
+
+    texture->setSource(source);
+    originalWidth = header.originalWidth;
+    originalHeight = header.originalHeight;
+    return texture;
+}
+
+bool TextureTranscodeCache::write(const QString& key, const gpu::TexturePointer& texture,
+        int originalWidth, int originalHeight) {
+    if (!texture || texture->getType() != gpu::Texture::TEX_2D) {
+        return false;
+    }
+
+    // Collect the mips that actually carry pixels; with auto generated mips only the top
+    // level is stored, the rest is rebuilt by the GPU on both sides of the cache.
+    std::vector<std::pair<gpu::uint16, gpu::Texture::PixelsPointer>> storedMips;
+    for (gpu::uint16 level = texture->minMip(); level <= texture->maxMip(); level++) {
+        if (texture->isStoredMipFaceAvailable(level)) {
+            auto mipFace = texture->accessStoredMipFace(level);
+            if (mipFace && mipFace->getSize() > 0) {
+                storedMips.emplace_back(level, mipFace);
+            }
+        }
+    }
+    if (storedMips.empty()) {
+        return false;
+    }
+
+    CacheFileHeader header;
+    header.magic = TEXTURE_CACHE_FILE_MAGIC;
+    header.version = TEXTURE_CACHE_FILE_VERSION;
+    header.usageFlags = (quint32)texture->getUsage()._flags.to_ulong();
+    header.originalWidth = originalWidth;
+    header.originalHeight = originalHeight;
+    header.width = texture->getWidth();
+    header.height = texture->getHeight();
+    header.maxMip = texture->maxMip();
+    header.numStoredMips = (quint16)storedMips.size();
+    header.texelSemantic = texture->getTexelFormat().getSemantic();
+    header.texelDimension = texture->getTexelFormat().getDimension();
+    header.texelType = texture->getTexelFormat().getType();
+    header.autoGenerateMips = texture->isAutogenerateMips();
+    const auto& sampler = texture->getSampler();
+    header.samplerFilter = sampler.getFilter();
+    header.samplerWrapModeU = sampler.getWrapModeU();
+    header.samplerWrapModeV = sampler.getWrapModeV();
+    header.samplerWrapModeW = sampler.getWrapModeW();
+
+    // Write to a temporary and rename, so a concurrent reader or an interrupted
+    // write can never observe a half-written entry.
+    auto filePath = cacheFilePath(key);
+    QFile file(filePath + ".tmp");
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(modelnetworking) << "Could not write texture transcode cache entry" << filePath;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& mip : storedMips) {
+        CacheMipHeader mipHeader;
+        memset(&mipHeader, 0, sizeof(mipHeader));
+        mipHeader.size = (quint32)mip.second->getSize();
+        mipHeader.level = mip.first;
+        mipHeader.formatSemantic = mip.second->getFormat().getSemantic();
+        mipHeader.formatDimension = mip.second->getFormat().getDimension();
+        mipHeader.formatType = mip.second->getFormat().getType();
+        file.write(reinterpret_cast<const char*>(&mipHeader), sizeof(mipHeader));
+        file.write(reinterpret_cast<const char*>(mip.second->readData()), mip.second->getSize());
+    }
+    file.close();
+
+    QFile::remove(filePath);
+    if (!file.rename(filePath)) {
+        qCWarning(modelnetworking) << "Could not finalize texture transcode cache entry" << filePath;
+        file.remove();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,55 @@
+//
+//  TextureTranscodeCache.h
+//  libraries/model-networking/src
+//
+//  Created by Andrzej Kapolka on 8/29/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TextureTranscodeCache_h
+#define hifi_TextureTranscodeCache_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#include <gpu/Texture.h>
+
+/// A content-addressed disk cache of fully processed textures.
+///
+/// Decoding a network image with QImage, downscaling it and generating its mip chain is by far
+/// the most expensive part of a texture load, and it produces the exact same bytes every time a
+/// domain is revisited. This cache persists the finished gpu::Texture mips the first time an
+/// image is processed; subsequent loads of the same content memory-map the cache file and assign
+/// the mips straight into a new gpu::Texture, skipping the decode entirely.
+///
+/// The key is derived from the source bytes and the processing parameters, so a changed image,
+/// texture type or downscale limit naturally misses and gets reprocessed. Only TEX_2D textures
+/// are cached: cube maps carry derived irradiance that is not captured by the mip payloads.
+class TextureTranscodeCache {
+public:
+    /// Evaluate the content-addressed key for a source image and its processing parameters.
+    static QString evalCacheKey(const QByteArray& content, int type, int maxNumPixels);
+
+    /// Attempt to rebuild a processed texture from the cache.
+    /// Returns nullptr on a miss or an unreadable/stale entry.
+    static gpu::TexturePointer read(const QString& key, const std::string& source,
+        int& originalWidth, int& originalHeight);
+
+    /// Persist a processed texture under the given key. Returns false if the texture
+    /// is not cacheable (not TEX_2D, no stored mips) or the file could not be written.
+    static bool write(const QString& key, const gpu::TexturePointer& texture,
+        int originalWidth, int originalHeight);
+
+    /// Redirect entries away from the application data location. Used by tools that
+    /// bake content offline into a directory of their choosing; must be called before
+    /// the first read or write.
+    static void setCacheDirectory(const QString& directory);
+
+private:
+    static QString cacheFilePath(const QString& key);
+};
+
+#endif // hifi_TextureTranscodeCache_h
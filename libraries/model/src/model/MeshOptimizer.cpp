@@ -0,0 +1,204 @@
+//
+//  MeshOptimizer.cpp
+//  libraries/model/src/model
+//
+//  Created by Sam Gateau on 8/31/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+#include "MeshOptimizer.h"
+
+#include <cmath>
+
+using namespace model;
+
+// Scoring constants from Forsyth's "Linear-Speed Vertex Cache Optimisation";
+// three extra slots model the vertices of the triangle being emitted.
+static const int SIMULATED_CACHE_SIZE = MeshOptimizer::DEFAULT_CACHE_SIZE + 3;
+static const float CACHE_DECAY_POWER = 1.5f;
+static const float LAST_TRIANGLE_SCORE = 0.75f;
+static const float VALENCE_BOOST_SCALE = 2.0f;
+static const float VALENCE_BOOST_POWER = 0.5f;
+
+static float computeVertexScore(int cachePosition, int remainingValence) {
+    if (remainingValence <= 0) {
+        // No triangle needs this vertex anymore
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // The vertices of the last emitted triangle all score the same, otherwise
+            // the optimizer tends to walk strips forever instead of fanning out
+            score = LAST_TRIANGLE_SCORE;
+        } else {
+            score = powf(1.0f - (float)(cachePosition - 3) / (float)(SIMULATED_CACHE_SIZE - 3),
+                CACHE_DECAY_POWER);
+        }
+    }
+
+    // Boost vertices with few triangles left so lone triangles get picked up along the
+    // way rather than scattered cache-hostile stragglers remaining at the end
+    score += VALENCE_BOOST_SCALE * powf((float)remainingValence, -VALENCE_BOOST_POWER);
+    return score;
+}
+
+void MeshOptimizer::optimizeTriangleOrder(uint32_t numVertices, std::vector<uint32_t>& indices) {
+    size_t numTriangles = indices.size() / 3;
+    if (numTriangles < 2 || numVertices == 0) {
+        return;
+    }
+
+    // Per-vertex remaining valence and adjacency (offsets into a shared triangle list)
+    std::vector<int> remainingValence(numVertices, 0);
+    for (uint32_t index : indices) {
+        if (index >= numVertices) {
+            // Inconsistent input, leave the order alone
+            return;
+        }
+        remainingValence[index]++;
+    }
+
+    std::vector<uint32_t> adjacencyOffsets(numVertices + 1, 0);
+    for (uint32_t vertex = 0; vertex < numVertices; vertex++) {
+        adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + remainingValence[vertex];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    {
+        std::vector<uint32_t> fillCursors(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t triangle = 0; triangle < numTriangles; triangle++) {
+            for (int corner = 0; corner < 3; corner++) {
+                uint32_t vertex = indices[triangle * 3 + corner];
+                adjacency[fillCursors[vertex]++] = (uint32_t)triangle;
+            }
+        }
+    }
+
+    std::vector<float> vertexScores(numVertices);
+    for (uint32_t vertex = 0; vertex < numVertices; vertex++) {
+        vertexScores[vertex] = computeVertexScore(-1, remainingValence[vertex]);
+    }
+
+    std::vector<float> triangleScores(numTriangles);
+    std::vector<bool> triangleEmitted(numTriangles, false);
+    int bestTriangle = -1;
+    float bestScore = -1.0f;
+    for (size_t triangle = 0; triangle < numTriangles; triangle++) {
+        float score = vertexScores[indices[triangle * 3]] + vertexScores[indices[triangle * 3 + 1]] +
+            vertexScores[indices[triangle * 3 + 2]];
+        triangleScores[triangle] = score;
+        if (score > bestScore) {
+            bestScore = score;
+            bestTriangle = (int)triangle;
+        }
+    }
+
+    std::vector<uint32_t> newIndices;
+    newIndices.reserve(indices.size());
+    uint32_t cache[SIMULATED_CACHE_SIZE];
+    int cacheCount = 0;
+    size_t scanCursor = 0;
+
+    for (size_t emitted = 0; emitted < numTriangles; emitted++) {
+        if (bestTriangle < 0) {
+            // The candidate set went dry, fall back to the next unemitted triangle;
+            // the cursor only moves forward so the whole pass stays linear
+            while (triangleEmitted[scanCursor]) {
+                scanCursor++;
+            }
+            bestTriangle = (int)scanCursor;
+        }
+
+        triangleEmitted[bestTriangle] = true;
+        uint32_t triangleVertices[3];
+        for (int corner = 0; corner < 3; corner++) {
+            uint32_t vertex = indices[bestTriangle * 3 + corner];
+            triangleVertices[corner] = vertex;
+            newIndices.push_back(vertex);
+            remainingValence[vertex]--;
+        }
+
+        // Move the triangle's vertices to the front of the simulated cache
+        uint32_t evicted[3];
+        int numEvicted = 0;
+        for (int corner = 0; corner < 3; corner++) {
+            uint32_t vertex = triangleVertices[corner];
+            int position = -1;
+            for (int i = 0; i < cacheCount; i++) {
+                if (cache[i] == vertex) {
+                    position = i;
+                    break;
+                }
+            }
+            if (position < 0) {
+                if (cacheCount < SIMULATED_CACHE_SIZE) {
+                    position = cacheCount++;
+                } else {
+                    position = SIMULATED_CACHE_SIZE - 1;
+                    evicted[numEvicted++] = cache[position];
+                }
+            }
+            for (int i = position; i > 0; i--) {
+                cache[i] = cache[i - 1];
+            }
+            cache[0] = vertex;
+        }
+
+        // Rescore the touched vertices and their unemitted triangles, tracking the next best
+        bestTriangle = -1;
+        bestScore = -1.0f;
+        auto rescoreVertex = [&](uint32_t vertex, int cachePosition) {
+            float oldScore = vertexScores[vertex];
+            float newScore = computeVertexScore(cachePosition, remainingValence[vertex]);
+            vertexScores[vertex] = newScore;
+            float delta = newScore - oldScore;
+            for (uint32_t slot = adjacencyOffsets[vertex]; slot < adjacencyOffsets[vertex + 1]; slot++) {
+                uint32_t triangle = adjacency[slot];
+                if (!triangleEmitted[triangle]) {
+                    triangleScores[triangle] += delta;
+                    if (triangleScores[triangle] > bestScore) {
+                        bestScore = triangleScores[triangle];
+                        bestTriangle = (int)triangle;
+                    }
+                }
+            }
+        };
+        for (int i = 0; i < numEvicted; i++) {
+            rescoreVertex(evicted[i], -1);
+        }
+        for (int i = 0; i < cacheCount; i++) {
+            rescoreVertex(cache[i], i);
+        }
+    }
+
+    indices.swap(newIndices);
+}
+
+float MeshOptimizer::evalACMR(const std::vector<uint32_t>& indices, int cacheSize) {
+    size_t numTriangles = indices.size() / 3;
+    if (numTriangles == 0) {
+        return 0.0f;
+    }
+
+    std::vector<uint32_t> cache(cacheSize, UINT32_MAX);
+    int cursor = 0;
+    size_t misses = 0;
+    for (uint32_t index : indices) {
+        bool hit = false;
+        for (int i = 0; i < cacheSize; i++) {
+            if (cache[i] == index) {
+                hit = true;
+                break;
+            }
+        }
+        if (!hit) {
+            misses++;
+            cache[cursor] = index;
+            cursor = (cursor + 1) % cacheSize;
+        }
+    }
+    return (float)misses / (float)numTriangles;
+}
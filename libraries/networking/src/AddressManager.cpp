@@ -12,6 +12,7 @@
 #include <QApplication>
 #include <QClipboard>
 #include <QDebug>
+#include <QHostInfo>
 #include <QJsonDocument>
 #include <QRegExp>
 #include <QStringList>
@@ -361,6 +362,9 @@ void AddressManager::goToAddressFromObject(const QVariantMap& dataObject, const
 
                 DependencyManager::get<NodeList>()->flagTimeForConnectionStep(LimitedNodeList::ConnectionStep::HandleAddress);
 
+                // a connect handshake is imminent - overlap keypair generation with socket discovery
+                warmupAccountKeypair();
+
                 const QString DOMAIN_ID_KEY = "id";
                 QString domainIDString = domainObject[DOMAIN_ID_KEY].toString();
                 QUuid domainID(domainIDString);
@@ -715,6 +719,9 @@ bool AddressManager::setDomainInfo(const QString& hostname, quint16 port, Lookup
 
     DependencyManager::get<NodeList>()->flagTimeForConnectionStep(LimitedNodeList::ConnectionStep::HandleAddress);
 
+    // a connect handshake is imminent - overlap keypair generation with socket discovery
+    warmupAccountKeypair();
+
     emit possibleDomainChangeRequired(hostname, port, QUuid());
 
     return hostChanged;
@@ -847,5 +854,56 @@ void AddressManager::addCurrentAddressToHistory(LookupTrigger trigger) {
             _backStack.push(currentAddress());
         }
     }
+
+    // the history just changed, which changes where the next jump is likely to go - start
+    // speculative DNS for those destinations now so the jump doesn't wait on the resolver
+    warmupDnsForLikelyDestinations();
+}
+
+void AddressManager::warmupDnsForLikelyDestinations() {
+    // the most likely targets of the next jump are the addresses at the top of the back and
+    // forward stacks, plus the last lookup we may be asked to refresh
+    const int WARMUP_STACK_DEPTH = 3;
+
+    QStringList likelyHosts;
+
+    for (int i = 0; i < WARMUP_STACK_DEPTH && i < _backStack.size(); i++) {
+        likelyHosts << _backStack[_backStack.size() - 1 - i].host();
+    }
+
+    for (int i = 0; i < WARMUP_STACK_DEPTH && i < _forwardStack.size(); i++) {
+        likelyHosts << _forwardStack[_forwardStack.size() - 1 - i].host();
+    }
+
+    likelyHosts << _previousLookup.host();
+
+    QSet<QString> warmedHosts;
+    for (auto& host : likelyHosts) {
+        // only hosts that look like network addresses are worth a resolver round trip - place
+        // names go through the API and resolve to a network address when they're actually used
+        if ((host.contains('.') || host == "localhost") && !warmedHosts.contains(host)) {
+            warmedHosts.insert(host);
+            QHostInfo::lookupHost(host, this, SLOT(handleDnsWarmupResult(QHostInfo)));
+        }
+    }
+}
+
+void AddressManager::handleDnsWarmupResult(const QHostInfo& hostInfo) {
+    for (auto& address : hostInfo.addresses()) {
+        if (address.protocol() == QAbstractSocket::IPv4Protocol) {
+            DomainHandler::storeWarmedAddress(hostInfo.hostName(), address);
+            return;
+        }
+    }
+}
+
+void AddressManager::warmupAccountKeypair() {
+    // an un-authenticated connect request earns a connection token and a refusal, and only then
+    // does keypair generation start today - kicking it off as soon as a domain change is known
+    // to be coming overlaps the generation and public key upload with socket discovery
+    auto accountManager = DependencyManager::get<AccountManager>();
+    if (accountManager->isLoggedIn() && !accountManager->getAccountInfo().hasPrivateKey()) {
+        accountManager->generateNewUserKeypair();
+    }
 }
 
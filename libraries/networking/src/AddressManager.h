@@ -22,6 +22,8 @@
 
 #include "AccountManager.h"
 
+class QHostInfo;
+
 const QString HIFI_URL_SCHEME = "hifi";
 
 extern const QString DEFAULT_HIFI_ADDRESS;
@@ -131,6 +133,8 @@ private slots:
 
     void handleShareableNameAPIResponse(QNetworkReply& requestReply);
 
+    void handleDnsWarmupResult(const QHostInfo& hostInfo);
+
 private:
     void goToAddressFromObject(const QVariantMap& addressMap, const QNetworkReply& reply);
 
@@ -154,6 +158,9 @@ private:
 
     void addCurrentAddressToHistory(LookupTrigger trigger);
 
+    void warmupDnsForLikelyDestinations();
+    void warmupAccountKeypair();
+
     QString _host;
     quint16 _port;
     QString _placeName;
@@ -23,6 +23,11 @@
 
 static int requestID = 0;
 
+// assets larger than this are fetched as several pipelined range requests instead of one
+// serial conversation, so the asset-server can keep the reliable channel full
+static const DataOffset ASSET_CHUNK_SIZE = 1024 * 1024;
+static const int MAX_PENDING_CHUNK_REQUESTS = 4;
+
 AssetRequest::AssetRequest(const QString& hash) :
     _requestID(++requestID),
     _hash(hash)
@@ -34,6 +39,10 @@ AssetRequest::~AssetRequest() {
     if (_assetRequestID) {
         assetClient->cancelGetAssetRequest(_assetRequestID);
     }
+    for (auto chunkRequestID : _chunkRequestIDs) {
+        // completed chunk requests have already been removed by AssetClient, so this is a no-op for them
+        assetClient->cancelGetAssetRequest(chunkRequestID);
+    }
     if (_assetInfoRequestID) {
         assetClient->cancelGetAssetInfoRequest(_assetInfoRequestID);
     }
@@ -106,9 +115,18 @@ void AssetRequest::start() {
         _data.resize(info.size);
         
         qCDebug(asset_client) << "Got size of " << _hash << " : " << info.size << " bytes";
-        
+
+        if (_info.size > ASSET_CHUNK_SIZE) {
+            // large asset - keep several range requests in flight so the transfer is not bound
+            // by a full round trip per range, and reassemble the chunks into _data as they land
+            while (_numPendingRequests < MAX_PENDING_CHUNK_REQUESTS && _nextChunkStart < _info.size) {
+                requestNextChunk();
+            }
+            return;
+        }
+
         int start = 0, end = _info.size;
-        
+
         auto assetClient = DependencyManager::get<AssetClient>();
         auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
         auto hash = _hash;
@@ -167,3 +185,85 @@ void AssetRequest::start() {
         });
     });
 }
+
+void AssetRequest::requestNextChunk() {
+    auto start = _nextChunkStart;
+    auto end = std::min(start + ASSET_CHUNK_SIZE, _info.size);
+    _nextChunkStart = end;
+
+    // the increment happens before the getAsset call since a send failure will
+    // invoke the callback synchronously
+    ++_numPendingRequests;
+
+    auto assetClient = DependencyManager::get<AssetClient>();
+    auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
+    auto hash = _hash;
+    auto chunkRequestID = assetClient->getAsset(_hash, start, end,
+            [this, that, hash, start, end](bool responseReceived, AssetServerError serverError, const QByteArray& data) {
+        if (!that) {
+            qCWarning(asset_client) << "Got chunk reply for dead asset request " << hash;
+            // If the request is dead, return
+            return;
+        }
+
+        --_numPendingRequests;
+
+        if (_state == Finished) {
+            // an earlier chunk already failed this request, nothing left to do
+            return;
+        }
+
+        if (!responseReceived) {
+            _error = NetworkError;
+        } else if (serverError != AssetServerError::NoError) {
+            switch (serverError) {
+                case AssetServerError::AssetNotFound:
+                    _error = NotFound;
+                    break;
+                case AssetServerError::InvalidByteRange:
+                    _error = InvalidByteRange;
+                    break;
+                default:
+                    _error = UnknownError;
+                    break;
+            }
+        } else {
+            Q_ASSERT(data.size() == (end - start));
+
+            memcpy(_data.data() + start, data.constData(), data.size());
+            _totalReceived += data.size();
+            emit progress(_totalReceived, _info.size);
+        }
+
+        if (_error != NoError) {
+            qCWarning(asset_client) << "Got error retrieving asset" << _hash << "- error code" << _error;
+
+            _state = Finished;
+            emit finished(this);
+            return;
+        }
+
+        if (_totalReceived == (uint64_t) _info.size) {
+            // all chunks are in - the individual chunks can't be verified, so check the
+            // hash of the reassembled data against the one we requested
+            if (hashData(_data).toHex() == _hash) {
+                saveToCache(getUrl(), _data);
+            } else {
+                _error = HashVerificationFailed;
+                qCWarning(asset_client) << "Hash of reassembled chunks doesn't match for asset" << _hash;
+            }
+
+            _state = Finished;
+            emit finished(this);
+        } else if (_nextChunkStart < _info.size) {
+            // keep the pipeline full
+            requestNextChunk();
+        }
+    }, [](qint64 totalReceived, qint64 total) {
+        // per-chunk progress is reported as each chunk completes instead
+    });
+
+    if (chunkRequestID != INVALID_MESSAGE_ID) {
+        _chunkRequestIDs.push_back(chunkRequestID);
+    }
+}
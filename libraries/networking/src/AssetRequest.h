@@ -12,6 +12,8 @@
 #ifndef hifi_AssetRequest_h
 #define hifi_AssetRequest_h
 
+#include <vector>
+
 #include <QByteArray>
 #include <QObject>
 #include <QString>
@@ -56,6 +58,9 @@ signals:
     void progress(qint64 totalReceived, qint64 total);
 
 private:
+    // issues the next pipelined chunk request for a large asset
+    void requestNextChunk();
+
     int _requestID;
     State _state = NotStarted;
     Error _error = NoError;
@@ -64,6 +69,8 @@ private:
     QString _hash;
     QByteArray _data;
     int _numPendingRequests { 0 };
+    DataOffset _nextChunkStart { 0 };
+    std::vector<MessageID> _chunkRequestIDs;
     MessageID _assetRequestID { INVALID_MESSAGE_ID };
     MessageID _assetInfoRequestID { INVALID_MESSAGE_ID };
 };
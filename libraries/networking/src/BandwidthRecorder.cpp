@@ -1,6 +1,6 @@
 //
-//  BandwidthMeter.cpp
-//  interface/src/ui
+//  BandwidthRecorder.cpp
+//  libraries/networking/src
 //
 //  Created by Seth Alves on 2015-1-30
 //  Copyright 2015 High Fidelity, Inc.
@@ -11,180 +11,153 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
-#include <QDateTime>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
 #include "BandwidthRecorder.h"
 
+// rates are recomputed from the counters at most this often; reads in between return the
+// last computed value, which also serves the purpose of the old "cached" total getters
+static const quint64 RATE_REFRESH_INTERVAL_USECS = 500 * USECS_PER_MSEC;
 
-BandwidthRecorder::Channel::Channel() {
-}
+// each writing thread takes the next stripe, round robin; threads that share a stripe are
+// still correct (the cells are atomic), they just contend a little
+static std::atomic<int> _nextWriterStripe { 0 };
 
-float BandwidthRecorder::Channel::getAverageInputPacketsPerSecond() {
-    float averageTimeBetweenPackets = _input.getEventDeltaAverage();
-    if (averageTimeBetweenPackets > 0.0f) {
-        return (1.0f / averageTimeBetweenPackets);
-    }
-    return 0.0f;
+int BandwidthRecorder::stripeIndexForThisThread() {
+    static thread_local int stripeIndex = _nextWriterStripe.fetch_add(1) % STRIPE_COUNT;
+    return stripeIndex;
 }
 
-float BandwidthRecorder::Channel::getAverageOutputPacketsPerSecond() {
-    float averageTimeBetweenPackets = _output.getEventDeltaAverage();
-    if (averageTimeBetweenPackets > 0.0f) {
-        return (1.0f / averageTimeBetweenPackets);
+BandwidthRecorder::BandwidthRecorder() {
+    for (int i = 0; i < STRIPE_COUNT; i++) {
+        _stripes[i].store(nullptr, std::memory_order_relaxed);
     }
-    return 0.0f;
 }
 
-float BandwidthRecorder::Channel::getAverageInputKilobitsPerSecond() {
-    return (_input.getAverageSampleValuePerSecond() * (8.0f / 1000));
+BandwidthRecorder::~BandwidthRecorder() {
+    for (int i = 0; i < STRIPE_COUNT; i++) {
+        delete _stripes[i].load(std::memory_order_acquire);
+    }
 }
 
-float BandwidthRecorder::Channel::getAverageOutputKilobitsPerSecond() {
-    return (_output.getAverageSampleValuePerSecond() * (8.0f / 1000));
+BandwidthRecorder::Stripe* BandwidthRecorder::stripeForThisThread() {
+    int index = stripeIndexForThisThread();
+    Stripe* stripe = _stripes[index].load(std::memory_order_acquire);
+    if (!stripe) {
+        Stripe* fresh = new Stripe();
+        if (_stripes[index].compare_exchange_strong(stripe, fresh, std::memory_order_acq_rel)) {
+            stripe = fresh;
+        } else {
+            delete fresh; // another thread on this stripe won the race
+        }
+    }
+    return stripe;
 }
 
-
-void BandwidthRecorder::Channel::updateInputAverage(const float sample) {
-    _input.updateAverage(sample);
+void BandwidthRecorder::updateInboundData(const quint8 channelType, const int bytes) {
+    Cell& cell = stripeForThisThread()->cells[channelType];
+    cell.inPackets.fetch_add(1, std::memory_order_relaxed);
+    cell.inBytes.fetch_add((quint64)bytes, std::memory_order_relaxed);
 }
 
-void BandwidthRecorder::Channel::updateOutputAverage(const float sample) {
-    _output.updateAverage(sample);
+void BandwidthRecorder::updateOutboundData(const quint8 channelType, const int bytes) {
+    Cell& cell = stripeForThisThread()->cells[channelType];
+    cell.outPackets.fetch_add(1, std::memory_order_relaxed);
+    cell.outBytes.fetch_add((quint64)bytes, std::memory_order_relaxed);
 }
 
-BandwidthRecorder::BandwidthRecorder() {
-    for (uint i=0; i<CHANNEL_COUNT; i++) {
-        _channels[ i ] = NULL;
+BandwidthRecorder::Totals BandwidthRecorder::gatherTotals(const int channelType) const {
+    Totals totals;
+    int firstChannel = (channelType < 0) ? 0 : channelType;
+    int lastChannel = (channelType < 0) ? CHANNEL_COUNT - 1 : channelType;
+    for (int i = 0; i < STRIPE_COUNT; i++) {
+        Stripe* stripe = _stripes[i].load(std::memory_order_acquire);
+        if (!stripe) {
+            continue;
+        }
+        for (int channel = firstChannel; channel <= lastChannel; channel++) {
+            Cell& cell = stripe->cells[channel];
+            totals.inPackets += cell.inPackets.load(std::memory_order_relaxed);
+            totals.inBytes += cell.inBytes.load(std::memory_order_relaxed);
+            totals.outPackets += cell.outPackets.load(std::memory_order_relaxed);
+            totals.outBytes += cell.outBytes.load(std::memory_order_relaxed);
+        }
     }
+    return totals;
 }
 
-BandwidthRecorder::~BandwidthRecorder() {
-    for (uint i=0; i<CHANNEL_COUNT; i++) {
-        delete _channels[ i ];
-    }
-}
+BandwidthRecorder::RateSnapshot& BandwidthRecorder::refreshedSnapshot(const int channelType) {
+    RateSnapshot& snapshot = (channelType < 0) ? _totalSnapshot : _channelSnapshots[channelType];
 
-void BandwidthRecorder::updateInboundData(const quint8 channelType, const int sample) {
-    if (! _channels[channelType]) {
-        _channels[channelType] = new Channel();
+    quint64 now = usecTimestampNow();
+    quint64 elapsedUsecs = now - snapshot.lastRefreshUsecs;
+    if (elapsedUsecs < RATE_REFRESH_INTERVAL_USECS) {
+        return snapshot;
     }
-    _channels[channelType]->updateInputAverage(sample);
-}
 
-void BandwidthRecorder::updateOutboundData(const quint8 channelType, const int sample) {
-    if (! _channels[channelType]) {
-        _channels[channelType] = new Channel();
+    Totals totals = gatherTotals(channelType);
+    if (snapshot.lastRefreshUsecs != 0) {
+        float elapsedSeconds = (float)elapsedUsecs / (float)USECS_PER_SECOND;
+        snapshot.inPacketsPerSecond = (float)(totals.inPackets - snapshot.lastTotals.inPackets) / elapsedSeconds;
+        snapshot.outPacketsPerSecond = (float)(totals.outPackets - snapshot.lastTotals.outPackets) / elapsedSeconds;
+        snapshot.inKilobitsPerSecond =
+            (float)(totals.inBytes - snapshot.lastTotals.inBytes) * (8.0f / 1000.0f) / elapsedSeconds;
+        snapshot.outKilobitsPerSecond =
+            (float)(totals.outBytes - snapshot.lastTotals.outBytes) * (8.0f / 1000.0f) / elapsedSeconds;
     }
-    _channels[channelType]->updateOutputAverage(sample);
+    snapshot.lastTotals = totals;
+    snapshot.lastRefreshUsecs = now;
+
+    return snapshot;
 }
 
 float BandwidthRecorder::getAverageInputPacketsPerSecond(const quint8 channelType) {
-    if (! _channels[channelType]) {
-        return 0.0f;
-    }
-    return _channels[channelType]->getAverageInputPacketsPerSecond();
+    return refreshedSnapshot(channelType).inPacketsPerSecond;
 }
 
 float BandwidthRecorder::getAverageOutputPacketsPerSecond(const quint8 channelType) {
-    if (! _channels[channelType]) {
-        return 0.0f;
-    }
-    return _channels[channelType]->getAverageOutputPacketsPerSecond();
+    return refreshedSnapshot(channelType).outPacketsPerSecond;
 }
 
 float BandwidthRecorder::getAverageInputKilobitsPerSecond(const quint8 channelType) {
-    if (! _channels[channelType]) {
-        return 0.0f;
-    }
-    return _channels[channelType]->getAverageInputKilobitsPerSecond();
+    return refreshedSnapshot(channelType).inKilobitsPerSecond;
 }
 
 float BandwidthRecorder::getAverageOutputKilobitsPerSecond(const quint8 channelType) {
-    if (! _channels[channelType]) {
-        return 0.0f;
-    }
-    return _channels[channelType]->getAverageOutputKilobitsPerSecond();
+    return refreshedSnapshot(channelType).outKilobitsPerSecond;
 }
 
 float BandwidthRecorder::getTotalAverageInputPacketsPerSecond() {
-    float result = 0.0f;
-    for (uint i=0; i<CHANNEL_COUNT; i++) {
-        if (_channels[i]) {
-            result += _channels[i]->getAverageInputPacketsPerSecond();
-        }
-    }
-    return result;
+    return refreshedSnapshot(-1).inPacketsPerSecond;
 }
 
 float BandwidthRecorder::getTotalAverageOutputPacketsPerSecond() {
-    float result = 0.0f;
-    for (uint i=0; i<CHANNEL_COUNT; i++) {
-        if (_channels[i]) {
-            result += _channels[i]->getAverageOutputPacketsPerSecond();
-        }
-    }
-    return result;
+    return refreshedSnapshot(-1).outPacketsPerSecond;
 }
 
-float BandwidthRecorder::getTotalAverageInputKilobitsPerSecond(){
-    float result = 0.0f;
-    for (uint i=0; i<CHANNEL_COUNT; i++) {
-        if (_channels[i]) {
-            result += _channels[i]->getAverageInputKilobitsPerSecond();
-        }
-    }
-    return result;
+float BandwidthRecorder::getTotalAverageInputKilobitsPerSecond() {
+    return refreshedSnapshot(-1).inKilobitsPerSecond;
 }
 
-float BandwidthRecorder::getTotalAverageOutputKilobitsPerSecond(){
-    float result = 0.0f;
-    for (uint i=0; i<CHANNEL_COUNT; i++) {
-        if (_channels[i]) {
-            result += _channels[i]->getAverageOutputKilobitsPerSecond();
-        }
-    }
-    return result;
+float BandwidthRecorder::getTotalAverageOutputKilobitsPerSecond() {
+    return refreshedSnapshot(-1).outKilobitsPerSecond;
 }
 
+// the snapshot refresh interval already bounds how often the totals are recomputed, so the
+// cached variants are now the same as the uncached ones; they remain for their callers
 float BandwidthRecorder::getCachedTotalAverageInputPacketsPerSecond() {
-    static qint64 lastCalculated = 0;
-    static float cachedValue = 0.0f;
-    qint64 now = QDateTime::currentMSecsSinceEpoch();
-    if (now - lastCalculated > 1000.0f) {
-        lastCalculated = now;
-        cachedValue = getTotalAverageInputPacketsPerSecond();
-    }
-    return cachedValue;
+    return getTotalAverageInputPacketsPerSecond();
 }
 
 float BandwidthRecorder::getCachedTotalAverageOutputPacketsPerSecond() {
-    static qint64 lastCalculated = 0;
-    static float cachedValue = 0.0f;
-    qint64 now = QDateTime::currentMSecsSinceEpoch();
-    if (now - lastCalculated > 1000.0f) {
-        lastCalculated = now;
-        cachedValue = getTotalAverageOutputPacketsPerSecond();
-    }
-    return cachedValue;
+    return getTotalAverageOutputPacketsPerSecond();
 }
 
 float BandwidthRecorder::getCachedTotalAverageInputKilobitsPerSecond() {
-    static qint64 lastCalculated = 0;
-    static float cachedValue = 0.0f;
-    qint64 now = QDateTime::currentMSecsSinceEpoch();
-    if (now - lastCalculated > 1000.0f) {
-        lastCalculated = now;
-        cachedValue = getTotalAverageInputKilobitsPerSecond();
-    }
-    return cachedValue;
+    return getTotalAverageInputKilobitsPerSecond();
 }
 
 float BandwidthRecorder::getCachedTotalAverageOutputKilobitsPerSecond() {
-    static qint64 lastCalculated = 0;
-    static float cachedValue = 0.0f;
-    qint64 now = QDateTime::currentMSecsSinceEpoch();
-    if (now - lastCalculated > 1000.0f) {
-        lastCalculated = now;
-        cachedValue = getTotalAverageOutputKilobitsPerSecond();
-    }
-    return cachedValue;
+    return getTotalAverageOutputKilobitsPerSecond();
 }
@@ -14,12 +14,16 @@
 #ifndef hifi_BandwidthRecorder_h
 #define hifi_BandwidthRecorder_h
 
+#include <atomic>
+
 #include <QObject>
-#include <QElapsedTimer>
 #include "DependencyManager.h"
-#include "SimpleMovingAverage.h"
-
 
+// Tracks packet and byte rates per channel in both directions. The recording path is a pair
+// of relaxed atomic increments into counter cells striped by writing thread -- no locks, no
+// allocation and no shared cache lines between network threads -- so attribution can stay
+// enabled on busy mixers. Rates are derived from counter deltas at read time, on whichever
+// single thread displays or reports stats.
 class BandwidthRecorder : public QObject, public Dependency {
     Q_OBJECT
     SINGLETON_DEPENDENCY
@@ -28,23 +32,6 @@ public:
     BandwidthRecorder();
     ~BandwidthRecorder();
 
-    // keep track of data rate in two directions as well as units and style to use during display
-    class Channel {
-    public:
-        Channel();
-        float getAverageInputPacketsPerSecond();
-        float getAverageOutputPacketsPerSecond();
-        float getAverageInputKilobitsPerSecond();
-        float getAverageOutputKilobitsPerSecond();
-
-        void updateInputAverage(const float sample);
-        void updateOutputAverage(const float sample);
-
-    private:
-        SimpleMovingAverage _input = SimpleMovingAverage();
-        SimpleMovingAverage _output = SimpleMovingAverage();
-    };
-
     float getAverageInputPacketsPerSecond(const quint8 channelType);
     float getAverageOutputPacketsPerSecond(const quint8 channelType);
     float getAverageInputKilobitsPerSecond(const quint8 channelType);
@@ -61,15 +48,61 @@ public:
     float getCachedTotalAverageOutputKilobitsPerSecond();
 
 
+public slots:
+    void updateInboundData(const quint8 channelType, const int bytes);
+    void updateOutboundData(const quint8 channelType, const int bytes);
+
+
 private:
     // one for each possible Node type
-    static const unsigned int CHANNEL_COUNT = 256;
-    Channel* _channels[CHANNEL_COUNT];
+    static const int CHANNEL_COUNT = 256;
+    // writing threads are spread over this many counter stripes
+    static const int STRIPE_COUNT = 4;
 
+    // raw counters for one channel within one stripe
+    class Cell {
+    public:
+        std::atomic<quint64> inPackets { 0 };
+        std::atomic<quint64> inBytes { 0 };
+        std::atomic<quint64> outPackets { 0 };
+        std::atomic<quint64> outBytes { 0 };
+    };
 
-public slots:
-    void updateInboundData(const quint8 channelType, const int bytes);
-    void updateOutboundData(const quint8 channelType, const int bytes);
+    // every channel's counters for the threads mapped to one stripe; allocated on the
+    // first write through that stripe, so recorders that never see traffic stay small
+    class Stripe {
+    public:
+        Cell cells[CHANNEL_COUNT];
+    };
+
+    class Totals {
+    public:
+        quint64 inPackets { 0 };
+        quint64 inBytes { 0 };
+        quint64 outPackets { 0 };
+        quint64 outBytes { 0 };
+    };
+
+    // rates computed from the counter deltas between two reads; only ever touched from
+    // the reading thread, so no synchronization is needed here
+    class RateSnapshot {
+    public:
+        Totals lastTotals;
+        quint64 lastRefreshUsecs { 0 };
+        float inPacketsPerSecond { 0.0f };
+        float outPacketsPerSecond { 0.0f };
+        float inKilobitsPerSecond { 0.0f };
+        float outKilobitsPerSecond { 0.0f };
+    };
+
+    static int stripeIndexForThisThread();
+    Stripe* stripeForThisThread();
+    Totals gatherTotals(const int channelType) const; // channelType of -1 sums every channel
+    RateSnapshot& refreshedSnapshot(const int channelType); // channelType of -1 for the totals
+
+    std::atomic<Stripe*> _stripes[STRIPE_COUNT];
+    RateSnapshot _channelSnapshots[CHANNEL_COUNT];
+    RateSnapshot _totalSnapshot;
 };
 
 #endif
@@ -0,0 +1,131 @@
+//
+//  ContentVersionManifest.cpp
+//  libraries/networking/src
+//
+//  Created by Ryan Huffman on 12/13/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContentVersionManifest.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include "NetworkLogging.h"
+#include "ResourceManager.h"
+
+QSet<QUrl> ContentVersionManifest::_validatedUrls;
+QMutex ContentVersionManifest::_validatedUrlsLock;
+
+void ContentVersionManifest::refresh(const QUrl& manifestUrl) {
+    auto request = ResourceManager::createResourceRequest(nullptr, manifestUrl);
+    if (!request) {
+        qCWarning(networking) << "Could not create request for content manifest" << manifestUrl;
+        return;
+    }
+
+    // the manifest itself is the one thing that must always come from the network
+    request->setCacheEnabled(false);
+
+    QObject::connect(request, &ResourceRequest::finished, [request, manifestUrl] {
+        if (request->getResult() == ResourceRequest::Success) {
+            apply(manifestUrl, request->getData());
+        } else {
+            qCWarning(networking) << "Failed to fetch content manifest" << manifestUrl
+                << "-" << request->getResultString();
+        }
+        request->deleteLater();
+    });
+    request->send();
+}
+
+bool ContentVersionManifest::isCacheValidated(const QUrl& url) {
+    QMutexLocker locker(&_validatedUrlsLock);
+    return _validatedUrls.contains(url);
+}
+
+void ContentVersionManifest::clear() {
+    QMutexLocker locker(&_validatedUrlsLock);
+    _validatedUrls.clear();
+}
+
+QHash<QUrl, QString> ContentVersionManifest::parseManifest(const QByteArray& manifestData) {
+    QHash<QUrl, QString> versions;
+
+    auto root = QJsonDocument::fromJson(manifestData).object();
+    QString baseUrl = root["baseUrl"].toString();
+    while (baseUrl.endsWith("/")) {
+        baseUrl.chop(1);
+    }
+    if (baseUrl.isEmpty()) {
+        // without a base URL the paths cannot be matched against request URLs
+        return versions;
+    }
+
+    for (const auto& value : root["assets"].toArray()) {
+        auto entry = value.toObject();
+        QString path = entry["path"].toString();
+        if (path.isEmpty()) {
+            continue;
+        }
+        // sounds carry no content key, their baked file name is content-derived instead
+        QString version = entry["key"].toString();
+        if (version.isEmpty()) {
+            version = entry["baked"].toString();
+        }
+        auto url = ResourceManager::normalizeURL(QUrl(baseUrl + "/" + path));
+
+        // a path baked under several parameter sets contributes all of them to its version
+        versions[url] = versions.value(url) + version;
+    }
+    return versions;
+}
+
+QString ContentVersionManifest::storedManifestPath(const QUrl& manifestUrl) {
+    QString manifestDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/content-manifests";
+    QDir().mkpath(manifestDir);
+    return manifestDir + "/" + QString::number(qHash(manifestUrl.toString()), 16) + ".json";
+}
+
+void ContentVersionManifest::apply(const QUrl& manifestUrl, const QByteArray& manifestData) {
+    auto newVersions = parseManifest(manifestData);
+    if (newVersions.isEmpty()) {
+        qCWarning(networking) << "Ignoring empty or unusable content manifest" << manifestUrl;
+        return;
+    }
+
+    // every URL whose advertised version is unchanged since the manifest stored on the
+    // last visit was applied can be served from the disk cache without revalidation;
+    // everything else keeps the normal conditional-request path
+    int validatedCount = 0;
+    QFile stored(storedManifestPath(manifestUrl));
+    if (stored.open(QIODevice::ReadOnly)) {
+        auto previousVersions = parseManifest(stored.readAll());
+        QMutexLocker locker(&_validatedUrlsLock);
+        for (auto it = newVersions.constBegin(); it != newVersions.constEnd(); ++it) {
+            auto previous = previousVersions.constFind(it.key());
+            if (previous != previousVersions.constEnd() && previous.value() == it.value()) {
+                _validatedUrls.insert(it.key());
+                validatedCount++;
+            }
+        }
+    }
+
+    // remember what was advertised; the next visit validates against it
+    QSaveFile file(storedManifestPath(manifestUrl));
+    if (file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        file.write(manifestData);
+        file.commit();
+    }
+
+    qCDebug(networking) << "Content manifest" << manifestUrl << "validated" << validatedCount
+        << "of" << newVersions.size() << "cached resources";
+}
@@ -0,0 +1,51 @@
+//
+//  ContentVersionManifest.h
+//  libraries/networking/src
+//
+//  Created by Ryan Huffman on 12/13/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ContentVersionManifest_h
+#define hifi_ContentVersionManifest_h
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+#include <QtCore/QUrl>
+
+/// The content-version list a domain advertises, used to validate cached resources in bulk.
+///
+/// Without it, every resource cached from a previous visit is revalidated individually
+/// with a conditional request - hundreds of round trips that dominate revisit load time.
+/// With it, one manifest fetch is diffed against the manifest stored on the last visit:
+/// a URL whose version hash is unchanged is marked validated and its disk cache entry is
+/// served with no network traffic at all, while mismatches take the normal revalidating
+/// path. The manifest format is the baked-manifest.json emitted by the content-baker.
+class ContentVersionManifest {
+public:
+    /// Asynchronously fetch and apply the manifest a domain advertises.
+    /// Called when domain settings arrive; safe to call again on a later settings update.
+    static void refresh(const QUrl& manifestUrl);
+
+    /// Returns true when the current manifest pins this URL to the same version hash it
+    /// advertised when the locally cached copy was fetched, so the cache entry may be
+    /// used without a conditional round trip.
+    static bool isCacheValidated(const QUrl& url);
+
+    /// Forget all validations, called when disconnecting from a domain.
+    static void clear();
+
+private:
+    static void apply(const QUrl& manifestUrl, const QByteArray& manifestData);
+    static QHash<QUrl, QString> parseManifest(const QByteArray& manifestData);
+    static QString storedManifestPath(const QUrl& manifestUrl);
+
+    static QSet<QUrl> _validatedUrls;
+    static QMutex _validatedUrlsLock;
+};
+
+#endif // hifi_ContentVersionManifest_h
@@ -11,11 +11,14 @@
 
 #include <math.h>
 
+#include <mutex>
+
 #include <QtCore/QJsonDocument>
 #include <QtCore/QDataStream>
 
 #include "AddressManager.h"
 #include "Assignment.h"
+#include "ContentVersionManifest.h"
 #include "HifiSockAddr.h"
 #include "NodeList.h"
 #include "udt/Packet.h"
@@ -27,6 +30,38 @@
 
 #include "DomainHandler.h"
 
+// Warmed DNS results are only trusted for a short window - long enough to cover the jump that
+// usually follows a warm-up, short enough that a re-pointed domain doesn't strand us on a stale
+// address (the in-flight lookup corrects it either way)
+static const quint64 WARMED_ADDRESS_TTL_USECS = 2 * 60 * USECS_PER_SECOND;
+
+struct WarmedAddress {
+    QHostAddress address;
+    quint64 timestamp;
+};
+
+static std::mutex _warmedAddressesMutex;
+
+static QHash<QString, WarmedAddress>& warmedAddresses() {
+    static QHash<QString, WarmedAddress> addresses;
+    return addresses;
+}
+
+void DomainHandler::storeWarmedAddress(const QString& hostname, const QHostAddress& address) {
+    std::lock_guard<std::mutex> lock(_warmedAddressesMutex);
+    warmedAddresses().insert(hostname.toLower(), { address, usecTimestampNow() });
+}
+
+bool DomainHandler::getWarmedAddress(const QString& hostname, QHostAddress& address) {
+    std::lock_guard<std::mutex> lock(_warmedAddressesMutex);
+    auto it = warmedAddresses().find(hostname.toLower());
+    if (it == warmedAddresses().end() || usecTimestampNow() - it->timestamp > WARMED_ADDRESS_TTL_USECS) {
+        return false;
+    }
+    address = it->address;
+    return true;
+}
+
 DomainHandler::DomainHandler(QObject* parent) :
     QObject(parent),
     _sockAddr(HifiSockAddr(QHostAddress::Null, DEFAULT_DOMAIN_SERVER_PORT)),
@@ -89,6 +124,7 @@ void DomainHandler::sendDisconnectPacket() {
 
 void DomainHandler::clearSettings() {
     _settingsObject = QJsonObject();
+    ContentVersionManifest::clear();
 }
 
 void DomainHandler::softReset() {
@@ -178,6 +214,20 @@ void DomainHandler::setSocketAndID(const QString& hostname, quint16 port, const
 
         // grab the port by reading the string after the colon
         _sockAddr.setPort(port);
+
+        // if a speculative warm-up already resolved this hostname, adopt the address right away
+        // so the check-in handshake starts now - the lookup that just went out above will
+        // re-confirm (or correct) the address when it completes
+        QHostAddress warmedAddress;
+        if (_sockAddr.getAddress().isNull() && getWarmedAddress(_hostname, warmedAddress)) {
+            qCDebug(networking) << "Using warmed DNS result" << warmedAddress << "for" << _hostname;
+
+            _sockAddr.setAddress(warmedAddress);
+
+            DependencyManager::get<NodeList>()->flagTimeForConnectionStep(LimitedNodeList::ConnectionStep::SetDomainSocket);
+
+            emit completedSocketDiscovery();
+        }
     }
 }
 
@@ -229,6 +279,15 @@ void DomainHandler::activateICEPublicSocket() {
 void DomainHandler::completedHostnameLookup(const QHostInfo& hostInfo) {
     for (int i = 0; i < hostInfo.addresses().size(); i++) {
         if (hostInfo.addresses()[i].protocol() == QAbstractSocket::IPv4Protocol) {
+            // remember the fresh result for speculative re-use on a later jump back here
+            storeWarmedAddress(hostInfo.hostName(), hostInfo.addresses()[i]);
+
+            if (_sockAddr.getAddress() == hostInfo.addresses()[i]) {
+                // we adopted a warmed address for this hostname and it still holds - the
+                // handshake is already under way, so don't restart socket discovery
+                return;
+            }
+
             _sockAddr.setAddress(hostInfo.addresses()[i]);
 
             DependencyManager::get<NodeList>()->flagTimeForConnectionStep(LimitedNodeList::ConnectionStep::SetDomainSocket);
@@ -297,6 +356,15 @@ void DomainHandler::processSettingsPacketList(QSharedPointer<ReceivedMessage> pa
         qCDebug(networking) << "Received domain settings: \n" << _settingsObject;
     }
 
+    // if the domain advertises a content manifest, fetch it so cached resources whose
+    // advertised versions are unchanged skip their revalidation round trips
+    static const QString CONTENT_SETTINGS_KEY = "content";
+    static const QString BAKED_MANIFEST_URL_KEY = "baked_manifest_url";
+    QString manifestUrl = _settingsObject[CONTENT_SETTINGS_KEY].toObject()[BAKED_MANIFEST_URL_KEY].toString();
+    if (!manifestUrl.isEmpty()) {
+        ContentVersionManifest::refresh(QUrl(manifestUrl));
+    }
+
     emit settingsReceived(_settingsObject);
 }
 
@@ -82,6 +82,13 @@ public:
 
     bool isSocketKnown() const { return !_sockAddr.getAddress().isNull(); }
 
+    // Speculative DNS warm-up. The AddressManager pre-resolves likely destinations (recent
+    // domains) and parks the results here so that a later setSocketAndID for one of them can
+    // kick off the domain-server handshake immediately instead of serializing it behind a
+    // fresh hostname lookup. Both calls are threadsafe.
+    static void storeWarmedAddress(const QString& hostname, const QHostAddress& address);
+    static bool getWarmedAddress(const QString& hostname, QHostAddress& address);
+
     void softReset();
 
     enum class ConnectionRefusedReason : uint8_t {
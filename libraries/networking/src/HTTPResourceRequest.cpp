@@ -54,7 +54,10 @@ void HTTPResourceRequest::doSend() {
     networkRequest.setHeader(QNetworkRequest::UserAgentHeader, HIGH_FIDELITY_USER_AGENT);
 
     if (_cacheEnabled) {
-        networkRequest.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
+        // a manifest-validated entry is served straight from the cache with no conditional
+        // round trip; onRequestFinished falls back to the network if the entry is gone
+        auto cacheControl = _cacheVerified ? QNetworkRequest::AlwaysCache : QNetworkRequest::PreferCache;
+        networkRequest.setAttribute(QNetworkRequest::CacheLoadControlAttribute, cacheControl);
     } else {
         networkRequest.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
     }
@@ -85,6 +88,16 @@ void HTTPResourceRequest::onRequestFinished() {
             break;
 
         case QNetworkReply::ContentNotFoundError: // Script.include('https://httpbin.org/status/404')
+            if (_cacheVerified) {
+                // the content manifest vouched for a cache entry that turned out to be
+                // missing or evicted; retry this request over the network
+                _cacheVerified = false;
+                _reply->disconnect(this);
+                _reply->deleteLater();
+                _reply = nullptr;
+                doSend();
+                return;
+            }
             _result = NotFound;
             break;
 
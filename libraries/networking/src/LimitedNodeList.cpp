@@ -88,9 +88,9 @@ LimitedNodeList::LimitedNodeList(int socketListenPort, int dtlsListenPort) :
     connect(localSocketUpdate, &QTimer::timeout, this, &LimitedNodeList::updateLocalSocket);
     localSocketUpdate->start(LOCAL_SOCKET_UPDATE_INTERVAL_MSECS);
 
-    QTimer* silentNodeTimer = new QTimer(this);
-    connect(silentNodeTimer, &QTimer::timeout, this, &LimitedNodeList::removeSilentNodes);
-    silentNodeTimer->start(NODE_SILENCE_THRESHOLD_MSECS);
+    _silentNodeTimer = new QTimer(this);
+    connect(_silentNodeTimer, &QTimer::timeout, this, &LimitedNodeList::removeSilentNodes);
+    _silentNodeTimer->start(NODE_SILENCE_THRESHOLD_MSECS);
 
     // check the local socket right now
     updateLocalSocket();
@@ -270,11 +270,10 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
         if (matchingNode) {
             if (!NON_VERIFIED_PACKETS.contains(headerType)) {
 
-                QByteArray packetHeaderHash = NLPacket::verificationHashInHeader(packet);
-                QByteArray expectedHash = NLPacket::hashForPacketAndSecret(packet, matchingNode->getConnectionSecret());
-
-                // check if the md5 hash in the header matches the hash we would expect
-                if (packetHeaderHash != expectedHash) {
+                // check if the md5 hash in the header matches the hash we would expect, using the
+                // node's pre-serialized secret and comparing against the header in place - this
+                // runs once per received sourced packet
+                if (!NLPacket::matchesVerificationHash(packet, matchingNode->getConnectionSecretBytes())) {
                     static QMultiMap<QUuid, PacketType> hashDebugSuppressMap;
 
                     if (!hashDebugSuppressMap.contains(sourceID, headerType)) {
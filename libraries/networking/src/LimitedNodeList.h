@@ -178,37 +178,45 @@ public:
     using value_type = SharedNodePointer;
     using const_iterator = std::vector<value_type>::const_iterator;
 
-    // Cede control of iteration under a single read lock (e.g. for use by thread pools)
+    // Snapshot the current node set into an immutable vector that can be iterated
+    // without any locks - the shared pointers keep the nodes (and their linked data)
+    // alive even if they are removed from the hash while the snapshot is held.
+    // Mutations continue to go through the hash under the write lock, so a snapshot
+    // never observes a partially-updated node set.
+    std::vector<SharedNodePointer> nodeSnapshot(int* lockWaitOut = nullptr, int* nodeTransformOut = nullptr) {
+        auto start = usecTimestampNow();
+        QReadLocker readLock(&_nodeMutex);
+        auto endLock = usecTimestampNow();
+        if (lockWaitOut) {
+            *lockWaitOut = (endLock - start);
+        }
+
+        std::vector<SharedNodePointer> nodes(_nodeHash.size());
+        std::transform(_nodeHash.cbegin(), _nodeHash.cend(), nodes.begin(), [](const NodeHash::value_type& it) {
+            return it.second;
+        });
+        if (nodeTransformOut) {
+            *nodeTransformOut = (usecTimestampNow() - endLock);
+        }
+        return nodes;
+    }
+
+    // Cede control of iteration over a lock-free snapshot (e.g. for use by thread pools)
     // Use this for nested loops instead of taking nested read locks!
-    //   This allows multiple threads (i.e. a thread pool) to share a lock
-    //   without deadlocking when a dying node attempts to acquire a write lock
+    //   Multiple threads (i.e. a thread pool) can iterate the snapshot without
+    //   holding the node mutex, so a dying node is free to acquire the write lock
+    //   while a broadcast pass is still in flight
     template<typename NestedNodeLambda>
-    void nestedEach(NestedNodeLambda functor, 
-                    int* lockWaitOut = nullptr, 
-                    int* nodeTransformOut = nullptr, 
+    void nestedEach(NestedNodeLambda functor,
+                    int* lockWaitOut = nullptr,
+                    int* nodeTransformOut = nullptr,
                     int* functorOut = nullptr) {
-        auto start = usecTimestampNow();
-        {
-            QReadLocker readLock(&_nodeMutex);
-            auto endLock = usecTimestampNow();
-            if (lockWaitOut) {
-                *lockWaitOut = (endLock - start);
-            }
-
-            std::vector<SharedNodePointer> nodes(_nodeHash.size());
-            std::transform(_nodeHash.cbegin(), _nodeHash.cend(), nodes.begin(), [](const NodeHash::value_type& it) {
-                return it.second;
-            });
-            auto endTransform = usecTimestampNow();
-            if (nodeTransformOut) {
-                *nodeTransformOut = (endTransform - endLock);
-            }
+        auto nodes = nodeSnapshot(lockWaitOut, nodeTransformOut);
 
-            functor(nodes.cbegin(), nodes.cend());
-            auto endFunctor = usecTimestampNow();
-            if (functorOut) {
-                *functorOut = (endFunctor - endTransform);
-            }
+        auto start = usecTimestampNow();
+        functor(nodes.cbegin(), nodes.cend());
+        if (functorOut) {
+            *functorOut = (usecTimestampNow() - start);
         }
     }
 
@@ -366,6 +374,10 @@ protected:
 
     QPointer<QTimer> _initialSTUNTimer;
 
+    // checks for silent nodes on its own interval; subclasses that run their own periodic
+    // node sweep may stop it and perform the check from their sweep instead
+    QTimer* _silentNodeTimer { nullptr };
+
     int _numInitialSTUNRequests = 0;
     bool _hasCompletedInitialSTUN = false;
     quint64 _firstSTUNTime = 0;
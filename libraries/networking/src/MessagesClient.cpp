@@ -106,15 +106,19 @@ std::unique_ptr<NLPacketList> MessagesClient::encodeMessagesDataPacket(QString c
 
 
 void MessagesClient::handleMessagesPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
-    QString channel, message;
-    QByteArray data;
-    bool isText { false };
-    QUuid senderID;
-    decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
-    if (isText) {
-        emit messageReceived(channel, message, senderID, false);
-    } else {
-        emit dataReceived(channel, data, senderID, false);
+    // the messages-mixer coalesces messages bound for the same destination into one packet
+    // list per network tick, so keep decoding until the message is exhausted
+    while (receivedMessage->getBytesLeftToRead() > 0) {
+        QString channel, message;
+        QByteArray data;
+        bool isText { false };
+        QUuid senderID;
+        decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
+        if (isText) {
+            emit messageReceived(channel, message, senderID, false);
+        } else {
+            emit dataReceived(channel, data, senderID, false);
+        }
     }
 }
 
@@ -11,6 +11,29 @@
 
 #include "NLPacket.h"
 
+#include <MemoryPool.h>
+
+static MemoryPool& nlPacketPool() {
+    static MemoryPool pool { "networking.NLPacket", sizeof(NLPacket) };
+    return pool;
+}
+
+void* NLPacket::operator new(size_t size) {
+    if (size != sizeof(NLPacket)) {
+        // a subclass - it didn't come from our pool, so don't send it there
+        return ::operator new(size);
+    }
+    return nlPacketPool().allocate();
+}
+
+void NLPacket::operator delete(void* packet, size_t size) {
+    if (size != sizeof(NLPacket)) {
+        ::operator delete(packet);
+        return;
+    }
+    nlPacketPool().release(packet);
+}
+
 int NLPacket::localHeaderSize(PacketType type) {
     bool nonSourced = NON_SOURCED_PACKETS.contains(type);
     bool nonVerified = NON_VERIFIED_PACKETS.contains(type);
@@ -150,19 +173,31 @@ QByteArray NLPacket::verificationHashInHeader(const udt::Packet& packet) {
 }
 
 QByteArray NLPacket::hashForPacketAndSecret(const udt::Packet& packet, const QUuid& connectionSecret) {
+    return hashForPacketAndSecretBytes(packet, connectionSecret.toRfc4122());
+}
+
+QByteArray NLPacket::hashForPacketAndSecretBytes(const udt::Packet& packet, const QByteArray& connectionSecretBytes) {
     QCryptographicHash hash(QCryptographicHash::Md5);
-    
+
     int offset = Packet::totalHeaderSize(packet.isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion)
         + NUM_BYTES_RFC4122_UUID + NUM_BYTES_MD5_HASH;
-    
+
     // add the packet payload and the connection UUID
     hash.addData(packet.getData() + offset, packet.getDataSize() - offset);
-    hash.addData(connectionSecret.toRfc4122());
-    
+    hash.addData(connectionSecretBytes);
+
     // return the hash
     return hash.result();
 }
 
+bool NLPacket::matchesVerificationHash(const udt::Packet& packet, const QByteArray& connectionSecretBytes) {
+    QByteArray expectedHash = hashForPacketAndSecretBytes(packet, connectionSecretBytes);
+
+    int offset = Packet::totalHeaderSize(packet.isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion)
+        + NUM_BYTES_RFC4122_UUID;
+    return memcmp(expectedHash.constData(), packet.getData() + offset, NUM_BYTES_MD5_HASH) == 0;
+}
+
 void NLPacket::writeTypeAndVersion() {
     auto headerOffset = Packet::totalHeaderSize(isPartOfMessage());
     
@@ -37,6 +37,11 @@ public:
         sizeof(udt::Packet::SequenceNumberAndBitField) + sizeof(udt::Packet::MessageNumberAndBitField) +
         sizeof(PacketType) + sizeof(PacketVersion) + NUM_BYTES_RFC4122_UUID + NUM_BYTES_MD5_HASH;
     
+    // NLPackets are churned at wire rate, so class-level new/delete route the objects
+    // through a fixed-size MemoryPool instead of the general-purpose heap
+    static void* operator new(size_t size);
+    static void operator delete(void* packet, size_t size);
+
     static std::unique_ptr<NLPacket> create(PacketType type, qint64 size = -1,
                     bool isReliable = false, bool isPartOfMessage = false, PacketVersion version = 0);
     
@@ -60,6 +65,10 @@ public:
     static QUuid sourceIDInHeader(const udt::Packet& packet);
     static QByteArray verificationHashInHeader(const udt::Packet& packet);
     static QByteArray hashForPacketAndSecret(const udt::Packet& packet, const QUuid& connectionSecret);
+    static QByteArray hashForPacketAndSecretBytes(const udt::Packet& packet, const QByteArray& connectionSecretBytes);
+    // computes the expected hash and compares it against the one in the header in place -
+    // use this on the receive path so the header hash isn't copied out just to be compared
+    static bool matchesVerificationHash(const udt::Packet& packet, const QByteArray& connectionSecretBytes);
     
     PacketType getType() const { return _type; }
     void setType(PacketType type);
@@ -56,18 +56,30 @@ Node::Node(const QUuid& uuid, NodeType_t type, const HifiSockAddr& publicSocket,
     NetworkPeer(uuid, publicSocket, localSocket, parent),
     _type(type),
     _connectionSecret(connectionSecret),
+    _connectionSecretBytes(connectionSecret.toRfc4122()),
     _isAlive(true),
     _pingMs(-1),  // "Uninitialized"
     _clockSkewUsec(0),
     _mutex(),
-    _clockSkewMovingPercentile(30, 0.8f),   // moving 80th percentile of 30 samples
-    _permissions(permissions)
+    _clockSkewMovingPercentile(30, 0.8f)   // moving 80th percentile of 30 samples
 {
+    setPermissions(permissions);
+
     // Update socket's object name
     setType(_type);
     _ignoreRadiusEnabled = false;
 }
 
+void Node::setPermissions(const NodePermissions& newPermissions) {
+    // publish an immutable snapshot and mirror the decision bits inline, so per-packet
+    // permission checks on other threads never lock or copy a NodePermissions while a
+    // settings change is being applied
+    _permissionFlags.store(static_cast<unsigned int>(static_cast<int>(newPermissions.permissions)),
+                           std::memory_order_relaxed);
+    std::atomic_store(&_permissions,
+                      std::shared_ptr<const NodePermissions>(std::make_shared<NodePermissions>(newPermissions)));
+}
+
 void Node::setType(char type) {
     _type = type;
     
@@ -105,6 +117,7 @@ void Node::addIgnoredNode(const QUuid& otherNodeID) {
 
         // add the session UUID to the set of ignored ones for this listening node
         _ignoredNodeIDSet.insert(otherNodeID);
+        _ignoreSetVersion.fetch_add(1, std::memory_order_release);
     } else {
         qCWarning(networking) << "Node::addIgnoredNode called with null ID or ID of ignoring node.";
     }
@@ -119,6 +132,7 @@ void Node::removeIgnoredNode(const QUuid& otherNodeID) {
 
         // remove the session UUID from the set of ignored ones for this listening node
         _ignoredNodeIDSet.unsafe_erase(otherNodeID);
+        _ignoreSetVersion.fetch_add(1, std::memory_order_release);
     } else {
         qCWarning(networking) << "Node::removeIgnoredNode called with null ID or ID of ignoring node.";
     }
@@ -135,7 +149,7 @@ QDataStream& operator<<(QDataStream& out, const Node& node) {
     out << node._uuid;
     out << node._publicSocket;
     out << node._localSocket;
-    out << node._permissions;
+    out << node.getPermissions();
     return out;
 }
 
@@ -144,7 +158,11 @@ QDataStream& operator>>(QDataStream& in, Node& node) {
     in >> node._uuid;
     in >> node._publicSocket;
     in >> node._localSocket;
-    in >> node._permissions;
+
+    NodePermissions permissions;
+    in >> permissions;
+    node.setPermissions(permissions);
+
     return in;
 }
 
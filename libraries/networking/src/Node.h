@@ -12,6 +12,7 @@
 #ifndef hifi_Node_h
 #define hifi_Node_h
 
+#include <atomic>
 #include <memory>
 #include <ostream>
 #include <stdint.h>
@@ -49,7 +50,15 @@ public:
     void setType(char type);
 
     const QUuid& getConnectionSecret() const { return _connectionSecret; }
-    void setConnectionSecret(const QUuid& connectionSecret) { _connectionSecret = connectionSecret; }
+    void setConnectionSecret(const QUuid& connectionSecret) {
+        if (_connectionSecret != connectionSecret) {
+            _connectionSecret = connectionSecret;
+            _connectionSecretBytes = connectionSecret.toRfc4122();
+        }
+    }
+    // the secret's rfc4122 bytes go into every sourced packet's verification hash, so they're
+    // kept serialized here rather than re-derived from the QUuid at packet rates
+    const QByteArray& getConnectionSecretBytes() const { return _connectionSecretBytes; }
 
     NodeData* getLinkedData() const { return _linkedData.get(); }
     void setLinkedData(std::unique_ptr<NodeData> linkedData) { _linkedData = std::move(linkedData); }
@@ -64,18 +73,21 @@ public:
     void updateClockSkewUsec(qint64 clockSkewSample);
     QMutex& getMutex() { return _mutex; }
 
-    void setPermissions(const NodePermissions& newPermissions) { _permissions = newPermissions; }
-    NodePermissions getPermissions() const { return _permissions; }
-    bool isAllowedEditor() const { return _permissions.can(NodePermissions::Permission::canAdjustLocks); }
-    bool getCanRez() const { return _permissions.can(NodePermissions::Permission::canRezPermanentEntities); }
-    bool getCanRezTmp() const { return _permissions.can(NodePermissions::Permission::canRezTemporaryEntities); }
-    bool getCanWriteToAssetServer() const { return _permissions.can(NodePermissions::Permission::canWriteToAssetServer); }
-    bool getCanKick() const { return _permissions.can(NodePermissions::Permission::canKick); }
+    void setPermissions(const NodePermissions& newPermissions);
+    NodePermissions getPermissions() const { return *std::atomic_load(&_permissions); }
+    bool isAllowedEditor() const { return hasPermission(NodePermissions::Permission::canAdjustLocks); }
+    bool getCanRez() const { return hasPermission(NodePermissions::Permission::canRezPermanentEntities); }
+    bool getCanRezTmp() const { return hasPermission(NodePermissions::Permission::canRezTemporaryEntities); }
+    bool getCanWriteToAssetServer() const { return hasPermission(NodePermissions::Permission::canWriteToAssetServer); }
+    bool getCanKick() const { return hasPermission(NodePermissions::Permission::canKick); }
 
     void parseIgnoreRequestMessage(QSharedPointer<ReceivedMessage> message);
     void addIgnoredNode(const QUuid& otherNodeID);
     void removeIgnoredNode(const QUuid& otherNodeID);
     bool isIgnoringNodeWithID(const QUuid& nodeID) const { QReadLocker lock { &_ignoredNodeIDSetLock }; return _ignoredNodeIDSet.find(nodeID) != _ignoredNodeIDSet.cend(); }
+    // bumped on every ignore set change, so cached filters built from the set (like the
+    // avatar mixer's per-client bitsets) can tell when they are stale
+    quint32 getIgnoreSetVersion() const { return _ignoreSetVersion.load(std::memory_order_acquire); }
     void parseIgnoreRadiusRequestMessage(QSharedPointer<ReceivedMessage> message);
 
     friend QDataStream& operator<<(QDataStream& out, const Node& node);
@@ -88,18 +100,30 @@ private:
     Node(const Node &otherNode);
     Node& operator=(Node otherNode);
 
+    // per-packet permission decisions read the inline flag mirror - one relaxed atomic
+    // load, no lock and no NodePermissions copy
+    bool hasPermission(NodePermissions::Permission permission) const {
+        return (_permissionFlags.load(std::memory_order_relaxed) & static_cast<unsigned int>(permission)) != 0;
+    }
+
     NodeType_t _type;
 
     QUuid _connectionSecret;
+    QByteArray _connectionSecretBytes;
     std::unique_ptr<NodeData> _linkedData;
     bool _isAlive;
     int _pingMs;
     qint64 _clockSkewUsec;
     QMutex _mutex;
     MovingPercentile _clockSkewMovingPercentile;
-    NodePermissions _permissions;
+    // immutable snapshot of this node's permissions, atomically swapped by setPermissions,
+    // with the decision bits mirrored inline for the hot boolean checks above
+    std::shared_ptr<const NodePermissions> _permissions;
+    std::atomic<unsigned int> _permissionFlags { 0 };
+
     tbb::concurrent_unordered_set<QUuid, UUIDHasher> _ignoredNodeIDSet;
     mutable QReadWriteLock _ignoredNodeIDSetLock;
+    std::atomic<quint32> _ignoreSetVersion { 0 };
 
     std::atomic_bool _ignoreRadiusEnabled;
 };
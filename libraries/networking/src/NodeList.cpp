@@ -44,7 +44,7 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     _domainHandler(this),
     _numNoReplyDomainCheckIns(0),
     _assignmentServerSocket(),
-    _keepAlivePingTimer(this)
+    _nodeSweepTimer(this)
 {
     setCustomDeleter([](Dependency* dependency){
         static_cast<NodeList*>(dependency)->deleteLater();
@@ -102,11 +102,20 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     // anytime we get a new node we may need to re-send our set of ignored node IDs to it
     connect(this, &LimitedNodeList::nodeActivated, this, &NodeList::maybeSendIgnoreSetToNode);
 
-    // setup our timer to send keepalive pings (it's started and stopped on domain connect/disconnect)
-    _keepAlivePingTimer.setInterval(KEEPALIVE_PING_INTERVAL_MS); // 1s, Qt::CoarseTimer acceptable
-    connect(&_keepAlivePingTimer, &QTimer::timeout, this, &NodeList::sendKeepAlivePings);
-    connect(&_domainHandler, SIGNAL(connectedToDomain(QString)), &_keepAlivePingTimer, SLOT(start()));
-    connect(&_domainHandler, &DomainHandler::disconnectedFromDomain, &_keepAlivePingTimer, &QTimer::stop);
+    // all periodic per-node work is swept from one single-shot timer that re-arms itself
+    // for the next due deadline after every pass
+    _nodeSweepTimer.setSingleShot(true);
+    connect(&_nodeSweepTimer, &QTimer::timeout, this, &NodeList::performNodeSweep);
+
+    // keepalive pings join the sweep on domain connect and drop out on disconnect
+    connect(&_domainHandler, SIGNAL(connectedToDomain(QString)), this, SLOT(startKeepAlivePings()));
+    connect(&_domainHandler, &DomainHandler::disconnectedFromDomain, this, &NodeList::stopKeepalivePingTimer);
+
+    // the base class checks for silent nodes on its own timer - fold that check into the sweep
+    // so it doesn't cost a separate wakeup
+    _silentNodeTimer->stop();
+    scheduleSweepTask({ usecTimestampNow() + NODE_SILENCE_THRESHOLD_MSECS * USECS_PER_MSEC,
+                        SweepTask::SilentNodeCheck, QUuid() });
 
     // set our sockAddrBelongsToDomainOrNode method as the connection creation filter for the udt::Socket
     using std::placeholders::_1;
@@ -239,6 +248,9 @@ void NodeList::reset() {
 
     _numNoReplyDomainCheckIns = 0;
 
+    // we no longer hold any version of the domain's node list
+    _domainListVersion = 0;
+
     // lock and clear our set of radius ignored IDs
     _radiusIgnoredSetLock.lockForWrite();
     _radiusIgnoredNodeIDs.clear();
@@ -397,6 +409,12 @@ void NodeList::sendDomainServerCheckIn() {
         packetStream << _ownerType.load() << _publicSockAddr << _localSockAddr << _nodeTypesOfInterest.toList();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
+        if (domainPacketType == PacketType::DomainListRequest) {
+            // ack the list version we last received - if it is still current the domain-server
+            // answers with just the list header instead of re-sending every node
+            packetStream << _domainListVersion;
+        }
+
         if (!_domainHandler.isConnected()) {
             DataServerAccountInfo& accountInfo = accountManager->getAccountInfo();
             packetStream << accountInfo.getUsername();
@@ -626,6 +644,10 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     packetStream >> newPermissions;
     setPermissions(newPermissions);
 
+    // pull the version of the node list this packet represents, which we ack with our
+    // next list request
+    packetStream >> _domainListVersion;
+
     // pull each node in the packet
     while (packetStream.device()->pos() < message->getSize()) {
         parseNodeFromPacketStream(packetStream);
@@ -638,6 +660,12 @@ void NodeList::processDomainServerAddedNode(QSharedPointer<ReceivedMessage> mess
 
     // use our shared method to pull out the new node
     parseNodeFromPacketStream(packetStream);
+
+    // this add record carries the list version it brings us up to
+    quint32 newDomainListVersion;
+    packetStream >> newDomainListVersion;
+
+    adoptDomainListVersion(newDomainListVersion);
 }
 
 void NodeList::processDomainServerRemovedNode(QSharedPointer<ReceivedMessage> message) {
@@ -645,6 +673,20 @@ void NodeList::processDomainServerRemovedNode(QSharedPointer<ReceivedMessage> me
     QUuid nodeUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
     qCDebug(networking) << "Received packet from domain-server to remove node with UUID" << uuidStringWithoutCurlyBraces(nodeUUID);
     killNodeWithUUID(nodeUUID);
+
+    // this remove record carries the list version it brings us up to
+    quint32 newDomainListVersion;
+    message->readPrimitive(&newDomainListVersion);
+
+    adoptDomainListVersion(newDomainListVersion);
+}
+
+void NodeList::adoptDomainListVersion(quint32 newDomainListVersion) {
+    // only adopt the next sequential version - if a delta went missing in between, our ack
+    // stays behind and the domain-server sends a fresh full list on our next request
+    if (newDomainListVersion == _domainListVersion + 1) {
+        _domainListVersion = newDomainListVersion;
+    }
 }
 
 void NodeList::parseNodeFromPacketStream(QDataStream& packetStream) {
@@ -710,25 +752,74 @@ void NodeList::pingPunchForInactiveNode(const SharedNodePointer& node) {
 }
 
 void NodeList::startNodeHolePunch(const SharedNodePointer& node) {
-    // connect to the correct signal on this node so we know when to ping it
-    connect(node.data(), &Node::pingTimerTimeout, this, &NodeList::handleNodePingTimeout);
-
-    // start the ping timer for this node
-    node->startPingTimer();
+    // add the node to the sweep so it is pinged every UDP_PUNCH_PING_INTERVAL_MS until one of
+    // its sockets activates
+    if (!_punchingNodes.contains(node->getUUID())) {
+        _punchingNodes.insert(node->getUUID());
+        scheduleSweepTask({ usecTimestampNow() + UDP_PUNCH_PING_INTERVAL_MS * USECS_PER_MSEC,
+                            SweepTask::HolePunch, node->getUUID() });
+    }
 
     // ping this node immediately
     pingPunchForInactiveNode(node);
 }
 
-void NodeList::handleNodePingTimeout() {
-    Node* senderNode = qobject_cast<Node*>(sender());
-    if (senderNode) {
-        SharedNodePointer sharedNode = nodeWithUUID(senderNode->getUUID());
+void NodeList::scheduleSweepTask(const SweepTask& task) {
+    bool isNewEarliest = _sweepTasks.empty() || task.dueTimeUsecs < _sweepTasks.top().dueTimeUsecs;
+    _sweepTasks.push(task);
+
+    if (isNewEarliest) {
+        armNodeSweepTimer();
+    }
+}
 
-        if (sharedNode && !sharedNode->getActiveSocket()) {
-            pingPunchForInactiveNode(sharedNode);
+void NodeList::armNodeSweepTimer() {
+    if (_sweepTasks.empty()) {
+        return;
+    }
+
+    quint64 now = usecTimestampNow();
+    quint64 earliestDueTime = _sweepTasks.top().dueTimeUsecs;
+    int msecsToNextDeadline = (earliestDueTime > now) ? (int)((earliestDueTime - now) / USECS_PER_MSEC) : 0;
+    _nodeSweepTimer.start(msecsToNextDeadline);
+}
+
+void NodeList::performNodeSweep() {
+    quint64 now = usecTimestampNow();
+
+    while (!_sweepTasks.empty() && _sweepTasks.top().dueTimeUsecs <= now) {
+        SweepTask task = _sweepTasks.top();
+        _sweepTasks.pop();
+
+        switch (task.type) {
+            case SweepTask::HolePunch: {
+                SharedNodePointer node = nodeWithUUID(task.nodeID);
+                if (node && !node->getActiveSocket()) {
+                    pingPunchForInactiveNode(node);
+                    task.dueTimeUsecs = now + UDP_PUNCH_PING_INTERVAL_MS * USECS_PER_MSEC;
+                    _sweepTasks.push(task);
+                } else {
+                    // the node activated a socket or was killed - it drops out of the sweep
+                    _punchingNodes.remove(task.nodeID);
+                }
+                break;
+            }
+            case SweepTask::KeepAlive:
+                if (_keepAlivePingsEnabled) {
+                    sendKeepAlivePings();
+                    task.dueTimeUsecs = now + KEEPALIVE_PING_INTERVAL_MS * USECS_PER_MSEC;
+                    _sweepTasks.push(task);
+                }
+                break;
+            case SweepTask::SilentNodeCheck:
+                removeSilentNodes();
+                task.dueTimeUsecs = now + NODE_SILENCE_THRESHOLD_MSECS * USECS_PER_MSEC;
+                _sweepTasks.push(task);
+                break;
         }
     }
+
+    armNodeSweepTimer();
 }
 
 void NodeList::activateSocketFromNodeCommunication(ReceivedMessage& message, const SharedNodePointer& sendingNode) {
@@ -753,12 +844,19 @@ void NodeList::activateSocketFromNodeCommunication(ReceivedMessage& message, con
     }
 }
 
-void NodeList::stopKeepalivePingTimer() {
-    if (_keepAlivePingTimer.isActive()) {
-        _keepAlivePingTimer.stop();
+void NodeList::startKeepAlivePings() {
+    if (!_keepAlivePingsEnabled) {
+        _keepAlivePingsEnabled = true;
+        scheduleSweepTask({ usecTimestampNow() + KEEPALIVE_PING_INTERVAL_MS * USECS_PER_MSEC,
+                            SweepTask::KeepAlive, QUuid() });
     }
 }
 
+void NodeList::stopKeepalivePingTimer() {
+    // the staged KeepAlive task sees this and drops out of the sweep at its next deadline
+    _keepAlivePingsEnabled = false;
+}
+
 void NodeList::sendKeepAlivePings() {
     eachMatchingNode([this](const SharedNodePointer& node)->bool {
         return _nodeTypesOfInterest.contains(node->getType());
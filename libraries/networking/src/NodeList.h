@@ -15,6 +15,8 @@
 #include <stdint.h>
 #include <iterator>
 #include <assert.h>
+#include <queue>
+#include <vector>
 
 #ifndef _WIN32
 #include <unistd.h> // not on windows, not needed for mac or windows
@@ -124,12 +126,13 @@ signals:
     void usernameFromIDReply(const QString& nodeID, const QString& username, const QString& machineFingerprint, bool isAdmin);
 
 private slots:
+    void startKeepAlivePings();
     void stopKeepalivePingTimer();
     void sendPendingDSPathQuery();
     void handleICEConnectionToDomainServer();
 
     void startNodeHolePunch(const SharedNodePointer& node);
-    void handleNodePingTimeout();
+    void performNodeSweep();
 
     void pingPunchForDomainServer();
 
@@ -152,17 +155,38 @@ private:
 
     void parseNodeFromPacketStream(QDataStream& packetStream);
 
+    void adoptDomainListVersion(quint32 newDomainListVersion);
+
     void pingPunchForInactiveNode(const SharedNodePointer& node);
 
+    // periodic per-node work (hole punch pings, keep-alive pings, silent node checks) all runs
+    // off one single-shot timer armed for the earliest due deadline in a min-heap, instead of a
+    // QTimer per node - with many peers the per-node timers dominated event loop wakeups
+    class SweepTask {
+    public:
+        enum Type : uint8_t { HolePunch, KeepAlive, SilentNodeCheck };
+        quint64 dueTimeUsecs;
+        Type type;
+        QUuid nodeID; // only used by HolePunch tasks
+        bool operator>(const SweepTask& other) const { return dueTimeUsecs > other.dueTimeUsecs; }
+    };
+    void scheduleSweepTask(const SweepTask& task);
+    void armNodeSweepTimer();
+
     bool sockAddrBelongsToDomainOrNode(const HifiSockAddr& sockAddr);
 
     std::atomic<NodeType_t> _ownerType;
     NodeSet _nodeTypesOfInterest;
     DomainHandler _domainHandler;
     int _numNoReplyDomainCheckIns;
+    // the domain's node list version we last received, acked with each list request
+    quint32 _domainListVersion { 0 };
     HifiSockAddr _assignmentServerSocket;
     bool _isShuttingDown { false };
-    QTimer _keepAlivePingTimer;
+    QTimer _nodeSweepTimer;
+    std::priority_queue<SweepTask, std::vector<SweepTask>, std::greater<SweepTask>> _sweepTasks;
+    QSet<QUuid> _punchingNodes;
+    bool _keepAlivePingsEnabled { false };
     bool _requestsDomainListData;
 
     mutable QReadWriteLock _radiusIgnoredSetLock;
@@ -111,6 +111,29 @@ bool PacketReceiver::registerListener(PacketType type, QObject* listener, const
     }
 }
 
+void PacketReceiver::registerFunctionListener(PacketType type, QObject* listener, ListenerFunction function, bool deliverPending) {
+    Q_ASSERT_X(listener, "PacketReceiver::registerFunctionListener", "No object to register");
+    Q_ASSERT_X(function, "PacketReceiver::registerFunctionListener", "No function to register");
+
+    QMutexLocker locker(&_packetListenerLock);
+
+    if (_messageListenerMap.contains(type)) {
+        qCWarning(networking) << "Registering a packet listener for packet type" << type
+            << "that will remove a previously registered listener";
+    }
+
+    // add the mapping - an invalid QMetaMethod marks this listener as function dispatched
+    _messageListenerMap[type] = { QPointer<QObject>(listener), QMetaMethod(), deliverPending, std::move(function) };
+}
+
+void PacketReceiver::registerFunctionListenerForTypes(PacketTypeList types, QObject* listener, ListenerFunction function) {
+    Q_ASSERT_X(!types.empty(), "PacketReceiver::registerFunctionListenerForTypes", "No types to register");
+
+    for (auto type : types) {
+        registerFunctionListener(type, listener, function);
+    }
+}
+
 QMetaMethod PacketReceiver::matchingMethodForListener(PacketType type, QObject* object, const char* slot) const {
     Q_ASSERT_X(object, "PacketReceiver::matchingMethodForListener", "No object to call");
     Q_ASSERT_X(slot, "PacketReceiver::matchingMethodForListener", "No slot to call");
@@ -205,16 +228,16 @@ void PacketReceiver::handleVerifiedPacket(std::unique_ptr<udt::Packet> packet) {
     if (_shouldDropPackets) {
         return;
     }
-    
-    auto nodeList = DependencyManager::get<LimitedNodeList>();
-    
+
     // setup an NLPacket from the packet we were passed
     auto nlPacket = NLPacket::fromBase(std::move(packet));
-    auto receivedMessage = QSharedPointer<ReceivedMessage>::create(*nlPacket);
 
+    // count the packet before the message adopts its buffer
     _inPacketCount += 1;
     _inByteCount += nlPacket->size();
 
+    auto receivedMessage = QSharedPointer<ReceivedMessage>::create(*nlPacket);
+
     handleVerifiedMessage(receivedMessage, true);
 }
 
@@ -257,7 +280,8 @@ void PacketReceiver::handleMessageFailure(HifiSockAddr from, udt::Packet::Messag
 }
 
 void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> receivedMessage, bool justReceived) {
-    auto nodeList = DependencyManager::get<LimitedNodeList>();
+    // this is a per-packet path, so use the raw fast path rather than taking a reference
+    auto nodeList = DependencyManager::getUnsafe<LimitedNodeList>();
     
     SharedNodePointer matchingNode;
     
@@ -271,16 +295,27 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
     
     auto it = _messageListenerMap.find(receivedMessage->getType());
             
-    if (it != _messageListenerMap.end() && it->method.isValid()) {
-         
+    if (it != _messageListenerMap.end() && (it->method.isValid() || it->function)) {
+
         auto listener = it.value();
 
         if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
             return;
         }
-    
+
         if (listener.object) {
-            
+
+            if (listener.function) {
+                // function dispatched listener - call straight through on this (networking) thread,
+                // skipping the QMetaObject invocation and the listener thread's event loop
+                if (matchingNode) {
+                    matchingNode->recordBytesReceived(receivedMessage->getSize());
+                }
+
+                listener.function(receivedMessage, matchingNode);
+                return;
+            }
+
             bool success = false;
 
             Qt::ConnectionType connectionType;
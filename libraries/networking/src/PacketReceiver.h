@@ -13,6 +13,7 @@
 #ifndef hifi_PacketReceiver_h
 #define hifi_PacketReceiver_h
 
+#include <functional>
 #include <vector>
 #include <unordered_map>
 
@@ -44,7 +45,8 @@ class PacketReceiver : public QObject {
     Q_OBJECT
 public:
     using PacketTypeList = std::vector<PacketType>;
-    
+    using ListenerFunction = std::function<void(QSharedPointer<ReceivedMessage>, SharedNodePointer)>;
+
     PacketReceiver(QObject* parent = 0);
     PacketReceiver(const PacketReceiver&) = delete;
 
@@ -62,6 +64,14 @@ public:
     // for the message is received.
     bool registerListener(PacketType type, QObject* listener, const char* slot, bool deliverPending = false);
     bool registerListenerForTypes(PacketTypeList types, QObject* listener, const char* slot);
+
+    // Function listeners are invoked on the networking thread with no QMetaObject machinery or event
+    // loop hop in between - they are for high-rate packet types and should do no more than hand the
+    // message off to the listener's own processing queue. The listener object is only used to tie the
+    // registration's lifetime to an owner for unregisterListener.
+    void registerFunctionListener(PacketType type, QObject* listener, ListenerFunction function, bool deliverPending = false);
+    void registerFunctionListenerForTypes(PacketTypeList types, QObject* listener, ListenerFunction function);
+
     void unregisterListener(QObject* listener);
     
     void handleVerifiedPacket(std::unique_ptr<udt::Packet> packet);
@@ -73,6 +83,7 @@ private:
         QPointer<QObject> object;
         QMetaMethod method;
         bool deliverPending;
+        ListenerFunction function; // when set, dispatch calls this instead of invoking the method
     };
 
     void handleVerifiedMessage(QSharedPointer<ReceivedMessage> message, bool justReceived);
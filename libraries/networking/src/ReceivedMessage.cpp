@@ -32,15 +32,20 @@ ReceivedMessage::ReceivedMessage(const NLPacketList& packetList)
 }
 
 ReceivedMessage::ReceivedMessage(NLPacket& packet)
-    : _data(packet.readAll()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
-      _numPackets(1),
+    : _numPackets(1),
       _sourceID(packet.getSourceID()),
       _packetType(packet.getType()),
       _packetVersion(packet.getVersion()),
       _senderSockAddr(packet.getSenderSockAddr()),
       _isComplete(packet.getPacketPosition() == NLPacket::ONLY)
 {
+    // adopt the packet's buffer rather than copying the payload out of it - _data wraps the
+    // adopted memory, so QByteArrays handed out by this message must not outlive it
+    qint64 payloadOffset = (packet.getPayload() - packet.getData()) + packet.pos();
+    qint64 payloadSize = packet.getPayloadSize() - packet.pos();
+    _rawPacketData = packet.releasePacketData();
+    _data = QByteArray::fromRawData(_rawPacketData.get() + payloadOffset, payloadSize);
+    _headData = _data.mid(0, HEAD_DATA_SIZE);
 }
 
 void ReceivedMessage::setFailed() {
@@ -16,6 +16,7 @@
 #include <QObject>
 
 #include <atomic>
+#include <memory>
 
 #include "NLPacketList.h"
 
@@ -25,6 +26,8 @@ public:
     ReceivedMessage(const NLPacketList& packetList);
     ReceivedMessage(NLPacket& packet);
 
+    // NOTE: for single packet messages the returned QByteArray wraps memory owned by this
+    // ReceivedMessage, so it (and copies of it) must not outlive the message
     QByteArray getMessage() const { return _data; }
     const char* getRawMessage() const { return _data.constData(); }
 
@@ -85,6 +88,10 @@ private slots:
     void onComplete();
 
 private:
+    // for single packet messages, the packet buffer adopted from the NLPacket - _data wraps
+    // this memory without owning it (until a multi-packet append forces a detach)
+    std::unique_ptr<char[]> _rawPacketData;
+
     QByteArray _data;
     QByteArray _headData;
 
@@ -18,6 +18,7 @@
 #include <SharedUtil.h>
 #include <assert.h>
 
+#include "ContentVersionManifest.h"
 #include "NetworkAccessManager.h"
 #include "NetworkLogging.h"
 #include "NodeList.h"
@@ -93,29 +94,67 @@ void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
     }
 }
 
-QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
-    // look for the highest priority pending request
-    int highestIndex = -1;
-    float highestPriority = -FLT_MAX;
-    QSharedPointer<Resource> highestResource;
+bool ResourceCacheSharedItems::removePendingRequest(QWeakPointer<Resource> staleRequest) {
     Lock lock(_mutex);
 
+    bool removed = false;
     for (int i = 0; i < _pendingRequests.size();) {
-        // Clear any freed resources
-        auto resource = _pendingRequests.at(i).lock();
-        if (!resource) {
+        auto request = _pendingRequests.at(i);
+        // Clear our resource and any freed resources
+        if (!request || request.data() == staleRequest.data()) {
+            removed = removed || (request.data() == staleRequest.data());
             _pendingRequests.removeAt(i);
             continue;
         }
+        i++;
+    }
+    return removed;
+}
 
-        // Check load priority
-        float priority = resource->getLoadPriority();
-        if (priority >= highestPriority) {
-            highestPriority = priority;
-            highestIndex = i;
-            highestResource = resource;
+QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
+    int highestIndex = -1;
+    QSharedPointer<Resource> highestResource;
+    Lock lock(_mutex);
+
+    // Tally how many of the active download slots each resource type currently holds,
+    // so one type (on domain entry, usually textures) cannot monopolize the connection
+    // while the model right in front of the user waits at the back of the queue.
+    QHash<QString, int> activeRequestsByType;
+    foreach (const auto& weakActiveRequest, _loadingRequests) {
+        auto activeRequest = weakActiveRequest.lock();
+        if (activeRequest) {
+            ++activeRequestsByType[activeRequest->getType()];
+        }
+    }
+    int perTypeShare = qMax(1, ResourceCache::getRequestLimit() / 2);
+
+    // Look for the highest priority pending request, in two passes: first consider only
+    // resources whose type is still below its share of the slots; if every pending type
+    // is over its share, fall back to a plain priority pick.
+    for (int pass = 0; pass < 2 && highestIndex < 0; pass++) {
+        float highestPriority = -FLT_MAX;
+        for (int i = 0; i < _pendingRequests.size();) {
+            // Clear any freed resources
+            auto resource = _pendingRequests.at(i).lock();
+            if (!resource) {
+                _pendingRequests.removeAt(i);
+                continue;
+            }
+
+            if (pass == 0 && activeRequestsByType.value(resource->getType()) >= perTypeShare) {
+                i++;
+                continue;
+            }
+
+            // Check load priority
+            float priority = resource->getLoadPriority();
+            if (priority >= highestPriority) {
+                highestPriority = priority;
+                highestIndex = i;
+                highestResource = resource;
+            }
+            i++;
         }
-        i++;
     }
 
     if (highestIndex >= 0) {
@@ -370,6 +409,16 @@ void ResourceCache::setUnusedResourceCacheSize(qint64 unusedResourcesMaxSize) {
 }
 
 void ResourceCache::addUnusedResource(const QSharedPointer<Resource>& resource) {
+    // Nobody references this resource anymore - if its download is still waiting for a
+    // slot (the item left the view before the request went out), cancel it rather than
+    // spending bandwidth on it. It re-queues through ensureLoading if it's wanted again.
+    if (!resource->isLoaded() && !resource->isFailed() && resource->_startedLoading) {
+        auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+        if (sharedItems->removePendingRequest(resource)) {
+            resource->_startedLoading = false;
+        }
+    }
+
     // If it doesn't fit or its size is unknown, remove it from the cache.
     if (resource->getBytes() == 0 || resource->getBytes() > _unusedResourcesMaxSize) {
         resource->setCache(nullptr);
@@ -546,9 +595,16 @@ void Resource::setLoadPriorities(const QHash<QPointer<QObject>, float>& prioriti
     }
 }
 
+void Resource::setLoadPriorityOperator(const QPointer<QObject>& owner, std::function<float()> priorityOperator) {
+    if (!(_failedToLoad || _loaded)) {
+        _loadPriorityOperators.insert(owner, priorityOperator);
+    }
+}
+
 void Resource::clearLoadPriority(const QPointer<QObject>& owner) {
     if (!(_failedToLoad || _loaded)) {
         _loadPriorities.remove(owner);
+        _loadPriorityOperators.remove(owner);
     }
 }
 
@@ -562,6 +618,17 @@ float Resource::getLoadPriority() {
         highestPriority = qMax(highestPriority, it.value());
         it++;
     }
+    // Operators are re-evaluated on every call, so scores based on distance or screen
+    // size stay current as the camera moves.
+    for (QHash<QPointer<QObject>, std::function<float()>>::iterator it = _loadPriorityOperators.begin();
+            it != _loadPriorityOperators.end(); ) {
+        if (it.key().isNull()) {
+            it = _loadPriorityOperators.erase(it);
+            continue;
+        }
+        highestPriority = qMax(highestPriority, it.value()());
+        it++;
+    }
     return highestPriority;
 }
 
@@ -643,6 +710,7 @@ void Resource::finishedLoading(bool success) {
         _failedToLoad = true;
     }
     _loadPriorities.clear();
+    _loadPriorityOperators.clear();
     emit finished(success);
 }
 
@@ -676,6 +744,10 @@ void Resource::makeRequest() {
         return;
     }
     
+    // if the domain's content manifest pins this URL to the version we have cached,
+    // the request can serve the cache entry without a revalidation round trip
+    _request->setCacheVerified(ContentVersionManifest::isCacheValidated(_activeUrl));
+
     qCDebug(resourceLog).noquote() << "Starting request for:" << _url.toDisplayString();
     emit loading();
 
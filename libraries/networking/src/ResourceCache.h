@@ -13,6 +13,7 @@
 #define hifi_ResourceCache_h
 
 #include <atomic>
+#include <functional>
 #include <mutex>
 
 #include <QtCore/QHash>
@@ -69,6 +70,7 @@ public:
     void appendPendingRequest(QWeakPointer<Resource> newRequest);
     void appendActiveRequest(QWeakPointer<Resource> newRequest);
     void removeRequest(QWeakPointer<Resource> doneRequest);
+    bool removePendingRequest(QWeakPointer<Resource> staleRequest);
     QList<QSharedPointer<Resource>> getPendingRequests();
     uint32_t getPendingRequestsCount() const;
     QList<QSharedPointer<Resource>> getLoadingRequests();
@@ -356,10 +358,15 @@ public:
 
     /// Sets the load priority for one owner.
     virtual void setLoadPriority(const QPointer<QObject>& owner, float priority);
-    
+
     /// Sets a set of priorities at once.
     virtual void setLoadPriorities(const QHash<QPointer<QObject>, float>& priorities);
-    
+
+    /// Sets a function used to compute the load priority for one owner at scheduling time,
+    /// so a score based on distance or screen size tracks the camera while the request
+    /// waits in the queue instead of being frozen at request time.
+    virtual void setLoadPriorityOperator(const QPointer<QObject>& owner, std::function<float()> priorityOperator);
+
     /// Clears the load priority for one owner.
     virtual void clearLoadPriority(const QPointer<QObject>& owner);
     
@@ -446,6 +453,7 @@ protected:
     bool _failedToLoad = false;
     bool _loaded = false;
     QHash<QPointer<QObject>, float> _loadPriorities;
+    QHash<QPointer<QObject>, std::function<float()>> _loadPriorityOperators;
     QWeakPointer<Resource> _self;
     QPointer<ResourceCache> _cache;
     
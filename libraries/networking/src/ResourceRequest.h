@@ -49,6 +49,10 @@ public:
 
     void setCacheEnabled(bool value) { _cacheEnabled = value; }
 
+    // a request whose URL the domain content manifest vouches for may serve its disk
+    // cache entry without a conditional revalidation round trip
+    void setCacheVerified(bool value) { _cacheVerified = value; }
+
 public slots:
     void send();
 
@@ -64,6 +68,7 @@ protected:
     Result _result;
     QByteArray _data;
     bool _cacheEnabled { true };
+    bool _cacheVerified { false };
     bool _loadedFromCache { false };
 };
 
@@ -15,6 +15,7 @@
 #include <QtCore/QTimer>
 
 #include <LogHandler.h>
+#include <ResourceGovernor.h>
 
 #include "ThreadedAssignment.h"
 
@@ -104,6 +105,12 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
 
     statsObject["io_stats"] = ioStats;
 
+    // report budget vs usage for this process when a resource governor is running,
+    // so an orchestrator can rebalance assignments across boxes
+    if (DependencyManager::isSet<ResourceGovernor>()) {
+        statsObject["resource_usage"] = DependencyManager::get<ResourceGovernor>()->getStatsObject();
+    }
+
     nodeList->sendStatsToDomainServer(statsObject);
 }
 
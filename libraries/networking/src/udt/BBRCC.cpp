@@ -0,0 +1,283 @@
+//
+//  BBRCC.cpp
+//  libraries/networking/src/udt
+//
+//  Created by Stephen Birarda on 2017-01-10.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BBRCC.h"
+
+#include <QtCore/QtGlobal>
+
+using namespace udt;
+using namespace std::chrono;
+
+static const double USECS_PER_SECOND = 1000000.0;
+
+// 2 / ln(2) - the smallest gain that doubles the sending rate every round trip,
+// so startup fills the pipe as fast as slow start does
+static const double STARTUP_GAIN = 2.885;
+static const double DRAIN_GAIN = 1.0 / STARTUP_GAIN;
+
+// in steady state we spend one rtprop probing above the estimated bandwidth, one draining
+// the queue that may have built, and six cruising at the estimate
+static const double PROBE_BW_GAINS[] = { 1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+static const int NUM_PROBE_BW_PHASES = 8;
+static const double PROBE_BW_CWND_GAIN = 2.0;
+
+// startup is considered done when btlbw has not grown by at least 25% for three round trips
+static const double FULL_BW_GROWTH_THRESHOLD = 1.25;
+static const int FULL_BW_ROUND_LIMIT = 3;
+
+static const int BTLBW_WINDOW_RTTS = 10; // btlbw filter window, in round trips
+static const microseconds RTPROP_WINDOW { 10000000 }; // rtprop is considered stale after 10s
+static const microseconds PROBE_RTT_DURATION { 200000 }; // how long to dwell at the reduced window
+static const int PROBE_RTT_CWND = 4; // packets in flight while re-measuring rtprop
+
+static const int MIN_CONGESTION_WINDOW = 4;
+
+BBRCC::BBRCC() {
+    _mss = udt::MAX_PACKET_SIZE_WITH_UDP_HEADER;
+
+    // until the first delivery rate sample arrives we are window limited, like slow start
+    _packetSendPeriod = 0.0;
+    _congestionWindowSize = 16;
+
+    setAckInterval(1); // per packet ACKs provide the delivery rate samples that drive the btlbw filter
+
+    _pacingGain = STARTUP_GAIN;
+    _cwndGain = STARTUP_GAIN;
+
+    // set min RTT to the maximum possible value until we collect a sample
+    _rtProp = std::numeric_limits<int>::max();
+
+    auto now = p_high_resolution_clock::now();
+    _rtPropTime = now;
+    _lastACKTime = now;
+    _phaseStartTime = now;
+}
+
+bool BBRCC::onACK(SequenceNumber ack, p_high_resolution_clock::time_point receiveTime) {
+    if (ack <= _lastACK) {
+        // a duplicate ACK makes no forward progress - the model only updates on newly delivered packets
+        // and loss recovery is handled by the NAK machinery
+        return false;
+    }
+
+    auto now = p_high_resolution_clock::now();
+
+    // grab an RTT sample if we have the send time for the ACKed packet
+    auto it = _sentPacketTimes.find(ack);
+    if (it != _sentPacketTimes.end()) {
+        int lastRTT = duration_cast<microseconds>(receiveTime - it->second).count();
+
+        const int MAX_RTT_SAMPLE_MICROSECONDS = 10000000;
+
+        if (lastRTT < 0) {
+            Q_ASSERT_X(false, __FUNCTION__, "calculated an RTT that is not > 0");
+            return false;
+        } else if (lastRTT == 0) {
+            // we do not allow a zero microsecond RTT
+            lastRTT = 1;
+        } else if (lastRTT > MAX_RTT_SAMPLE_MICROSECONDS) {
+            // cap the lastRTT to avoid overflows in window size calculations
+            lastRTT = MAX_RTT_SAMPLE_MICROSECONDS;
+        }
+
+        updateRoundTripEstimates(lastRTT, now);
+    }
+
+    // seqlen is inclusive of both ends, so the number of newly ACKed packets is one less
+    int packetsACKed = seqlen(_lastACK, ack) - 1;
+    _lastACK = ack;
+
+    // all sent times at or before this ACK are no longer needed
+    _sentPacketTimes.erase(_sentPacketTimes.begin(), _sentPacketTimes.upper_bound(ack));
+
+    updateBtlBw(packetsACKed, now);
+    updateStateMachine(now);
+    applyControl();
+
+    // no fast re-transmit - the receiver NAKs losses and the send queue re-sends from its NAK list
+    return false;
+}
+
+void BBRCC::updateRoundTripEstimates(int rttSample, p_high_resolution_clock::time_point now) {
+    if (_ewmaRTT == -1) {
+        // first RTT sample
+        _ewmaRTT = rttSample;
+    } else {
+        // Jacobson's EWMA RTT estimation, matching the alpha used elsewhere in udt
+        static const int RTT_ESTIMATION_ALPHA = 8;
+        _ewmaRTT = (_ewmaRTT * (RTT_ESTIMATION_ALPHA - 1) + rttSample) / RTT_ESTIMATION_ALPHA;
+    }
+
+    // rtprop is a windowed min - take any sample at or below the current value, and
+    // take a larger sample once the current value has gone stale
+    if (rttSample <= _rtProp || now - _rtPropTime > RTPROP_WINDOW) {
+        _rtProp = rttSample;
+        _rtPropTime = now;
+    }
+}
+
+void BBRCC::updateBtlBw(int packetsACKed, p_high_resolution_clock::time_point now) {
+    int elapsed = duration_cast<microseconds>(now - _lastACKTime).count();
+    _lastACKTime = now;
+
+    if (packetsACKed <= 0 || elapsed <= 0) {
+        return;
+    }
+
+    // delivery rate sample for this ACK, in packets per second
+    int sample = (int) (packetsACKed * USECS_PER_SECOND / elapsed);
+
+    // the filter window covers several round trips so that one pass of the 0.75 ProbeBW phase
+    // cannot drag the estimate down
+    microseconds window { (int64_t) BTLBW_WINDOW_RTTS * std::max(_ewmaRTT, synInterval()) };
+
+    // expire samples that have fallen out of the window
+    while (!_btlBwSamples.empty() && now - _btlBwSamples.front().first > window) {
+        _btlBwSamples.pop_front();
+    }
+
+    // drop samples dominated by this one so the deque stays in decreasing order and
+    // the windowed max is always at the front
+    while (!_btlBwSamples.empty() && _btlBwSamples.back().second <= sample) {
+        _btlBwSamples.pop_back();
+    }
+
+    _btlBwSamples.emplace_back(now, sample);
+    _btlBw = _btlBwSamples.front().second;
+}
+
+void BBRCC::updateStateMachine(p_high_resolution_clock::time_point now) {
+    bool roundStart = false;
+    if (_lastACK > _roundTripEnd) {
+        // everything in flight at the start of this round has now been ACKed
+        _roundTripEnd = _sendCurrSeqNum;
+        roundStart = true;
+    }
+
+    // if rtprop has gone stale, cut packets in flight so queues drain and it can be re-measured
+    if (_state != ProbeRTT && now - _rtPropTime > RTPROP_WINDOW) {
+        _state = ProbeRTT;
+        _pacingGain = 1.0;
+        _cwndGain = 1.0;
+        _phaseStartTime = now;
+        return;
+    }
+
+    switch (_state) {
+        case Startup:
+            if (roundStart) {
+                if (_btlBw > _fullBwBaseline * FULL_BW_GROWTH_THRESHOLD) {
+                    // still growing - reset the plateau check
+                    _fullBwBaseline = _btlBw;
+                    _roundsWithoutGrowth = 0;
+                } else if (++_roundsWithoutGrowth >= FULL_BW_ROUND_LIMIT) {
+                    // btlbw has plateaued, the pipe is full - drain the queue startup built
+                    _filledPipe = true;
+                    _state = Drain;
+                    _pacingGain = DRAIN_GAIN;
+                    _cwndGain = STARTUP_GAIN;
+                }
+            }
+            break;
+
+        case Drain:
+            if (packetsInFlight() <= estimatedBDP()) {
+                enterProbeBW(now);
+            }
+            break;
+
+        case ProbeBW:
+            // advance the gain cycle once per rtprop
+            if (duration_cast<microseconds>(now - _phaseStartTime).count() >= std::max(_rtProp, synInterval())) {
+                _probeBWPhase = (_probeBWPhase + 1) % NUM_PROBE_BW_PHASES;
+                _pacingGain = PROBE_BW_GAINS[_probeBWPhase];
+                _phaseStartTime = now;
+            }
+            break;
+
+        case ProbeRTT:
+            if (now - _phaseStartTime >= PROBE_RTT_DURATION) {
+                // the dwell is over - consider rtprop fresh again and resume
+                _rtPropTime = now;
+
+                if (_filledPipe) {
+                    enterProbeBW(now);
+                } else {
+                    _state = Startup;
+                    _pacingGain = STARTUP_GAIN;
+                    _cwndGain = STARTUP_GAIN;
+                }
+            }
+            break;
+    }
+}
+
+void BBRCC::enterProbeBW(p_high_resolution_clock::time_point now) {
+    _state = ProbeBW;
+    _probeBWPhase = 0;
+    _pacingGain = PROBE_BW_GAINS[_probeBWPhase];
+    _cwndGain = PROBE_BW_CWND_GAIN;
+    _phaseStartTime = now;
+}
+
+int BBRCC::estimatedBDP() const {
+    if (_rtProp == std::numeric_limits<int>::max()) {
+        // no RTT sample yet, no meaningful BDP estimate
+        return 0;
+    }
+
+    return (int) ((int64_t) _btlBw * _rtProp / USECS_PER_SECOND);
+}
+
+void BBRCC::applyControl() {
+    if (_btlBw > 0) {
+        // pace sends at the current gain times the estimated bottleneck bandwidth
+        setPacketSendPeriod(USECS_PER_SECOND / (_pacingGain * _btlBw));
+    }
+
+    int window = (int) (_cwndGain * estimatedBDP());
+
+    if (_state == Startup) {
+        // while filling the pipe never shrink the window - the BDP estimate lags behind delivery
+        window = std::max(window, _congestionWindowSize);
+    } else if (_state == ProbeRTT) {
+        // keep almost nothing in flight so queues empty and rtprop can be observed
+        window = std::min(window, PROBE_RTT_CWND);
+    }
+
+    _congestionWindowSize = std::max(window, MIN_CONGESTION_WINDOW);
+
+    if (_congestionWindowSize > udt::MAX_PACKETS_IN_FLIGHT) {
+        _congestionWindowSize = udt::MAX_PACKETS_IN_FLIGHT;
+    }
+}
+
+void BBRCC::onTimeout() {
+    // a timeout means everything in flight was lost or the path stalled - keep the btlbw filter
+    // (bandwidth history is still our best estimate) but re-enter startup with a minimal window
+    _sentPacketTimes.clear();
+
+    _filledPipe = false;
+    _fullBwBaseline = 0;
+    _roundsWithoutGrowth = 0;
+
+    _state = Startup;
+    _pacingGain = STARTUP_GAIN;
+    _cwndGain = STARTUP_GAIN;
+
+    _congestionWindowSize = MIN_CONGESTION_WINDOW;
+}
+
+void BBRCC::onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    if (_sentPacketTimes.find(seqNum) == _sentPacketTimes.end()) {
+        _sentPacketTimes[seqNum] = timePoint;
+    }
+}
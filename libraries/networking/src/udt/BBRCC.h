@@ -0,0 +1,100 @@
+//
+//  BBRCC.h
+//  libraries/networking/src/udt
+//
+//  Created by Stephen Birarda on 2017-01-10.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_BBRCC_h
+#define hifi_BBRCC_h
+
+#include <deque>
+#include <map>
+
+#include "CongestionControl.h"
+#include "Constants.h"
+
+namespace udt {
+
+// A rate based congestion control in the style of BBR. Instead of probing for loss (DefaultCC) or for
+// queueing delay (TCPVegasCC), it continuously estimates the bottleneck bandwidth (btlbw) from the ACK
+// stream and the round trip propagation delay (rtprop) from RTT samples, then paces sends at a gain
+// cycled multiple of btlbw while capping packets in flight to a multiple of the estimated
+// bandwidth-delay product. On long-fat links this keeps the pipe full where a delay based controller
+// backs off well before the link is saturated.
+class BBRCC : public CongestionControl {
+public:
+    BBRCC();
+
+    virtual bool onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) override;
+
+    // individual loss events do not change the model - loss recovery is left to the NAK machinery
+    virtual void onLoss(SequenceNumber rangeStart, SequenceNumber rangeEnd) override {};
+    virtual void onTimeout() override;
+
+    virtual bool shouldACK2() override { return false; }
+    virtual bool shouldProbe() override { return false; }
+
+    virtual int estimatedBtlBw() const override { return _btlBw; }
+
+    virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+
+protected:
+    virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) override { _lastACK = _roundTripEnd = seqNum - 1; }
+
+private:
+    enum State {
+        Startup, // fill the pipe quickly by growing the send rate exponentially
+        Drain, // drain the queue that startup built before settling at the estimated rate
+        ProbeBW, // steady state - cycle the pacing gain around 1.0 to track bandwidth changes
+        ProbeRTT // periodically cut packets in flight so queues empty and rtprop can be re-measured
+    };
+
+    void updateRoundTripEstimates(int rttSample, p_high_resolution_clock::time_point now);
+    void updateBtlBw(int packetsACKed, p_high_resolution_clock::time_point now);
+    void updateStateMachine(p_high_resolution_clock::time_point now);
+    void applyControl();
+
+    int estimatedBDP() const; // estimated bandwidth-delay product, in packets
+    int packetsInFlight() const { return seqlen(_lastACK, _sendCurrSeqNum) - 1; }
+
+    void enterProbeBW(p_high_resolution_clock::time_point now);
+
+    using PacketTimeList = std::map<SequenceNumber, p_high_resolution_clock::time_point>;
+    PacketTimeList _sentPacketTimes; // Map of sequence numbers to sent time
+
+    State _state { Startup };
+
+    double _pacingGain; // current multiple of btlbw used to pace sends
+    double _cwndGain; // current multiple of the BDP used to cap packets in flight
+
+    int _btlBw { 0 }; // windowed max of delivery rate samples, in packets per second
+    std::deque<std::pair<p_high_resolution_clock::time_point, int>> _btlBwSamples; // decreasing maxima and their sample times
+
+    int _rtProp; // windowed min of RTT samples, in microseconds
+    p_high_resolution_clock::time_point _rtPropTime; // when _rtProp was last lowered or refreshed
+
+    int _ewmaRTT { -1 }; // Exponential weighted moving average RTT, sizes the btlbw filter window
+
+    SequenceNumber _lastACK; // Sequence number of last packet that was ACKed
+    p_high_resolution_clock::time_point _lastACKTime; // arrival time of the last rate sampled ACK
+
+    SequenceNumber _roundTripEnd; // ACK of this sequence number marks the end of the current round trip
+
+    int _fullBwBaseline { 0 }; // btlbw at the start of the current startup growth check
+    int _roundsWithoutGrowth { 0 }; // consecutive round trips without significant btlbw growth
+    bool _filledPipe { false }; // marker for having seen btlbw plateau (the pipe is full)
+
+    int _probeBWPhase { 0 }; // index into the pacing gain cycle while in ProbeBW
+    p_high_resolution_clock::time_point _phaseStartTime; // start of the current ProbeBW phase or ProbeRTT dwell
+};
+
+}
+
+#endif // hifi_BBRCC_h
@@ -152,6 +152,14 @@ QByteArray BasePacket::readWithoutCopy(qint64 maxSize) {
     return data;
 }
 
+std::unique_ptr<char[]> BasePacket::releasePacketData() {
+    _packetSize = 0;
+    _payloadStart = nullptr;
+    _payloadCapacity = 0;
+    _payloadSize = 0;
+    return std::move(_packet);
+}
+
 qint64 BasePacket::writeString(const QString& string) {
     QByteArray data = string.toUtf8();
     uint32_t length = data.length();
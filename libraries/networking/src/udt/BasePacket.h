@@ -80,6 +80,10 @@ public:
     QByteArray read(qint64 maxSize);
     QByteArray readWithoutCopy(qint64 maxSize); // this can only be used if packet will stay in scope
 
+    // Releases ownership of the allocated memory to the caller, leaving this packet empty.
+    // Used to hand a received packet's bytes off (e.g. to a ReceivedMessage) without copying them.
+    std::unique_ptr<char[]> releasePacketData();
+
     qint64 writeString(const QString& string);
     QString readString();
 
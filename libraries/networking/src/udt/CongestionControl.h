@@ -51,6 +51,10 @@ public:
     virtual bool shouldACK2() { return true; }
     virtual bool shouldProbe() { return true; }
 
+    // estimated bottleneck bandwidth, in packets per second - the default is the bandwidth reported
+    // by the receiver, controllers that build their own estimate (like BBRCC) override this
+    virtual int estimatedBtlBw() const { return _bandwidth; }
+
     virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {}
 protected:
     void setAckInterval(int ackInterval) { _ackInterval = ackInterval; }
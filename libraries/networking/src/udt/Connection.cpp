@@ -99,6 +99,15 @@ void Connection::setMaxBandwidth(int maxBandwidth) {
     _congestionControl->setMaxBandwidth(maxBandwidth);
 }
 
+ConnectionStats::Stats Connection::sampleStats() {
+    if (_sendQueue) {
+        // fold the send queue's pacing adherence counts into the stats before sampling
+        _stats.recordPacedSends(_sendQueue->getAndResetPacedSends(), _sendQueue->getAndResetLateSends());
+    }
+
+    return _stats.sample();
+}
+
 SendQueue& Connection::getSendQueue() {
     if (!_sendQueue) {
 
@@ -122,7 +131,7 @@ SendQueue& Connection::getSendQueue() {
 
         
         // set defaults on the send queue from our congestion control object and estimatedTimeout()
-        _sendQueue->setPacketSendPeriod(_congestionControl->_packetSendPeriod);
+        _sendQueue->setPacketSendPeriod(currentPacketSendPeriod());
         _sendQueue->setSyncInterval(_synInterval);
         _sendQueue->setEstimatedTimeout(estimatedTimeout());
         _sendQueue->setFlowWindowSize(std::min(_flowWindowSize, (int) _congestionControl->_congestionWindowSize));
@@ -929,6 +938,21 @@ int Connection::estimatedTimeout() const {
     return _congestionControl->_userDefinedRTO ? _congestionControl->_rto : _rtt + _rttVariance * 4;
 }
 
+double Connection::currentPacketSendPeriod() const {
+    double sendPeriod = _congestionControl->_packetSendPeriod;
+
+    if (sendPeriod == 0.0) {
+        // the congestion control is purely window limited (like TCPVegasCC) - without pacing an
+        // entire congestion window can leave in one microburst, overflowing the shallow queues of
+        // home routers and wifi gear and causing avoidable loss. Spread the window across half the
+        // estimated RTT, which stays well ahead of the ACK clock so window growth is never throttled.
+        int windowSize = std::max(1, std::min(_flowWindowSize, (int) _congestionControl->_congestionWindowSize));
+        sendPeriod = (double) _rtt / (2 * windowSize);
+    }
+
+    return sendPeriod;
+}
+
 void Connection::updateCongestionControlAndSendQueue(std::function<void ()> congestionCallback) {
     // update the last sent sequence number in congestion control
     _congestionControl->setSendCurrentSequenceNumber(getSendQueue().getCurrentSequenceNumber());
@@ -937,15 +961,23 @@ void Connection::updateCongestionControlAndSendQueue(std::function<void ()> cong
     congestionCallback();
     
     auto& sendQueue = getSendQueue();
-    
+
+    double sendPeriod = currentPacketSendPeriod();
+
     // now that we've updated the congestion control, update the packet send period and flow window size
-    sendQueue.setPacketSendPeriod(_congestionControl->_packetSendPeriod);
+    sendQueue.setPacketSendPeriod(sendPeriod);
     sendQueue.setEstimatedTimeout(estimatedTimeout());
     sendQueue.setFlowWindowSize(std::min(_flowWindowSize, (int) _congestionControl->_congestionWindowSize));
-    
+
     // record connection stats
-    _stats.recordPacketSendPeriod(_congestionControl->_packetSendPeriod);
+    _stats.recordPacketSendPeriod(sendPeriod);
     _stats.recordCongestionWindowSize(_congestionControl->_congestionWindowSize);
+
+    // record the pacing rate and bottleneck bandwidth estimate so controllers can be compared in the field
+    if (sendPeriod > 0.0) {
+        _stats.recordPacingRate((int) (USECS_PER_SECOND / sendPeriod));
+    }
+    _stats.recordBtlBw(_congestionControl->estimatedBtlBw());
 }
 
 void PendingReceivedMessage::enqueuePacket(std::unique_ptr<Packet> packet) {
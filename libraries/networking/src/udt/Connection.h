@@ -71,7 +71,7 @@ public:
 
     void queueReceivedMessagePacket(std::unique_ptr<Packet> packet);
     
-    ConnectionStats::Stats sampleStats() { return _stats.sample(); }
+    ConnectionStats::Stats sampleStats();
     
     bool isActive() const { return _isActive; }
 
@@ -119,7 +119,8 @@ private:
     void updateRTT(int rtt);
     
     int estimatedTimeout() const;
-    
+    double currentPacketSendPeriod() const;
+
     void updateCongestionControlAndSendQueue(std::function<void()> congestionCallback);
     
     void stopSendQueue();
@@ -112,3 +112,21 @@ void ConnectionStats::recordPacketSendPeriod(int sample) {
     _currentSample.packetSendPeriod = sample;
     _total.packetSendPeriod = (int)((_total.packetSendPeriod * EWMA_PREVIOUS_SAMPLES_WEIGHT) + (sample * EWMA_CURRENT_SAMPLE_WEIGHT));
 }
+
+void ConnectionStats::recordPacingRate(int sample) {
+    _currentSample.pacingRate = sample;
+    _total.pacingRate = (int)((_total.pacingRate * EWMA_PREVIOUS_SAMPLES_WEIGHT) + (sample * EWMA_CURRENT_SAMPLE_WEIGHT));
+}
+
+void ConnectionStats::recordBtlBw(int sample) {
+    _currentSample.btlBw = sample;
+    _total.btlBw = (int)((_total.btlBw * EWMA_PREVIOUS_SAMPLES_WEIGHT) + (sample * EWMA_CURRENT_SAMPLE_WEIGHT));
+}
+
+void ConnectionStats::recordPacedSends(int pacedSends, int lateSends) {
+    _currentSample.pacedSends += pacedSends;
+    _total.pacedSends += pacedSends;
+
+    _currentSample.lateSends += lateSends;
+    _total.lateSends += lateSends;
+}
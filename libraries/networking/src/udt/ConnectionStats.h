@@ -69,6 +69,13 @@ public:
         int rtt { 0 };
         int congestionWindowSize { 0 };
         int packetSendPeriod { 0 };
+        int pacingRate { 0 }; // packets per second the congestion control is pacing sends at
+        int btlBw { 0 }; // congestion control's bottleneck bandwidth estimate, packets per second
+
+        // pacing adherence - how many sends the send queue paced and how many of those
+        // missed their deadline and went out as part of a catch-up burst
+        int pacedSends { 0 };
+        int lateSends { 0 };
         
         // TODO: Remove once Win build supports brace initialization: `Events events {{ 0 }};`
         Stats() { events.fill(0); }
@@ -93,6 +100,9 @@ public:
     void recordRTT(int sample);
     void recordCongestionWindowSize(int sample);
     void recordPacketSendPeriod(int sample);
+    void recordPacingRate(int sample);
+    void recordBtlBw(int sample);
+    void recordPacedSends(int pacedSends, int lateSends);
     
 private:
     Stats _currentSample;
@@ -46,7 +46,10 @@ void LossList::append(SequenceNumber start, SequenceNumber end) {
 void LossList::insert(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::insert(SequenceNumber, SequenceNumber)", "Range start greater than range end");
-    
+
+    // this may merge and erase ranges, so the cached remove hint cannot be trusted afterwards
+    _removeHintValid = false;
+
     auto it = find_if_not(_lossList.begin(), _lossList.end(), [&start](pair<SequenceNumber, SequenceNumber> pair){
         return pair.second < start;
     });
@@ -86,13 +89,21 @@ void LossList::insert(SequenceNumber start, SequenceNumber end) {
 }
 
 bool LossList::remove(SequenceNumber seq) {
-    auto it = find_if(_lossList.begin(), _lossList.end(), [&seq](pair<SequenceNumber, SequenceNumber> pair) {
+    auto from = _lossList.begin();
+
+    if (_removeHintValid && _removeHint->first <= seq) {
+        // the list is ordered, so when the cached range does not start past seq any match is at
+        // or after it and the ranges in front of it can be skipped entirely
+        from = _removeHint;
+    }
+
+    auto it = find_if(from, _lossList.end(), [&seq](pair<SequenceNumber, SequenceNumber> pair) {
         return pair.first <= seq && seq <= pair.second;
     });
-    
+
     if (it != end(_lossList)) {
         if (it->first == it->second) {
-            _lossList.erase(it);
+            it = _lossList.erase(it);
         } else if (seq == it->first) {
             ++it->first;
         } else if (seq == it->second) {
@@ -100,10 +111,14 @@ bool LossList::remove(SequenceNumber seq) {
         } else {
             auto temp = it->second;
             it->second = seq - 1;
-            _lossList.insert(++it, make_pair(seq + 1, temp));
+            it = _lossList.insert(++it, make_pair(seq + 1, temp));
         }
         _length -= 1;
-        
+
+        // remember where this remove landed so the next one can start its scan there
+        _removeHint = it;
+        _removeHintValid = (it != _lossList.end());
+
         // this sequence number was found in the loss list, return true
         return true;
     } else {
@@ -115,6 +130,10 @@ bool LossList::remove(SequenceNumber seq) {
 void LossList::remove(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::remove(SequenceNumber, SequenceNumber)", "Range start greater than range end");
+
+    // this may erase ranges, so the cached remove hint cannot be trusted afterwards
+    _removeHintValid = false;
+
     // Find the first segment sharing sequence numbers
     auto it = find_if(_lossList.begin(), _lossList.end(), [&start, &end](pair<SequenceNumber, SequenceNumber> pair) {
         return (pair.first <= start && start <= pair.second) || (start <= pair.first && pair.first <= end);
@@ -23,29 +23,37 @@ class ControlPacket;
 class LossList {
 public:
     LossList() {}
-    
-    void clear() { _length = 0; _lossList.clear(); }
-    
+
+    void clear() { _length = 0; _lossList.clear(); _removeHintValid = false; }
+
     // must always add at the end - faster than insert
     void append(SequenceNumber seq);
     void append(SequenceNumber start, SequenceNumber end);
-    
+
     // inserts anywhere - MUCH slower
     void insert(SequenceNumber start, SequenceNumber end);
-    
+
     bool remove(SequenceNumber seq);
     void remove(SequenceNumber start, SequenceNumber end);
-    
+
     int getLength() const { return _length; }
     bool isEmpty() const { return _length == 0; }
     SequenceNumber getFirstSequenceNumber() const;
     SequenceNumber popFirstSequenceNumber();
-    
+
     void write(ControlPacket& packet, int maxPairs = -1);
-    
+
 private:
-    std::list<std::pair<SequenceNumber, SequenceNumber>> _lossList;
+    using RangeList = std::list<std::pair<SequenceNumber, SequenceNumber>>;
+
+    RangeList _lossList;
     int _length { 0 };
+
+    // cache of the last range touched by a single sequence number remove - retransmitted packets
+    // arrive roughly in NAK list order, so the next remove usually lands in or just after the
+    // same range and the scan can start there instead of at the front of the list
+    RangeList::iterator _removeHint;
+    bool _removeHintValid { false };
 };
     
 }
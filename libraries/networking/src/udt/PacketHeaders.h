@@ -228,7 +228,8 @@ enum class AvatarMixerPacketVersion : PacketVersion {
     Unignore,
     ImmediateSessionDisplayNameUpdates,
     VariableAvatarData,
-    AvatarAsChildFixes
+    AvatarAsChildFixes,
+    CompressedBlendshapes
 };
 
 enum class DomainConnectRequestVersion : PacketVersion {
@@ -239,6 +240,11 @@ enum class DomainConnectRequestVersion : PacketVersion {
     HasMachineFingerprint
 };
 
+enum class DomainListRequestVersion : PacketVersion {
+    PreListVersionAck = 17,
+    HasListVersionAck
+};
+
 enum class DomainConnectionDeniedVersion : PacketVersion {
     ReasonMessageOnly = 17,
     IncludesReasonCode,
@@ -247,14 +253,21 @@ enum class DomainConnectionDeniedVersion : PacketVersion {
 
 enum class DomainServerAddedNodeVersion : PacketVersion {
     PrePermissionsGrid = 17,
-    PermissionsGrid
+    PermissionsGrid,
+    HasListVersion
+};
+
+enum class DomainServerRemovedNodeVersion : PacketVersion {
+    PreListVersion = 17,
+    HasListVersion
 };
 
 enum class DomainListVersion : PacketVersion {
     PrePermissionsGrid = 18,
     PermissionsGrid,
     GetUsernameFromUUIDSupport,
-    GetMachineFingerprintFromUUIDSupport
+    GetMachineFingerprintFromUUIDSupport,
+    HasListVersion
 };
 
 enum class AudioVersion : PacketVersion {
@@ -268,7 +281,8 @@ enum class AudioVersion : PacketVersion {
 };
 
 enum class MessageDataVersion : PacketVersion {
-    TextOrBinaryData = 18
+    TextOrBinaryData = 18,
+    CoalescedMessages = 19
 };
 
 #endif // hifi_PacketHeaders_h
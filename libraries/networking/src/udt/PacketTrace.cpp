@@ -0,0 +1,126 @@
+//
+//  PacketTrace.cpp
+//  libraries/networking/src/udt
+//
+//  Created by Clement on 1/12/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketTrace.h"
+
+#include <chrono>
+
+#include "../NetworkLogging.h"
+#include "Constants.h"
+#include "ControlPacket.h"
+
+using namespace udt;
+using namespace std::chrono;
+
+static const quint32 PACKET_TRACE_MAGIC = 0x48465452; // 'HFTR'
+static const quint32 PACKET_TRACE_VERSION = 1;
+
+bool PacketTraceRecorder::start(const QString& filePath) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_isRecording) {
+        qCWarning(networking) << "PacketTraceRecorder::start called while already recording - ignoring";
+        return false;
+    }
+
+    _file.setFileName(filePath);
+    if (!_file.open(QIODevice::WriteOnly)) {
+        qCWarning(networking) << "PacketTraceRecorder could not open" << filePath << "for writing";
+        return false;
+    }
+
+    _stream.setDevice(&_file);
+    _stream << PACKET_TRACE_MAGIC << PACKET_TRACE_VERSION;
+
+    _startTime = p_high_resolution_clock::now();
+    _isRecording = true;
+
+    qCDebug(networking) << "PacketTraceRecorder recording packet trace to" << filePath;
+
+    return true;
+}
+
+void PacketTraceRecorder::stop() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_isRecording) {
+        _isRecording = false;
+        _stream.setDevice(nullptr);
+        _file.close();
+    }
+}
+
+void PacketTraceRecorder::recordPacket(const char* data, int size, PacketTraceRecord::Direction direction) {
+    if (size < (int) sizeof(uint32_t)) {
+        // not enough data to hold a header, nothing worth recording
+        return;
+    }
+
+    PacketTraceRecord record;
+    record.direction = direction;
+    record.size = size;
+
+    // decode just the leading word of the header - enough to distinguish control from data
+    // packets and pull the control type or data sequence number
+    uint32_t firstWord = *reinterpret_cast<const uint32_t*>(data);
+
+    if (firstWord & CONTROL_BIT_MASK) {
+        record.isControl = 1;
+        record.controlType = (firstWord & ~CONTROL_BIT_MASK) >> (8 * sizeof(ControlPacket::Type));
+    } else {
+        record.sequenceNumber = firstWord & SEQUENCE_NUMBER_MASK;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_isRecording) {
+        // the trace was stopped while we were parsing the header
+        return;
+    }
+
+    record.timestamp = duration_cast<microseconds>(p_high_resolution_clock::now() - _startTime).count();
+
+    _stream << record.timestamp << record.direction << record.isControl
+        << record.controlType << record.sequenceNumber << record.size;
+}
+
+bool PacketTraceReader::open(const QString& filePath) {
+    _file.setFileName(filePath);
+    if (!_file.open(QIODevice::ReadOnly)) {
+        qCWarning(networking) << "PacketTraceReader could not open" << filePath << "for reading";
+        return false;
+    }
+
+    _stream.setDevice(&_file);
+
+    quint32 magic, version;
+    _stream >> magic >> version;
+
+    if (magic != PACKET_TRACE_MAGIC || version != PACKET_TRACE_VERSION) {
+        qCWarning(networking) << filePath << "is not a packet trace or has an unsupported version";
+        _stream.setDevice(nullptr);
+        _file.close();
+        return false;
+    }
+
+    return true;
+}
+
+bool PacketTraceReader::readNextRecord(PacketTraceRecord& record) {
+    if (!_file.isOpen() || _stream.atEnd()) {
+        return false;
+    }
+
+    _stream >> record.timestamp >> record.direction >> record.isControl
+        >> record.controlType >> record.sequenceNumber >> record.size;
+
+    return _stream.status() == QDataStream::Ok;
+}
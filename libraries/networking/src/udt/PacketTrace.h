@@ -0,0 +1,79 @@
+//
+//  PacketTrace.h
+//  libraries/networking/src/udt
+//
+//  Created by Clement on 1/12/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketTrace_h
+#define hifi_PacketTrace_h
+
+#include <atomic>
+#include <mutex>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include <PortableHighResolutionClock.h>
+
+namespace udt {
+
+// A wire-level trace of the datagrams flowing through a Socket, in a compact binary format.
+// One record is written per datagram with just enough of the header decoded (control bit,
+// control type or data sequence number) to replay or analyze a congestion control session offline.
+
+struct PacketTraceRecord {
+    enum Direction : quint8 {
+        Sent = 0,
+        Received
+    };
+
+    quint64 timestamp { 0 }; // microseconds since the trace was started
+    quint8 direction { Sent };
+    quint8 isControl { 0 };
+    quint16 controlType { 0 }; // ControlPacket::Type, for control packets
+    quint32 sequenceNumber { 0 }; // sequence number, for data packets
+    quint32 size { 0 }; // size of the datagram on the wire, in bytes
+};
+
+class PacketTraceRecorder {
+public:
+    // opens the trace file and writes the format header - returns false if the file could not be opened
+    bool start(const QString& filePath);
+    void stop();
+
+    bool isRecording() const { return _isRecording; }
+
+    // parses the header of a raw datagram and appends a record for it - safe to call from any thread
+    void recordPacket(const char* data, int size, PacketTraceRecord::Direction direction);
+
+private:
+    std::atomic<bool> _isRecording { false };
+
+    std::mutex _mutex;
+    QFile _file;
+    QDataStream _stream;
+    p_high_resolution_clock::time_point _startTime;
+};
+
+class PacketTraceReader {
+public:
+    // opens a trace file and verifies the format header
+    bool open(const QString& filePath);
+
+    // reads the next record from the trace - returns false once the trace is exhausted
+    bool readNextRecord(PacketTraceRecord& record);
+
+private:
+    QFile _file;
+    QDataStream _stream;
+};
+
+} // namespace udt
+
+#endif // hifi_PacketTrace_h
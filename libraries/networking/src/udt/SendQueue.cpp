@@ -350,8 +350,25 @@ void SendQueue::run() {
             // sleep as long as we need for next packet send, if we can
             auto now = p_high_resolution_clock::now();
 
+            // cap how far we can fall behind schedule - the backlog of send credit acts as a token
+            // bucket, and without a ceiling on its depth a stall here would be followed by an
+            // arbitrarily large catch-up burst, which is exactly what pacing is meant to avoid
+            auto maxSendCredit = std::chrono::microseconds((int64_t) _maxBurstPackets * _packetSendPeriod);
+            if (now - nextPacketTimestamp > maxSendCredit) {
+                nextPacketTimestamp = now - maxSendCredit;
+            }
+
             auto timeToSleep = duration_cast<microseconds>(nextPacketTimestamp - now);
 
+            if (attemptedToSendPacket) {
+                // count this send against the pacing adherence stats - a send that happens after its
+                // deadline has already passed went out as part of a burst rather than on schedule
+                ++_pacedSends;
+                if (timeToSleep.count() < 0) {
+                    ++_lateSends;
+                }
+            }
+
             // we use nextPacketTimestamp so that we don't fall behind, not to force long sleeps
             // we'll never allow nextPacketTimestamp to force us to sleep for more than nextPacketDelta
             // so cap it to that value
@@ -68,7 +68,15 @@ public:
     void setSyncInterval(int syncInterval) { _syncInterval = syncInterval; }
 
     void setProbePacketEnabled(bool enabled);
-    
+
+    // how many packets of send credit can accumulate while we are behind schedule - this is the
+    // depth of the pacing token bucket and bounds the size of any catch-up burst
+    void setMaxBurstPackets(int maxBurstPackets) { _maxBurstPackets = maxBurstPackets; }
+
+    // number of paced sends, and how many of those missed their deadline, since last asked
+    int getAndResetPacedSends() { return _pacedSends.exchange(0); }
+    int getAndResetLateSends() { return _lateSends.exchange(0); }
+
 public slots:
     void stop();
     
@@ -147,6 +155,12 @@ private:
 
 
     std::atomic<bool> _shouldSendProbes { true };
+
+    static const int DEFAULT_MAX_BURST_PACKETS = 8;
+    std::atomic<int> _maxBurstPackets { DEFAULT_MAX_BURST_PACKETS }; // pacing token bucket depth, in packets
+
+    std::atomic<int> _pacedSends { 0 }; // paced sends since the stats were last sampled
+    std::atomic<int> _lateSends { 0 }; // paced sends that ran behind schedule since the stats were last sampled
 };
     
 }
@@ -15,6 +15,13 @@
 #include <sys/socket.h>
 #endif
 
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
 #include <QtCore/QThread>
 
 #include <LogHandler.h>
@@ -185,6 +192,15 @@ qint64 Socket::writePacketList(std::unique_ptr<PacketList> packetList, const Hif
     }
 
     // Unerliable and Unordered
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    if (_udpSocket.socketDescriptor() != -1 && packetList->_packets.size() > 1
+        && !sockAddr.getAddress().isNull() && sockAddr.getAddress().protocol() == QAbstractSocket::IPv4Protocol) {
+        // the list is a contiguous batch for one destination - flush it with a single sendmmsg call
+        // instead of one syscall (and one sequence number lock) per packet
+        return writeUnreliablePacketListBatched(std::move(packetList), sockAddr);
+    }
+#endif
+
     qint64 totalBytesSent = 0;
     while (!packetList->_packets.empty()) {
         totalBytesSent += writePacket(packetList->takeFront<Packet>(), sockAddr);
@@ -193,6 +209,80 @@ qint64 Socket::writePacketList(std::unique_ptr<PacketList> packetList, const Hif
     return totalBytesSent;
 }
 
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+
+qint64 Socket::writeUnreliablePacketListBatched(std::unique_ptr<PacketList> packetList, const HifiSockAddr& sockAddr) {
+    auto socketDescriptor = _udpSocket.socketDescriptor();
+
+    // reserve a block of unreliable sequence numbers for the whole list up front, so concurrent
+    // senders (like mixer threads) take the lock once per list instead of once per packet
+    auto numPackets = packetList->_packets.size();
+    SequenceNumber sequenceNumber;
+    {
+        Lock lock(_unreliableSequenceNumbersMutex);
+        auto& currentSequenceNumber = _unreliableSequenceNumbers[sockAddr];
+        sequenceNumber = currentSequenceNumber + 1;
+        currentSequenceNumber = currentSequenceNumber + (SequenceNumber::Type) numPackets;
+    }
+
+    sockaddr_in destination;
+    memset(&destination, 0, sizeof(destination));
+    destination.sin_family = AF_INET;
+    destination.sin_addr.s_addr = htonl(sockAddr.getAddress().toIPv4Address());
+    destination.sin_port = htons(sockAddr.getPort());
+
+    struct mmsghdr headers[MAX_BATCHED_DATAGRAMS];
+    struct iovec iovecs[MAX_BATCHED_DATAGRAMS];
+
+    qint64 totalBytesSent = 0;
+    auto it = packetList->_packets.begin();
+
+    while (it != packetList->_packets.end()) {
+        memset(headers, 0, sizeof(headers));
+
+        int batched = 0;
+        while (it != packetList->_packets.end() && batched < MAX_BATCHED_DATAGRAMS) {
+            auto& packet = *it;
+            packet->writeSequenceNumber(sequenceNumber++);
+
+            if (_packetTraceRecorder.isRecording()) {
+                _packetTraceRecorder.recordPacket(packet->getData(), packet->getDataSize(), PacketTraceRecord::Sent);
+            }
+
+            iovecs[batched].iov_base = packet->getData();
+            iovecs[batched].iov_len = packet->getDataSize();
+            headers[batched].msg_hdr.msg_iov = &iovecs[batched];
+            headers[batched].msg_hdr.msg_iovlen = 1;
+            headers[batched].msg_hdr.msg_name = &destination;
+            headers[batched].msg_hdr.msg_namelen = sizeof(destination);
+
+            ++batched;
+            ++it;
+        }
+
+        int sent = sendmmsg(socketDescriptor, headers, batched, 0);
+        if (sent < 0) {
+            // when saturating a link this isn't an uncommon failure - log it like writeDatagram does and
+            // drop the remainder, these packets are unreliable
+            qCDebug(networking) << "Socket::writeUnreliablePacketListBatched sendmmsg error -" << strerror(errno);
+            break;
+        }
+
+        for (int i = 0; i < sent; i++) {
+            totalBytesSent += headers[i].msg_len;
+        }
+
+        if (sent < batched) {
+            // the kernel only took part of the batch - drop the remainder like any other failed unreliable send
+            break;
+        }
+    }
+
+    return totalBytesSent;
+}
+
+#endif
+
 void Socket::writeReliablePacket(Packet* packet, const HifiSockAddr& sockAddr) {
     auto connection = findOrCreateConnection(sockAddr);
     if (connection) {
@@ -223,6 +313,9 @@ qint64 Socket::writeDatagram(const char* data, qint64 size, const HifiSockAddr&
 }
 
 qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr) {
+    if (_packetTraceRecorder.isRecording()) {
+        _packetTraceRecorder.recordPacket(datagram.constData(), datagram.size(), PacketTraceRecord::Sent);
+    }
 
     qint64 bytesWritten = _udpSocket.writeDatagram(datagram, sockAddr.getAddress(), sockAddr.getPort());
 
@@ -337,7 +430,7 @@ void Socket::readPendingDatagrams() {
 
         // grab a time point we can mark as the receive time of this packet
         auto receiveTime = p_high_resolution_clock::now();
-        
+
         // setup a HifiSockAddr to read into
         HifiSockAddr senderSockAddr;
 
@@ -348,80 +441,156 @@ void Socket::readPendingDatagrams() {
         auto sizeRead = _udpSocket.readDatagram(buffer.get(), packetSizeWithHeader,
                                                 senderSockAddr.getAddressPointer(), senderSockAddr.getPortPointer());
 
-        // save information for this packet, in case it is the one that sticks readyRead
-        _lastPacketSizeRead = sizeRead;
-        _lastPacketSockAddr = senderSockAddr;
-
         if (sizeRead <= 0) {
             // we either didn't pull anything for this packet or there was an error reading (this seems to trigger
             // on windows even if there's not a packet available)
             continue;
         }
 
-        auto it = _unfilteredHandlers.find(senderSockAddr);
+        processReceivedDatagram(std::move(buffer), sizeRead, senderSockAddr, receiveTime);
 
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this HifiSockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
-            }
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+        // the read through QUdpSocket above keeps its read notifier armed - anything else queued
+        // up behind it in the kernel buffer can now be drained in batches instead of paying one
+        // syscall per datagram
+        drainPendingDatagramsBatched();
+#endif
+    }
+}
 
-            continue;
+void Socket::processReceivedDatagram(std::unique_ptr<char[]> buffer, qint64 sizeRead, const HifiSockAddr& senderSockAddr,
+                                     const p_high_resolution_clock::time_point& receiveTime) {
+    // save information for this packet, in case it is the one that sticks readyRead
+    _lastPacketSizeRead = sizeRead;
+    _lastPacketSockAddr = senderSockAddr;
+
+    if (_packetTraceRecorder.isRecording()) {
+        _packetTraceRecorder.recordPacket(buffer.get(), sizeRead, PacketTraceRecord::Received);
+    }
+
+    auto it = _unfilteredHandlers.find(senderSockAddr);
+
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this HifiSockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), sizeRead, senderSockAddr);
+            basePacket->setReceiveTime(receiveTime);
+            it->second(std::move(basePacket));
         }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+        return;
+    }
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr);
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), sizeRead, senderSockAddr);
+        controlPacket->setReceiveTime(receiveTime);
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
-            }
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr);
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
-
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
-
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
-                    auto connection = findOrCreateConnection(senderSockAddr);
-
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
-                        continue;
-                    }
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
+
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), sizeRead, senderSockAddr);
+        packet->setReceiveTime(receiveTime);
+
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
+
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
+                auto connection = findOrCreateConnection(senderSockAddr);
+
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
+                    return;
                 }
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
 }
 
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+
+void Socket::drainPendingDatagramsBatched() {
+    auto socketDescriptor = _udpSocket.socketDescriptor();
+    if (socketDescriptor == -1) {
+        return;
+    }
+
+    struct mmsghdr headers[MAX_BATCHED_DATAGRAMS];
+    struct iovec iovecs[MAX_BATCHED_DATAGRAMS];
+    struct sockaddr_storage senders[MAX_BATCHED_DATAGRAMS];
+
+    int received = 0;
+    do {
+        memset(headers, 0, sizeof(headers));
+        for (int i = 0; i < MAX_BATCHED_DATAGRAMS; i++) {
+            // replenish any buffer slot handed off to a packet during the last batch
+            if (!_batchedReceiveBuffers[i]) {
+                _batchedReceiveBuffers[i].reset(new char[udt::MAX_PACKET_SIZE]);
+            }
+            iovecs[i].iov_base = _batchedReceiveBuffers[i].get();
+            iovecs[i].iov_len = udt::MAX_PACKET_SIZE;
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+            headers[i].msg_hdr.msg_name = &senders[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(senders[i]);
+        }
+
+        received = recvmmsg(socketDescriptor, headers, MAX_BATCHED_DATAGRAMS, MSG_DONTWAIT, nullptr);
+        if (received <= 0) {
+            // EAGAIN/EWOULDBLOCK just means we've drained the kernel buffer
+            if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                qCDebug(networking) << "Socket::drainPendingDatagramsBatched recvmmsg error -" << strerror(errno);
+            }
+            return;
+        }
+
+        // we're reading packets so re-start the readyRead backup timer
+        _readyReadBackupTimer->start();
+
+        // one receive time for the whole batch - these datagrams were already queued when we started
+        auto receiveTime = p_high_resolution_clock::now();
+
+        for (int i = 0; i < received; i++) {
+            if (headers[i].msg_hdr.msg_flags & MSG_TRUNC) {
+                // no valid udt packet is bigger than our buffers - drop whatever this was
+                qCDebug(networking) << "Socket::drainPendingDatagramsBatched dropping oversized datagram of"
+                    << headers[i].msg_len << "bytes";
+                continue;
+            }
+
+            HifiSockAddr senderSockAddr(reinterpret_cast<sockaddr*>(&senders[i]));
+            processReceivedDatagram(std::move(_batchedReceiveBuffers[i]), headers[i].msg_len,
+                                    senderSockAddr, receiveTime);
+        }
+    } while (received == MAX_BATCHED_DATAGRAMS);
+}
+
+#endif
+
 void Socket::connectToSendSignal(const HifiSockAddr& destinationAddr, QObject* receiver, const char* slot) {
     auto it = _connectionsHash.find(destinationAddr);
     if (it != _connectionsHash.end()) {
@@ -454,8 +623,7 @@ void Socket::rateControlSync() {
         if (it != _connectionsHash.end()) {
             // if the connection is erased while calling sync since we are re-using the iterator that was invalidated
             // we're good to go
-            auto& connection = _connectionsHash[sockAddr];
-            connection->sync();
+            it->second->sync();
         }
     }
 
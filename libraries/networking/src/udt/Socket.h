@@ -22,7 +22,10 @@
 #include <QtCore/QTimer>
 #include <QtNetwork/QUdpSocket>
 
+#include <PortableHighResolutionClock.h>
+
 #include "../HifiSockAddr.h"
+#include "PacketTrace.h"
 #include "TCPVegasCC.h"
 #include "Connection.h"
 
@@ -88,6 +91,10 @@ public:
     
     StatsVector sampleStatsForAllConnections();
 
+    // record a wire-level trace of every datagram sent and received by this socket, for offline replay
+    bool startPacketTrace(const QString& filePath) { return _packetTraceRecorder.start(filePath); }
+    void stopPacketTrace() { _packetTraceRecorder.stop(); }
+
 #if (PR_BUILD || DEV_BUILD)
     void sendFakedHandshakeRequest(const HifiSockAddr& sockAddr);
 #endif
@@ -109,6 +116,8 @@ private slots:
 
 private:
     void setSystemBufferSizes();
+    void processReceivedDatagram(std::unique_ptr<char[]> buffer, qint64 sizeRead, const HifiSockAddr& senderSockAddr,
+                                 const p_high_resolution_clock::time_point& receiveTime);
     Connection* findOrCreateConnection(const HifiSockAddr& sockAddr);
     bool socketMatchesNodeOrDomain(const HifiSockAddr& sockAddr);
    
@@ -145,9 +154,22 @@ private:
 
     bool _shouldChangeSocketOptions { true };
 
+    PacketTraceRecorder _packetTraceRecorder;
+
     int _lastPacketSizeRead { 0 };
     SequenceNumber _lastReceivedSequenceNumber;
     HifiSockAddr _lastPacketSockAddr;
+
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    static const int MAX_BATCHED_DATAGRAMS = 64;
+
+    void drainPendingDatagramsBatched();
+    qint64 writeUnreliablePacketListBatched(std::unique_ptr<PacketList> packetList, const HifiSockAddr& sockAddr);
+
+    // receive buffers for batched reads - slots are handed off to packet objects as datagrams
+    // arrive and lazily replenished, so allocations track datagrams actually received
+    std::unique_ptr<char[]> _batchedReceiveBuffers[MAX_BATCHED_DATAGRAMS];
+#endif
     
     friend UDTTest;
 };
@@ -312,6 +312,12 @@ public:
     virtual bool writeToMap(QVariantMap& entityDescription, OctreeElementPointer element, bool skipDefaultValues,
                             bool skipThoseWithBadParents) = 0;
 
+    // Chunked persistence - trees that support it save their content as a set of chunk files
+    // in a directory, rewriting only the chunks that changed since the last save
+    virtual bool supportsChunkedPersist() const { return false; }
+    virtual bool writeChunkedPersist(const QString& directory) { return false; }
+    virtual bool readChunkedPersist(const QString& directory) { return false; }
+
     // Octree importers
     bool readFromFile(const char* filename);
     bool readFromURL(const QString& url); // will support file urls as well...
@@ -20,6 +20,38 @@
 
 const int OctreeEditPacketSender::DEFAULT_MAX_PENDING_MESSAGES = PacketSender::DEFAULT_PACKETS_PER_SECOND;
 
+// the receiver NACKs once a second, so a resend younger than half that is assumed in flight
+const quint64 MINIMUM_RESEND_INTERVAL_USECS = 500 * USECS_PER_MSEC;
+
+void OctreeEditPacketSender::SentEditRecordHistory::recordsSent(quint16 sequenceNumber, EditRecords&& records) {
+    _records[sequenceNumber] = std::move(records);
+    _lastResendTimes.erase(sequenceNumber);
+    _sentOrder.push_back(sequenceNumber);
+
+    // prune to the same depth as the sent packet history
+    while (_sentOrder.size() > MAX_REASONABLE_SEQUENCE_GAP) {
+        quint16 oldestSequenceNumber = _sentOrder.front();
+        _sentOrder.pop_front();
+        _records.erase(oldestSequenceNumber);
+        _lastResendTimes.erase(oldestSequenceNumber);
+    }
+}
+
+const OctreeEditPacketSender::EditRecords* OctreeEditPacketSender::SentEditRecordHistory::getRecords(
+        quint16 sequenceNumber) const {
+    auto it = _records.find(sequenceNumber);
+    return (it != _records.end()) ? &it->second : nullptr;
+}
+
+bool OctreeEditPacketSender::SentEditRecordHistory::shouldResend(quint16 sequenceNumber, quint64 now) {
+    quint64& lastResendTime = _lastResendTimes[sequenceNumber];
+    if (now - lastResendTime < MINIMUM_RESEND_INTERVAL_USECS) {
+        return false;
+    }
+    lastResendTime = now;
+    return true;
+}
+
 
 OctreeEditPacketSender::OctreeEditPacketSender() :
     PacketSender(),
@@ -72,7 +104,8 @@ bool OctreeEditPacketSender::serversExist() const {
 
 // This method is called when the edit packet layer has determined that it has a fully formed packet destined for
 // a known nodeID.
-void OctreeEditPacketSender::queuePacketToNode(const QUuid& nodeUUID, std::unique_ptr<NLPacket> packet) {
+void OctreeEditPacketSender::queuePacketToNode(const QUuid& nodeUUID, std::unique_ptr<NLPacket> packet,
+                                               EditRecords editRecords) {
 
     bool wantDebug = false;
     DependencyManager::get<NodeList>()->eachNode([&](const SharedNodePointer& node){
@@ -110,6 +143,13 @@ void OctreeEditPacketSender::queuePacketToNode(const QUuid& nodeUUID, std::uniqu
             // add packet to history
             _sentPacketHistories[nodeUUID].packetSent(sequence, *packet);
 
+            // remember the individual edits the packet carried, for selective resend on NACK
+            // (only for a specific node - a null nodeUUID matches every server)
+            if (!editRecords.empty() && !nodeUUID.isNull()) {
+                QMutexLocker locker(&_sentRecordsLock);
+                _sentEditRecords[nodeUUID].recordsSent(sequence, std::move(editRecords));
+            }
+
             queuePacketForSending(node, NLPacket::createCopy(*packet));
         }
     });
@@ -260,8 +300,10 @@ void OctreeEditPacketSender::queueOctreeEditMessage(PacketType type, QByteArray&
                         auto packetToRelease = initializePacket(type, node->getClockSkewUsec());
                         bufferedPacket.swap(packetToRelease);
 
-                        // release the previously buffered packet
-                        releaseQueuedPacket(nodeUUID, std::move(packetToRelease));
+                        // release the previously buffered packet, along with the records it carries
+                        EditRecords releasedRecords;
+                        releasedRecords.swap(_pendingEditRecords[nodeUUID]);
+                        releaseQueuedPacket(nodeUUID, std::move(packetToRelease), std::move(releasedRecords));
                     }
                 }
 
@@ -274,6 +316,7 @@ void OctreeEditPacketSender::queueOctreeEditMessage(PacketType type, QByteArray&
                 }
 
                 bufferedPacket->write(editMessage);
+                _pendingEditRecords[nodeUUID].push_back({ type, editMessage });
             }
         }
     });
@@ -297,9 +340,12 @@ void OctreeEditPacketSender::releaseQueuedMessages() {
                 
                 // swap the null ptr with the packet we want to release
                 i.second.swap(releasedPacket);
-                
+
+                EditRecords releasedRecords;
+                releasedRecords.swap(_pendingEditRecords[i.first]);
+
                 // move and release the queued packet
-                releaseQueuedPacket(i.first, std::move(releasedPacket));
+                releaseQueuedPacket(i.first, std::move(releasedPacket), std::move(releasedRecords));
             }
             
         }
@@ -307,10 +353,11 @@ void OctreeEditPacketSender::releaseQueuedMessages() {
     }
 }
 
-void OctreeEditPacketSender::releaseQueuedPacket(const QUuid& nodeID, std::unique_ptr<NLPacket> packet) {
+void OctreeEditPacketSender::releaseQueuedPacket(const QUuid& nodeID, std::unique_ptr<NLPacket> packet,
+                                                 EditRecords editRecords) {
     _releaseQueuedPacketMutex.lock();
     if (packet->getPayloadSize() > 0 && packet->getType() != PacketType::Unknown) {
-        queuePacketToNode(nodeID, std::move(packet));
+        queuePacketToNode(nodeID, std::move(packet), std::move(editRecords));
     }
     _releaseQueuedPacketMutex.unlock();
 }
@@ -341,31 +388,88 @@ bool OctreeEditPacketSender::process() {
 
 void OctreeEditPacketSender::processNackPacket(ReceivedMessage& message, SharedNodePointer sendingNode) {
     // parse sending node from packet, retrieve packet history for that node
+    QUuid nodeUUID = sendingNode->getUUID();
 
     // if packet history doesn't exist for the sender node (somehow), bail
-    if (_sentPacketHistories.count(sendingNode->getUUID()) == 0) {
+    if (_sentPacketHistories.count(nodeUUID) == 0) {
         return;
     }
-    
-    const SentPacketHistory& sentPacketHistory = _sentPacketHistories[sendingNode->getUUID()];
 
-    // read sequence numbers and queue packets for resend
+    const SentPacketHistory& sentPacketHistory = _sentPacketHistories[nodeUUID];
+
+    quint64 now = usecTimestampNow();
+    EditRecords recordsToResend;
+
+    // read sequence numbers and collect the missing edits for resend
     while (message.getBytesLeftToRead() > 0) {
         unsigned short int sequenceNumber;
         message.readPrimitive(&sequenceNumber);
-        
-        // retrieve packet from history
+
+        {
+            QMutexLocker locker(&_sentRecordsLock);
+            SentEditRecordHistory& recordHistory = _sentEditRecords[nodeUUID];
+
+            if (!recordHistory.shouldResend(sequenceNumber, now)) {
+                continue;
+            }
+
+            const EditRecords* records = recordHistory.getRecords(sequenceNumber);
+            if (records) {
+                // we know the individual edits this packet carried - collect them for repacking
+                recordsToResend.insert(recordsToResend.end(), records->begin(), records->end());
+                continue;
+            }
+        }
+
+        // no record breakdown for this sequence (a single message packet, or one that
+        // pre-dates the record history) - fall back to resending the whole stored packet
         const NLPacket* packet = sentPacketHistory.getPacket(sequenceNumber);
         if (packet) {
             queuePacketForSending(sendingNode, NLPacket::createCopy(*packet));
         }
     }
+
+    if (recordsToResend.empty()) {
+        return;
+    }
+
+    // repack the missing edits densely, so edits from several lost packets share MTUs; the
+    // repacked packets are sequenced and recorded like any other edit packet, which makes the
+    // resends themselves recoverable. The records were clock skew adjusted when first packed,
+    // so they are written back as is.
+    std::unique_ptr<NLPacket> bufferedPacket;
+    EditRecords packedRecords;
+    for (auto& record : recordsToResend) {
+        if (bufferedPacket &&
+            ((record.first != bufferedPacket->getType() && bufferedPacket->getPayloadSize() > 0) ||
+             (record.second.size() >= bufferedPacket->bytesAvailableForWrite()))) {
+
+            queuePacketToNode(nodeUUID, std::move(bufferedPacket), std::move(packedRecords));
+            bufferedPacket.reset();
+            packedRecords.clear();
+        }
+
+        if (!bufferedPacket) {
+            bufferedPacket = initializePacket(record.first, sendingNode->getClockSkewUsec());
+        }
+
+        bufferedPacket->write(record.second);
+        packedRecords.push_back(std::move(record));
+    }
+
+    if (bufferedPacket) {
+        queuePacketToNode(nodeUUID, std::move(bufferedPacket), std::move(packedRecords));
+    }
 }
 
 void OctreeEditPacketSender::nodeKilled(SharedNodePointer node) {
     // TODO: add locks
     QUuid nodeUUID = node->getUUID();
     _pendingEditPackets.erase(nodeUUID);
+    _pendingEditRecords.erase(nodeUUID);
     _outgoingSequenceNumbers.erase(nodeUUID);
     _sentPacketHistories.erase(nodeUUID);
+
+    QMutexLocker locker(&_sentRecordsLock);
+    _sentEditRecords.erase(nodeUUID);
 }
@@ -12,7 +12,9 @@
 #ifndef hifi_OctreeEditPacketSender_h
 #define hifi_OctreeEditPacketSender_h
 
+#include <deque>
 #include <unordered_map>
+#include <vector>
 
 #include <PacketSender.h>
 #include <udt/PacketHeaders.h>
@@ -38,7 +40,7 @@ public:
     /// interval to ensure that the packets are actually sent. Can be called even before servers are known, in
     /// which case  up to MaxPendingMessages of the released messages will be buffered and actually released when
     /// servers are known.
-    void releaseQueuedMessages();
+    virtual void releaseQueuedMessages();
 
     /// are we in sending mode. If we're not in sending mode then all packets and messages will be ignored and
     /// not queued and not sent
@@ -84,13 +86,34 @@ public slots:
 
 protected:
     using EditMessagePair = std::pair<PacketType, QByteArray>;
+    using EditRecords = std::vector<EditMessagePair>;
+
+    // The individual edit records packed into each sent packet, kept alongside the packet
+    // history, so a NACK can re-send just the missing edits - repacked densely across the
+    // lost packets - instead of a whole stored packet copy per lost sequence number.
+    class SentEditRecordHistory {
+    public:
+        void recordsSent(quint16 sequenceNumber, EditRecords&& records);
+        const EditRecords* getRecords(quint16 sequenceNumber) const;
+
+        // returns false while an earlier resend of this sequence may still be in flight,
+        // since the receiver re-NACKs every missing sequence until a resend lands
+        bool shouldResend(quint16 sequenceNumber, quint64 now);
+
+    private:
+        std::unordered_map<quint16, EditRecords> _records;
+        std::unordered_map<quint16, quint64> _lastResendTimes;
+        std::deque<quint16> _sentOrder; // oldest first, for pruning
+    };
 
     bool _shouldSend;
-    void queuePacketToNode(const QUuid& nodeID, std::unique_ptr<NLPacket> packet);
+    void queuePacketToNode(const QUuid& nodeID, std::unique_ptr<NLPacket> packet,
+                           EditRecords editRecords = EditRecords());
     void queuePendingPacketToNodes(std::unique_ptr<NLPacket> packet);
     void queuePacketToNodes(std::unique_ptr<NLPacket> packet);
     std::unique_ptr<NLPacket> initializePacket(PacketType type, qint64 nodeClockSkew);
-    void releaseQueuedPacket(const QUuid& nodeUUID, std::unique_ptr<NLPacket> packetBuffer); // releases specific queued packet
+    void releaseQueuedPacket(const QUuid& nodeUUID, std::unique_ptr<NLPacket> packetBuffer,
+                             EditRecords editRecords = EditRecords()); // releases specific queued packet
 
     void processPreServerExistsPackets();
 
@@ -112,5 +135,11 @@ protected:
     // TODO: add locks for this and _pendingEditPackets
     std::unordered_map<QUuid, SentPacketHistory> _sentPacketHistories;
     std::unordered_map<QUuid, quint16> _outgoingSequenceNumbers;
+
+    // the records accumulated into each node's pending edit packet, parallel to _pendingEditPackets
+    std::unordered_map<QUuid, EditRecords> _pendingEditRecords;
+
+    QMutex _sentRecordsLock;
+    std::unordered_map<QUuid, SentEditRecordHistory> _sentEditRecords;
 };
 #endif // hifi_OctreeEditPacketSender_h
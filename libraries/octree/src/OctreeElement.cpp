@@ -19,6 +19,7 @@
 #include <Profile.h>
 
 #include <LogHandler.h>
+#include <MemoryPool.h>
 #include <NodeList.h>
 #include <PerfStat.h>
 
@@ -86,12 +87,9 @@ void OctreeElement::init(unsigned char * octalCode) {
 
 #ifdef SIMPLE_EXTERNAL_CHILDREN
     _childrenSingle.reset();
+    _externalChildren = NULL;
 #endif
 
-    for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-        _externalChildren[i].reset();
-    }
-
     _isDirty = true;
     _shouldRender = false;
     _sourceUUIDKey = 0;
@@ -252,6 +250,31 @@ AtomicUIntStat OctreeElement::_setChildAtIndexCalls { 0 };
 AtomicUIntStat OctreeElement::_externalChildrenCount { 0 };
 AtomicUIntStat OctreeElement::_childrenCount[NUMBER_OF_CHILDREN + 1];
 
+// slab pool for the 8-wide child pointer arrays; only elements with two or more children
+// hold one, and pooling keeps the interior-node arrays packed together for traversal
+static MemoryPool& childArrayPool() {
+    static MemoryPool pool("octree.ChildArray", NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer));
+    return pool;
+}
+
+OctreeElementPointer* OctreeElement::allocateExternalChildren() {
+    OctreeElementPointer* children = static_cast<OctreeElementPointer*>(childArrayPool().allocate());
+    for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
+        new (&children[i]) OctreeElementPointer();
+    }
+    _externalChildrenMemoryUsage += NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
+    return children;
+}
+
+void OctreeElement::releaseExternalChildren() {
+    for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
+        _externalChildren[i].~OctreeElementPointer();
+    }
+    childArrayPool().release(_externalChildren);
+    _externalChildren = NULL;
+    _externalChildrenMemoryUsage -= NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
+}
+
 OctreeElementPointer OctreeElement::getChildAtIndex(int childIndex) const {
 #ifdef SIMPLE_CHILD_ARRAY
     return _simpleChildArray[childIndex];
@@ -292,11 +315,11 @@ void OctreeElement::deleteAllChildren() {
         }
     }
 
+    _childrenSingle.reset();
     if (_childrenExternal) {
-        // if the children_t union represents _children.external we need to delete it here
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
+        // return the slab-allocated child array to the pool
+        releaseExternalChildren();
+        _childrenExternal = false;
     }
 }
 
@@ -345,32 +368,29 @@ void OctreeElement::setChildAtIndex(int childIndex, OctreeElementPointer child)
         _childrenSingle = child;
     } else if (previousChildCount == 1 && newChildCount == 2) {
         OctreeElementPointer previousChild = _childrenSingle;
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
+        _childrenSingle.reset();
+        _externalChildren = allocateExternalChildren();
         _externalChildren[firstIndex] = previousChild;
         _externalChildren[childIndex] = child;
 
         _childrenExternal = true;
 
-        _externalChildrenMemoryUsage += NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
-
     } else if (previousChildCount == 2 && newChildCount == 1) {
         assert(!child); // we are removing a child, so this must be true!
         OctreeElementPointer previousFirstChild = _externalChildren[firstIndex];
         OctreeElementPointer previousSecondChild = _externalChildren[secondIndex];
 
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
+        releaseExternalChildren();
         _childrenExternal = false;
 
-        _externalChildrenMemoryUsage -= NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
         if (childIndex == firstIndex) {
             _childrenSingle = previousSecondChild;
         } else {
             _childrenSingle = previousFirstChild;
         }
+    } else if (newChildCount == 1) {
+        // replacing the lone child in place; it lives inline, not in the external array
+        _childrenSingle = child;
     } else {
         _externalChildren[childIndex] = child;
     }
@@ -242,12 +242,16 @@ protected:
 #endif
 
 #ifdef SIMPLE_EXTERNAL_CHILDREN
-    // union children_t {
+    // the single-child case (by far the most common, along with leaves) is stored inline;
+    // the full 8-wide pointer array is carved out of a shared slab pool only for elements
+    // that actually hold two or more children, so leaves don't carry 128 bytes of nulls
     OctreeElementPointer _childrenSingle;
-    OctreeElementPointer _externalChildren[NUMBER_OF_CHILDREN];
-    // } _children;
+    OctreeElementPointer* _externalChildren { nullptr };
 #endif
 
+    OctreeElementPointer* allocateExternalChildren();
+    void releaseExternalChildren();
+
     uint16_t _sourceUUIDKey; /// Client only, stores node id of voxel server that sent his voxel, 2 bytes
 
     // Support for _sourceUUID, we use these static member variables to track the UUIDs that are
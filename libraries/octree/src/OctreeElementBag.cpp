@@ -11,6 +11,7 @@
 
 #include "OctreeElementBag.h"
 #include <OctalCode.h>
+#include <ViewFrustum.h>
 
 void OctreeElementBag::deleteAll() {
     _bagElements = Bag();
@@ -38,3 +39,42 @@ OctreeElementPointer OctreeElementBag::extract() {
     }
     return result;
 }
+
+OctreeElementPointer OctreeElementBag::extract(const ViewFrustum& viewFrustum) {
+    // anything inside the frustum outranks everything outside it; priority proper is
+    // in (0, 1], so this pushes out-of-view elements strictly below the in-view group
+    const float OUT_OF_VIEW_PENALTY = 2.0f;
+
+    Bag::iterator best = _bagElements.end();
+    float bestPriority = 0.0f;
+
+    Bag::iterator it = _bagElements.begin();
+    while (it != _bagElements.end()) {
+        OctreeElementPointer element = it->second.lock();
+        if (!element) {
+            it = _bagElements.erase(it);
+            continue;
+        }
+
+        // apparent size: how much of the view this subtree's bounds could cover. The
+        // bag is re-scanned against the caller's current frustum on every extract, so
+        // pending subtrees automatically re-order as the view moves.
+        float scale = element->getScale();
+        float priority = scale / glm::max(element->distanceToCamera(viewFrustum), scale);
+        if (!viewFrustum.cubeIntersectsKeyhole(element->getAACube())) {
+            priority -= OUT_OF_VIEW_PENALTY;
+        }
+        if (best == _bagElements.end() || priority > bestPriority) {
+            best = it;
+            bestPriority = priority;
+        }
+        ++it;
+    }
+
+    OctreeElementPointer result;
+    if (best != _bagElements.end()) {
+        result = best->second.lock();
+        _bagElements.erase(best);
+    }
+    return result;
+}
@@ -20,6 +20,8 @@
 
 #include "OctreeElement.h"
 
+class ViewFrustum;
+
 class OctreeElementBag {
     using Bag = std::unordered_map<OctreeElement*, OctreeElementWeakPointer>;
     
@@ -29,6 +31,9 @@ public:
     OctreeElementPointer extract(); /// pull a element out of the bag (could come in any order) and if all of the
                                     /// elements have expired, a single null pointer will be returned
 
+    OctreeElementPointer extract(const ViewFrustum& viewFrustum); /// pull the element whose bounds look largest from
+                                    /// this view; elements outside the frustum come out only after everything inside it
+
     bool isEmpty(); /// does the bag contain elements, 
                     /// if all of the contained elements are expired, they will not report as empty, and
                     /// a single last item will be returned by extract as a null pointer
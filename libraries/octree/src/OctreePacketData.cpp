@@ -10,6 +10,7 @@
 //
 
 #include <GLMHelpers.h>
+#include <MemoryPool.h>
 #include <PerfStat.h>
 
 #include "OctreeLogging.h"
@@ -29,6 +30,28 @@ struct aaCubeData {
     float scale;
 };
 
+static MemoryPool& octreePacketDataPool() {
+    // each object carries two full packet buffers, so keep the slabs small
+    const size_t BLOCKS_PER_SLAB = 4;
+    static MemoryPool pool { "octree.OctreePacketData", sizeof(OctreePacketData), BLOCKS_PER_SLAB };
+    return pool;
+}
+
+void* OctreePacketData::operator new(size_t size) {
+    if (size != sizeof(OctreePacketData)) {
+        return ::operator new(size);
+    }
+    return octreePacketDataPool().allocate();
+}
+
+void OctreePacketData::operator delete(void* packetData, size_t size) {
+    if (size != sizeof(OctreePacketData)) {
+        ::operator delete(packetData);
+        return;
+    }
+    octreePacketDataPool().release(packetData);
+}
+
 OctreePacketData::OctreePacketData(bool enableCompression, int targetSize) {
     changeSettings(enableCompression, targetSize); // does reset...
 }
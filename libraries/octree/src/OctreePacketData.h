@@ -86,6 +86,11 @@ public:
     OctreePacketData(bool enableCompression = false, int maxFinalizedSize = MAX_OCTREE_PACKET_DATA_SIZE);
     ~OctreePacketData();
 
+    // these objects carry two full packet buffers and are heap-churned once per incoming
+    // octree packet on the client, so class-level new/delete use a fixed-size MemoryPool
+    static void* operator new(size_t size);
+    static void operator delete(void* packetData, size_t size);
+
     /// change compression and target size settings
     void changeSettings(bool enableCompression = false, unsigned int targetSize = MAX_OCTREE_PACKET_DATA_SIZE);
 
@@ -36,7 +36,7 @@ const int OctreePersistThread::DEFAULT_PERSIST_INTERVAL = 1000 * 30; // every 30
 
 OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& filename, const QString& backupDirectory, int persistInterval,
                                          bool wantBackup, const QJsonObject& settings, bool debugTimestampNow,
-                                         QString persistAsFileType) :
+                                         QString persistAsFileType, bool persistChunked) :
     _tree(tree),
     _filename(filename),
     _backupDirectory(backupDirectory),
@@ -47,13 +47,15 @@ OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& file
     _wantBackup(wantBackup),
     _debugTimestampNow(debugTimestampNow),
     _lastTimeDebug(0),
-    _persistAsFileType(persistAsFileType)
+    _persistAsFileType(persistAsFileType),
+    _persistChunked(persistChunked && tree->supportsChunkedPersist())
 {
     parseSettings(settings);
 
     // in case the persist filename has an extension that doesn't match the file type
     QString sansExt = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS);
     _filename = sansExt + "." + _persistAsFileType;
+    _chunkDirectory = sansExt + ".chunks";
 }
 
 QString OctreePersistThread::getPersistFileMimeType() const {
@@ -161,7 +163,14 @@ bool OctreePersistThread::process() {
                 qCDebug(octree) << "Loading Octree... lock file removed:" << lockFileName;
             }
 
-            persistantFileRead = _tree->readFromFile(qPrintable(_filename.toLocal8Bit()));
+            // when chunked persistence is enabled and chunk files exist on disk, load those;
+            // otherwise fall back to the monolithic persist file (which also migrates
+            // pre-chunked domains - the first chunked save will write the chunk files)
+            if (_persistChunked && _tree->readChunkedPersist(_chunkDirectory)) {
+                persistantFileRead = true;
+            } else {
+                persistantFileRead = _tree->readFromFile(qPrintable(_filename.toLocal8Bit()));
+            }
             _tree->pruneTree();
         });
 
@@ -238,6 +247,13 @@ bool OctreePersistThread::process() {
 void OctreePersistThread::aboutToFinish() {
     qCDebug(octree) << "Persist thread about to finish...";
     persist();
+
+    // backups and persist-file downloads are served from the monolithic file, so when running
+    // chunked keep it current on clean shutdown
+    if (_persistChunked) {
+        _tree->writeToFile(qPrintable(_filename), NULL, _persistAsFileType);
+    }
+
     qCDebug(octree) << "Persist thread done with about to finish...";
     _stopThread = true;
 }
@@ -271,7 +287,12 @@ void OctreePersistThread::persist() {
         if(lockFile.is_open()) {
             qCDebug(octree) << "saving Octree lock file created at:" << lockFileName;
 
-            _tree->writeToFile(qPrintable(_filename), NULL, _persistAsFileType);
+            // chunked saves only rewrite the chunks that changed since the last save; if the
+            // chunked write fails for any reason we fall back to the monolithic file so a
+            // persist pass never silently drops data
+            if (!_persistChunked || !_tree->writeChunkedPersist(_chunkDirectory)) {
+                _tree->writeToFile(qPrintable(_filename), NULL, _persistAsFileType);
+            }
             time(&_lastPersistTime);
             _tree->clearDirtyBit(); // tree is clean after saving
             qCDebug(octree) << "DONE saving Octree to file...";
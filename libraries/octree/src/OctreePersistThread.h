@@ -35,7 +35,8 @@ public:
 
     OctreePersistThread(OctreePointer tree, const QString& filename, const QString& backupDirectory,
                         int persistInterval = DEFAULT_PERSIST_INTERVAL, bool wantBackup = false,
-                        const QJsonObject& settings = QJsonObject(), bool debugTimestampNow = false, QString persistAsFileType="svo");
+                        const QJsonObject& settings = QJsonObject(), bool debugTimestampNow = false, QString persistAsFileType="svo",
+                        bool persistChunked = false);
 
     bool isInitialLoadComplete() const { return _initialLoadComplete; }
     quint64 getLoadElapsedTime() const { return _loadTimeUSecs; }
@@ -79,6 +80,8 @@ private:
     quint64 _lastTimeDebug;
 
     QString _persistAsFileType;
+    bool _persistChunked;
+    QString _chunkDirectory;
 };
 
 #endif // hifi_OctreePersistThread_h
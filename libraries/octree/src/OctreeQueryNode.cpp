@@ -13,6 +13,7 @@
 
 #include <cstring>
 #include <cstdio>
+#include <utility>
 
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
@@ -32,7 +33,7 @@ bool OctreeQueryNode::packetIsDuplicate() const {
     // of the entire packet, we need to compare only the packet content...
 
     if (_lastOctreePacketLength == _octreePacket->getPayloadSize()) {
-        if (memcmp(_lastOctreePayload.data() + OCTREE_PACKET_EXTRA_HEADERS_SIZE,
+        if (memcmp(_lastOctreePacket->getPayload() + OCTREE_PACKET_EXTRA_HEADERS_SIZE,
                    _octreePacket->getPayload() + OCTREE_PACKET_EXTRA_HEADERS_SIZE,
                    _octreePacket->getPayloadSize() - OCTREE_PACKET_EXTRA_HEADERS_SIZE) == 0) {
             return true;
@@ -84,6 +85,7 @@ void OctreeQueryNode::init() {
     _myPacketType = getMyPacketType();
 
     _octreePacket = NLPacket::create(getMyPacketType());
+    _lastOctreePacket = NLPacket::create(getMyPacketType());
 
     resetOctreePacket(); // don't bump sequence
 }
@@ -95,12 +97,13 @@ void OctreeQueryNode::resetOctreePacket() {
         return;
     }
 
-    // Whenever we call this, we will keep a copy of the last packet, so we can determine if the last packet has
-    // changed since we last reset it. Since we know that no two packets can ever be identical without being the same
+    // Whenever we call this, we will keep the last packet, so we can determine if the next packet has
+    // changed since we last reset. Since we know that no two packets can ever be identical without being the same
     // scene information, (e.g. the root node packet of a static scene), we can use this as a strategy for reducing
-    // packet send rate.
-    _lastOctreePacketLength = _octreePacket->getPayloadSize();
-    memcpy(_lastOctreePayload.data(), _octreePacket->getPayload(), _lastOctreePacketLength);
+    // packet send rate. Rather than copying the payload out, we swap the two packets and rebuild the current one
+    // in the buffer the previous comparison packet was using.
+    std::swap(_octreePacket, _lastOctreePacket);
+    _lastOctreePacketLength = _lastOctreePacket->getPayloadSize();
 
     // If we're moving, and the client asked for low res, then we force monochrome, otherwise, use
     // the clients requested color state.
@@ -112,6 +112,7 @@ private:
 
     bool _viewSent { false };
     std::unique_ptr<NLPacket> _octreePacket;
+    std::unique_ptr<NLPacket> _lastOctreePacket;
     bool _octreePacketWaiting;
 
     unsigned int _lastOctreePacketLength { 0 };
@@ -148,8 +149,6 @@ private:
 
     quint64 _sceneSendStartTime = 0;
 
-    std::array<char, udt::MAX_PACKET_SIZE> _lastOctreePayload;
-
     QJsonObject _lastCheckJSONParameters;
 
     bool _shouldForceFullScene { false };
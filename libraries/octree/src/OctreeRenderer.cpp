@@ -12,6 +12,9 @@
 #include <glm/glm.hpp>
 #include <stdint.h>
 
+#include <memory>
+#include <vector>
+
 #include <NumericalConstants.h>
 #include <PerfStat.h>
 #include <RenderArgs.h>
@@ -100,9 +103,13 @@ void OctreeRenderer::processDatagram(ReceivedMessage& message, SharedNodePointer
         const QUuid& sourceUUID = message.getSourceID();
         
         int subsection = 1;
-        
+
         bool error = false;
-        
+
+        // First pass: uncompress every section outside the tree lock. Decompression is
+        // the bulk of the CPU spent per packet and is pure, so doing it here keeps the
+        // tree available to the render thread while we chew on the bitstream.
+        std::vector<std::unique_ptr<OctreePacketData>> sections;
         while (message.getBytesLeftToRead() > 0 && !error) {
             if (packetIsCompressed) {
                 if (message.getBytesLeftToRead() > (qint64) sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE)) {
@@ -114,60 +121,63 @@ void OctreeRenderer::processDatagram(ReceivedMessage& message, SharedNodePointer
             } else {
                 sectionLength = message.getBytesLeftToRead();
             }
-            
+
             if (sectionLength) {
-                // ask the VoxelTree to read the bitstream into the tree
-                ReadBitstreamToTreeParams args(WANT_EXISTS_BITS, NULL,
-                                                sourceUUID, sourceNode, false, message.getVersion());
-                quint64 startUncompress, startLock = usecTimestampNow();
-                quint64 startReadBitsteam, endReadBitsteam;
-                // FIXME STUTTER - there may be an opportunity to bump this lock outside of the
-                // loop to reduce the amount of locking/unlocking we're doing
-                _tree->withWriteLock([&] {
-                    startUncompress = usecTimestampNow();
-
-                    OctreePacketData packetData(packetIsCompressed);
-                    packetData.loadFinalizedContent(reinterpret_cast<const unsigned char*>(message.getRawMessage() + message.getPosition()),
-                        sectionLength);
-                    if (extraDebugging) {
-                        qCDebug(octree) << "OctreeRenderer::processDatagram() ... "
-                            "Got Packet Section color:" << packetIsColored <<
-                            "compressed:" << packetIsCompressed <<
-                            "sequence: " << sequence <<
-                            "flight: " << flightTime << " usec" <<
-                            "size:" << message.getSize() <<
-                            "data:" << message.getBytesLeftToRead() <<
-                            "subsection:" << subsection <<
-                            "sectionLength:" << sectionLength <<
-                            "uncompressed:" << packetData.getUncompressedSize();
-                    }
+                quint64 startUncompress = usecTimestampNow();
+
+                auto packetData = std::unique_ptr<OctreePacketData>(new OctreePacketData(packetIsCompressed));
+                packetData->loadFinalizedContent(reinterpret_cast<const unsigned char*>(message.getRawMessage() + message.getPosition()),
+                    sectionLength);
+                if (extraDebugging) {
+                    qCDebug(octree) << "OctreeRenderer::processDatagram() ... "
+                        "Got Packet Section color:" << packetIsColored <<
+                        "compressed:" << packetIsCompressed <<
+                        "sequence: " << sequence <<
+                        "flight: " << flightTime << " usec" <<
+                        "size:" << message.getSize() <<
+                        "data:" << message.getBytesLeftToRead() <<
+                        "subsection:" << subsection <<
+                        "sectionLength:" << sectionLength <<
+                        "uncompressed:" << packetData->getUncompressedSize();
+                }
+                sections.push_back(std::move(packetData));
 
+                totalUncompress += (usecTimestampNow() - startUncompress);
+
+                // seek forwards in packet
+                message.seek(message.getPosition() + sectionLength);
+            }
+            subsection++;
+        }
+
+        // Second pass: apply all the sections under a single, brief write lock, instead
+        // of re-acquiring the lock (and re-stalling the render thread) per section.
+        if (!sections.empty()) {
+            quint64 startLock = usecTimestampNow();
+            _tree->withWriteLock([&] {
+                totalWaitingForLock += (usecTimestampNow() - startLock);
+
+                for (auto& packetData : sections) {
+                    // ask the VoxelTree to read the bitstream into the tree
+                    ReadBitstreamToTreeParams args(WANT_EXISTS_BITS, NULL,
+                                                    sourceUUID, sourceNode, false, message.getVersion());
                     if (extraDebugging) {
                         qCDebug(octree) << "OctreeRenderer::processDatagram() ******* START _tree->readBitstreamToTree()...";
                     }
-                    startReadBitsteam = usecTimestampNow();
-                    _tree->readBitstreamToTree(packetData.getUncompressedData(), packetData.getUncompressedSize(), args);
-                    endReadBitsteam = usecTimestampNow();
+                    quint64 startReadBitsteam = usecTimestampNow();
+                    _tree->readBitstreamToTree(packetData->getUncompressedData(), packetData->getUncompressedSize(), args);
+                    totalReadBitsteam += (usecTimestampNow() - startReadBitsteam);
                     if (extraDebugging) {
                         qCDebug(octree) << "OctreeRenderer::processDatagram() ******* END _tree->readBitstreamToTree()...";
                     }
-                });
-                
-                // seek forwards in packet
-                message.seek(message.getPosition() + sectionLength);
 
-                elementsPerPacket += args.elementsPerPacket;
-                entitiesPerPacket += args.entitiesPerPacket;
+                    elementsPerPacket += args.elementsPerPacket;
+                    entitiesPerPacket += args.entitiesPerPacket;
 
-                _elementsInLastWindow += args.elementsPerPacket;
-                _entitiesInLastWindow += args.entitiesPerPacket;
-
-                totalWaitingForLock += (startUncompress - startLock);
-                totalUncompress += (startReadBitsteam - startUncompress);
-                totalReadBitsteam += (endReadBitsteam - startReadBitsteam);
-
-            }
-            subsection++;
+                    _elementsInLastWindow += args.elementsPerPacket;
+                    _entitiesInLastWindow += args.entitiesPerPacket;
+                }
+            });
         }
         _elementsPerPacket.updateAverage(elementsPerPacket);
         _entitiesPerPacket.updateAverage(entitiesPerPacket);
@@ -134,6 +134,9 @@ void OctreeSceneStats::copyFromOther(const OctreeSceneStats& other) {
     _incomingWastedBytes = other._incomingWastedBytes;
 
     _incomingOctreeSequenceNumberStats = other._incomingOctreeSequenceNumberStats;
+
+    // our _statsPacket wasn't copied, so don't trust any template it holds
+    _statsTemplateDirty = true;
 }
 
 
@@ -141,8 +144,22 @@ OctreeSceneStats::~OctreeSceneStats() {
     reset();
 }
 
+static bool octalCodePtrsEqual(const OctalCodePtr& a, const OctalCodePtr& b) {
+    if (!a || !b) {
+        return !a && !b;
+    }
+    auto aBytes = bytesRequiredForCodeLength(numberOfThreeBitSectionsInCode(a.get()));
+    auto bBytes = bytesRequiredForCodeLength(numberOfThreeBitSectionsInCode(b.get()));
+    return aBytes == bBytes && memcmp(a.get(), b.get(), aBytes) == 0;
+}
+
 void OctreeSceneStats::sceneStarted(bool isFullScene, bool isMoving, OctreeElementPointer root,
                                     JurisdictionMap* jurisdictionMap) {
+    // hang on to the prior jurisdiction so we can tell whether the preserialized stats
+    // template is still good - reset() clears it
+    auto priorJurisdictionRoot = _jurisdictionRoot;
+    auto priorJurisdictionEndNodes = std::move(_jurisdictionEndNodes);
+
     reset(); // resets packet and octree stats
     _isStarted = true;
     _start = usecTimestampNow();
@@ -161,6 +178,17 @@ void OctreeSceneStats::sceneStarted(bool isFullScene, bool isMoving, OctreeEleme
         _jurisdictionRoot = nullptr;
         _jurisdictionEndNodes.clear();
     }
+
+    // only a jurisdiction change invalidates the template, since everything ahead of the
+    // jurisdiction in the message is fixed-size counters that get patched per send
+    if (!_statsTemplateDirty) {
+        bool jurisdictionChanged = !octalCodePtrsEqual(priorJurisdictionRoot, _jurisdictionRoot) ||
+            priorJurisdictionEndNodes.size() != _jurisdictionEndNodes.size();
+        for (size_t i = 0; !jurisdictionChanged && i < _jurisdictionEndNodes.size(); i++) {
+            jurisdictionChanged = !octalCodePtrsEqual(priorJurisdictionEndNodes[i], _jurisdictionEndNodes[i]);
+        }
+        _statsTemplateDirty = jurisdictionChanged;
+    }
 }
 
 void OctreeSceneStats::sceneCompleted() {
@@ -241,105 +269,54 @@ void OctreeSceneStats::reset() {
     _jurisdictionEndNodes.clear();
 }
 
-void OctreeSceneStats::packetSent(int bytes) {
-    _packets++;
-    _bytes += bytes;
-}
-
-void OctreeSceneStats::traversed(const OctreeElementPointer element) {
-    _traversed++;
-    if (element->isLeaf()) {
-        _leaves++;
-    } else {
-        _internal++;
-    }
-}
-
-void OctreeSceneStats::skippedDistance(const OctreeElementPointer element) {
-    _skippedDistance++;
-    if (element->isLeaf()) {
-        _leavesSkippedDistance++;
-    } else {
-        _internalSkippedDistance++;
-    }
-}
-
-void OctreeSceneStats::skippedOutOfView(const OctreeElementPointer element) {
-    _skippedOutOfView++;
-    if (element->isLeaf()) {
-        _leavesSkippedOutOfView++;
-    } else {
-        _internalSkippedOutOfView++;
-    }
-}
-
-void OctreeSceneStats::skippedWasInView(const OctreeElementPointer element) {
-    _skippedWasInView++;
-    if (element->isLeaf()) {
-        _leavesSkippedWasInView++;
-    } else {
-        _internalSkippedWasInView++;
-    }
-}
-
-void OctreeSceneStats::skippedNoChange(const OctreeElementPointer element) {
-    _skippedNoChange++;
-    if (element->isLeaf()) {
-        _leavesSkippedNoChange++;
-    } else {
-        _internalSkippedNoChange++;
-    }
-}
-
-void OctreeSceneStats::skippedOccluded(const OctreeElementPointer element) {
-    _skippedOccluded++;
-    if (element->isLeaf()) {
-        _leavesSkippedOccluded++;
-    } else {
-        _internalSkippedOccluded++;
-    }
-}
-
-void OctreeSceneStats::colorSent(const OctreeElementPointer element) {
-    _colorSent++;
-    if (element->isLeaf()) {
-        _leavesColorSent++;
-    } else {
-        _internalColorSent++;
-    }
-}
-
-void OctreeSceneStats::didntFit(const OctreeElementPointer element) {
-    _didntFit++;
-    if (element->isLeaf()) {
-        _leavesDidntFit++;
-    } else {
-        _internalDidntFit++;
+int OctreeSceneStats::packIntoPacket() {
+    if (_statsTemplateDirty) {
+        // full serialization, including the jurisdiction suffix
+        buildStatsTemplate();
+        _statsTemplateDirty = false;
+        return _statsPacket->getPayloadSize();
     }
-}
-
-void OctreeSceneStats::colorBitsWritten() {
-    _colorBitsWritten++;
-}
-
-void OctreeSceneStats::existsBitsWritten() {
-    _existsBitsWritten++;
-}
 
-void OctreeSceneStats::existsInPacketBitsWritten() {
-    _existsInPacketBitsWritten++;
-}
+    // the template is current, so just patch the counter block at the front of the payload
+    static_assert(sizeof(PackedCounters) == 222, "PackedCounters doesn't match the stats wire format");
+    PackedCounters counters;
+    counters.start = _start;
+    counters.end = _end;
+    counters.elapsed = _elapsed;
+    counters.totalEncodeTime = _totalEncodeTime;
+    counters.isFullScene = _isFullScene;
+    counters.isMoving = _isMoving;
+    counters.packets = _packets;
+    counters.bytes = _bytes;
+    counters.totalInternal = _totalInternal;
+    counters.totalLeaves = _totalLeaves;
+    counters.internal = _internal;
+    counters.leaves = _leaves;
+    counters.internalSkippedDistance = _internalSkippedDistance;
+    counters.leavesSkippedDistance = _leavesSkippedDistance;
+    counters.internalSkippedOutOfView = _internalSkippedOutOfView;
+    counters.leavesSkippedOutOfView = _leavesSkippedOutOfView;
+    counters.internalSkippedWasInView = _internalSkippedWasInView;
+    counters.leavesSkippedWasInView = _leavesSkippedWasInView;
+    counters.internalSkippedNoChange = _internalSkippedNoChange;
+    counters.leavesSkippedNoChange = _leavesSkippedNoChange;
+    counters.internalSkippedOccluded = _internalSkippedOccluded;
+    counters.leavesSkippedOccluded = _leavesSkippedOccluded;
+    counters.internalColorSent = _internalColorSent;
+    counters.leavesColorSent = _leavesColorSent;
+    counters.internalDidntFit = _internalDidntFit;
+    counters.leavesDidntFit = _leavesDidntFit;
+    counters.colorBitsWritten = _colorBitsWritten;
+    counters.existsBitsWritten = _existsBitsWritten;
+    counters.existsInPacketBitsWritten = _existsInPacketBitsWritten;
+    counters.treesRemoved = _treesRemoved;
+
+    memcpy(_statsPacket->getPayload(), &counters, sizeof(counters));
 
-void OctreeSceneStats::childBitsRemoved(bool includesExistsBits) {
-    _existsInPacketBitsWritten--;
-    if (includesExistsBits) {
-        _existsBitsWritten--;
-    }
-    _colorBitsWritten--;
-    _treesRemoved++;
+    return _statsPacket->getPayloadSize();
 }
 
-int OctreeSceneStats::packIntoPacket() {
+void OctreeSceneStats::buildStatsTemplate() {
     _statsPacket->reset();
 
     _statsPacket->writePrimitive(_start);
@@ -396,8 +373,6 @@ int OctreeSceneStats::packIntoPacket() {
         int bytes = 0;
         _statsPacket->writePrimitive(bytes);
     }
-
-    return _statsPacket->getPayloadSize();
 }
 
 int OctreeSceneStats::unpackFromPacket(ReceivedMessage& packet) {
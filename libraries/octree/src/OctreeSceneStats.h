@@ -47,8 +47,14 @@ public:
 
     void printDebugDetails();
 
+    // The trackers below run once per element inside the encode hot path, so they are inline
+    // increments taking the element by const reference - no function call, no shared_ptr copy.
+
     /// Track that a packet was sent as part of the scene.
-    void packetSent(int bytes);
+    void packetSent(int bytes) {
+        _packets++;
+        _bytes += bytes;
+    }
 
     /// Tracks the beginning of an encode pass during scene calculation.
     void encodeStarted();
@@ -57,40 +63,71 @@ public:
     void encodeStopped();
 
     /// Track that a element was traversed as part of computation of a scene.
-    void traversed(const OctreeElementPointer element);
+    void traversed(const OctreeElementPointer& element) {
+        _traversed++;
+        element->isLeaf() ? _leaves++ : _internal++;
+    }
 
     /// Track that a element was skipped as part of computation of a scene due to being beyond the LOD distance.
-    void skippedDistance(const OctreeElementPointer element);
+    void skippedDistance(const OctreeElementPointer& element) {
+        _skippedDistance++;
+        element->isLeaf() ? _leavesSkippedDistance++ : _internalSkippedDistance++;
+    }
 
     /// Track that a element was skipped as part of computation of a scene due to being out of view.
-    void skippedOutOfView(const OctreeElementPointer element);
+    void skippedOutOfView(const OctreeElementPointer& element) {
+        _skippedOutOfView++;
+        element->isLeaf() ? _leavesSkippedOutOfView++ : _internalSkippedOutOfView++;
+    }
 
     /// Track that a element was skipped as part of computation of a scene due to previously being in view while in delta sending
-    void skippedWasInView(const OctreeElementPointer element);
+    void skippedWasInView(const OctreeElementPointer& element) {
+        _skippedWasInView++;
+        element->isLeaf() ? _leavesSkippedWasInView++ : _internalSkippedWasInView++;
+    }
 
     /// Track that a element was skipped as part of computation of a scene due to not having changed since last full scene sent
-    void skippedNoChange(const OctreeElementPointer element);
+    void skippedNoChange(const OctreeElementPointer& element) {
+        _skippedNoChange++;
+        element->isLeaf() ? _leavesSkippedNoChange++ : _internalSkippedNoChange++;
+    }
 
     /// Track that a element was skipped as part of computation of a scene due to being occluded
-    void skippedOccluded(const OctreeElementPointer element);
+    void skippedOccluded(const OctreeElementPointer& element) {
+        _skippedOccluded++;
+        element->isLeaf() ? _leavesSkippedOccluded++ : _internalSkippedOccluded++;
+    }
 
     /// Track that a element's color was was sent as part of computation of a scene
-    void colorSent(const OctreeElementPointer element);
+    void colorSent(const OctreeElementPointer& element) {
+        _colorSent++;
+        element->isLeaf() ? _leavesColorSent++ : _internalColorSent++;
+    }
 
     /// Track that a element was due to be sent, but didn't fit in the packet and was moved to next packet
-    void didntFit(const OctreeElementPointer element);
+    void didntFit(const OctreeElementPointer& element) {
+        _didntFit++;
+        element->isLeaf() ? _leavesDidntFit++ : _internalDidntFit++;
+    }
 
     /// Track that the color bitmask was was sent as part of computation of a scene
-    void colorBitsWritten();
+    void colorBitsWritten() { _colorBitsWritten++; }
 
     /// Track that the exists in tree bitmask was was sent as part of computation of a scene
-    void existsBitsWritten();
+    void existsBitsWritten() { _existsBitsWritten++; }
 
     /// Track that the exists in packet bitmask was was sent as part of computation of a scene
-    void existsInPacketBitsWritten();
+    void existsInPacketBitsWritten() { _existsInPacketBitsWritten++; }
 
     /// Fix up tracking statistics in case where bitmasks were removed for some reason
-    void childBitsRemoved(bool includesExistsBits);
+    void childBitsRemoved(bool includesExistsBits) {
+        _existsInPacketBitsWritten--;
+        if (includesExistsBits) {
+            _existsBitsWritten--;
+        }
+        _colorBitsWritten--;
+        _treesRemoved++;
+    }
 
     /// Pack the details of the statistics into a buffer for sending as a network packet
     int packIntoPacket();
@@ -177,9 +214,52 @@ private:
 
     void copyFromOther(const OctreeSceneStats& other);
 
+    /// serializes the full stats message - counters plus jurisdiction - into _statsPacket
+    void buildStatsTemplate();
+
+    // The leading fixed-size section of the stats message, in wire order. packIntoPacket()
+    // patches this block over the preserialized template in one memcpy per send instead of
+    // re-serializing the whole message field by field; only a jurisdiction change forces a
+    // rebuild of the template. Must stay in sync with unpackFromPacket().
+#pragma pack(push, 1)
+    struct PackedCounters {
+        quint64 start;
+        quint64 end;
+        quint64 elapsed;
+        quint64 totalEncodeTime;
+        bool isFullScene;
+        bool isMoving;
+        quint32 packets;
+        quint64 bytes;
+        quint64 totalInternal;
+        quint64 totalLeaves;
+        quint64 internal;
+        quint64 leaves;
+        quint64 internalSkippedDistance;
+        quint64 leavesSkippedDistance;
+        quint64 internalSkippedOutOfView;
+        quint64 leavesSkippedOutOfView;
+        quint64 internalSkippedWasInView;
+        quint64 leavesSkippedWasInView;
+        quint64 internalSkippedNoChange;
+        quint64 leavesSkippedNoChange;
+        quint64 internalSkippedOccluded;
+        quint64 leavesSkippedOccluded;
+        quint64 internalColorSent;
+        quint64 leavesColorSent;
+        quint64 internalDidntFit;
+        quint64 leavesDidntFit;
+        quint64 colorBitsWritten;
+        quint64 existsBitsWritten;
+        quint64 existsInPacketBitsWritten;
+        quint64 treesRemoved;
+    };
+#pragma pack(pop)
+
     bool _isReadyToSend;
 
     std::unique_ptr<NLPacket> _statsPacket = NLPacket::create(PacketType::OctreeStats);
+    bool _statsTemplateDirty { true };
 
     // scene timing data in usecs
     bool _isStarted;
@@ -548,13 +548,33 @@ void CharacterController::preSimulation() {
         const btScalar MAX_WALKING_SPEED = 2.5f;
         const quint64 RAY_HIT_START_PERIOD = 500 * MSECS_PER_SECOND;
 
-        ClosestNotMe rayCallback(_rigidBody);
-        rayCallback.m_closestHitFraction = 1.0f;
-        _dynamicsWorld->rayTest(rayStart, rayEnd, rayCallback);
-        bool rayHasHit = rayCallback.hasHit();
+        // most frames the floor is about where it was last frame, so first probe with a
+        // short ray just past the last known floor distance -- a full MAX_FALL_HEIGHT ray
+        // descends far more of the broadphase tree than a short one
+        bool rayHasHit = false;
+        const btScalar FLOOR_DISTANCE_MARGIN = 0.5f; // meters
+        if (_floorDistance < MAX_FALL_HEIGHT) {
+            btScalar shortRayLength = _radius + _halfHeight + _floorDistance + FLOOR_DISTANCE_MARGIN;
+            ClosestNotMe shortRayCallback(_rigidBody);
+            shortRayCallback.m_closestHitFraction = 1.0f;
+            _dynamicsWorld->rayTest(rayStart, rayStart - shortRayLength * _currentUp, shortRayCallback);
+            if (shortRayCallback.hasHit()) {
+                rayHasHit = true;
+                _floorDistance = shortRayLength * shortRayCallback.m_closestHitFraction - (_radius + _halfHeight);
+            }
+        }
+        if (!rayHasHit) {
+            // short probe missed (or we had no recent floor) --> scan the full fall height
+            ClosestNotMe rayCallback(_rigidBody);
+            rayCallback.m_closestHitFraction = 1.0f;
+            _dynamicsWorld->rayTest(rayStart, rayEnd, rayCallback);
+            rayHasHit = rayCallback.hasHit();
+            if (rayHasHit) {
+                _floorDistance = rayLength * rayCallback.m_closestHitFraction - (_radius + _halfHeight);
+            }
+        }
         if (rayHasHit) {
             _rayHitStartTime = now;
-            _floorDistance = rayLength * rayCallback.m_closestHitFraction - (_radius + _halfHeight);
         } else if ((now - _rayHitStartTime) < RAY_HIT_START_PERIOD) {
             rayHasHit = true;
         } else {
@@ -16,6 +16,8 @@
 #include <btBulletDynamicsCommon.h>
 #include <BulletCollision/CollisionShapes/btShapeHull.h>
 
+#include <NumericalConstants.h>
+#include <SharedUtil.h> // for usecTimestampNow
 #include <ShapeInfo.h> // for MAX_HULL_POINTS
 
 const int32_t MAX_HULL_INDICES = 6 * MAX_HULL_POINTS;
@@ -188,6 +190,34 @@ model::MeshPointer CollisionRenderMeshCache::getMesh(CollisionRenderMeshCache::K
     return mesh;
 }
 
+// limit on how much time requestMesh() may spend building new meshes within any one
+// frame-sized window -- toggling hull rendering in a domain with many entities requests
+// them all at once and would otherwise stall the render thread for seconds
+const uint64_t MAX_MESH_BUILD_TIME_PER_WINDOW = 3 * USECS_PER_MSEC;
+const uint64_t MESH_BUILD_WINDOW = USECS_PER_SECOND / 60;
+
+model::MeshPointer CollisionRenderMeshCache::requestMesh(CollisionRenderMeshCache::Key key) {
+    model::MeshPointer mesh;
+    if (key) {
+        CollisionMeshMap::const_iterator itr = _meshMap.find(key);
+        if (itr != _meshMap.end()) {
+            // cache hits are always free
+            return itr->second;
+        }
+        uint64_t now = usecTimestampNow();
+        if (now - _buildWindowStart > MESH_BUILD_WINDOW) {
+            _buildWindowStart = now;
+            _buildWindowSpent = 0;
+        }
+        if (_buildWindowSpent < MAX_MESH_BUILD_TIME_PER_WINDOW) {
+            mesh = getMesh(key);
+            _buildWindowSpent += usecTimestampNow() - now;
+        }
+        // else over budget: return nullptr and let the caller try again next frame
+    }
+    return mesh;
+}
+
 bool CollisionRenderMeshCache::releaseMesh(CollisionRenderMeshCache::Key key) {
     if (!key) {
         return false;
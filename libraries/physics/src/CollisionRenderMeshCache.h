@@ -29,6 +29,11 @@ public:
     /// \return pointer to geometry
     model::MeshPointer getMesh(Key key);
 
+    /// like getMesh() but only spends a bounded amount of time building new meshes per
+    /// frame-sized window -- returns nullptr when over budget and the caller should ask
+    /// again next frame
+    model::MeshPointer requestMesh(Key key);
+
     /// \return true if geometry was found and released
     bool releaseMesh(Key key);
 
@@ -43,6 +48,8 @@ private:
     using CollisionMeshMap = std::unordered_map<Key, model::MeshPointer>;
     CollisionMeshMap _meshMap;
     std::vector<Key> _pendingGarbage;
+    uint64_t _buildWindowStart { 0 };
+    uint64_t _buildWindowSpent { 0 };
 };
 
 #endif // hifi_CollisionRenderMeshCache_h
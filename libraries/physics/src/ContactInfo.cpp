@@ -11,6 +11,19 @@
 
 #include "ContactInfo.h"
 
+// default is one CONTINUE event per stable contact per ~0.1 sec of simulation
+const uint32_t DEFAULT_STEPS_BETWEEN_CONTINUE_EVENTS = 9;
+
+uint32_t ContactInfo::_stepsBetweenContinueEvents { DEFAULT_STEPS_BETWEEN_CONTINUE_EVENTS };
+
+void ContactInfo::setStepsBetweenContinueEvents(uint32_t steps) {
+    _stepsBetweenContinueEvents = steps > 0 ? steps : DEFAULT_STEPS_BETWEEN_CONTINUE_EVENTS;
+}
+
+uint32_t ContactInfo::getStepsBetweenContinueEvents() {
+    return _stepsBetweenContinueEvents;
+}
+
 void ContactInfo::update(uint32_t currentStep, const btManifoldPoint& p) {
     _lastStep = currentStep;
     positionWorldOnB = p.m_positionWorldOnB;
@@ -18,11 +31,9 @@ void ContactInfo::update(uint32_t currentStep, const btManifoldPoint& p) {
     distance = p.m_distance1;
 }
 
-const uint32_t STEPS_BETWEEN_CONTINUE_EVENTS = 9;
-
 ContactEventType ContactInfo::computeType(uint32_t thisStep) {
     if (_continueExpiry == 0) {
-        _continueExpiry = thisStep + STEPS_BETWEEN_CONTINUE_EVENTS;
+        _continueExpiry = thisStep + _stepsBetweenContinueEvents;
         return CONTACT_EVENT_TYPE_START;
     }
     return (_lastStep == thisStep) ? CONTACT_EVENT_TYPE_CONTINUE : CONTACT_EVENT_TYPE_END;
@@ -30,7 +41,7 @@ ContactEventType ContactInfo::computeType(uint32_t thisStep) {
 
 bool ContactInfo::readyForContinue(uint32_t thisStep) {
     if (thisStep > _continueExpiry) {
-        _continueExpiry = thisStep + STEPS_BETWEEN_CONTINUE_EVENTS;
+        _continueExpiry = thisStep + _stepsBetweenContinueEvents;
         return true;
     }
     return false;
@@ -20,6 +20,10 @@
 
 class ContactInfo {
 public:
+    // how many steps a persistent contact waits between CONTINUE events
+    static void setStepsBetweenContinueEvents(uint32_t steps);
+    static uint32_t getStepsBetweenContinueEvents();
+
     void update(uint32_t currentStep, const btManifoldPoint& p);
     ContactEventType computeType(uint32_t thisStep);
 
@@ -32,6 +36,8 @@ public:
     btVector3 normalWorldOnB;
     btScalar distance;
 private:
+    static uint32_t _stepsBetweenContinueEvents;
+
     uint32_t _lastStep { 0 };
     uint32_t _continueExpiry { 0 };
 };
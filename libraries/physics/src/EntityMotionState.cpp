@@ -229,29 +229,27 @@ void EntityMotionState::setWorldTransform(const btTransform& worldTrans) {
 
     assert(entityTreeIsLocked());
     measureBodyAcceleration();
-    bool positionSuccess;
-    _entity->setPosition(bulletToGLM(worldTrans.getOrigin()) + ObjectMotionState::getWorldOffset(), positionSuccess, false);
-    if (!positionSuccess) {
-        static QString repeatedMessage =
-            LogHandler::getInstance().addRepeatedMessageRegex("EntityMotionState::setWorldTransform "
-                                                              "setPosition failed.*");
-        qCDebug(physics) << "EntityMotionState::setWorldTransform setPosition failed" << _entity->getID();
-    }
-    bool orientationSuccess;
-    _entity->setOrientation(bulletToGLM(worldTrans.getRotation()), orientationSuccess, false);
-    if (!orientationSuccess) {
+
+    // write position and orientation in one pass -- this is the hot loop of the "copy results
+    // out" phase of the step and doing them separately pays for the parent-transform lookup
+    // and the locationChanged() walk twice per moved entity
+    bool transformSuccess;
+    _entity->setPositionAndOrientation(bulletToGLM(worldTrans.getOrigin()) + ObjectMotionState::getWorldOffset(),
+                                       bulletToGLM(worldTrans.getRotation()), transformSuccess, false);
+    if (!transformSuccess) {
         static QString repeatedMessage =
             LogHandler::getInstance().addRepeatedMessageRegex("EntityMotionState::setWorldTransform "
-                                                              "setOrientation failed.*");
-        qCDebug(physics) << "EntityMotionState::setWorldTransform setOrientation failed" << _entity->getID();
+                                                              "setPositionAndOrientation failed.*");
+        qCDebug(physics) << "EntityMotionState::setWorldTransform setPositionAndOrientation failed" << _entity->getID();
     }
     _entity->setVelocity(getBodyLinearVelocity());
     _entity->setAngularVelocity(getBodyAngularVelocity());
-    _entity->setLastSimulated(usecTimestampNow());
+    quint64 now = usecTimestampNow();
+    _entity->setLastSimulated(now);
 
     if (_entity->getSimulatorID().isNull()) {
         _loopsWithoutOwner++;
-        if (_loopsWithoutOwner > LOOPS_FOR_SIMULATION_ORPHAN && usecTimestampNow() > _nextOwnershipBid) {
+        if (_loopsWithoutOwner > LOOPS_FOR_SIMULATION_ORPHAN && now > _nextOwnershipBid) {
             upgradeOutgoingPriority(VOLUNTEER_SIMULATION_PRIORITY);
         }
     }
@@ -12,8 +12,14 @@
 #include <assert.h>
 #include <stdint.h>
 
+#include <thread>
+#include <vector>
+
 #include "MeshMassProperties.h"
 
+// meshes smaller than this aren't worth the thread spawn overhead
+const uint32_t MIN_TRIANGLES_PER_PARALLEL_CHUNK = 8192;
+
 // this method is included for unit test verification
 void computeBoxInertia(btScalar mass, const btVector3& diagonal, btMatrix3x3& inertia) {
     // formula for box inertia tensor:
@@ -248,26 +254,17 @@ void applyInverseParallelAxisTheorem(btMatrix3x3& inertia, const btVector3& shif
     }
 }
 
-MeshMassProperties::MeshMassProperties(const VectorOfPoints& points, const VectorOfIndices& triangleIndices) {
-    computeMassProperties(points, triangleIndices);
-}
-
-void MeshMassProperties::computeMassProperties(const VectorOfPoints& points, const VectorOfIndices& triangleIndices) {
-    // We process the mesh one triangle at a time.  Each triangle defines a tetrahedron 
-    // relative to some local point p0 (which we chose to be the local origin for convenience). 
-    // Each tetrahedron contributes to the three totals: volume, centerOfMass, and inertiaTensor.
+// accumulate the contributions of a contiguous range of triangles into the given totals
+static void accumulateTetrahedra(const VectorOfPoints& points, const VectorOfIndices& triangleIndices,
+        uint32_t firstTriangle, uint32_t numTriangles,
+        btScalar& totalVolume, btVector3& weightedCenter, btMatrix3x3& totalInertia) {
+    // Each triangle defines a tetrahedron relative to some local point p0 (which we chose
+    // to be the local origin for convenience).  Each tetrahedron contributes to the three
+    // totals: volume, centerOfMass, and inertiaTensor.
     //
-    // We assume the mesh triangles are wound using the right-hand-rule, such that the 
+    // We assume the mesh triangles are wound using the right-hand-rule, such that the
     // triangle's points circle counter-clockwise about its face normal.
-    // 
-
-    // initialize the totals
-    _volume = btScalar(0.0f);
-    btVector3 weightedCenter;
-    weightedCenter.setZero();
-    for (uint32_t i = 0; i < 3; ++i) {
-        _inertia[i].setZero();
-    }
+    //
 
     // create some variables to hold temporary results
     #ifndef NDEBUG
@@ -275,13 +272,12 @@ void MeshMassProperties::computeMassProperties(const VectorOfPoints& points, con
     #endif
     const btVector3 p0(0.0f, 0.0f, 0.0f);
     btMatrix3x3 tetraInertia;
-    btMatrix3x3 doubleDebugInertia;
     btVector3 tetraPoints[4];
     btVector3 center;
-    
+
     // loop over triangles
-    uint32_t numTriangles = (uint32_t)triangleIndices.size() / 3;
-    for (uint32_t i = 0; i < numTriangles; ++i) {
+    uint32_t endTriangle = firstTriangle + numTriangles;
+    for (uint32_t i = firstTriangle; i < endTriangle; ++i) {
         uint32_t t = 3 * i;
         #ifndef NDEBUG
         assert(triangleIndices[t] < numPoints);
@@ -314,12 +310,59 @@ void MeshMassProperties::computeMassProperties(const VectorOfPoints& points, con
 
         // tally results
         weightedCenter += volume * center;
-        _volume += volume;
-        _inertia += tetraInertia;
+        totalVolume += volume;
+        totalInertia += tetraInertia;
+    }
+}
+
+MeshMassProperties::MeshMassProperties(const VectorOfPoints& points, const VectorOfIndices& triangleIndices) {
+    computeMassProperties(points, triangleIndices);
+}
+
+void MeshMassProperties::computeMassProperties(const VectorOfPoints& points, const VectorOfIndices& triangleIndices) {
+    // initialize the totals
+    _volume = btScalar(0.0f);
+    btVector3 weightedCenter;
+    weightedCenter.setZero();
+    for (uint32_t i = 0; i < 3; ++i) {
+        _inertia[i].setZero();
+    }
+
+    uint32_t numTriangles = (uint32_t)triangleIndices.size() / 3;
+    uint32_t numThreads = (uint32_t)std::thread::hardware_concurrency();
+    if (numTriangles >= 2 * MIN_TRIANGLES_PER_PARALLEL_CHUNK && numThreads > 1) {
+        // the mesh is big enough to be worth reducing in parallel: chunk the triangles
+        // across worker threads with per-thread accumulators, then combine
+        uint32_t numChunks = numTriangles / MIN_TRIANGLES_PER_PARALLEL_CHUNK;
+        if (numChunks > numThreads) {
+            numChunks = numThreads;
+        }
+        std::vector<btScalar> volumes(numChunks, btScalar(0.0f));
+        std::vector<btVector3> centers(numChunks, btVector3(0.0f, 0.0f, 0.0f));
+        std::vector<btMatrix3x3> inertias(numChunks);
+        std::vector<std::thread> workers;
+        workers.reserve(numChunks);
+
+        uint32_t trianglesPerChunk = numTriangles / numChunks;
+        for (uint32_t i = 0; i < numChunks; ++i) {
+            uint32_t firstTriangle = i * trianglesPerChunk;
+            uint32_t chunkSize = (i == numChunks - 1) ? numTriangles - firstTriangle : trianglesPerChunk;
+            inertias[i] = btMatrix3x3(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+            workers.emplace_back(accumulateTetrahedra, std::cref(points), std::cref(triangleIndices),
+                    firstTriangle, chunkSize, std::ref(volumes[i]), std::ref(centers[i]), std::ref(inertias[i]));
+        }
+        for (uint32_t i = 0; i < numChunks; ++i) {
+            workers[i].join();
+            _volume += volumes[i];
+            weightedCenter += centers[i];
+            _inertia += inertias[i];
+        }
+    } else {
+        accumulateTetrahedra(points, triangleIndices, 0, numTriangles, _volume, weightedCenter, _inertia);
     }
 
     _centerOfMass = weightedCenter / _volume;
-    
+
     applyInverseParallelAxisTheorem(_inertia, _centerOfMass, _volume);
 }
 
@@ -0,0 +1,153 @@
+//
+//  PhysicsCapture.cpp
+//  libraries/physics/src
+//
+//  Created by Andrew Meadows 2017.01.17
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsCapture.h"
+
+#include "PhysicsLogging.h"
+
+const quint32 PHYSICS_CAPTURE_MAGIC = 0x48465043; // "HFPC"
+const quint32 PHYSICS_CAPTURE_VERSION = 1;
+
+// record tags so bodies added mid-capture can be interleaved with steps
+const quint8 RECORD_BODY = 0;
+const quint8 RECORD_STEP = 1;
+
+static void writeVector(QDataStream& stream, const btVector3& v) {
+    stream << (float)v.getX() << (float)v.getY() << (float)v.getZ();
+}
+
+static btVector3 readVector(QDataStream& stream) {
+    float x, y, z;
+    stream >> x >> y >> z;
+    return btVector3(x, y, z);
+}
+
+bool PhysicsCaptureRecorder::start(const QString& filePath) {
+    if (_isCapturing) {
+        return false;
+    }
+    _file.setFileName(filePath);
+    if (!_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(physics) << "PhysicsCaptureRecorder failed to open" << filePath;
+        return false;
+    }
+    _stream.setDevice(&_file);
+    _stream << PHYSICS_CAPTURE_MAGIC << PHYSICS_CAPTURE_VERSION;
+    _isCapturing = true;
+    return true;
+}
+
+void PhysicsCaptureRecorder::stop() {
+    if (_isCapturing) {
+        _isCapturing = false;
+        _stream.setDevice(nullptr);
+        _file.close();
+    }
+}
+
+void PhysicsCaptureRecorder::captureBody(const btRigidBody* body) {
+    if (!_isCapturing || !body || body->isStaticOrKinematicObject()) {
+        // static and kinematic bodies don't contribute solver load we can replay
+        return;
+    }
+    const btCollisionShape* shape = body->getCollisionShape();
+    if (!shape) {
+        return;
+    }
+
+    int32_t shapeType = shape->getShapeType();
+    btVector3 halfExtents;
+    if (shapeType == SPHERE_SHAPE_PROXYTYPE) {
+        btScalar radius = static_cast<const btSphereShape*>(shape)->getRadius();
+        halfExtents = btVector3(radius, radius, radius);
+    } else {
+        // approximate everything else by its local AABB
+        btTransform identity;
+        identity.setIdentity();
+        btVector3 aabbMin, aabbMax;
+        shape->getAabb(identity, aabbMin, aabbMax);
+        halfExtents = 0.5f * (aabbMax - aabbMin);
+    }
+
+    float mass = body->getInvMass() > 0.0f ? 1.0f / body->getInvMass() : 0.0f;
+
+    _stream << RECORD_BODY << (qint32)shapeType;
+    writeVector(_stream, halfExtents);
+    _stream << mass;
+    writeVector(_stream, body->getWorldTransform().getOrigin());
+    btQuaternion rotation = body->getWorldTransform().getRotation();
+    _stream << (float)rotation.getX() << (float)rotation.getY() << (float)rotation.getZ() << (float)rotation.getW();
+    writeVector(_stream, body->getLinearVelocity());
+    writeVector(_stream, body->getAngularVelocity());
+    writeVector(_stream, body->getGravity());
+    _stream << (quint8)(body->isActive() ? 1 : 0);
+}
+
+void PhysicsCaptureRecorder::captureStep(float timeStep) {
+    if (!_isCapturing) {
+        return;
+    }
+    _stream << RECORD_STEP << timeStep;
+}
+
+bool PhysicsCaptureReader::read(const QString& filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(physics) << "PhysicsCaptureReader failed to open" << filePath;
+        return false;
+    }
+    QDataStream stream(&file);
+
+    quint32 magic, version;
+    stream >> magic >> version;
+    if (magic != PHYSICS_CAPTURE_MAGIC || version != PHYSICS_CAPTURE_VERSION) {
+        qCWarning(physics) << "PhysicsCaptureReader bad header in" << filePath;
+        return false;
+    }
+
+    _bodies.clear();
+    _steps.clear();
+    while (!stream.atEnd()) {
+        quint8 tag;
+        stream >> tag;
+        if (tag == RECORD_BODY) {
+            PhysicsCaptureBody body;
+            qint32 shapeType;
+            stream >> shapeType;
+            body.shapeType = shapeType;
+            body.halfExtents = readVector(stream);
+            stream >> body.mass;
+            btVector3 position = readVector(stream);
+            float x, y, z, w;
+            stream >> x >> y >> z >> w;
+            body.transform = btTransform(btQuaternion(x, y, z, w), position);
+            body.linearVelocity = readVector(stream);
+            body.angularVelocity = readVector(stream);
+            body.gravity = readVector(stream);
+            quint8 isActive;
+            stream >> isActive;
+            body.isActive = (isActive != 0);
+            _bodies.push_back(body);
+        } else if (tag == RECORD_STEP) {
+            float timeStep;
+            stream >> timeStep;
+            _steps.push_back(timeStep);
+        } else {
+            qCWarning(physics) << "PhysicsCaptureReader unknown record tag" << tag << "in" << filePath;
+            return false;
+        }
+        if (stream.status() != QDataStream::Ok) {
+            qCWarning(physics) << "PhysicsCaptureReader truncated stream in" << filePath;
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,67 @@
+//
+//  PhysicsCapture.h
+//  libraries/physics/src
+//
+//  Created by Andrew Meadows 2017.01.17
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsCapture_h
+#define hifi_PhysicsCapture_h
+
+#include <vector>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include <btBulletDynamicsCommon.h>
+
+// one rigid body as captured when it entered the simulation (or when capture started)
+struct PhysicsCaptureBody {
+    int32_t shapeType;  // btBroadphaseProxy type of the original shape
+    btVector3 halfExtents;  // box half extents, or (radius, radius, radius) for spheres
+    float mass;
+    btTransform transform;
+    btVector3 linearVelocity;
+    btVector3 angularVelocity;
+    btVector3 gravity;
+    bool isActive;
+};
+
+/// Records a compact stream of rigid body states and step timesteps from a live
+/// simulation, for headless re-stepping in perf regression tests. Non-primitive
+/// shapes are approximated by their local AABB box, so replay reproduces solver
+/// load rather than exact trajectories.
+class PhysicsCaptureRecorder {
+public:
+    bool start(const QString& filePath);
+    void stop();
+    bool isCapturing() const { return _isCapturing; }
+
+    void captureBody(const btRigidBody* body);
+    void captureStep(float timeStep);
+
+private:
+    QFile _file;
+    QDataStream _stream;
+    bool _isCapturing { false };
+};
+
+/// Reads a capture written by PhysicsCaptureRecorder back into memory.
+class PhysicsCaptureReader {
+public:
+    bool read(const QString& filePath);
+
+    const std::vector<PhysicsCaptureBody>& getBodies() const { return _bodies; }
+    const std::vector<float>& getSteps() const { return _steps; }
+
+private:
+    std::vector<PhysicsCaptureBody> _bodies;
+    std::vector<float> _steps;
+};
+
+#endif // hifi_PhysicsCapture_h
@@ -20,9 +20,32 @@
 #include "ThreadSafeDynamicsWorld.h"
 #include "PhysicsLogging.h"
 
+// above this many other-avatar bodies, avatar-avatar collision response is dropped --
+// in a dense crowd the capsules genuinely overlap and the resulting pairs melt the solver
+const int32_t DEFAULT_AVATAR_CROWD_COLLISION_THRESHOLD = 50;
+
+// filter callback installed on the pair cache: applies the usual group/mask test and
+// additionally drops other-avatar vs other-avatar pairs when the crowd is too dense
+class CrowdFilterCallback : public btOverlapFilterCallback {
+public:
+    bool needBroadphaseCollision(btBroadphaseProxy* proxy0, btBroadphaseProxy* proxy1) const override {
+        bool collides = (proxy0->m_collisionFilterGroup & proxy1->m_collisionFilterMask) != 0 &&
+                (proxy1->m_collisionFilterGroup & proxy0->m_collisionFilterMask) != 0;
+        if (collides && _dropAvatarAvatarCollisions &&
+                proxy0->m_collisionFilterGroup == BULLET_COLLISION_GROUP_OTHER_AVATAR &&
+                proxy1->m_collisionFilterGroup == BULLET_COLLISION_GROUP_OTHER_AVATAR) {
+            return false;
+        }
+        return collides;
+    }
+
+    bool _dropAvatarAvatarCollisions { false };
+};
+
 PhysicsEngine::PhysicsEngine(const glm::vec3& offset) :
         _originOffset(offset),
-        _myAvatarController(nullptr) {
+        _myAvatarController(nullptr),
+        _avatarCrowdCollisionThreshold(DEFAULT_AVATAR_CROWD_COLLISION_THRESHOLD) {
 }
 
 PhysicsEngine::~PhysicsEngine() {
@@ -35,11 +58,20 @@ PhysicsEngine::~PhysicsEngine() {
     delete _constraintSolver;
     delete _dynamicsWorld;
     delete _ghostPairCallback;
+    delete _crowdFilterCallback;
 }
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
-        _collisionConfig = new btDefaultCollisionConfiguration();
+        // dense scenes overflow Bullet's default pools (4096 entries), after which it falls back to
+        // one heap allocation per contact manifold and collision algorithm - reserve larger pools up front
+        btDefaultCollisionConstructionInfo collisionConstructionInfo;
+        const int MAX_PERSISTENT_MANIFOLD_POOL_SIZE = 16384;
+        const int MAX_COLLISION_ALGORITHM_POOL_SIZE = 16384;
+        collisionConstructionInfo.m_defaultMaxPersistentManifoldPoolSize = MAX_PERSISTENT_MANIFOLD_POOL_SIZE;
+        collisionConstructionInfo.m_defaultMaxCollisionAlgorithmPoolSize = MAX_COLLISION_ALGORITHM_POOL_SIZE;
+
+        _collisionConfig = new btDefaultCollisionConfiguration(collisionConstructionInfo);
         _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
         _constraintSolver = new btSequentialImpulseConstraintSolver;
@@ -48,6 +80,13 @@ void PhysicsEngine::init() {
         _ghostPairCallback = new btGhostPairCallback();
         _dynamicsWorld->getPairCache()->setInternalGhostPairCallback(_ghostPairCallback);
 
+        _crowdFilterCallback = new CrowdFilterCallback();
+        _dynamicsWorld->getPairCache()->setOverlapFilterCallback(_crowdFilterCallback);
+
+        // cache friction directions between steps so the solver doesn't recompute them
+        // for every manifold point in contact-heavy scenes
+        _dynamicsWorld->getSolverInfo().m_solverMode |= SOLVER_ENABLE_FRICTION_DIRECTION_CACHING;
+
         // default gravity of the world is zero, so each object must specify its own gravity
         // TODO: set up gravity zones
         _dynamicsWorld->setGravity(btVector3(0.0f, 0.0f, 0.0f));
@@ -139,6 +178,15 @@ void PhysicsEngine::addObjectToDynamicsWorld(ObjectMotionState* motionState) {
     motionState->computeCollisionGroupAndMask(group, mask);
     _dynamicsWorld->addRigidBody(body, group, mask);
 
+    if (group == BULLET_COLLISION_GROUP_OTHER_AVATAR) {
+        ++_numOtherAvatarBodies;
+        updateAvatarCrowdFilter();
+    }
+
+    if (_captureRecorder.isCapturing()) {
+        _captureRecorder.captureBody(body);
+    }
+
     motionState->clearIncomingDirtyFlags();
 }
 
@@ -175,6 +223,10 @@ void PhysicsEngine::removeObjects(const VectorOfMotionStates& objects) {
     for (auto object : objects) {
         btRigidBody* body = object->getRigidBody();
         if (body) {
+            if (body->getBroadphaseHandle() &&
+                    body->getBroadphaseHandle()->m_collisionFilterGroup == BULLET_COLLISION_GROUP_OTHER_AVATAR) {
+                --_numOtherAvatarBodies;
+            }
             _dynamicsWorld->removeRigidBody(body);
 
             // NOTE: setRigidBody() modifies body->m_userPointer so we should clear the MotionState's body BEFORE deleting it.
@@ -183,6 +235,7 @@ void PhysicsEngine::removeObjects(const VectorOfMotionStates& objects) {
             delete body;
         }
     }
+    updateAvatarCrowdFilter();
 }
 
 // Same as above, but takes a Set instead of a Vector.  Should only be called during teardown.
@@ -191,6 +244,10 @@ void PhysicsEngine::removeObjects(const SetOfMotionStates& objects) {
     for (auto object : objects) {
         btRigidBody* body = object->getRigidBody();
         if (body) {
+            if (body->getBroadphaseHandle() &&
+                    body->getBroadphaseHandle()->m_collisionFilterGroup == BULLET_COLLISION_GROUP_OTHER_AVATAR) {
+                --_numOtherAvatarBodies;
+            }
             _dynamicsWorld->removeRigidBody(body);
 
             // NOTE: setRigidBody() modifies body->m_userPointer so we should clear the MotionState's body BEFORE deleting it.
@@ -199,6 +256,7 @@ void PhysicsEngine::removeObjects(const SetOfMotionStates& objects) {
             delete body;
         }
     }
+    updateAvatarCrowdFilter();
 }
 
 void PhysicsEngine::addObjects(const VectorOfMotionStates& objects) {
@@ -258,6 +316,50 @@ void PhysicsEngine::removeContacts(ObjectMotionState* motionState) {
     }
 }
 
+// simulation LOD: dynamic bodies far from the avatar get progressively larger sleeping
+// thresholds so they deactivate sooner and drop out of the solver; the thresholds are
+// restored smoothly as the avatar approaches so nearby simulation quality is unchanged
+const float SIMULATION_LOD_NEAR_DISTANCE = 30.0f; // meters
+const float SIMULATION_LOD_FAR_DISTANCE = 60.0f; // meters
+const float SIMULATION_LOD_FAR_THRESHOLD_SCALE = 4.0f;
+const uint32_t SIMULATION_LOD_UPDATE_PERIOD = 45; // substeps, about twice per second
+
+void PhysicsEngine::updateSimulationLOD() {
+    if (!_myAvatarController) {
+        // without an avatar everything simulates at full fidelity (e.g. server-side simulation)
+        return;
+    }
+    if (_numSubsteps - _lastSimulationLODStep < SIMULATION_LOD_UPDATE_PERIOD) {
+        return;
+    }
+    _lastSimulationLODStep = _numSubsteps;
+    BT_PROFILE("simulationLOD");
+
+    glm::vec3 avatarPosition;
+    glm::quat avatarRotation;
+    _myAvatarController->getPositionAndOrientation(avatarPosition, avatarRotation);
+    btVector3 center = glmToBullet(avatarPosition);
+
+    auto& nonStaticBodies = _dynamicsWorld->getNonStaticRigidBodies();
+    for (int32_t i = 0; i < nonStaticBodies.size(); ++i) {
+        btRigidBody* body = nonStaticBodies[i];
+        if (body->isKinematicObject() || !body->getMotionState()) {
+            // kinematic objects are driven from outside the simulation and the avatar's own
+            // body is the only one without a MotionState -- neither gets LOD treatment
+            continue;
+        }
+        float distance = (body->getWorldTransform().getOrigin() - center).length();
+        float scale = 1.0f;
+        if (distance > SIMULATION_LOD_NEAR_DISTANCE) {
+            float fraction = btMin((distance - SIMULATION_LOD_NEAR_DISTANCE) /
+                    (SIMULATION_LOD_FAR_DISTANCE - SIMULATION_LOD_NEAR_DISTANCE), 1.0f);
+            scale = 1.0f + fraction * (SIMULATION_LOD_FAR_THRESHOLD_SCALE - 1.0f);
+        }
+        body->setSleepingThresholds(scale * DYNAMIC_LINEAR_SPEED_THRESHOLD,
+                scale * DYNAMIC_ANGULAR_SPEED_THRESHOLD);
+    }
+}
+
 void PhysicsEngine::stepSimulation() {
     CProfileManager::Reset();
     BT_PROFILE("stepSimulation");
@@ -292,10 +394,16 @@ void PhysicsEngine::stepSimulation() {
         _myAvatarController->preSimulation();
     }
 
+    updateSimulationLOD();
+
     auto onSubStep = [this]() {
         this->updateContactMap();
     };
 
+    if (_captureRecorder.isCapturing()) {
+        _captureRecorder.captureStep(timeStep);
+    }
+
     int numSubsteps = _dynamicsWorld->stepSimulationWithSubstepCallback(timeStep, PHYSICS_ENGINE_MAX_NUM_SUBSTEPS,
                                                                         PHYSICS_ENGINE_FIXED_SUBSTEP, onSubStep);
     if (numSubsteps > 0) {
@@ -307,10 +415,66 @@ void PhysicsEngine::stepSimulation() {
             _myAvatarController->postSimulation();
         }
 
+        // count the simulation islands the solver dispatched this step - an object whose island
+        // tag is its own index in the collision object array is the representative of its island,
+        // so scaling problems (one mega-island vs many small ones) show up in the stats
+        int32_t numIslands = 0;
+        auto& collisionObjects = _dynamicsWorld->getCollisionObjectArray();
+        for (int32_t i = 0; i < collisionObjects.size(); ++i) {
+            if (collisionObjects[i]->getIslandTag() == i) {
+                ++numIslands;
+            }
+        }
+        _numIslands = numIslands;
+
         _hasOutgoingChanges = true;
     }
 }
 
+void PhysicsEngine::setAvatarCrowdCollisionThreshold(int32_t numAvatars) {
+    _avatarCrowdCollisionThreshold = numAvatars;
+    updateAvatarCrowdFilter();
+}
+
+void PhysicsEngine::updateAvatarCrowdFilter() {
+    if (!_crowdFilterCallback) {
+        return;
+    }
+    bool shouldDrop = _numOtherAvatarBodies > _avatarCrowdCollisionThreshold;
+    if (shouldDrop != _crowdFilterCallback->_dropAvatarAvatarCollisions) {
+        _crowdFilterCallback->_dropAvatarAvatarCollisions = shouldDrop;
+        // the filter callback is only consulted when new overlaps enter the pair cache,
+        // so clean existing avatar-avatar pairs out when the crowd crosses the threshold
+        if (shouldDrop && _dynamicsWorld) {
+            auto& collisionObjects = _dynamicsWorld->getCollisionObjectArray();
+            for (int32_t i = 0; i < collisionObjects.size(); ++i) {
+                btBroadphaseProxy* proxy = collisionObjects[i]->getBroadphaseHandle();
+                if (proxy && proxy->m_collisionFilterGroup == BULLET_COLLISION_GROUP_OTHER_AVATAR) {
+                    _dynamicsWorld->getPairCache()->cleanProxyFromPairs(proxy, _collisionDispatcher);
+                }
+            }
+        }
+    }
+}
+
+bool PhysicsEngine::startCapture(const QString& filePath) {
+    if (!_captureRecorder.start(filePath)) {
+        return false;
+    }
+    // snapshot the bodies already in the simulation; bodies added later are
+    // captured as they arrive in addObjectToDynamicsWorld()
+    if (_dynamicsWorld) {
+        auto& collisionObjects = _dynamicsWorld->getCollisionObjectArray();
+        for (int32_t i = 0; i < collisionObjects.size(); ++i) {
+            btRigidBody* body = btRigidBody::upcast(collisionObjects[i]);
+            if (body) {
+                _captureRecorder.captureBody(body);
+            }
+        }
+    }
+    return true;
+}
+
 void PhysicsEngine::harvestPerformanceStats() {
     // unfortunately the full context names get too long for our stats presentation format
     //QString contextName = PerformanceTimer::getContextName(); // TODO: how to show full context name?
@@ -418,6 +582,13 @@ void PhysicsEngine::updateContactMap() {
 const CollisionEvents& PhysicsEngine::getCollisionEvents() {
     _collisionEvents.clear();
 
+    // cap CONTINUE events per harvest: a pile of stacked entities can hold hundreds of
+    // deep persistent contacts and each event crosses into script dispatch. Contacts
+    // skipped by the cap keep their expired timers and take their turn next harvest,
+    // so stable piles notify at a bounded aggregate rate. START and END always deliver.
+    const uint32_t MAX_CONTINUE_EVENTS_PER_HARVEST = 64;
+    uint32_t numContinueEvents = 0;
+
     // scan known contacts and trigger events
     ContactMap::iterator contactItr = _contactMap.begin();
 
@@ -425,9 +596,14 @@ const CollisionEvents& PhysicsEngine::getCollisionEvents() {
         ContactInfo& contact = contactItr->second;
         ContactEventType type = contact.computeType(_numContactFrames);
         const btScalar SIGNIFICANT_DEPTH = -0.002f; // penetrations have negative distance
-        if (type != CONTACT_EVENT_TYPE_CONTINUE ||
-                (contact.distance < SIGNIFICANT_DEPTH &&
-                 contact.readyForContinue(_numContactFrames))) {
+        bool isThrottledContinue = type == CONTACT_EVENT_TYPE_CONTINUE &&
+                (contact.distance >= SIGNIFICANT_DEPTH ||
+                 numContinueEvents >= MAX_CONTINUE_EVENTS_PER_HARVEST ||
+                 !contact.readyForContinue(_numContactFrames));
+        if (type == CONTACT_EVENT_TYPE_CONTINUE && !isThrottledContinue) {
+            ++numContinueEvents;
+        }
+        if (!isThrottledContinue) {
             ObjectMotionState* motionStateA = static_cast<ObjectMotionState*>(contactItr->first._a);
             ObjectMotionState* motionStateB = static_cast<ObjectMotionState*>(contactItr->first._b);
 
@@ -489,6 +665,7 @@ void PhysicsEngine::dumpStatsIfNecessary() {
     if (_dumpNextStats) {
         _dumpNextStats = false;
         CProfileManager::dumpAll();
+        qCDebug(physics) << "num simulation islands =" << _numIslands;
     }
 }
 
@@ -22,12 +22,14 @@
 #include "BulletUtil.h"
 #include "ContactInfo.h"
 #include "ObjectMotionState.h"
+#include "PhysicsCapture.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "ObjectAction.h"
 
 const float HALF_SIMULATION_EXTENT = 512.0f; // meters
 
 class CharacterController;
+class CrowdFilterCallback;
 
 // simple class for keeping track of contacts
 class ContactKey {
@@ -51,6 +53,9 @@ public:
 
     uint32_t getNumSubsteps();
 
+    /// \return number of simulation islands the solver dispatched during the last step
+    int32_t getNumIslands() const { return _numIslands; }
+
     void removeObjects(const VectorOfMotionStates& objects);
     void removeObjects(const SetOfMotionStates& objects); // only called during teardown
 
@@ -83,13 +88,29 @@ public:
 
     void dumpNextStats() { _dumpNextStats = true; }
 
+    /// \param period number of substeps a persistent contact waits between CONTINUE events
+    void setContactEventPeriod(uint32_t period) { ContactInfo::setStepsBetweenContinueEvents(period); }
+
+    /// \param numAvatars above this many other-avatar bodies, avatar-avatar collisions are dropped
+    void setAvatarCrowdCollisionThreshold(int32_t numAvatars);
+
     EntityActionPointer getActionByID(const QUuid& actionID) const;
     void addAction(EntityActionPointer action);
     void removeAction(const QUuid actionID);
     void forEachAction(std::function<void(EntityActionPointer)> actor);
 
+    /// \brief start recording body states and step timesteps for offline replay
+    bool startCapture(const QString& filePath);
+    void stopCapture() { _captureRecorder.stop(); }
+
 private:
     void addObjectToDynamicsWorld(ObjectMotionState* motionState);
+
+    /// \brief scale sleeping thresholds of dynamic bodies by distance from the avatar
+    void updateSimulationLOD();
+
+    /// \brief enable/disable avatar-avatar pair dropping based on current crowd size
+    void updateAvatarCrowdFilter();
     void recursivelyHarvestPerformanceStats(CProfileIterator* profileIterator, QString contextName);
 
     /// \brief bump any objects that touch this one, then remove contact info
@@ -106,9 +127,11 @@ private:
     btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
+    CrowdFilterCallback* _crowdFilterCallback = NULL;
 
     ContactMap _contactMap;
     CollisionEvents _collisionEvents;
+    PhysicsCaptureRecorder _captureRecorder;
     QHash<QUuid, EntityActionPointer> _objectActions;
     std::vector<btRigidBody*> _activeStaticBodies;
 
@@ -118,6 +141,10 @@ private:
 
     uint32_t _numContactFrames = 0;
     uint32_t _numSubsteps;
+    uint32_t _lastSimulationLODStep = 0;
+    int32_t _numIslands = 0;
+    int32_t _numOtherAvatarBodies = 0;
+    int32_t _avatarCrowdCollisionThreshold;
 
     bool _dumpNextStats = false;
     bool _hasOutgoingChanges = false;
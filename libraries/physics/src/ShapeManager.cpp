@@ -16,6 +16,19 @@
 #include "ShapeFactory.h"
 #include "ShapeManager.h"
 
+// cap on the number of zero-reference cooked shapes we hang on to before deleting the oldest
+const int MAX_RETAINED_COOKED_SHAPES = 64;
+
+// hull decomposition and mesh processing are expensive enough that re-cooking on entity churn
+// causes visible hitches on the simulation thread -- these shapes are worth retaining after
+// their last reference is released
+static bool isShapeExpensiveToCook(int shapeType) {
+    return shapeType == SHAPE_TYPE_COMPOUND
+        || shapeType == SHAPE_TYPE_SIMPLE_HULL
+        || shapeType == SHAPE_TYPE_SIMPLE_COMPOUND
+        || shapeType == SHAPE_TYPE_STATIC_MESH;
+}
+
 ShapeManager::ShapeManager() {
 }
 
@@ -26,6 +39,7 @@ ShapeManager::~ShapeManager() {
         ShapeFactory::deleteShape(shapeRef->shape);
     }
     _shapeMap.clear();
+    _shapesByPointer.clear();
 }
 
 const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
@@ -42,6 +56,18 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
     DoubleHashKey key = info.getHash();
     ShapeReference* shapeRef = _shapeMap.find(key);
     if (shapeRef) {
+        if (shapeRef->refCount == 0) {
+            // this shape was being retained at zero references -- stop tracking it for eviction
+            for (int i = 0; i < _retainedCookedShapes.size(); ++i) {
+                if (_retainedCookedShapes[i].equals(key)) {
+                    for (int j = i + 1; j < _retainedCookedShapes.size(); ++j) {
+                        _retainedCookedShapes[j - 1] = _retainedCookedShapes[j];
+                    }
+                    _retainedCookedShapes.pop_back();
+                    break;
+                }
+            }
+        }
         shapeRef->refCount++;
         return shapeRef->shape;
     }
@@ -51,7 +77,9 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         newRef.refCount = 1;
         newRef.shape = shape;
         newRef.key = key;
+        newRef.shapeType = info.getType();
         _shapeMap.insert(key, newRef);
+        _shapesByPointer[shape] = key;
     }
     return shape;
 }
@@ -82,24 +110,59 @@ bool ShapeManager::releaseShapeByKey(const DoubleHashKey& key) {
 }
 
 bool ShapeManager::releaseShape(const btCollisionShape* shape) {
-    int numShapes = _shapeMap.size();
-    for (int i = 0; i < numShapes; ++i) {
-        ShapeReference* shapeRef = _shapeMap.getAtIndex(i);
-        if (shape == shapeRef->shape) {
-            return releaseShapeByKey(shapeRef->key);
-        }
+    auto itr = _shapesByPointer.find(shape);
+    if (itr != _shapesByPointer.end()) {
+        return releaseShapeByKey(itr->second);
     }
     return false;
 }
 
+// private helper method
+void ShapeManager::removeShapeFromIndexes(const ShapeReference* shapeRef) {
+    // copy the key before removal invalidates shapeRef
+    DoubleHashKey key = shapeRef->key;
+    _shapesByPointer.erase(shapeRef->shape);
+    _shapeMap.remove(key);
+}
+
 void ShapeManager::collectGarbage() {
     int numShapes = _pendingGarbage.size();
     for (int i = 0; i < numShapes; ++i) {
         DoubleHashKey& key = _pendingGarbage[i];
         ShapeReference* shapeRef = _shapeMap.find(key);
         if (shapeRef && shapeRef->refCount == 0) {
-            ShapeFactory::deleteShape(shapeRef->shape);
-            _shapeMap.remove(key);
+            if (isShapeExpensiveToCook(shapeRef->shapeType)) {
+                // hang on to this one -- entities cycling in and out of the simulation would
+                // otherwise re-cook the same hulls over and over
+                // (_pendingGarbage can contain duplicate keys, so avoid tracking one twice)
+                bool alreadyRetained = false;
+                for (int j = 0; j < _retainedCookedShapes.size(); ++j) {
+                    if (_retainedCookedShapes[j].equals(key)) {
+                        alreadyRetained = true;
+                        break;
+                    }
+                }
+                if (alreadyRetained) {
+                    continue;
+                }
+                _retainedCookedShapes.push_back(key);
+                if (_retainedCookedShapes.size() > MAX_RETAINED_COOKED_SHAPES) {
+                    // evict the oldest retained shape
+                    DoubleHashKey oldestKey = _retainedCookedShapes[0];
+                    for (int j = 1; j < _retainedCookedShapes.size(); ++j) {
+                        _retainedCookedShapes[j - 1] = _retainedCookedShapes[j];
+                    }
+                    _retainedCookedShapes.pop_back();
+                    ShapeReference* oldestRef = _shapeMap.find(oldestKey);
+                    if (oldestRef && oldestRef->refCount == 0) {
+                        ShapeFactory::deleteShape(oldestRef->shape);
+                        removeShapeFromIndexes(oldestRef);
+                    }
+                }
+            } else {
+                ShapeFactory::deleteShape(shapeRef->shape);
+                removeShapeFromIndexes(shapeRef);
+            }
         }
     }
     _pendingGarbage.clear();
@@ -115,10 +178,10 @@ int ShapeManager::getNumReferences(const ShapeInfo& info) const {
 }
 
 int ShapeManager::getNumReferences(const btCollisionShape* shape) const {
-    int numShapes = _shapeMap.size();
-    for (int i = 0; i < numShapes; ++i) {
-        const ShapeReference* shapeRef = _shapeMap.getAtIndex(i);
-        if (shape == shapeRef->shape) {
+    auto itr = _shapesByPointer.find(shape);
+    if (itr != _shapesByPointer.end()) {
+        const ShapeReference* shapeRef = _shapeMap.find(itr->second);
+        if (shapeRef) {
             return shapeRef->refCount;
         }
     }
@@ -126,12 +189,5 @@ int ShapeManager::getNumReferences(const btCollisionShape* shape) const {
 }
 
 bool ShapeManager::hasShape(const btCollisionShape* shape) const {
-    int numShapes = _shapeMap.size();
-    for (int i = 0; i < numShapes; ++i) {
-        const ShapeReference* shapeRef = _shapeMap.getAtIndex(i);
-        if (shape == shapeRef->shape) {
-            return true;
-        }
-    }
-    return false;
+    return _shapesByPointer.find(shape) != _shapesByPointer.end();
 }
@@ -12,6 +12,8 @@
 #ifndef hifi_ShapeManager_h
 #define hifi_ShapeManager_h
 
+#include <unordered_map>
+
 #include <btBulletDynamicsCommon.h>
 #include <LinearMath/btHashMap.h>
 
@@ -42,17 +44,25 @@ public:
 
 private:
     bool releaseShapeByKey(const DoubleHashKey& key);
+    void removeShapeFromIndexes(const ShapeReference* shapeRef);
 
     class ShapeReference {
     public:
         int refCount;
         const btCollisionShape* shape;
         DoubleHashKey key;
+        int shapeType { SHAPE_TYPE_NONE };
         ShapeReference() : refCount(0), shape(nullptr) {}
     };
 
     btHashMap<DoubleHashKey, ShapeReference> _shapeMap;
     btAlignedObjectArray<DoubleHashKey> _pendingGarbage;
+
+    // reverse index so release/lookup by shape pointer doesn't scan the whole map
+    std::unordered_map<const btCollisionShape*, DoubleHashKey> _shapesByPointer;
+
+    // keys of expensively cooked shapes being retained at zero references, oldest first
+    btAlignedObjectArray<DoubleHashKey> _retainedCookedShapes;
 };
 
 #endif // hifi_ShapeManager_h
@@ -181,6 +181,12 @@ public:
     // Fetch the most recently displayed image as a QImage
     virtual QImage getScreenshot(float aspectRatio = 0.0f) const = 0;
 
+    // Fetch a display image without stalling the calling thread; the callback fires from an
+    // arbitrary thread once the capture is ready.  The default implementation just captures
+    // synchronously - plugins with an asynchronous readback path override this.
+    using ScreenshotCallback = std::function<void(QImage)>;
+    virtual void getScreenshotAsync(float aspectRatio, ScreenshotCallback callback) const;
+
     // will query the underlying hmd api to compute the most recent head pose
     virtual bool beginFrameRender(uint32_t frameIndex) { return true; }
 
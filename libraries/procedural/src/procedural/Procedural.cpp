@@ -8,6 +8,9 @@
 
 #include "Procedural.h"
 
+#include <mutex>
+#include <unordered_map>
+
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonArray>
@@ -35,6 +38,14 @@ static const std::string PROCEDURAL_BLOCK = "//PROCEDURAL_BLOCK";
 static const std::string PROCEDURAL_COMMON_BLOCK = "//PROCEDURAL_COMMON_BLOCK";
 static const std::string PROCEDURAL_VERSION = "//PROCEDURAL_VERSION";
 
+// Procedural shaders are routinely shared by many entities (a domain full of identical
+// skyboxes, say), and each entity used to compile its own copy of the program. Compiled
+// programs are shared through this process-wide cache, keyed by the fully assembled source,
+// so only the first entity to see a given shader pays the compile; the rest reuse it and
+// only rebuild their own pipelines. weak_ptrs keep the cache from pinning retired shaders.
+static std::mutex _cachedProgramsMutex;
+static std::unordered_map<std::string, std::weak_ptr<gpu::Shader>> _cachedPrograms;
+
 static const std::string STANDARD_UNIFORM_NAMES[Procedural::NUM_STANDARD_UNIFORMS] = {
     "iDate",
     "iGlobalTime",
@@ -237,13 +248,20 @@ void Procedural::prepare(gpu::Batch& batch, const glm::vec3& position, const glm
     _entityPosition = position;
     _entityOrientation = glm::mat3_cast(orientation);
     if (_shaderUrl.isLocalFile()) {
-        auto lastModified = (quint64)QFileInfo(_shaderPath).lastModified().toMSecsSinceEpoch();
-        if (lastModified > _shaderModified) {
-            QFile file(_shaderPath);
-            file.open(QIODevice::ReadOnly);
-            _shaderSource = QTextStream(&file).readAll();
-            _shaderDirty = true;
-            _shaderModified = lastModified;
+        // Live-edit reload only needs to notice changes eventually; stat'ing the file once
+        // per frame per entity adds up in domains with many procedural entities
+        static const quint64 LOCAL_FILE_CHECK_INTERVAL_USECS = 500 * USECS_PER_MSEC;
+        auto now = usecTimestampNow();
+        if (now - _lastLocalFileCheck > LOCAL_FILE_CHECK_INTERVAL_USECS) {
+            _lastLocalFileCheck = now;
+            auto lastModified = (quint64)QFileInfo(_shaderPath).lastModified().toMSecsSinceEpoch();
+            if (lastModified > _shaderModified) {
+                QFile file(_shaderPath);
+                file.open(QIODevice::ReadOnly);
+                _shaderSource = QTextStream(&file).readAll();
+                _shaderDirty = true;
+                _shaderModified = lastModified;
+            }
         }
     } else if (_networkShader && _networkShader->isLoaded()) {
         _shaderSource = _networkShader->_source;
@@ -277,15 +295,37 @@ void Procedural::prepare(gpu::Batch& batch, const glm::vec3& position, const glm
         // Leave this here for debugging
         // qCDebug(procedural) << "FragmentShader:\n" << fragmentShaderSource.c_str();
 
-        _fragmentShader = gpu::Shader::createPixel(fragmentShaderSource);
-        _shader = gpu::Shader::createProgram(_vertexShader, _fragmentShader);
+        // Reuse an already-compiled copy of this program if another entity got there first.
+        // The key covers both stages - skyboxes and entities pair the same fragment block
+        // with different vertex shaders.
+        std::string programKey = _vertexSource + fragmentShaderSource;
+        gpu::ShaderPointer program;
+        {
+            std::lock_guard<std::mutex> lock(_cachedProgramsMutex);
+            auto itr = _cachedPrograms.find(programKey);
+            if (itr != _cachedPrograms.end()) {
+                program = itr->second.lock();
+                if (!program) {
+                    _cachedPrograms.erase(itr);
+                }
+            }
+        }
+
+        if (!program) {
+            _fragmentShader = gpu::Shader::createPixel(fragmentShaderSource);
+            program = gpu::Shader::createProgram(_vertexShader, _fragmentShader);
 
-        gpu::Shader::BindingSet slotBindings;
-        slotBindings.insert(gpu::Shader::Binding(std::string("iChannel0"), 0));
-        slotBindings.insert(gpu::Shader::Binding(std::string("iChannel1"), 1));
-        slotBindings.insert(gpu::Shader::Binding(std::string("iChannel2"), 2));
-        slotBindings.insert(gpu::Shader::Binding(std::string("iChannel3"), 3));
-        gpu::Shader::makeProgram(*_shader, slotBindings);
+            gpu::Shader::BindingSet slotBindings;
+            slotBindings.insert(gpu::Shader::Binding(std::string("iChannel0"), 0));
+            slotBindings.insert(gpu::Shader::Binding(std::string("iChannel1"), 1));
+            slotBindings.insert(gpu::Shader::Binding(std::string("iChannel2"), 2));
+            slotBindings.insert(gpu::Shader::Binding(std::string("iChannel3"), 3));
+            gpu::Shader::makeProgram(*program, slotBindings);
+
+            std::lock_guard<std::mutex> lock(_cachedProgramsMutex);
+            _cachedPrograms[programKey] = program;
+        }
+        _shader = program;
 
         _opaquePipeline = gpu::Pipeline::create(_shader, _opaqueState);
         _transparentPipeline = gpu::Pipeline::create(_shader, _transparentState);
@@ -80,6 +80,7 @@ protected:
     QString _shaderPath;
     QUrl _shaderUrl;
     quint64 _shaderModified { 0 };
+    quint64 _lastLocalFileCheck { 0 };
     NetworkShaderPointer _networkShader;
     QJsonObject _parsedUniforms;
     QJsonArray _parsedChannels;
@@ -14,6 +14,9 @@
 #include "impl/FileClip.h"
 #include "impl/BufferClip.h"
 
+#include <vector>
+
+#include <QtCore/QDataStream>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QBuffer>
@@ -90,6 +93,42 @@ bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
     return true;
 }
 
+// Appends the accumulated frame index to the end of the file. The index rides in ordinary
+// frames of a reserved type, so readers that predate it skip over it like any other unknown
+// frame type, and it ends with a trailer frame holding the index start offset and a magic so
+// new readers can find it without scanning.
+bool writeIndex(QIODevice& output, const std::vector<PointerFrameHeader>& index) {
+    QByteArray indexData;
+    {
+        QDataStream stream(&indexData, QIODevice::WriteOnly);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream << (quint32)index.size();
+        for (const auto& entry : index) {
+            stream << (quint16)entry.type << (quint32)entry.timeOffset
+                   << (quint16)entry.size << (quint64)entry.fileOffset;
+        }
+    }
+    indexData = qCompress(indexData);
+
+    quint64 indexStart = (quint64)output.pos();
+
+    // a frame payload is limited to 16 bits of size, so a large index spans several frames
+    const int MAX_INDEX_FRAME_SIZE = UINT16_MAX;
+    for (int offset = 0; offset < indexData.size(); offset += MAX_INDEX_FRAME_SIZE) {
+        if (!writeFrame(output, Frame({ Frame::TYPE_INDEX, 0, indexData.mid(offset, MAX_INDEX_FRAME_SIZE) }), false)) {
+            return false;
+        }
+    }
+
+    QByteArray trailerData;
+    {
+        QDataStream stream(&trailerData, QIODevice::WriteOnly);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream << indexStart << (quint32)PointerClip::INDEX_MAGIC;
+    }
+    return writeFrame(output, Frame({ Frame::TYPE_INDEX, 0, trailerData }), false);
+}
+
 const QString Clip::FRAME_TYPE_MAP = QStringLiteral("frameTypes");
 const QString Clip::FRAME_COMREPSSION_FLAG = QStringLiteral("compressed");
 
@@ -105,17 +144,39 @@ bool Clip::write(QIODevice& output) {
     // Always mark new files as compressed
     rootObject.insert(FRAME_COMREPSSION_FLAG, true);
     QByteArray headerFrameData = QJsonDocument(rootObject).toBinaryData();
+
+    // Accumulate a frame index as we write, so readers can locate every frame (and seek by
+    // time) without walking the whole file
+    std::vector<PointerFrameHeader> index;
+    auto recordIndexEntry = [&](const Frame& frame, qint64 frameStart, qint64 frameEnd) {
+        if (frameEnd == frameStart) {
+            // invalid frames are skipped by writeFrame without failing
+            return;
+        }
+        PointerFrameHeader entry;
+        entry.type = frame.type;
+        entry.timeOffset = frame.timeOffset;
+        entry.fileOffset = frameStart + PointerClip::MINIMUM_FRAME_SIZE;
+        entry.size = (FrameSize)(frameEnd - entry.fileOffset);
+        index.push_back(entry);
+    };
+
     // Never compress the header frame
-    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false)) {
+    Frame headerFrame({ Frame::TYPE_HEADER, 0, headerFrameData });
+    qint64 frameStart = output.pos();
+    if (!writeFrame(output, headerFrame, false)) {
         return false;
     }
+    recordIndexEntry(headerFrame, frameStart, output.pos());
 
     seek(0);
 
     for (auto frame = nextFrame(); frame; frame = nextFrame()) {
+        frameStart = output.pos();
         if (!writeFrame(output, *frame)) {
             return false;
         }
+        recordIndexEntry(*frame, frameStart, output.pos());
     }
-    return true;
+    return writeIndex(output, index);
 }
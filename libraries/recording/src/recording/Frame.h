@@ -35,6 +35,7 @@ struct FrameHeader {
 #endif
 
     static const FrameType TYPE_INVALID = 0xFFFF;
+    static const FrameType TYPE_INDEX = 0xFFFE;
     static const FrameType TYPE_HEADER = 0x0;
 
     static Time secondsToFrameTime(float seconds);
@@ -15,6 +15,17 @@
 
 using namespace recording;
 
+BufferClip::~BufferClip() {
+    {
+        std::lock_guard<std::mutex> workLock(_workMutex);
+        _shutdown = true;
+    }
+    _workCondition.notify_one();
+    if (_compressor.joinable()) {
+        _compressor.join();
+    }
+}
+
 QString BufferClip::getName() const {
     return _name;
 }
@@ -25,23 +36,66 @@ void BufferClip::addFrame(FrameConstPointer newFrame) {
         throw std::runtime_error("Frames may not have negative time offsets");
     }
 
-    Locker lock(_mutex);
-    auto itr = std::lower_bound(_frames.begin(), _frames.end(), newFrame->timeOffset,
-        [](const Frame& a, Frame::Time b)->bool {
-            return a.timeOffset < b;
+    {
+        Locker lock(_mutex);
+        auto itr = std::lower_bound(_frames.begin(), _frames.end(), newFrame->timeOffset,
+            [](const BufferFrame& a, Frame::Time b)->bool {
+                return a.timeOffset < b;
+            }
+        );
+
+        auto newFrameIndex = itr - _frames.begin();
+        //qDebug(recordingLog) << "Adding frame with time offset " << newFrame->timeOffset << " @ index " << newFrameIndex;
+        _frames.insert(_frames.begin() + newFrameIndex, BufferFrame(*newFrame));
+        if ((size_t)newFrameIndex < _firstUncompressedIndex) {
+            _firstUncompressedIndex = newFrameIndex;
         }
-    );
+    }
 
-    auto newFrameIndex = itr - _frames.begin();
-    //qDebug(recordingLog) << "Adding frame with time offset " << newFrame->timeOffset << " @ index " << newFrameIndex;
-    _frames.insert(_frames.begin() + newFrameIndex, Frame(*newFrame));
+    // hand the new frame to the background compressor
+    {
+        std::lock_guard<std::mutex> workLock(_workMutex);
+        if (!_compressor.joinable()) {
+            _compressor = std::thread([this] { compressFrames(); });
+        }
+        ++_pendingCompressions;
+    }
+    _workCondition.notify_one();
+}
+
+void BufferClip::compressFrames() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> workLock(_workMutex);
+            _workCondition.wait(workLock, [this] { return _shutdown || _pendingCompressions > 0; });
+            if (_shutdown) {
+                // any frames not yet visited simply stay raw; readFrame checks per frame
+                return;
+            }
+            --_pendingCompressions;
+        }
+
+        Locker lock(_mutex);
+        while (_firstUncompressedIndex < _frames.size() && _frames[_firstUncompressedIndex].compressed) {
+            ++_firstUncompressedIndex;
+        }
+        if (_firstUncompressedIndex < _frames.size()) {
+            auto& frame = _frames[_firstUncompressedIndex];
+            frame.data = qCompress(frame.data);
+            frame.compressed = true;
+        }
+    }
 }
 
 // Internal only function, needs no locking
 FrameConstPointer BufferClip::readFrame(size_t frameIndex) const {
     FramePointer result;
     if (frameIndex < _frames.size()) {
-        result = std::make_shared<Frame>(_frames[frameIndex]);
+        const auto& bufferFrame = _frames[frameIndex];
+        result = std::make_shared<Frame>();
+        result->type = bufferFrame.type;
+        result->timeOffset = bufferFrame.timeOffset;
+        result->data = bufferFrame.compressed ? qUncompress(bufferFrame.data) : bufferFrame.data;
     }
     return result;
 }
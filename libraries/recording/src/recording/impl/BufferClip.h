@@ -12,21 +12,46 @@
 
 #include "ArrayClip.h"
 
+#include <condition_variable>
+#include <thread>
+
 #include <QtCore/QUuid>
 
 namespace recording {
 
-class BufferClip : public ArrayClip<Frame> {
+struct BufferFrame : public FrameHeader {
+    QByteArray data;
+    bool compressed { false }; // set once the background compressor has visited this frame
+
+    BufferFrame() {}
+    BufferFrame(const Frame& frame) : FrameHeader(frame.type, frame.timeOffset), data(frame.data) {}
+};
+
+class BufferClip : public ArrayClip<BufferFrame> {
 public:
     using Pointer = std::shared_ptr<BufferClip>;
 
+    virtual ~BufferClip();
+
     virtual QString getName() const override;
     virtual void addFrame(FrameConstPointer) override;
 
 private:
     virtual FrameConstPointer readFrame(size_t index) const override;
+    void compressFrames();
+
     QString _name { QUuid().toString() };
-    
+
+    // Captured frames are compressed by a background thread shortly after they arrive, so an
+    // hour of recording doesn't hold an hour of raw frame data in memory. The work mutex only
+    // guards the signalling state; the frames themselves stay under the clip mutex.
+    std::thread _compressor;
+    std::mutex _workMutex;
+    std::condition_variable _workCondition;
+    int _pendingCompressions { 0 };
+    bool _shutdown { false };
+    size_t _firstUncompressedIndex { 0 };
+
     //mutable size_t _frameIndex { 0 }; // FIXME - not in use
 };
 
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 
+#include <QtCore/QDataStream>
 #include <QtCore/QDebug>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
@@ -75,6 +76,80 @@ PointerFrameHeaderList parseFrameHeaders(uchar* const start, const size_t& size)
     return results;
 }
 
+// Looks for the trailing frame index that Clip::write() appends. If the data ends with the
+// index trailer, the frame headers come out of the index and opening the clip never touches
+// the frame payloads; anything unexpected falls back to a full header scan.
+PointerFrameHeaderList parseIndex(uchar* const start, const size_t& size) {
+    PointerFrameHeaderList results;
+
+    const qint64 TRAILER_PAYLOAD_SIZE = sizeof(quint64) + sizeof(quint32);
+    const qint64 TRAILER_SIZE = PointerClip::MINIMUM_FRAME_SIZE + TRAILER_PAYLOAD_SIZE;
+    if ((qint64)size < TRAILER_SIZE) {
+        return results;
+    }
+
+    quint32 magic;
+    memcpy(&magic, start + size - sizeof(quint32), sizeof(quint32));
+    if (magic != PointerClip::INDEX_MAGIC) {
+        return results;
+    }
+
+    quint64 indexStart;
+    memcpy(&indexStart, start + size - TRAILER_PAYLOAD_SIZE, sizeof(quint64));
+    if (indexStart + TRAILER_SIZE >= size) {
+        return results;
+    }
+
+    // the index itself rides in frames of the reserved type; concatenate them
+    QByteArray indexData;
+    auto current = start + indexStart;
+    auto end = start + size - TRAILER_SIZE;
+    while (current < end) {
+        if (end - current < PointerClip::MINIMUM_FRAME_SIZE) {
+            return PointerFrameHeaderList();
+        }
+        FrameType type;
+        memcpy(&type, current, sizeof(FrameType));
+        current += sizeof(FrameType) + sizeof(Frame::Time);
+        FrameSize chunkSize;
+        memcpy(&chunkSize, current, sizeof(FrameSize));
+        current += sizeof(FrameSize);
+        if (type != Frame::TYPE_INDEX || end - current < chunkSize) {
+            return PointerFrameHeaderList();
+        }
+        indexData.append(reinterpret_cast<char*>(current), chunkSize);
+        current += chunkSize;
+    }
+
+    indexData = qUncompress(indexData);
+    if (indexData.isEmpty()) {
+        return PointerFrameHeaderList();
+    }
+
+    QDataStream stream(indexData);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    quint32 count;
+    stream >> count;
+    for (quint32 i = 0; i < count; ++i) {
+        quint16 type;
+        quint32 timeOffset;
+        quint16 frameSize;
+        quint64 fileOffset;
+        stream >> type >> timeOffset >> frameSize >> fileOffset;
+        if (stream.status() != QDataStream::Ok || fileOffset + frameSize > indexStart) {
+            return PointerFrameHeaderList();
+        }
+        PointerFrameHeader header;
+        header.type = type;
+        header.timeOffset = timeOffset;
+        header.size = frameSize;
+        header.fileOffset = fileOffset;
+        results.push_back(header);
+    }
+    qDebug(recordingLog) << "Loaded frame index with " << results.size() << " frames";
+    return results;
+}
+
 void PointerClip::reset() {
     _frames.clear();
     _data = nullptr;
@@ -88,7 +163,12 @@ void PointerClip::init(uchar* data, size_t size) {
     _data = data;
     _size = size;
 
-    auto parsedFrameHeaders = parseFrameHeaders(data, size);
+    // An indexed clip tells us where every frame lives without walking (and paging in)
+    // the entire mapping; older, unindexed data still gets the full scan
+    auto parsedFrameHeaders = parseIndex(data, size);
+    if (parsedFrameHeaders.empty()) {
+        parsedFrameHeaders = parseFrameHeaders(data, size);
+    }
     // Verify that at least one frame exists and that the first frame is a header
     if (0 == parsedFrameHeaders.size()) {
         qWarning() << "No frames found, invalid file";
@@ -44,6 +44,9 @@ public:
 
     // FIXME move to frame?
     static const qint64 MINIMUM_FRAME_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
+
+    // marks a trailing frame index, so files can be opened without scanning every frame
+    static const quint32 INDEX_MAGIC = 0x48465249; // 'HFRI'
 protected:
     void reset() override;
     virtual FrameConstPointer readFrame(size_t index) const override;
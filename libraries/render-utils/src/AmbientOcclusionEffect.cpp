@@ -30,6 +30,7 @@
 
 #include "ssao_makePyramid_frag.h"
 #include "ssao_makeOcclusion_frag.h"
+#include "ssao_makeTemporalAccumulation_frag.h"
 #include "ssao_debugOcclusion_frag.h"
 #include "ssao_makeHorizontalBlur_frag.h"
 #include "ssao_makeVerticalBlur_frag.h"
@@ -63,6 +64,11 @@ void AmbientOcclusionFramebuffer::clear() {
     _occlusionTexture.reset();
     _occlusionBlurredFramebuffer.reset();
     _occlusionBlurredTexture.reset();
+    for (int i = 0; i < 2; i++) {
+        _occlusionHistoryFramebuffers[i].reset();
+        _occlusionHistoryTextures[i].reset();
+    }
+    _isHistoryValid = false;
 }
 
 gpu::TexturePointer AmbientOcclusionFramebuffer::getLinearDepthTexture() {
@@ -81,6 +87,12 @@ void AmbientOcclusionFramebuffer::allocate() {
     _occlusionBlurredTexture = gpu::TexturePointer(gpu::Texture::create2D(gpu::Element::COLOR_RGBA_32, width, height, gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_LINEAR_MIP_POINT)));
     _occlusionBlurredFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("occlusionBlurred"));
     _occlusionBlurredFramebuffer->setRenderBuffer(0, _occlusionBlurredTexture);
+
+    for (int i = 0; i < 2; i++) {
+        _occlusionHistoryTextures[i] = gpu::TexturePointer(gpu::Texture::create2D(gpu::Element::COLOR_RGBA_32, width, height, gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_LINEAR_MIP_POINT)));
+        _occlusionHistoryFramebuffers[i] = gpu::FramebufferPointer(gpu::Framebuffer::create("occlusionHistory"));
+        _occlusionHistoryFramebuffers[i]->setRenderBuffer(0, _occlusionHistoryTextures[i]);
+    }
 }
 
 gpu::FramebufferPointer AmbientOcclusionFramebuffer::getOcclusionFramebuffer() {
@@ -111,6 +123,20 @@ gpu::TexturePointer AmbientOcclusionFramebuffer::getOcclusionBlurredTexture() {
     return _occlusionBlurredTexture;
 }
 
+gpu::FramebufferPointer AmbientOcclusionFramebuffer::getOcclusionHistoryFramebuffer(int index) {
+    if (!_occlusionHistoryFramebuffers[index]) {
+        allocate();
+    }
+    return _occlusionHistoryFramebuffers[index];
+}
+
+gpu::TexturePointer AmbientOcclusionFramebuffer::getOcclusionHistoryTexture(int index) {
+    if (!_occlusionHistoryTextures[index]) {
+        allocate();
+    }
+    return _occlusionHistoryTextures[index];
+}
+
 
 class GaussianDistribution {
 public:
@@ -170,8 +196,10 @@ public:
 const int AmbientOcclusionEffect_FrameTransformSlot = 0;
 const int AmbientOcclusionEffect_ParamsSlot = 1;
 const int AmbientOcclusionEffect_CameraCorrectionSlot = 2;
+const int AmbientOcclusionEffect_TemporalParamsSlot = 3;
 const int AmbientOcclusionEffect_LinearDepthMapSlot = 0;
 const int AmbientOcclusionEffect_OcclusionMapSlot = 0;
+const int AmbientOcclusionEffect_OcclusionHistoryMapSlot = 1;
 
 AmbientOcclusionEffect::AmbientOcclusionEffect() {
 }
@@ -216,10 +244,24 @@ void AmbientOcclusionEffect::configure(const Config& config) {
         current.z = config.numSpiralTurns;
     }
 
-    if (config.numSamples != _parametersBuffer->getNumSamples()) {
+    // In temporal accumulation mode only a quarter of the samples are taken each frame,
+    // the rotating spiral pattern spreads the full set over four frames
+    int numSamples = config.numSamples;
+    if (config.temporalEnabled) {
+        const int TEMPORAL_FRAME_COUNT = 4;
+        numSamples = std::max(1, numSamples / TEMPORAL_FRAME_COUNT);
+    }
+    if (numSamples != _parametersBuffer->getNumSamples()) {
         auto& current = _parametersBuffer.edit().sampleInfo;
-        current.x = config.numSamples;
-        current.y = 1.0f / config.numSamples;
+        current.x = (float)numSamples;
+        current.y = 1.0f / numSamples;
+    }
+
+    _isTemporalEnabled = config.temporalEnabled;
+    _temporalBlend = config.temporalBlend;
+    if (!_isTemporalEnabled && _parametersBuffer->ditheringInfo.y != 0.0f) {
+        // Stop the per frame rotation of the sampling pattern, it is only stable under accumulation
+        _parametersBuffer.edit().ditheringInfo.y = 0.0f;
     }
 
     if (config.fetchMipsEnabled != _parametersBuffer->isFetchMipsEnabled()) {
@@ -284,6 +326,32 @@ const gpu::PipelinePointer& AmbientOcclusionEffect::getOcclusionPipeline() {
     return _occlusionPipeline;
 }
 
+const gpu::PipelinePointer& AmbientOcclusionEffect::getTemporalPipeline() {
+    if (!_temporalPipeline) {
+        auto vs = gpu::StandardShaderLib::getDrawViewportQuadTransformTexcoordVS();
+        auto ps = gpu::Shader::createPixel(std::string(ssao_makeTemporalAccumulation_frag));
+        gpu::ShaderPointer program = gpu::Shader::createProgram(vs, ps);
+
+        gpu::Shader::BindingSet slotBindings;
+        slotBindings.insert(gpu::Shader::Binding(std::string("deferredFrameTransformBuffer"), AmbientOcclusionEffect_FrameTransformSlot));
+        slotBindings.insert(gpu::Shader::Binding(std::string("ambientOcclusionParamsBuffer"), AmbientOcclusionEffect_ParamsSlot));
+        slotBindings.insert(gpu::Shader::Binding(std::string("cameraCorrectionBuffer"), AmbientOcclusionEffect_CameraCorrectionSlot));
+        slotBindings.insert(gpu::Shader::Binding(std::string("ambientOcclusionTemporalBuffer"), AmbientOcclusionEffect_TemporalParamsSlot));
+
+        slotBindings.insert(gpu::Shader::Binding(std::string("occlusionMap"), AmbientOcclusionEffect_OcclusionMapSlot));
+        slotBindings.insert(gpu::Shader::Binding(std::string("historyMap"), AmbientOcclusionEffect_OcclusionHistoryMapSlot));
+        gpu::Shader::makeProgram(*program, slotBindings);
+
+        gpu::StatePointer state = gpu::StatePointer(new gpu::State());
+
+        state->setColorWriteMask(true, true, true, false);
+
+        // Good to go add the brand new pipeline
+        _temporalPipeline = gpu::Pipeline::create(program, state);
+    }
+    return _temporalPipeline;
+}
+
 
 const gpu::PipelinePointer& AmbientOcclusionEffect::getHBlurPipeline() {
     if (!_hBlurPipeline) {
@@ -369,7 +437,38 @@ void AmbientOcclusionEffect::run(const render::SceneContextPointer& sceneContext
     
     auto occlusionFBO = _framebuffer->getOcclusionFramebuffer();
     auto occlusionBlurredFBO = _framebuffer->getOcclusionBlurredFramebuffer();
-    
+
+    // Temporal accumulation frame to frame state: which history buffer is read and which is
+    // written, how much of the history survives, and the reprojection to last frame's clip space
+    bool useTemporal = _isTemporalEnabled;
+    gpu::FramebufferPointer historyWriteFBO;
+    gpu::TexturePointer historyReadTexture;
+    if (useTemporal) {
+        glm::mat4 projMat;
+        Transform viewTransform;
+        args->getViewFrustum().evalProjectionMatrix(projMat);
+        args->getViewFrustum().evalViewTransform(viewTransform);
+        glm::mat4 viewMat;
+        viewTransform.getInverseMatrix(viewMat);
+
+        auto& temporal = _temporalParametersBuffer.edit();
+        temporal.previousViewProjection = _previousViewProjection;
+        // The first frame after a (re)allocation has no history worth blending with
+        temporal.temporalInfo.x = _framebuffer->isHistoryValid() ? _temporalBlend : 0.0f;
+        _previousViewProjection = projMat * viewMat;
+
+        // Rotate the spin angle of the sampling spiral so the four frame sequence covers
+        // the full sample set
+        const int TEMPORAL_FRAME_COUNT = 4;
+        const float TEMPORAL_FRAME_ROTATION = 2.399963f; // golden angle in radians
+        _frameId = (_frameId + 1) % TEMPORAL_FRAME_COUNT;
+        _parametersBuffer.edit().ditheringInfo.y = _frameId * TEMPORAL_FRAME_ROTATION;
+
+        historyWriteFBO = _framebuffer->getOcclusionHistoryFramebuffer(_frameId & 1);
+        historyReadTexture = _framebuffer->getOcclusionHistoryTexture((_frameId & 1) ^ 1);
+        _framebuffer->setHistoryValid();
+    }
+
     outputs.edit0() = _framebuffer;
     outputs.edit1() = _parametersBuffer;
 
@@ -382,9 +481,10 @@ void AmbientOcclusionEffect::run(const render::SceneContextPointer& sceneContext
 
 
     auto occlusionPipeline = getOcclusionPipeline();
+    auto temporalPipeline = (useTemporal ? getTemporalPipeline() : nullptr);
     auto firstHBlurPipeline = getHBlurPipeline();
     auto lastVBlurPipeline = getVBlurPipeline();
-    
+
     gpu::doInBatch(args->_context, [=](gpu::Batch& batch) {
         batch.enableStereo(false);
 
@@ -413,12 +513,24 @@ void AmbientOcclusionEffect::run(const render::SceneContextPointer& sceneContext
         batch.setResourceTexture(AmbientOcclusionEffect_LinearDepthMapSlot, _framebuffer->getLinearDepthTexture());
         batch.draw(gpu::TRIANGLE_STRIP, 4);
 
-        
+        // Temporal accumulation pass, resolving the quarter rate sampling against the
+        // reprojected history before the blur sees it
+        auto blurInputTexture = occlusionFBO->getRenderBuffer(0);
+        if (useTemporal) {
+            batch.setFramebuffer(historyWriteFBO);
+            batch.setPipeline(temporalPipeline);
+            batch.setUniformBuffer(AmbientOcclusionEffect_TemporalParamsSlot, _temporalParametersBuffer);
+            batch.setResourceTexture(AmbientOcclusionEffect_OcclusionMapSlot, occlusionFBO->getRenderBuffer(0));
+            batch.setResourceTexture(AmbientOcclusionEffect_OcclusionHistoryMapSlot, historyReadTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+            blurInputTexture = historyWriteFBO->getRenderBuffer(0);
+        }
+
         if (_parametersBuffer->getBlurRadius() > 0) {
             // Blur 1st pass
             batch.setFramebuffer(occlusionBlurredFBO);
             batch.setPipeline(firstHBlurPipeline);
-            batch.setResourceTexture(AmbientOcclusionEffect_OcclusionMapSlot, occlusionFBO->getRenderBuffer(0));
+            batch.setResourceTexture(AmbientOcclusionEffect_OcclusionMapSlot, blurInputTexture);
             batch.draw(gpu::TRIANGLE_STRIP, 4);
 
             // Blur 2nd pass
@@ -426,11 +538,15 @@ void AmbientOcclusionEffect::run(const render::SceneContextPointer& sceneContext
             batch.setPipeline(lastVBlurPipeline);
             batch.setResourceTexture(AmbientOcclusionEffect_OcclusionMapSlot, occlusionBlurredFBO->getRenderBuffer(0));
             batch.draw(gpu::TRIANGLE_STRIP, 4);
+        } else if (useTemporal) {
+            // No blur to carry the accumulated result back into the occlusion output, copy it
+            batch.blit(historyWriteFBO, occlusionViewport, occlusionFBO, occlusionViewport);
         }
-        
-        
+
+
         batch.setResourceTexture(AmbientOcclusionEffect_LinearDepthMapSlot, nullptr);
         batch.setResourceTexture(AmbientOcclusionEffect_OcclusionMapSlot, nullptr);
+        batch.setResourceTexture(AmbientOcclusionEffect_OcclusionHistoryMapSlot, nullptr);
         
         _gpuTimer->end(batch);
     });
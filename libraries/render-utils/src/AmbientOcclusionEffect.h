@@ -30,12 +30,21 @@ public:
     
     gpu::FramebufferPointer getOcclusionBlurredFramebuffer();
     gpu::TexturePointer getOcclusionBlurredTexture();
-    
+
+    // Temporal accumulation history, double buffered so a frame can read the previous
+    // frame's accumulated occlusion while writing the new one
+    gpu::FramebufferPointer getOcclusionHistoryFramebuffer(int index);
+    gpu::TexturePointer getOcclusionHistoryTexture(int index);
+
+    // The history content is garbage right after a (re)allocation, let the effect know
+    bool isHistoryValid() const { return _isHistoryValid; }
+    void setHistoryValid() { _isHistoryValid = true; }
+
     // Update the source framebuffer size which will drive the allocation of all the other resources.
     void updateLinearDepth(const gpu::TexturePointer& linearDepthBuffer);
     gpu::TexturePointer getLinearDepthTexture();
     const glm::ivec2& getSourceFrameSize() const { return _frameSize; }
-        
+
 protected:
     void clear();
     void allocate();
@@ -47,8 +56,11 @@ protected:
     
     gpu::FramebufferPointer _occlusionBlurredFramebuffer;
     gpu::TexturePointer _occlusionBlurredTexture;
-    
-    
+
+    gpu::FramebufferPointer _occlusionHistoryFramebuffers[2];
+    gpu::TexturePointer _occlusionHistoryTextures[2];
+    bool _isHistoryValid{ false };
+
     glm::ivec2 _frameSize;
 };
 
@@ -60,6 +72,8 @@ class AmbientOcclusionEffectConfig : public render::GPUJobConfig::Persistent {
     Q_PROPERTY(bool ditheringEnabled MEMBER ditheringEnabled NOTIFY dirty)
     Q_PROPERTY(bool borderingEnabled MEMBER borderingEnabled NOTIFY dirty)
     Q_PROPERTY(bool fetchMipsEnabled MEMBER fetchMipsEnabled NOTIFY dirty)
+    Q_PROPERTY(bool temporalEnabled MEMBER temporalEnabled NOTIFY dirty)
+    Q_PROPERTY(float temporalBlend MEMBER temporalBlend WRITE setTemporalBlend)
     Q_PROPERTY(float radius MEMBER radius WRITE setRadius)
     Q_PROPERTY(float obscuranceLevel MEMBER obscuranceLevel WRITE setObscuranceLevel)
     Q_PROPERTY(float falloffBias MEMBER falloffBias WRITE setFalloffBias)
@@ -85,6 +99,7 @@ public:
     void setNumSamples(int samples) { numSamples = std::max(1.0f, (float)samples); emit dirty(); }
     void setResolutionLevel(int level) { resolutionLevel = std::max(0, std::min(level, MAX_RESOLUTION_LEVEL)); emit dirty(); }
     void setBlurRadius(int radius) { blurRadius = std::max(0, std::min(MAX_BLUR_RADIUS, radius)); emit dirty(); }
+    void setTemporalBlend(float blend) { temporalBlend = std::max(0.0f, std::min(blend, 0.99f)); emit dirty(); }
 
     float radius{ 0.5f };
     float perspectiveScale{ 1.0f };
@@ -99,6 +114,8 @@ public:
     bool ditheringEnabled{ true }; // randomize the distribution of taps per pixel, should always be true
     bool borderingEnabled{ true }; // avoid evaluating information from non existing pixels out of the frame, should always be true
     bool fetchMipsEnabled{ true }; // fetch taps in sub mips to otpimize cache, should always be true
+    bool temporalEnabled{ false }; // accumulate a quarter of the samples each frame, reprojected from the previous frame
+    float temporalBlend{ 0.85f }; // how much of the reprojected history survives each frame
 
 signals:
     void dirty();
@@ -154,20 +171,41 @@ public:
     };
     using ParametersBuffer = gpu::StructBuffer<Parameters>;
 
+    // Class describing the uniform buffer with the reprojection info used by the temporal accumulation pass
+    class TemporalParameters {
+    public:
+        // World space to previous frame mono clip space
+        glm::mat4 previousViewProjection;
+        // Temporal info is { blend factor, depth key tolerance, 0, 0 }
+        glm::vec4 temporalInfo{ 0.0f, 0.02f, 0.0f, 0.0f };
+
+        TemporalParameters() {}
+    };
+    using TemporalParametersBuffer = gpu::StructBuffer<TemporalParameters>;
+
 private:
     void updateGaussianDistribution();
-   
+
     ParametersBuffer _parametersBuffer;
+    TemporalParametersBuffer _temporalParametersBuffer;
 
     const gpu::PipelinePointer& getOcclusionPipeline();
+    const gpu::PipelinePointer& getTemporalPipeline();
     const gpu::PipelinePointer& getHBlurPipeline(); // first
     const gpu::PipelinePointer& getVBlurPipeline(); // second
 
     gpu::PipelinePointer _occlusionPipeline;
+    gpu::PipelinePointer _temporalPipeline;
     gpu::PipelinePointer _hBlurPipeline;
     gpu::PipelinePointer _vBlurPipeline;
 
     AmbientOcclusionFramebufferPointer _framebuffer;
+
+    bool _isTemporalEnabled{ false };
+    float _temporalBlend{ 0.85f };
+    // Parity of the frame, selecting which history buffer is read and which is written
+    int _frameId{ 0 };
+    glm::mat4 _previousViewProjection{ 1.0f };
     
     gpu::RangeTimerPointer _gpuTimer;
 
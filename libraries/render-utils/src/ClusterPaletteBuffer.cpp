@@ -0,0 +1,54 @@
+//
+//  ClusterPaletteBuffer.cpp
+//  libraries/render-utils/src
+//
+//  Created by Sam Gateau on 2/7/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ClusterPaletteBuffer.h"
+
+ClusterPaletteBuffer& ClusterPaletteBuffer::instance() {
+    static ClusterPaletteBuffer INSTANCE;
+    return INSTANCE;
+}
+
+ClusterPaletteBuffer::ClusterPaletteBuffer() :
+    _buffer(std::make_shared<gpu::Buffer>()) {
+}
+
+ClusterPaletteBuffer::Allocation ClusterPaletteBuffer::allocate(int numClusters) {
+    Allocation allocation;
+    allocation.size = numClusters * sizeof(glm::mat4);
+    size_t reserved = (allocation.size + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _freeRanges.find(reserved);
+    if (found != _freeRanges.end()) {
+        allocation.offset = found->second;
+        _freeRanges.erase(found);
+    } else {
+        // Grow the buffer; the gpu::Buffer identity never changes so batches keep
+        // referring to the same object across reallocations
+        allocation.offset = _buffer->getSize();
+        _buffer->resize(allocation.offset + reserved);
+    }
+    return allocation;
+}
+
+void ClusterPaletteBuffer::release(const Allocation& allocation) {
+    if (allocation.size == 0) {
+        return;
+    }
+    size_t reserved = (allocation.size + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _freeRanges.insert({ reserved, allocation.offset });
+}
+
+void ClusterPaletteBuffer::update(const Allocation& allocation, int numClusters, const glm::mat4* matrices) {
+    _buffer->setSubData(allocation.offset, numClusters * sizeof(glm::mat4), (const gpu::Byte*) matrices);
+}
@@ -0,0 +1,59 @@
+//
+//  ClusterPaletteBuffer.h
+//  libraries/render-utils/src
+//
+//  Created by Sam Gateau on 2/7/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ClusterPaletteBuffer_h
+#define hifi_ClusterPaletteBuffer_h
+
+#include <mutex>
+#include <map>
+
+#include <gpu/Buffer.h>
+
+// One persistent GPU buffer shared by every skinned mesh's cluster matrix palette.
+// Each mesh allocates an aligned range once, refreshes it only when its pose actually
+// moved, and the payloads bind the shared buffer at their offset, so a crowd of
+// animated avatars costs one buffer identity instead of one tiny UBO upload each.
+class ClusterPaletteBuffer {
+public:
+    static ClusterPaletteBuffer& instance();
+
+    // A range of the shared buffer, in bytes; size 0 means not allocated
+    struct Allocation {
+        size_t offset { 0 };
+        size_t size { 0 };
+    };
+
+    // Reserve room for numClusters matrices; the offset honors the worst case
+    // uniform buffer offset alignment so it can be bound directly
+    Allocation allocate(int numClusters);
+
+    // Return a range to the free list, to be reused by a later allocate of the same size
+    void release(const Allocation& allocation);
+
+    // Upload the cluster matrices of an allocated range
+    void update(const Allocation& allocation, int numClusters, const glm::mat4* matrices);
+
+    const gpu::BufferPointer& getBuffer() const { return _buffer; }
+
+private:
+    ClusterPaletteBuffer();
+
+    // Worst case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT on the hardware we target: four mat4s
+    static const size_t BLOCK_ALIGNMENT = 256;
+
+    std::mutex _mutex;
+    gpu::BufferPointer _buffer;
+    // Free ranges keyed by their reserved size. Ranges are recycled whole, no coalescing
+    // or splitting: models reloading the same skeletons reuse the exact same sizes
+    std::multimap<size_t, size_t> _freeRanges;
+};
+
+#endif // hifi_ClusterPaletteBuffer_h
@@ -24,6 +24,7 @@
 #include "FramebufferCache.h"
 
 #include "deferred_light_vert.h"
+#include "deferred_light_tile_vert.h"
 #include "deferred_light_point_vert.h"
 #include "deferred_light_spot_vert.h"
 
@@ -78,6 +79,7 @@ enum DeferredShader_BufferSlot {
     LIGHT_CLUSTER_GRID_FRUSTUM_GRID_SLOT,
     LIGHT_CLUSTER_GRID_CLUSTER_GRID_SLOT,
     LIGHT_CLUSTER_GRID_CLUSTER_CONTENT_SLOT,
+    LIGHT_CLUSTER_GRID_TILE_LIST_SLOT,
 
 };
 
@@ -105,6 +107,8 @@ void DeferredLightingEffect::init() {
 
     _localLightLocations = std::make_shared<LightLocations>();
     _localLightOutlineLocations = std::make_shared<LightLocations>();
+    _localLightTiledLocations = std::make_shared<LightLocations>();
+    _localLightOutlineTiledLocations = std::make_shared<LightLocations>();
     _pointLightLocations = std::make_shared<LightLocations>();
     _spotLightLocations = std::make_shared<LightLocations>();
 
@@ -119,6 +123,9 @@ void DeferredLightingEffect::init() {
     loadLightProgram(deferred_light_vert, local_lights_shading_frag, true, _localLight, _localLightLocations);
     loadLightProgram(deferred_light_vert, local_lights_drawOutline_frag, true, _localLightOutline, _localLightOutlineLocations);
 
+    loadLightProgram(deferred_light_tile_vert, local_lights_shading_frag, true, _localLightTiled, _localLightTiledLocations);
+    loadLightProgram(deferred_light_tile_vert, local_lights_drawOutline_frag, true, _localLightOutlineTiled, _localLightOutlineTiledLocations);
+
     loadLightVolumeProgram(deferred_light_point_vert, no_light_frag, false, _pointLightBack, _pointLightLocations);
     loadLightVolumeProgram(deferred_light_point_vert, no_light_frag, true, _pointLightFront, _pointLightLocations);
     loadLightVolumeProgram(deferred_light_spot_vert, no_light_frag, false, _spotLightBack, _spotLightLocations);
@@ -252,6 +259,7 @@ static gpu::ShaderPointer makeLightProgram(const char* vertSource, const char* f
     slotBindings.insert(gpu::Shader::Binding(std::string("frustumGridBuffer"), LIGHT_CLUSTER_GRID_FRUSTUM_GRID_SLOT));
     slotBindings.insert(gpu::Shader::Binding(std::string("clusterGridBuffer"), LIGHT_CLUSTER_GRID_CLUSTER_GRID_SLOT));
     slotBindings.insert(gpu::Shader::Binding(std::string("clusterContentBuffer"), LIGHT_CLUSTER_GRID_CLUSTER_CONTENT_SLOT));
+    slotBindings.insert(gpu::Shader::Binding(std::string("tileListBuffer"), LIGHT_CLUSTER_GRID_TILE_LIST_SLOT));
 
     gpu::Shader::makeProgram(*program, slotBindings);
 
@@ -729,18 +737,41 @@ void RenderDeferredLocals::run(const render::SceneContextPointer& sceneContext,
             batch.setUniformBuffer(LIGHT_CLUSTER_GRID_CLUSTER_GRID_SLOT, lightClusters->_clusterGridBuffer);
             batch.setUniformBuffer(LIGHT_CLUSTER_GRID_CLUSTER_CONTENT_SLOT, lightClusters->_clusterContentBuffer);
 
-            // Local light pipeline
-            batch.setPipeline(deferredLightingEffect->_localLight);
-            batch._glUniform4fv(deferredLightingEffect->_localLightLocations->texcoordFrameTransform, 1, reinterpret_cast<const float*>(&textureFrameTransform));
+            // The tile list collapses the cluster grid over depth as seen from the mono eye,
+            // in stereo the per eye footprints drift away from the mono ones so keep the full
+            // screen quad there
+            bool useTileList = !args->_context->isStereo() && (lightClusters->_numOccupiedTiles > 0);
+            int numTileVertices = lightClusters->_numOccupiedTiles * 6;
+
+            if (useTileList) {
+                batch.setUniformBuffer(LIGHT_CLUSTER_GRID_TILE_LIST_SLOT, lightClusters->_tileListBuffer);
+
+                // Local light pipeline, one quad per occupied tile of the grid
+                batch.setPipeline(deferredLightingEffect->_localLightTiled);
+                batch._glUniform4fv(deferredLightingEffect->_localLightTiledLocations->texcoordFrameTransform, 1, reinterpret_cast<const float*>(&textureFrameTransform));
 
-            batch.draw(gpu::TRIANGLE_STRIP, 4);
+                batch.draw(gpu::TRIANGLES, numTileVertices);
+            } else {
+                // Local light pipeline
+                batch.setPipeline(deferredLightingEffect->_localLight);
+                batch._glUniform4fv(deferredLightingEffect->_localLightLocations->texcoordFrameTransform, 1, reinterpret_cast<const float*>(&textureFrameTransform));
+
+                batch.draw(gpu::TRIANGLE_STRIP, 4);
+            }
 
              // Draw outline as well ?
             if (lightingModel->isShowLightContourEnabled()) {
-                batch.setPipeline(deferredLightingEffect->_localLightOutline);
-                batch._glUniform4fv(deferredLightingEffect->_localLightOutlineLocations->texcoordFrameTransform, 1, reinterpret_cast<const float*>(&textureFrameTransform));
+                if (useTileList) {
+                    batch.setPipeline(deferredLightingEffect->_localLightOutlineTiled);
+                    batch._glUniform4fv(deferredLightingEffect->_localLightOutlineTiledLocations->texcoordFrameTransform, 1, reinterpret_cast<const float*>(&textureFrameTransform));
 
-                batch.draw(gpu::TRIANGLE_STRIP, 4);
+                    batch.draw(gpu::TRIANGLES, numTileVertices);
+                } else {
+                    batch.setPipeline(deferredLightingEffect->_localLightOutline);
+                    batch._glUniform4fv(deferredLightingEffect->_localLightOutlineLocations->texcoordFrameTransform, 1, reinterpret_cast<const float*>(&textureFrameTransform));
+
+                    batch.draw(gpu::TRIANGLE_STRIP, 4);
+                }
             }
         }
     }
@@ -770,6 +801,7 @@ void RenderDeferredCleanup::run(const render::SceneContextPointer& sceneContext,
         batch.setUniformBuffer(LIGHT_CLUSTER_GRID_FRUSTUM_GRID_SLOT, nullptr);
         batch.setUniformBuffer(LIGHT_CLUSTER_GRID_CLUSTER_GRID_SLOT, nullptr);
         batch.setUniformBuffer(LIGHT_CLUSTER_GRID_CLUSTER_CONTENT_SLOT, nullptr);
+        batch.setUniformBuffer(LIGHT_CLUSTER_GRID_TILE_LIST_SLOT, nullptr);
 
     }
 
@@ -92,6 +92,10 @@ private:
     gpu::PipelinePointer _localLight;
     gpu::PipelinePointer _localLightOutline;
 
+    // Same local light shading but drawn as one quad per occupied cluster grid tile
+    gpu::PipelinePointer _localLightTiled;
+    gpu::PipelinePointer _localLightOutlineTiled;
+
     gpu::PipelinePointer _pointLightBack;
     gpu::PipelinePointer _pointLightFront;
     gpu::PipelinePointer _spotLightBack;
@@ -107,6 +111,8 @@ private:
 
     LightLocationsPtr _localLightLocations;
     LightLocationsPtr _localLightOutlineLocations;
+    LightLocationsPtr _localLightTiledLocations;
+    LightLocationsPtr _localLightOutlineTiledLocations;
     LightLocationsPtr _pointLightLocations;
     LightLocationsPtr _spotLightLocations;
 
@@ -95,7 +95,8 @@ const glm::uvec4 LightClusters::MAX_GRID_DIMENSIONS { 32, 32, 31, 16384 };
 LightClusters::LightClusters() :
     _lightIndicesBuffer(std::make_shared<gpu::Buffer>()),
     _clusterGridBuffer(/*std::make_shared<gpu::Buffer>(), */gpu::Element::INDEX_INT32),
-    _clusterContentBuffer(/*std::make_shared<gpu::Buffer>(), */gpu::Element::INDEX_INT32) {
+    _clusterContentBuffer(/*std::make_shared<gpu::Buffer>(), */gpu::Element::INDEX_INT32),
+    _tileListBuffer(gpu::Element::INDEX_INT32) {
 }
 
 void LightClusters::setDimensions(glm::uvec3 gridDims, uint32_t listBudget) {
@@ -145,6 +146,18 @@ uint32_t LightClusters::getNumClusters() const {
         _clusterGridBuffer._buffer = std::make_shared<gpu::Buffer>(_clusterGridBuffer._size, (gpu::Byte*) _clusterGrid.data(), _clusterGridBuffer._size);
     }
 
+    auto theFrustumGrid = _frustumGridBuffer.get();
+    uint32_t numTiles = theFrustumGrid.dims.x * theFrustumGrid.dims.y;
+    if (numTiles != (uint32_t) _occupiedTileFlags.size()) {
+        _occupiedTileFlags.clear();
+        _occupiedTileFlags.resize(numTiles, 0);
+        _occupiedTileList.clear();
+        _occupiedTileList.reserve(numTiles);
+        _numOccupiedTiles = 0;
+        _tileListBuffer._size = (numTiles * sizeof(int32_t));
+        _tileListBuffer._buffer = std::make_shared<gpu::Buffer>(_tileListBuffer._size, nullptr, _tileListBuffer._size);
+    }
+
     // Since LightIndex is 2bytes, we can fit 2 in a uint32
     auto configListBudget = _clusterContentBudget;
     if (sizeof(LightIndex) == 2) {
@@ -344,8 +357,16 @@ glm::ivec3 LightClusters::updateClusters() {
     // Clean up last info
     uint32_t numClusters = (uint32_t)_clusterGrid.size();
 
-    std::vector< std::vector< LightIndex > > clusterGridPoint(numClusters);
-    std::vector< std::vector< LightIndex > > clusterGridSpot(numClusters);
+    // Reuse the per cluster gathering lists from the previous frame: clearing keeps their
+    // capacity, so the steady state does no allocation at all in here
+    auto& clusterGridPoint = _clusterGridPoint;
+    auto& clusterGridSpot = _clusterGridSpot;
+    clusterGridPoint.resize(numClusters);
+    clusterGridSpot.resize(numClusters);
+    for (uint32_t i = 0; i < numClusters; i++) {
+        clusterGridPoint[i].clear();
+        clusterGridSpot[i].clear();
+    }
 
     _clusterGrid.clear();
     _clusterGrid.resize(numClusters, EMPTY_CLUSTER);
@@ -354,6 +375,9 @@ glm::ivec3 LightClusters::updateClusters() {
     _clusterContent.clear();
     _clusterContent.resize(maxNumIndices, INVALID_LIGHT);
 
+    uint32_t numTiles = (uint32_t)_occupiedTileFlags.size();
+    std::fill(_occupiedTileFlags.begin(), _occupiedTileFlags.end(), 0);
+
 
     auto theFrustumGrid(_frustumGridBuffer.get());
 
@@ -506,6 +530,8 @@ glm::ivec3 LightClusters::updateClusters() {
         checkBudget = true;
     }
     uint16_t indexOffset = 0;
+    _numOccupiedClusters = 0;
+    _maxLightsPerCluster = 0;
     for (int i = 0; i < (int) clusterGridPoint.size(); i++) {
         auto& clusterPoint = clusterGridPoint[i];
         auto& clusterSpot = clusterGridSpot[i];
@@ -515,6 +541,11 @@ glm::ivec3 LightClusters::updateClusters() {
         uint16_t numLights = numLightsPoint + numLightsSpot;
         uint16_t offset = indexOffset;
 
+        if (numLights) {
+            _numOccupiedClusters++;
+            _maxLightsPerCluster = std::max(_maxLightsPerCluster, (uint32_t)numLights);
+        }
+
         // Check for overflow
         if (checkBudget) {
             if ((indexOffset + numLights) > (uint16_t) maxNumIndices) {
@@ -522,9 +553,15 @@ glm::ivec3 LightClusters::updateClusters() {
             }
         }
 
-        // Encode the cluster grid: [ ContentOffset - 16bits, Num Point LIghts - 8bits, Num Spot Lights - 8bits] 
+        // Encode the cluster grid: [ ContentOffset - 16bits, Num Point LIghts - 8bits, Num Spot Lights - 8bits]
         _clusterGrid[i] = (uint32_t)((0xFF000000 & (numLightsSpot << 24)) | (0x00FF0000 & (numLightsPoint << 16)) | (0x0000FFFF & offset));
 
+        // The cluster index layout is x + (y + z * dims.y) * dims.x so collapsing along z
+        // to the XY tile the cluster belongs to is just a modulo
+        if (numLights) {
+            _occupiedTileFlags[i % numTiles] = 1;
+        }
+
 
         if (numLightsPoint) {
             memcpy(_clusterContent.data() + indexOffset, clusterPoint.data(), numLightsPoint * sizeof(LightIndex));
@@ -536,10 +573,22 @@ glm::ivec3 LightClusters::updateClusters() {
         }
     }
 
+    // Gather the list of occupied tiles driving the screen coverage of the local lighting pass
+    _occupiedTileList.clear();
+    for (uint32_t tile = 0; tile < numTiles; tile++) {
+        if (_occupiedTileFlags[tile]) {
+            _occupiedTileList.push_back((int32_t)tile);
+        }
+    }
+    _numOccupiedTiles = (uint32_t)_occupiedTileList.size();
+
     // update the buffers
     _clusterGridBuffer._buffer->setData(_clusterGridBuffer._size, (gpu::Byte*) _clusterGrid.data());
     _clusterContentBuffer._buffer->setSubData(0, indexOffset * sizeof(LightIndex), (gpu::Byte*) _clusterContent.data());
-    
+    if (_numOccupiedTiles) {
+        _tileListBuffer._buffer->setSubData(0, _numOccupiedTiles * sizeof(int32_t), (gpu::Byte*) _occupiedTileList.data());
+    }
+
     return glm::ivec3(numLightsIn, numClusteredLights, numClusterTouched);
 }
 
@@ -592,6 +641,7 @@ void LightClusteringPass::run(const render::SceneContextPointer& sceneContext, c
     config->setNumInputLights(clusteringStats.x);
     config->setNumClusteredLights(clusteringStats.y);
     config->setNumClusteredLightReferences(clusteringStats.z);
+    config->setClusterOccupancy(_lightClusters->_numOccupiedClusters, _lightClusters->_maxLightsPerCluster);
 }
 
 DebugLightClusters::DebugLightClusters() {
@@ -109,6 +109,23 @@ public:
     gpu::BufferView _clusterContentBuffer;
     uint32_t _clusterContentBudget { 0 };
 
+    // Per cluster gathering lists, kept from frame to frame so updateClusters does not
+    // reallocate one pair of vectors per cluster every frame
+    std::vector<std::vector<LightIndex>> _clusterGridPoint;
+    std::vector<std::vector<LightIndex>> _clusterGridSpot;
+
+    // The XY columns of the grid which received at least one light this frame, the
+    // local lighting pass is drawn as one quad per occupied tile instead of a full
+    // screen quad so the cluster walk only runs where lights can contribute
+    std::vector<uint8_t> _occupiedTileFlags;
+    std::vector<int32_t> _occupiedTileList;
+    gpu::BufferView _tileListBuffer;
+    uint32_t _numOccupiedTiles { 0 };
+
+    // Occupancy of the grid after the last updateClusters, for tuning the dimensions
+    uint32_t _numOccupiedClusters { 0 };
+    uint32_t _maxLightsPerCluster { 0 };
+
     bool _clusterResourcesInvalid { true };
     void updateClusterResource();
 };
@@ -132,6 +149,9 @@ class LightClusteringPassConfig : public render::Job::Config {
     Q_PROPERTY(int numInputLights MEMBER numInputLights NOTIFY dirty)
     Q_PROPERTY(int numClusteredLights MEMBER numClusteredLights NOTIFY dirty)
 
+    Q_PROPERTY(int numOccupiedClusters MEMBER numOccupiedClusters NOTIFY dirty)
+    Q_PROPERTY(int maxLightsPerCluster MEMBER maxLightsPerCluster NOTIFY dirty)
+
     Q_PROPERTY(int numSceneLights MEMBER numSceneLights NOTIFY dirty)
     Q_PROPERTY(int numFreeSceneLights MEMBER numFreeSceneLights NOTIFY dirty)
     Q_PROPERTY(int numAllocatedSceneLights MEMBER numAllocatedSceneLights NOTIFY dirty)
@@ -156,6 +176,11 @@ public:
     void setNumInputLights(int numLights) { numInputLights = numLights; emit dirty(); }
     void setNumClusteredLights(int numLights) { numClusteredLights = numLights; emit dirty(); }
 
+    int numOccupiedClusters { 0 };
+    int maxLightsPerCluster { 0 };
+
+    void setClusterOccupancy(int numOccupied, int maxLights) { numOccupiedClusters = numOccupied; maxLightsPerCluster = maxLights; emit dirty(); }
+
     int numSceneLights { 0 };
     int numFreeSceneLights { 0 };
     int numAllocatedSceneLights { 0 };
@@ -105,9 +105,6 @@ ShapeKey MeshPartPayload::getShapeKey() const {
     if (drawMaterialKey.isNormalMap()) {
         builder.withTangents();
     }
-    if (drawMaterialKey.isMetallicMap()) {
-        builder.withSpecular();
-    }
     if (drawMaterialKey.isLightmapMap()) {
         builder.withLightmap();
     }
@@ -373,11 +370,11 @@ void ModelMeshPartPayload::notifyLocationChanged() {
 }
 
 void ModelMeshPartPayload::updateTransformForSkinnedMesh(const Transform& renderTransform, const Transform& boundTransform,
-        const gpu::BufferPointer& buffer) {
+        const ClusterPaletteBuffer::Allocation& clusterPalette) {
     _transform = renderTransform;
     _worldBound = _adjustedLocalBound;
     _worldBound.transform(boundTransform);
-    _clusterBuffer = buffer;
+    _clusterPalette = clusterPalette;
 }
 
 ItemKey ModelMeshPartPayload::getKey() const {
@@ -461,7 +458,6 @@ ShapeKey ModelMeshPartPayload::getShapeKey() const {
 
     bool isTranslucent = drawMaterialKey.isTranslucent();
     bool hasTangents = drawMaterialKey.isNormalMap() && !mesh.tangents.isEmpty();
-    bool hasSpecular = drawMaterialKey.isMetallicMap();
     bool hasLightmap = drawMaterialKey.isLightmapMap();
     bool isUnlit = drawMaterialKey.isUnlit();
 
@@ -469,7 +465,7 @@ ShapeKey ModelMeshPartPayload::getShapeKey() const {
     bool wireframe = _model->isWireframe();
 
     if (wireframe) {
-        isTranslucent = hasTangents = hasSpecular = hasLightmap = isSkinned = false;
+        isTranslucent = hasTangents = hasLightmap = isSkinned = false;
     }
 
     ShapeKey::Builder builder;
@@ -481,9 +477,6 @@ ShapeKey ModelMeshPartPayload::getShapeKey() const {
     if (hasTangents) {
         builder.withTangents();
     }
-    if (hasSpecular) {
-        builder.withSpecular();
-    }
     if (hasLightmap) {
         builder.withLightmap();
     }
@@ -500,7 +493,8 @@ ShapeKey ModelMeshPartPayload::getShapeKey() const {
 }
 
 void ModelMeshPartPayload::bindMesh(gpu::Batch& batch) const {
-    if (!_isBlendShaped) {
+    auto blendedIt = _isBlendShaped ? _model->_blendedVertexBuffers.find(_meshIndex) : _model->_blendedVertexBuffers.end();
+    if (blendedIt == _model->_blendedVertexBuffers.end()) {
         batch.setIndexBuffer(gpu::UINT32, (_drawMesh->getIndexBuffer()._buffer), 0);
 
         batch.setInputFormat((_drawMesh->getVertexFormat()));
@@ -511,8 +505,9 @@ void ModelMeshPartPayload::bindMesh(gpu::Batch& batch) const {
 
         batch.setInputFormat((_drawMesh->getVertexFormat()));
 
-        batch.setInputBuffer(0, _model->_blendedVertexBuffers[_meshIndex], 0, sizeof(glm::vec3));
-        batch.setInputBuffer(1, _model->_blendedVertexBuffers[_meshIndex], _drawMesh->getNumVertices() * sizeof(glm::vec3), sizeof(glm::vec3));
+        const gpu::BufferPointer& blendedVertexBuffer = blendedIt->second;
+        batch.setInputBuffer(0, blendedVertexBuffer, 0, sizeof(glm::vec3));
+        batch.setInputBuffer(1, blendedVertexBuffer, _drawMesh->getNumVertices() * sizeof(glm::vec3), sizeof(glm::vec3));
         batch.setInputStream(2, _drawMesh->getVertexStream().makeRangedStream(2));
     }
 
@@ -525,8 +520,9 @@ void ModelMeshPartPayload::bindMesh(gpu::Batch& batch) const {
 
 void ModelMeshPartPayload::bindTransform(gpu::Batch& batch, const ShapePipeline::LocationsPointer locations, RenderArgs::RenderMode renderMode) const {
     // Still relying on the raw data from the model
-    if (_clusterBuffer) {
-        batch.setUniformBuffer(ShapePipeline::Slot::BUFFER::SKINNING, _clusterBuffer);
+    if (_clusterPalette.size > 0) {
+        batch.setUniformBuffer(ShapePipeline::Slot::BUFFER::SKINNING, ClusterPaletteBuffer::instance().getBuffer(),
+            _clusterPalette.offset, _clusterPalette.size);
     }
     batch.setModelTransform(_transform);
 }
@@ -557,6 +553,12 @@ void ModelMeshPartPayload::render(RenderArgs* args) const {
         return; // bail asap
     }
 
+    // When the model stands in as an impostor only its quad draws, unless this render
+    // is the capture of the impostor itself
+    if (_model->isRenderingAsImpostor() && !_model->isCapturingImpostor()) {
+        return;
+    }
+
     if (_fadeState == FADE_WAITING_TO_START) {
         if (_model->isLoaded() && _model->getGeometry()->areTexturesLoaded()) {
             if (EntityItem::getEntitiesShouldFadeFunction()()) {
@@ -582,6 +584,35 @@ void ModelMeshPartPayload::render(RenderArgs* args) const {
     auto locations =  args->_pipeline->locations;
     assert(locations);
 
+    // Parts that carry no per-instance state beyond their model transform get merged with
+    // the other parts sharing the same geometry, material and pipeline into one instanced
+    // draw through the batch's named call collector, instead of one draw call each.
+    // Translucent parts keep the individual path so the depth sort stays meaningful.
+    if (canMergeInstances() && _fadeState == FADE_COMPLETE && !_isBlendShaped && _clusterPalette.size == 0 &&
+            _drawMaterial && !_drawMaterial->getKey().isTranslucent()) {
+        batch.setModelTransform(_transform);
+
+        std::string instanceName = "model_part_" + std::to_string((size_t)_drawMesh.get()) + "_" +
+            std::to_string(_partIndex) + "_" + std::to_string((size_t)_drawMaterial.get()) + "_" +
+            std::to_string(std::hash<render::ShapePipelinePointer>()(args->_pipeline));
+
+        auto pipeline = args->_pipeline;
+        bool enableTexturing = args->_enableTexturing;
+        // Capturing this is safe: items are only removed by the scene's pending changes,
+        // which are processed before any payload records into the next frame's batches
+        batch.setupNamedCalls(instanceName, [this, pipeline, enableTexturing](gpu::Batch& batch, gpu::Batch::NamedBatchData& data) {
+            batch.setPipeline(pipeline->pipeline);
+            pipeline->prepare(batch);
+            bindMesh(batch);
+            bindMaterial(batch, pipeline->locations, enableTexturing);
+            batch.drawIndexedInstanced((gpu::uint32)data.count(), gpu::TRIANGLES, _drawPart._numIndices, _drawPart._startIndex);
+        });
+
+        const int INDICES_PER_TRIANGLE = 3;
+        args->_details._trianglesRendered += _drawPart._numIndices / INDICES_PER_TRIANGLE;
+        return;
+    }
+
     bindTransform(batch, locations, args->_renderMode);
 
     //Bind the index buffer and vertex buffer and Blend shapes if needed
@@ -21,6 +21,8 @@
 
 #include <model/Geometry.h>
 
+#include "ClusterPaletteBuffer.h"
+
 const uint8_t FADE_WAITING_TO_START = 0;
 const uint8_t FADE_IN_PROGRESS = 1;
 const uint8_t FADE_COMPLETE = 2;
@@ -91,7 +93,7 @@ public:
     void notifyLocationChanged() override;
     void updateTransformForSkinnedMesh(const Transform& renderTransform,
             const Transform& boundTransform,
-            const gpu::BufferPointer& buffer);
+            const ClusterPaletteBuffer::Allocation& clusterPalette);
 
     float computeFadeAlpha() const;
 
@@ -107,9 +109,13 @@ public:
 
     void initCache();
 
+    // Whether this part may be merged into an instanced draw with the other parts sharing
+    // its geometry, material and pipeline; subclasses with extra per-instance binds say no
+    virtual bool canMergeInstances() const { return true; }
+
     void computeAdjustedLocalBound(const QVector<glm::mat4>& clusterMatrices);
 
-    gpu::BufferPointer _clusterBuffer;
+    ClusterPaletteBuffer::Allocation _clusterPalette;
     Model* _model;
 
     int _meshIndex;
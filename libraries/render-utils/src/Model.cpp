@@ -24,6 +24,7 @@
 
 #include "AbstractViewStateInterface.h"
 #include "MeshPartPayload.h"
+#include "ModelImpostors.h"
 #include "Model.h"
 
 #include "RenderUtilsLogging.h"
@@ -34,6 +35,7 @@ using namespace std;
 int nakedModelPointerTypeId = qRegisterMetaType<ModelPointer>();
 int weakGeometryResourceBridgePointerTypeId = qRegisterMetaType<Geometry::WeakPointer >();
 int vec3VectorTypeId = qRegisterMetaType<QVector<glm::vec3> >();
+int floatVectorTypeId = qRegisterMetaType<QVector<float> >();
 float Model::FAKE_DIMENSION_PLACEHOLDER = -1.0f;
 #define HTTP_INVALID_COM "http://invalid.com"
 
@@ -249,12 +251,17 @@ void Model::updateRenderItems() {
                         if (state.clusterMatrices.size() == 1) {
                             renderTransform = modelTransform.worldTransform(Transform(state.clusterMatrices[0]));
                         }
-                        data.updateTransformForSkinnedMesh(renderTransform, modelTransform, state.clusterBuffer);
+                        data.updateTransformForSkinnedMesh(renderTransform, modelTransform, state.clusterPalette);
                     }
                 }
             });
         }
 
+        if (self->_impostorRenderItem != render::Item::INVALID_ITEM_ID) {
+            // refresh the spatial placement of the impostor quad along with the meshes
+            pendingChanges.updateItem<ModelImpostorPayload>(self->_impostorRenderItem, [](ModelImpostorPayload& data) {});
+        }
+
         // collision mesh does not share the same unit scale as the FBX file's mesh: only apply offset
         Transform collisionMeshOffset;
         collisionMeshOffset.setIdentity();
@@ -301,22 +308,23 @@ bool Model::updateGeometry() {
         assert(_meshStates.empty());
 
         const FBXGeometry& fbxGeometry = getFBXGeometry();
+        int meshIndex = 0;
         foreach (const FBXMesh& mesh, fbxGeometry.meshes) {
             MeshState state;
             state.clusterMatrices.resize(mesh.clusters.size());
             _meshStates.append(state);
 
-            // Note: we add empty buffers for meshes that lack blendshapes so we can access the buffers by index
-            // later in ModelMeshPayload, however the vast majority of meshes will not have them.
-            // TODO? make _blendedVertexBuffers a map instead of vector and only add for meshes with blendshapes?
-            auto buffer = std::make_shared<gpu::Buffer>();
+            // only meshes with blendshapes need a per-instance vertex buffer; the rest render
+            // straight from the gpu buffers shared through the geometry cache
             if (!mesh.blendshapes.isEmpty()) {
+                auto buffer = std::make_shared<gpu::Buffer>();
                 buffer->resize((mesh.vertices.size() + mesh.normals.size()) * sizeof(glm::vec3));
                 buffer->setSubData(0, mesh.vertices.size() * sizeof(glm::vec3), (gpu::Byte*) mesh.vertices.constData());
                 buffer->setSubData(mesh.vertices.size() * sizeof(glm::vec3),
                                    mesh.normals.size() * sizeof(glm::vec3), (gpu::Byte*) mesh.normals.constData());
+                _blendedVertexBuffers[meshIndex] = buffer;
             }
-            _blendedVertexBuffers.push_back(buffer);
+            meshIndex++;
         }
         needFullUpdate = true;
     }
@@ -607,6 +615,15 @@ bool Model::addToScene(std::shared_ptr<render::Scene> scene,
             }
             somethingAdded = !_modelMeshRenderItems.empty();
 
+            if (somethingAdded && _impostorRenderItem == render::Item::INVALID_ITEM_ID) {
+                // One extra item per model: the camera facing quad standing in for all the
+                // meshes when the model is far enough away
+                auto impostorPayload = std::make_shared<ModelImpostorPayload>(this);
+                auto impostorRenderPayload = std::make_shared<ModelImpostorPayload::Payload>(impostorPayload);
+                _impostorRenderItem = scene->allocateID();
+                pendingChanges.resetItem(_impostorRenderItem, impostorRenderPayload);
+            }
+
             _renderInfoVertexCount = verticesCount;
             _renderInfoDrawCalls = _modelMeshRenderItems.count();
             _renderInfoHasTransparent = hasTransparent;
@@ -630,6 +647,12 @@ void Model::removeFromScene(std::shared_ptr<render::Scene> scene, render::Pendin
     _modelMeshRenderItems.clear();
     _modelMeshRenderItemsSet.clear();
 
+    if (_impostorRenderItem != render::Item::INVALID_ITEM_ID) {
+        pendingChanges.removeItem(_impostorRenderItem);
+        _impostorRenderItem = render::Item::INVALID_ITEM_ID;
+    }
+    exitImpostor();
+
     foreach (auto item, _collisionRenderItems.keys()) {
         pendingChanges.removeItem(item);
     }
@@ -812,7 +835,12 @@ void Model::setURL(const QUrl& url) {
     deleteGeometry();
 
     auto resource = DependencyManager::get<ModelCache>()->getGeometryResource(url);
-    resource->setLoadPriority(this, _loadingPriority);
+    if (_loadingPriorityOperator) {
+        // let the score track the camera while the request waits in the queue
+        resource->setLoadPriorityOperator(this, _loadingPriorityOperator);
+    } else {
+        resource->setLoadPriority(this, _loadingPriority);
+    }
     _renderWatcher.setResource(resource);
     onInvalidate();
 }
@@ -878,7 +906,9 @@ class Blender : public QRunnable {
 public:
 
     Blender(ModelPointer model, int blendNumber, const Geometry::WeakPointer& geometry,
-        const QVector<FBXMesh>& meshes, const QVector<float>& blendshapeCoefficients);
+        const QVector<FBXMesh>& meshes, const QVector<float>& blendshapeCoefficients,
+        const QVector<glm::vec3>& lastVertices, const QVector<glm::vec3>& lastNormals,
+        const QVector<float>& lastCoefficients);
 
     virtual void run() override;
 
@@ -889,28 +919,59 @@ private:
     Geometry::WeakPointer _geometry;
     QVector<FBXMesh> _meshes;
     QVector<float> _blendshapeCoefficients;
+    // Result of the last applied blend and the coefficients it was computed with, when
+    // they are usable only the blendshapes whose coefficient moved are accumulated
+    QVector<glm::vec3> _lastVertices;
+    QVector<glm::vec3> _lastNormals;
+    QVector<float> _lastCoefficients;
 };
 
 Blender::Blender(ModelPointer model, int blendNumber, const Geometry::WeakPointer& geometry,
-        const QVector<FBXMesh>& meshes, const QVector<float>& blendshapeCoefficients) :
+        const QVector<FBXMesh>& meshes, const QVector<float>& blendshapeCoefficients,
+        const QVector<glm::vec3>& lastVertices, const QVector<glm::vec3>& lastNormals,
+        const QVector<float>& lastCoefficients) :
     _model(model),
     _blendNumber(blendNumber),
     _geometry(geometry),
     _meshes(meshes),
-    _blendshapeCoefficients(blendshapeCoefficients) {
+    _blendshapeCoefficients(blendshapeCoefficients),
+    _lastVertices(lastVertices),
+    _lastNormals(lastNormals),
+    _lastCoefficients(lastCoefficients) {
 }
 
 void Blender::run() {
     PROFILE_RANGE_EX(simulation_animation, __FUNCTION__, 0xFFFF0000, 0, { { "url", _model->getURL().toString() } });
     QVector<glm::vec3> vertices, normals;
     if (_model) {
+        int totalSize = 0;
+        foreach (const FBXMesh& mesh, _meshes) {
+            if (!mesh.blendshapes.isEmpty()) {
+                totalSize += mesh.vertices.size();
+            }
+        }
+
+        // Start from the last applied blend and accumulate only the blendshapes whose
+        // coefficient moved, rather than rebuilding every vertex from the base mesh.
+        // A full rebuild still happens periodically so that the incremental deltas
+        // cannot accumulate float drift
+        const int FULL_REBUILD_PERIOD = 128;
+        bool incremental = (_lastVertices.size() == totalSize) && (_lastNormals.size() == totalSize) &&
+            !_lastCoefficients.isEmpty() && (_blendNumber % FULL_REBUILD_PERIOD != 0);
+        if (incremental) {
+            vertices = _lastVertices;
+            normals = _lastNormals;
+        }
+
         int offset = 0;
         foreach (const FBXMesh& mesh, _meshes) {
             if (mesh.blendshapes.isEmpty()) {
                 continue;
             }
-            vertices += mesh.vertices;
-            normals += mesh.normals;
+            if (!incremental) {
+                vertices += mesh.vertices;
+                normals += mesh.normals;
+            }
             glm::vec3* meshVertices = vertices.data() + offset;
             glm::vec3* meshNormals = normals.data() + offset;
             offset += mesh.vertices.size();
@@ -918,7 +979,12 @@ void Blender::run() {
             for (int i = 0, n = qMin(_blendshapeCoefficients.size(), mesh.blendshapes.size()); i < n; i++) {
                 float vertexCoefficient = _blendshapeCoefficients.at(i);
                 const float EPSILON = 0.0001f;
-                if (vertexCoefficient < EPSILON) {
+                if (incremental) {
+                    vertexCoefficient -= (i < _lastCoefficients.size() ? _lastCoefficients.at(i) : 0.0f);
+                    if (fabsf(vertexCoefficient) < EPSILON) {
+                        continue;
+                    }
+                } else if (vertexCoefficient < EPSILON) {
                     continue;
                 }
                 float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
@@ -935,7 +1001,7 @@ void Blender::run() {
     QMetaObject::invokeMethod(DependencyManager::get<ModelBlender>().data(), "setBlendedVertices",
         Q_ARG(ModelPointer, _model), Q_ARG(int, _blendNumber),
         Q_ARG(const Geometry::WeakPointer&, _geometry), Q_ARG(const QVector<glm::vec3>&, vertices),
-        Q_ARG(const QVector<glm::vec3>&, normals));
+        Q_ARG(const QVector<glm::vec3>&, normals), Q_ARG(const QVector<float>&, _blendshapeCoefficients));
 }
 
 void Model::setScaleToFit(bool scaleToFit, const glm::vec3& dimensions) {
@@ -1071,20 +1137,25 @@ void Model::updateClusterMatrices() {
     for (int i = 0; i < _meshStates.size(); i++) {
         MeshState& state = _meshStates[i];
         const FBXMesh& mesh = geometry.meshes.at(i);
+        bool paletteChanged = false;
         for (int j = 0; j < mesh.clusters.size(); j++) {
             const FBXCluster& cluster = mesh.clusters.at(j);
             auto jointMatrix = _rig->getJointTransform(cluster.jointIndex);
+            glm::mat4 previous = state.clusterMatrices[j];
             glm_mat4u_mul(jointMatrix, cluster.inverseBindMatrix, state.clusterMatrices[j]);
+            paletteChanged = paletteChanged || (state.clusterMatrices[j] != previous);
         }
 
-        // Once computed the cluster matrices, update the buffer(s)
+        // Once computed the cluster matrices, refresh our range of the shared palette,
+        // but only when the pose actually moved since the last upload
         if (mesh.clusters.size() > 1) {
-            if (!state.clusterBuffer) {
-                state.clusterBuffer = std::make_shared<gpu::Buffer>(state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                                    (const gpu::Byte*) state.clusterMatrices.constData());
-            } else {
-                state.clusterBuffer->setSubData(0, state.clusterMatrices.size() * sizeof(glm::mat4),
-                                                (const gpu::Byte*) state.clusterMatrices.constData());
+            auto& palette = ClusterPaletteBuffer::instance();
+            if (state.clusterPalette.size == 0) {
+                state.clusterPalette = palette.allocate(mesh.clusters.size());
+                paletteChanged = true;
+            }
+            if (paletteChanged) {
+                palette.update(state.clusterPalette, mesh.clusters.size(), state.clusterMatrices.constData());
             }
         }
     }
@@ -1115,25 +1186,79 @@ float Model::getLimbLength(int jointIndex) const {
     return _rig->getLimbLength(jointIndex, freeLineage, _scale, geometry.joints);
 }
 
+void Model::enterImpostor() {
+    if (_renderAsImpostor) {
+        return;
+    }
+    int slotIndex = ModelImpostors::instance().acquireSlot();
+    if (slotIndex < 0) {
+        // the atlas is full, keep drawing the meshes
+        return;
+    }
+    _impostorSlot = slotIndex;
+    _renderAsImpostor = true;
+}
+
+void Model::exitImpostor() {
+    if (_impostorSlot >= 0) {
+        ModelImpostors::instance().releaseSlot(_impostorSlot);
+        _impostorSlot = -1;
+    }
+    _renderAsImpostor = false;
+}
+
 bool Model::maybeStartBlender() {
     if (isLoaded()) {
         const FBXGeometry& fbxGeometry = getFBXGeometry();
         if (fbxGeometry.hasBlendedMeshes()) {
             QThreadPool::globalInstance()->start(new Blender(getThisPointer(), ++_blendNumber, _renderGeometry,
-                fbxGeometry.meshes, _blendshapeCoefficients));
+                fbxGeometry.meshes, _blendshapeCoefficients,
+                _blendedVertices, _blendedNormals, _appliedBlendshapeCoefficients));
             return true;
         }
     }
     return false;
 }
 
+int Model::getBlendedVertexCount() const {
+    int count = 0;
+    if (isLoaded()) {
+        foreach (const FBXMesh& mesh, getFBXGeometry().meshes) {
+            if (!mesh.blendshapes.isEmpty()) {
+                count += mesh.vertices.size();
+            }
+        }
+    }
+    return count;
+}
+
+float Model::getBlendPriority() const {
+    // Approximate the apparent size on screen with the bounding radius over the distance
+    // to the view position, so the blends of the models filling the view land first
+    float radius = glm::length(getMeshExtents().size()) * 0.5f;
+    if (_viewState) {
+        ViewFrustum viewFrustum;
+        _viewState->copyCurrentViewFrustum(viewFrustum);
+        const float MIN_DISTANCE = 0.1f;
+        float distance = std::max(MIN_DISTANCE, glm::distance(_translation, viewFrustum.getPosition()));
+        return radius / distance;
+    }
+    return radius;
+}
+
 void Model::setBlendedVertices(int blendNumber, const Geometry::WeakPointer& geometry,
-        const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals) {
+        const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals, const QVector<float>& blendshapeCoefficients) {
     auto geometryRef = geometry.lock();
     if (!geometryRef || _renderGeometry != geometryRef || _blendedVertexBuffers.empty() || blendNumber < _appliedBlendNumber) {
         return;
     }
     _appliedBlendNumber = blendNumber;
+
+    // Keep the applied result around, the next blender starts from it and only
+    // accumulates the blendshapes whose coefficient changed
+    _blendedVertices = vertices;
+    _blendedNormals = normals;
+    _appliedBlendshapeCoefficients = blendshapeCoefficients;
     const FBXGeometry& fbxGeometry = getFBXGeometry();
     int index = 0;
     for (int i = 0; i < fbxGeometry.meshes.size(); i++) {
@@ -1142,10 +1267,13 @@ void Model::setBlendedVertices(int blendNumber, const Geometry::WeakPointer& geo
             continue;
         }
 
-        gpu::BufferPointer& buffer = _blendedVertexBuffers[i];
-        buffer->setSubData(0, mesh.vertices.size() * sizeof(glm::vec3), (gpu::Byte*) vertices.constData() + index*sizeof(glm::vec3));
-        buffer->setSubData(mesh.vertices.size() * sizeof(glm::vec3),
-            mesh.normals.size() * sizeof(glm::vec3), (gpu::Byte*) normals.constData() + index*sizeof(glm::vec3));
+        auto blendedIt = _blendedVertexBuffers.find(i);
+        if (blendedIt != _blendedVertexBuffers.end()) {
+            gpu::BufferPointer& buffer = blendedIt->second;
+            buffer->setSubData(0, mesh.vertices.size() * sizeof(glm::vec3), (gpu::Byte*) vertices.constData() + index*sizeof(glm::vec3));
+            buffer->setSubData(mesh.vertices.size() * sizeof(glm::vec3),
+                mesh.normals.size() * sizeof(glm::vec3), (gpu::Byte*) normals.constData() + index*sizeof(glm::vec3));
+        }
 
         index += mesh.vertices.size();
     }
@@ -1154,6 +1282,12 @@ void Model::setBlendedVertices(int blendNumber, const Geometry::WeakPointer& geo
 void Model::deleteGeometry() {
     _deleteGeometryCounter++;
     _blendedVertexBuffers.clear();
+    _blendedVertices.clear();
+    _blendedNormals.clear();
+    _appliedBlendshapeCoefficients.clear();
+    for (const auto& state : _meshStates) {
+        ClusterPaletteBuffer::instance().release(state.clusterPalette);
+    }
     _meshStates.clear();
     _rig->destroyAnimGraph();
     _blendedBlendshapeCoefficients.clear();
@@ -1347,10 +1481,16 @@ ModelBlender::ModelBlender() :
 ModelBlender::~ModelBlender() {
 }
 
+// Budget on the number of vertices the blends in flight can touch, keeping one frame of
+// a crowded scene from queueing an unbounded amount of blend work on the thread pool
+static const int MAX_PENDING_BLEND_VERTICES = 200000;
+
 void ModelBlender::noteRequiresBlend(ModelPointer model) {
-    if (_pendingBlenders < QThread::idealThreadCount()) {
+    if (_pendingBlenders < QThread::idealThreadCount() &&
+            (_pendingBlenders == 0 || (_pendingBlendVertices + model->getBlendedVertexCount() <= MAX_PENDING_BLEND_VERTICES))) {
         if (model->maybeStartBlender()) {
             _pendingBlenders++;
+            _pendingBlendVertices += model->getBlendedVertexCount();
         }
         return;
     }
@@ -1361,20 +1501,45 @@ void ModelBlender::noteRequiresBlend(ModelPointer model) {
     }
 }
 
-void ModelBlender::setBlendedVertices(ModelPointer model, int blendNumber,
-        const Geometry::WeakPointer& geometry, const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals) {
+void ModelBlender::setBlendedVertices(ModelPointer model, int blendNumber, const Geometry::WeakPointer& geometry,
+        const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals, const QVector<float>& blendshapeCoefficients) {
     if (model) {
-        model->setBlendedVertices(blendNumber, geometry, vertices, normals);
+        model->setBlendedVertices(blendNumber, geometry, vertices, normals, blendshapeCoefficients);
     }
     _pendingBlenders--;
+    _pendingBlendVertices = std::max(0, _pendingBlendVertices - vertices.size());
     {
         Lock lock(_mutex);
-        for (auto i = _modelsRequiringBlends.begin(); i != _modelsRequiringBlends.end();) {
-            auto weakPtr = *i;
-            _modelsRequiringBlends.erase(i++); // remove front of the set
-            ModelPointer nextModel = weakPtr.lock();
-            if (nextModel && nextModel->maybeStartBlender()) {
+        while (!_modelsRequiringBlends.empty()) {
+            // Wake the waiting model that takes the most of the screen first
+            ModelPointer nextModel;
+            float bestPriority = 0.0f;
+            auto bestIt = _modelsRequiringBlends.end();
+            for (auto i = _modelsRequiringBlends.begin(); i != _modelsRequiringBlends.end();) {
+                ModelPointer candidate = i->lock();
+                if (!candidate) {
+                    _modelsRequiringBlends.erase(i++); // clean up the dead entry
+                    continue;
+                }
+                float priority = candidate->getBlendPriority();
+                if (!nextModel || priority > bestPriority) {
+                    bestPriority = priority;
+                    nextModel = candidate;
+                    bestIt = i;
+                }
+                ++i;
+            }
+            if (!nextModel) {
+                break;
+            }
+            if (_pendingBlenders > 0 && (_pendingBlendVertices + nextModel->getBlendedVertexCount() > MAX_PENDING_BLEND_VERTICES)) {
+                // Over the blend budget for now, the next completion will pick it up
+                break;
+            }
+            _modelsRequiringBlends.erase(bestIt);
+            if (nextModel->maybeStartBlender()) {
                 _pendingBlenders++;
+                _pendingBlendVertices += nextModel->getBlendedVertexCount();
                 return;
             }
         }
@@ -30,6 +30,7 @@
 #include <SpatiallyNestable.h>
 #include <TriangleSet.h>
 
+#include "ClusterPaletteBuffer.h"
 #include "GeometryCache.h"
 #include "TextureCache.h"
 #include "Rig.h"
@@ -108,11 +109,26 @@ public:
     AABox getRenderableMeshBound() const;
     const render::ItemIDs& fetchRenderItemIDs() const;
 
+    // Impostor state: when the model is far enough away its meshes stop drawing and a
+    // camera facing quad sourced from the shared atlas stands in (see ModelImpostors)
+    bool isRenderingAsImpostor() const { return _renderAsImpostor; }
+    bool isCapturingImpostor() const { return _capturingImpostor; }
+    void setCapturingImpostor(bool capturing) { _capturingImpostor = capturing; }
+    int getImpostorSlot() const { return _impostorSlot; }
+    void enterImpostor();
+    void exitImpostor();
+
     bool maybeStartBlender();
 
+    /// Total number of vertices the blendshapes of this model touch, the cost of one blend
+    int getBlendedVertexCount() const;
+
+    /// Approximate apparent size of the model on screen, used to order pending vertex blends
+    float getBlendPriority() const;
+
     /// Sets blended vertices computed in a separate thread.
     void setBlendedVertices(int blendNumber, const Geometry::WeakPointer& geometry,
-        const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals);
+        const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals, const QVector<float>& blendshapeCoefficients);
 
     bool isLoaded() const { return (bool)_renderGeometry && _renderGeometry->isGeometryLoaded(); }
 
@@ -232,6 +248,7 @@ public:
     void setCollisionMesh(model::MeshPointer mesh);
 
     void setLoadingPriority(float priority) { _loadingPriority = priority; }
+    void setLoadingPriorityOperator(std::function<float()> priorityOperator) { _loadingPriorityOperator = priorityOperator; }
 
     size_t getRenderInfoVertexCount() const { return _renderInfoVertexCount; }
     size_t getRenderInfoTextureSize();
@@ -242,7 +259,7 @@ public:
     class MeshState {
     public:
         QVector<glm::mat4> clusterMatrices;
-        gpu::BufferPointer clusterBuffer;
+        ClusterPaletteBuffer::Allocation clusterPalette;
     };
 
     const MeshState& getMeshState(int index) { return _meshStates.at(index); }
@@ -346,7 +363,9 @@ protected:
     QUrl _url;
     bool _isVisible;
 
-    gpu::Buffers _blendedVertexBuffers;
+    // per-instance blend output, keyed by mesh index; only meshes with blendshapes get an
+    // entry -- everything else binds the gpu buffers shared through the geometry cache
+    std::unordered_map<int, gpu::BufferPointer> _blendedVertexBuffers;
 
     QVector<QVector<QSharedPointer<Texture> > > _dilatedTextures;
 
@@ -354,6 +373,13 @@ protected:
     int _blendNumber;
     int _appliedBlendNumber;
 
+    // Result of the last applied blend and the coefficients it was computed with, handed
+    // back to the blender so it only accumulates the blendshapes whose coefficient moved.
+    // QVector is implicitly shared so passing these to the worker is cheap
+    QVector<glm::vec3> _blendedVertices;
+    QVector<glm::vec3> _blendedNormals;
+    QVector<float> _appliedBlendshapeCoefficients;
+
     QMutex _mutex;
 
     bool _triangleSetsValid { false };
@@ -381,6 +407,12 @@ protected:
 
     render::ItemIDs _modelMeshRenderItemIDs;
 
+    // Extra render item standing in for all the meshes when the model is far enough away
+    render::ItemID _impostorRenderItem { render::Item::INVALID_ITEM_ID };
+    bool _renderAsImpostor { false };
+    bool _capturingImpostor { false };
+    int _impostorSlot { -1 };
+
     bool _addedToScene { false }; // has been added to scene
     bool _needsFixupInScene { true }; // needs to be removed/re-added to scene
     bool _needsReload { true };
@@ -408,6 +440,7 @@ protected:
 
 private:
     float _loadingPriority { 0.0f };
+    std::function<float()> _loadingPriorityOperator;
 
     void calculateTextureInfo();
 };
@@ -427,7 +460,7 @@ public:
 
 public slots:
     void setBlendedVertices(ModelPointer model, int blendNumber, const Geometry::WeakPointer& geometry,
-        const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals);
+        const QVector<glm::vec3>& vertices, const QVector<glm::vec3>& normals, const QVector<float>& blendshapeCoefficients);
 
 private:
     using Mutex = std::mutex;
@@ -438,6 +471,9 @@ private:
 
     std::set<ModelWeakPointer, std::owner_less<ModelWeakPointer>> _modelsRequiringBlends;
     int _pendingBlenders;
+    // Vertices touched by the blends currently in flight, the budget on this caps how much
+    // blending can pile up in one frame
+    int _pendingBlendVertices { 0 };
     Mutex _mutex;
 };
 
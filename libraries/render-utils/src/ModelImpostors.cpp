@@ -0,0 +1,226 @@
+//
+//  ModelImpostors.cpp
+//  libraries/render-utils/src
+//
+//  Created by Sam Gateau on 4/24/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ModelImpostors.h"
+
+#include "GeometryCache.h"
+#include "Model.h"
+
+ModelImpostors& ModelImpostors::instance() {
+    static ModelImpostors INSTANCE;
+    return INSTANCE;
+}
+
+void ModelImpostors::allocateAtlas() {
+    if (_atlasFramebuffer) {
+        return;
+    }
+    int slotsPerRow = ATLAS_SIZE / SLOT_SIZE;
+    _slots.resize(slotsPerRow * slotsPerRow);
+
+    auto defaultSampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_LINEAR);
+    _atlasTexture = gpu::TexturePointer(gpu::Texture::create2D(gpu::Element::COLOR_SRGBA_32, ATLAS_SIZE, ATLAS_SIZE, defaultSampler));
+    _atlasFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("impostorAtlas"));
+    _atlasFramebuffer->setRenderBuffer(0, _atlasTexture);
+
+    auto depthFormat = gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::DEPTH_STENCIL); // Depth24_Stencil8 texel format
+    auto depthTexture = gpu::TexturePointer(gpu::Texture::create2D(depthFormat, ATLAS_SIZE, ATLAS_SIZE, defaultSampler));
+    _atlasFramebuffer->setDepthStencilBuffer(depthTexture, depthFormat);
+}
+
+int ModelImpostors::acquireSlot() {
+    allocateAtlas();
+    for (int i = 0; i < (int)_slots.size(); i++) {
+        if (!_slots[i].used) {
+            _slots[i] = Slot();
+            _slots[i].used = true;
+            return i;
+        }
+    }
+    return -1;
+}
+
+void ModelImpostors::releaseSlot(int slotIndex) {
+    if (slotIndex >= 0 && slotIndex < (int)_slots.size()) {
+        _slots[slotIndex] = Slot();
+    }
+}
+
+glm::ivec4 ModelImpostors::getSlotViewport(int slotIndex) const {
+    int slotsPerRow = ATLAS_SIZE / SLOT_SIZE;
+    return glm::ivec4((slotIndex % slotsPerRow) * SLOT_SIZE, (slotIndex / slotsPerRow) * SLOT_SIZE, SLOT_SIZE, SLOT_SIZE);
+}
+
+glm::vec4 ModelImpostors::getSlotTexcoordRect(int slotIndex) const {
+    glm::vec4 viewport = glm::vec4(getSlotViewport(slotIndex));
+    return viewport / (float)ATLAS_SIZE;
+}
+
+void ModelImpostors::queueCapture(const ModelPointer& model) {
+    int slotIndex = model->getImpostorSlot();
+    if (slotIndex < 0 || _slots[slotIndex].capturePending) {
+        return;
+    }
+    _slots[slotIndex].capturePending = true;
+    _captureQueue.push_back(model);
+}
+
+ModelPointer ModelImpostors::takeNextCapture() {
+    while (!_captureQueue.empty()) {
+        auto model = _captureQueue.front().lock();
+        _captureQueue.pop_front();
+        if (model && model->getImpostorSlot() >= 0) {
+            return model;
+        }
+    }
+    return ModelPointer();
+}
+
+void ModelImpostors::finishCapture(int slotIndex, const glm::vec3& center, float radius, const glm::vec3& viewDir) {
+    auto& slot = _slots[slotIndex];
+    slot.center = center;
+    slot.radius = radius;
+    slot.capturedViewDir = viewDir;
+    slot.rendered = true;
+    slot.capturePending = false;
+}
+
+const gpu::FramebufferPointer& ModelImpostors::getAtlasFramebuffer() {
+    allocateAtlas();
+    return _atlasFramebuffer;
+}
+
+const gpu::TexturePointer& ModelImpostors::getAtlasTexture() {
+    allocateAtlas();
+    return _atlasTexture;
+}
+
+glm::quat ModelImpostors::evalFacingRotation(const glm::vec3& viewDir) {
+    glm::vec3 zAxis = -viewDir;
+    glm::vec3 up = (fabsf(zAxis.y) < 0.9f) ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+    glm::vec3 xAxis = glm::normalize(glm::cross(up, zAxis));
+    glm::vec3 yAxis = glm::cross(zAxis, xAxis);
+    return glm::quat_cast(glm::mat3(xAxis, yAxis, zAxis));
+}
+
+namespace render {
+template <> const ItemKey payloadGetKey(const ModelImpostorPayload::Pointer& payload) {
+    if (payload) {
+        return payload->getKey();
+    }
+    return ItemKey::Builder::transparentShape();
+}
+
+template <> const Item::Bound payloadGetBound(const ModelImpostorPayload::Pointer& payload) {
+    if (payload) {
+        return payload->getBound();
+    }
+    return Item::Bound();
+}
+
+template <> const ShapeKey shapeGetShapeKey(const ModelImpostorPayload::Pointer& payload) {
+    if (payload) {
+        return payload->getShapeKey();
+    }
+    return ShapeKey::Builder::ownPipeline();
+}
+
+template <> void payloadRender(const ModelImpostorPayload::Pointer& payload, RenderArgs* args) {
+    if (payload) {
+        payload->render(args);
+    }
+}
+}
+
+ModelImpostorPayload::ModelImpostorPayload(Model* model) :
+    _model(model),
+    _quadId(GeometryCache::UNKNOWN_ID) {
+}
+
+render::ItemKey ModelImpostorPayload::getKey() const {
+    render::ItemKey::Builder builder;
+    builder.withTypeShape().withTransparent();
+    if (_model && !_model->isVisible()) {
+        builder.withInvisible();
+    }
+    return builder.build();
+}
+
+render::Item::Bound ModelImpostorPayload::getBound() const {
+    if (_model) {
+        return _model->getRenderableMeshBound();
+    }
+    return render::Item::Bound();
+}
+
+render::ShapeKey ModelImpostorPayload::getShapeKey() const {
+    return render::ShapeKey::Builder::ownPipeline();
+}
+
+void ModelImpostorPayload::render(RenderArgs* args) const {
+    if (!_model || !_model->addedToScene() || !_model->isVisible() || !_model->isLoaded()) {
+        return;
+    }
+    auto& impostors = ModelImpostors::instance();
+
+    AABox bound = _model->getRenderableMeshBound();
+    glm::vec3 center = bound.calcCenter();
+    float radius = 0.5f * glm::length(bound.getScale());
+    glm::vec3 eyePos = args->getViewFrustum().getPosition();
+    float distance = std::max(glm::distance(center, eyePos), 0.001f);
+
+    // The quad takes over from the meshes once the model is small enough on screen,
+    // with some hysteresis so the edge of the range does not flicker between the two
+    const float IMPOSTOR_APPARENT_SIZE = 0.01f;
+    const float IMPOSTOR_HYSTERESIS = 1.25f;
+    float apparentSize = radius / distance;
+    if (_model->isRenderingAsImpostor()) {
+        if (apparentSize > IMPOSTOR_APPARENT_SIZE * IMPOSTOR_HYSTERESIS) {
+            _model->exitImpostor();
+            return;
+        }
+    } else if (apparentSize < IMPOSTOR_APPARENT_SIZE) {
+        _model->enterImpostor();
+    }
+    if (!_model->isRenderingAsImpostor()) {
+        return;
+    }
+
+    int slotIndex = _model->getImpostorSlot();
+    const auto& slot = impostors.getSlot(slotIndex);
+
+    // Recapture when the viewpoint walked too far around the model since the snapshot
+    glm::vec3 viewDir = (center - eyePos) / distance;
+    const float RECAPTURE_MAX_COS = 0.98f;
+    if (!slot.rendered || glm::dot(viewDir, slot.capturedViewDir) < RECAPTURE_MAX_COS) {
+        impostors.queueCapture(_model->getThisPointer());
+    }
+    if (!slot.rendered) {
+        return;
+    }
+
+    gpu::Batch& batch = *(args->_batch);
+    Transform transform;
+    transform.setTranslation(slot.center);
+    transform.setRotation(ModelImpostors::evalFacingRotation(viewDir));
+    batch.setModelTransform(transform);
+
+    auto geometryCache = DependencyManager::get<GeometryCache>();
+    if (_quadId == GeometryCache::UNKNOWN_ID) {
+        _quadId = geometryCache->allocateID();
+    }
+    geometryCache->bindSimpleProgram(batch, true, true, true, false, false);
+    batch.setResourceTexture(0, impostors.getAtlasTexture());
+    glm::vec4 texRect = impostors.getSlotTexcoordRect(slotIndex);
+    geometryCache->renderQuad(batch, glm::vec2(-slot.radius), glm::vec2(slot.radius),
+        glm::vec2(texRect.x, texRect.y), glm::vec2(texRect.x + texRect.z, texRect.y + texRect.w),
+        glm::vec4(1.0f), _quadId);
+}
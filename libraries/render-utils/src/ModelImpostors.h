@@ -0,0 +1,107 @@
+//
+//  ModelImpostors.h
+//  libraries/render-utils/src
+//
+//  Created by Sam Gateau on 4/24/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ModelImpostors_h
+#define hifi_ModelImpostors_h
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <gpu/Batch.h>
+#include <gpu/Framebuffer.h>
+
+#include <render/Scene.h>
+#include <render/ShapePipeline.h>
+
+class Model;
+using ModelPointer = std::shared_ptr<Model>;
+using ModelWeakPointer = std::weak_ptr<Model>;
+
+// The shared atlas holding the snapshots of the models far enough away to draw as a
+// single camera facing quad, and the queue of snapshots waiting to be captured.
+// All of this state is only ever touched from the render thread.
+class ModelImpostors {
+public:
+    static ModelImpostors& instance();
+
+    static const int ATLAS_SIZE { 2048 };
+    static const int SLOT_SIZE { 128 };
+
+    class Slot {
+    public:
+        // World space sphere of the model and the view direction it was captured from
+        glm::vec3 center;
+        float radius { 0.0f };
+        glm::vec3 capturedViewDir;
+        bool rendered { false };
+        bool used { false };
+        bool capturePending { false };
+    };
+
+    // Returns the index of a free slot of the atlas, or -1 when they are all taken
+    // and the model keeps drawing its meshes
+    int acquireSlot();
+    void releaseSlot(int slotIndex);
+
+    const Slot& getSlot(int slotIndex) const { return _slots[slotIndex]; }
+    glm::ivec4 getSlotViewport(int slotIndex) const;
+    // Texcoord rect of the slot in the atlas as { offset, scale }
+    glm::vec4 getSlotTexcoordRect(int slotIndex) const;
+
+    void queueCapture(const ModelPointer& model);
+    ModelPointer takeNextCapture();
+    bool hasPendingCaptures() const { return !_captureQueue.empty(); }
+    void finishCapture(int slotIndex, const glm::vec3& center, float radius, const glm::vec3& viewDir);
+
+    const gpu::FramebufferPointer& getAtlasFramebuffer();
+    const gpu::TexturePointer& getAtlasTexture();
+
+    // Orientation turning the XY quad (or the capture camera) toward the given view
+    // direction, with a stable up axis so capture and display agree
+    static glm::quat evalFacingRotation(const glm::vec3& viewDir);
+
+private:
+    void allocateAtlas();
+
+    std::vector<Slot> _slots;
+    std::deque<ModelWeakPointer> _captureQueue;
+
+    gpu::FramebufferPointer _atlasFramebuffer;
+    gpu::TexturePointer _atlasTexture;
+};
+
+// The render item standing in for the meshes of a model when it is far enough away,
+// drawing one camera facing quad sourced from the impostor atlas
+class ModelImpostorPayload {
+public:
+    ModelImpostorPayload(Model* model);
+
+    typedef render::Payload<ModelImpostorPayload> Payload;
+    typedef Payload::DataPointer Pointer;
+
+    render::ItemKey getKey() const;
+    render::Item::Bound getBound() const;
+    render::ShapeKey getShapeKey() const;
+    void render(RenderArgs* args) const;
+
+    Model* _model;
+    mutable int _quadId;
+};
+
+namespace render {
+    template <> const ItemKey payloadGetKey(const ModelImpostorPayload::Pointer& payload);
+    template <> const Item::Bound payloadGetBound(const ModelImpostorPayload::Pointer& payload);
+    template <> const ShapeKey shapeGetShapeKey(const ModelImpostorPayload::Pointer& payload);
+    template <> void payloadRender(const ModelImpostorPayload::Pointer& payload, RenderArgs* args);
+}
+
+#endif // hifi_ModelImpostors_h
@@ -44,9 +44,13 @@
 #include "drawOpaqueStencil_frag.h"
 
 
+#include "Model.h"
+#include "ModelImpostors.h"
+
 using namespace render;
 extern void initOverlay3DPipelines(render::ShapePlumber& plumber);
 extern void initDeferredPipelines(render::ShapePlumber& plumber);
+extern void initForwardPipelines(render::ShapePlumber& plumber);
 
 RenderDeferredTask::RenderDeferredTask(RenderFetchCullSortTask::Output items) {
     // Prepare the ShapePipelines
@@ -73,6 +77,9 @@ RenderDeferredTask::RenderDeferredTask(RenderFetchCullSortTask::Output items) {
 
 
     // GPU jobs: Start preparing the primary, deferred and lighting buffer
+    // Capture the pending impostor snapshots before anything draws to the main buffers
+    addJob<GenerateModelImpostors>("GenerateModelImpostors");
+
     const auto primaryFramebuffer = addJob<PreparePrimaryFramebuffer>("PreparePrimaryBuffer");
 
     const auto opaqueRangeTimer = addJob<BeginGPURangeTimer>("BeginOpaqueRangeTimer", "DrawOpaques");
@@ -511,3 +518,62 @@ void Blit::run(const SceneContextPointer& sceneContext, const RenderContextPoint
         }
     });
 }
+
+GenerateModelImpostors::GenerateModelImpostors() {
+    _shapePlumber = std::make_shared<ShapePlumber>();
+    initForwardPipelines(*_shapePlumber);
+}
+
+void GenerateModelImpostors::run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext) {
+    auto& impostors = ModelImpostors::instance();
+    if (!impostors.hasPendingCaptures()) {
+        return;
+    }
+    RenderArgs* args = renderContext->args;
+
+    gpu::doInBatch(args->_context, [&](gpu::Batch& batch) {
+        args->_batch = &batch;
+        batch.enableStereo(false);
+        batch.setFramebuffer(impostors.getAtlasFramebuffer());
+
+        const int MAX_CAPTURES_PER_FRAME = 2;
+        for (int n = 0; n < MAX_CAPTURES_PER_FRAME; n++) {
+            ModelPointer model = impostors.takeNextCapture();
+            if (!model) {
+                break;
+            }
+            int slotIndex = model->getImpostorSlot();
+            auto viewport = impostors.getSlotViewport(slotIndex);
+            batch.setViewportTransform(viewport);
+            batch.setStateScissorRect(viewport);
+            batch.clearFramebuffer(gpu::Framebuffer::BUFFER_COLOR0 | gpu::Framebuffer::BUFFER_DEPTH,
+                glm::vec4(0.0f), 1.0f, 0, true);
+
+            // Orthographic camera fitting the bounding sphere of the model, looking at it
+            // from the current viewpoint so the quad can face back the same way
+            AABox bound = model->getRenderableMeshBound();
+            glm::vec3 center = bound.calcCenter();
+            float radius = std::max(0.5f * glm::length(bound.getScale()), 0.001f);
+            glm::vec3 viewDir = glm::normalize(center - args->getViewFrustum().getPosition());
+
+            Transform viewTransform;
+            viewTransform.setTranslation(center - viewDir * (2.0f * radius));
+            viewTransform.setRotation(ModelImpostors::evalFacingRotation(viewDir));
+            batch.setProjectionTransform(glm::ortho(-radius, radius, -radius, radius, radius, 3.0f * radius));
+            batch.setViewTransform(viewTransform);
+
+            // Draw the meshes of this model only, with the forward pipelines since the
+            // atlas is a plain lit color target
+            render::ItemBounds itemBounds;
+            for (auto id : model->fetchRenderItemIDs()) {
+                itemBounds.emplace_back(render::ItemBound(id));
+            }
+            model->setCapturingImpostor(true);
+            renderShapes(sceneContext, renderContext, _shapePlumber, itemBounds);
+            model->setCapturingImpostor(false);
+
+            impostors.finishCapture(slotIndex, center, radius, viewDir);
+        }
+    });
+    args->_batch = nullptr;
+}
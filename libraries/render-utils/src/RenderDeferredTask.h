@@ -192,6 +192,20 @@ public:
     void run(const render::SceneContextPointer& sceneContext, const render::RenderContextPointer& renderContext, const gpu::FramebufferPointer& srcFramebuffer);
 };
 
+// Renders the pending snapshots of the models drawing as impostors into the shared
+// atlas, a few per frame (see ModelImpostors)
+class GenerateModelImpostors {
+public:
+    using JobModel = render::Job::Model<GenerateModelImpostors>;
+
+    GenerateModelImpostors();
+
+    void run(const render::SceneContextPointer& sceneContext, const render::RenderContextPointer& renderContext);
+
+protected:
+    render::ShapePlumberPointer _shapePlumber;
+};
+
 class RenderDeferredTask : public render::Task {
 public:
     using JobModel = Model<RenderDeferredTask>;
@@ -47,6 +47,15 @@ void RenderShadowMap::run(const render::SceneContextPointer& sceneContext, const
     const auto& fbo = shadow->framebuffer;
 
     RenderArgs* args = renderContext->args;
+
+    // When neither the scene nor the keylight frustum changed since the last render, the
+    // depth texture already holds the right image; skip the whole pass
+    uint32_t sceneGeneration = sceneContext->_scene->getChangeGeneration();
+    if (_cachedFrameValid && sceneGeneration == _cachedSceneGeneration &&
+            _cachedView == shadow->getView() && _cachedProjection == shadow->getProjection()) {
+        return;
+    }
+
     gpu::doInBatch(args->_context, [&](gpu::Batch& batch) {
         args->_batch = &batch;
 
@@ -88,6 +97,11 @@ void RenderShadowMap::run(const render::SceneContextPointer& sceneContext, const
         args->_pipeline = nullptr;
         args->_batch = nullptr;
     });
+
+    _cachedFrameValid = true;
+    _cachedSceneGeneration = sceneGeneration;
+    _cachedView = shadow->getView();
+    _cachedProjection = shadow->getProjection();
 }
 
 RenderShadowTask::RenderShadowTask(CullFunctor cullFunctor) {
@@ -29,6 +29,13 @@ public:
 
 protected:
     render::ShapePlumberPointer _shapePlumber;
+
+    // What the shadow map currently contains, so a frame where neither the scene nor the
+    // keylight frustum moved can reuse the depth texture instead of re-rendering it
+    bool _cachedFrameValid { false };
+    uint32_t _cachedSceneGeneration { 0 };
+    Transform _cachedView;
+    glm::mat4 _cachedProjection;
 };
 
 class RenderShadowTaskConfig : public render::Task::Config::Persistent {
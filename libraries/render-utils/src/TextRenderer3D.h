@@ -19,9 +19,9 @@
 namespace gpu {
 class Batch;
 }
-class Font;
 
 #include "text/EffectType.h"
+#include "text/Font.h"
 #include "text/FontFamilies.h"
 
 // TextRenderer3D is actually a fairly thin wrapper around a Font class
@@ -53,6 +53,9 @@ private:
     glm::vec4 _color;
 
     std::shared_ptr<Font> _font;
+    // Cached string vertices, owned here because the Font is shared between all the
+    // renderers of the same family
+    Font::DrawInfo _drawInfo;
 };
 
 
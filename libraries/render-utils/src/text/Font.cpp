@@ -260,14 +260,52 @@ void Font::setupGPU() {
     }
 }
 
-void Font::rebuildVertices(float x, float y, const QString& str, const glm::vec2& bounds) {
-    _verticesBuffer = std::make_shared<gpu::Buffer>();
-    _numVertices = 0;
-    _indicesBuffer = std::make_shared<gpu::Buffer>();
-    _numIndices = 0;
+void Font::ensureIndices(unsigned int numQuads) {
+    if (!_indicesBuffer) {
+        _indicesBuffer = std::make_shared<gpu::Buffer>();
+    }
+    // Grow the shared index buffer with the quad pattern up to the requested count
+    while (_numQuadIndices < numQuads) {
+        quint16 verticesOffset = (quint16)(_numQuadIndices * VERTICES_PER_QUAD);
+
+        // Sam's recommended triangle slices
+        // Triangle tri1 = { v0, v1, v3 };
+        // Triangle tri2 = { v1, v2, v3 };
+        // NOTE: Random guy on the internet's recommended triangle slices
+        // Triangle tri1 = { v0, v1, v2 };
+        // Triangle tri2 = { v2, v3, v0 };
+
+        // The problem here being that the 4 vertices are { ll, lr, ul, ur }, a Z pattern
+        // Additionally, you want to ensure that the shared side vertices are used sequentially
+        // to improve cache locality
+        //
+        //  2 -- 3
+        //  |    |
+        //  |    |
+        //  0 -- 1
+        //
+        //  { 0, 1, 2 } -> { 2, 1, 3 }
+        quint16 indices[NUMBER_OF_INDICES_PER_QUAD];
+        indices[0] = verticesOffset + 0;
+        indices[1] = verticesOffset + 1;
+        indices[2] = verticesOffset + 2;
+        indices[3] = verticesOffset + 2;
+        indices[4] = verticesOffset + 1;
+        indices[5] = verticesOffset + 3;
+        _indicesBuffer->append(sizeof(indices), (const gpu::Byte*)indices);
+
+        _numQuadIndices++;
+    }
+}
 
-    _lastStringRendered = str;
-    _lastBounds = bounds;
+void Font::rebuildVertices(DrawInfo& drawInfo, float x, float y, const QString& str, const glm::vec2& bounds) {
+    drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
+    drawInfo.numVertices = 0;
+    drawInfo.numIndices = 0;
+
+    drawInfo.string = str;
+    drawInfo.origin = glm::vec2(x, y);
+    drawInfo.bounds = bounds;
 
     // Top left of text
     glm::vec2 advance = glm::vec2(x, y);
@@ -301,39 +339,11 @@ void Font::rebuildVertices(float x, float y, const QString& str, const glm::vec2
         if (!isNewLine) {
             for (auto c : token) {
                 auto glyph = _glyphs[c];
-                quint16 verticesOffset = _numVertices;
 
                 QuadBuilder qd(glyph, advance - glm::vec2(0.0f, _ascent));
-                _verticesBuffer->append(sizeof(QuadBuilder), (const gpu::Byte*)&qd);
-                _numVertices += 4;
-                
-                // Sam's recommended triangle slices
-                // Triangle tri1 = { v0, v1, v3 };
-                // Triangle tri2 = { v1, v2, v3 };
-                // NOTE: Random guy on the internet's recommended triangle slices
-                // Triangle tri1 = { v0, v1, v2 };
-                // Triangle tri2 = { v2, v3, v0 };
-
-                // The problem here being that the 4 vertices are { ll, lr, ul, ur }, a Z pattern
-                // Additionally, you want to ensure that the shared side vertices are used sequentially
-                // to improve cache locality
-                //
-                //  2 -- 3
-                //  |    |
-                //  |    |
-                //  0 -- 1
-                //
-                //  { 0, 1, 2 } -> { 2, 1, 3 }
-                quint16 indices[NUMBER_OF_INDICES_PER_QUAD];
-                indices[0] = verticesOffset + 0;
-                indices[1] = verticesOffset + 1;
-                indices[2] = verticesOffset + 2;
-                indices[3] = verticesOffset + 2;
-                indices[4] = verticesOffset + 1;
-                indices[5] = verticesOffset + 3;
-                _indicesBuffer->append(sizeof(indices), (const gpu::Byte*)indices);
-                _numIndices += NUMBER_OF_INDICES_PER_QUAD;
-                
+                drawInfo.verticesBuffer->append(sizeof(QuadBuilder), (const gpu::Byte*)&qd);
+                drawInfo.numVertices += VERTICES_PER_QUAD;
+                drawInfo.numIndices += NUMBER_OF_INDICES_PER_QUAD;
 
                 // Advance by glyph size
                 advance.x += glyph.d;
@@ -343,16 +353,18 @@ void Font::rebuildVertices(float x, float y, const QString& str, const glm::vec2
             advance.x += _spaceWidth;
         }
     }
+
+    ensureIndices(drawInfo.numVertices / VERTICES_PER_QUAD);
 }
 
-void Font::drawString(gpu::Batch& batch, float x, float y, const QString& str, const glm::vec4* color,
+void Font::drawString(gpu::Batch& batch, DrawInfo& drawInfo, float x, float y, const QString& str, const glm::vec4* color,
                       EffectType effectType, const glm::vec2& bounds, bool layered) {
     if (str == "") {
         return;
     }
 
-    if (str != _lastStringRendered || bounds != _lastBounds) {
-        rebuildVertices(x, y, str, bounds);
+    if (str != drawInfo.string || bounds != drawInfo.bounds || glm::vec2(x, y) != drawInfo.origin) {
+        rebuildVertices(drawInfo, x, y, str, bounds);
     }
 
     setupGPU();
@@ -360,13 +372,13 @@ void Font::drawString(gpu::Batch& batch, float x, float y, const QString& str, c
     batch.setPipeline(layered ? _layeredPipeline : _pipeline);
     batch.setResourceTexture(_fontLoc, _texture);
     batch._glUniform1i(_outlineLoc, (effectType == OUTLINE_EFFECT));
-    
+
     // need the gamma corrected color here
     glm::vec4 lrgba = ColorUtils::sRGBToLinearVec4(*color);
     batch._glUniform4fv(_colorLoc, 1, (const float*)&lrgba);
 
     batch.setInputFormat(_format);
-    batch.setInputBuffer(0, _verticesBuffer, 0, _format->getChannels().at(0)._stride);
+    batch.setInputBuffer(0, drawInfo.verticesBuffer, 0, _format->getChannels().at(0)._stride);
     batch.setIndexBuffer(gpu::UINT16, _indicesBuffer, 0);
-    batch.drawIndexed(gpu::TRIANGLES, _numIndices, 0);
+    batch.drawIndexed(gpu::TRIANGLES, drawInfo.numIndices, 0);
 }
@@ -26,8 +26,22 @@ public:
     glm::vec2 computeExtent(const QString& str) const;
     float getFontSize() const { return _fontSize; }
 
+    // The vertices of a string are built once and cached by whoever draws it (the Font
+    // itself is shared between all the renderers of the same family), only a change of
+    // the string characteristics triggers a rebuild
+    struct DrawInfo {
+        gpu::BufferPointer verticesBuffer;
+        unsigned int numVertices{ 0 };
+        unsigned int numIndices{ 0 };
+
+        // last string characteristics the vertices were built from
+        QString string;
+        glm::vec2 origin;
+        glm::vec2 bounds;
+    };
+
     // Render string to batch
-    void drawString(gpu::Batch& batch, float x, float y, const QString& str,
+    void drawString(gpu::Batch& batch, DrawInfo& drawInfo, float x, float y, const QString& str,
         const glm::vec4* color, EffectType effectType,
         const glm::vec2& bound, bool layered = false);
 
@@ -40,7 +54,8 @@ private:
     glm::vec2 computeTokenExtent(const QString& str) const;
 
     const Glyph& getGlyph(const QChar& c) const;
-    void rebuildVertices(float x, float y, const QString& str, const glm::vec2& bounds);
+    void rebuildVertices(DrawInfo& drawInfo, float x, float y, const QString& str, const glm::vec2& bounds);
+    void ensureIndices(unsigned int numQuads);
 
     void setupGPU();
 
@@ -66,19 +81,14 @@ private:
     gpu::PipelinePointer _layeredPipeline;
     gpu::TexturePointer _texture;
     gpu::Stream::FormatPointer _format;
-    gpu::BufferPointer _verticesBuffer;
+    // The quad index pattern is the same for every string, so one growing index buffer
+    // is shared by all the strings drawn with this font and stays bound across draws
     gpu::BufferPointer _indicesBuffer;
-    gpu::BufferStreamPointer _stream;
-    unsigned int _numVertices = 0;
-    unsigned int _numIndices = 0;
+    unsigned int _numQuadIndices = 0;
 
     int _fontLoc = -1;
     int _outlineLoc = -1;
     int _colorLoc = -1;
-
-    // last string render characteristics
-    QString _lastStringRendered;
-    glm::vec2 _lastBounds;
 };
 
 #endif
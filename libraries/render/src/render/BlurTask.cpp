@@ -92,11 +92,14 @@ _generateOutputFramebuffer(generateOutputFramebuffer)
 
 }
 
-bool BlurInOutResource::updateResources(const gpu::FramebufferPointer& sourceFramebuffer, Resources& blurringResources) {
+bool BlurInOutResource::updateResources(const gpu::FramebufferPointer& sourceFramebuffer, Resources& blurringResources, int downsampleLevel) {
     if (!sourceFramebuffer) {
         return false;
     }
-    if (_blurredFramebuffer && _blurredFramebuffer->getSize() != sourceFramebuffer->getSize()) {
+    // The blurring targets shrink with the downsample level, the final framebuffer stays at source size
+    uint16 blurWidth = std::max(1, sourceFramebuffer->getWidth() >> downsampleLevel);
+    uint16 blurHeight = std::max(1, sourceFramebuffer->getHeight() >> downsampleLevel);
+    if (_blurredFramebuffer && (_blurredFramebuffer->getWidth() != blurWidth || _blurredFramebuffer->getHeight() != blurHeight)) {
         _blurredFramebuffer.reset();
     }
 
@@ -108,9 +111,27 @@ bool BlurInOutResource::updateResources(const gpu::FramebufferPointer& sourceFra
         //    _blurredFramebuffer->setDepthStencilBuffer(sourceFramebuffer->getDepthStencilBuffer(), sourceFramebuffer->getDepthStencilBufferFormat());
         //}
         auto blurringSampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_LINEAR_MIP_POINT);
-        auto blurringTarget = gpu::TexturePointer(gpu::Texture::create2D(sourceFramebuffer->getRenderBuffer(0)->getTexelFormat(), sourceFramebuffer->getWidth(), sourceFramebuffer->getHeight(), blurringSampler));
+        auto blurringTarget = gpu::TexturePointer(gpu::Texture::create2D(sourceFramebuffer->getRenderBuffer(0)->getTexelFormat(), blurWidth, blurHeight, blurringSampler));
         _blurredFramebuffer->setRenderBuffer(0, blurringTarget);
-    } 
+    }
+
+    if (downsampleLevel > 0) {
+        if (_downsampledFramebuffer && (_downsampledFramebuffer->getWidth() != blurWidth || _downsampledFramebuffer->getHeight() != blurHeight)) {
+            _downsampledFramebuffer.reset();
+        }
+        if (!_downsampledFramebuffer) {
+            _downsampledFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("blurDownsampled"));
+            auto blurringSampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_LINEAR_MIP_POINT);
+            auto downsampledTarget = gpu::TexturePointer(gpu::Texture::create2D(sourceFramebuffer->getRenderBuffer(0)->getTexelFormat(), blurWidth, blurHeight, blurringSampler));
+            _downsampledFramebuffer->setRenderBuffer(0, downsampledTarget);
+        }
+        blurringResources.downsampledFramebuffer = _downsampledFramebuffer;
+        blurringResources.downsampledTexture = _downsampledFramebuffer->getRenderBuffer(0);
+    } else {
+        _downsampledFramebuffer.reset();
+        blurringResources.downsampledFramebuffer.reset();
+        blurringResources.downsampledTexture.reset();
+    }
 
     blurringResources.sourceTexture = sourceFramebuffer->getRenderBuffer(0);
     blurringResources.blurringFramebuffer = _blurredFramebuffer;
@@ -145,6 +166,21 @@ bool BlurInOutResource::updateResources(const gpu::FramebufferPointer& sourceFra
     return true;
 }
 
+// Plain textured blit used to downsample the source before blurring and to upsample
+// the blurred result back, relying on the linear sampler of the blur targets
+static gpu::PipelinePointer makeBlitPipeline() {
+    auto vs = gpu::StandardShaderLib::getDrawViewportQuadTransformTexcoordVS();
+    auto ps = gpu::StandardShaderLib::getDrawTextureOpaquePS();
+    gpu::ShaderPointer program = gpu::Shader::createProgram(vs, ps);
+
+    gpu::Shader::BindingSet slotBindings;
+    slotBindings.insert(gpu::Shader::Binding(std::string("colorMap"), BlurTask_SourceSlot));
+    gpu::Shader::makeProgram(*program, slotBindings);
+
+    gpu::StatePointer state = gpu::StatePointer(new gpu::State());
+    return gpu::Pipeline::create(program, state);
+}
+
 BlurGaussian::BlurGaussian(bool generateOutputFramebuffer) :
     _inOutResources(generateOutputFramebuffer)
 {
@@ -195,8 +231,17 @@ gpu::PipelinePointer BlurGaussian::getBlurHPipeline() {
     return _blurHPipeline;
 }
 
+gpu::PipelinePointer BlurGaussian::getBlitPipeline() {
+    if (!_blitPipeline) {
+        _blitPipeline = makeBlitPipeline();
+    }
+
+    return _blitPipeline;
+}
+
 void BlurGaussian::configure(const Config& config) {
     _parameters->setFilterRadiusScale(config.filterScale);
+    _resolutionLevel = config.resolutionLevel;
 }
 
 
@@ -208,7 +253,7 @@ void BlurGaussian::run(const SceneContextPointer& sceneContext, const RenderCont
 
 
     BlurInOutResource::Resources blurringResources;
-    if (!_inOutResources.updateResources(sourceFramebuffer, blurringResources)) {
+    if (!_inOutResources.updateResources(sourceFramebuffer, blurringResources, _resolutionLevel)) {
         // early exit if no valid blurring resources
         return;
     }
@@ -217,13 +262,68 @@ void BlurGaussian::run(const SceneContextPointer& sceneContext, const RenderCont
     auto blurVPipeline = getBlurVPipeline();
     auto blurHPipeline = getBlurHPipeline();
 
-    _parameters->setWidthHeight(args->_viewport.z, args->_viewport.w, args->_context->isStereo());
+    auto sourceViewport = args->_viewport;
+    auto blurViewport = sourceViewport >> _resolutionLevel;
+
+    _parameters->setWidthHeight(blurViewport.z, blurViewport.w, args->_context->isStereo());
+
+    if (_resolutionLevel > 0) {
+        auto blitPipeline = getBlitPipeline();
+        glm::ivec2 sourceSize(blurringResources.sourceTexture->getDimensions());
+        glm::ivec2 downsampledSize(blurringResources.downsampledTexture->getDimensions());
+        _parameters->setTexcoordTransform(gpu::Framebuffer::evalSubregionTexcoordTransformCoefficients(downsampledSize, blurViewport));
+
+        gpu::doInBatch(args->_context, [=](gpu::Batch& batch) {
+            batch.enableStereo(false);
+            batch.setProjectionTransform(glm::mat4());
+            batch.resetViewTransform();
+
+            // Downsample the source region
+            batch.setViewportTransform(blurViewport);
+            batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(sourceSize, sourceViewport));
+            batch.setFramebuffer(blurringResources.downsampledFramebuffer);
+            batch.setPipeline(blitPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.sourceTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            // Blur it, ping-ponging the two reduced targets
+            batch.setUniformBuffer(BlurTask_ParamsSlot, _parameters->_parametersBuffer);
+
+            batch.setFramebuffer(blurringResources.blurringFramebuffer);
+            batch.clearColorFramebuffer(gpu::Framebuffer::BUFFER_COLOR0, glm::vec4(0.0));
+
+            batch.setPipeline(blurVPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.downsampledTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            batch.setFramebuffer(blurringResources.downsampledFramebuffer);
+            batch.setPipeline(blurHPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.blurringTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            // Upsample the blurred region back to the final framebuffer through the linear sampler
+            batch.setViewportTransform(sourceViewport);
+            batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(downsampledSize, blurViewport));
+            batch.setFramebuffer(blurringResources.finalFramebuffer);
+            if (_inOutResources._generateOutputFramebuffer) {
+                batch.clearColorFramebuffer(gpu::Framebuffer::BUFFER_COLOR0, glm::vec4(0.0));
+            }
+            batch.setPipeline(blitPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.downsampledTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            batch.setResourceTexture(BlurTask_SourceSlot, nullptr);
+            batch.setUniformBuffer(BlurTask_ParamsSlot, nullptr);
+        });
+        return;
+    }
+
     glm::ivec2 textureSize(blurringResources.sourceTexture->getDimensions());
-    _parameters->setTexcoordTransform(gpu::Framebuffer::evalSubregionTexcoordTransformCoefficients(textureSize, args->_viewport));
+    _parameters->setTexcoordTransform(gpu::Framebuffer::evalSubregionTexcoordTransformCoefficients(textureSize, sourceViewport));
 
     gpu::doInBatch(args->_context, [=](gpu::Batch& batch) {
         batch.enableStereo(false);
-        batch.setViewportTransform(args->_viewport);
+        batch.setViewportTransform(sourceViewport);
 
         batch.setUniformBuffer(BlurTask_ParamsSlot, _parameters->_parametersBuffer);
 
@@ -302,9 +402,18 @@ gpu::PipelinePointer BlurGaussianDepthAware::getBlurHPipeline() {
     return _blurHPipeline;
 }
 
+gpu::PipelinePointer BlurGaussianDepthAware::getBlitPipeline() {
+    if (!_blitPipeline) {
+        _blitPipeline = makeBlitPipeline();
+    }
+
+    return _blitPipeline;
+}
+
 void BlurGaussianDepthAware::configure(const Config& config) {
     _parameters->setFilterRadiusScale(config.filterScale);
     _parameters->setDepthThreshold(config.depthThreshold);
+    _resolutionLevel = config.resolutionLevel;
 }
 
 
@@ -318,24 +427,75 @@ void BlurGaussianDepthAware::run(const SceneContextPointer& sceneContext, const
     auto& depthTexture = SourceAndDepth.get1();
 
     BlurInOutResource::Resources blurringResources;
-    if (!_inOutResources.updateResources(sourceFramebuffer, blurringResources)) {
+    if (!_inOutResources.updateResources(sourceFramebuffer, blurringResources, _resolutionLevel)) {
         // early exit if no valid blurring resources
         return;
     }
-    
+
     blurredFramebuffer = blurringResources.finalFramebuffer;
 
     auto blurVPipeline = getBlurVPipeline();
     auto blurHPipeline = getBlurHPipeline();
 
     auto sourceViewport = args->_viewport;
+    auto blurViewport = sourceViewport >> _resolutionLevel;
 
-    _parameters->setWidthHeight(sourceViewport.z, sourceViewport.w, args->_context->isStereo());
-    glm::ivec2 textureSize(blurringResources.sourceTexture->getDimensions());
-    _parameters->setTexcoordTransform(gpu::Framebuffer::evalSubregionTexcoordTransformCoefficients(textureSize, sourceViewport));
+    _parameters->setWidthHeight(blurViewport.z, blurViewport.w, args->_context->isStereo());
     _parameters->setDepthPerspective(args->getViewFrustum().getProjection()[1][1]);
     _parameters->setLinearDepthPosFar(args->getViewFrustum().getFarClip());
 
+    if (_resolutionLevel > 0) {
+        auto blitPipeline = getBlitPipeline();
+        glm::ivec2 sourceSize(blurringResources.sourceTexture->getDimensions());
+        glm::ivec2 downsampledSize(blurringResources.downsampledTexture->getDimensions());
+        _parameters->setTexcoordTransform(gpu::Framebuffer::evalSubregionTexcoordTransformCoefficients(downsampledSize, blurViewport));
+
+        gpu::doInBatch(args->_context, [=](gpu::Batch& batch) {
+            batch.enableStereo(false);
+            batch.setProjectionTransform(glm::mat4());
+            batch.resetViewTransform();
+
+            // Downsample the source region
+            batch.setViewportTransform(blurViewport);
+            batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(sourceSize, sourceViewport));
+            batch.setFramebuffer(blurringResources.downsampledFramebuffer);
+            batch.setPipeline(blitPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.sourceTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            // Blur it, ping-ponging the two reduced targets; the depth map stays at its
+            // own resolution, the shaders fetch it with normalized texcoords
+            batch.setUniformBuffer(BlurTask_ParamsSlot, _parameters->_parametersBuffer);
+            batch.setResourceTexture(BlurTask_DepthSlot, depthTexture);
+
+            batch.setFramebuffer(blurringResources.blurringFramebuffer);
+            batch.setPipeline(blurVPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.downsampledTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            batch.setFramebuffer(blurringResources.downsampledFramebuffer);
+            batch.setPipeline(blurHPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.blurringTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            // Upsample the blurred region back to the final framebuffer through the linear sampler
+            batch.setViewportTransform(sourceViewport);
+            batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(downsampledSize, blurViewport));
+            batch.setFramebuffer(blurringResources.finalFramebuffer);
+            batch.setPipeline(blitPipeline);
+            batch.setResourceTexture(BlurTask_SourceSlot, blurringResources.downsampledTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+            batch.setResourceTexture(BlurTask_SourceSlot, nullptr);
+            batch.setResourceTexture(BlurTask_DepthSlot, nullptr);
+            batch.setUniformBuffer(BlurTask_ParamsSlot, nullptr);
+        });
+        return;
+    }
+
+    glm::ivec2 textureSize(blurringResources.sourceTexture->getDimensions());
+    _parameters->setTexcoordTransform(gpu::Framebuffer::evalSubregionTexcoordTransformCoefficients(textureSize, sourceViewport));
+
     gpu::doInBatch(args->_context, [=](gpu::Batch& batch) {
         batch.enableStereo(false);
         batch.setViewportTransform(sourceViewport);
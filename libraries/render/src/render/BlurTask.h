@@ -66,14 +66,19 @@ public:
 
     struct Resources {
         gpu::TexturePointer sourceTexture;
+        // ping-pong target holding the downsampled source, null when blurring at source resolution
+        gpu::FramebufferPointer downsampledFramebuffer;
+        gpu::TexturePointer downsampledTexture;
         gpu::FramebufferPointer blurringFramebuffer;
         gpu::TexturePointer blurringTexture;
         gpu::FramebufferPointer finalFramebuffer;
     };
 
-    bool updateResources(const gpu::FramebufferPointer& sourceFramebuffer, Resources& resources);
+    // downsampleLevel shrinks the blurring targets to source >> level, the final framebuffer stays at source size
+    bool updateResources(const gpu::FramebufferPointer& sourceFramebuffer, Resources& resources, int downsampleLevel = 0);
 
     gpu::FramebufferPointer _blurredFramebuffer;
+    gpu::FramebufferPointer _downsampledFramebuffer;
 
     // the output framebuffer defined if the job needs to output the result in a new framebuffer and not in place in th einput buffer
     gpu::FramebufferPointer _outputFramebuffer;
@@ -85,11 +90,23 @@ class BlurGaussianConfig : public Job::Config {
     Q_OBJECT
     Q_PROPERTY(bool enabled WRITE setEnabled READ isEnabled NOTIFY dirty) // expose enabled flag
     Q_PROPERTY(float filterScale MEMBER filterScale NOTIFY dirty) // expose enabled flag
+    Q_PROPERTY(int resolutionLevel MEMBER resolutionLevel WRITE setResolutionLevel)
 public:
 
     BlurGaussianConfig() : Job::Config(true) {}
 
     float filterScale{ 0.2f };
+
+    // 0 runs the blur at the source resolution, n at source >> n; the result is
+    // upsampled back through the linear sampler which is hard to tell apart on
+    // the low frequency blur output
+    int resolutionLevel{ 0 };
+
+    const int MAX_RESOLUTION_LEVEL = 2;
+
+public slots:
+    void setResolutionLevel(int level) { resolutionLevel = std::max(0, std::min(level, MAX_RESOLUTION_LEVEL)); emit dirty(); }
+
 signals :
     void dirty();
 
@@ -110,12 +127,15 @@ public:
 protected:
 
     BlurParamsPointer _parameters;
+    int _resolutionLevel{ 0 };
 
     gpu::PipelinePointer _blurVPipeline;
     gpu::PipelinePointer _blurHPipeline;
+    gpu::PipelinePointer _blitPipeline;
 
     gpu::PipelinePointer getBlurVPipeline();
     gpu::PipelinePointer getBlurHPipeline();
+    gpu::PipelinePointer getBlitPipeline();
 
     BlurInOutResource _inOutResources;
 };
@@ -144,16 +164,19 @@ public:
     void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const Inputs& SourceAndDepth, gpu::FramebufferPointer& blurredFramebuffer);
 
     const BlurParamsPointer& getParameters() const { return _parameters; }
- 
+
     gpu::PipelinePointer getBlurVPipeline();
     gpu::PipelinePointer getBlurHPipeline();
+    gpu::PipelinePointer getBlitPipeline();
 
 protected:
     gpu::PipelinePointer _blurVPipeline;
     gpu::PipelinePointer _blurHPipeline;
+    gpu::PipelinePointer _blitPipeline;
 
     BlurInOutResource _inOutResources;
     BlurParamsPointer _parameters;
+    int _resolutionLevel{ 0 };
 };
 
 }
@@ -13,6 +13,9 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <float.h>
+#include <thread>
+#include <vector>
 
 #include <OctreeUtils.h>
 #include <PerfStat.h>
@@ -21,6 +24,127 @@
 
 using namespace render;
 
+namespace {
+
+// Frustum planes repacked so a box can be tested against four planes per SIMD iteration.
+// The box is in view if its farthest vertex along each plane normal is on or in front of
+// that plane; the two unused lanes of the second group are padded with zero planes that
+// always pass.
+class BatchedFrustumTest {
+public:
+    BatchedFrustumTest(const ViewFrustum& frustum) {
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+        const ::Plane* planes = frustum.getPlanes();
+        for (int group = 0; group < 2; ++group) {
+            float nx[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float ny[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float nz[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float d[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            for (int lane = 0; lane < 4; ++lane) {
+                int planeIndex = 4 * group + lane;
+                if (planeIndex < NUM_FRUSTUM_PLANES) {
+                    const glm::vec3& normal = planes[planeIndex].getNormal();
+                    nx[lane] = normal.x;
+                    ny[lane] = normal.y;
+                    nz[lane] = normal.z;
+                    d[lane] = planes[planeIndex].getDCoefficient();
+                }
+            }
+            _normalX[group] = _mm_loadu_ps(nx);
+            _normalY[group] = _mm_loadu_ps(ny);
+            _normalZ[group] = _mm_loadu_ps(nz);
+            _d[group] = _mm_loadu_ps(d);
+            // masks selecting the box max (normal component >= 0) or min per lane
+            __m128 zero = _mm_setzero_ps();
+            _selectMaxX[group] = _mm_cmpge_ps(_normalX[group], zero);
+            _selectMaxY[group] = _mm_cmpge_ps(_normalY[group], zero);
+            _selectMaxZ[group] = _mm_cmpge_ps(_normalZ[group], zero);
+        }
+#else
+        _frustum = &frustum;
+#endif
+    }
+
+    bool boxIntersectsFrustum(const AABox& box) const {
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+        glm::vec3 boxMin = box.getMinimumPoint();
+        glm::vec3 boxMax = box.getMaximumPoint();
+        __m128 minX = _mm_set1_ps(boxMin.x);
+        __m128 minY = _mm_set1_ps(boxMin.y);
+        __m128 minZ = _mm_set1_ps(boxMin.z);
+        __m128 maxX = _mm_set1_ps(boxMax.x);
+        __m128 maxY = _mm_set1_ps(boxMax.y);
+        __m128 maxZ = _mm_set1_ps(boxMax.z);
+        __m128 zero = _mm_setzero_ps();
+        for (int group = 0; group < 2; ++group) {
+            // farthest vertex along each plane normal
+            __m128 px = _mm_or_ps(_mm_and_ps(_selectMaxX[group], maxX), _mm_andnot_ps(_selectMaxX[group], minX));
+            __m128 py = _mm_or_ps(_mm_and_ps(_selectMaxY[group], maxY), _mm_andnot_ps(_selectMaxY[group], minY));
+            __m128 pz = _mm_or_ps(_mm_and_ps(_selectMaxZ[group], maxZ), _mm_andnot_ps(_selectMaxZ[group], minZ));
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_normalX[group], px), _mm_mul_ps(_normalY[group], py)),
+                _mm_add_ps(_mm_mul_ps(_normalZ[group], pz), _d[group]));
+            if (_mm_movemask_ps(_mm_cmplt_ps(distance, zero))) {
+                return false;
+            }
+        }
+        return true;
+#else
+        return _frustum->boxIntersectsFrustum(box);
+#endif
+    }
+
+private:
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    __m128 _normalX[2];
+    __m128 _normalY[2];
+    __m128 _normalZ[2];
+    __m128 _d[2];
+    __m128 _selectMaxX[2];
+    __m128 _selectMaxY[2];
+    __m128 _selectMaxZ[2];
+#else
+    const ViewFrustum* _frustum;
+#endif
+};
+
+// below this count the thread spawn overhead exceeds the win
+const size_t MIN_ITEMS_PER_CULL_THREAD = 4096;
+
+// test a contiguous array of item bounds against the frustum, splitting the array
+// across worker threads when it is large; inViewFlags[i] is non-zero for survivors
+// (null bounds always survive)
+void batchCullBounds(const ViewFrustum& frustum, const ItemBounds& inItems, std::vector<uint8_t>& inViewFlags) {
+    BatchedFrustumTest test(frustum);
+    size_t numItems = inItems.size();
+    inViewFlags.resize(numItems);
+
+    auto cullRange = [&](size_t firstItem, size_t numToCull) {
+        for (size_t i = firstItem; i < firstItem + numToCull; ++i) {
+            inViewFlags[i] = inItems[i].bound.isNull() || test.boxIntersectsFrustum(inItems[i].bound);
+        }
+    };
+
+    size_t numThreads = (size_t)std::thread::hardware_concurrency();
+    if (numItems >= 2 * MIN_ITEMS_PER_CULL_THREAD && numThreads > 1) {
+        size_t numChunks = std::min(numItems / MIN_ITEMS_PER_CULL_THREAD, numThreads);
+        size_t itemsPerChunk = numItems / numChunks;
+        std::vector<std::thread> workers;
+        workers.reserve(numChunks);
+        for (size_t i = 0; i < numChunks; ++i) {
+            size_t firstItem = i * itemsPerChunk;
+            size_t numToCull = (i == numChunks - 1) ? numItems - firstItem : itemsPerChunk;
+            workers.emplace_back(cullRange, firstItem, numToCull);
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    } else {
+        cullRange(0, numItems);
+    }
+}
+
+} // namespace
+
 void render::cullItems(const RenderContextPointer& renderContext, const CullFunctor& cullFunctor, RenderDetails::Item& details,
                        const ItemBounds& inItems, ItemBounds& outItems) {
     assert(renderContext->args);
@@ -31,21 +155,24 @@ void render::cullItems(const RenderContextPointer& renderContext, const CullFunc
 
     details._considered += (int)inItems.size();
 
+    // frustum test the whole batch first, in parallel for large scenes
+    // TODO: some entity types (like lights) might want to be rendered even
+    // when they are outside of the view frustum...
+    std::vector<uint8_t> inViewFlags;
+    {
+        PerformanceTimer perfTimer("boxIntersectsFrustum");
+        batchCullBounds(frustum, inItems, inViewFlags);
+    }
+
     // Culling / LOD
-    for (auto item : inItems) {
+    for (size_t i = 0; i < inItems.size(); ++i) {
+        const auto& item = inItems[i];
         if (item.bound.isNull()) {
             outItems.emplace_back(item); // One more Item to render
             continue;
         }
 
-        // TODO: some entity types (like lights) might want to be rendered even
-        // when they are outside of the view frustum...
-        bool inView;
-        {
-            PerformanceTimer perfTimer("boxIntersectsFrustum");
-            inView = frustum.boxIntersectsFrustum(item.bound);
-        }
-        if (inView) {
+        if (inViewFlags[i]) {
             bool bigEnoughToRender;
             {
                 PerformanceTimer perfTimer("shouldRender");
@@ -73,8 +200,7 @@ void FetchNonspatialItems::run(const SceneContextPointer& sceneContext, const Re
     const auto& items = scene->getNonspatialSet();
     outItems.reserve(items.size());
     for (auto& id : items) {
-        auto& item = scene->getItem(id);
-        outItems.emplace_back(ItemBound(id, item.getBound()));
+        outItems.emplace_back(ItemBound(id, scene->getItemBound(id)));
     }
 }
 
@@ -193,9 +319,8 @@ void CullSpatialSelection::run(const SceneContextPointer& sceneContext, const Re
         {
             PerformanceTimer perfTimer("insideFitItems");
             for (auto id : inSelection.insideItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
+                if (_filter.test(scene->getItemKey(id))) {
+                    ItemBound itemBound(id, scene->getItemBound(id));
                     outItems.emplace_back(itemBound);
                 }
             }
@@ -205,9 +330,8 @@ void CullSpatialSelection::run(const SceneContextPointer& sceneContext, const Re
         {
             PerformanceTimer perfTimer("insideSmallItems");
             for (auto id : inSelection.insideSubcellItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
+                if (_filter.test(scene->getItemKey(id))) {
+                    ItemBound itemBound(id, scene->getItemBound(id));
                     outItems.emplace_back(itemBound);
                 }
             }
@@ -217,9 +341,8 @@ void CullSpatialSelection::run(const SceneContextPointer& sceneContext, const Re
         {
             PerformanceTimer perfTimer("partialFitItems");
             for (auto id : inSelection.partialItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
+                if (_filter.test(scene->getItemKey(id))) {
+                    ItemBound itemBound(id, scene->getItemBound(id));
                     outItems.emplace_back(itemBound);
                 }
             }
@@ -229,9 +352,8 @@ void CullSpatialSelection::run(const SceneContextPointer& sceneContext, const Re
         {
             PerformanceTimer perfTimer("partialSmallItems");
             for (auto id : inSelection.partialSubcellItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
+                if (_filter.test(scene->getItemKey(id))) {
+                    ItemBound itemBound(id, scene->getItemBound(id));
                     outItems.emplace_back(itemBound);
                 }
             }
@@ -243,9 +365,8 @@ void CullSpatialSelection::run(const SceneContextPointer& sceneContext, const Re
         {
             PerformanceTimer perfTimer("insideFitItems");
             for (auto id : inSelection.insideItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
+                if (_filter.test(scene->getItemKey(id))) {
+                    ItemBound itemBound(id, scene->getItemBound(id));
                     outItems.emplace_back(itemBound);
                 }
             }
@@ -255,9 +376,8 @@ void CullSpatialSelection::run(const SceneContextPointer& sceneContext, const Re
         {
             PerformanceTimer perfTimer("insideSmallItems");
             for (auto id : inSelection.insideSubcellItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
+                if (_filter.test(scene->getItemKey(id))) {
+                    ItemBound itemBound(id, scene->getItemBound(id));
                     if (test.solidAngleTest(itemBound.bound)) {
                         outItems.emplace_back(itemBound);
                     }
@@ -265,32 +385,44 @@ void CullSpatialSelection::run(const SceneContextPointer& sceneContext, const Re
             }
         }
 
+        // Partial items need per-item frustum tests: gather the filtered bounds
+        // (fit items first, then subcell items) and cull them as one batch so
+        // large scenes split the plane tests across worker threads.
+        ItemBounds partialBounds;
+        partialBounds.reserve(inSelection.partialItems.size() + inSelection.partialSubcellItems.size());
+
         // partial & fit items: filter & frustum cull
         {
             PerformanceTimer perfTimer("partialFitItems");
             for (auto id : inSelection.partialItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
-                    if (test.frustumTest(itemBound.bound)) {
-                        outItems.emplace_back(itemBound);
-                    }
+                if (_filter.test(scene->getItemKey(id))) {
+                    partialBounds.emplace_back(ItemBound(id, scene->getItemBound(id)));
                 }
             }
         }
+        size_t numPartialFitItems = partialBounds.size();
 
         // partial & subcell items:: filter & frutum cull & solidangle cull
         {
             PerformanceTimer perfTimer("partialSmallItems");
             for (auto id : inSelection.partialSubcellItems) {
-                auto& item = scene->getItem(id);
-                if (_filter.test(item.getKey())) {
-                    ItemBound itemBound(id, item.getBound());
-                    if (test.frustumTest(itemBound.bound)) {
-                        if (test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                        }
-                    }
+                if (_filter.test(scene->getItemKey(id))) {
+                    partialBounds.emplace_back(ItemBound(id, scene->getItemBound(id)));
+                }
+            }
+        }
+
+        {
+            PerformanceTimer perfTimer("partialItemsCull");
+            std::vector<uint8_t> inViewFlags;
+            batchCullBounds(args->getViewFrustum(), partialBounds, inViewFlags);
+            for (size_t i = 0; i < partialBounds.size(); ++i) {
+                if (!inViewFlags[i]) {
+                    details._outOfView++;
+                    continue;
+                }
+                if (i < numPartialFitItems || test.solidAngleTest(partialBounds[i].bound)) {
+                    outItems.emplace_back(partialBounds[i]);
                 }
             }
         }
@@ -321,4 +453,134 @@ void FilterItemLayer::run(const SceneContextPointer& sceneContext, const RenderC
             outItems.emplace_back(itemBound);
         }
     }
+}
+
+// Resolution of the occlusion buffer; coarse on purpose since a texel must be fully
+// covered by a single occluder bound before it can hide anything
+const int OCCLUSION_BUFFER_WIDTH = 64;
+const int OCCLUSION_BUFFER_HEIGHT = 32;
+
+// Only the closest items are rasterized as occluders, beyond that the buffer is mostly
+// converged and the rasterization cost is wasted
+const size_t MAX_OCCLUDER_ITEMS = 256;
+
+void OcclusionBuffer::reset(const ViewFrustum& frustum) {
+    // ViewFrustum::_view is the camera to world transform
+    _worldToClip = frustum.getProjection() * glm::inverse(frustum.getView());
+    _depths.assign(OCCLUSION_BUFFER_WIDTH * OCCLUSION_BUFFER_HEIGHT, FLT_MAX);
+}
+
+bool OcclusionBuffer::projectBound(const AABox& bound, glm::vec2& texelMin, glm::vec2& texelMax, float& nearDepth, float& farDepth) const {
+    glm::vec2 ndcMin(FLT_MAX, FLT_MAX);
+    glm::vec2 ndcMax(-FLT_MAX, -FLT_MAX);
+    nearDepth = FLT_MAX;
+    farDepth = -FLT_MAX;
+    for (int i = BOTTOM_LEFT_NEAR; i <= TOP_LEFT_FAR; i++) {
+        glm::vec4 clipVertex = _worldToClip * glm::vec4(bound.getVertex((BoxVertex)i), 1.0f);
+        if (clipVertex.w <= 0.0f) {
+            // the bound crosses the near clip plane, its footprint cannot be projected
+            return false;
+        }
+        glm::vec2 ndcVertex = glm::vec2(clipVertex) / clipVertex.w;
+        ndcMin = glm::min(ndcMin, ndcVertex);
+        ndcMax = glm::max(ndcMax, ndcVertex);
+        // clip w is the view space distance, used as the depth on both sides of the test
+        nearDepth = std::min(nearDepth, clipVertex.w);
+        farDepth = std::max(farDepth, clipVertex.w);
+    }
+
+    glm::vec2 bufferSize((float)OCCLUSION_BUFFER_WIDTH, (float)OCCLUSION_BUFFER_HEIGHT);
+    texelMin = (ndcMin * 0.5f + 0.5f) * bufferSize;
+    texelMax = (ndcMax * 0.5f + 0.5f) * bufferSize;
+    return true;
+}
+
+void OcclusionBuffer::rasterizeOccluder(const AABox& bound) {
+    glm::vec2 texelMin, texelMax;
+    float nearDepth, farDepth;
+    if (!projectBound(bound, texelMin, texelMax, nearDepth, farDepth)) {
+        return;
+    }
+
+    // only the texels fully covered by the footprint may be written, and the far depth
+    // of the bound is written so whatever tests behind it is truly behind the item
+    int x0 = std::max((int)std::ceil(texelMin.x), 0);
+    int y0 = std::max((int)std::ceil(texelMin.y), 0);
+    int x1 = std::min((int)std::floor(texelMax.x), OCCLUSION_BUFFER_WIDTH) - 1;
+    int y1 = std::min((int)std::floor(texelMax.y), OCCLUSION_BUFFER_HEIGHT) - 1;
+
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            float& depth = _depths[y * OCCLUSION_BUFFER_WIDTH + x];
+            depth = std::min(depth, farDepth);
+        }
+    }
+}
+
+bool OcclusionBuffer::isOccluded(const AABox& bound) const {
+    glm::vec2 texelMin, texelMax;
+    float nearDepth, farDepth;
+    if (!projectBound(bound, texelMin, texelMax, nearDepth, farDepth)) {
+        return false;
+    }
+
+    // every texel the footprint touches must be covered by a closer occluder
+    int x0 = std::max((int)std::floor(texelMin.x), 0);
+    int y0 = std::max((int)std::floor(texelMin.y), 0);
+    int x1 = std::min((int)std::ceil(texelMax.x), OCCLUSION_BUFFER_WIDTH) - 1;
+    int y1 = std::min((int)std::ceil(texelMax.y), OCCLUSION_BUFFER_HEIGHT) - 1;
+    if (x0 > x1 || y0 > y1) {
+        // footprint off the buffer, keep the item
+        return false;
+    }
+
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            if (nearDepth < _depths[y * OCCLUSION_BUFFER_WIDTH + x]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void CullItemsByOcclusion::configure(const Config& config) {
+    _skipCulling = config.skipCulling;
+}
+
+void CullItemsByOcclusion::run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext,
+    const ItemBounds& inItems, ItemBounds& outItems) {
+    assert(renderContext->args);
+    assert(renderContext->args->hasViewFrustum());
+    RenderArgs* args = renderContext->args;
+
+    outItems.clear();
+
+    int numOccluded = 0;
+    if (_skipCulling) {
+        outItems = inItems;
+    } else {
+        PerformanceTimer perfTimer("occlusionCull");
+        outItems.reserve(inItems.size());
+        _buffer.reset(args->getViewFrustum());
+
+        // The input is sorted front to back so each item is only tested against closer
+        // survivors, which grow the buffer as the walk moves away from the eye
+        size_t numOccluders = 0;
+        for (const auto& item : inItems) {
+            if (!item.bound.isNull() && _buffer.isOccluded(item.bound)) {
+                numOccluded++;
+                continue;
+            }
+            outItems.emplace_back(item);
+            if (!item.bound.isNull() && numOccluders < MAX_OCCLUDER_ITEMS) {
+                _buffer.rasterizeOccluder(item.bound);
+                numOccluders++;
+            }
+        }
+    }
+
+    auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
+    config->numItems = (int)outItems.size();
+    config->numOccluded = numOccluded;
 }
\ No newline at end of file
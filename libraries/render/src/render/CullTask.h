@@ -24,6 +24,7 @@ namespace render {
 
     class FetchNonspatialItems {
     public:
+        typedef void is_parallel_safe_tag; // only reads the scene
         using JobModel = Job::ModelO<FetchNonspatialItems, ItemBounds>;
         void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, ItemBounds& outItems);
     };
@@ -54,6 +55,7 @@ namespace render {
         ViewFrustum _frozenFrutstum;
         float _lodAngle;
     public:
+        typedef void is_parallel_safe_tag; // reads the scene and args, frozen frustum state is per instance
         using Config = FetchSpatialTreeConfig;
         using JobModel = Job::ModelO<FetchSpatialTree, ItemSpatialTree::ItemSelection, Config>;
 
@@ -143,6 +145,7 @@ namespace render {
     template <int NUM_FILTERS>
     class MultiFilterItem {
     public:
+        typedef void is_parallel_safe_tag; // only reads the scene and writes its own buckets
         using ItemFilterArray = std::array<ItemFilter, NUM_FILTERS>;
         using ItemBoundsArray = VaryingArray<ItemBounds, NUM_FILTERS>;
         using Config = MultiFilterItemConfig;
@@ -165,8 +168,7 @@ namespace render {
 
             // For each item, filter it into one bucket
             for (auto itemBound : inItems) {
-                auto& item = scene->getItem(itemBound.id);
-                auto itemKey = item.getKey();
+                auto itemKey = scene->getItemKey(itemBound.id);
                 for (size_t i = 0; i < NUM_FILTERS; i++) {
                     if (_filters[i].test(itemKey)) {
                         outItems[i].template edit<ItemBounds>().emplace_back(itemBound);
@@ -178,6 +180,7 @@ namespace render {
 
     class FilterItemLayer {
     public:
+        typedef void is_parallel_safe_tag; // only reads the scene
         using JobModel = Job::ModelIO<FilterItemLayer, ItemBounds, ItemBounds>;
 
         FilterItemLayer() {}
@@ -188,6 +191,60 @@ namespace render {
 
         void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems);
     };
+
+    // Coarse depth buffer rasterized on the CPU from the bounds of the closest items,
+    // a stand-in for GPU occlusion queries which the gpu backend does not expose.
+    // Occluders write their farthest depth over the texels their bound fully covers;
+    // an item is occluded when its nearest depth is behind every texel its bound
+    // touches, so the test is conservative with respect to the buffer resolution.
+    // Only the bounds are available on the CPU though, so a bound much bigger than
+    // the geometry it contains can over-occlude what is behind it.
+    class OcclusionBuffer {
+    public:
+        void reset(const ViewFrustum& frustum);
+        void rasterizeOccluder(const AABox& bound);
+        bool isOccluded(const AABox& bound) const;
+
+    private:
+        // projects the bound in texel space, false if it crosses the near clip plane
+        bool projectBound(const AABox& bound, glm::vec2& texelMin, glm::vec2& texelMax, float& nearDepth, float& farDepth) const;
+
+        glm::mat4 _worldToClip;
+        std::vector<float> _depths;
+    };
+
+    class CullItemsByOcclusionConfig : public Job::Config {
+        Q_OBJECT
+        Q_PROPERTY(int numItems READ getNumItems)
+        Q_PROPERTY(int numOccluded READ getNumOccluded)
+        Q_PROPERTY(bool skipCulling MEMBER skipCulling WRITE setSkipCulling)
+    public:
+        int numItems{ 0 };
+        int numOccluded{ 0 };
+        int getNumItems() { return numItems; }
+        int getNumOccluded() { return numOccluded; }
+
+        bool skipCulling{ false };
+    public slots:
+        void setSkipCulling(bool enabled) { skipCulling = enabled; emit dirty(); }
+    signals:
+        void dirty();
+    };
+
+    // Drops the items hidden behind closer ones; expects its input depth sorted front
+    // to back so each item is only tested against the already rasterized closer items.
+    class CullItemsByOcclusion {
+        bool _skipCulling{ false }; // initialized by Config
+    public:
+        using Config = CullItemsByOcclusionConfig;
+        using JobModel = Job::ModelIO<CullItemsByOcclusion, ItemBounds, ItemBounds, Config>;
+
+        void configure(const Config& config);
+        void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems);
+
+    private:
+        OcclusionBuffer _buffer;
+    };
 }
 
 #endif // hifi_render_CullTask_h;
\ No newline at end of file
@@ -81,6 +81,7 @@ const gpu::PipelinePointer DrawSceneOctree::getDrawLODReticlePipeline() {
 void DrawSceneOctree::configure(const Config& config) {
     _showVisibleCells = config.showVisibleCells;
     _showEmptyCells = config.showEmptyCells;
+    _showLODCells = config.showLODCells;
 }
 
 
@@ -147,6 +148,20 @@ void DrawSceneOctree::run(const SceneContextPointer& sceneContext,
                 }
             }
         }
+
+        if (_showLODCells) {
+            // aggregate representatives of the branches below the lod threshold:
+            // one cell bound stands in for all the items too small to draw individually
+            for (const auto& cellID : inSelection.cellSelection.tinyCells) {
+                auto cell = scene->getSpatialTree().getConcreteCell(cellID);
+                auto cellLoc = cell.getlocation();
+                glm::ivec4 cellLocation(cellLoc.pos.x, cellLoc.pos.y, cellLoc.pos.z, cellLoc.depth);
+
+                batch._glUniform4iv(_drawCellLocationLoc, 1, ((const int*)(&cellLocation)));
+                batch.draw(gpu::LINES, 24, 0);
+            }
+        }
+
         // Draw the LOD Reticle
         {
             float angle = glm::degrees(getAccuracyAngle(args->_sizeScale, args->_boundaryLevelAdjust));
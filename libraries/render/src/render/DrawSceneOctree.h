@@ -22,6 +22,7 @@ namespace render {
         Q_PROPERTY(bool enabled MEMBER enabled NOTIFY dirty())
         Q_PROPERTY(bool showVisibleCells READ getShowVisibleCells WRITE setShowVisibleCells NOTIFY dirty())
         Q_PROPERTY(bool showEmptyCells READ getShowEmptyCells WRITE setShowEmptyCells NOTIFY dirty())
+        Q_PROPERTY(bool showLODCells READ getShowLODCells WRITE setShowLODCells NOTIFY dirty())
         Q_PROPERTY(int numAllocatedCells READ getNumAllocatedCells)
         Q_PROPERTY(int numFreeCells READ getNumFreeCells)
 
@@ -37,13 +38,16 @@ namespace render {
 
         bool showVisibleCells{ true };
         bool showEmptyCells{ false };
+        bool showLODCells{ true };
 
         bool getShowVisibleCells() { return showVisibleCells; }
         bool getShowEmptyCells() { return showEmptyCells; }
+        bool getShowLODCells() { return showLODCells; }
 
     public slots:
         void setShowVisibleCells(bool show) { showVisibleCells = show; emit dirty(); }
         void setShowEmptyCells(bool show) { showEmptyCells = show; emit dirty(); }
+        void setShowLODCells(bool show) { showLODCells = show; emit dirty(); }
 
     signals:
         void dirty();
@@ -63,6 +67,7 @@ namespace render {
 
         bool _showVisibleCells; // initialized by Config
         bool _showEmptyCells; // initialized by Config
+        bool _showLODCells; // initialized by Config
 
     public:
         using Config = DrawSceneOctreeConfig;
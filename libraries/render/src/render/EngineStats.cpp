@@ -47,8 +47,10 @@ void EngineStats::run(const SceneContextPointer& sceneContext, const RenderConte
     config->frameTextureCount = _gpuStats._RSNumTextureBounded;
     config->frameTextureRate = config->frameTextureCount * frequency;
     config->frameTextureMemoryUsage = _gpuStats._RSAmountTextureMemoryBounded;
+    config->frameRedundantTextureCount = _gpuStats._RSNumRedundantTextureBounded;
 
     config->frameSetPipelineCount = _gpuStats._PSNumSetPipelines;
+    config->frameRedundantSetPipelineCount = _gpuStats._PSNumRedundantSetPipelines;
     config->frameSetInputFormatCount = _gpuStats._ISNumFormatChanges;
 
     config->emitDirty();
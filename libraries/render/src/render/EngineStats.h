@@ -46,8 +46,10 @@ namespace render {
         Q_PROPERTY(quint32 frameTextureCount MEMBER frameTextureCount NOTIFY dirty)
         Q_PROPERTY(quint32 frameTextureRate MEMBER frameTextureRate NOTIFY dirty)
         Q_PROPERTY(quint32 frameTextureMemoryUsage MEMBER frameTextureMemoryUsage NOTIFY dirty)
+        Q_PROPERTY(quint32 frameRedundantTextureCount MEMBER frameRedundantTextureCount NOTIFY dirty)
 
         Q_PROPERTY(quint32 frameSetPipelineCount MEMBER frameSetPipelineCount NOTIFY dirty)
+        Q_PROPERTY(quint32 frameRedundantSetPipelineCount MEMBER frameRedundantSetPipelineCount NOTIFY dirty)
         Q_PROPERTY(quint32 frameSetInputFormatCount MEMBER frameSetInputFormatCount NOTIFY dirty)
 
 
@@ -76,8 +78,10 @@ namespace render {
         quint32 frameTextureCount{ 0 };
         quint32 frameTextureRate{ 0 };
         qint64 frameTextureMemoryUsage{ 0 };
+        quint32 frameRedundantTextureCount{ 0 };
 
         quint32 frameSetPipelineCount{ 0 };
+        quint32 frameRedundantSetPipelineCount{ 0 };
 
         quint32 frameSetInputFormatCount{ 0 };
 
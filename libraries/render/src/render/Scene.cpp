@@ -11,6 +11,9 @@
 #include "Scene.h"
 
 #include <numeric>
+
+#include <QtCore/QJsonObject>
+
 #include <gpu/Batch.h>
 #include "Logging.h"
 
@@ -47,6 +50,8 @@ Scene::Scene(glm::vec3 origin, float size) :
     _masterSpatialTree(origin, size)
 {
     _items.push_back(Item()); // add the itemID #0 to nothing
+    _itemKeys.push_back(ItemKey());
+    _itemBounds.push_back(Item::Bound());
 }
 
 Scene::~Scene() {
@@ -76,23 +81,56 @@ void consolidateChangeQueue(PendingChangesQueue& queue, PendingChanges& singleBa
         queue.pop();
     };
 }
- 
+
+// Maximum number of item resets applied per frame.  Bulk domain loads enqueue tens of
+// thousands of resets at once; overflow is deferred to the next frame so the spike
+// amortizes instead of hitching a single frame.
+const size_t MAX_RESET_ITEMS_PER_FRAME = 4096;
+
 void Scene::processPendingChangesQueue() {
     PROFILE_RANGE(render, __FUNCTION__);
+    // Deferred changes from last frame go first so their ordering against this frame's
+    // changes is preserved
     PendingChanges consolidatedPendingChanges;
+    consolidatedPendingChanges.merge(_deferredChanges);
+    _deferredChanges = PendingChanges();
 
     {
         std::unique_lock<std::mutex> lock(_changeQueueMutex);
         consolidateChangeQueue(_changeQueue, consolidatedPendingChanges);
     }
-    
+
+    if (consolidatedPendingChanges._resetItems.size() > MAX_RESET_ITEMS_PER_FRAME) {
+        // Over budget: process the first MAX_RESET_ITEMS_PER_FRAME resets now and push the
+        // rest to next frame.  Updates and removes are deferred wholesale along with them
+        // since they may target items whose reset has not been applied yet.
+        auto& deferred = _deferredChanges;
+        deferred._resetItems.assign(consolidatedPendingChanges._resetItems.begin() + MAX_RESET_ITEMS_PER_FRAME,
+                consolidatedPendingChanges._resetItems.end());
+        deferred._resetPayloads.assign(consolidatedPendingChanges._resetPayloads.begin() + MAX_RESET_ITEMS_PER_FRAME,
+                consolidatedPendingChanges._resetPayloads.end());
+        deferred._removedItems.swap(consolidatedPendingChanges._removedItems);
+        deferred._updatedItems.swap(consolidatedPendingChanges._updatedItems);
+        deferred._updateFunctors.swap(consolidatedPendingChanges._updateFunctors);
+
+        consolidatedPendingChanges._resetItems.resize(MAX_RESET_ITEMS_PER_FRAME);
+        consolidatedPendingChanges._resetPayloads.resize(MAX_RESET_ITEMS_PER_FRAME);
+    }
+
+    if (!consolidatedPendingChanges._resetItems.empty() || !consolidatedPendingChanges._updatedItems.empty() ||
+            !consolidatedPendingChanges._removedItems.empty()) {
+        ++_changeGeneration;
+    }
+
     {
         std::unique_lock<std::mutex> lock(_itemsMutex);
-        // Here we should be able to check the value of last ItemID allocated 
+        // Here we should be able to check the value of last ItemID allocated
         // and allocate new items accordingly
         ItemID maxID = _IDAllocator.load();
         if (maxID > _items.size()) {
             _items.resize(maxID + 100); // allocate the maxId and more
+            _itemKeys.resize(_items.size());
+            _itemBounds.resize(_items.size());
         }
         // Now we know for sure that we have enough items in the array to
         // capture anything coming from the pendingChanges
@@ -135,6 +173,10 @@ void Scene::resetItems(const ItemIDs& ids, Payloads& payloads) {
             _masterNonspatialSet.insert(resetID);
         }
 
+        // Refresh the flat mirrors, the key after resetCell since it adjusts the small flag
+        _itemKeys[resetID] = item.getKey();
+        _itemBounds[resetID] = item.getBound();
+
         // next loop
         resetPayload++;
     }
@@ -156,6 +198,8 @@ void Scene::removeItems(const ItemIDs& ids) {
 
         // Kill it
         item.kill();
+        _itemKeys[removedID] = ItemKey();
+        _itemBounds[removedID] = Item::Bound();
     }
 }
 
@@ -197,8 +241,29 @@ void Scene::updateItems(const ItemIDs& ids, UpdateFunctors& functors) {
             }
         }
 
+        // Refresh the flat mirrors, the key after resetCell since it adjusts the small flag
+        _itemKeys[updateID] = item.getKey();
+        _itemBounds[updateID] = item.getBound();
 
         // next loop
         updateFunctor++;
     }
 }
+
+QJsonArray Scene::dumpItemDescriptions() const {
+    QJsonArray descriptions;
+    for (ItemID id = 1; id < (ItemID)_items.size(); id++) {
+        auto& key = _itemKeys[id];
+        if (key._flags.none()) {
+            continue; // freed slot
+        }
+        auto& bound = _itemBounds[id];
+        QJsonObject description;
+        description["id"] = (int)id;
+        description["key"] = (qint64)key._flags.to_ulong();
+        description["corner"] = QJsonArray { bound.getCorner().x, bound.getCorner().y, bound.getCorner().z };
+        description["dimensions"] = QJsonArray { bound.getDimensions().x, bound.getDimensions().y, bound.getDimensions().z };
+        descriptions.append(description);
+    }
+    return descriptions;
+}
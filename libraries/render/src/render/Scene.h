@@ -12,6 +12,8 @@
 #ifndef hifi_render_Scene_h
 #define hifi_render_Scene_h
 
+#include <QtCore/QJsonArray>
+
 #include "Item.h"
 #include "SpatialTree.h"
 
@@ -72,6 +74,10 @@ public:
     // Process the penging changes equeued
     void processPendingChangesQueue();
 
+    // Monotonic counter bumped every time a batch of changes is actually applied to the
+    // scene; consumers can compare generations to detect that nothing moved between frames
+    uint32_t getChangeGeneration() const { return _changeGeneration.load(); }
+
     // This next call are  NOT threadsafe, you have to call them from the correct thread to avoid any potential issues
 
     // Access a particular item form its ID
@@ -81,23 +87,42 @@ public:
     // Same as getItem, checking if the id is valid
     const Item getItemSafe(const ItemID& id) const { if (isAllocatedID(id)) { return _items[id]; } else { return Item(); } }
 
+    // Flat mirrors of the item keys and bounds, refreshed while transactions are processed,
+    // so the fetch stage can walk them without a virtual call into the payload per item
+    const ItemKey& getItemKey(const ItemID& id) const { return _itemKeys[id]; }
+    const Item::Bound& getItemBound(const ItemID& id) const { return _itemBounds[id]; }
+
     // Access the spatialized items
     const ItemSpatialTree& getSpatialTree() const { return _masterSpatialTree; }
 
     // Access non-spatialized items (overlays, backgrounds)
     const ItemIDSet& getNonspatialSet() const { return _masterNonspatialSet; }
 
+    // Dump a description of every allocated item - key flags and bound - as JSON, for offline
+    // inspection and A/B comparison by the render benchmark tooling. The payloads themselves
+    // are live objects and can't be serialized. Not threadsafe against edits: call it on the
+    // render thread between frames.
+    QJsonArray dumpItemDescriptions() const;
+
 protected:
     // Thread safe elements that can be accessed from anywhere
     std::atomic<unsigned int> _IDAllocator{ 1 }; // first valid itemID will be One
     std::atomic<unsigned int> _numAllocatedItems{ 1 }; // num of allocated items, matching the _items.size()
     std::mutex _changeQueueMutex;
     PendingChangesQueue _changeQueue;
+    std::atomic<uint32_t> _changeGeneration{ 0 };
+
+    // Resets beyond the per-frame budget, carried over to the next frame (only touched
+    // by processPendingChangesQueue, on the render thread)
+    PendingChanges _deferredChanges;
 
     // The actual database
     // database of items is protected for editing by a mutex
     std::mutex _itemsMutex;
     Item::Vector _items;
+    // SoA mirrors of _items, always resized together with it
+    std::vector<ItemKey> _itemKeys;
+    std::vector<Item::Bound> _itemBounds;
     ItemSpatialTree _masterSpatialTree;
     ItemIDSet _masterNonspatialSet;
 
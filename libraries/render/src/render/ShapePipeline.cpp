@@ -44,6 +44,11 @@ void ShapePlumber::addPipelineHelper(const Filter& filter, ShapeKey key, int bit
             qCDebug(renderlogging) << "Key already assigned: " << key;
         }
         _pipelineMap.insert(PipelineMap::value_type(key, pipeline));
+
+        if (_pipelineTable.empty()) {
+            _pipelineTable.resize(1 << ShapeKey::NUM_FLAGS);
+        }
+        _pipelineTable[key._flags.to_ulong()] = pipeline;
     }
 }
 
@@ -94,6 +99,16 @@ void ShapePlumber::addPipeline(const Filter& filter, const gpu::ShaderPointer& p
     addPipelineHelper(filter, key, 0, shapePipeline);
 }
 
+void ShapePlumber::warmPipelines(gpu::Batch& batch) const {
+    std::unordered_set<const ShapePipeline*> warmed;
+    for (const auto& entry : _pipelineMap) {
+        const auto& pipeline = entry.second;
+        if (pipeline && warmed.insert(pipeline.get()).second) {
+            batch.setPipeline(pipeline->pipeline);
+        }
+    }
+}
+
 const ShapePipelinePointer ShapePlumber::pickPipeline(RenderArgs* args, const Key& key) const {
     assert(!_pipelineMap.empty());
     assert(args);
@@ -101,8 +116,19 @@ const ShapePipelinePointer ShapePlumber::pickPipeline(RenderArgs* args, const Ke
 
     PerformanceTimer perfTimer("ShapePlumber::pickPipeline");
 
-    const auto& pipelineIterator = _pipelineMap.find(key);
-    if (pipelineIterator == _pipelineMap.end()) {
+    auto& batch = args->_batch;
+
+    // The shaders were compiled by makeProgram when the pipelines were added; recording
+    // every pipeline into the very first batch syncs the remaining backend objects in
+    // one controlled pass instead of hitching at first draw of each permutation.
+    // (The backend owns the GL context so this cannot move to a worker thread.)
+    if (!_warmedUp) {
+        _warmedUp = true;
+        warmPipelines(*batch);
+    }
+
+    const PipelinePointer& shapePipeline = _pipelineTable[key._flags.to_ulong()];
+    if (!shapePipeline) {
         // The first time we can't find a pipeline, we should log it
         if (_missingKeys.find(key) == _missingKeys.end()) {
             _missingKeys.insert(key);
@@ -111,9 +137,6 @@ const ShapePipelinePointer ShapePlumber::pickPipeline(RenderArgs* args, const Ke
         return PipelinePointer(nullptr);
     }
 
-    PipelinePointer shapePipeline(pipelineIterator->second);
-    auto& batch = args->_batch;
-
     // Setup the one pipeline (to rule them all)
     batch->setPipeline(shapePipeline->pipeline);
 
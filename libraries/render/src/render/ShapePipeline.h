@@ -261,6 +261,9 @@ public:
     using Pipeline = ShapePipeline;
     using PipelinePointer = ShapePipelinePointer;
     using PipelineMap = std::unordered_map<ShapeKey, PipelinePointer, ShapeKey::Hash, ShapeKey::KeyEqual>;
+    // Flat table covering the whole key space, directly indexed by the key bits so the
+    // draw loop resolves a pipeline without a hash probe
+    using PipelineTable = std::vector<PipelinePointer>;
     using Slot = Pipeline::Slot;
     using Locations = Pipeline::Locations;
     using LocationsPointer = Pipeline::LocationsPointer;
@@ -276,9 +279,15 @@ public:
 protected:
     void addPipelineHelper(const Filter& filter, Key key, int bit, const PipelinePointer& pipeline);
     PipelineMap _pipelineMap;
+    PipelineTable _pipelineTable;
 
 private:
+    // Record every registered pipeline into the batch so the backend creates all of its
+    // objects in one pass rather than hitching at first use of each permutation
+    void warmPipelines(gpu::Batch& batch) const;
+
     mutable std::unordered_set<Key, Key::Hash, Key::KeyEqual> _missingKeys;
+    mutable bool _warmedUp{ false };
 };
 
 using ShapePlumberPointer = std::shared_ptr<ShapePlumber>;
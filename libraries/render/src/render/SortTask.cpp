@@ -40,13 +40,44 @@ struct BackToFrontSort {
     }
 };
 
-void render::depthSortItems(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, bool frontToBack, const ItemBounds& inItems, ItemBounds& outItems) {
+static bool sameItemBounds(const ItemBounds& a, const ItemBounds& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].id != b[i].id || !(a[i].bound == b[i].bound)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DepthSortCache::matches(const glm::vec3& eyePosition, const ItemBounds& inItems) const {
+    return _isValid && eyePosition == _eyePosition && sameItemBounds(inItems, _inItems);
+}
+
+void DepthSortCache::store(const glm::vec3& eyePosition, const ItemBounds& inItems, const ItemBounds& outItems) {
+    _eyePosition = eyePosition;
+    _inItems = inItems;
+    _sortedItems = outItems;
+    _isValid = true;
+}
+
+void render::depthSortItems(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, bool frontToBack,
+        const ItemBounds& inItems, ItemBounds& outItems, DepthSortCache* cache) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
     auto& scene = sceneContext->_scene;
     RenderArgs* args = renderContext->args;
 
+    // sort keys only depend on the eye position and the item bounds: when neither has
+    // changed since last frame, last frame's order is still correct
+    glm::vec3 eyePosition = args->getViewFrustum().getPosition();
+    if (cache && cache->matches(eyePosition, inItems)) {
+        outItems = cache->getSortedItems();
+        return;
+    }
 
     // Allocate and simply copy
     outItems.clear();
@@ -78,6 +109,10 @@ void render::depthSortItems(const SceneContextPointer& sceneContext, const Rende
     for (auto& item : itemBoundSorts) {
        outItems.emplace_back(ItemBound(item._id, item._bounds));
     }
+
+    if (cache) {
+        cache->store(eyePosition, inItems, outItems);
+    }
 }
 
 void PipelineSortShapes::run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const ItemBounds& inItems, ShapeBounds& outShapes) {
@@ -111,10 +146,20 @@ void DepthSortShapes::run(const SceneContextPointer& sceneContext, const RenderC
             outItems = outShapes.insert(std::make_pair(pipeline.first, ItemBounds{})).first;
         }
 
-        depthSortItems(sceneContext, renderContext, _frontToBack, inItems, outItems->second);
+        depthSortItems(sceneContext, renderContext, _frontToBack, inItems, outItems->second, &_sortCaches[pipeline.first]);
+    }
+
+    // drop caches for pipelines that are no longer in the input
+    auto cacheItr = _sortCaches.begin();
+    while (cacheItr != _sortCaches.end()) {
+        if (inShapes.find(cacheItr->first) == inShapes.end()) {
+            cacheItr = _sortCaches.erase(cacheItr);
+        } else {
+            ++cacheItr;
+        }
     }
 }
 
 void DepthSortItems::run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems) {
-    depthSortItems(sceneContext, renderContext, _frontToBack, inItems, outItems);
+    depthSortItems(sceneContext, renderContext, _frontToBack, inItems, outItems, &_sortCache);
 }
@@ -15,32 +15,60 @@
 #include "Engine.h"
 
 namespace render {
-    void depthSortItems(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, bool frontToBack, const ItemBounds& inItems, ItemBounds& outItems);
+
+    // Cached result of a depth sort.  The sort keys only depend on the eye position and the
+    // item bounds, so while those are unchanged the previous frame's order is still correct
+    // and the sort can be skipped.
+    class DepthSortCache {
+    public:
+        bool matches(const glm::vec3& eyePosition, const ItemBounds& inItems) const;
+        void store(const glm::vec3& eyePosition, const ItemBounds& inItems, const ItemBounds& outItems);
+
+        const ItemBounds& getSortedItems() const { return _sortedItems; }
+
+    private:
+        glm::vec3 _eyePosition;
+        ItemBounds _inItems;
+        ItemBounds _sortedItems;
+        bool _isValid { false };
+    };
+
+    void depthSortItems(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, bool frontToBack,
+        const ItemBounds& inItems, ItemBounds& outItems, DepthSortCache* cache = nullptr);
 
     class PipelineSortShapes {
     public:
+        typedef void is_parallel_safe_tag; // only reads the scene and writes its own output
         using JobModel = Job::ModelIO<PipelineSortShapes, ItemBounds, ShapeBounds>;
         void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const ItemBounds& inItems, ShapeBounds& outShapes);
     };
 
     class DepthSortShapes {
     public:
+        typedef void is_parallel_safe_tag; // sort caches are per instance
         using JobModel = Job::ModelIO<DepthSortShapes, ShapeBounds, ShapeBounds>;
 
         bool _frontToBack;
         DepthSortShapes(bool frontToBack = true) : _frontToBack(frontToBack) {}
 
         void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const ShapeBounds& inShapes, ShapeBounds& outShapes);
+
+    private:
+        std::unordered_map<ShapeKey, DepthSortCache, ShapeKey::Hash, ShapeKey::KeyEqual> _sortCaches;
     };
 
     class DepthSortItems {
     public:
+        typedef void is_parallel_safe_tag; // sort cache is per instance
         using JobModel = Job::ModelIO<DepthSortItems, ItemBounds, ItemBounds>;
 
         bool _frontToBack;
         DepthSortItems(bool frontToBack = true) : _frontToBack(frontToBack) {}
 
         void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems);
+
+    private:
+        DepthSortCache _sortCache;
     };
 }
 
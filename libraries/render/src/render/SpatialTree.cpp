@@ -522,6 +522,11 @@ int Octree::selectTraverse(Index cellID, CellSelection& selection, const Frustum
             auto cellLocation = cell.getlocation();
             float lod = selector.testSolidAngle(cellLocation.getCenter(), Octree::getCoordSubcellWidth(cellLocation.depth));
             if (lod < 0.0f) {
+                // the branch is too small on screen to draw its items individually:
+                // keep this topmost rejected cell as the aggregate representative
+                if (!cell.isBrickEmpty() || cell.hasChildren()) {
+                    selection.tinyCells.push_back(cellID);
+                }
                 return 0;
                 break;
             }
@@ -550,6 +555,10 @@ int  Octree::selectBranch(Index cellID, CellSelection& selection, const FrustumS
     auto cellLocation = cell.getlocation();
     float lod = selector.testSolidAngle(cellLocation.getCenter(), Octree::getCoordSubcellWidth(cellLocation.depth));
     if (lod < 0.0f) {
+        // see selectTraverse: keep the topmost rejected cell as the aggregate representative
+        if (!cell.isBrickEmpty() || cell.hasChildren()) {
+            selection.tinyCells.push_back(cellID);
+        }
         return 0;
     }
 
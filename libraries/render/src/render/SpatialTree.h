@@ -296,6 +296,10 @@ namespace render {
             Indices partialCells;
             Indices partialBricks;
 
+            // Topmost cells with content whose branch was rejected by the solid angle test:
+            // each one is the aggregate stand-in for everything below the lod threshold in its branch
+            Indices tinyCells;
+
             Indices& cells(bool inside) { return (inside ? insideCells : partialCells); }
             Indices& bricks(bool inside) { return (inside ? insideBricks : partialBricks); }
 
@@ -306,6 +310,7 @@ namespace render {
                 insideBricks.clear();
                 partialCells.clear();
                 partialBricks.clear();
+                tinyCells.clear();
             }
         };
 
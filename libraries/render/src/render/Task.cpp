@@ -9,12 +9,44 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <algorithm>
+#include <thread>
+
 #include <QtCore/QThread>
 
 #include "Task.h"
 
 using namespace render;
 
+void TimingHistory::record(double msTime) {
+    _samples[_head] = msTime;
+    _head = (_head + 1) % LENGTH;
+    if (_count < LENGTH) {
+        _count++;
+    }
+}
+
+double TimingHistory::getPercentile(float fraction) const {
+    if (_count == 0) {
+        return 0.0;
+    }
+    std::array<double, LENGTH> sorted;
+    std::copy(_samples.begin(), _samples.begin() + _count, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + _count);
+    int rank = std::min((int)(fraction * _count), _count - 1);
+    return sorted[rank];
+}
+
+QJsonArray TimingHistory::toJsonArray() const {
+    // oldest sample first
+    QJsonArray samples;
+    int first = (_count < LENGTH) ? 0 : _head;
+    for (int i = 0; i < _count; i++) {
+        samples.append(_samples[(first + i) % LENGTH]);
+    }
+    return samples;
+}
+
 void TaskConfig::refresh() {
     if (QThread::currentThread() != thread()) {
         QMetaObject::invokeMethod(this, "refresh", Qt::BlockingQueuedConnection);
@@ -24,3 +56,79 @@ void TaskConfig::refresh() {
     _task->configure(*this);
 }
 
+// true if the input varying depends on the output varying: either they are the same
+// piece of data or one is reachable among the sub varyings of the other
+static bool varyingDependsOn(const Varying& input, const Varying& output) {
+    if (input.isNull() || output.isNull()) {
+        return false;
+    }
+    if (input.isSameAs(output)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < input.length(); i++) {
+        if (varyingDependsOn(input[i], output)) {
+            return true;
+        }
+    }
+    for (uint8_t i = 0; i < output.length(); i++) {
+        if (varyingDependsOn(input, output[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Task::JobStages Task::evalParallelStages() const {
+    JobStages stages;
+    for (size_t i = 0; i < _jobs.size(); i++) {
+        auto& job = _jobs[i];
+
+        // A job joins the current stage only if it and every job already in the stage
+        // are parallel safe and no varying flows from the stage into the job
+        bool canJoin = !stages.empty() && job.isParallelSafe();
+        if (canJoin) {
+            for (auto stageJobIndex : stages.back()) {
+                if (!_jobs[stageJobIndex].isParallelSafe()
+                        || varyingDependsOn(job.getInput(), _jobs[stageJobIndex].getOutput())) {
+                    canJoin = false;
+                    break;
+                }
+            }
+        }
+
+        if (canJoin) {
+            stages.back().push_back(i);
+        } else {
+            stages.push_back(std::vector<size_t>(1, i));
+        }
+    }
+    return stages;
+}
+
+void Task::run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext) {
+    // Lazily (re)build the stages when the job list changed
+    if (_numJobsInStages != _jobs.size()) {
+        _stages = evalParallelStages();
+        _numJobsInStages = _jobs.size();
+    }
+
+    for (const auto& stage : _stages) {
+        if (stage.size() == 1) {
+            _jobs[stage[0]].run(sceneContext, renderContext);
+        } else {
+            // Each worker gets its own RenderContext since jobs set their config on it
+            std::vector<std::thread> workers;
+            workers.reserve(stage.size());
+            for (auto jobIndex : stage) {
+                auto workerContext = std::make_shared<RenderContext>(*renderContext);
+                workers.emplace_back([this, jobIndex, sceneContext, workerContext] {
+                    _jobs[jobIndex].runOnWorkerThread(sceneContext, workerContext);
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+    }
+}
+
@@ -11,10 +11,13 @@
 
 #ifndef hifi_render_Task_h
 #define hifi_render_Task_h
+#include <array>
 #include <tuple>
+#include <type_traits>
 
 #include <QtCore/qobject.h>
 
+#include <QtCore/qjsonarray.h>
 #include <QtCore/qjsondocument.h>
 #include <QtCore/qjsonobject.h>
 #include <QtCore/qjsonvalue.h>
@@ -49,6 +52,11 @@ public:
     template <class T> const T& get() const { return std::static_pointer_cast<const Model<T>>(_concept)->_data; }
     template <class T> T& edit() { return std::static_pointer_cast<Model<T>>(_concept)->_data; }
 
+    bool isNull() const { return !_concept; }
+
+    // Two Varyings are the same piece of data if they share the same concept:
+    // this is the identity tying a job's input to the producing job's output
+    bool isSameAs(const Varying& other) const { return _concept && (_concept == other._concept); }
 
     // access potential sub varyings contained in this one.
     Varying operator[] (uint8_t index) const { return (*_concept)[index]; }
@@ -65,6 +73,18 @@ protected:
         virtual Varying operator[] (uint8_t index) const = 0;
         virtual uint8_t length() const = 0;
     };
+
+    // Expose the sub varyings of proxy data types (the VaryingSets, which define
+    // is_proxy_tag); any other data type has none
+    template <class T, class V = void> struct Proxy {
+        static Varying element(const T& data, uint8_t index) { return Varying(); }
+        static uint8_t length(const T& data) { return 0; }
+    };
+    template <class T> struct Proxy<T, typename T::is_proxy_tag> {
+        static Varying element(const T& data, uint8_t index) { return data[index]; }
+        static uint8_t length(const T& data) { return data.length(); }
+    };
+
     template <class T> class Model : public Concept {
     public:
         using Data = T;
@@ -73,10 +93,9 @@ protected:
         virtual ~Model() = default;
 
         virtual Varying operator[] (uint8_t index) const override {
-            Varying var;
-            return var;
+            return Proxy<Data>::element(_data, index);
         }
-        virtual uint8_t length() const override { return 0; }
+        virtual uint8_t length() const override { return Proxy<Data>::length(_data); }
 
         Data _data;
     };
@@ -118,6 +137,7 @@ template <class T0, class T1, class T2>
 class VaryingSet3 : public std::tuple<Varying, Varying,Varying>{
 public:
     using Parent = std::tuple<Varying, Varying, Varying>;
+    typedef void is_proxy_tag;
 
     VaryingSet3() : Parent(Varying(T0()), Varying(T1()), Varying(T2())) {}
     VaryingSet3(const VaryingSet3& src) : Parent(std::get<0>(src), std::get<1>(src), std::get<2>(src)) {}
@@ -150,6 +170,7 @@ template <class T0, class T1, class T2, class T3>
 class VaryingSet4 : public std::tuple<Varying, Varying, Varying, Varying>{
 public:
     using Parent = std::tuple<Varying, Varying, Varying, Varying>;
+    typedef void is_proxy_tag;
 
     VaryingSet4() : Parent(Varying(T0()), Varying(T1()), Varying(T2()), Varying(T3())) {}
     VaryingSet4(const VaryingSet4& src) : Parent(std::get<0>(src), std::get<1>(src), std::get<2>(src), std::get<3>(src)) {}
@@ -188,6 +209,7 @@ template <class T0, class T1, class T2, class T3, class T4>
 class VaryingSet5 : public std::tuple<Varying, Varying, Varying, Varying, Varying>{
 public:
     using Parent = std::tuple<Varying, Varying, Varying, Varying, Varying>;
+    typedef void is_proxy_tag;
 
     VaryingSet5() : Parent(Varying(T0()), Varying(T1()), Varying(T2()), Varying(T3()), Varying(T4())) {}
     VaryingSet5(const VaryingSet5& src) : Parent(std::get<0>(src), std::get<1>(src), std::get<2>(src), std::get<3>(src), std::get<4>(src)) {}
@@ -230,6 +252,7 @@ template <class T0, class T1, class T2, class T3, class T4, class T5>
 class VaryingSet6 : public std::tuple<Varying, Varying, Varying, Varying, Varying, Varying>{
 public:
     using Parent = std::tuple<Varying, Varying, Varying, Varying, Varying, Varying>;
+    typedef void is_proxy_tag;
 
     VaryingSet6() : Parent(Varying(T0()), Varying(T1()), Varying(T2()), Varying(T3()), Varying(T4()), Varying(T5())) {}
     VaryingSet6(const VaryingSet6& src) : Parent(std::get<0>(src), std::get<1>(src), std::get<2>(src), std::get<3>(src), std::get<4>(src), std::get<5>(src)) {}
@@ -253,6 +276,23 @@ public:
     const T5& get5() const { return std::get<5>((*this)).template get<T5>(); }
     T5& edit5() { return std::get<5>((*this)).template edit<T5>(); }
 
+    virtual Varying operator[] (uint8_t index) const {
+        if (index == 5) {
+            return std::get<5>((*this));
+        } else if (index == 4) {
+            return std::get<4>((*this));
+        } else if (index == 3) {
+            return std::get<3>((*this));
+        } else if (index == 2) {
+            return std::get<2>((*this));
+        } else if (index == 1) {
+            return std::get<1>((*this));
+        } else {
+            return std::get<0>((*this));
+        }
+    }
+    virtual uint8_t length() const { return 6; }
+
     Varying hasVarying() const { return Varying((*this)); }
 };
 
@@ -260,7 +300,8 @@ template <class T0, class T1, class T2, class T3, class T4, class T5, class T6>
 class VaryingSet7 : public std::tuple<Varying, Varying, Varying, Varying, Varying, Varying, Varying>{
 public:
     using Parent = std::tuple<Varying, Varying, Varying, Varying, Varying, Varying, Varying>;
-    
+    typedef void is_proxy_tag;
+
     VaryingSet7() : Parent(Varying(T0()), Varying(T1()), Varying(T2()), Varying(T3()), Varying(T4()), Varying(T5()), Varying(T6())) {}
     VaryingSet7(const VaryingSet7& src) : Parent(std::get<0>(src), std::get<1>(src), std::get<2>(src), std::get<3>(src), std::get<4>(src), std::get<5>(src), std::get<6>(src)) {}
     VaryingSet7(const Varying& first, const Varying& second, const Varying& third, const Varying& fourth, const Varying& fifth, const Varying& sixth, const Varying& seventh) : Parent(first, second, third, fourth, fifth, sixth, seventh) {}
@@ -285,7 +326,26 @@ public:
     
     const T6& get6() const { return std::get<6>((*this)).template get<T6>(); }
     T6& edit6() { return std::get<6>((*this)).template edit<T6>(); }
-    
+
+    virtual Varying operator[] (uint8_t index) const {
+        if (index == 6) {
+            return std::get<6>((*this));
+        } else if (index == 5) {
+            return std::get<5>((*this));
+        } else if (index == 4) {
+            return std::get<4>((*this));
+        } else if (index == 3) {
+            return std::get<3>((*this));
+        } else if (index == 2) {
+            return std::get<2>((*this));
+        } else if (index == 1) {
+            return std::get<1>((*this));
+        } else {
+            return std::get<0>((*this));
+        }
+    }
+    virtual uint8_t length() const { return 7; }
+
     Varying hasVarying() const { return Varying((*this)); }
 };
 
@@ -293,11 +353,18 @@ public:
 template < class T, int NUM >
 class VaryingArray : public std::array<Varying, NUM> {
 public:
+    using Parent = std::array<Varying, NUM>;
+    typedef void is_proxy_tag;
+
     VaryingArray() {
         for (size_t i = 0; i < NUM; i++) {
             (*this)[i] = Varying(T());
         }
     }
+
+    Varying& operator[] (uint8_t index) { return Parent::operator[](index); }
+    Varying operator[] (uint8_t index) const { return Parent::operator[](index); }
+    uint8_t length() const { return NUM; }
 };
 
 class Job;
@@ -367,13 +434,32 @@ protected:
     Setting::Handle<QString> _preset;
 };
 
+// Ring buffered history of a per-frame timing sample, long enough for dashboards
+// scraping the config JSON from live clients to derive stable percentiles
+class TimingHistory {
+public:
+    static const int LENGTH = 100;
+
+    void record(double msTime);
+    // fraction in [0, 1], e.g. 0.95 for the p95 of the recorded samples
+    double getPercentile(float fraction) const;
+    QJsonArray toJsonArray() const;
+
+private:
+    std::array<double, LENGTH> _samples;
+    int _count{ 0 };
+    int _head{ 0 };
+};
+
 // A default Config is always on; to create an enableable Config, use the ctor JobConfig(bool enabled)
 class JobConfig : public QObject {
     Q_OBJECT
     Q_PROPERTY(double cpuRunTime READ getCPURunTime NOTIFY newStats()) //ms
+    Q_PROPERTY(double cpuRunTimeP95 READ getCPURunTimeP95) //ms, over the last TimingHistory::LENGTH frames
     Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled)
 
     double _msCPURunTime{ 0.0 };
+    TimingHistory _cpuRunTimeHistory;
 public:
     using Persistent = PersistentConfig<JobConfig>;
 
@@ -401,8 +487,10 @@ public:
 
     // Running Time measurement
     // The new stats signal is emitted once per run time of a job when stats  (cpu runtime) are updated
-    void setCPURunTime(double mstime) { _msCPURunTime = mstime; emit newStats(); }
+    void setCPURunTime(double mstime) { _msCPURunTime = mstime; _cpuRunTimeHistory.record(mstime); emit newStats(); }
     double getCPURunTime() const { return _msCPURunTime; }
+    double getCPURunTimeP95() const { return _cpuRunTimeHistory.getPercentile(0.95f); }
+    Q_INVOKABLE QString getCPURunTimeHistory() const { return QJsonDocument(_cpuRunTimeHistory.toJsonArray()).toJson(QJsonDocument::Compact); }
 
 public slots:
     void load(const QJsonObject& val) { qObjectFromJsonValue(val, *this); emit loaded(); }
@@ -436,6 +524,13 @@ private:
     Task* _task;
 };
 
+// A job data type may declare "typedef void is_parallel_safe_tag;" to state that its run
+// method only reads the scene and the contexts: such jobs are allowed to run concurrently
+// with each other when the varyings show no dependency between them (see Task::run).
+// Any job recording gpu work or touching shared mutable state must NOT declare the tag.
+template <class T, class V = void> struct JobParallelSafety : std::false_type {};
+template <class T> struct JobParallelSafety<T, typename T::is_parallel_safe_tag> : std::true_type {};
+
 template <class T, class C> void jobConfigure(T& data, const C& configuration) {
     data.configure(configuration);
 }
@@ -461,10 +556,12 @@ template <class T, class I, class O> void jobRun(T& data, const SceneContextPoin
 class GPUJobConfig : public JobConfig {
     Q_OBJECT
     Q_PROPERTY(double gpuRunTime READ getGPURunTime)
+    Q_PROPERTY(double gpuRunTimeP95 READ getGPURunTimeP95) //ms, over the last TimingHistory::LENGTH frames
     Q_PROPERTY(double batchRunTime READ getBatchRunTime)
 
     double _msGPURunTime { 0.0 };
     double _msBatchRunTime { 0.0 };
+    TimingHistory _gpuRunTimeHistory;
 public:
     using Persistent = PersistentConfig<GPUJobConfig>;
 
@@ -472,18 +569,22 @@ public:
     GPUJobConfig(bool enabled) : JobConfig(enabled) {}
 
     // Running Time measurement on GPU and for Batch execution
-    void setGPUBatchRunTime(double msGpuTime, double msBatchTime) { _msGPURunTime = msGpuTime; _msBatchRunTime = msBatchTime; }
+    void setGPUBatchRunTime(double msGpuTime, double msBatchTime) { _msGPURunTime = msGpuTime; _msBatchRunTime = msBatchTime; _gpuRunTimeHistory.record(msGpuTime); }
     double getGPURunTime() const { return _msGPURunTime; }
+    double getGPURunTimeP95() const { return _gpuRunTimeHistory.getPercentile(0.95f); }
+    Q_INVOKABLE QString getGPURunTimeHistory() const { return QJsonDocument(_gpuRunTimeHistory.toJsonArray()).toJson(QJsonDocument::Compact); }
     double getBatchRunTime() const { return _msBatchRunTime; }
 };
 
 class GPUTaskConfig : public TaskConfig {
     Q_OBJECT
     Q_PROPERTY(double gpuRunTime READ getGPURunTime)
+    Q_PROPERTY(double gpuRunTimeP95 READ getGPURunTimeP95) //ms, over the last TimingHistory::LENGTH frames
     Q_PROPERTY(double batchRunTime READ getBatchRunTime)
 
     double _msGPURunTime { 0.0 };
     double _msBatchRunTime { 0.0 };
+    TimingHistory _gpuRunTimeHistory;
 public:
 
     using Persistent = PersistentConfig<GPUTaskConfig>;
@@ -493,8 +594,10 @@ public:
     GPUTaskConfig(bool enabled) : TaskConfig(enabled) {}
 
     // Running Time measurement on GPU and for Batch execution
-    void setGPUBatchRunTime(double msGpuTime, double msBatchTime) { _msGPURunTime = msGpuTime; _msBatchRunTime = msBatchTime; }
+    void setGPUBatchRunTime(double msGpuTime, double msBatchTime) { _msGPURunTime = msGpuTime; _msBatchRunTime = msBatchTime; _gpuRunTimeHistory.record(msGpuTime); }
     double getGPURunTime() const { return _msGPURunTime; }
+    double getGPURunTimeP95() const { return _gpuRunTimeHistory.getPercentile(0.95f); }
+    Q_INVOKABLE QString getGPURunTimeHistory() const { return QJsonDocument(_gpuRunTimeHistory.toJsonArray()).toJson(QJsonDocument::Compact); }
     double getBatchRunTime() const { return _msBatchRunTime; }
 };
 
@@ -513,6 +616,9 @@ public:
         virtual const Varying getInput() const { return Varying(); }
         virtual const Varying getOutput() const { return Varying(); }
 
+        // true when the data type declared is_parallel_safe_tag
+        virtual bool isParallelSafe() const { return false; }
+
         virtual QConfigPointer& getConfiguration() { return _config; }
         virtual void applyConfiguration() = 0;
 
@@ -540,6 +646,8 @@ public:
         const Varying getInput() const override { return _input; }
         const Varying getOutput() const override { return _output; }
 
+        bool isParallelSafe() const override { return JobParallelSafety<Data>::value; }
+
         template <class... A>
         Model(const Varying& input, A&&... args) :
             Concept(std::make_shared<C>()), _data(Data(std::forward<A>(args)...)), _input(input), _output(Output()) {
@@ -575,6 +683,8 @@ public:
         return concept->_data;
     }
 
+    bool isParallelSafe() const { return _concept->isParallelSafe(); }
+
     void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext) {
         PerformanceTimer perfTimer(_name.c_str());
         PROFILE_RANGE(render, _name.c_str());
@@ -585,6 +695,16 @@ public:
         _concept->setCPURunTime((double)(usecTimestampNow() - start) / 1000.0);
     }
 
+    // Same as run but without PerformanceTimer/PROFILE_RANGE, which are not thread safe;
+    // used by Task::run for the jobs it sends to worker threads
+    void runOnWorkerThread(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext) {
+        auto start = usecTimestampNow();
+
+        _concept->run(sceneContext, renderContext);
+
+        _concept->setCPURunTime((double)(usecTimestampNow() - start) / 1000.0);
+    }
+
     protected:
     ConceptPointer _concept;
     std::string _name = "";
@@ -623,9 +743,7 @@ public:
         void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext) override {
             auto config = std::static_pointer_cast<Config>(_config);
             if (config->alwaysEnabled || config->enabled) {
-                for (auto job : _data._jobs) {
-                    job.run(sceneContext, renderContext);
-                }
+                _data.run(sceneContext, renderContext);
             }
         }
     };
@@ -692,18 +810,24 @@ public:
         }
     }
 
-    void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext) {
-        for (auto job : _jobs) {
-            job.run(sceneContext, renderContext);
-        }
-    }
+    // Run the jobs in order, executing consecutive parallel-safe independent jobs
+    // concurrently on worker threads (see evalParallelStages)
+    void run(const SceneContextPointer& sceneContext, const RenderContextPointer& renderContext);
 
 protected:
     template <class T, class C> friend class Model;
 
+    // A stage is a group of consecutive jobs that can run concurrently: only
+    // parallel-safe jobs with no varying flowing between them share a stage
+    using JobStages = std::vector<std::vector<size_t>>;
+    JobStages evalParallelStages() const;
+
     QConfigPointer _config;
     Jobs _jobs;
     Varying _output;
+
+    JobStages _stages;
+    size_t _numJobsInStages { 0 };
 };
 
 }
@@ -52,6 +52,8 @@ ScriptAudioInjector* AudioScriptingInterface::playSound(SharedSoundPointer sound
         if (!injector) {
             return NULL;
         }
+        // the samples may be a view over the sound's mapping - hold the sound
+        injector->setSound(sound);
         return new ScriptAudioInjector(injector);
 
     } else {
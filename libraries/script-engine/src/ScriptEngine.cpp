@@ -9,7 +9,9 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
 #include <thread>
 
 #include <QtCore/QCoreApplication>
@@ -38,6 +40,7 @@
 #include <EntityScriptingInterface.h>
 #include <MessagesClient.h>
 #include <NetworkAccessManager.h>
+#include <NumericalConstants.h>
 #include <PathUtils.h>
 #include <ResourceScriptingInterface.h>
 #include <NodeList.h>
@@ -307,6 +310,10 @@ void ScriptEngine::runDebuggable() {
         }
         _lastUpdate = now;
 
+        // the debug path has no measured idle slice, so collect right after the update
+        // tick with an unconstrained budget - pauses matter less under the debugger
+        maybeCollectGarbage(std::numeric_limits<quint64>::max());
+
         // only clear exceptions if we are not in the middle of evaluating
         if (!isEvaluating() && hasUncaughtException()) {
             qCWarning(scriptengine) << __FUNCTION__ << "---------- UNCAUGHT EXCEPTION --------";
@@ -559,6 +566,9 @@ void ScriptEngine::init() {
     qScriptRegisterMetaType(this, AvatarEntityMapToScriptValue, AvatarEntityMapFromScriptValue);
     qScriptRegisterSequenceMetaType<QVector<QUuid>>(this);
     qScriptRegisterSequenceMetaType<QVector<EntityItemID>>(this);
+    qScriptRegisterSequenceMetaType<QVector<EntityItemProperties>>(this);
+    qScriptRegisterSequenceMetaType<QVector<PickRay>>(this);
+    qScriptRegisterSequenceMetaType<QVector<RayToEntityIntersectionResult>>(this);
 
     qScriptRegisterSequenceMetaType<QVector<glm::vec2> >(this);
     qScriptRegisterSequenceMetaType<QVector<glm::quat> >(this);
@@ -983,6 +993,10 @@ void ScriptEngine::run() {
                 break;
             }
 
+            // spend part of the remaining idle slice on garbage collection, if one is due
+            auto remainingIdle = std::chrono::duration_cast<std::chrono::microseconds>(sleepUntil - clock::now());
+            maybeCollectGarbage((quint64)remainingIdle.count());
+
             // We only want to sleep a small amount so that any pending events (like timers or invokeMethod events)
             // will be able to process quickly.
             static const int SMALL_SLEEP_AMOUNT = 100;
@@ -1090,7 +1104,7 @@ void ScriptEngine::run() {
 // NOTE: This is private because it must be called on the same thread that created the timers, which is why
 // we want to only call it in our own run "shutdown" processing.
 void ScriptEngine::stopAllTimers() {
-    QMutableHashIterator<QTimer*, CallbackData> i(_timerFunctionMap);
+    QMutableHashIterator<QTimer*, TimerData> i(_timerFunctionMap);
     int j {0};
     while (i.hasNext()) {
         i.next();
@@ -1103,10 +1117,10 @@ void ScriptEngine::stopAllTimers() {
 void ScriptEngine::stopAllTimersForEntityScript(const EntityItemID& entityID) {
      // We could maintain a separate map of entityID => QTimer, but someone will have to prove to me that it's worth the complexity. -HRS
     QVector<QTimer*> toDelete;
-    QMutableHashIterator<QTimer*, CallbackData> i(_timerFunctionMap);
+    QMutableHashIterator<QTimer*, TimerData> i(_timerFunctionMap);
     while (i.hasNext()) {
         i.next();
-        if (i.value().definingEntityIdentifier != entityID) {
+        if (i.value().callback.definingEntityIdentifier != entityID) {
             continue;
         }
         QTimer* timer = i.key();
@@ -1162,62 +1176,200 @@ void ScriptEngine::callAnimationStateHandler(QScriptValue callback, AnimVariantM
 void ScriptEngine::updateMemoryCost(const qint64& deltaSize) {
     if (deltaSize > 0) {
         reportAdditionalMemoryCost(deltaSize);
+        _externalMemoryCost += deltaSize;
+        _externalMemoryCostTotal += deltaSize;
     }
 }
 
-void ScriptEngine::timerFired() {
+// a collection is due this often even if no external memory has been reported, to keep
+// object-only garbage (closures, temporaries) from piling up into an expensive collection
+static const quint64 GC_INTERVAL_USECS = USECS_PER_SECOND;
+
+// ... or sooner, once this much external memory has been reported since the last collection
+static const qint64 GC_EXTERNAL_MEMORY_TRIGGER_BYTES = 16 * 1024 * 1024;
+
+// never attempt a collection in an idle slice shorter than this, even if the last
+// collection was faster - durations jitter, and overrunning the slice delays the frame
+static const quint64 GC_MINIMUM_BUDGET_USECS = 2 * USECS_PER_MSEC;
+
+void ScriptEngine::maybeCollectGarbage(quint64 idleBudgetUsecs) {
+    // QtScript has no incremental collector, so the next best thing is making full
+    // collections cheap and predictable: run them frequently, from the idle slice between
+    // frames, while there's little garbage to trace. Because this is the only place the
+    // engine triggers a collection, GC never lands inside an update or a batched timer
+    // callback run.
+    quint64 now = usecTimestampNow();
+    if (_gcEpochTime == 0) {
+        _gcEpochTime = now;
+        _lastGCTime = now;
+        return;
+    }
+
+    bool due = (now - _lastGCTime > GC_INTERVAL_USECS) || (_externalMemoryCost > GC_EXTERNAL_MEMORY_TRIGGER_BYTES);
+    if (!due) {
+        return;
+    }
+
+    // expect this collection to cost about what the last one did; if the idle slice
+    // can't cover that, wait for a longer one rather than eating into the next frame
+    quint64 expectedUsecs = std::max(_lastGCDurationUsecs, GC_MINIMUM_BUDGET_USECS);
+    if (idleBudgetUsecs < expectedUsecs) {
+        _gcDeferredCount++;
+        return;
+    }
+
+    {
+        PROFILE_RANGE(script, "collectGarbage");
+        collectGarbage();
+    }
+
+    quint64 after = usecTimestampNow();
+    _lastGCDurationUsecs = after - now;
+    _gcTotalUsecs += _lastGCDurationUsecs;
+    _gcMaxUsecs = std::max(_gcMaxUsecs, _lastGCDurationUsecs);
+    _gcCount++;
+    _lastGCTime = after;
+    _externalMemoryCost = 0;
+}
+
+QVariantMap ScriptEngine::getMemoryStats() const {
+    QVariantMap stats;
+    stats["gcCount"] = (qulonglong)_gcCount;
+    stats["gcTotalUsecs"] = (qulonglong)_gcTotalUsecs;
+    stats["gcMaxUsecs"] = (qulonglong)_gcMaxUsecs;
+    stats["gcLastUsecs"] = (qulonglong)_lastGCDurationUsecs;
+    stats["gcDeferredCount"] = (qulonglong)_gcDeferredCount;
+    stats["externalMemoryPending"] = (qlonglong)_externalMemoryCost;
+    stats["externalMemoryTotal"] = (qlonglong)_externalMemoryCostTotal;
+    double seconds = _gcEpochTime > 0 ? (double)(usecTimestampNow() - _gcEpochTime) / (double)USECS_PER_SECOND : 0.0;
+    stats["externalMemoryRate"] = seconds > 0.0 ? (double)_externalMemoryCostTotal / seconds : 0.0;
+    return stats;
+}
+
+// callbacks due within this window of a wake all run in that wake, instead of waking
+// the thread again microseconds later for the next one.
+static const quint64 TIMER_COALESCE_WINDOW_USECS = 2 * USECS_PER_MSEC;
+
+void ScriptEngine::timerWheelFired() {
     {
         auto engine = DependencyManager::get<ScriptEngines>();
         if (!engine || engine->isStopped()) {
-            scriptWarningMessage("Script.timerFired() while shutting down is ignored... parent script:" + getFilename());
+            scriptWarningMessage("Script.timerWheelFired() while shutting down is ignored... parent script:" + getFilename());
             return; // bail early
         }
     }
 
-    QTimer* callingTimer = reinterpret_cast<QTimer*>(sender());
-    CallbackData timerData = _timerFunctionMap.value(callingTimer);
+    quint64 now = usecTimestampNow();
+    _timerWakeCount++;
 
-    if (!callingTimer->isActive()) {
-        // this timer is done, we can kill it
-        _timerFunctionMap.remove(callingTimer);
-        delete callingTimer;
+    // gather everything due within the coalescing window, oldest deadline first
+    std::vector<std::pair<quint64, QTimer*>> due;
+    for (auto it = _timerFunctionMap.constBegin(); it != _timerFunctionMap.constEnd(); ++it) {
+        if (it.value().nextDue <= now + TIMER_COALESCE_WINDOW_USECS) {
+            due.emplace_back(it.value().nextDue, it.key());
+        }
     }
+    std::sort(due.begin(), due.end());
 
-    // call the associated JS function, if it exists
-    if (timerData.function.isValid()) {
-        auto preTimer = p_high_resolution_clock::now();
-        callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
-        auto postTimer = p_high_resolution_clock::now();
-        auto elapsed = (postTimer - preTimer);
-        _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
-    } else {
-        qCWarning(scriptengine) << "timerFired -- invalid function" << timerData.function.toVariant().toString();
+    for (auto& dueEntry : due) {
+        auto it = _timerFunctionMap.find(dueEntry.second);
+        if (it == _timerFunctionMap.end()) {
+            continue; // an earlier callback in this batch stopped this timer
+        }
+        TimerData timerData = it.value();
+
+        quint64 jitter = now > timerData.nextDue ? now - timerData.nextDue : 0;
+        _timerJitterTotalUsecs += jitter;
+        _timerJitterMaxUsecs = std::max(_timerJitterMaxUsecs, jitter);
+
+        if (timerData.isSingleShot) {
+            QTimer* handle = it.key();
+            _timerFunctionMap.erase(it);
+            delete handle;
+        } else {
+            quint64 intervalUsecs = (quint64)timerData.intervalMS * USECS_PER_MSEC;
+            quint64 nextDue = timerData.nextDue + intervalUsecs;
+            if (intervalUsecs > 0 && nextDue <= now) {
+                // this interval fell at least a full period behind; skip the missed fires
+                // rather than bursting to catch up.
+                quint64 missed = (now - timerData.nextDue) / intervalUsecs;
+                nextDue = timerData.nextDue + (missed + 1) * intervalUsecs;
+                _timerOverrunCount += missed;
+            }
+            it.value().nextDue = nextDue;
+        }
+
+        // call the associated JS function, if it exists
+        if (timerData.callback.function.isValid()) {
+            auto preTimer = p_high_resolution_clock::now();
+            callWithEnvironment(timerData.callback.definingEntityIdentifier, timerData.callback.definingSandboxURL,
+                                timerData.callback.function, timerData.callback.function, QScriptValueList());
+            auto postTimer = p_high_resolution_clock::now();
+            auto elapsed = (postTimer - preTimer);
+            _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+            _timerCallbackCount++;
+        } else {
+            qCWarning(scriptengine) << "timerWheelFired -- invalid function" << timerData.callback.function.toVariant().toString();
+        }
     }
+
+    rescheduleTimerWheel();
+}
+
+void ScriptEngine::rescheduleTimerWheel() {
+    if (!_timerWheel) {
+        return;
+    }
+    if (_timerFunctionMap.isEmpty()) {
+        _timerWheel->stop();
+        return;
+    }
+    quint64 nextDue = std::numeric_limits<quint64>::max();
+    for (auto it = _timerFunctionMap.constBegin(); it != _timerFunctionMap.constEnd(); ++it) {
+        nextDue = std::min(nextDue, it.value().nextDue);
+    }
+    quint64 now = usecTimestampNow();
+    int delayMS = nextDue > now ? (int)((nextDue - now) / USECS_PER_MSEC) : 0;
+    _timerWheel->start(delayMS);
 }
 
 QObject* ScriptEngine::setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot) {
-    // create the timer, add it to the map, and start it
+    // the returned QTimer is only an opaque handle for clearInterval/clearTimeout and is
+    // never started; all callbacks are driven by the shared timer wheel, so hundreds of
+    // scripted timers wake the script thread once per batch of due callbacks.
     QTimer* newTimer = new QTimer(this);
     newTimer->setSingleShot(isSingleShot);
 
-    // The default timer type is not very accurate below about 200ms http://doc.qt.io/qt-5/qt.html#TimerType-enum
-    static const int MIN_TIMEOUT_FOR_COARSE_TIMER = 200;
-    if (intervalMS < MIN_TIMEOUT_FOR_COARSE_TIMER) {
-        newTimer->setTimerType(Qt::PreciseTimer);
-    }
-
-    connect(newTimer, &QTimer::timeout, this, &ScriptEngine::timerFired);
-
-    // make sure the timer stops when the script does
-    connect(this, &ScriptEngine::scriptEnding, newTimer, &QTimer::stop);
-
-    CallbackData timerData = { function, currentEntityIdentifier, currentSandboxURL };
+    TimerData timerData = { { function, currentEntityIdentifier, currentSandboxURL },
+                            usecTimestampNow() + (quint64)intervalMS * USECS_PER_MSEC, intervalMS, isSingleShot };
     _timerFunctionMap.insert(newTimer, timerData);
 
-    newTimer->start(intervalMS);
+    if (!_timerWheel) {
+        _timerWheel = new QTimer(this);
+        _timerWheel->setSingleShot(true);
+        // The default timer type is not very accurate below about 200ms http://doc.qt.io/qt-5/qt.html#TimerType-enum
+        _timerWheel->setTimerType(Qt::PreciseTimer);
+        connect(_timerWheel, &QTimer::timeout, this, &ScriptEngine::timerWheelFired);
+
+        // make sure the wheel stops when the script does
+        connect(this, &ScriptEngine::scriptEnding, _timerWheel, &QTimer::stop);
+    }
+    rescheduleTimerWheel();
     return newTimer;
 }
 
+QVariantMap ScriptEngine::getTimerStats() const {
+    QVariantMap stats;
+    stats["activeTimers"] = _timerFunctionMap.size();
+    stats["wakeCount"] = (qulonglong)_timerWakeCount;
+    stats["callbackCount"] = (qulonglong)_timerCallbackCount;
+    stats["averageJitterUsecs"] = _timerCallbackCount > 0 ? (double)_timerJitterTotalUsecs / (double)_timerCallbackCount : 0.0;
+    stats["maxJitterUsecs"] = (qulonglong)_timerJitterMaxUsecs;
+    stats["overrunCount"] = (qulonglong)_timerOverrunCount;
+    stats["totalExecutionUsecs"] = (qulonglong)_totalTimerExecution.count();
+    return stats;
+}
+
 QObject* ScriptEngine::setInterval(const QScriptValue& function, int intervalMS) {
     if (DependencyManager::get<ScriptEngines>()->isStopped()) {
         scriptWarningMessage("Script.setInterval() while shutting down is ignored... parent script:" + getFilename());
@@ -1238,9 +1390,9 @@ QObject* ScriptEngine::setTimeout(const QScriptValue& function, int timeoutMS) {
 
 void ScriptEngine::stopTimer(QTimer *timer) {
     if (_timerFunctionMap.contains(timer)) {
-        timer->stop();
         _timerFunctionMap.remove(timer);
         delete timer;
+        rescheduleTimerWheel();
     } else {
         qCDebug(scriptengine) << "stopTimer -- not in _timerFunctionMap" << timer;
     }
@@ -1704,87 +1856,104 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
         return;
     }
 
-    // SYNTAX ERRORS
-    auto syntaxError = lintScript(contents, fileName);
-    if (syntaxError.isError()) {
-        auto message = syntaxError.property("formatted").toString();
-        if (message.isEmpty()) {
-            message = syntaxError.toString();
+    // PER-URL VETTING CACHE -- when many entities boot from the same script URL, linting,
+    // compilation and the sandbox preflight below only need to happen for the first one;
+    // the rest reuse the vetted compiled program and skip straight to evaluation
+    bool alreadyVetted = false;
+    QScriptProgram program;
+    {
+        auto vettedProgram = _vettedEntityPrograms.find(scriptOrURL);
+        if (vettedProgram != _vettedEntityPrograms.end() && vettedProgram->sourceCode() == contents) {
+            program = *vettedProgram;
+            alreadyVetted = true;
         }
-        setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        syntaxError.setProperty("detail", entityID.toString());
-        emit unhandledException(syntaxError);
-        return;
     }
-    QScriptProgram program { contents, fileName };
-    if (program.isNull()) {
-        setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(makeError("program.isNull"));
-        return; // done processing script
+
+    if (!alreadyVetted) {
+        // SYNTAX ERRORS
+        auto syntaxError = lintScript(contents, fileName);
+        if (syntaxError.isError()) {
+            auto message = syntaxError.property("formatted").toString();
+            if (message.isEmpty()) {
+                message = syntaxError.toString();
+            }
+            setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            syntaxError.setProperty("detail", entityID.toString());
+            emit unhandledException(syntaxError);
+            return;
+        }
+        program = QScriptProgram { contents, fileName };
+        if (program.isNull()) {
+            setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(makeError("program.isNull"));
+            return; // done processing script
+        }
     }
 
     if (isURL) {
         setParentURL(scriptOrURL);
     }
 
-    // SANITY/PERFORMANCE CHECK USING SANDBOX
-    const int SANDBOX_TIMEOUT = 0.25 * MSECS_PER_SECOND;
-    BaseScriptEngine sandbox;
-    sandbox.setProcessEventsInterval(SANDBOX_TIMEOUT);
-    QScriptValue testConstructor, exception;
-    {
-        QTimer timeout;
-        timeout.setSingleShot(true);
-        timeout.start(SANDBOX_TIMEOUT);
-        connect(&timeout, &QTimer::timeout, [&sandbox, SANDBOX_TIMEOUT, scriptOrURL]{
-            auto context = sandbox.currentContext();
-            if (context) {
-                qCDebug(scriptengine) << "ScriptEngine::entityScriptContentAvailable timeout(" << scriptOrURL << ")";
-
-                // Guard against infinite loops and non-performant code
-                context->throwError(QString("Timed out (entity constructors are limited to %1ms)").arg(SANDBOX_TIMEOUT));
-            }
-        });
+    if (!alreadyVetted) {
+        // SANITY/PERFORMANCE CHECK USING SANDBOX
+        const int SANDBOX_TIMEOUT = 0.25 * MSECS_PER_SECOND;
+        BaseScriptEngine sandbox;
+        sandbox.setProcessEventsInterval(SANDBOX_TIMEOUT);
+        QScriptValue testConstructor, exception;
+        {
+            QTimer timeout;
+            timeout.setSingleShot(true);
+            timeout.start(SANDBOX_TIMEOUT);
+            connect(&timeout, &QTimer::timeout, [&sandbox, SANDBOX_TIMEOUT, scriptOrURL]{
+                auto context = sandbox.currentContext();
+                if (context) {
+                    qCDebug(scriptengine) << "ScriptEngine::entityScriptContentAvailable timeout(" << scriptOrURL << ")";
+
+                    // Guard against infinite loops and non-performant code
+                    context->throwError(QString("Timed out (entity constructors are limited to %1ms)").arg(SANDBOX_TIMEOUT));
+                }
+            });
 
-        testConstructor = sandbox.evaluate(program);
+            testConstructor = sandbox.evaluate(program);
 
-        if (sandbox.hasUncaughtException()) {
-            exception = sandbox.cloneUncaughtException(QString("(preflight %1)").arg(entityID.toString()));
-            sandbox.clearExceptions();
-        } else if (testConstructor.isError()) {
-            exception = testConstructor;
+            if (sandbox.hasUncaughtException()) {
+                exception = sandbox.cloneUncaughtException(QString("(preflight %1)").arg(entityID.toString()));
+                sandbox.clearExceptions();
+            } else if (testConstructor.isError()) {
+                exception = testConstructor;
+            }
         }
-    }
-
-    if (exception.isError()) {
-        // create a local copy using makeError to decouple from the sandbox engine
-        exception = makeError(exception);
-        setError(formatException(exception), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(exception);
-        return;
-    }
 
-    // CONSTRUCTOR VIABILITY
-    if (!testConstructor.isFunction()) {
-        QString testConstructorType = QString(testConstructor.toVariant().typeName());
-        if (testConstructorType == "") {
-            testConstructorType = "empty";
-        }
-        QString testConstructorValue = testConstructor.toString();
-        const int maxTestConstructorValueSize = 80;
-        if (testConstructorValue.size() > maxTestConstructorValueSize) {
-            testConstructorValue = testConstructorValue.mid(0, maxTestConstructorValueSize) + "...";
+        if (exception.isError()) {
+            // create a local copy using makeError to decouple from the sandbox engine
+            exception = makeError(exception);
+            setError(formatException(exception), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(exception);
+            return;
         }
-        auto message = QString("failed to load entity script -- expected a function, got %1, %2")
-            .arg(testConstructorType).arg(testConstructorValue);
 
-        auto err = makeError(message);
-        err.setProperty("fileName", scriptOrURL);
-        err.setProperty("detail", "(constructor " + entityID.toString() + ")");
+        // CONSTRUCTOR VIABILITY
+        if (!testConstructor.isFunction()) {
+            QString testConstructorType = QString(testConstructor.toVariant().typeName());
+            if (testConstructorType == "") {
+                testConstructorType = "empty";
+            }
+            QString testConstructorValue = testConstructor.toString();
+            const int maxTestConstructorValueSize = 80;
+            if (testConstructorValue.size() > maxTestConstructorValueSize) {
+                testConstructorValue = testConstructorValue.mid(0, maxTestConstructorValueSize) + "...";
+            }
+            auto message = QString("failed to load entity script -- expected a function, got %1, %2")
+                .arg(testConstructorType).arg(testConstructorValue);
 
-        setError("Could not find constructor (" + testConstructorType + ")", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(err);
-        return; // done processing script
+            auto err = makeError(message);
+            err.setProperty("fileName", scriptOrURL);
+            err.setProperty("detail", "(constructor " + entityID.toString() + ")");
+
+            setError("Could not find constructor (" + testConstructorType + ")", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(err);
+            return; // done processing script
+        }
     }
 
     // (this feeds into refreshFileScript)
@@ -1798,7 +1967,13 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
     QScriptValue entityScriptConstructor, entityScriptObject;
     QUrl sandboxURL = currentSandboxURL.isEmpty() ? scriptOrURL : currentSandboxURL;
     auto initialization = [&]{
-        entityScriptConstructor = evaluate(contents, fileName);
+        // the program was already linted (and possibly compiled by an earlier entity sharing
+        // this URL), so evaluate it directly instead of re-parsing the source
+        entityScriptConstructor = BaseScriptEngine::evaluate(program);
+        if (!isEvaluating() && hasUncaughtException()) {
+            emit unhandledException(cloneUncaughtException(__FUNCTION__));
+            clearExceptions();
+        }
         entityScriptObject = entityScriptConstructor.construct();
 
         if (hasUncaughtException()) {
@@ -1823,6 +1998,10 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
     newDetails.definingSandboxURL = sandboxURL;
     setEntityScriptDetails(entityID, newDetails);
 
+    // this URL's program is known-good for these exact contents; later entities sharing the
+    // URL (compared against contents, so edited file scripts still re-vet) skip the preflight
+    _vettedEntityPrograms[scriptOrURL] = program;
+
     if (isURL) {
         setParentURL("");
     }
@@ -21,6 +21,7 @@
 #include <QtCore/QStringList>
 
 #include <QtScript/QScriptEngine>
+#include <QtScript/QScriptProgram>
 
 #include <AnimationCache.h>
 #include <AnimVariant.h>
@@ -180,6 +181,26 @@ public:
 
     Q_INVOKABLE void requestGarbageCollection() { collectGarbage(); }
 
+    /**jsdoc
+     * Statistics from the shared timer scheduler: active timer count, thread wakes,
+     * callbacks run, average and worst-case fire jitter, overruns (interval periods
+     * skipped because callbacks ran long) and total callback execution time.
+     * @function Script.getTimerStats
+     * @return {object} The scheduler statistics.
+     */
+    Q_INVOKABLE QVariantMap getTimerStats() const;
+
+    /**jsdoc
+     * Statistics from the garbage collection scheduler: collections run, total, worst-case
+     * and most recent collection time, collections deferred because the idle slice was too
+     * short, and the external (ArrayBuffer) memory reported to the collector - pending since
+     * the last collection, lifetime total, and average bytes per second - so leaky scripts
+     * show up as a climbing allocation rate.
+     * @function Script.getMemoryStats
+     * @return {object} The garbage collection statistics.
+     */
+    Q_INVOKABLE QVariantMap getMemoryStats() const;
+
     Q_INVOKABLE QUuid generateUUID() { return QUuid::createUuid(); }
 
     bool isFinished() const { return _isFinished; } // used by Application and ScriptWidget
@@ -239,7 +260,8 @@ protected:
     Q_INVOKABLE void executeOnScriptThread(std::function<void()> function, const Qt::ConnectionType& type = Qt::QueuedConnection );
 
     QString logException(const QScriptValue& exception);
-    void timerFired();
+    void timerWheelFired();
+    void rescheduleTimerWheel();
     void stopAllTimers();
     void stopAllTimersForEntityScript(const EntityItemID& entityID);
     void refreshFileScript(const EntityItemID& entityID);
@@ -251,6 +273,8 @@ protected:
     QObject* setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot);
     void stopTimer(QTimer* timer);
 
+    void maybeCollectGarbage(quint64 idleBudgetUsecs);
+
     QHash<EntityItemID, RegisteredEventHandlers> _registeredHandlers;
     void forwardHandlerCall(const EntityItemID& entityID, const QString& eventName, QScriptValueList eventHanderArgs);
     Q_INVOKABLE void entityScriptContentAvailable(const EntityItemID& entityID, const QString& scriptOrURL, const QString& contents, bool isURL, bool success, const QString& status);
@@ -267,11 +291,42 @@ protected:
     std::atomic<bool> _isRunning { false };
     std::atomic<bool> _isStopping { false };
     bool _isInitialized { false };
-    QHash<QTimer*, CallbackData> _timerFunctionMap;
+    // All script timers are driven by a single timer wheel per engine. The QTimer keys
+    // are opaque handles for clearInterval/clearTimeout and are never started; each wake
+    // of _timerWheel runs every due callback in one engine entry.
+    struct TimerData {
+        CallbackData callback;
+        quint64 nextDue; // next fire time, usecTimestampNow() based
+        int intervalMS;
+        bool isSingleShot;
+    };
+    QHash<QTimer*, TimerData> _timerFunctionMap;
+    QTimer* _timerWheel { nullptr };
+    quint64 _timerWakeCount { 0 };
+    quint64 _timerCallbackCount { 0 };
+    quint64 _timerJitterTotalUsecs { 0 };
+    quint64 _timerJitterMaxUsecs { 0 };
+    quint64 _timerOverrunCount { 0 };
+    // Garbage collections are scheduled explicitly from the idle slice between frames
+    // rather than left to the collector, so they never land inside an update or a batched
+    // timer callback run. All of these are only touched from the script thread.
+    quint64 _gcEpochTime { 0 }; // when GC scheduling started, for allocation-rate stats
+    quint64 _lastGCTime { 0 };
+    quint64 _lastGCDurationUsecs { 0 };
+    quint64 _gcCount { 0 };
+    quint64 _gcTotalUsecs { 0 };
+    quint64 _gcMaxUsecs { 0 };
+    quint64 _gcDeferredCount { 0 };
+    qint64 _externalMemoryCost { 0 }; // bytes reported since the last collection
+    qint64 _externalMemoryCostTotal { 0 };
     QSet<QUrl> _includedURLs;
     QHash<EntityItemID, EntityScriptDetails> _entityScripts;
     QHash<QString, EntityItemID> _occupiedScriptURLs;
     QList<DeferredLoadEntity> _deferredEntityLoads;
+    // per-URL cache of entity script programs that already passed linting and the sandbox
+    // preflight, so additional entities booting from the same URL skip straight to evaluation
+    // and reuse the compiled program instead of re-parsing the source
+    QHash<QString, QScriptProgram> _vettedEntityPrograms;
 
     bool _isThreaded { false };
     QScriptEngineDebugger* _debugger { nullptr };
@@ -9,16 +9,42 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <algorithm>
+
 #include <glm/gtx/vector_angle.hpp>
 
 #include <QDebug>
 
 #include <GLMHelpers.h>
 
+#include "ArrayBufferViewClass.h"
 #include "ScriptEngineLogging.h"
 #include "NumericalConstants.h"
 #include "Vec3.h"
 
+Q_DECLARE_METATYPE(QByteArray*)
+
+// resolves a Float32Array view to a pointer into its shared ArrayBuffer storage,
+// so the batch operations below can work on the packed floats in place.
+static float* floatDataFromTypedArray(const QScriptValue& view, int& floatCountOut) {
+    floatCountOut = 0;
+    QScriptValue data = view.data();
+    if (!data.isValid()) {
+        return nullptr;
+    }
+    QByteArray* buffer = qscriptvalue_cast<QByteArray*>(data.property(BUFFER_PROPERTY_NAME).data());
+    if (!buffer) {
+        return nullptr;
+    }
+    int byteOffset = data.property(BYTE_OFFSET_PROPERTY_NAME).toInt32();
+    int byteLength = data.property(BYTE_LENGTH_PROPERTY_NAME).toInt32();
+    if (byteOffset < 0 || byteLength < 0 || byteOffset + byteLength > buffer->size()) {
+        return nullptr;
+    }
+    floatCountOut = byteLength / (int)sizeof(float);
+    return reinterpret_cast<float*>(buffer->data() + byteOffset);
+}
+
 
 float Vec3::orientedAngle(const glm::vec3& v1, const glm::vec3& v2, const glm::vec3& v3) {
     float radians = glm::orientedAngle(glm::normalize(v1), glm::normalize(v2), glm::normalize(v3));
@@ -87,3 +113,145 @@ float Vec3::getAngle(const glm::vec3& v1, const glm::vec3& v2) {
 	return glm::acos(glm::dot(glm::normalize(v1), glm::normalize(v2)));
 }
 
+void Vec3::batchSum(QScriptValue a, QScriptValue b, QScriptValue result) {
+    int aCount, bCount, resultCount;
+    float* aData = floatDataFromTypedArray(a, aCount);
+    float* bData = floatDataFromTypedArray(b, bCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!aData || !bData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchSum expects Float32Array arguments";
+        return;
+    }
+    int count = std::min(std::min(aCount, bCount), resultCount);
+    for (int i = 0; i < count; i++) {
+        resultData[i] = aData[i] + bData[i];
+    }
+}
+
+void Vec3::batchSubtract(QScriptValue a, QScriptValue b, QScriptValue result) {
+    int aCount, bCount, resultCount;
+    float* aData = floatDataFromTypedArray(a, aCount);
+    float* bData = floatDataFromTypedArray(b, bCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!aData || !bData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchSubtract expects Float32Array arguments";
+        return;
+    }
+    int count = std::min(std::min(aCount, bCount), resultCount);
+    for (int i = 0; i < count; i++) {
+        resultData[i] = aData[i] - bData[i];
+    }
+}
+
+void Vec3::batchMultiply(QScriptValue a, float f, QScriptValue result) {
+    int aCount, resultCount;
+    float* aData = floatDataFromTypedArray(a, aCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!aData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchMultiply expects Float32Array arguments";
+        return;
+    }
+    int count = std::min(aCount, resultCount);
+    for (int i = 0; i < count; i++) {
+        resultData[i] = aData[i] * f;
+    }
+}
+
+void Vec3::batchMultiplyQbyV(const glm::quat& q, QScriptValue v, QScriptValue result) {
+    int vCount, resultCount;
+    float* vData = floatDataFromTypedArray(v, vCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!vData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchMultiplyQbyV expects Float32Array arguments";
+        return;
+    }
+    int count = (std::min(vCount, resultCount) / 3) * 3;
+    for (int i = 0; i < count; i += 3) {
+        glm::vec3 rotated = q * glm::vec3(vData[i], vData[i + 1], vData[i + 2]);
+        resultData[i] = rotated.x;
+        resultData[i + 1] = rotated.y;
+        resultData[i + 2] = rotated.z;
+    }
+}
+
+void Vec3::batchMix(QScriptValue a, QScriptValue b, float m, QScriptValue result) {
+    int aCount, bCount, resultCount;
+    float* aData = floatDataFromTypedArray(a, aCount);
+    float* bData = floatDataFromTypedArray(b, bCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!aData || !bData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchMix expects Float32Array arguments";
+        return;
+    }
+    int count = std::min(std::min(aCount, bCount), resultCount);
+    for (int i = 0; i < count; i++) {
+        resultData[i] = aData[i] + m * (bData[i] - aData[i]);
+    }
+}
+
+void Vec3::batchCross(QScriptValue a, QScriptValue b, QScriptValue result) {
+    int aCount, bCount, resultCount;
+    float* aData = floatDataFromTypedArray(a, aCount);
+    float* bData = floatDataFromTypedArray(b, bCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!aData || !bData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchCross expects Float32Array arguments";
+        return;
+    }
+    int count = (std::min(std::min(aCount, bCount), resultCount) / 3) * 3;
+    for (int i = 0; i < count; i += 3) {
+        glm::vec3 crossed = glm::cross(glm::vec3(aData[i], aData[i + 1], aData[i + 2]),
+                                       glm::vec3(bData[i], bData[i + 1], bData[i + 2]));
+        resultData[i] = crossed.x;
+        resultData[i + 1] = crossed.y;
+        resultData[i + 2] = crossed.z;
+    }
+}
+
+void Vec3::batchDot(QScriptValue a, QScriptValue b, QScriptValue result) {
+    int aCount, bCount, resultCount;
+    float* aData = floatDataFromTypedArray(a, aCount);
+    float* bData = floatDataFromTypedArray(b, bCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!aData || !bData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchDot expects Float32Array arguments";
+        return;
+    }
+    int count = std::min(std::min(aCount, bCount) / 3, resultCount);
+    for (int i = 0; i < count; i++) {
+        resultData[i] = glm::dot(glm::vec3(aData[3 * i], aData[3 * i + 1], aData[3 * i + 2]),
+                                 glm::vec3(bData[3 * i], bData[3 * i + 1], bData[3 * i + 2]));
+    }
+}
+
+void Vec3::batchLength(QScriptValue v, QScriptValue result) {
+    int vCount, resultCount;
+    float* vData = floatDataFromTypedArray(v, vCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!vData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchLength expects Float32Array arguments";
+        return;
+    }
+    int count = std::min(vCount / 3, resultCount);
+    for (int i = 0; i < count; i++) {
+        resultData[i] = glm::length(glm::vec3(vData[3 * i], vData[3 * i + 1], vData[3 * i + 2]));
+    }
+}
+
+void Vec3::batchNormalize(QScriptValue v, QScriptValue result) {
+    int vCount, resultCount;
+    float* vData = floatDataFromTypedArray(v, vCount);
+    float* resultData = floatDataFromTypedArray(result, resultCount);
+    if (!vData || !resultData) {
+        qCWarning(scriptengine) << "Vec3.batchNormalize expects Float32Array arguments";
+        return;
+    }
+    int count = (std::min(vCount, resultCount) / 3) * 3;
+    for (int i = 0; i < count; i += 3) {
+        glm::vec3 normalized = glm::normalize(glm::vec3(vData[i], vData[i + 1], vData[i + 2]));
+        resultData[i] = normalized.x;
+        resultData[i + 1] = normalized.y;
+        resultData[i + 2] = normalized.z;
+    }
+}
+
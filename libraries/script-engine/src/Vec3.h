@@ -17,6 +17,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QString>
+#include <QtScript/QScriptValue>
 
 #include "GLMHelpers.h"
 
@@ -94,6 +95,20 @@ public slots:
     glm::vec3 fromPolar(float elevation, float azimuth);
     float getAngle(const glm::vec3& v1, const glm::vec3& v2);
 
+    // packed batch operations over Float32Array views of consecutive x,y,z triplets.
+    // they read and write the view's shared ArrayBuffer storage directly, so per-frame
+    // math over many vectors runs without creating a script object per component.
+    // result may alias either input. dot and length write one float per vector.
+    void batchSum(QScriptValue a, QScriptValue b, QScriptValue result);
+    void batchSubtract(QScriptValue a, QScriptValue b, QScriptValue result);
+    void batchMultiply(QScriptValue a, float f, QScriptValue result);
+    void batchMultiplyQbyV(const glm::quat& q, QScriptValue v, QScriptValue result);
+    void batchMix(QScriptValue a, QScriptValue b, float m, QScriptValue result);
+    void batchCross(QScriptValue a, QScriptValue b, QScriptValue result);
+    void batchDot(QScriptValue a, QScriptValue b, QScriptValue result);
+    void batchLength(QScriptValue v, QScriptValue result);
+    void batchNormalize(QScriptValue v, QScriptValue result);
+
 private:
     const glm::vec3& UNIT_X() { return Vectors::UNIT_X; }
     const glm::vec3& UNIT_Y() { return Vectors::UNIT_Y; }
@@ -55,6 +55,17 @@ public:
         result = codec.data;
     }
 
+    template<typename T>
+    inline void readCompressedCounts(T* results, size_t count) {
+        // decode a run of byte-count coded values in one call - one codec is reused across
+        // the run instead of constructing one per value
+        ByteCountCoded<T> codec;
+        for (size_t i = 0; i < count; i++) {
+            _offset += codec.decode(reinterpret_cast<const char*>(_data + _offset), (int)remaining());
+            results[i] = codec.data;
+        }
+    }
+
     inline size_t remaining() const {
         return _size - _offset;
     }
@@ -30,6 +30,24 @@
 
 #include "NumericalConstants.h"
 
+/// mirrors the bits of a byte (MSB <-> LSB), used by the decode fast path to convert the
+/// MSB-first wire order into the LSB-first order the value bits were packed in
+inline unsigned char byteCountCodingMirrorByte(unsigned char value) {
+    value = ((value & 0xF0) >> 4) | ((value & 0x0F) << 4);
+    value = ((value & 0xCC) >> 2) | ((value & 0x33) << 2);
+    value = ((value & 0xAA) >> 1) | ((value & 0x55) << 1);
+    return value;
+}
+
+inline int byteCountCodingLeadingOnes(unsigned char value) {
+    int count = 0;
+    while (value & 0x80) {
+        count++;
+        value <<= 1;
+    }
+    return count;
+}
+
 template<typename T> class ByteCountCoded {
 public:
     T data;
@@ -64,25 +82,14 @@ template<typename T> inline QByteArray& operator>>(QByteArray& in, ByteCountCode
 template<typename T> inline QByteArray ByteCountCoded<T>::encode() const {
     QByteArray output;
 
-    int totalBits = sizeof(data) * BITS_IN_BYTE;
-    int valueBits = totalBits;
-    bool firstValueFound = false;
-    T temp = data;
-    T lastBitMask = (T)(1) << (totalBits - 1);
-
     // determine the number of bits that the value takes
-    for (int bitAt = 0; bitAt < totalBits; bitAt++) {
-        T bitValue = (temp & lastBitMask) == lastBitMask;
-        if (!firstValueFound) {
-            if (bitValue == 0) {
-                valueBits--;
-            } else {
-                firstValueFound = true;
-            }
-        }
-        temp = temp << 1;
+    int valueBits = 0;
+    T temp = data;
+    while (temp) {
+        valueBits++;
+        temp = temp >> 1;
     }
-    
+
     // calculate the number of total bytes, including our header
     // BITS_IN_BYTE-1 because we need to code the number of bytes in the header
     // + 1 because we always take at least 1 byte, even if number of bits is less than a bytes worth
@@ -121,6 +128,27 @@ template<typename T> inline size_t ByteCountCoded<T>::decode(const QByteArray& f
 
 template<typename T> inline size_t ByteCountCoded<T>::decode(const char* encodedBuffer, int encodedSize) {
     data = 0; // reset data
+
+    // Fast path: when the lead bits fit in the first byte and the whole encoding is in the buffer,
+    // we can decode a byte at a time by mirroring each byte, instead of walking the bits. The lead
+    // bits (including their 0 terminator) shift out of the mirrored first byte, and each subsequent
+    // mirrored byte ORs in as a whole.
+    if (encodedSize > 0) {
+        const int maxValidBytes = ((int)sizeof(T) * BITS_IN_BYTE) / (BITS_IN_BYTE - 1) + 1;
+        unsigned char leadByte = (unsigned char)encodedBuffer[0];
+        int numberOfBytes = byteCountCodingLeadingOnes(leadByte) + 1;
+        if (numberOfBytes <= BITS_IN_BYTE && numberOfBytes <= maxValidBytes && numberOfBytes <= encodedSize) {
+            T value = (T)(byteCountCodingMirrorByte(leadByte) >> numberOfBytes);
+            int valueBitsSoFar = BITS_IN_BYTE - numberOfBytes;
+            for (int i = 1; i < numberOfBytes; i++) {
+                value |= (T)byteCountCodingMirrorByte((unsigned char)encodedBuffer[i]) << valueBitsSoFar;
+                valueBitsSoFar += BITS_IN_BYTE;
+            }
+            data = value;
+            return numberOfBytes;
+        }
+    }
+
     size_t bytesConsumed = 0;
     int bitCount = BITS_IN_BYTE * encodedSize;
 
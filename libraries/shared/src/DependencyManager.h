@@ -17,6 +17,7 @@
 #include <QSharedPointer>
 #include <QWeakPointer>
 
+#include <atomic>
 #include <functional>
 #include <typeinfo>
 
@@ -48,7 +49,14 @@ class DependencyManager {
 public:
     template<typename T>
     static QSharedPointer<T> get();
-    
+
+    // Raw-pointer fast path for hot (per-frame / per-packet) callers: after the first call
+    // this is a version check and an array load, with no hash lookup and no reference-count
+    // traffic. The pointer is only valid while the dependency remains set - never cache it
+    // yourself or hold it across set<T>() / destroy<T>(); cold paths should stay on get<T>().
+    template<typename T>
+    static T* getUnsafe();
+
     template<typename T>
     static bool isSet();
     
@@ -74,6 +82,9 @@ private:
     
     QHash<size_t, QSharedPointer<Dependency>> _instanceHash;
     QHash<size_t, size_t> _inheritanceHash;
+
+    // bumped on every set/destroy/registerInheritance so getUnsafe callers re-resolve
+    std::atomic<uint64_t> _version { 1 };
 };
 
 template <typename T>
@@ -92,6 +103,20 @@ QSharedPointer<T> DependencyManager::get() {
     return instance.toStrongRef();
 }
 
+template <typename T>
+T* DependencyManager::getUnsafe() {
+    static size_t hashCode = manager().getHashCode<T>();
+    static std::atomic<uint64_t> cachedVersion { 0 };
+    static std::atomic<T*> cachedInstance { nullptr };
+
+    uint64_t version = manager()._version.load(std::memory_order_acquire);
+    if (version != cachedVersion.load(std::memory_order_acquire)) {
+        cachedInstance.store(qSharedPointerCast<T>(manager().safeGet(hashCode)).data(), std::memory_order_release);
+        cachedVersion.store(version, std::memory_order_release);
+    }
+    return cachedInstance.load(std::memory_order_relaxed);
+}
+
 template <typename T>
 bool DependencyManager::isSet() {
     static size_t hashCode = manager().getHashCode<T>();
@@ -109,6 +134,7 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
     QSharedPointer<T> newInstance(new T(args...), &T::customDeleter);
     QSharedPointer<Dependency> storedInstance = qSharedPointerCast<Dependency>(newInstance);
     instance.swap(storedInstance);
+    manager()._version.fetch_add(1, std::memory_order_release);
 
     return newInstance;
 }
@@ -122,6 +148,7 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
     QSharedPointer<T> newInstance(new I(args...), &I::customDeleter);
     QSharedPointer<Dependency> storedInstance = qSharedPointerCast<Dependency>(newInstance);
     instance.swap(storedInstance);
+    manager()._version.fetch_add(1, std::memory_order_release);
 
     return newInstance;
 }
@@ -130,6 +157,7 @@ template <typename T>
 void DependencyManager::destroy() {
     static size_t hashCode = manager().getHashCode<T>();
     manager().safeGet(hashCode).clear();
+    manager()._version.fetch_add(1, std::memory_order_release);
 }
 
 template<typename Base, typename Derived>
@@ -137,6 +165,7 @@ void DependencyManager::registerInheritance() {
     size_t baseHashCode = typeid(Base).hash_code();
     size_t derivedHashCode = typeid(Derived).hash_code();
     manager()._inheritanceHash.insert(baseHashCode, derivedHashCode);
+    manager()._version.fetch_add(1, std::memory_order_release);
 }
 
 template<typename T>
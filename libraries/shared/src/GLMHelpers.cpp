@@ -184,6 +184,108 @@ int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatIn
     return 6;
 }
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quats, int count) {
+    unsigned char* p = buffer;
+    int n = 0;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    // the float-heavy work (abs, largest-component search, sign flip, quantization)
+    // runs four quaternions wide; the per-quat component shuffle and byte swap that
+    // depend on the largest component stay scalar
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+    const float RANGE = (float)((1 << 15) - 1);
+
+    for (; n + 4 <= count; n += 4) {
+        // transpose to SoA (layout-agnostic loads)
+        __m128 qx = _mm_setr_ps(quats[n+0].x, quats[n+1].x, quats[n+2].x, quats[n+3].x);
+        __m128 qy = _mm_setr_ps(quats[n+0].y, quats[n+1].y, quats[n+2].y, quats[n+3].y);
+        __m128 qz = _mm_setr_ps(quats[n+0].z, quats[n+1].z, quats[n+2].z, quats[n+3].z);
+        __m128 qw = _mm_setr_ps(quats[n+0].w, quats[n+1].w, quats[n+2].w, quats[n+3].w);
+
+        __m128 ax = _mm_andnot_ps(signMask, qx);
+        __m128 ay = _mm_andnot_ps(signMask, qy);
+        __m128 az = _mm_andnot_ps(signMask, qz);
+        __m128 aw = _mm_andnot_ps(signMask, qw);
+
+        // largest component per lane, ties resolved to the lowest index as in the scalar path
+        __m128i m1 = _mm_castps_si128(_mm_cmpgt_ps(ay, ax));
+        __m128 t0 = _mm_max_ps(ax, ay);
+        __m128i i0 = _mm_and_si128(m1, _mm_set1_epi32(1));
+        __m128i m2 = _mm_castps_si128(_mm_cmpgt_ps(aw, az));
+        __m128 t1 = _mm_max_ps(az, aw);
+        __m128i i1 = _mm_or_si128(_mm_set1_epi32(2), _mm_and_si128(m2, _mm_set1_epi32(1)));
+        __m128i m3 = _mm_castps_si128(_mm_cmpgt_ps(t1, t0));
+        __m128i index = _mm_or_si128(_mm_and_si128(m3, i1), _mm_andnot_si128(m3, i0));
+
+        // value of the largest component, to decide the sign flip
+        __m128 mask0 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(0)));
+        __m128 mask1 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+        __m128 mask2 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+        __m128 mask3 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+        __m128 largest = _mm_or_ps(_mm_or_ps(_mm_and_ps(mask0, qx), _mm_and_ps(mask1, qy)),
+                                   _mm_or_ps(_mm_and_ps(mask2, qz), _mm_and_ps(mask3, qw)));
+
+        // ensure that the sign of the dropped component is always negative
+        __m128 flip = _mm_and_ps(_mm_cmpgt_ps(largest, _mm_setzero_ps()), signMask);
+        qx = _mm_xor_ps(qx, flip);
+        qy = _mm_xor_ps(qy, flip);
+        qz = _mm_xor_ps(qz, flip);
+        qw = _mm_xor_ps(qw, flip);
+
+        // quantize all components into 0..RANGE, matching the scalar operation order
+        __m128 mag = _mm_set1_ps(MAGNITUDE);
+        __m128 twoMag = _mm_set1_ps(2.0f * MAGNITUDE);
+        __m128 range = _mm_set1_ps(RANGE);
+        __m128i cx = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(qx, mag), twoMag), range));
+        __m128i cy = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(qy, mag), twoMag), range));
+        __m128i cz = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(qz, mag), twoMag), range));
+        __m128i cw = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(qw, mag), twoMag), range));
+
+        alignas(16) int32_t quantized[4][4];
+        alignas(16) int32_t largestComponent[4];
+        _mm_store_si128((__m128i*)quantized[0], cx);
+        _mm_store_si128((__m128i*)quantized[1], cy);
+        _mm_store_si128((__m128i*)quantized[2], cz);
+        _mm_store_si128((__m128i*)quantized[3], cw);
+        _mm_store_si128((__m128i*)largestComponent, index);
+
+        for (int lane = 0; lane < 4; lane++) {
+            int largest = largestComponent[lane];
+
+            uint16_t components[3];
+            for (int i = 0, j = 0; i < 4; i++) {
+                if (i != largest) {
+                    components[j++] = (uint16_t)quantized[i][lane];
+                }
+            }
+
+            // encode the largest component into the high bits of the first two components
+            components[0] = (0x7fff & components[0]) | ((0x01 & largest) << 15);
+            components[1] = (0x7fff & components[1]) | ((0x02 & largest) << 14);
+
+            p[0] = HI_BYTE(components[0]);
+            p[1] = LO_BYTE(components[0]);
+            p[2] = HI_BYTE(components[1]);
+            p[3] = LO_BYTE(components[1]);
+            p[4] = HI_BYTE(components[2]);
+            p[5] = LO_BYTE(components[2]);
+            p += 6;
+        }
+    }
+#endif
+
+    for (; n < count; n++) {
+        p += packOrientationQuatToSixBytes(p, quats[n]);
+    }
+
+    return (int)(p - buffer);
+}
+
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput) {
 
     uint16_t components[3];
@@ -577,3 +679,64 @@ glm::mat4 orthoInverse(const glm::mat4& m) {
     r[3][3] = 1.0f;
     return r;
 }
+
+//
+// Batched transform kernels, with runtime CPU dispatch
+//
+
+#include "CPUDetect.h"
+
+static void batchTransformPoints_ref(const glm::mat4& m, const glm::vec3* src, glm::vec4* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = m * glm::vec4(src[i], 1.0f);
+    }
+}
+
+static void batchTransformVecs_ref(const glm::mat4& m, const glm::vec4* src, glm::vec4* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = m * src[i];
+    }
+}
+
+static void batchNormalizeQuats_ref(const glm::quat* src, glm::quat* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = glm::normalize(src[i]);
+    }
+}
+
+#ifdef ARCH_X86
+
+void batchTransformPoints_AVX2(const glm::mat4& m, const glm::vec3* src, glm::vec4* dst, size_t count);
+void batchTransformVecs_AVX2(const glm::mat4& m, const glm::vec4* src, glm::vec4* dst, size_t count);
+void batchNormalizeQuats_AVX2(const glm::quat* src, glm::quat* dst, size_t count);
+
+void batchTransformPoints(const glm::mat4& m, const glm::vec3* src, glm::vec4* dst, size_t count) {
+    static auto f = cpuSupportsAVX2() ? batchTransformPoints_AVX2 : batchTransformPoints_ref;
+    (*f)(m, src, dst, count);   // dispatch
+}
+
+void batchTransformVecs(const glm::mat4& m, const glm::vec4* src, glm::vec4* dst, size_t count) {
+    static auto f = cpuSupportsAVX2() ? batchTransformVecs_AVX2 : batchTransformVecs_ref;
+    (*f)(m, src, dst, count);   // dispatch
+}
+
+void batchNormalizeQuats(const glm::quat* src, glm::quat* dst, size_t count) {
+    static auto f = cpuSupportsAVX2() ? batchNormalizeQuats_AVX2 : batchNormalizeQuats_ref;
+    (*f)(src, dst, count);  // dispatch
+}
+
+#else
+
+void batchTransformPoints(const glm::mat4& m, const glm::vec3* src, glm::vec4* dst, size_t count) {
+    batchTransformPoints_ref(m, src, dst, count);
+}
+
+void batchTransformVecs(const glm::mat4& m, const glm::vec4* src, glm::vec4* dst, size_t count) {
+    batchTransformVecs_ref(m, src, dst, count);
+}
+
+void batchNormalizeQuats(const glm::quat* src, glm::quat* dst, size_t count) {
+    batchNormalizeQuats_ref(src, dst, count);
+}
+
+#endif
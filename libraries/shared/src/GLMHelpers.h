@@ -12,6 +12,7 @@
 #ifndef hifi_GLMHelpers_h
 #define hifi_GLMHelpers_h
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <glm/glm.hpp>
@@ -107,6 +108,11 @@ int unpackOrientationQuatFromBytes(const unsigned char* buffer, glm::quat& quatO
 int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatInput);
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput);
 
+// batch variant of packOrientationQuatToSixBytes: packs count quaternions into
+// 6 contiguous bytes each, quantizing four at a time on x86. Identical wire format.
+// returns the number of bytes written (6 * count).
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quats, int count);
+
 // Ratios need the be highly accurate when less than 10, but not very accurate above 10, and they
 // are never greater than 1000 to 1, this allows us to encode each component in 16bits
 int packFloatRatioToTwoByte(unsigned char* buffer, float ratio);
@@ -230,6 +236,21 @@ glm::vec3 transformPoint(const glm::mat4& m, const glm::vec3& p);
 glm::vec3 transformVectorFast(const glm::mat4& m, const glm::vec3& v);
 glm::vec3 transformVectorFull(const glm::mat4& m, const glm::vec3& v);
 
+//
+// Batched forms of the transform math that shows up in hot loops (octree cube projections,
+// avatar joint processing, culling). Runtime-dispatched to AVX2 kernels on capable CPUs
+// (see avx2/GLMHelpers_avx2.cpp), with scalar fallbacks everywhere else.
+//
+
+// dst[i] = m * vec4(src[i], 1.0), without the perspective divide
+void batchTransformPoints(const glm::mat4& m, const glm::vec3* src, glm::vec4* dst, size_t count);
+
+// dst[i] = m * src[i]
+void batchTransformVecs(const glm::mat4& m, const glm::vec4* src, glm::vec4* dst, size_t count);
+
+// dst[i] = normalize(src[i]); src and dst may alias
+void batchNormalizeQuats(const glm::quat* src, glm::quat* dst, size_t count);
+
 // Calculate an orthogonal basis from a primary and secondary axis.
 // The uAxis, vAxis & wAxis will form an orthognal basis.
 // The primary axis will be the uAxis.
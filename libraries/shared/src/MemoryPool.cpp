@@ -0,0 +1,145 @@
+//
+//  MemoryPool.cpp
+//  libraries/shared/src
+//
+//  Created by Clément Brisset on 2017-08-14.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MemoryPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+// process-wide pool registry, behind its own mutex so pool operations never contend with stats reads
+static std::mutex _poolRegistryMutex;
+static std::vector<MemoryPool*>& poolRegistry() {
+    static std::vector<MemoryPool*> registry;
+    return registry;
+}
+
+MemoryPool::MemoryPool(const char* name, size_t blockSize, size_t blocksPerSlab) :
+    _name(name),
+    _blockSize(blockSize),
+    _blocksPerSlab(blocksPerSlab)
+{
+    // blocks double as free-list nodes and must satisfy any type's alignment
+    const size_t MIN_BLOCK_SIZE = sizeof(FreeBlock);
+    const size_t ALIGNMENT = alignof(std::max_align_t);
+    _blockSize = std::max(_blockSize, MIN_BLOCK_SIZE);
+    _blockSize = (_blockSize + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+    std::lock_guard<std::mutex> registryLock(_poolRegistryMutex);
+    poolRegistry().push_back(this);
+}
+
+MemoryPool::~MemoryPool() {
+    {
+        std::lock_guard<std::mutex> registryLock(_poolRegistryMutex);
+        auto& registry = poolRegistry();
+        registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    assert(_blocksInUse == 0);
+    for (auto slab : _slabs) {
+        delete[] slab;
+    }
+}
+
+void MemoryPool::addSlab() {
+    // slabs from new char[] are aligned for max_align_t, and the block size is rounded
+    // up to that alignment in the constructor, so every block is suitably aligned
+    char* slab = new char[_blockSize * _blocksPerSlab];
+    _slabs.push_back(slab);
+
+    for (size_t i = 0; i < _blocksPerSlab; i++) {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * _blockSize);
+        block->next = _freeList;
+        _freeList = block;
+    }
+}
+
+void* MemoryPool::allocate() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_freeList) {
+        addSlab();
+    }
+
+    FreeBlock* block = _freeList;
+    _freeList = block->next;
+
+    ++_blocksInUse;
+    _highWaterMark = std::max(_highWaterMark, _blocksInUse);
+
+    return block;
+}
+
+void MemoryPool::release(void* block) {
+    if (!block) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    FreeBlock* freeBlock = reinterpret_cast<FreeBlock*>(block);
+    freeBlock->next = _freeList;
+    _freeList = freeBlock;
+
+    --_blocksInUse;
+}
+
+MemoryPool::Stats MemoryPool::getStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return { _name, _blockSize, _slabs.size() * _blocksPerSlab, _blocksInUse, _highWaterMark };
+}
+
+std::vector<MemoryPool::Stats> MemoryPool::getAllStats() {
+    std::lock_guard<std::mutex> registryLock(_poolRegistryMutex);
+    std::vector<Stats> allStats;
+    allStats.reserve(poolRegistry().size());
+    for (auto pool : poolRegistry()) {
+        allStats.push_back(pool->getStats());
+    }
+    return allStats;
+}
+
+ThreadLocalArena& ThreadLocalArena::current() {
+    // deliberately leaked, like the tracing zone rings: scratch chunks are small, per-thread,
+    // and keeping them alive means reset()/allocate() never race thread teardown
+    static thread_local ThreadLocalArena* arena = nullptr;
+    if (!arena) {
+        arena = new ThreadLocalArena();
+    }
+    return *arena;
+}
+
+void* ThreadLocalArena::allocate(size_t bytes, size_t alignment) {
+    _offset = (_offset + alignment - 1) & ~(alignment - 1);
+
+    // advance until a chunk fits; a fresh chunk is sized to fit even oversized requests,
+    // so this always terminates
+    while (_chunks.empty() || _offset + bytes > _chunks[_currentChunk].size) {
+        if (_chunks.empty() || ++_currentChunk == _chunks.size()) {
+            size_t chunkSize = std::max(bytes, DEFAULT_CHUNK_SIZE);
+            _chunks.push_back({ new char[chunkSize], chunkSize });
+            _currentChunk = _chunks.size() - 1;
+        }
+        _offset = 0;
+    }
+
+    void* result = _chunks[_currentChunk].data + _offset;
+    _offset += bytes;
+    _bytesUsed += bytes;
+    return result;
+}
+
+void ThreadLocalArena::reset() {
+    _currentChunk = 0;
+    _offset = 0;
+    _bytesUsed = 0;
+}
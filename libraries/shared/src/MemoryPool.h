@@ -0,0 +1,157 @@
+//
+//  MemoryPool.h
+//  libraries/shared/src
+//
+//  Created by Clément Brisset on 2017-08-14.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MemoryPool_h
+#define hifi_MemoryPool_h
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/// A thread-safe pool of fixed-size memory blocks, intended for objects that are created and
+/// destroyed at high rates (packets, per-frame scratch objects). Blocks are carved out of slabs
+/// that are never returned to the system while the pool lives, so a steady-state workload stops
+/// touching the general-purpose heap entirely.
+///
+/// Every pool registers itself by name ("subsystem.Type") so live occupancy can be inspected
+/// through MemoryPool::getAllStats().
+class MemoryPool {
+public:
+    static const size_t DEFAULT_BLOCKS_PER_SLAB = 64;
+
+    struct Stats {
+        const char* name;       // "subsystem.Type", set at construction
+        size_t blockSize;       // bytes per block, after alignment rounding
+        size_t blocksAllocated; // total blocks backed by slabs
+        size_t blocksInUse;     // blocks currently handed out
+        size_t highWaterMark;   // most blocks ever simultaneously in use
+    };
+
+    MemoryPool(const char* name, size_t blockSize, size_t blocksPerSlab = DEFAULT_BLOCKS_PER_SLAB);
+    ~MemoryPool();
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    /// returns one block of blockSize bytes, growing the pool by a slab if the free list is empty
+    void* allocate();
+
+    /// returns a block previously obtained from allocate() to the free list
+    void release(void* block);
+
+    size_t getBlockSize() const { return _blockSize; }
+
+    Stats getStats() const;
+
+    /// stats for every live pool in the process, for the stats surface
+    static std::vector<Stats> getAllStats();
+
+private:
+    void addSlab();
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    const char* _name;
+    size_t _blockSize;
+    size_t _blocksPerSlab;
+
+    FreeBlock* _freeList { nullptr };
+    std::vector<char*> _slabs;
+    size_t _blocksInUse { 0 };
+    size_t _highWaterMark { 0 };
+
+    mutable std::mutex _mutex;
+};
+
+/// A per-thread bump allocator for scratch memory whose lifetime is bounded by a frame (or any
+/// other unit of work). allocate() is a pointer increment; there is no per-allocation free - the
+/// owner of the work unit calls reset() at the boundary and every outstanding pointer becomes
+/// invalid at once. Memory acquired from the system is kept for the life of the thread.
+class ThreadLocalArena {
+public:
+    static const size_t DEFAULT_CHUNK_SIZE = 256 * 1024;
+
+    /// the calling thread's arena, created on first use
+    static ThreadLocalArena& current();
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    /// marks everything allocated since the last reset as free; called at the frame boundary
+    void reset();
+
+    size_t getBytesUsed() const { return _bytesUsed; }
+
+private:
+    ThreadLocalArena() {}
+
+    struct Chunk {
+        char* data;
+        size_t size;
+    };
+
+    std::vector<Chunk> _chunks;
+    size_t _currentChunk { 0 };
+    size_t _offset { 0 };
+    size_t _bytesUsed { 0 };
+};
+
+/// Drop-in STL allocator backed by a MemoryPool. Single-element allocations come from the pool;
+/// anything larger than a block (bulk container growth) falls back to the heap, so it is safe
+/// for any container but pays off for node-based ones (std::list, std::map) and small_vectors.
+template <typename T>
+class PoolSTLAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = PoolSTLAllocator<U>;
+    };
+
+    PoolSTLAllocator(MemoryPool* pool) : _pool(pool) {}
+    template <typename U>
+    PoolSTLAllocator(const PoolSTLAllocator<U>& other) : _pool(other.getPool()) {}
+
+    T* allocate(size_t n) {
+        if (n * sizeof(T) <= _pool->getBlockSize()) {
+            return static_cast<T*>(_pool->allocate());
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (n * sizeof(T) <= _pool->getBlockSize()) {
+            _pool->release(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    MemoryPool* getPool() const { return _pool; }
+
+private:
+    MemoryPool* _pool;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolSTLAllocator<T>& a, const PoolSTLAllocator<U>& b) {
+    return a.getPool() == b.getPool();
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolSTLAllocator<T>& a, const PoolSTLAllocator<U>& b) {
+    return !(a == b);
+}
+
+#endif // hifi_MemoryPool_h
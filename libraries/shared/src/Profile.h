@@ -87,6 +87,16 @@ inline void metadata(const QString& metadataType, const QVariantMap& args) {
 #define PROFILE_INSTANT(category, name, ...) instant(trace_##category(), name, ##__VA_ARGS__);
 #define PROFILE_SET_THREAD_NAME(threadName) metadata("thread_name", { { "name", threadName } });
 
+// Always-on scoped zones (see Trace.h). Unlike PROFILE_RANGE these don't consult the logging
+// category or build a QString per hit -- the name is hashed at compile time, registration
+// happens once through the local static, and each hit writes one slot into a per-thread ring.
+// Safe to leave in production hot paths; the events appear in trace captures as 'X' events.
+#define PROFILE_ZONE_CONCAT2(a, b) a##b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT2(a, b)
+#define PROFILE_ZONE(category, name) \
+    static const tracing::ZoneInfo PROFILE_ZONE_CONCAT(profileZoneInfo, __LINE__) { name, "trace." #category, tracing::zoneId(name) }; \
+    tracing::ScopedZone PROFILE_ZONE_CONCAT(profileZoneThis, __LINE__) { &PROFILE_ZONE_CONCAT(profileZoneInfo, __LINE__) };
+
 #define SAMPLE_PROFILE_RANGE(chance, category, name, ...) if (randFloat() <= chance) { PROFILE_RANGE(category, name); }
 #define SAMPLE_PROFILE_RANGE_EX(chance, category, name, ...) if (randFloat() <= chance) { PROFILE_RANGE_EX(category, name, argbColor, payload, ##__VA_ARGS__); }
 #define SAMPLE_PROFILE_COUNTER(chance, category, name, ...) if (randFloat() <= chance) { PROFILE_COUNTER(category, name, ##__VA_ARGS__); }
@@ -126,6 +126,7 @@ public:
     glm::vec3 direction;
 };
 Q_DECLARE_METATYPE(PickRay)
+Q_DECLARE_METATYPE(QVector<PickRay>)
 QScriptValue pickRayToScriptValue(QScriptEngine* engine, const PickRay& pickRay);
 void pickRayFromScriptValue(const QScriptValue& object, PickRay& pickRay);
 
@@ -0,0 +1,186 @@
+//
+//  ResourceGovernor.cpp
+//  libraries/shared/src
+//
+//  Created by Ryan Huffman on 2017-04-12
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ResourceGovernor.h"
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+#ifdef Q_OS_MAC
+#include <mach/mach.h>
+#endif
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#include <QtCore/QFile>
+#endif
+
+#include "NumericalConstants.h"
+#include "SharedLogging.h"
+#include "SharedUtil.h"
+
+static const int SAMPLE_INTERVAL_MSECS = 1000;
+
+ResourceGovernor::ResourceGovernor() {
+    // a flat budget for whatever assignment this process ends up hosting
+    QByteArray flatBudget = qgetenv("HIFI_ASSIGNMENT_CPU_BUDGET_PERCENT");
+    if (!flatBudget.isEmpty()) {
+        bool ok = false;
+        float percent = flatBudget.toFloat(&ok);
+        if (ok && percent > 0.0f) {
+            _cpuBudgetCores = percent / 100.0f;
+        }
+    }
+
+    // per-type overrides, applied once we know our assignment type - the monitor's
+    // children all inherit the same environment, so this is how an operator gives the
+    // audio mixer more headroom than the entity server on the same box
+    QString typeBudgets = QString::fromLocal8Bit(qgetenv("HIFI_ASSIGNMENT_CPU_BUDGETS"));
+    for (const QString& entry : typeBudgets.split(',', QString::SkipEmptyParts)) {
+        QStringList typeAndPercent = entry.split('=');
+        bool ok = false;
+        float percent = (typeAndPercent.size() == 2) ? typeAndPercent[1].toFloat(&ok) : 0.0f;
+        if (ok && percent > 0.0f) {
+            _perTypeCPUBudgets.insert(typeAndPercent[0].trimmed(), percent / 100.0f);
+        } else {
+            qCDebug(shared) << "ResourceGovernor ignoring malformed CPU budget entry" << entry;
+        }
+    }
+
+    // seed the counters so the first real sample has a baseline
+    _lastSampleTimestamp = usecTimestampNow();
+    _lastCPUTimeUsecs = getProcessCPUTimeUsecs();
+
+    connect(&_sampleTimer, &QTimer::timeout, this, &ResourceGovernor::sample);
+    _sampleTimer.setInterval(SAMPLE_INTERVAL_MSECS); // Qt::CoarseTimer acceptable
+    _sampleTimer.start();
+}
+
+void ResourceGovernor::setAssignmentTypeName(const QString& typeName) {
+    _assignmentTypeName = typeName;
+
+    auto it = _perTypeCPUBudgets.constFind(typeName);
+    if (it != _perTypeCPUBudgets.constEnd()) {
+        _cpuBudgetCores = it.value();
+    }
+
+    if (_cpuBudgetCores > 0.0f) {
+        qCDebug(shared) << "ResourceGovernor enforcing a CPU budget of"
+            << _cpuBudgetCores * 100.0f << "percent of one core for" << typeName;
+    }
+}
+
+void ResourceGovernor::sample() {
+    quint64 now = usecTimestampNow();
+    quint64 cpuTimeUsecs = getProcessCPUTimeUsecs();
+
+    if (now > _lastSampleTimestamp) {
+        float intervalUsage = (float)(cpuTimeUsecs - _lastCPUTimeUsecs) / (float)(now - _lastSampleTimestamp);
+
+        // smooth over a few samples so one expensive second does not flap the throttle
+        const float CURRENT_SAMPLE_RATIO = 0.25f;
+        _cpuUsageCores = (1.0f - CURRENT_SAMPLE_RATIO) * _cpuUsageCores + CURRENT_SAMPLE_RATIO * intervalUsage;
+
+        float budget = _cpuBudgetCores;
+        _overCPUBudget = (budget > 0.0f && _cpuUsageCores > budget);
+    }
+
+    _lastSampleTimestamp = now;
+    _lastCPUTimeUsecs = cpuTimeUsecs;
+
+    quint64 rssBytes = getProcessRSSBytes();
+    if (rssBytes > 0) {
+        _rssBytes = rssBytes;
+        if (rssBytes > _rssHighWaterBytes) {
+            _rssHighWaterBytes = rssBytes;
+        }
+    }
+}
+
+QJsonObject ResourceGovernor::getStatsObject() const {
+    QJsonObject statsObject;
+
+    statsObject["assignment_type"] = _assignmentTypeName;
+    statsObject["cpu_budget_cores"] = (double)_cpuBudgetCores;
+    statsObject["cpu_usage_cores"] = (double)_cpuUsageCores;
+    statsObject["over_cpu_budget"] = isOverCPUBudget();
+    statsObject["rss_bytes"] = (double)_rssBytes;
+    statsObject["rss_high_water_bytes"] = (double)_rssHighWaterBytes;
+    statsObject["times_throttled"] = (double)_timesThrottled;
+
+    return statsObject;
+}
+
+quint64 ResourceGovernor::getProcessCPUTimeUsecs() {
+#ifdef Q_OS_WIN
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+
+    // FILETIME is in 100ns ticks
+    ULARGE_INTEGER kernel, user;
+    kernel.LowPart = kernelTime.dwLowDateTime;
+    kernel.HighPart = kernelTime.dwHighDateTime;
+    user.LowPart = userTime.dwLowDateTime;
+    user.HighPart = userTime.dwHighDateTime;
+
+    return (kernel.QuadPart + user.QuadPart) / 10;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+
+    quint64 userUsecs = (quint64)usage.ru_utime.tv_sec * USECS_PER_SECOND + usage.ru_utime.tv_usec;
+    quint64 systemUsecs = (quint64)usage.ru_stime.tv_sec * USECS_PER_SECOND + usage.ru_stime.tv_usec;
+
+    return userUsecs + systemUsecs;
+#endif
+}
+
+quint64 ResourceGovernor::getProcessRSSBytes() {
+#if defined(Q_OS_WIN)
+    MemoryInfo memoryInfo;
+    if (getMemoryInfo(memoryInfo)) {
+        return memoryInfo.processUsedMemoryBytes;
+    }
+
+    return 0;
+#elif defined(Q_OS_MAC)
+    mach_task_basic_info_data_t taskInfo;
+    mach_msg_type_number_t infoCount = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&taskInfo, &infoCount) != KERN_SUCCESS) {
+        return 0;
+    }
+
+    return taskInfo.resident_size;
+#elif defined(Q_OS_LINUX)
+    // the second field of statm is the resident set, in pages
+    QFile statm("/proc/self/statm");
+    if (!statm.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+
+    QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.size() < 2) {
+        return 0;
+    }
+
+    return fields[1].toULongLong() * (quint64)sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
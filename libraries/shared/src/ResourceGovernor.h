@@ -0,0 +1,85 @@
+//
+//  ResourceGovernor.h
+//  libraries/shared/src
+//
+//  Created by Ryan Huffman on 2017-04-12
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ResourceGovernor_h
+#define hifi_ResourceGovernor_h
+
+#include <atomic>
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+#include "DependencyManager.h"
+
+/// Samples this process's CPU time and resident set size once per second and compares
+/// them against an operator-configured budget, so that several co-hosted assignment-client
+/// processes can share a box without one of them starving the others.
+///
+/// Budgets come from the environment, since the orchestrator that launches the processes
+/// is also the thing that decides how big each one is allowed to be:
+///   HIFI_ASSIGNMENT_CPU_BUDGET_PERCENT - percent of one core for this process (e.g. 150)
+///   HIFI_ASSIGNMENT_CPU_BUDGETS - per-type overrides, e.g. "audio-mixer=200,entity-server=80"
+///
+/// Enforcement is cooperative - the frame loops that can shed load poll isOverCPUBudget()
+/// and back off on their own terms. Memory is tracked (current and high-water RSS) but
+/// never enforced, since there is no graceful way to shed allocated memory.
+class ResourceGovernor : public QObject, public Dependency {
+    Q_OBJECT
+    SINGLETON_DEPENDENCY
+
+public:
+    ResourceGovernor();
+
+    /// names the assignment this process is hosting and applies any per-type budget -
+    /// call before the assignment's worker thread starts so no synchronization is needed
+    void setAssignmentTypeName(const QString& typeName);
+
+    void setCPUBudget(float cores) { _cpuBudgetCores = cores; }
+    float getCPUBudget() const { return _cpuBudgetCores; }
+
+    float getCPUUsage() const { return _cpuUsageCores; } // recent usage, in cores
+    quint64 getRSSBytes() const { return _rssBytes; }
+    quint64 getRSSHighWaterBytes() const { return _rssHighWaterBytes; }
+
+    /// cheap poll for frame loops - when true the assignment should shed load
+    bool isOverCPUBudget() const { return _overCPUBudget; }
+
+    /// called by a frame loop each time it sheds load, so the stats show enforcement
+    void noteThrottle() { ++_timesThrottled; }
+
+    QJsonObject getStatsObject() const;
+
+private slots:
+    void sample();
+
+private:
+    static quint64 getProcessCPUTimeUsecs();
+    static quint64 getProcessRSSBytes();
+
+    QTimer _sampleTimer;
+    QString _assignmentTypeName { "unknown" };
+    QHash<QString, float> _perTypeCPUBudgets;
+
+    std::atomic<float> _cpuBudgetCores { 0.0f }; // 0 is unlimited
+    std::atomic<float> _cpuUsageCores { 0.0f };
+    std::atomic<bool> _overCPUBudget { false };
+    std::atomic<quint64> _rssBytes { 0 };
+    std::atomic<quint64> _rssHighWaterBytes { 0 };
+    std::atomic<quint64> _timesThrottled { 0 };
+
+    quint64 _lastSampleTimestamp { 0 };
+    quint64 _lastCPUTimeUsecs { 0 };
+};
+
+#endif // hifi_ResourceGovernor_h
@@ -19,6 +19,80 @@
 const float defaultAACubeSize = 1.0f;
 const int maxParentingChain = 30;
 
+std::atomic<uint64_t> SpatiallyNestable::_worldTransformStamp { 1 };
+
+Transform SpatiallyNestable::readLocalTransform() const {
+    // lock-free seqlock read: copy the transform, then make sure no writer was active
+    // before or during the copy, otherwise retry
+    Transform result;
+    uint32_t generation = _transformGeneration.load(std::memory_order_acquire);
+    while (true) {
+        if (!(generation & 1)) {
+            result = _transform;
+            uint32_t check = _transformGeneration.load(std::memory_order_acquire);
+            if (check == generation) {
+                return result;
+            }
+            generation = check;
+        } else {
+            generation = _transformGeneration.load(std::memory_order_acquire);
+        }
+    }
+}
+
+void SpatiallyNestable::modifyLocalTransform(const std::function<bool(Transform&)>& mutator) {
+    _transformLock.withWriteLock([&] {
+        _transformGeneration.fetch_add(1, std::memory_order_acq_rel); // odd: write in progress
+        bool changed = mutator(_transform);
+        _transformGeneration.fetch_add(1, std::memory_order_release); // even again
+        if (changed) {
+            // every cached world transform anywhere may now be stale
+            _worldTransformStamp.fetch_add(1, std::memory_order_acq_rel);
+        }
+    });
+}
+
+bool SpatiallyNestable::readWorldTransformCache(uint64_t stamp, Transform& result) const {
+    uint32_t generation = _worldCacheGeneration.load(std::memory_order_acquire);
+    if (generation & 1) {
+        return false;
+    }
+    uint64_t cachedStamp = _worldTransformCacheStamp;
+    Transform cached = _worldTransformCache;
+    if (_worldCacheGeneration.load(std::memory_order_acquire) != generation || cachedStamp != stamp) {
+        return false;
+    }
+    result = cached;
+    return true;
+}
+
+void SpatiallyNestable::writeWorldTransformCache(uint64_t stamp, const Transform& transform) const {
+    // competing writers would be storing the same answer for the same stamp, so losing
+    // this race just means recomputing once more on the next query
+    uint32_t generation = _worldCacheGeneration.load(std::memory_order_relaxed);
+    if ((generation & 1) ||
+        !_worldCacheGeneration.compare_exchange_strong(generation, generation + 1, std::memory_order_acq_rel)) {
+        return;
+    }
+    _worldTransformCacheStamp = stamp;
+    _worldTransformCache = transform;
+    _worldCacheGeneration.store(generation + 2, std::memory_order_release);
+}
+
+bool SpatiallyNestable::isWorldTransformCacheable() const {
+    // a transform hanging off a parent's joint can change whenever the parent's skeleton
+    // animates, which the change stamp doesn't see -- never cache anywhere in such a chain
+    if (_parentJointIndex != INVALID_JOINT_INDEX) {
+        return false;
+    }
+    bool success = false;
+    SpatiallyNestablePointer parent = getParentPointer(success);
+    if (!success) {
+        return false;
+    }
+    return !parent || parent->isWorldTransformCacheable();
+}
+
 SpatiallyNestable::SpatiallyNestable(NestableType nestableType, QUuid id) :
     _nestableType(nestableType),
     _id(id),
@@ -64,12 +138,17 @@ const QUuid SpatiallyNestable::getParentID() const {
 }
 
 void SpatiallyNestable::setParentID(const QUuid& parentID) {
+    bool changed = false;
     _idLock.withWriteLock([&] {
         if (_parentID != parentID) {
             _parentID = parentID;
             _parentKnowsMe = false;
+            changed = true;
         }
     });
+    if (changed) {
+        _worldTransformStamp.fetch_add(1, std::memory_order_acq_rel);
+    }
 
     bool success = false;
     getParentPointer(success);
@@ -149,7 +228,10 @@ void SpatiallyNestable::forgetChild(SpatiallyNestablePointer newChild) const {
 }
 
 void SpatiallyNestable::setParentJointIndex(quint16 parentJointIndex) {
-    _parentJointIndex = parentJointIndex;
+    if (_parentJointIndex != parentJointIndex) {
+        _parentJointIndex = parentJointIndex;
+        _worldTransformStamp.fetch_add(1, std::memory_order_acq_rel);
+    }
 }
 
 glm::vec3 SpatiallyNestable::worldToLocal(const glm::vec3& position,
@@ -399,14 +481,15 @@ void SpatiallyNestable::setPosition(const glm::vec3& position, bool& success, bo
     bool changed = false;
     Transform parentTransform = getParentTransform(success);
     Transform myWorldTransform;
-    _transformLock.withWriteLock([&] {
-        Transform::mult(myWorldTransform, parentTransform, _transform);
+    modifyLocalTransform([&](Transform& transform) {
+        Transform::mult(myWorldTransform, parentTransform, transform);
         if (myWorldTransform.getTranslation() != position) {
             changed = true;
             myWorldTransform.setTranslation(position);
-            Transform::inverseMult(_transform, parentTransform, myWorldTransform);
+            Transform::inverseMult(transform, parentTransform, myWorldTransform);
             _translationChanged = usecTimestampNow();
         }
+        return changed;
     });
     if (success && changed) {
         locationChanged(tellPhysics);
@@ -452,14 +535,15 @@ void SpatiallyNestable::setOrientation(const glm::quat& orientation, bool& succe
     bool changed = false;
     Transform parentTransform = getParentTransform(success);
     Transform myWorldTransform;
-    _transformLock.withWriteLock([&] {
-        Transform::mult(myWorldTransform, parentTransform, _transform);
+    modifyLocalTransform([&](Transform& transform) {
+        Transform::mult(myWorldTransform, parentTransform, transform);
         if (myWorldTransform.getRotation() != orientation) {
             changed = true;
             myWorldTransform.setRotation(orientation);
-            Transform::inverseMult(_transform, parentTransform, myWorldTransform);
+            Transform::inverseMult(transform, parentTransform, myWorldTransform);
             _rotationChanged = usecTimestampNow();
         }
+        return changed;
     });
     if (success && changed) {
         locationChanged(tellPhysics);
@@ -476,6 +560,41 @@ void SpatiallyNestable::setOrientation(const glm::quat& orientation) {
     #endif
 }
 
+void SpatiallyNestable::setPositionAndOrientation(const glm::vec3& position, const glm::quat& orientation,
+                                                  bool& success, bool tellPhysics) {
+    // guard against introducing NaN into the transform
+    if (isNaN(position) || isNaN(orientation)) {
+        success = false;
+        return;
+    }
+
+    bool changed = false;
+    Transform parentTransform = getParentTransform(success);
+    Transform myWorldTransform;
+    modifyLocalTransform([&](Transform& transform) {
+        Transform::mult(myWorldTransform, parentTransform, transform);
+        bool translationChanged = myWorldTransform.getTranslation() != position;
+        bool rotationChanged = myWorldTransform.getRotation() != orientation;
+        if (translationChanged || rotationChanged) {
+            changed = true;
+            quint64 now = usecTimestampNow();
+            if (translationChanged) {
+                myWorldTransform.setTranslation(position);
+                _translationChanged = now;
+            }
+            if (rotationChanged) {
+                myWorldTransform.setRotation(orientation);
+                _rotationChanged = now;
+            }
+            Transform::inverseMult(transform, parentTransform, myWorldTransform);
+        }
+        return changed;
+    });
+    if (success && changed) {
+        locationChanged(tellPhysics);
+    }
+}
+
 glm::vec3 SpatiallyNestable::getVelocity(bool& success) const {
     glm::vec3 result;
     Transform parentTransform = getParentTransform(success);
@@ -595,12 +714,22 @@ glm::vec3 SpatiallyNestable::getParentAngularVelocity(bool& success) const {
 }
 
 const Transform SpatiallyNestable::getTransform(bool& success, int depth) const {
+    // if nothing in the world has changed since the last computation, the cached answer
+    // still holds; a deep parent chain is therefore walked once per change (each ancestor
+    // caching its own result on the way down), not once per query
+    uint64_t stamp = _worldTransformStamp.load(std::memory_order_acquire);
     Transform result;
+    if (readWorldTransformCache(stamp, result)) {
+        success = true;
+        return result;
+    }
+
     // return a world-space transform for this object's location
     Transform parentTransform = getParentTransform(success, depth);
-    _transformLock.withReadLock([&] {
-        Transform::mult(result, parentTransform, _transform);
-    });
+    Transform::mult(result, parentTransform, readLocalTransform());
+    if (success && isWorldTransformCacheable()) {
+        writeWorldTransformCache(stamp, result);
+    }
     return result;
 }
 
@@ -652,14 +781,15 @@ void SpatiallyNestable::setTransform(const Transform& transform, bool& success)
 
     bool changed = false;
     Transform parentTransform = getParentTransform(success);
-    _transformLock.withWriteLock([&] {
-        Transform beforeTransform = _transform;
-        Transform::inverseMult(_transform, parentTransform, transform);
-        if (_transform != beforeTransform) {
+    modifyLocalTransform([&](Transform& localTransform) {
+        Transform beforeTransform = localTransform;
+        Transform::inverseMult(localTransform, parentTransform, transform);
+        if (localTransform != beforeTransform) {
             changed = true;
             _translationChanged = usecTimestampNow();
             _rotationChanged = usecTimestampNow();
         }
+        return changed;
     });
     if (success && changed) {
         locationChanged();
@@ -674,11 +804,7 @@ bool SpatiallyNestable::setTransform(const Transform& transform) {
 
 glm::vec3 SpatiallyNestable::getScale() const {
     // TODO: scale
-    glm::vec3 result;
-    _transformLock.withReadLock([&] {
-        result = _transform.getScale();
-    });
-    return result;
+    return readLocalTransform().getScale();
 }
 
 glm::vec3 SpatiallyNestable::getScale(int jointIndex) const {
@@ -695,12 +821,13 @@ void SpatiallyNestable::setScale(const glm::vec3& scale) {
 
     bool changed = false;
     // TODO: scale
-    _transformLock.withWriteLock([&] {
-        if (_transform.getScale() != scale) {
-            _transform.setScale(scale);
+    modifyLocalTransform([&](Transform& transform) {
+        if (transform.getScale() != scale) {
+            transform.setScale(scale);
             changed = true;
             _scaleChanged = usecTimestampNow();
         }
+        return changed;
     });
     if (changed) {
         dimensionsChanged();
@@ -716,13 +843,14 @@ void SpatiallyNestable::setScale(float value) {
 
     bool changed = false;
     // TODO: scale
-    _transformLock.withWriteLock([&] {
-        glm::vec3 beforeScale = _transform.getScale();
-        _transform.setScale(value);
-        if (_transform.getScale() != beforeScale) {
+    modifyLocalTransform([&](Transform& transform) {
+        glm::vec3 beforeScale = transform.getScale();
+        transform.setScale(value);
+        if (transform.getScale() != beforeScale) {
             changed = true;
             _scaleChanged = usecTimestampNow();
         }
+        return changed;
     });
 
     if (changed) {
@@ -731,11 +859,7 @@ void SpatiallyNestable::setScale(float value) {
 }
 
 const Transform SpatiallyNestable::getLocalTransform() const {
-    Transform result;
-    _transformLock.withReadLock([&] {
-        result =_transform;
-    });
-    return result;
+    return readLocalTransform();
 }
 
 void SpatiallyNestable::setLocalTransform(const Transform& transform) {
@@ -746,14 +870,15 @@ void SpatiallyNestable::setLocalTransform(const Transform& transform) {
     }
 
     bool changed = false;
-    _transformLock.withWriteLock([&] {
-        if (_transform != transform) {
-            _transform = transform;
+    modifyLocalTransform([&](Transform& localTransform) {
+        if (localTransform != transform) {
+            localTransform = transform;
             changed = true;
             _scaleChanged = usecTimestampNow();
             _translationChanged = usecTimestampNow();
             _rotationChanged = usecTimestampNow();
         }
+        return changed;
     });
 
     if (changed) {
@@ -762,11 +887,7 @@ void SpatiallyNestable::setLocalTransform(const Transform& transform) {
 }
 
 glm::vec3 SpatiallyNestable::getLocalPosition() const {
-    glm::vec3 result;
-    _transformLock.withReadLock([&] {
-        result = _transform.getTranslation();
-    });
-    return result;
+    return readLocalTransform().getTranslation();
 }
 
 void SpatiallyNestable::setLocalPosition(const glm::vec3& position, bool tellPhysics) {
@@ -776,12 +897,13 @@ void SpatiallyNestable::setLocalPosition(const glm::vec3& position, bool tellPhy
         return;
     }
     bool changed = false;
-    _transformLock.withWriteLock([&] {
-        if (_transform.getTranslation() != position) {
-            _transform.setTranslation(position);
+    modifyLocalTransform([&](Transform& transform) {
+        if (transform.getTranslation() != position) {
+            transform.setTranslation(position);
             changed = true;
             _translationChanged = usecTimestampNow();
         }
+        return changed;
     });
     if (changed) {
         locationChanged(tellPhysics);
@@ -789,11 +911,7 @@ void SpatiallyNestable::setLocalPosition(const glm::vec3& position, bool tellPhy
 }
 
 glm::quat SpatiallyNestable::getLocalOrientation() const {
-    glm::quat result;
-    _transformLock.withReadLock([&] {
-        result = _transform.getRotation();
-    });
-    return result;
+    return readLocalTransform().getRotation();
 }
 
 void SpatiallyNestable::setLocalOrientation(const glm::quat& orientation) {
@@ -803,12 +921,13 @@ void SpatiallyNestable::setLocalOrientation(const glm::quat& orientation) {
         return;
     }
     bool changed = false;
-    _transformLock.withWriteLock([&] {
-        if (_transform.getRotation() != orientation) {
-            _transform.setRotation(orientation);
+    modifyLocalTransform([&](Transform& transform) {
+        if (transform.getRotation() != orientation) {
+            transform.setRotation(orientation);
             changed = true;
             _rotationChanged = usecTimestampNow();
         }
+        return changed;
     });
     if (changed) {
         locationChanged();
@@ -845,11 +964,7 @@ void SpatiallyNestable::setLocalAngularVelocity(const glm::vec3& angularVelocity
 
 glm::vec3 SpatiallyNestable::getLocalScale() const {
     // TODO: scale
-    glm::vec3 result;
-    _transformLock.withReadLock([&] {
-        result = _transform.getScale();
-    });
-    return result;
+    return readLocalTransform().getScale();
 }
 
 void SpatiallyNestable::setLocalScale(const glm::vec3& scale) {
@@ -861,12 +976,13 @@ void SpatiallyNestable::setLocalScale(const glm::vec3& scale) {
 
     bool changed = false;
     // TODO: scale
-    _transformLock.withWriteLock([&] {
-        if (_transform.getScale() != scale) {
-            _transform.setScale(scale);
+    modifyLocalTransform([&](Transform& transform) {
+        if (transform.getScale() != scale) {
+            transform.setScale(scale);
             changed = true;
             _scaleChanged = usecTimestampNow();
         }
+        return changed;
     });
     if (changed) {
         dimensionsChanged();
@@ -1083,9 +1199,7 @@ void SpatiallyNestable::getLocalTransformAndVelocities(
         glm::vec3& velocity,
         glm::vec3& angularVelocity) const {
     // transform
-    _transformLock.withReadLock([&] {
-        transform = _transform;
-    });
+    transform = readLocalTransform();
     // linear velocity
     _velocityLock.withReadLock([&] {
         velocity = _velocity;
@@ -1104,14 +1218,15 @@ void SpatiallyNestable::setLocalTransformAndVelocities(
     bool changed = false;
 
     // transform
-    _transformLock.withWriteLock([&] {
-        if (_transform != localTransform) {
-            _transform = localTransform;
+    modifyLocalTransform([&](Transform& transform) {
+        if (transform != localTransform) {
+            transform = localTransform;
             changed = true;
             _scaleChanged = usecTimestampNow();
             _translationChanged = usecTimestampNow();
             _rotationChanged = usecTimestampNow();
         }
+        return changed;
     });
     // linear velocity
     _velocityLock.withWriteLock([&] {
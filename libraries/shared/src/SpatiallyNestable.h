@@ -12,6 +12,8 @@
 #ifndef hifi_SpatiallyNestable_h
 #define hifi_SpatiallyNestable_h
 
+#include <atomic>
+
 #include <QUuid>
 
 #include "Transform.h"
@@ -81,6 +83,11 @@ public:
     virtual void setOrientation(const glm::quat& orientation, bool& success, bool tellPhysics = true);
     virtual void setOrientation(const glm::quat& orientation);
 
+    // set both at once with one parent lookup, one transform write and one locationChanged --
+    // used by the physics simulation when copying results out for many objects in a row
+    virtual void setPositionAndOrientation(const glm::vec3& position, const glm::quat& orientation,
+                                           bool& success, bool tellPhysics = true);
+
     // these are here because some older code uses rotation rather than orientation
     virtual const glm::quat getRotation() const { return getOrientation(); }
     virtual void setRotation(glm::quat orientation) { setOrientation(orientation); }
@@ -211,11 +218,27 @@ private:
     QUuid _parentID; // what is this thing's transform relative to?
     quint16 _parentJointIndex { INVALID_JOINT_INDEX }; // which joint of the parent is this relative to?
 
-    mutable ReadWriteLockable _transformLock;
+    mutable ReadWriteLockable _transformLock; // serializes _transform writers; readers go through the seqlock below
     mutable ReadWriteLockable _idLock;
     mutable ReadWriteLockable _velocityLock;
     mutable ReadWriteLockable _angularVelocityLock;
     Transform _transform; // this is to be combined with parent's world-transform to produce this' world-transform.
+
+    // Generation-stamped snapshots of _transform and of the computed world transform. Readers
+    // copy without taking a lock and retry if they raced a writer, so the physics, render and
+    // script threads never block each other on transform queries.
+    mutable std::atomic<uint32_t> _transformGeneration { 0 };
+    mutable std::atomic<uint32_t> _worldCacheGeneration { 0 };
+    mutable Transform _worldTransformCache;
+    mutable uint64_t _worldTransformCacheStamp { 0 };
+    static std::atomic<uint64_t> _worldTransformStamp; // bumped on any transform or parenting change, anywhere
+
+    Transform readLocalTransform() const;
+    void modifyLocalTransform(const std::function<bool(Transform&)>& mutator); // mutator returns whether it changed anything
+    bool readWorldTransformCache(uint64_t stamp, Transform& result) const;
+    void writeWorldTransformCache(uint64_t stamp, const Transform& transform) const;
+    bool isWorldTransformCacheable() const;
+
     glm::vec3 _velocity;
     glm::vec3 _angularVelocity;
     mutable bool _parentKnowsMe { false };
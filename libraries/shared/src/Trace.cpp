@@ -8,7 +8,9 @@
 
 #include "Trace.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 
 #include <QtCore/QDebug>
 #include <QtCore/QCoreApplication>
@@ -36,7 +38,66 @@
 using namespace tracing;
 
 bool tracing::enabled() {
-    return DependencyManager::get<Tracer>()->isEnabled();
+    auto tracer = DependencyManager::getUnsafe<Tracer>();
+    return tracer && tracer->isEnabled();
+}
+
+uint64_t tracing::zoneClockNsecs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        p_high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// the registries are mutex-guarded, but they're only touched on a zone's first registration
+// and a thread's first recorded zone -- never on the per-event hot path
+static std::mutex _zoneRegistryMutex;
+static QHash<uint32_t, const ZoneInfo*> _zoneRegistry;
+static std::vector<ZoneRing*> _zoneRings;
+
+ZoneInfo::ZoneInfo(const char* name, const char* category, uint32_t id) :
+    name(name), category(category), id(id) {
+    std::lock_guard<std::mutex> guard(_zoneRegistryMutex);
+    auto itr = _zoneRegistry.find(id);
+    if (itr != _zoneRegistry.end()) {
+        if (strcmp(itr.value()->name, name) != 0) {
+            qWarning() << "Zone ID collision between" << name << "and" << itr.value()->name;
+        }
+        return;
+    }
+    _zoneRegistry.insert(id, this);
+}
+
+ZoneRing::ZoneRing() : _threadID(int64_t(QThread::currentThreadId())) {
+}
+
+ZoneRing& ZoneRing::current() {
+    static thread_local ZoneRing* ring { nullptr };
+    if (!ring) {
+        // rings are deliberately never freed -- threads that record zones live as long as
+        // the process does, and a leaked ring is cheaper than racing the serializer
+        ring = new ZoneRing();
+        std::lock_guard<std::mutex> guard(_zoneRegistryMutex);
+        _zoneRings.push_back(ring);
+    }
+    return *ring;
+}
+
+std::vector<ZoneRing*> ZoneRing::allRings() {
+    std::lock_guard<std::mutex> guard(_zoneRegistryMutex);
+    return _zoneRings;
+}
+
+std::vector<ZoneEvent> ZoneRing::snapshot() const {
+    size_t head = _head.load(std::memory_order_acquire);
+    size_t count = std::min(head, SIZE);
+    std::vector<ZoneEvent> result;
+    result.reserve(count);
+    for (size_t i = head - count; i < head; ++i) {
+        const auto& event = _events[i & (SIZE - 1)];
+        if (event.info) {
+            result.push_back(event);
+        }
+    }
+    return result;
 }
 
 void Tracer::startTracing() {
@@ -156,6 +217,29 @@ void Tracer::serialize(const QString& originalPath) {
             }
             event.writeJson(out);
         }
+
+        // append whatever the always-on zone rings currently hold. Zones share the clock
+        // epoch of the events above, so both layers line up on the same timeline.
+        auto processID = QCoreApplication::applicationPid();
+        for (const auto* ring : ZoneRing::allRings()) {
+            for (const auto& zone : ring->snapshot()) {
+                QJsonObject ev {
+                    { "name", QString::fromLatin1(zone.info->name) },
+                    { "cat", QString::fromLatin1(zone.info->category) },
+                    { "ph", QString(Complete) },
+                    { "ts", zone.startNsecs / 1000.0 },
+                    { "dur", (zone.endNsecs - zone.startNsecs) / 1000.0 },
+                    { "pid", processID },
+                    { "tid", ring->threadID() }
+                };
+                if (first) {
+                    first = false;
+                } else {
+                    out << ",\n";
+                }
+                out << QJsonDocument(ev).toJson(QJsonDocument::Compact);
+            }
+        }
         out << "\n]";
     }
 
@@ -10,8 +10,11 @@
 #ifndef hifi_Trace_h
 #define hifi_Trace_h
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <vector>
 
 #include <QtCore/QString>
 #include <QtCore/QVariantMap>
@@ -102,7 +105,7 @@ private:
 };
 
 inline void traceEvent(const QLoggingCategory& category, const QString& name, EventType type, const QString& id = "", const QVariantMap& args = {}, const QVariantMap& extra = {}) {
-    const auto& tracer = DependencyManager::get<Tracer>();
+    auto tracer = DependencyManager::getUnsafe<Tracer>();
     if (tracer) {
         tracer->traceEvent(category, name, type, id, args, extra);
     }
@@ -112,6 +115,74 @@ inline void traceEvent(const QLoggingCategory& category, const QString& name, Ev
     traceEvent(category, name, type, QString::number(id), args, extra);
 }
 
+// --- always-on profiling zones ---
+//
+// Unlike the events above, zones build no QStrings and take no locks on the hot path: the
+// zone ID is hashed at compile time, the call site registers itself once through a local
+// static, and every hit writes a single slot into a per-thread ring. The rings behave like
+// a flight recorder - the newest events overwrite the oldest - and whatever is resident at
+// serialization time rides along in the chrome://tracing output as complete ('X') events.
+// That makes them cheap enough to leave enabled in production builds.
+
+constexpr uint32_t zoneId(const char* name, uint32_t hash = 2166136261U) {
+    // FNV-1a, expressed recursively so C++11 constexpr accepts it
+    return *name ? zoneId(name + 1, (hash ^ (uint32_t)*name) * 16777619U) : hash;
+}
+
+struct ZoneInfo {
+    const char* name;
+    const char* category;
+    uint32_t id;
+    ZoneInfo(const char* name, const char* category, uint32_t id);  // registers the zone
+};
+
+struct ZoneEvent {
+    const ZoneInfo* info { nullptr };
+    uint64_t startNsecs { 0 };
+    uint64_t endNsecs { 0 };
+};
+
+uint64_t zoneClockNsecs();
+
+class ZoneRing {
+public:
+    static const size_t SIZE = 8192; // power of two; about 192KB per thread
+
+    // the calling thread's ring, created and registered on first use. Rings live for the
+    // rest of the process so the serializer never races a thread shutting down.
+    static ZoneRing& current();
+    static std::vector<ZoneRing*> allRings();
+
+    void record(const ZoneInfo* info, uint64_t startNsecs, uint64_t endNsecs) {
+        size_t slot = _head.load(std::memory_order_relaxed);
+        _events[slot & (SIZE - 1)] = { info, startNsecs, endNsecs };
+        _head.store(slot + 1, std::memory_order_release);
+    }
+
+    int64_t threadID() const { return _threadID; }
+
+    // copies the resident events, oldest first. A writer lapping the reader can tear the
+    // very oldest entries; losing a handful of events is acceptable for a flight recorder.
+    std::vector<ZoneEvent> snapshot() const;
+
+private:
+    ZoneRing();
+
+    std::array<ZoneEvent, SIZE> _events;
+    std::atomic<size_t> _head { 0 };
+    int64_t _threadID { 0 };
+};
+
+class ScopedZone {
+public:
+    ScopedZone(const ZoneInfo* info) : _info(info), _startNsecs(zoneClockNsecs()) {}
+    ~ScopedZone() { ZoneRing::current().record(_info, _startNsecs, zoneClockNsecs()); }
+
+private:
+    const ZoneInfo* _info;
+    uint64_t _startNsecs;
+};
+
 }
 
 #endif // hifi_Trace_h
@@ -0,0 +1,54 @@
+//
+//  UUIDIntern.cpp
+//  libraries/shared/src
+//
+//  Created by Andrew Meadows on 2017-05-02.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "UUIDIntern.h"
+
+QReadWriteLock UUIDIntern::_lock;
+std::unordered_map<QUuid, quint64> UUIDIntern::_handles;
+std::vector<QUuid> UUIDIntern::_uuids;
+
+quint64 UUIDIntern::intern(const QUuid& uuid) {
+    if (uuid.isNull()) {
+        return NULL_HANDLE;
+    }
+
+    {
+        QReadLocker locker(&_lock);
+        auto it = _handles.find(uuid);
+        if (it != _handles.end()) {
+            return it->second;
+        }
+    }
+
+    QWriteLocker locker(&_lock);
+    // a writer may have raced us here, so re-check before assigning
+    auto it = _handles.find(uuid);
+    if (it != _handles.end()) {
+        return it->second;
+    }
+    _uuids.push_back(uuid);
+    quint64 handle = (quint64)_uuids.size();
+    _handles[uuid] = handle;
+    return handle;
+}
+
+QUuid UUIDIntern::lookup(quint64 handle) {
+    QReadLocker locker(&_lock);
+    if (handle == NULL_HANDLE || handle > (quint64)_uuids.size()) {
+        return QUuid();
+    }
+    return _uuids[handle - 1];
+}
+
+quint64 UUIDIntern::count() {
+    QReadLocker locker(&_lock);
+    return (quint64)_uuids.size();
+}
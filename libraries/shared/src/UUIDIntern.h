@@ -0,0 +1,47 @@
+//
+//  UUIDIntern.h
+//  libraries/shared/src
+//
+//  Created by Andrew Meadows on 2017-05-02.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_UUIDIntern_h
+#define hifi_UUIDIntern_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QUuid>
+
+#include "UUIDHasher.h"
+
+// Process-local interning of QUuids to dense 64-bit handles, assigned on first sight.
+// A handle costs one map probe to obtain, so interning only pays off for subsystems
+// that can hold onto the handle and key their own tables with it - anything that
+// receives raw QUuids off the wire every packet should hash them directly instead
+// (see UUIDHasher). Handles are never recycled; the null UUID interns to NULL_HANDLE.
+class UUIDIntern {
+public:
+    static const quint64 NULL_HANDLE = 0;
+
+    /// Returns the handle for uuid, assigning the next dense handle on first sight.
+    static quint64 intern(const QUuid& uuid);
+
+    /// Returns the UUID for a previously assigned handle, or the null UUID.
+    static QUuid lookup(quint64 handle);
+
+    /// The number of distinct UUIDs interned so far.
+    static quint64 count();
+
+private:
+    static QReadWriteLock _lock;
+    static std::unordered_map<QUuid, quint64> _handles;
+    static std::vector<QUuid> _uuids; // handle N lives at index N - 1
+};
+
+#endif // hifi_UUIDIntern_h
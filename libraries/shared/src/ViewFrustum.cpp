@@ -620,15 +620,27 @@ CubeProjectedPolygon ViewFrustum::getProjectedPolygon(const AACube& box) const {
 
     CubeProjectedPolygon projectedPolygon(vertexCount);
 
-    bool pointInView = true;
     bool allPointsInView = false; // assume the best, but wait till we know we have a vertex
     bool anyPointsInView = false; // assume the worst!
     if (vertexCount) {
         allPointsInView = true; // assume the best!
-        for(int i = 0; i < vertexCount; i++) {
+
+        // gather the hull vertices and project them in one batch (see GLMHelpers)
+        glm::vec3 hullVertices[MAX_PROJECTED_POLYGON_VERTEX_COUNT];
+        glm::vec4 projectedVertices[MAX_PROJECTED_POLYGON_VERTEX_COUNT];
+        for (int i = 0; i < vertexCount; i++) {
             int vertexNum = hullVertexLookup[lookUp][i+1];
-            glm::vec3 point = box.getVertex((BoxVertex)vertexNum);
-            glm::vec2 projectedPoint = projectPoint(point, pointInView);
+            hullVertices[i] = box.getVertex((BoxVertex)vertexNum);
+        }
+        batchTransformPoints(_ourModelViewProjectionMatrix, hullVertices, projectedVertices, vertexCount);
+
+        for(int i = 0; i < vertexCount; i++) {
+            const glm::vec4& projected = projectedVertices[i];
+            // math! If the w result is negative then the point is behind the viewer
+            bool pointInView = (projected.w > 0.0f);
+            // if the point is out of view we also need to flip the signs of x and y
+            float sign = pointInView ? 1.0f : -1.0f;
+            glm::vec2 projectedPoint(sign * projected.x / projected.w, sign * projected.y / projected.w);
             allPointsInView = allPointsInView && pointInView;
             anyPointsInView = anyPointsInView || pointInView;
             projectedPolygon.setVertex(i, projectedPoint);
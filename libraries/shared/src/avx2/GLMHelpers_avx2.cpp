@@ -0,0 +1,102 @@
+//
+//  GLMHelpers_avx2.cpp
+//  libraries/shared/src
+//
+//  Created by Anthony Thibault on 2017-08-10.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <immintrin.h>  // AVX2
+
+#include "../GLMHelpers.h"
+
+#ifndef __AVX2__
+#error Must be compiled with /arch:AVX2 or -mavx2 -mfma.
+#endif
+
+// dst[i] = m * vec4(src[i], 1.0), two points per iteration
+void batchTransformPoints_AVX2(const glm::mat4& m, const glm::vec3* src, glm::vec4* dst, size_t count) {
+
+    // matrix columns duplicated into both 128-bit lanes
+    __m256 col0 = _mm256_broadcast_ps((const __m128*)&m[0][0]);
+    __m256 col1 = _mm256_broadcast_ps((const __m128*)&m[1][0]);
+    __m256 col2 = _mm256_broadcast_ps((const __m128*)&m[2][0]);
+    __m256 col3 = _mm256_broadcast_ps((const __m128*)&m[3][0]);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const float* p = (const float*)&src[i];
+
+        __m256 x = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(p + 0)), _mm_broadcast_ss(p + 3), 1);
+        __m256 y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(p + 1)), _mm_broadcast_ss(p + 4), 1);
+        __m256 z = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(p + 2)), _mm_broadcast_ss(p + 5), 1);
+
+        // w = 1, so col3 seeds the accumulator
+        __m256 r = _mm256_fmadd_ps(col0, x, _mm256_fmadd_ps(col1, y, _mm256_fmadd_ps(col2, z, col3)));
+
+        _mm256_storeu_ps((float*)&dst[i], r);
+    }
+
+    for (; i < count; i++) {
+        dst[i] = m * glm::vec4(src[i], 1.0f);
+    }
+
+    _mm256_zeroupper();
+}
+
+// dst[i] = m * src[i], two vectors per iteration
+void batchTransformVecs_AVX2(const glm::mat4& m, const glm::vec4* src, glm::vec4* dst, size_t count) {
+
+    __m256 col0 = _mm256_broadcast_ps((const __m128*)&m[0][0]);
+    __m256 col1 = _mm256_broadcast_ps((const __m128*)&m[1][0]);
+    __m256 col2 = _mm256_broadcast_ps((const __m128*)&m[2][0]);
+    __m256 col3 = _mm256_broadcast_ps((const __m128*)&m[3][0]);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m256 v = _mm256_loadu_ps((const float*)&src[i]);
+
+        __m256 x = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+        __m256 y = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+        __m256 z = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+        __m256 w = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+
+        __m256 r = _mm256_fmadd_ps(col0, x, _mm256_fmadd_ps(col1, y, _mm256_fmadd_ps(col2, z, _mm256_mul_ps(col3, w))));
+
+        _mm256_storeu_ps((float*)&dst[i], r);
+    }
+
+    for (; i < count; i++) {
+        dst[i] = m * src[i];
+    }
+
+    _mm256_zeroupper();
+}
+
+// dst[i] = normalize(src[i]), two quats per iteration
+void batchNormalizeQuats_AVX2(const glm::quat* src, glm::quat* dst, size_t count) {
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m256 q = _mm256_loadu_ps((const float*)&src[i]);
+
+        // dot product broadcast within each 128-bit lane
+        __m256 len2 = _mm256_dp_ps(q, q, 0xFF);
+        __m256 invLen = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(len2));
+
+        _mm256_storeu_ps((float*)&dst[i], _mm256_mul_ps(q, invLen));
+    }
+
+    for (; i < count; i++) {
+        dst[i] = glm::normalize(src[i]);
+    }
+
+    _mm256_zeroupper();
+}
+
+#endif
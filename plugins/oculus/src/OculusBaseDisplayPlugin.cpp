@@ -128,12 +128,13 @@ void OculusBaseDisplayPlugin::internalDeactivate() {
 }
 
 void OculusBaseDisplayPlugin::updatePresentPose() {
-    //mat4 sensorResetMat;
-    //_currentPresentFrameInfo.sensorSampleTime = ovr_GetTimeInSeconds();
-    //_currentPresentFrameInfo.predictedDisplayTime = ovr_GetPredictedDisplayTime(_session, _currentFrame->frameIndex);
-    //auto trackingState = ovr_GetTrackingState(_session, _currentRenderFrameInfo.predictedDisplayTime, ovrFalse);
-    //_currentPresentFrameInfo.presentPose = toGlm(trackingState.HeadPose.ThePose);
-    _currentPresentFrameInfo.presentPose = _currentPresentFrameInfo.renderPose;
+    // Sample the tracking state again, now that we're about to present - a frame held
+    // over from a long render gets reprojected with the freshest head pose instead of
+    // the pose it was rendered with
+    _currentPresentFrameInfo.sensorSampleTime = ovr_GetTimeInSeconds();
+    _currentPresentFrameInfo.predictedDisplayTime = ovr_GetPredictedDisplayTime(_session, _currentFrame ? _currentFrame->frameIndex : 0);
+    auto trackingState = ovr_GetTrackingState(_session, _currentPresentFrameInfo.predictedDisplayTime, ovrFalse);
+    _currentPresentFrameInfo.presentPose = toGlm(trackingState.HeadPose.ThePose);
 }
 
 OculusBaseDisplayPlugin::~OculusBaseDisplayPlugin() {
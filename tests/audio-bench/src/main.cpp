@@ -0,0 +1,176 @@
+//
+//  main.cpp
+//  tests/audio-bench/src
+//
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+//
+//  Micro-benchmarks for the audio DSP kernels, reporting ns per network frame.
+//  The kernels select their SIMD implementation at runtime, so the numbers
+//  reflect the best dispatch path the host CPU supports (printed up front).
+//  Run before deploying DSP changes and compare against a baseline capture.
+//
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <AudioConstants.h>
+#include <AudioFOA.h>
+#include <AudioHRTF.h>
+#include <AudioLimiter.h>
+#include <AudioSRC.h>
+#include <CPUDetect.h>
+
+static const int FRAME_SAMPLES = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+
+// time an operation processing one network frame, amortized over many iterations
+static double benchNsPerFrame(std::function<void()> op) {
+    const int WARMUP_ITERATIONS = 100;
+    const int ITERATIONS = 10000;
+
+    for (int i = 0; i < WARMUP_ITERATIONS; i++) {
+        op();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        op();
+    }
+    auto finish = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count() / (double)ITERATIONS;
+}
+
+static void report(const char* kernel, double nsPerFrame) {
+    // frames are 10ms of audio; express the budget consumed as well
+    double budget = nsPerFrame / (AudioConstants::NETWORK_FRAME_SECS * 1e9);
+    printf("%-32s %12.0f ns/frame %8.3f%% of realtime\n", kernel, nsPerFrame, budget * 100.0);
+}
+
+static void fillNoise(int16_t* buffer, int numSamples) {
+    uint32_t seed = 1;
+    for (int i = 0; i < numSamples; i++) {
+        seed = seed * 69069 + 1;
+        buffer[i] = (int16_t)(seed >> 20);
+    }
+}
+
+static void benchHRTF() {
+    int16_t input[FRAME_SAMPLES];
+    float output[2 * FRAME_SAMPLES];
+    fillNoise(input, FRAME_SAMPLES);
+    memset(output, 0, sizeof(output));
+
+    AudioHRTF hrtf;
+    float azimuth = 0.0f;
+    report("AudioHRTF::render", benchNsPerFrame([&] {
+        // sweep the azimuth so the filters keep interpolating, as they do in-world
+        azimuth += 0.01f;
+        hrtf.render(input, output, 1, azimuth, 1.0f, 1.0f, FRAME_SAMPLES);
+    }));
+
+    AudioHRTF hrtfStatic;
+    report("AudioHRTF::render (static)", benchNsPerFrame([&] {
+        hrtfStatic.render(input, output, 1, 1.0f, 1.0f, 1.0f, FRAME_SAMPLES);
+    }));
+
+    // batched render, as the audio-mixer drives it
+    AudioHRTF hrtfs[HRTF_BATCH];
+    AudioHRTF* hrtfPtrs[HRTF_BATCH];
+    int16_t* inputs[HRTF_BATCH];
+    bool silent[HRTF_BATCH];
+    int indices[HRTF_BATCH];
+    float azimuths[HRTF_BATCH];
+    float distances[HRTF_BATCH];
+    float gains[HRTF_BATCH];
+    for (int i = 0; i < HRTF_BATCH; i++) {
+        hrtfPtrs[i] = &hrtfs[i];
+        inputs[i] = input;
+        silent[i] = false;
+        indices[i] = 1;
+        azimuths[i] = 0.1f * i;
+        distances[i] = 1.0f;
+        gains[i] = 1.0f;
+    }
+    double ns = benchNsPerFrame([&] {
+        AudioHRTF::renderBatch(hrtfPtrs, inputs, silent, indices, azimuths, distances, gains,
+                               output, HRTF_BATCH, FRAME_SAMPLES);
+    });
+    report("AudioHRTF::renderBatch (x8)", ns / HRTF_BATCH);
+}
+
+static void benchFOA() {
+    int16_t input[AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC];
+    float output[2 * FRAME_SAMPLES];
+    fillNoise(input, AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC);
+    memset(output, 0, sizeof(output));
+
+    AudioFOA foa;
+    float angle = 0.0f;
+    report("AudioFOA::render", benchNsPerFrame([&] {
+        angle += 0.01f;
+        foa.render(input, output, 1, cosf(angle), 0.0f, sinf(angle), 0.0f, 1.0f, FRAME_SAMPLES);
+    }));
+}
+
+static void benchSRC() {
+    static const struct { int inputRate; int outputRate; int numChannels; const char* name; } configs[] = {
+        { 44100, 48000, 1, "AudioSRC 44.1k->48k mono" },
+        { 44100, 48000, 2, "AudioSRC 44.1k->48k stereo" },
+        { 48000, 24000, 1, "AudioSRC 48k->24k mono" },
+        { 48000, 24000, 2, "AudioSRC 48k->24k stereo" },
+        { 24000, 48000, 2, "AudioSRC 24k->48k stereo" },
+    };
+
+    for (auto& config : configs) {
+        AudioSRC src(config.inputRate, config.outputRate, config.numChannels);
+
+        // 10ms of input at the source rate
+        int inputFrames = config.inputRate / 100;
+        std::vector<int16_t> input(inputFrames * config.numChannels);
+        std::vector<int16_t> output(src.getMaxOutput(inputFrames) * config.numChannels);
+        fillNoise(input.data(), (int)input.size());
+
+        report(config.name, benchNsPerFrame([&] {
+            src.render(input.data(), output.data(), inputFrames);
+        }));
+    }
+}
+
+static void benchLimiter() {
+    float input[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    int16_t output[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+
+    uint32_t seed = 1;
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; i++) {
+        seed = seed * 69069 + 1;
+        // hot signal, to exercise the gain computer and not just the passthrough
+        input[i] = (float)(int32_t)seed * (2.0f / 4294967296.0f);
+    }
+
+    AudioLimiter limiter(AudioConstants::SAMPLE_RATE, AudioConstants::STEREO);
+    report("AudioLimiter::render (stereo)", benchNsPerFrame([&] {
+        limiter.render(input, output, FRAME_SAMPLES);
+    }));
+}
+
+int main(int argc, char** argv) {
+    printf("audio-bench: SSE4.1=%d AVX=%d AVX2=%d AVX512=%d\n",
+           cpuSupportsSSE41(), cpuSupportsAVX(), cpuSupportsAVX2(), cpuSupportsAVX512());
+
+    benchHRTF();
+    benchFOA();
+    benchSRC();
+    benchLimiter();
+
+    return 0;
+}
@@ -0,0 +1,288 @@
+//
+//  main.cpp
+//  tests/entity-bench/src
+//
+//  Created by Brad Hefta-Gaub on 2017-08-24.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+//
+//  Soak benchmark for the entity-server's octree workloads, in-process against an EntityTree:
+//  a generated N-entity tree under simultaneous synthetic churn - M moving entities, K edits/sec
+//  round-tripped through the entity-edit wire codec (the same decode+update path the inbound
+//  packet processor drives), and V viewers with orbiting frusta running full-scene encodes the
+//  way OctreeSendThread does. Reports encode throughput, ingest latency percentiles, and time
+//  spent waiting on the tree lock per workload. Run it before and after any octree performance
+//  change.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <QCoreApplication>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <EntityItem.h>
+#include <EntityItemProperties.h>
+#include <EntityTree.h>
+#include <EntityTreeElement.h>
+#include <Octree.h>
+#include <OctreeConstants.h>
+#include <OctreePacketData.h>
+#include <SharedUtil.h>
+#include <ViewFrustum.h>
+
+// entities live in a cube this big centered in the domain, so the frusta see a busy scene
+static const float PLAY_AREA = 256.0f;
+
+static std::atomic<bool> _running { true };
+
+struct WorkloadStats {
+    std::vector<quint64> latencySamplesUsecs;
+    quint64 operations { 0 };
+    quint64 bytes { 0 };
+    quint64 lockWaitUsecs { 0 };
+};
+
+static glm::vec3 randomPosition(std::mt19937& rng) {
+    std::uniform_real_distribution<float> offset(-PLAY_AREA * 0.5f, PLAY_AREA * 0.5f);
+    float center = TREE_SCALE * 0.5f;
+    return glm::vec3(center + offset(rng), center + offset(rng), center + offset(rng));
+}
+
+static quint64 percentile(std::vector<quint64>& sortedSamples, float fraction) {
+    if (sortedSamples.empty()) {
+        return 0;
+    }
+    size_t index = (size_t)(fraction * (sortedSamples.size() - 1));
+    return sortedSamples[index];
+}
+
+// the M-moving-entities workload: reposition a slice of the tree at roughly 60Hz
+static void moverThread(EntityTreePointer tree, std::vector<EntityItemID> entityIDs, WorkloadStats* stats) {
+    std::mt19937 rng(12345);
+    const quint64 TICK_USECS = USECS_PER_SECOND / 60;
+
+    while (_running) {
+        quint64 tickStart = usecTimestampNow();
+        for (auto& entityID : entityIDs) {
+            if (!_running) {
+                break;
+            }
+            EntityItemProperties properties;
+            properties.setPosition(randomPosition(rng));
+
+            // the tree expects its callers to hold the lock, as the server's edit path does
+            quint64 start = usecTimestampNow();
+            tree->withWriteLock([&] {
+                stats->lockWaitUsecs += usecTimestampNow() - start;
+                tree->updateEntity(entityID, properties);
+            });
+            stats->latencySamplesUsecs.push_back(usecTimestampNow() - start);
+            stats->operations++;
+        }
+        quint64 elapsed = usecTimestampNow() - tickStart;
+        if (elapsed < TICK_USECS) {
+            usleep(TICK_USECS - elapsed);
+        }
+    }
+}
+
+// the K-edits/sec workload: encode each edit through the wire codec, then decode and apply it,
+// which is the same work OctreeInboundPacketProcessor hands to the tree per received edit
+static void editorThread(EntityTreePointer tree, std::vector<EntityItemID> entityIDs, int editsPerSec,
+                         WorkloadStats* stats) {
+    std::mt19937 rng(54321);
+    std::uniform_int_distribution<size_t> pickEntity(0, entityIDs.size() - 1);
+    const quint64 EDIT_INTERVAL_USECS = USECS_PER_SECOND / std::max(editsPerSec, 1);
+
+    while (_running) {
+        quint64 editStart = usecTimestampNow();
+
+        EntityItemID entityID = entityIDs[pickEntity(rng)];
+        EntityItemProperties properties;
+        properties.setPosition(randomPosition(rng));
+
+        QByteArray buffer;
+        EntityItemProperties::encodeEntityEditPacket(PacketType::EntityEdit, entityID, properties,
+                                                     properties.getPosition(), buffer);
+
+        // ingest: decode plus tree update, timed as one operation
+        quint64 ingestStart = usecTimestampNow();
+        int processedBytes = 0;
+        EntityItemID decodedID;
+        EntityItemProperties decodedProperties;
+        if (EntityItemProperties::decodeEntityEditPacket(reinterpret_cast<const unsigned char*>(buffer.data()),
+                                                         buffer.size(), processedBytes, decodedID, decodedProperties)) {
+            quint64 lockStart = usecTimestampNow();
+            tree->withWriteLock([&] {
+                stats->lockWaitUsecs += usecTimestampNow() - lockStart;
+                tree->updateEntity(decodedID, decodedProperties);
+            });
+        }
+        stats->latencySamplesUsecs.push_back(usecTimestampNow() - ingestStart);
+        stats->operations++;
+
+        quint64 elapsed = usecTimestampNow() - editStart;
+        if (elapsed < EDIT_INTERVAL_USECS) {
+            usleep(EDIT_INTERVAL_USECS - elapsed);
+        }
+    }
+}
+
+// the V-viewers workload: full-scene encodes against an orbiting frustum, section by section
+// under the read lock, the way OctreeSendThread drives encodeTreeBitstream
+static void viewerThread(EntityTreePointer tree, int viewerIndex, WorkloadStats* stats) {
+    const unsigned int sectionTargetSize =
+        MAX_OCTREE_PACKET_DATA_SIZE - sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE) - COMPRESS_PADDING;
+
+    float center = TREE_SCALE * 0.5f;
+    float angle = viewerIndex * 0.7f;
+    const float ORBIT_RADIUS = PLAY_AREA * 0.75f;
+    const float ORBIT_RATE = 0.1f; // radians per scene, so successive scenes differ
+
+    while (_running) {
+        // a frustum on the orbit, looking at the center of the play area
+        glm::vec3 position(center + ORBIT_RADIUS * cosf(angle), center, center + ORBIT_RADIUS * sinf(angle));
+        glm::mat4 view = glm::lookAt(position, glm::vec3(center, center, center), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        ViewFrustum viewFrustum;
+        viewFrustum.setPosition(position);
+        viewFrustum.setOrientation(glm::quat_cast(glm::inverse(view)));
+        viewFrustum.setProjection(glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 1024.0f));
+        viewFrustum.calculate();
+
+        OctreeElementExtraEncodeData extraEncodeData;
+        EncodeBitstreamParams params;
+        params.viewFrustum = viewFrustum;
+        params.extraEncodeData = &extraEncodeData;
+
+        OctreePacketData packetData(true, sectionTargetSize);
+        OctreeElementBag bag;
+        bag.insert(tree->getRoot());
+
+        while (!bag.isEmpty() && _running) {
+            quint64 lockStart = usecTimestampNow();
+            tree->withReadLock([&] {
+                stats->lockWaitUsecs += usecTimestampNow() - lockStart;
+                OctreeElementPointer sectionRoot = bag.extract();
+                if (sectionRoot) {
+                    tree->encodeTreeBitstream(sectionRoot, &packetData, bag, params);
+                }
+            });
+            if (packetData.hasContent()) {
+                stats->bytes += packetData.getFinalizedSize();
+            }
+            packetData.changeSettings(true, sectionTargetSize);
+        }
+
+        tree->releaseSceneEncodeData(&extraEncodeData);
+        stats->operations++; // one completed scene
+        angle += ORBIT_RATE;
+    }
+}
+
+static void reportLatency(const char* workload, WorkloadStats& stats, int durationSecs) {
+    std::sort(stats.latencySamplesUsecs.begin(), stats.latencySamplesUsecs.end());
+    printf("%-8s %8llu ops (%6.0f/sec)  latency p50 %5llu p90 %5llu p99 %5llu usecs  lock wait %llu msecs\n",
+           workload,
+           (unsigned long long)stats.operations, stats.operations / (double)durationSecs,
+           (unsigned long long)percentile(stats.latencySamplesUsecs, 0.50f),
+           (unsigned long long)percentile(stats.latencySamplesUsecs, 0.90f),
+           (unsigned long long)percentile(stats.latencySamplesUsecs, 0.99f),
+           (unsigned long long)(stats.lockWaitUsecs / USECS_PER_MSEC));
+}
+
+int main(int argc, char** argv) {
+    QCoreApplication app(argc, argv);
+
+    int numEntities = 10000;
+    int numMovers = 100;
+    int editsPerSec = 100;
+    int numViewers = 4;
+    int durationSecs = 10;
+
+    for (int i = 1; i < argc - 1; i++) {
+        QString arg(argv[i]);
+        int value = atoi(argv[i + 1]);
+        if (arg == "--entities") { numEntities = value; }
+        else if (arg == "--movers") { numMovers = value; }
+        else if (arg == "--edits") { editsPerSec = value; }
+        else if (arg == "--viewers") { numViewers = value; }
+        else if (arg == "--duration") { durationSecs = value; }
+    }
+
+    printf("entity-bench: %d entities, %d movers, %d edits/sec, %d viewers, %d seconds\n",
+           numEntities, numMovers, editsPerSec, numViewers, durationSecs);
+
+    EntityTreePointer tree = EntityTreePointer(new EntityTree(true));
+    tree->createRootElement();
+
+    // build the synthetic tree
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dimension(0.1f, 2.0f);
+    std::vector<EntityItemID> entityIDs;
+    entityIDs.reserve(numEntities);
+
+    quint64 buildStart = usecTimestampNow();
+    for (int i = 0; i < numEntities; i++) {
+        EntityItemID entityID(QUuid::createUuid());
+        EntityItemProperties properties;
+        properties.setType(EntityTypes::Box);
+        properties.setPosition(randomPosition(rng));
+        float size = dimension(rng);
+        properties.setDimensions(glm::vec3(size, size, size));
+        if (tree->addEntity(entityID, properties)) {
+            entityIDs.push_back(entityID);
+        }
+    }
+    printf("entity-bench: built tree with %d entities in %.2f seconds\n",
+           (int)entityIDs.size(), (usecTimestampNow() - buildStart) / (double)USECS_PER_SECOND);
+
+    // movers churn a fixed slice from the front, editors target the whole tree
+    numMovers = std::min(numMovers, (int)entityIDs.size());
+    std::vector<EntityItemID> moverIDs(entityIDs.begin(), entityIDs.begin() + numMovers);
+
+    WorkloadStats moverStats, editorStats;
+    std::vector<WorkloadStats> viewerStats(numViewers);
+
+    std::vector<std::thread> threads;
+    threads.emplace_back(moverThread, tree, moverIDs, &moverStats);
+    threads.emplace_back(editorThread, tree, entityIDs, editsPerSec, &editorStats);
+    for (int i = 0; i < numViewers; i++) {
+        threads.emplace_back(viewerThread, tree, i, &viewerStats[i]);
+    }
+
+    usleep(durationSecs * USECS_PER_SECOND);
+    _running = false;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    printf("\n");
+    reportLatency("movers", moverStats, durationSecs);
+    reportLatency("edits", editorStats, durationSecs);
+
+    quint64 scenes = 0, encodedBytes = 0, viewerLockWait = 0;
+    for (auto& stats : viewerStats) {
+        scenes += stats.operations;
+        encodedBytes += stats.bytes;
+        viewerLockWait += stats.lockWaitUsecs;
+    }
+    printf("viewers  %8llu scenes (%5.1f/sec/viewer)  encode %.2f MB/sec  lock wait %llu msecs\n",
+           (unsigned long long)scenes,
+           numViewers > 0 ? scenes / (double)durationSecs / numViewers : 0.0,
+           encodedBytes / (double)durationSecs / (1024.0 * 1024.0),
+           (unsigned long long)(viewerLockWait / USECS_PER_MSEC));
+
+    return 0;
+}
@@ -0,0 +1,347 @@
+//
+//  MixerBenchApp.cpp
+//  tests/mixer-bench/src
+//
+//  Created by Seth Alves on 2017-08-21.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include <cmath>
+
+#include <QCommandLineParser>
+#include <QLoggingCategory>
+#include <QThread>
+#include <QTimer>
+
+#include <AbstractAudioInterface.h>
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <AudioConstants.h>
+#include <DependencyManager.h>
+#include <NetworkLogging.h>
+#include <SettingHandle.h>
+#include <SharedLogging.h>
+#include <SharedUtil.h>
+#include <Transform.h>
+
+#include "MixerBenchApp.h"
+
+static const char* RESULT_PREFIX = "MIXER_BENCH_RESULT";
+
+// a mixed-audio frame arriving this much past the frame budget counts as a deadline miss
+static const quint64 DEADLINE_USECS = (quint64)(AudioConstants::NETWORK_FRAME_USECS * 3 / 2);
+
+MixerBenchApp::MixerBenchApp(int argc, char* argv[]) :
+    QCoreApplication(argc, argv)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("High Fidelity mixer load-generation bench");
+
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption verboseOutput("v", "verbose output");
+    parser.addOption(verboseOutput);
+
+    const QCommandLineOption domainAddressOption("d", "domain-server address", "127.0.0.1:40103");
+    parser.addOption(domainAddressOption);
+
+    const QCommandLineOption numClientsOption("clients", "number of synthetic clients", "10");
+    parser.addOption(numClientsOption);
+
+    const QCommandLineOption durationOption("duration", "seconds to run", "30");
+    parser.addOption(durationOption);
+
+    const QCommandLineOption avatarRateOption("avatar-rate", "avatar updates per second", "45");
+    parser.addOption(avatarRateOption);
+
+    // internal: this process is one synthetic client, spawned by the parent
+    const QCommandLineOption clientOption("client", "run as a single synthetic client");
+    parser.addOption(clientOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText();
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    _verbose = parser.isSet(verboseOutput);
+    if (!_verbose) {
+        QLoggingCategory::setFilterRules("qt.network.ssl.warning=false");
+
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtDebugMsg, false);
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtInfoMsg, false);
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtWarningMsg, false);
+
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtDebugMsg, false);
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtInfoMsg, false);
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtWarningMsg, false);
+    }
+
+    if (parser.isSet(domainAddressOption)) {
+        _domainAddress = parser.value(domainAddressOption);
+    }
+    if (parser.isSet(numClientsOption)) {
+        _numClients = parser.value(numClientsOption).toInt();
+    }
+    if (parser.isSet(durationOption)) {
+        _durationSecs = parser.value(durationOption).toInt();
+    }
+    if (parser.isSet(avatarRateOption)) {
+        _avatarRateHz = parser.value(avatarRateOption).toInt();
+    }
+    _isClient = parser.isSet(clientOption);
+
+    if (_isClient) {
+        startClient();
+    } else {
+        startParent();
+    }
+}
+
+void MixerBenchApp::startParent() {
+    printf("mixer-bench: %d clients against %s for %d seconds (audio %d Hz, avatars %d Hz)\n",
+           _numClients, qPrintable(_domainAddress), _durationSecs,
+           (int)(1000.0f / AudioConstants::NETWORK_FRAME_MSECS), _avatarRateHz);
+    printf("mixer-bench: per-stage mixer timings are on the domain-server stats page while this runs\n");
+
+    _clientsRemaining = _numClients;
+    for (int i = 0; i < _numClients; i++) {
+        auto client = new QProcess(this);
+        client->setProcessChannelMode(QProcess::MergedChannels);
+        connect(client, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+                this, &MixerBenchApp::clientFinished);
+
+        QStringList arguments { "--client", "-d", _domainAddress,
+                                "--duration", QString::number(_durationSecs),
+                                "--avatar-rate", QString::number(_avatarRateHz) };
+        if (_verbose) {
+            arguments << "-v";
+        }
+        client->start(applicationFilePath(), arguments);
+        _clients.append(client);
+    }
+}
+
+void MixerBenchApp::clientFinished(int exitCode, QProcess::ExitStatus exitStatus) {
+    auto client = qobject_cast<QProcess*>(sender());
+    if (client) {
+        for (auto& line : QString(client->readAll()).split('\n')) {
+            if (line.startsWith(RESULT_PREFIX)) {
+                _clientResults.append(line);
+            } else if (_verbose && !line.isEmpty()) {
+                printf("client: %s\n", qPrintable(line));
+            }
+        }
+    }
+
+    if (--_clientsRemaining == 0) {
+        finishParent();
+    }
+}
+
+void MixerBenchApp::finishParent() {
+    quint64 audioFrames = 0, audioMisses = 0, maxGap = 0, gapSum = 0;
+    quint64 avatarPackets = 0, avatarBytes = 0, audioSent = 0, avatarSent = 0;
+
+    for (auto& result : _clientResults) {
+        for (auto& field : result.split(' ')) {
+            auto keyValue = field.split('=');
+            if (keyValue.size() != 2) {
+                continue;
+            }
+            quint64 value = keyValue[1].toULongLong();
+            if (keyValue[0] == "audioFrames") { audioFrames += value; }
+            else if (keyValue[0] == "audioMisses") { audioMisses += value; }
+            else if (keyValue[0] == "maxGapUsecs") { maxGap = std::max(maxGap, value); }
+            else if (keyValue[0] == "gapSumUsecs") { gapSum += value; }
+            else if (keyValue[0] == "avatarPackets") { avatarPackets += value; }
+            else if (keyValue[0] == "avatarBytes") { avatarBytes += value; }
+            else if (keyValue[0] == "audioSent") { audioSent += value; }
+            else if (keyValue[0] == "avatarSent") { avatarSent += value; }
+        }
+    }
+
+    int reporting = _clientResults.size();
+    printf("\nmixer-bench results (%d of %d clients reporting)\n", reporting, _numClients);
+    printf("  sent:  %llu audio frames, %llu avatar updates\n",
+           (unsigned long long)audioSent, (unsigned long long)avatarSent);
+    if (audioFrames > 0) {
+        double hitRate = 100.0 * (audioFrames - audioMisses) / audioFrames;
+        printf("  audio: %llu mixed frames, %.2f%% within deadline (%llu misses), "
+               "avg gap %llu usecs, max gap %llu usecs\n",
+               (unsigned long long)audioFrames, hitRate, (unsigned long long)audioMisses,
+               (unsigned long long)(gapSum / audioFrames), (unsigned long long)maxGap);
+    } else {
+        printf("  audio: no mixed frames received - is an audio-mixer running?\n");
+    }
+    printf("  avatars: %llu bulk packets, %llu bytes\n",
+           (unsigned long long)avatarPackets, (unsigned long long)avatarBytes);
+
+    QCoreApplication::exit(reporting == _numClients ? 0 : 1);
+}
+
+void MixerBenchApp::startClient() {
+    Setting::init();
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+
+    DependencyManager::set<AccountManager>([&]{ return QString("Mozilla/5.0 (HighFidelityMixerBench)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent, INVALID_PORT);
+
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // start the nodeThread so its event loop is running
+    QThread* nodeThread = new QThread(this);
+    nodeThread->setObjectName("NodeList Thread");
+    nodeThread->start();
+    nodeThread->setPriority(QThread::TimeCriticalPriority);
+
+    // setup a timer for domain-server check ins
+    QTimer* domainCheckInTimer = new QTimer(nodeList.data());
+    connect(domainCheckInTimer, &QTimer::timeout, nodeList.data(), &NodeList::sendDomainServerCheckIn);
+    domainCheckInTimer->start(DOMAIN_SERVER_CHECK_IN_MSECS);
+
+    nodeList->moveToThread(nodeThread);
+
+    connect(nodeList.data(), &NodeList::nodeActivated, this, &MixerBenchApp::nodeActivated);
+
+    _avatar = std::make_shared<AvatarData>();
+    connect(nodeList.data(), &NodeList::uuidChanged, _avatar.get(), &AvatarData::setSessionUUID);
+
+    // spread the synthetic avatars around a circle so the mixers do real spatial work
+    _motionOffset = (float)(QCoreApplication::applicationPid() % 360) * 3.14159265f / 180.0f;
+
+    auto& packetReceiver = nodeList->getPacketReceiver();
+    packetReceiver.registerListener(PacketType::MixedAudio, this, "handleMixedAudio");
+    packetReceiver.registerListener(PacketType::SilentAudioFrame, this, "handleMixedAudio");
+    packetReceiver.registerListener(PacketType::BulkAvatarData, this, "handleBulkAvatarData");
+
+    nodeList->addSetOfNodeTypesToNodeInterestSet(NodeSet() << NodeType::AudioMixer << NodeType::AvatarMixer);
+
+    DependencyManager::get<AddressManager>()->handleLookupString(_domainAddress, false);
+
+    // microphone audio at the network frame rate
+    QTimer* audioTimer = new QTimer(this);
+    audioTimer->setTimerType(Qt::PreciseTimer);
+    connect(audioTimer, &QTimer::timeout, this, &MixerBenchApp::sendAudioFrame);
+    audioTimer->start((int)AudioConstants::NETWORK_FRAME_MSECS);
+
+    // avatar updates at the configured rate, identity once a second
+    QTimer* avatarTimer = new QTimer(this);
+    avatarTimer->setTimerType(Qt::PreciseTimer);
+    connect(avatarTimer, &QTimer::timeout, this, &MixerBenchApp::sendAvatarUpdate);
+    avatarTimer->start(1000 / std::max(_avatarRateHz, 1));
+
+    QTimer* identityTimer = new QTimer(this);
+    connect(identityTimer, &QTimer::timeout, _avatar.get(), &AvatarData::sendIdentityPacket);
+    identityTimer->start(1000);
+
+    QTimer::singleShot(_durationSecs * 1000, this, &MixerBenchApp::finishClient);
+}
+
+void MixerBenchApp::nodeActivated(SharedNodePointer node) {
+    if (node->getType() == NodeType::AudioMixer) {
+        negotiateAudioFormat();
+    }
+}
+
+void MixerBenchApp::negotiateAudioFormat() {
+    // plain PCM only - codecs would just add noise to the numbers
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto negotiateFormatPacket = NLPacket::create(PacketType::NegotiateAudioFormat);
+    quint8 numberOfCodecs = 1;
+    negotiateFormatPacket->writePrimitive(numberOfCodecs);
+    negotiateFormatPacket->writeString("pcm");
+
+    SharedNodePointer audioMixer = nodeList->soloNodeOfType(NodeType::AudioMixer);
+    if (audioMixer) {
+        nodeList->sendPacket(std::move(negotiateFormatPacket), *audioMixer);
+    }
+}
+
+void MixerBenchApp::sendAudioFrame() {
+    // one network frame of a 440Hz tone, so the mixer sees a real (loud) stream
+    int16_t samples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+    const float TWO_PI = 6.28318530f;
+    const float PHASE_STEP = TWO_PI * 440.0f / AudioConstants::SAMPLE_RATE;
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+        samples[i] = (int16_t)(8000.0f * sinf(_phase));
+        _phase += PHASE_STEP;
+        if (_phase > TWO_PI) {
+            _phase -= TWO_PI;
+        }
+    }
+
+    Transform transform;
+    transform.setTranslation(_avatar->getPosition());
+    transform.setRotation(_avatar->getOrientation());
+
+    AbstractAudioInterface::emitAudioPacket(samples, sizeof(samples), _audioSequenceNumber,
+                                            transform, glm::vec3(0.0f), glm::vec3(1.0f),
+                                            PacketType::MicrophoneAudioNoEcho, "pcm");
+    _audioFramesSent++;
+}
+
+void MixerBenchApp::sendAvatarUpdate() {
+    // walk a circle so the avatar keeps producing deltas and the audio keeps moving
+    const float WALK_RADIUS = 5.0f;
+    const float WALK_RATE = 0.5f; // radians per second
+    float angle = _motionOffset + WALK_RATE * (usecTimestampNow() / (float)USECS_PER_SECOND);
+    _avatar->setPosition(glm::vec3(WALK_RADIUS * cosf(angle), 0.0f, WALK_RADIUS * sinf(angle)));
+    _avatar->setOrientation(glm::angleAxis(-angle, glm::vec3(0.0f, 1.0f, 0.0f)));
+
+    QByteArray avatarByteArray = _avatar->toByteArrayStateful(AvatarData::CullSmallData);
+    _avatar->doneEncoding(true);
+
+    static AvatarDataSequenceNumber sequenceNumber = 0;
+    auto avatarPacket = NLPacket::create(PacketType::AvatarData, avatarByteArray.size() + sizeof(sequenceNumber));
+    avatarPacket->writePrimitive(sequenceNumber++);
+    avatarPacket->write(avatarByteArray);
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    nodeList->broadcastToNodes(std::move(avatarPacket), NodeSet() << NodeType::AvatarMixer);
+    _avatarUpdatesSent++;
+}
+
+void MixerBenchApp::handleMixedAudio(QSharedPointer<ReceivedMessage> message) {
+    quint64 now = usecTimestampNow();
+    if (_lastMixedAudioArrival != 0) {
+        quint64 gap = now - _lastMixedAudioArrival;
+        _totalInterArrivalUsecs += gap;
+        _maxInterArrivalUsecs = std::max(_maxInterArrivalUsecs, gap);
+        if (gap > DEADLINE_USECS) {
+            _mixedAudioDeadlineMisses++;
+        }
+    }
+    _lastMixedAudioArrival = now;
+    _mixedAudioFrames++;
+}
+
+void MixerBenchApp::handleBulkAvatarData(QSharedPointer<ReceivedMessage> message) {
+    _bulkAvatarPackets++;
+    _bulkAvatarBytes += message->getSize();
+}
+
+void MixerBenchApp::finishClient() {
+    printf("%s audioFrames=%llu audioMisses=%llu maxGapUsecs=%llu gapSumUsecs=%llu "
+           "avatarPackets=%llu avatarBytes=%llu audioSent=%llu avatarSent=%llu\n",
+           RESULT_PREFIX,
+           (unsigned long long)_mixedAudioFrames,
+           (unsigned long long)_mixedAudioDeadlineMisses,
+           (unsigned long long)_maxInterArrivalUsecs,
+           (unsigned long long)_totalInterArrivalUsecs,
+           (unsigned long long)_bulkAvatarPackets,
+           (unsigned long long)_bulkAvatarBytes,
+           (unsigned long long)_audioFramesSent,
+           (unsigned long long)_avatarUpdatesSent);
+    fflush(stdout);
+    QCoreApplication::exit(0);
+}
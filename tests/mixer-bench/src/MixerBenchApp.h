@@ -0,0 +1,84 @@
+//
+//  MixerBenchApp.h
+//  tests/mixer-bench/src
+//
+//  Created by Seth Alves on 2017-08-21.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MixerBenchApp_h
+#define hifi_MixerBenchApp_h
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QList>
+#include <QtCore/QProcess>
+
+#include <AvatarData.h>
+#include <NodeList.h>
+
+//
+//  Load-generation harness for the audio and avatar mixers. Run against a locally running
+//  domain-server plus mixers; the parent process spawns N synthetic clients (one process each,
+//  since NodeList is a process-wide singleton), and each client connects to the domain, streams
+//  PCM microphone audio at the network frame rate and AvatarData at the configured rate, and
+//  measures whether the mixers hold their frame deadlines from the receiving end - inter-arrival
+//  gaps of mixed-audio frames against the 10ms budget, plus avatar broadcast throughput.
+//  Mixer-internal per-stage timings (AudioMixerStats) are reported by the mixer to the
+//  domain-server stats page while the bench runs; this tool covers the client-observable side.
+//
+
+class MixerBenchApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    MixerBenchApp(int argc, char* argv[]);
+
+private slots:
+    void nodeActivated(SharedNodePointer node);
+    void handleMixedAudio(QSharedPointer<ReceivedMessage> message);
+    void handleBulkAvatarData(QSharedPointer<ReceivedMessage> message);
+    void clientFinished(int exitCode, QProcess::ExitStatus exitStatus);
+
+private:
+    void startParent();
+    void startClient();
+    void sendAudioFrame();
+    void sendAvatarUpdate();
+    void negotiateAudioFormat();
+    void finishClient();
+    void finishParent();
+
+    // configuration
+    QString _domainAddress { "127.0.0.1:40103" };
+    int _numClients { 10 };
+    int _durationSecs { 30 };
+    int _avatarRateHz { 45 };
+    bool _isClient { false };
+    bool _verbose { false };
+
+    // client send state
+    std::shared_ptr<AvatarData> _avatar;
+    quint16 _audioSequenceNumber { 0 };
+    float _phase { 0.0f };
+    float _motionOffset { 0.0f };
+    quint64 _audioFramesSent { 0 };
+    quint64 _avatarUpdatesSent { 0 };
+
+    // client receive stats
+    quint64 _lastMixedAudioArrival { 0 };
+    quint64 _mixedAudioFrames { 0 };
+    quint64 _mixedAudioDeadlineMisses { 0 };
+    quint64 _totalInterArrivalUsecs { 0 };
+    quint64 _maxInterArrivalUsecs { 0 };
+    quint64 _bulkAvatarPackets { 0 };
+    quint64 _bulkAvatarBytes { 0 };
+
+    // parent state
+    QList<QProcess*> _clients;
+    QStringList _clientResults;
+    int _clientsRemaining { 0 };
+};
+
+#endif // hifi_MixerBenchApp_h
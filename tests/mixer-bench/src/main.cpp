@@ -0,0 +1,17 @@
+//
+//  main.cpp
+//  tests/mixer-bench/src
+//
+//  Created by Seth Alves on 2017-08-21.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MixerBenchApp.h"
+
+int main(int argc, char* argv[]) {
+    MixerBenchApp app(argc, argv);
+    return app.exec();
+}
@@ -0,0 +1,113 @@
+//
+//  PacketTraceTests.cpp
+//  tests/networking/src
+//
+//  Created by Clement on 1/12/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketTraceTests.h"
+
+#include <QtCore/QTemporaryDir>
+
+#include <udt/Constants.h>
+#include <udt/ControlPacket.h>
+#include <udt/PacketTrace.h>
+#include <udt/TCPVegasCC.h>
+
+QTEST_MAIN(PacketTraceTests)
+
+void PacketTraceTests::recordAndReadBackTest() {
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    auto tracePath = tempDir.path() + "/trace.hftr";
+
+    udt::PacketTraceRecorder recorder;
+    QVERIFY(recorder.start(tracePath));
+    QVERIFY(recorder.isRecording());
+
+    // craft the leading header word of a reliable data packet
+    static const uint32_t DATA_SEQUENCE_NUMBER = 12345;
+    QByteArray dataPacket { 100, 0 };
+    uint32_t dataWord = udt::RELIABILITY_BIT_MASK | DATA_SEQUENCE_NUMBER;
+    memcpy(dataPacket.data(), &dataWord, sizeof(dataWord));
+
+    // and the leading header word of an ACK control packet
+    QByteArray controlPacket { 24, 0 };
+    uint32_t controlWord = udt::CONTROL_BIT_MASK
+        | ((uint32_t) udt::ControlPacket::ACK << (8 * sizeof(udt::ControlPacket::Type)));
+    memcpy(controlPacket.data(), &controlWord, sizeof(controlWord));
+
+    recorder.recordPacket(dataPacket.constData(), dataPacket.size(), udt::PacketTraceRecord::Sent);
+    recorder.recordPacket(controlPacket.constData(), controlPacket.size(), udt::PacketTraceRecord::Received);
+
+    recorder.stop();
+    QVERIFY(!recorder.isRecording());
+
+    udt::PacketTraceReader reader;
+    QVERIFY(reader.open(tracePath));
+
+    udt::PacketTraceRecord record;
+
+    QVERIFY(reader.readNextRecord(record));
+    QCOMPARE(record.direction, (quint8) udt::PacketTraceRecord::Sent);
+    QCOMPARE(record.isControl, (quint8) 0);
+    QCOMPARE(record.sequenceNumber, (quint32) DATA_SEQUENCE_NUMBER);
+    QCOMPARE(record.size, (quint32) dataPacket.size());
+
+    auto firstTimestamp = record.timestamp;
+
+    QVERIFY(reader.readNextRecord(record));
+    QCOMPARE(record.direction, (quint8) udt::PacketTraceRecord::Received);
+    QCOMPARE(record.isControl, (quint8) 1);
+    QCOMPARE(record.controlType, (quint16) udt::ControlPacket::ACK);
+    QCOMPARE(record.size, (quint32) controlPacket.size());
+    QVERIFY(record.timestamp >= firstTimestamp);
+
+    // the trace should be exhausted
+    QVERIFY(!reader.readNextRecord(record));
+}
+
+// exposes the protected setup methods so a test can stand in for a Connection
+class ReplayableVegasCC : public udt::TCPVegasCC {
+public:
+    using udt::TCPVegasCC::setInitialSendSequenceNumber;
+    using udt::CongestionControl::setSendCurrentSequenceNumber;
+};
+
+void PacketTraceTests::vegasDuplicateACKReplayTest() {
+    ReplayableVegasCC controller;
+
+    udt::SequenceNumber initial { 1000 };
+    controller.setInitialSendSequenceNumber(initial);
+
+    auto base = p_high_resolution_clock::now();
+
+    // "send" five packets, one millisecond apart
+    static const int NUM_SENT_PACKETS = 5;
+    static const int PACKET_WIRE_SIZE = 1000;
+    for (int i = 0; i < NUM_SENT_PACKETS; ++i) {
+        controller.onPacketSent(PACKET_WIRE_SIZE, initial + i, base + std::chrono::milliseconds(i));
+    }
+    controller.setSendCurrentSequenceNumber(initial + (NUM_SENT_PACKETS - 1));
+
+    // the RTT for the schedule is large enough that wall clock time elapsed while
+    // this test runs cannot trip the retransmit timeout check
+    auto ackTime = base + std::chrono::milliseconds(500);
+
+    // the first ACK is in-order - no fast re-transmit
+    QCOMPARE(controller.onACK(initial, ackTime), false);
+
+    // two duplicates are not enough to trigger a fast re-transmit
+    QCOMPARE(controller.onACK(initial, ackTime), false);
+
+    // the third duplicate ACK falls back to Reno fast re-transmit
+    QCOMPARE(controller.onACK(initial, ackTime), true);
+
+    // once transmission resumes in-order, no re-transmit is requested
+    QCOMPARE(controller.onACK(initial + 1, ackTime + std::chrono::milliseconds(1)), false);
+}
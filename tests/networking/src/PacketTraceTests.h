@@ -0,0 +1,28 @@
+//
+//  PacketTraceTests.h
+//  tests/networking/src
+//
+//  Created by Clement on 1/12/17.
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketTraceTests_h
+#define hifi_PacketTraceTests_h
+
+#include <QtTest/QtTest>
+
+class PacketTraceTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that recorded packet headers survive a round trip through the trace format
+    void recordAndReadBackTest();
+
+    // Test that a scripted ACK schedule replayed against TCPVegasCC triggers
+    // fast re-transmit on the third duplicate ACK and not on in-order ACKs
+    void vegasDuplicateACKReplayTest();
+};
+
+#endif // hifi_PacketTraceTests_h
@@ -275,3 +275,27 @@ void CollisionRenderMeshCacheTests::testMultipleShapes() {
     delete shapeB;
     delete shapeC;
 }
+
+void CollisionRenderMeshCacheTests::testRequestMesh() {
+    btBoxShape* shape = createBoxShape(btVector3(1.0f, 2.0f, 3.0f));
+
+    CollisionRenderMeshCache cache;
+    QVERIFY(cache.getNumMeshes() == 0);
+
+    // the first build in a fresh budget window always proceeds
+    model::MeshPointer mesh = cache.requestMesh(shape);
+    QVERIFY((bool)mesh);
+    QVERIFY(cache.getNumMeshes() == 1);
+
+    // cache hits are returned regardless of budget
+    model::MeshPointer mesh2 = cache.requestMesh(shape);
+    QVERIFY(mesh2 == mesh);
+    QVERIFY(cache.getNumMeshes() == 1);
+
+    // requestMesh and getMesh share the cache
+    model::MeshPointer mesh3 = cache.getMesh(shape);
+    QVERIFY(mesh3 == mesh);
+    QVERIFY(cache.getNumMeshes() == 1);
+
+    delete shape;
+}
@@ -21,6 +21,7 @@ private slots:
     void testShapeHullManifold();
     void testCompoundShape();
     void testMultipleShapes();
+    void testRequestMesh();
 };
 
 #endif // hifi_CollisionRenderMeshCacheTests_h
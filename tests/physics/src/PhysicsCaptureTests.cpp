@@ -0,0 +1,185 @@
+//
+//  PhysicsCaptureTests.cpp
+//  tests/physics/src
+//
+//  Created by Andrew Meadows on 2017.01.17
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsCaptureTests.h"
+
+#include <vector>
+
+#include <QtCore/QTemporaryDir>
+
+#include <btBulletDynamicsCommon.h>
+
+#include <PhysicsCapture.h>
+#include <PhysicsHelpers.h>
+
+QTEST_MAIN(PhysicsCaptureTests)
+
+void PhysicsCaptureTests::testCaptureRoundTrip() {
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    QString capturePath = tempDir.path() + "/capture.hfpc";
+
+    btBoxShape box(btVector3(0.5f, 0.5f, 0.5f));
+    btSphereShape sphere(0.3f);
+
+    btRigidBody::btRigidBodyConstructionInfo boxInfo(1.0f, nullptr, &box);
+    boxInfo.m_startWorldTransform = btTransform(btQuaternion::getIdentity(), btVector3(1.0f, 2.0f, 3.0f));
+    btRigidBody boxBody(boxInfo);
+    boxBody.setLinearVelocity(btVector3(0.1f, 0.2f, 0.3f));
+    boxBody.setGravity(btVector3(0.0f, -9.8f, 0.0f));
+
+    btRigidBody::btRigidBodyConstructionInfo sphereInfo(2.0f, nullptr, &sphere);
+    sphereInfo.m_startWorldTransform = btTransform(btQuaternion::getIdentity(), btVector3(-1.0f, 5.0f, 0.0f));
+    btRigidBody sphereBody(sphereInfo);
+
+    PhysicsCaptureRecorder recorder;
+    QVERIFY(recorder.start(capturePath));
+    QVERIFY(recorder.isCapturing());
+    recorder.captureBody(&boxBody);
+    recorder.captureStep(PHYSICS_ENGINE_FIXED_SUBSTEP);
+    recorder.captureBody(&sphereBody);
+    recorder.captureStep(2.0f * PHYSICS_ENGINE_FIXED_SUBSTEP);
+    recorder.stop();
+    QVERIFY(!recorder.isCapturing());
+
+    PhysicsCaptureReader reader;
+    QVERIFY(reader.read(capturePath));
+    QCOMPARE(reader.getBodies().size(), (size_t)2);
+    QCOMPARE(reader.getSteps().size(), (size_t)2);
+
+    const PhysicsCaptureBody& capturedBox = reader.getBodies()[0];
+    QCOMPARE(capturedBox.shapeType, (int32_t)BOX_SHAPE_PROXYTYPE);
+    QCOMPARE(capturedBox.mass, 1.0f);
+    QVERIFY(capturedBox.transform.getOrigin().distance(btVector3(1.0f, 2.0f, 3.0f)) < FLT_EPSILON);
+    QVERIFY(capturedBox.linearVelocity.distance(btVector3(0.1f, 0.2f, 0.3f)) < FLT_EPSILON);
+    QVERIFY(capturedBox.gravity.distance(btVector3(0.0f, -9.8f, 0.0f)) < FLT_EPSILON);
+
+    const PhysicsCaptureBody& capturedSphere = reader.getBodies()[1];
+    QCOMPARE(capturedSphere.shapeType, (int32_t)SPHERE_SHAPE_PROXYTYPE);
+    QCOMPARE(capturedSphere.mass, 2.0f);
+    QVERIFY(capturedSphere.halfExtents.distance(btVector3(0.3f, 0.3f, 0.3f)) < FLT_EPSILON);
+
+    QCOMPARE(reader.getSteps()[0], PHYSICS_ENGINE_FIXED_SUBSTEP);
+    QCOMPARE(reader.getSteps()[1], 2.0f * PHYSICS_ENGINE_FIXED_SUBSTEP);
+}
+
+// re-step the capture in a fresh world and print per-step timing
+static void replayCapture(const PhysicsCaptureReader& reader) {
+    btDefaultCollisionConfiguration collisionConfig;
+    btCollisionDispatcher dispatcher(&collisionConfig);
+    btDbvtBroadphase broadphase;
+    btSequentialImpulseConstraintSolver solver;
+    btDiscreteDynamicsWorld world(&dispatcher, &broadphase, &solver, &collisionConfig);
+    world.setGravity(btVector3(0.0f, 0.0f, 0.0f));
+
+    std::vector<btCollisionShape*> shapes;
+    std::vector<btRigidBody*> bodies;
+    for (const PhysicsCaptureBody& captured : reader.getBodies()) {
+        btCollisionShape* shape;
+        if (captured.shapeType == SPHERE_SHAPE_PROXYTYPE) {
+            shape = new btSphereShape(captured.halfExtents.getX());
+        } else {
+            shape = new btBoxShape(captured.halfExtents);
+        }
+        shapes.push_back(shape);
+
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        if (captured.mass > 0.0f) {
+            shape->calculateLocalInertia(captured.mass, inertia);
+        }
+        btRigidBody::btRigidBodyConstructionInfo info(captured.mass, nullptr, shape, inertia);
+        info.m_startWorldTransform = captured.transform;
+        btRigidBody* body = new btRigidBody(info);
+        body->setLinearVelocity(captured.linearVelocity);
+        body->setAngularVelocity(captured.angularVelocity);
+        world.addRigidBody(body);
+        body->setGravity(captured.gravity);
+        if (!captured.isActive) {
+            body->forceActivationState(ISLAND_SLEEPING);
+        }
+        bodies.push_back(body);
+    }
+
+    // a floor so dynamic bodies have something to collide with
+    btBoxShape floorShape(btVector3(1000.0f, 1.0f, 1000.0f));
+    btRigidBody::btRigidBodyConstructionInfo floorInfo(0.0f, nullptr, &floorShape);
+    floorInfo.m_startWorldTransform = btTransform(btQuaternion::getIdentity(), btVector3(0.0f, -1.0f, 0.0f));
+    btRigidBody floorBody(floorInfo);
+    world.addRigidBody(&floorBody);
+
+    btClock clock;
+    uint64_t totalUsecs = 0;
+    uint64_t maxUsecs = 0;
+    for (float timeStep : reader.getSteps()) {
+        clock.reset();
+        world.stepSimulation(timeStep, PHYSICS_ENGINE_MAX_NUM_SUBSTEPS, PHYSICS_ENGINE_FIXED_SUBSTEP);
+        uint64_t usecs = clock.getTimeMicroseconds();
+        totalUsecs += usecs;
+        if (usecs > maxUsecs) {
+            maxUsecs = usecs;
+        }
+    }
+
+    size_t numSteps = reader.getSteps().size();
+    qDebug() << "replayed" << (int)reader.getBodies().size() << "bodies over" << (int)numSteps << "steps:"
+        << "avg =" << (numSteps ? totalUsecs / numSteps : 0) << "usec/step,"
+        << "max =" << maxUsecs << "usec";
+
+    world.removeRigidBody(&floorBody);
+    for (btRigidBody* body : bodies) {
+        world.removeRigidBody(body);
+        delete body;
+    }
+    for (btCollisionShape* shape : shapes) {
+        delete shape;
+    }
+}
+
+void PhysicsCaptureTests::testReplayTiming() {
+    QString capturePath = QString::fromLocal8Bit(qgetenv("HIFI_PHYSICS_CAPTURE"));
+    if (!capturePath.isEmpty()) {
+        // replay a capture recorded from a real scene
+        PhysicsCaptureReader reader;
+        QVERIFY(reader.read(capturePath));
+        replayCapture(reader);
+        return;
+    }
+
+    // no capture provided: generate a synthetic one (a stack of boxes settling
+    // under gravity for two seconds) and make sure it replays cleanly
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    QString syntheticPath = tempDir.path() + "/synthetic.hfpc";
+
+    btBoxShape box(btVector3(0.25f, 0.25f, 0.25f));
+    PhysicsCaptureRecorder recorder;
+    QVERIFY(recorder.start(syntheticPath));
+    const int NUM_BOXES = 20;
+    for (int i = 0; i < NUM_BOXES; ++i) {
+        btRigidBody::btRigidBodyConstructionInfo info(1.0f, nullptr, &box);
+        info.m_startWorldTransform = btTransform(btQuaternion::getIdentity(),
+                btVector3(0.0f, 0.3f + 0.55f * (float)i, 0.0f));
+        btRigidBody body(info);
+        body.setGravity(btVector3(0.0f, -9.8f, 0.0f));
+        recorder.captureBody(&body);
+    }
+    const int NUM_STEPS = 180;
+    for (int i = 0; i < NUM_STEPS; ++i) {
+        recorder.captureStep(PHYSICS_ENGINE_FIXED_SUBSTEP);
+    }
+    recorder.stop();
+
+    PhysicsCaptureReader reader;
+    QVERIFY(reader.read(syntheticPath));
+    QCOMPARE(reader.getBodies().size(), (size_t)NUM_BOXES);
+    QCOMPARE(reader.getSteps().size(), (size_t)NUM_STEPS);
+    replayCapture(reader);
+}
@@ -0,0 +1,30 @@
+//
+//  PhysicsCaptureTests.h
+//  tests/physics/src
+//
+//  Created by Andrew Meadows on 2017.01.17
+//  Copyright 2017 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsCaptureTests_h
+#define hifi_PhysicsCaptureTests_h
+
+#include <QtTest/QtTest>
+
+class PhysicsCaptureTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    // capture records survive a round trip through the file format
+    void testCaptureRoundTrip();
+
+    // re-step a capture headless and report per-step solver timing;
+    // set HIFI_PHYSICS_CAPTURE to a capture file to replay a real scene,
+    // otherwise a synthetic box-stack capture is generated and replayed
+    void testReplayTiming();
+};
+
+#endif // hifi_PhysicsCaptureTests_h
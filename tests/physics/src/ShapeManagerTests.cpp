@@ -238,8 +238,14 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 1);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 
-    // collect garbage
+    // collect garbage and verify the shape is retained rather than deleted --
+    // hulls are expensive to cook and are kept around for a while at zero references
     shapeManager.collectGarbage();
-    QCOMPARE(shapeManager.getNumShapes(), 0);
+    QCOMPARE(shapeManager.getNumShapes(), 1);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
+
+    // ask for the shape again and verify we get the retained shape back without a re-cook
+    const btCollisionShape* retainedShape = shapeManager.getShape(info);
+    QCOMPARE(retainedShape, shape);
+    QCOMPARE(shapeManager.getNumReferences(info), 1);
 }
@@ -18,6 +18,10 @@
 
 #include <QtCore/QDir>
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QSettings>
@@ -821,6 +825,36 @@ private:
             return;
         }
         parsePath(commandParams[1]);
+    } else if (verb == "path") {
+        if (commandParams.length() < 2) {
+            qDebug() << "No camera path file specified";
+            return;
+        }
+        QString file = commandParams[1];
+        if (QFileInfo(file).isRelative()) {
+            file = _commandPath + "/" + file;
+        }
+        loadCameraPath(file);
+    } else if (verb == "timings") {
+        if (commandParams.length() < 2) {
+            qDebug() << "No output file specified for timings";
+            return;
+        }
+        QString file = commandParams[1];
+        if (QFileInfo(file).isRelative()) {
+            file = _commandPath + "/" + file;
+        }
+        writeEngineTimings(file);
+    } else if (verb == "dumpscene") {
+        if (commandParams.length() < 2) {
+            qDebug() << "No output file specified for dumpScene";
+            return;
+        }
+        QString file = commandParams[1];
+        if (QFileInfo(file).isRelative()) {
+            file = _commandPath + "/" + file;
+        }
+        writeSceneDump(file);
     } else {
         qDebug() << "Unknown command " << command;
     }
@@ -845,11 +879,114 @@ private:
         runCommand(command);
     }
 
+    // Loads a recorded camera path - a JSON array of { "time": seconds, "position": [x,y,z],
+    // "orientation": [x,y,z,w] } keyframes - and starts replaying it.  The camera is interpolated
+    // between keyframes every frame, so the same path file against the same scene always produces
+    // the same frame sequence, which is what makes before/after timing comparisons meaningful.
+    void loadCameraPath(const QString& fileName) {
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly)) {
+            qDebug() << "Cannot find camera path file " + fileName;
+            return;
+        }
+        _pathKeyframes.clear();
+        for (auto value : QJsonDocument::fromJson(file.readAll()).array()) {
+            auto keyframe = value.toObject();
+            auto position = keyframe["position"].toArray();
+            auto orientation = keyframe["orientation"].toArray();
+            PathKeyframe frame;
+            frame.time = (float)keyframe["time"].toDouble();
+            frame.position = glm::vec3((float)position[0].toDouble(), (float)position[1].toDouble(),
+                (float)position[2].toDouble());
+            frame.orientation = glm::quat((float)orientation[3].toDouble(), (float)orientation[0].toDouble(),
+                (float)orientation[1].toDouble(), (float)orientation[2].toDouble());
+            _pathKeyframes.push_back(frame);
+        }
+        qDebug() << "Replaying camera path " << fileName << " with " << _pathKeyframes.size() << " keyframes";
+        _pathStart = usecTimestampNow();
+    }
+
+    void updateCameraPath(quint64 now) {
+        if (_pathKeyframes.empty()) {
+            return;
+        }
+        float t = (now - _pathStart) / (float)USECS_PER_SECOND;
+        if (t >= _pathKeyframes.back().time) {
+            // playback complete, park on the last keyframe
+            _camera.setPosition(_pathKeyframes.back().position);
+            _camera.setRotation(_pathKeyframes.back().orientation);
+            _pathKeyframes.clear();
+            return;
+        }
+        size_t next = 0;
+        while (_pathKeyframes[next].time < t) {
+            next++;
+        }
+        if (next == 0) {
+            _camera.setPosition(_pathKeyframes[0].position);
+            _camera.setRotation(_pathKeyframes[0].orientation);
+            return;
+        }
+        const auto& from = _pathKeyframes[next - 1];
+        const auto& to = _pathKeyframes[next];
+        float alpha = (to.time > from.time) ? (t - from.time) / (to.time - from.time) : 1.0f;
+        _camera.setPosition(glm::mix(from.position, to.position, alpha));
+        _camera.setRotation(glm::slerp(from.orientation, to.orientation, alpha));
+    }
+
+    // Serializes the per-job CPU and GPU timings accumulated on the engine's config tree, one entry
+    // per job named by its dotted path through the task hierarchy.  Paired with a camera path replay
+    // this gives a machine-diffable profile of two builds over the same frames.
+    void writeEngineTimings(const QString& fileName) {
+        QJsonArray timings;
+        std::function<void(const QObject*, const QString&)> visitConfig = [&](const QObject* config,
+                const QString& path) {
+            for (auto child : config->children()) {
+                QString childPath = path.isEmpty() ? child->objectName() : path + "." + child->objectName();
+                auto cpuRunTime = child->property("cpuRunTime");
+                if (cpuRunTime.isValid()) {
+                    QJsonObject timing;
+                    timing["name"] = childPath;
+                    timing["cpuRunTime"] = cpuRunTime.toDouble();
+                    timing["cpuRunTimeP95"] = child->property("cpuRunTimeP95").toDouble();
+                    auto gpuRunTime = child->property("gpuRunTime");
+                    if (gpuRunTime.isValid()) {
+                        timing["gpuRunTime"] = gpuRunTime.toDouble();
+                        timing["gpuRunTimeP95"] = child->property("gpuRunTimeP95").toDouble();
+                        timing["batchRunTime"] = child->property("batchRunTime").toDouble();
+                    }
+                    timings.append(timing);
+                }
+                visitConfig(child, childPath);
+            }
+        };
+        visitConfig(_renderEngine->getConfiguration().get(), QString());
+
+        QFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly)) {
+            qDebug() << "Cannot write timings file " + fileName;
+            return;
+        }
+        file.write(QJsonDocument(timings).toJson());
+        qDebug() << "Wrote engine timings to " << fileName;
+    }
+
+    void writeSceneDump(const QString& fileName) {
+        QFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly)) {
+            qDebug() << "Cannot write scene dump file " + fileName;
+            return;
+        }
+        file.write(QJsonDocument(_main3DScene->dumpItemDescriptions()).toJson());
+        qDebug() << "Wrote scene dump to " << fileName;
+    }
+
     void update() {
         auto now = usecTimestampNow();
         static auto last = now;
 
         runNextCommand(now);
+        updateCameraPath(now);
 
         float delta = now - last;
         // Update the camera
@@ -1116,6 +1253,15 @@ private:
     int _commandIndex { -1 };
     uint64_t _nextCommandTime { 0 };
 
+    // camera path being replayed, cleared once playback passes the last keyframe
+    struct PathKeyframe {
+        float time;
+        glm::vec3 position;
+        glm::quat orientation;
+    };
+    std::vector<PathKeyframe> _pathKeyframes;
+    quint64 _pathStart { 0 };
+
     //TextOverlay* _textOverlay;
     static bool _cullingEnabled;
 
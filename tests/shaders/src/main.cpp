@@ -53,12 +53,8 @@
 #include <render-utils/model_frag.h>
 #include <render-utils/model_shadow_frag.h>
 #include <render-utils/model_normal_map_frag.h>
-#include <render-utils/model_normal_specular_map_frag.h>
-#include <render-utils/model_specular_map_frag.h>
 #include <render-utils/model_lightmap_frag.h>
 #include <render-utils/model_lightmap_normal_map_frag.h>
-#include <render-utils/model_lightmap_normal_specular_map_frag.h>
-#include <render-utils/model_lightmap_specular_map_frag.h>
 #include <render-utils/model_translucent_frag.h>
 
 #include <entities-renderer/untextured_particle_frag.h>
@@ -165,19 +161,13 @@ void QTestWindow::draw() {
 
         testShaderBuild(model_vert, model_frag);
         testShaderBuild(model_normal_map_vert, model_normal_map_frag);
-        testShaderBuild(model_vert, model_specular_map_frag);
-        testShaderBuild(model_normal_map_vert, model_normal_specular_map_frag);
         testShaderBuild(model_vert, model_translucent_frag);
         testShaderBuild(model_normal_map_vert, model_translucent_frag);
         testShaderBuild(model_lightmap_vert, model_lightmap_frag);
         testShaderBuild(model_lightmap_normal_map_vert, model_lightmap_normal_map_frag);
-        testShaderBuild(model_lightmap_vert, model_lightmap_specular_map_frag);
-        testShaderBuild(model_lightmap_normal_map_vert, model_lightmap_normal_specular_map_frag);
 
         testShaderBuild(skin_model_vert, model_frag);
         testShaderBuild(skin_model_normal_map_vert, model_normal_map_frag);
-        testShaderBuild(skin_model_vert, model_specular_map_frag);
-        testShaderBuild(skin_model_normal_map_vert, model_normal_specular_map_frag);
         testShaderBuild(skin_model_vert, model_translucent_frag);
         testShaderBuild(skin_model_normal_map_vert, model_translucent_frag);
 
@@ -0,0 +1,334 @@
+//
+//  ContentBakerApp.cpp
+//  tools/content-baker/src
+//
+//  Created by Ryan Huffman on 12/12/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContentBakerApp.h"
+
+#include <cmath>
+#include <memory>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtGui/QImage>
+
+#include <FBXReader.h>
+#include <OBJReader.h>
+#include <Sound.h>
+#include <CompiledGeometryCache.h>
+#include <TextureTranscodeCache.h>
+
+static const QStringList MODEL_EXTENSIONS { "fbx", "obj" };
+static const QStringList IMAGE_EXTENSIONS { "png", "jpg", "jpeg", "tga", "bmp" };
+static const QStringList SOUND_EXTENSIONS { "wav", "raw" };
+
+// the texture type names accepted by --texture-types; cube maps are excluded because the
+// transcode cache cannot capture their derived irradiance, custom because its loader is
+// arbitrary code the baker cannot run
+static NetworkTexture::Type textureTypeForName(const QString& name, bool& ok) {
+    ok = true;
+    if (name == "default") {
+        return NetworkTexture::DEFAULT_TEXTURE;
+    } else if (name == "albedo") {
+        return NetworkTexture::ALBEDO_TEXTURE;
+    } else if (name == "normal") {
+        return NetworkTexture::NORMAL_TEXTURE;
+    } else if (name == "bump") {
+        return NetworkTexture::BUMP_TEXTURE;
+    } else if (name == "specular" || name == "metallic") {
+        return NetworkTexture::METALLIC_TEXTURE;
+    } else if (name == "roughness") {
+        return NetworkTexture::ROUGHNESS_TEXTURE;
+    } else if (name == "gloss") {
+        return NetworkTexture::GLOSS_TEXTURE;
+    } else if (name == "emissive") {
+        return NetworkTexture::EMISSIVE_TEXTURE;
+    } else if (name == "occlusion" || name == "scattering") {
+        return NetworkTexture::OCCLUSION_TEXTURE;
+    } else if (name == "lightmap") {
+        return NetworkTexture::LIGHTMAP_TEXTURE;
+    }
+    ok = false;
+    return NetworkTexture::DEFAULT_TEXTURE;
+}
+
+ContentBakerApp::ContentBakerApp(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("High Fidelity Content Baker - pre-processes domain content into client-ready assets");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption verboseOption("v", "verbose output");
+    parser.addOption(verboseOption);
+
+    const QCommandLineOption inputOption("i", "input content directory, walked recursively", "directory");
+    parser.addOption(inputOption);
+
+    const QCommandLineOption outputOption("o", "output directory for baked files and the manifest", "directory");
+    parser.addOption(outputOption);
+
+    const QCommandLineOption baseUrlOption("base-url", "URL prefix the input directory is served under; "
+        "lets baked sounds be named the way the client cache will look for them", "url");
+    parser.addOption(baseUrlOption);
+
+    const QCommandLineOption textureTypesOption("texture-types", "comma separated texture types to bake each "
+        "image as (default, albedo, normal, bump, specular, roughness, gloss, emissive, occlusion, lightmap)",
+        "types", "albedo");
+    parser.addOption(textureTypesOption);
+
+    const QCommandLineOption maxTexturePixelsOption("max-texture-pixels", "downscale limit, must match the "
+        "loading client's to produce the same bytes", "pixels",
+        QString::number(ABSOLUTE_MAX_TEXTURE_NUM_PIXELS));
+    parser.addOption(maxTexturePixelsOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << endl;
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        return;
+    }
+
+    _verbose = parser.isSet(verboseOption);
+
+    QDir inputDir(parser.value(inputOption));
+    if (!parser.isSet(inputOption) || !inputDir.exists()) {
+        qCritical() << "Input directory does not exist:" << parser.value(inputOption);
+        _returnCode = 2;
+        return;
+    }
+
+    if (!parser.isSet(outputOption)) {
+        qCritical() << "An output directory is required";
+        _returnCode = 2;
+        return;
+    }
+    _outputPath = parser.value(outputOption);
+    if (!QDir().mkpath(_outputPath)) {
+        qCritical() << "Could not create output directory:" << _outputPath;
+        _returnCode = 2;
+        return;
+    }
+
+    _baseUrl = parser.value(baseUrlOption);
+    while (_baseUrl.endsWith("/")) {
+        _baseUrl.chop(1);
+    }
+
+    for (const QString& name : parser.value(textureTypesOption).split(",", QString::SkipEmptyParts)) {
+        bool ok;
+        auto type = textureTypeForName(name.trimmed().toLower(), ok);
+        if (!ok) {
+            qCritical() << "Unknown texture type:" << name;
+            _returnCode = 2;
+            return;
+        }
+        _textureTypes.append(type);
+    }
+
+    _maxTexturePixels = parser.value(maxTexturePixelsOption).toInt();
+    if (_maxTexturePixels <= 0) {
+        qCritical() << "Invalid downscale limit:" << parser.value(maxTexturePixelsOption);
+        _returnCode = 2;
+        return;
+    }
+
+    // baked entries are written in the exact on-disk layout of the client-side caches
+    TextureTranscodeCache::setCacheDirectory(_outputPath + "/processed_textures");
+    CompiledGeometryCache::setCacheDirectory(_outputPath + "/compiled_geometry");
+    QDir().mkpath(_outputPath + "/processed_sounds");
+
+    QDirIterator it(inputDir.absolutePath(), QDir::Files | QDir::Readable, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        QString filePath = it.next();
+        QString relativePath = inputDir.relativeFilePath(filePath);
+        QString extension = it.fileInfo().suffix().toLower();
+
+        bool baked = false;
+        if (MODEL_EXTENSIONS.contains(extension)) {
+            baked = bakeModel(filePath, relativePath);
+        } else if (IMAGE_EXTENSIONS.contains(extension)) {
+            baked = bakeTexture(filePath, relativePath);
+        } else if (SOUND_EXTENSIONS.contains(extension)) {
+            baked = bakeSound(filePath, relativePath);
+        } else {
+            continue; // not bakeable content, leave it to be served as-is
+        }
+
+        if (baked) {
+            _bakedCount++;
+        } else {
+            _failedCount++;
+        }
+    }
+
+    QJsonObject manifest;
+    manifest["version"] = 1;
+    if (!_baseUrl.isEmpty()) {
+        manifest["baseUrl"] = _baseUrl;
+    }
+    manifest["assets"] = _manifestEntries;
+
+    QFile manifestFile(_outputPath + "/baked-manifest.json");
+    if (!manifestFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCritical() << "Could not write manifest to" << manifestFile.fileName();
+        _returnCode = 3;
+        return;
+    }
+    manifestFile.write(QJsonDocument(manifest).toJson());
+
+    qInfo() << "Baked" << _bakedCount << "assets," << _failedCount << "failures, manifest at"
+        << manifestFile.fileName();
+    if (_failedCount > 0) {
+        _returnCode = 3;
+    }
+}
+
+bool ContentBakerApp::bakeModel(const QString& filePath, const QString& relativePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not read" << relativePath;
+        return false;
+    }
+    QByteArray content = file.readAll();
+
+    // an empty mapping matches a model loaded without an FST, the common case for raw
+    // domain content; mapped loads miss the bake and compile on the client as before
+    QString key = CompiledGeometryCache::evalCacheKey(content, QVariantHash());
+
+    std::unique_ptr<FBXGeometry> geometry;
+    try {
+        if (relativePath.toLower().endsWith(".obj")) {
+            geometry.reset(OBJReader().readOBJ(content, QVariantHash()));
+        } else {
+            geometry.reset(readFBX(content, QVariantHash(), relativePath));
+        }
+    } catch (const QString& error) {
+        qWarning() << "Could not parse" << relativePath << "-" << error;
+        return false;
+    }
+
+    if (!geometry || !CompiledGeometryCache::write(key, *geometry)) {
+        qWarning() << "Could not compile" << relativePath;
+        return false;
+    }
+
+    if (_verbose) {
+        qInfo() << "Compiled" << relativePath;
+    }
+    QJsonObject entry;
+    entry["path"] = relativePath;
+    entry["type"] = QString("model");
+    entry["key"] = key;
+    entry["baked"] = "compiled_geometry/" + key + ".hgc";
+    _manifestEntries.append(entry);
+    return true;
+}
+
+bool ContentBakerApp::bakeTexture(const QString& filePath, const QString& relativePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not read" << relativePath;
+        return false;
+    }
+    QByteArray content = file.readAll();
+
+    auto extension = relativePath.mid(relativePath.lastIndexOf('.') + 1).toStdString();
+    for (auto type : _textureTypes) {
+        QString key = TextureTranscodeCache::evalCacheKey(content, type, _maxTexturePixels);
+
+        QImage image = QImage::fromData(content, extension.c_str());
+        int imageWidth = image.width();
+        int imageHeight = image.height();
+        if (imageWidth == 0 || imageHeight == 0 || image.format() == QImage::Format_Invalid) {
+            qWarning() << "Could not decode" << relativePath;
+            return false;
+        }
+
+        // the same downscale the client applies, so the processed bytes match
+        if (imageWidth * imageHeight > _maxTexturePixels) {
+            float scaleFactor = sqrtf(_maxTexturePixels / (float)(imageWidth * imageHeight));
+            imageWidth = (int)(scaleFactor * (float)imageWidth + 0.5f);
+            imageHeight = (int)(scaleFactor * (float)imageHeight + 0.5f);
+            QImage newImage = image.scaled(QSize(imageWidth, imageHeight),
+                Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+            image.swap(newImage);
+        }
+
+        auto loader = getTextureLoaderForType(type);
+        gpu::TexturePointer texture(loader(image, relativePath.toStdString()));
+        if (!texture || !TextureTranscodeCache::write(key, texture, imageWidth, imageHeight)) {
+            qWarning() << "Could not process" << relativePath << "as texture type" << type;
+            return false;
+        }
+
+        if (_verbose) {
+            qInfo() << "Processed" << relativePath << "as texture type" << type;
+        }
+        QJsonObject entry;
+        entry["path"] = relativePath;
+        entry["type"] = QString("texture");
+        entry["textureType"] = (int)type;
+        entry["key"] = key;
+        entry["baked"] = "processed_textures/" + key + ".htc";
+        _manifestEntries.append(entry);
+    }
+    return true;
+}
+
+bool ContentBakerApp::bakeSound(const QString& filePath, const QString& relativePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not read" << relativePath;
+        return false;
+    }
+    QByteArray content = file.readAll();
+
+    bool isStereo = false;
+    bool isAmbisonic = false;
+    float duration = 0.0f;
+    QByteArray samples = Sound::processSoundData(content, relativePath.mid(relativePath.lastIndexOf('/') + 1).toLower(),
+        isStereo, isAmbisonic, duration);
+    if (samples.isEmpty()) {
+        qWarning() << "Could not process" << relativePath;
+        return false;
+    }
+
+    // with a base URL the baked file carries the name the client cache derives from the
+    // source URL, so it can be dropped straight into place; otherwise it is content-addressed
+    QString bakedName = _baseUrl.isEmpty()
+        ? QString(QCryptographicHash::hash(content, QCryptographicHash::Md5).toHex()) + ".hfsp"
+        : Sound::processedFileName(QUrl(_baseUrl + "/" + relativePath));
+
+    if (!Sound::writeProcessedFile(_outputPath + "/processed_sounds/" + bakedName, content, samples,
+            isStereo, isAmbisonic, duration)) {
+        qWarning() << "Could not write processed sound for" << relativePath;
+        return false;
+    }
+
+    if (_verbose) {
+        qInfo() << "Processed" << relativePath;
+    }
+    QJsonObject entry;
+    entry["path"] = relativePath;
+    entry["type"] = QString("sound");
+    entry["baked"] = "processed_sounds/" + bakedName;
+    _manifestEntries.append(entry);
+    return true;
+}
@@ -0,0 +1,49 @@
+//
+//  ContentBakerApp.h
+//  tools/content-baker/src
+//
+//  Created by Ryan Huffman on 12/12/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ContentBakerApp_h
+#define hifi_ContentBakerApp_h
+
+#include <QCoreApplication>
+#include <QtCore/QJsonArray>
+
+#include <TextureCache.h>
+
+// Pre-processes a directory of domain content into the formats clients build at load
+// time - compiled geometry for models, processed mips for textures, mixer-native samples
+// for sounds - and emits a manifest describing the baked files. The baked entries are
+// byte-identical to what a client's own processing caches would produce, so a client
+// that obtains them skips the load-time transcode entirely.
+class ContentBakerApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    ContentBakerApp(int argc, char* argv[]);
+
+    int getReturnCode() const { return _returnCode; }
+
+private:
+    bool bakeModel(const QString& filePath, const QString& relativePath);
+    bool bakeTexture(const QString& filePath, const QString& relativePath);
+    bool bakeSound(const QString& filePath, const QString& relativePath);
+
+    QString _outputPath;
+    QString _baseUrl;
+    QList<NetworkTexture::Type> _textureTypes;
+    int _maxTexturePixels { ABSOLUTE_MAX_TEXTURE_NUM_PIXELS };
+    bool _verbose { false };
+
+    QJsonArray _manifestEntries;
+    int _bakedCount { 0 };
+    int _failedCount { 0 };
+    int _returnCode { 0 };
+};
+
+#endif // hifi_ContentBakerApp_h
@@ -0,0 +1,17 @@
+//
+//  main.cpp
+//  tools/content-baker/src
+//
+//  Created by Ryan Huffman on 12/12/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContentBakerApp.h"
+
+int main(int argc, char * argv[]) {
+    ContentBakerApp app(argc, argv);
+    return app.getReturnCode();
+}
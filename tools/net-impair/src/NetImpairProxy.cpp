@@ -0,0 +1,326 @@
+//
+//  NetImpairProxy.cpp
+//  tools/net-impair/src
+//
+//  Created by Stephen Birarda on 8/28/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "NetImpairProxy.h"
+
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+const QCommandLineOption PORT_OPTION { "port", "listen port for the proxied client", "port" };
+const QCommandLineOption TARGET_OPTION { "target", "proxied server, as host:port", "host:port" };
+const QCommandLineOption DELAY_OPTION { "delay", "one-way delay in msecs, both directions", "msecs" };
+const QCommandLineOption JITTER_OPTION { "jitter", "uniform +/- jitter in msecs, both directions", "msecs" };
+const QCommandLineOption LOSS_OPTION { "loss", "datagram loss percentage, both directions", "percent" };
+const QCommandLineOption REORDER_OPTION { "reorder", "datagram reorder percentage, both directions", "percent" };
+const QCommandLineOption BANDWIDTH_OPTION { "bandwidth", "bandwidth cap in kbps, both directions", "kbps" };
+const QCommandLineOption UP_DELAY_OPTION { "up-delay", "one-way delay in msecs, client to server", "msecs" };
+const QCommandLineOption UP_JITTER_OPTION { "up-jitter", "uniform +/- jitter in msecs, client to server", "msecs" };
+const QCommandLineOption UP_LOSS_OPTION { "up-loss", "datagram loss percentage, client to server", "percent" };
+const QCommandLineOption UP_REORDER_OPTION { "up-reorder", "datagram reorder percentage, client to server", "percent" };
+const QCommandLineOption UP_BANDWIDTH_OPTION { "up-bandwidth", "bandwidth cap in kbps, client to server", "kbps" };
+const QCommandLineOption DOWN_DELAY_OPTION { "down-delay", "one-way delay in msecs, server to client", "msecs" };
+const QCommandLineOption DOWN_JITTER_OPTION { "down-jitter", "uniform +/- jitter in msecs, server to client", "msecs" };
+const QCommandLineOption DOWN_LOSS_OPTION { "down-loss", "datagram loss percentage, server to client", "percent" };
+const QCommandLineOption DOWN_REORDER_OPTION { "down-reorder", "datagram reorder percentage, server to client", "percent" };
+const QCommandLineOption DOWN_BANDWIDTH_OPTION { "down-bandwidth", "bandwidth cap in kbps, server to client", "kbps" };
+const QCommandLineOption QUEUE_LIMIT_OPTION { "queue-limit", "drop datagrams the bandwidth cap would delay past this, in msecs", "msecs" };
+const QCommandLineOption SCHEDULE_OPTION { "schedule", "JSON file of timed impairment changes", "file" };
+const QCommandLineOption STATS_INTERVAL_OPTION { "stats-interval", "stats output interval in msecs", "msecs" };
+
+static const int DEFAULT_STATS_INTERVAL_MSECS = 1000;
+
+// the extra hold applied to a reordered datagram, as a multiple of the jitter interval
+static const float REORDER_HOLD_MULTIPLIER = 2.0f;
+static const float MINIMUM_REORDER_HOLD_MSECS = 10.0f;
+
+NetImpairProxy::NetImpairProxy(int& argc, char** argv) :
+    QCoreApplication(argc, argv)
+{
+    parseArguments();
+
+    _startTimeUsecs = usecTimestampNow();
+
+    connect(&_clientSocket, &QUdpSocket::readyRead, this, &NetImpairProxy::readClientSocket);
+    connect(&_serverSocket, &QUdpSocket::readyRead, this, &NetImpairProxy::readServerSocket);
+
+    _deliveryTimer.setSingleShot(true);
+    _deliveryTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_deliveryTimer, &QTimer::timeout, this, &NetImpairProxy::deliverStagedDatagrams);
+
+    connect(&_statsTimer, &QTimer::timeout, this, &NetImpairProxy::printStats);
+    _statsTimer.start(_argumentParser.isSet(STATS_INTERVAL_OPTION)
+                      ? _argumentParser.value(STATS_INTERVAL_OPTION).toInt() : DEFAULT_STATS_INTERVAL_MSECS);
+
+    // arm the scheduled phases relative to startup
+    for (const SchedulePhase& phase : _schedule) {
+        QTimer::singleShot((int) phase.atMsecs, this, [this, phase] { applyPhase(phase); });
+    }
+}
+
+void NetImpairProxy::parseArguments() {
+    _argumentParser.setApplicationDescription("High Fidelity UDP network impairment proxy");
+    _argumentParser.addHelpOption();
+
+    _argumentParser.addOptions({
+        PORT_OPTION, TARGET_OPTION,
+        DELAY_OPTION, JITTER_OPTION, LOSS_OPTION, REORDER_OPTION, BANDWIDTH_OPTION,
+        UP_DELAY_OPTION, UP_JITTER_OPTION, UP_LOSS_OPTION, UP_REORDER_OPTION, UP_BANDWIDTH_OPTION,
+        DOWN_DELAY_OPTION, DOWN_JITTER_OPTION, DOWN_LOSS_OPTION, DOWN_REORDER_OPTION, DOWN_BANDWIDTH_OPTION,
+        QUEUE_LIMIT_OPTION, SCHEDULE_OPTION, STATS_INTERVAL_OPTION
+    });
+
+    if (!_argumentParser.parse(arguments())) {
+        qCritical() << _argumentParser.errorText();
+        _argumentParser.showHelp(1);
+    }
+
+    if (_argumentParser.isSet("help")) {
+        _argumentParser.showHelp(0);
+    }
+
+    if (!_argumentParser.isSet(PORT_OPTION) || !_argumentParser.isSet(TARGET_OPTION)) {
+        qCritical() << "Both --port and --target are required";
+        _argumentParser.showHelp(1);
+    }
+
+    auto targetParts = _argumentParser.value(TARGET_OPTION).split(':');
+    if (targetParts.size() != 2) {
+        qCritical() << "Could not parse target" << _argumentParser.value(TARGET_OPTION) << "as host:port";
+        _argumentParser.showHelp(1);
+    }
+    _serverAddr = HifiSockAddr(targetParts[0], (quint16) targetParts[1].toUInt(), true);
+    if (_serverAddr.isNull()) {
+        qCritical() << "Failed to lookup target host" << targetParts[0];
+        QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+        return;
+    }
+
+    quint16 listenPort = (quint16) _argumentParser.value(PORT_OPTION).toUInt();
+    if (!_clientSocket.bind(QHostAddress::AnyIPv4, listenPort)) {
+        qCritical() << "Failed to bind listen port" << listenPort;
+        QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+        return;
+    }
+    _serverSocket.bind(QHostAddress::AnyIPv4, 0);
+
+    // the base options seed both directions, the per-direction options override
+    auto floatOption = [this](const QCommandLineOption& option, float& value) {
+        if (_argumentParser.isSet(option)) {
+            value = _argumentParser.value(option).toFloat();
+        }
+    };
+    auto intOption = [this](const QCommandLineOption& option, int& value) {
+        if (_argumentParser.isSet(option)) {
+            value = _argumentParser.value(option).toInt();
+        }
+    };
+
+    for (ImpairmentProfile* profile : { &_upProfile, &_downProfile }) {
+        floatOption(DELAY_OPTION, profile->delayMsecs);
+        floatOption(JITTER_OPTION, profile->jitterMsecs);
+        floatOption(LOSS_OPTION, profile->lossPercent);
+        floatOption(REORDER_OPTION, profile->reorderPercent);
+        intOption(BANDWIDTH_OPTION, profile->bandwidthKbps);
+    }
+
+    floatOption(UP_DELAY_OPTION, _upProfile.delayMsecs);
+    floatOption(UP_JITTER_OPTION, _upProfile.jitterMsecs);
+    floatOption(UP_LOSS_OPTION, _upProfile.lossPercent);
+    floatOption(UP_REORDER_OPTION, _upProfile.reorderPercent);
+    intOption(UP_BANDWIDTH_OPTION, _upProfile.bandwidthKbps);
+
+    floatOption(DOWN_DELAY_OPTION, _downProfile.delayMsecs);
+    floatOption(DOWN_JITTER_OPTION, _downProfile.jitterMsecs);
+    floatOption(DOWN_LOSS_OPTION, _downProfile.lossPercent);
+    floatOption(DOWN_REORDER_OPTION, _downProfile.reorderPercent);
+    intOption(DOWN_BANDWIDTH_OPTION, _downProfile.bandwidthKbps);
+
+    floatOption(QUEUE_LIMIT_OPTION, _queueLimitMsecs);
+
+    if (_argumentParser.isSet(SCHEDULE_OPTION)) {
+        loadSchedule(_argumentParser.value(SCHEDULE_OPTION));
+    }
+
+    qInfo() << "Proxying client datagrams on port" << listenPort
+            << "to" << _serverAddr << "with" << (int) _schedule.size() << "scheduled phases";
+}
+
+void NetImpairProxy::loadSchedule(const QString& filename) {
+    QFile scheduleFile { filename };
+    if (!scheduleFile.open(QIODevice::ReadOnly)) {
+        qCritical() << "Could not open schedule file" << filename;
+        return;
+    }
+
+    QJsonParseError parseError;
+    auto document = QJsonDocument::fromJson(scheduleFile.readAll(), &parseError);
+    if (document.isNull() || !document.isArray()) {
+        qCritical() << "Could not parse schedule file" << filename << "-" << parseError.errorString();
+        return;
+    }
+
+    for (const auto& value : document.array()) {
+        auto entry = value.toObject();
+        SchedulePhase phase;
+        phase.atMsecs = (quint64) (entry["time"].toDouble() * MSECS_PER_SECOND);
+        auto direction = entry["direction"].toString("both");
+        phase.affectsUp = (direction == "up" || direction == "both");
+        phase.affectsDown = (direction == "down" || direction == "both");
+        phase.changes = entry;
+        _schedule.push_back(phase);
+    }
+}
+
+void NetImpairProxy::applyChanges(ImpairmentProfile& profile, const QJsonObject& changes) {
+    // each phase overrides only the keys it names
+    if (changes.contains("delay")) {
+        profile.delayMsecs = (float) changes["delay"].toDouble();
+    }
+    if (changes.contains("jitter")) {
+        profile.jitterMsecs = (float) changes["jitter"].toDouble();
+    }
+    if (changes.contains("loss")) {
+        profile.lossPercent = (float) changes["loss"].toDouble();
+    }
+    if (changes.contains("reorder")) {
+        profile.reorderPercent = (float) changes["reorder"].toDouble();
+    }
+    if (changes.contains("bandwidth")) {
+        profile.bandwidthKbps = changes["bandwidth"].toInt();
+    }
+}
+
+void NetImpairProxy::applyPhase(const SchedulePhase& phase) {
+    if (phase.affectsUp) {
+        applyChanges(_upProfile, phase.changes);
+    }
+    if (phase.affectsDown) {
+        applyChanges(_downProfile, phase.changes);
+    }
+
+    qInfo().nospace() << "Phase at " << (phase.atMsecs / MSECS_PER_SECOND) << "s applied"
+        << " - up { delay: " << _upProfile.delayMsecs << " jitter: " << _upProfile.jitterMsecs
+        << " loss: " << _upProfile.lossPercent << " reorder: " << _upProfile.reorderPercent
+        << " bandwidth: " << _upProfile.bandwidthKbps << " }"
+        << " down { delay: " << _downProfile.delayMsecs << " jitter: " << _downProfile.jitterMsecs
+        << " loss: " << _downProfile.lossPercent << " reorder: " << _downProfile.reorderPercent
+        << " bandwidth: " << _downProfile.bandwidthKbps << " }";
+}
+
+void NetImpairProxy::readClientSocket() {
+    while (_clientSocket.hasPendingDatagrams()) {
+        QByteArray payload;
+        payload.resize(_clientSocket.pendingDatagramSize());
+
+        QHostAddress senderAddress;
+        quint16 senderPort;
+        _clientSocket.readDatagram(payload.data(), payload.size(), &senderAddress, &senderPort);
+
+        // the first datagram on the listen port pins the client we proxy for
+        if (_clientAddr.isNull()) {
+            _clientAddr = HifiSockAddr(senderAddress, senderPort);
+            qInfo() << "Pinned client" << _clientAddr;
+        }
+
+        stageDatagram(payload, true);
+    }
+}
+
+void NetImpairProxy::readServerSocket() {
+    while (_serverSocket.hasPendingDatagrams()) {
+        QByteArray payload;
+        payload.resize(_serverSocket.pendingDatagramSize());
+        _serverSocket.readDatagram(payload.data(), payload.size());
+
+        stageDatagram(payload, false);
+    }
+}
+
+void NetImpairProxy::stageDatagram(const QByteArray& payload, bool toServer) {
+    ImpairmentProfile& profile = toServer ? _upProfile : _downProfile;
+    int& dropped = toServer ? _upDropped : _downDropped;
+
+    if (profile.lossPercent > 0.0f && _percentDistribution(_generator) < profile.lossPercent) {
+        ++dropped;
+        return;
+    }
+
+    quint64 now = usecTimestampNow();
+    float delayMsecs = profile.delayMsecs + profile.jitterMsecs * _jitterDistribution(_generator);
+
+    if (profile.reorderPercent > 0.0f && _percentDistribution(_generator) < profile.reorderPercent) {
+        // hold this datagram back long enough that later arrivals overtake it
+        delayMsecs += std::max(REORDER_HOLD_MULTIPLIER * profile.jitterMsecs, MINIMUM_REORDER_HOLD_MSECS);
+    }
+
+    quint64 dueTimeUsecs = now + (quint64) std::max(delayMsecs * USECS_PER_MSEC, 0.0f);
+
+    if (profile.bandwidthKbps > 0) {
+        // serialize through the token bucket - each datagram occupies the link for
+        // its transmission time at the capped rate
+        quint64& nextClearUsecs = toServer ? _upNextClearUsecs : _downNextClearUsecs;
+        quint64 transmitUsecs = (quint64) payload.size() * BITS_IN_BYTE * USECS_PER_MSEC / profile.bandwidthKbps;
+
+        dueTimeUsecs = std::max(dueTimeUsecs, nextClearUsecs);
+        if (dueTimeUsecs - now > (quint64) (_queueLimitMsecs * USECS_PER_MSEC)) {
+            // the shaping queue is full - tail drop, like a congested router
+            ++dropped;
+            return;
+        }
+        nextClearUsecs = dueTimeUsecs + transmitUsecs;
+    }
+
+    _stagedDatagrams.push({ dueTimeUsecs, payload, toServer });
+    armDeliveryTimer();
+}
+
+void NetImpairProxy::deliverStagedDatagrams() {
+    quint64 now = usecTimestampNow();
+
+    while (!_stagedDatagrams.empty() && _stagedDatagrams.top().dueTimeUsecs <= now) {
+        const StagedDatagram& staged = _stagedDatagrams.top();
+
+        if (staged.toServer) {
+            _serverSocket.writeDatagram(staged.payload, _serverAddr.getAddress(), _serverAddr.getPort());
+            ++_upForwarded;
+        } else if (!_clientAddr.isNull()) {
+            _clientSocket.writeDatagram(staged.payload, _clientAddr.getAddress(), _clientAddr.getPort());
+            ++_downForwarded;
+        }
+
+        _stagedDatagrams.pop();
+    }
+
+    armDeliveryTimer();
+}
+
+void NetImpairProxy::armDeliveryTimer() {
+    if (_stagedDatagrams.empty()) {
+        return;
+    }
+
+    quint64 now = usecTimestampNow();
+    quint64 dueTimeUsecs = _stagedDatagrams.top().dueTimeUsecs;
+    _deliveryTimer.start(dueTimeUsecs > now ? (int) ((dueTimeUsecs - now) / USECS_PER_MSEC) : 0);
+}
+
+void NetImpairProxy::printStats() {
+    qInfo().nospace() << "up { forwarded: " << _upForwarded << " dropped: " << _upDropped << " }"
+        << " down { forwarded: " << _downForwarded << " dropped: " << _downDropped << " }"
+        << " staged: " << (int) _stagedDatagrams.size();
+
+    _upForwarded = _upDropped = _downForwarded = _downDropped = 0;
+}
@@ -0,0 +1,129 @@
+//
+//  NetImpairProxy.h
+//  tools/net-impair/src
+//
+//  Created by Stephen Birarda on 8/28/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_NetImpairProxy_h
+#define hifi_NetImpairProxy_h
+
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTimer>
+#include <QtNetwork/QUdpSocket>
+
+#include <HifiSockAddr.h>
+
+// A UDP proxy that forwards datagrams between one client and one server while applying
+// configurable impairments per direction - delay with jitter, random loss, reordering
+// and a bandwidth cap - so congestion control, send pacing and jitter buffer changes
+// can be validated against reproducible network conditions.
+//
+// Point the client at the proxy's listen port instead of the real server port and run
+// one instance per proxied service (domain-server, audio-mixer, ...). The first
+// datagram to arrive on the listen port pins the client address; replies from the
+// server are impaired on the way back and forwarded there.
+//
+// A JSON schedule file can change the impairments while the proxy runs, to replay
+// recorded real-world condition profiles:
+//     [
+//         { "time": 0, "direction": "both", "delay": 40, "jitter": 10 },
+//         { "time": 30, "direction": "up", "loss": 2.5, "bandwidth": 256 },
+//         { "time": 60, "direction": "both", "delay": 150, "reorder": 1 }
+//     ]
+// Each entry fires "time" seconds after startup and overrides only the keys present.
+
+// one set of impairments for one direction of the proxied link
+struct ImpairmentProfile {
+    float delayMsecs { 0.0f }; // fixed one-way delay added to every datagram
+    float jitterMsecs { 0.0f }; // uniform +/- jitter around the fixed delay
+    float lossPercent { 0.0f }; // percentage of datagrams silently dropped
+    float reorderPercent { 0.0f }; // percentage of datagrams held back past their successors
+    int bandwidthKbps { 0 }; // token bucket cap in kilobits per second, 0 for unlimited
+};
+
+class NetImpairProxy : public QCoreApplication {
+    Q_OBJECT
+public:
+    NetImpairProxy(int& argc, char** argv);
+
+private slots:
+    void readClientSocket();
+    void readServerSocket();
+    void deliverStagedDatagrams();
+    void printStats();
+
+private:
+    // a datagram held back until its impaired delivery time
+    struct StagedDatagram {
+        quint64 dueTimeUsecs;
+        QByteArray payload;
+        bool toServer;
+
+        bool operator>(const StagedDatagram& other) const { return dueTimeUsecs > other.dueTimeUsecs; }
+    };
+
+    // a timed change to the impairment profiles, loaded from the schedule file
+    struct SchedulePhase {
+        quint64 atMsecs;
+        bool affectsUp;
+        bool affectsDown;
+        QJsonObject changes;
+    };
+
+    void parseArguments();
+    void loadSchedule(const QString& filename);
+    void applyPhase(const SchedulePhase& phase);
+    static void applyChanges(ImpairmentProfile& profile, const QJsonObject& changes);
+
+    void stageDatagram(const QByteArray& payload, bool toServer);
+    void armDeliveryTimer();
+
+    QCommandLineParser _argumentParser;
+
+    QUdpSocket _clientSocket; // bound to the listen port, talks to the client
+    QUdpSocket _serverSocket; // talks to the proxied server
+
+    HifiSockAddr _serverAddr; // the proxied server
+    HifiSockAddr _clientAddr; // pinned from the first datagram on the listen port
+
+    ImpairmentProfile _upProfile; // client to server
+    ImpairmentProfile _downProfile; // server to client
+
+    float _queueLimitMsecs { 500.0f }; // datagrams delayed past this by the bandwidth cap are dropped
+
+    std::priority_queue<StagedDatagram, std::vector<StagedDatagram>, std::greater<StagedDatagram>> _stagedDatagrams;
+    QTimer _deliveryTimer;
+
+    // when the token bucket will next admit a datagram, per direction
+    quint64 _upNextClearUsecs { 0 };
+    quint64 _downNextClearUsecs { 0 };
+
+    std::vector<SchedulePhase> _schedule;
+    quint64 _startTimeUsecs { 0 };
+
+    std::random_device _randomDevice;
+    std::mt19937 _generator { _randomDevice() };
+    std::uniform_real_distribution<float> _percentDistribution { 0.0f, 100.0f };
+    std::uniform_real_distribution<float> _jitterDistribution { -1.0f, 1.0f };
+
+    QTimer _statsTimer;
+    int _upForwarded { 0 };
+    int _upDropped { 0 };
+    int _downForwarded { 0 };
+    int _downDropped { 0 };
+};
+
+#endif // hifi_NetImpairProxy_h
@@ -0,0 +1,18 @@
+//
+//  main.cpp
+//  tools/net-impair/src
+//
+//  Created by Stephen Birarda on 8/28/16.
+//  Copyright 2016 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+
+#include <QtCore/QCoreApplication>
+
+#include "NetImpairProxy.h"
+
+int main(int argc, char* argv[]) {
+    NetImpairProxy app(argc, argv);
+    return app.exec();
+}
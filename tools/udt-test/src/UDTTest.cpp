@@ -13,6 +13,8 @@
 
 #include <QtCore/QDebug>
 
+#include <udt/BBRCC.h>
+#include <udt/CongestionControl.h>
 #include <udt/Constants.h>
 #include <udt/Packet.h>
 #include <udt/PacketList.h>
@@ -55,6 +57,12 @@ const QCommandLineOption MESSAGE_SEED {
 const QCommandLineOption STATS_INTERVAL {
     "stats-interval", "stats output interval (default is 100ms)", "milliseconds"
 };
+const QCommandLineOption CONGESTION_CONTROL {
+    "congestion-control", "congestion control to use for connections - vegas (default) or bbr", "controller"
+};
+const QCommandLineOption TRACE_PACKETS {
+    "trace-packets", "record a wire-level trace of all sent and received packets to this file", "filepath"
+};
 
 const QStringList CLIENT_STATS_TABLE_HEADERS {
     "Send (Mb/s)", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)", "Period (us)",
@@ -80,7 +88,28 @@ UDTTest::UDTTest(int& argc, char** argv) :
 
     _socket.bind(QHostAddress::AnyIPv4, _argumentParser.value(PORT_OPTION).toUInt());
     qDebug() << "Test socket is listening on" << _socket.localPort();
-    
+
+    if (_argumentParser.isSet(CONGESTION_CONTROL)) {
+        // swap the congestion control factory on the socket before any connections are created
+        QString controller = _argumentParser.value(CONGESTION_CONTROL).toLower();
+
+        if (controller == "bbr") {
+            _socket.setCongestionControlFactory(std::unique_ptr<udt::CongestionControlVirtualFactory>(
+                new udt::CongestionControlFactory<udt::BBRCC>()));
+            qDebug() << "Connections will use BBR style congestion control";
+        } else if (controller != "vegas") {
+            qCritical() << "Unknown congestion control" << controller << "- the options are vegas or bbr";
+            QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+        }
+    }
+
+    if (_argumentParser.isSet(TRACE_PACKETS)) {
+        if (!_socket.startPacketTrace(_argumentParser.value(TRACE_PACKETS))) {
+            qCritical() << "Could not open" << _argumentParser.value(TRACE_PACKETS) << "for packet trace output";
+            QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+        }
+    }
+
     if (_argumentParser.isSet(TARGET_OPTION)) {
         // parse the IP and port combination for this target
         QString hostnamePortString = _argumentParser.value(TARGET_OPTION);
@@ -228,7 +257,7 @@ void UDTTest::parseArguments() {
     _argumentParser.addOptions({
         PORT_OPTION, TARGET_OPTION, PACKET_SIZE, MIN_PACKET_SIZE, MAX_PACKET_SIZE,
         MAX_SEND_BYTES, MAX_SEND_PACKETS, UNRELIABLE_PACKETS, ORDERED_PACKETS,
-        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL
+        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL, CONGESTION_CONTROL, TRACE_PACKETS
     });
     
     if (!_argumentParser.parse(arguments())) {